@@ -138,6 +138,62 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getdecimalprecision(Lib3MF_Writer pWr
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setdecimalprecision(Lib3MF_Writer pWriter, Lib3MF_uint32 nDecimalPrecision);
 
+/**
+* Activates (deactivates) the shortest round-trip output of mesh coordinates and radii. Each value is written with the fewest digits that read back as exactly the same number; the decimal precision is ignored while active.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] bShortestRoundtripActive - flag whether shortest round-trip output is active or not.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setshortestroundtripactive(Lib3MF_Writer pWriter, bool bShortestRoundtripActive);
+
+/**
+* Queries whether the shortest round-trip output of mesh coordinates and radii is active or not.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pShortestRoundtripActive - returns flag whether shortest round-trip output is active or not.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getshortestroundtripactive(Lib3MF_Writer pWriter, bool * pShortestRoundtripActive);
+
+/**
+* Sets the number of threads the writer may use to compress package parts and to render large meshes. 0 selects the number of hardware threads, 1 disables parallel writing.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nThreadCount - Number of threads, including the calling thread. 0 means automatic.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setworkerthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads the writer may use to compress package parts and to render large meshes.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pThreadCount - Number of threads, including the calling thread. 0 means automatic.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getworkerthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Sets the compression of all parts of a kind. Already compressed images are best stored without compression.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] ePartType - The kind of parts to configure.
+* @param[in] eLevel - The compression level. Defaults to Fastest for all kinds of parts. Once it is set, encrypted parts are deflated with it before encryption and stored without further compression.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_setcompressionlevel(Lib3MF_Writer pWriter, eLib3MFPackagePartType ePartType, eLib3MFCompressionLevel eLevel);
+
+/**
+* Returns the compression of all parts of a kind.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] ePartType - The kind of parts to query.
+* @param[out] pLevel - The compression level.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_writer_getcompressionlevel(Lib3MF_Writer pWriter, eLib3MFPackagePartType ePartType, eLib3MFCompressionLevel * pLevel);
+
 /**
 * Activates (deactivates) the strict mode of the reader.
 *
@@ -280,6 +336,54 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setstrictmodeactive(Lib3MF_Reader pRe
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_getstrictmodeactive(Lib3MF_Reader pReader, bool * pStrictModeActive);
 
+/**
+* Sets the number of threads the reader may use to decode mesh data. 0 selects the number of hardware threads. With 1 (the default), vertex and triangle lists are still decoded by the streaming mesh decoder, but on the calling thread only.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] nThreadCount - Number of threads, including the calling thread. 0 means automatic.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setworkerthreadcount(Lib3MF_Reader pReader, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads the reader may use to decode mesh data.
+*
+* @param[in] pReader - Reader instance.
+* @param[out] pThreadCount - Number of threads, including the calling thread. 0 means automatic.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_getworkerthreadcount(Lib3MF_Reader pReader, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Hands the vertices and triangles of all mesh objects to callbacks in blocks while they are read. Blocks of one mesh object are delivered in document order, and vertices are delivered before the triangles that refer to them. If the geometry is not retained, the meshes of the read model stay empty, while objects, components and build items are still read. Beam lattices and triangle sets require the geometry to be retained.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] pTheVertexBlockCallback - Callback to call for every block of vertices. May be null.
+* @param[in] pTheTriangleBlockCallback - Callback to call for every block of triangles. May be null.
+* @param[in] bRetainGeometry - If true, the geometry is read into the model as well.
+* @param[in] pUserData - Userdata that is passed to the callback functions
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setmeshstreamcallbacks(Lib3MF_Reader pReader, Lib3MFVertexBlockCallback pTheVertexBlockCallback, Lib3MFTriangleBlockCallback pTheTriangleBlockCallback, bool bRetainGeometry, Lib3MF_pvoid pUserData);
+
+/**
+* Defers parsing the geometry of mesh objects until it is first accessed. The model part is kept in memory after reading, and each mesh is parsed from it on first access. Ignored if mesh stream callbacks are set.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] bLazyMeshLoadingActive - Flag whether mesh geometry is parsed on first access
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setlazymeshloadingactive(Lib3MF_Reader pReader, bool bLazyMeshLoadingActive);
+
+/**
+* Returns whether mesh geometry is parsed on first access.
+*
+* @param[in] pReader - Reader instance.
+* @param[out] pLazyMeshLoadingActive - Flag whether mesh geometry is parsed on first access
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_getlazymeshloadingactive(Lib3MF_Reader pReader, bool * pLazyMeshLoadingActive);
+
 /**
 * Returns Warning and Error Information of the read process
 *
@@ -323,6 +427,66 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_addkeywrappingcallback(Lib3MF_Reader
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_reader_setcontentencryptioncallback(Lib3MF_Reader pReader, Lib3MFContentEncryptionCallback pTheCallback, Lib3MF_pvoid pUserData);
 
+/*************************************************************************************************************************
+ Class definition for StreamingWriter
+**************************************************************************************************************************/
+
+/**
+* Starts a new mesh object. All of its vertices must be added before its triangles.
+*
+* @param[in] pStreamingWriter - StreamingWriter instance.
+* @param[in] pName - Name of the object. May be empty.
+* @param[out] pObjectID - Resource ID of the new mesh object.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_streamingwriter_beginmeshobject(Lib3MF_StreamingWriter pStreamingWriter, const char * pName, Lib3MF_uint32 * pObjectID);
+
+/**
+* Writes a batch of vertices of the current mesh object. Vertex indices continue over all batches of the object.
+*
+* @param[in] pStreamingWriter - StreamingWriter instance.
+* @param[in] nVerticesBufferSize - Number of elements in buffer
+* @param[in] pVerticesBuffer - Position buffer of Positions of the vertices
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_streamingwriter_addvertices(Lib3MF_StreamingWriter pStreamingWriter, Lib3MF_uint64 nVerticesBufferSize, const sLib3MFPosition * pVerticesBuffer);
+
+/**
+* Writes a batch of triangles of the current mesh object. No further vertices may be added to the object afterwards.
+*
+* @param[in] pStreamingWriter - StreamingWriter instance.
+* @param[in] nIndicesBufferSize - Number of elements in buffer
+* @param[in] pIndicesBuffer - Triangle buffer of Vertex indices of the triangles. They must refer to vertices, which have already been added to the object.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_streamingwriter_addtriangles(Lib3MF_StreamingWriter pStreamingWriter, Lib3MF_uint64 nIndicesBufferSize, const sLib3MFTriangle * pIndicesBuffer);
+
+/**
+* Finishes the current mesh object.
+*
+* @param[in] pStreamingWriter - StreamingWriter instance.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_streamingwriter_endmeshobject(Lib3MF_StreamingWriter pStreamingWriter);
+
+/**
+* Adds a build item. It is written when the package is finished.
+*
+* @param[in] pStreamingWriter - StreamingWriter instance.
+* @param[in] nObjectID - Resource ID of a finished mesh object.
+* @param[in] pTransform - Transformation matrix.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_streamingwriter_addbuilditem(Lib3MF_StreamingWriter pStreamingWriter, Lib3MF_uint32 nObjectID, const sLib3MFTransform * pTransform);
+
+/**
+* Writes the build items and closes the package. No further calls are allowed afterwards.
+*
+* @param[in] pStreamingWriter - StreamingWriter instance.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_streamingwriter_finish(Lib3MF_StreamingWriter pStreamingWriter);
+
 /*************************************************************************************************************************
  Class definition for PackagePart
 **************************************************************************************************************************/
@@ -1202,6 +1366,27 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_meshobject_addvertex(Lib3MF_MeshObject pMesh
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_meshobject_getvertices(Lib3MF_MeshObject pMeshObject, const Lib3MF_uint64 nVerticesBufferSize, Lib3MF_uint64* pVerticesNeededCount, sLib3MFPosition * pVerticesBuffer);
 
+/**
+* Returns the number of pages in which the vertices of the mesh object are stored.
+*
+* @param[in] pMeshObject - MeshObject instance.
+* @param[out] pPageCount - the number of vertex pages.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_meshobject_getvertexpagecount(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 * pPageCount);
+
+/**
+* Returns direct read access to a page of vertices without copying them. The memory is owned by the mesh object, must not be written to and is only valid until the mesh is modified or released.
+*
+* @param[in] pMeshObject - MeshObject instance.
+* @param[in] nPageIndex - index of the page (0 to pagecount - 1).
+* @param[out] pVertexCount - number of vertices stored in the page.
+* @param[out] pStride - distance in bytes between two consecutive vertices.
+* @param[out] pCoordinates - pointer to the three single precision coordinates of the first vertex in the page.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_meshobject_getvertexpage(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nPageIndex, Lib3MF_uint32 * pVertexCount, Lib3MF_uint32 * pStride, Lib3MF_pvoid * pCoordinates);
+
 /**
 * Returns indices of a single triangle of a mesh object.
 *
@@ -1243,6 +1428,27 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_meshobject_addtriangle(Lib3MF_MeshObject pMe
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_meshobject_gettriangleindices(Lib3MF_MeshObject pMeshObject, const Lib3MF_uint64 nIndicesBufferSize, Lib3MF_uint64* pIndicesNeededCount, sLib3MFTriangle * pIndicesBuffer);
 
+/**
+* Returns the number of pages in which the triangles of the mesh object are stored.
+*
+* @param[in] pMeshObject - MeshObject instance.
+* @param[out] pPageCount - the number of triangle pages.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_meshobject_gettrianglepagecount(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 * pPageCount);
+
+/**
+* Returns direct read access to a page of triangles without copying them. The memory is owned by the mesh object, must not be written to and is only valid until the mesh is modified or released.
+*
+* @param[in] pMeshObject - MeshObject instance.
+* @param[in] nPageIndex - index of the page (0 to pagecount - 1).
+* @param[out] pTriangleCount - number of triangles stored in the page.
+* @param[out] pStride - distance in bytes between two consecutive triangles.
+* @param[out] pIndices - pointer to the three 32 bit vertex indices of the first triangle in the page.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_meshobject_gettrianglepage(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nPageIndex, Lib3MF_uint32 * pTriangleCount, Lib3MF_uint32 * pStride, Lib3MF_pvoid * pIndices);
+
 /**
 * Sets the property at the object-level of the mesh object.
 *
@@ -1325,6 +1531,17 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_meshobject_clearallproperties(Lib3MF_MeshObj
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_meshobject_setgeometry(Lib3MF_MeshObject pMeshObject, Lib3MF_uint64 nVerticesBufferSize, const sLib3MFPosition * pVerticesBuffer, Lib3MF_uint64 nIndicesBufferSize, const sLib3MFTriangle * pIndicesBuffer);
 
+/**
+* Preallocates memory for the given total numbers of vertices, triangles and beams, so that they can be added without further allocations.
+*
+* @param[in] pMeshObject - MeshObject instance.
+* @param[in] nVertexCount - number of vertices to reserve memory for.
+* @param[in] nTriangleCount - number of triangles to reserve memory for.
+* @param[in] nBeamCount - number of beams to reserve memory for.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_meshobject_reservegeometry(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nVertexCount, Lib3MF_uint32 nTriangleCount, Lib3MF_uint32 nBeamCount);
+
 /**
 * Retrieves, if an object describes a topologically oriented and manifold mesh, according to the core spec.
 *
@@ -1334,6 +1551,15 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_meshobject_setgeometry(Lib3MF_MeshObject pMe
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_meshobject_ismanifoldandoriented(Lib3MF_MeshObject pMeshObject, bool * pIsManifoldAndOriented);
 
+/**
+* Retrieves, if the geometry of an object has been loaded. Meshes read with lazy mesh loading are only loaded when their geometry is accessed for the first time.
+*
+* @param[in] pMeshObject - MeshObject instance.
+* @param[out] pIsGeometryLoaded - returns, if the geometry of the object has been loaded.
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_meshobject_isgeometryloaded(Lib3MF_MeshObject pMeshObject, bool * pIsGeometryLoaded);
+
 /**
 * Retrieves the BeamLattice within this MeshObject.
 *
@@ -4867,6 +5093,99 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_implicitfunction_clear(Lib3MF_ImplicitFuncti
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_implicitfunction_sortnodestopologically(Lib3MF_ImplicitFunction pImplicitFunction);
 
+/**
+* Compiles the function into an evaluator. Later changes of the function do not affect the evaluator.
+*
+* @param[in] pImplicitFunction - ImplicitFunction instance.
+* @param[out] pEvaluator - the evaluator
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_implicitfunction_createevaluator(Lib3MF_ImplicitFunction pImplicitFunction, Lib3MF_ImplicitEvaluator * pEvaluator);
+
+/*************************************************************************************************************************
+ Class definition for ImplicitEvaluator
+**************************************************************************************************************************/
+
+/**
+* Returns the number of input values per point. Vector inputs take 3 values, matrix inputs 16.
+*
+* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+* @param[out] pStride - number of input values per point
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_implicitevaluator_getinputstride(Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint32 * pStride);
+
+/**
+* Returns the number of output values per point. Vector outputs take 3 values, matrix outputs 16.
+*
+* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+* @param[out] pStride - number of output values per point
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_implicitevaluator_getoutputstride(Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint32 * pStride);
+
+/**
+* Sets the number of threads used by Evaluate. 0 selects the number of hardware threads, 1 (default) evaluates on the calling thread.
+*
+* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+* @param[in] nThreadCount - number of threads
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_implicitevaluator_setworkerthreadcount(Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads used by Evaluate.
+*
+* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+* @param[out] pThreadCount - number of threads
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_implicitevaluator_getworkerthreadcount(Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Evaluates the function for a batch of points. The input values of all function inputs of a point are stored consecutively, followed by the next point.
+*
+* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+* @param[in] nInputsBufferSize - Number of elements in buffer
+* @param[in] pInputsBuffer - double buffer of input values of all points
+* @param[in] nOutputsBufferSize - Number of elements in buffer
+* @param[out] pOutputsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pOutputsBuffer - double buffer of output values of all points
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_implicitevaluator_evaluate(Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint64 nInputsBufferSize, const Lib3MF_double * pInputsBuffer, const Lib3MF_uint64 nOutputsBufferSize, Lib3MF_uint64* pOutputsNeededCount, Lib3MF_double * pOutputsBuffer);
+
+/**
+* Evaluates the function for a batch of points in structure-of-arrays layout. The values of the first input component of all points are stored consecutively, followed by the values of the next component. The outputs are returned in the same layout.
+*
+* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+* @param[in] nInputsBufferSize - Number of elements in buffer
+* @param[in] pInputsBuffer - double buffer of input values of all points, one array per component
+* @param[in] nOutputsBufferSize - Number of elements in buffer
+* @param[out] pOutputsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pOutputsBuffer - double buffer of output values of all points, one array per component
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_implicitevaluator_evaluatebatch(Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint64 nInputsBufferSize, const Lib3MF_double * pInputsBuffer, const Lib3MF_uint64 nOutputsBufferSize, Lib3MF_uint64* pOutputsNeededCount, Lib3MF_double * pOutputsBuffer);
+
+/**
+* Computes bounds of the function outputs for boxes of input values. Every box is given by the minimal and maximal value of each input component, stored like the points of Evaluate. The bounds contain all output values within the box, but are not necessarily tight. Unbounded outputs are reported as infinite.
+*
+* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+* @param[in] nInputMinimaBufferSize - Number of elements in buffer
+* @param[in] pInputMinimaBuffer - double buffer of minimal input values of all boxes
+* @param[in] nInputMaximaBufferSize - Number of elements in buffer
+* @param[in] pInputMaximaBuffer - double buffer of maximal input values of all boxes
+* @param[in] nOutputMinimaBufferSize - Number of elements in buffer
+* @param[out] pOutputMinimaNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pOutputMinimaBuffer - double buffer of lower bounds of the outputs of all boxes
+* @param[in] nOutputMaximaBufferSize - Number of elements in buffer
+* @param[out] pOutputMaximaNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pOutputMaximaBuffer - double buffer of upper bounds of the outputs of all boxes
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_implicitevaluator_evaluatebounds(Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint64 nInputMinimaBufferSize, const Lib3MF_double * pInputMinimaBuffer, Lib3MF_uint64 nInputMaximaBufferSize, const Lib3MF_double * pInputMaximaBuffer, const Lib3MF_uint64 nOutputMinimaBufferSize, Lib3MF_uint64* pOutputMinimaNeededCount, Lib3MF_double * pOutputMinimaBuffer, const Lib3MF_uint64 nOutputMaximaBufferSize, Lib3MF_uint64* pOutputMaximaNeededCount, Lib3MF_double * pOutputMaximaBuffer);
+
 /*************************************************************************************************************************
  Class definition for FunctionFromImage3D
 **************************************************************************************************************************/
@@ -4965,6 +5284,68 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_functionfromimage3d_getscale(Lib3MF_Function
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_functionfromimage3d_setscale(Lib3MF_FunctionFromImage3D pFunctionFromImage3D, Lib3MF_double dScale);
 
+/**
+* Creates a sampler, which decodes the sheets of the 3D image on demand. Later changes of the function do not affect the sampler.
+*
+* @param[in] pFunctionFromImage3D - FunctionFromImage3D instance.
+* @param[out] pSampler - the sampler
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_functionfromimage3d_createsampler(Lib3MF_FunctionFromImage3D pFunctionFromImage3D, Lib3MF_Image3DSampler * pSampler);
+
+/*************************************************************************************************************************
+ Class definition for Image3DSampler
+**************************************************************************************************************************/
+
+/**
+* Sets the maximal memory size of the decoded sheets, which are kept for later samples. The most recently used sheet is always kept.
+*
+* @param[in] pImage3DSampler - Image3DSampler instance.
+* @param[in] nCacheSize - cache size in bytes
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_image3dsampler_setcachesize(Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint64 nCacheSize);
+
+/**
+* Returns the maximal memory size of the decoded sheets.
+*
+* @param[in] pImage3DSampler - Image3DSampler instance.
+* @param[out] pCacheSize - cache size in bytes
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_image3dsampler_getcachesize(Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint64 * pCacheSize);
+
+/**
+* Sets the number of threads used by Sample. 0 selects the number of hardware threads, 1 (default) samples on the calling thread.
+*
+* @param[in] pImage3DSampler - Image3DSampler instance.
+* @param[in] nThreadCount - number of threads
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_image3dsampler_setworkerthreadcount(Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads used by Sample.
+*
+* @param[in] pImage3DSampler - Image3DSampler instance.
+* @param[out] pThreadCount - number of threads
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_image3dsampler_getworkerthreadcount(Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Samples the function from image3D at a batch of points. Every point takes the 3 values u, v and w, every result the 4 values red, green, blue and alpha, including offset and scale.
+*
+* @param[in] pImage3DSampler - Image3DSampler instance.
+* @param[in] nUVWBufferSize - Number of elements in buffer
+* @param[in] pUVWBuffer - double buffer of u, v and w of all points
+* @param[in] nRGBABufferSize - Number of elements in buffer
+* @param[out] pRGBANeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pRGBABuffer - double buffer of red, green, blue and alpha of all points
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_image3dsampler_sample(Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint64 nUVWBufferSize, const Lib3MF_double * pUVWBuffer, const Lib3MF_uint64 nRGBABufferSize, Lib3MF_uint64* pRGBANeededCount, Lib3MF_double * pRGBABuffer);
+
 /*************************************************************************************************************************
  Class definition for BuildItem
 **************************************************************************************************************************/
@@ -6488,6 +6869,16 @@ LIB3MF_DECLSPEC Lib3MFResult lib3mf_getspecificationversion(const char * pSpecif
 */
 LIB3MF_DECLSPEC Lib3MFResult lib3mf_createmodel(Lib3MF_Model * pModel);
 
+/**
+* creates a writer, which streams mesh objects into a new 3MF file while they are generated.
+*
+* @param[in] pFilename - Filename to write into
+* @param[in] eUnit - Unit of the model
+* @param[out] pStreamingWriter - returns the streaming writer instance
+* @return error code or 0 (success)
+*/
+LIB3MF_DECLSPEC Lib3MFResult lib3mf_createstreamingwriter(const char * pFilename, eLib3MFModelUnit eUnit, Lib3MF_StreamingWriter * pStreamingWriter);
+
 /**
 * releases shared ownership of an object instance
 *
@@ -56,6 +56,12 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_Writer_SetProgressCallback = NULL;
 	pWrapperTable->m_Writer_GetDecimalPrecision = NULL;
 	pWrapperTable->m_Writer_SetDecimalPrecision = NULL;
+	pWrapperTable->m_Writer_SetShortestRoundtripActive = NULL;
+	pWrapperTable->m_Writer_GetShortestRoundtripActive = NULL;
+	pWrapperTable->m_Writer_SetWorkerThreadCount = NULL;
+	pWrapperTable->m_Writer_GetWorkerThreadCount = NULL;
+	pWrapperTable->m_Writer_SetCompressionLevel = NULL;
+	pWrapperTable->m_Writer_GetCompressionLevel = NULL;
 	pWrapperTable->m_Writer_SetStrictModeActive = NULL;
 	pWrapperTable->m_Writer_GetStrictModeActive = NULL;
 	pWrapperTable->m_Writer_GetWarning = NULL;
@@ -70,10 +76,21 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_Reader_RemoveRelationToRead = NULL;
 	pWrapperTable->m_Reader_SetStrictModeActive = NULL;
 	pWrapperTable->m_Reader_GetStrictModeActive = NULL;
+	pWrapperTable->m_Reader_SetWorkerThreadCount = NULL;
+	pWrapperTable->m_Reader_GetWorkerThreadCount = NULL;
+	pWrapperTable->m_Reader_SetMeshStreamCallbacks = NULL;
+	pWrapperTable->m_Reader_SetLazyMeshLoadingActive = NULL;
+	pWrapperTable->m_Reader_GetLazyMeshLoadingActive = NULL;
 	pWrapperTable->m_Reader_GetWarning = NULL;
 	pWrapperTable->m_Reader_GetWarningCount = NULL;
 	pWrapperTable->m_Reader_AddKeyWrappingCallback = NULL;
 	pWrapperTable->m_Reader_SetContentEncryptionCallback = NULL;
+	pWrapperTable->m_StreamingWriter_BeginMeshObject = NULL;
+	pWrapperTable->m_StreamingWriter_AddVertices = NULL;
+	pWrapperTable->m_StreamingWriter_AddTriangles = NULL;
+	pWrapperTable->m_StreamingWriter_EndMeshObject = NULL;
+	pWrapperTable->m_StreamingWriter_AddBuildItem = NULL;
+	pWrapperTable->m_StreamingWriter_Finish = NULL;
 	pWrapperTable->m_PackagePart_GetPath = NULL;
 	pWrapperTable->m_PackagePart_SetPath = NULL;
 	pWrapperTable->m_Resource_GetResourceID = NULL;
@@ -158,10 +175,14 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_MeshObject_SetVertex = NULL;
 	pWrapperTable->m_MeshObject_AddVertex = NULL;
 	pWrapperTable->m_MeshObject_GetVertices = NULL;
+	pWrapperTable->m_MeshObject_GetVertexPageCount = NULL;
+	pWrapperTable->m_MeshObject_GetVertexPage = NULL;
 	pWrapperTable->m_MeshObject_GetTriangle = NULL;
 	pWrapperTable->m_MeshObject_SetTriangle = NULL;
 	pWrapperTable->m_MeshObject_AddTriangle = NULL;
 	pWrapperTable->m_MeshObject_GetTriangleIndices = NULL;
+	pWrapperTable->m_MeshObject_GetTrianglePageCount = NULL;
+	pWrapperTable->m_MeshObject_GetTrianglePage = NULL;
 	pWrapperTable->m_MeshObject_SetObjectLevelProperty = NULL;
 	pWrapperTable->m_MeshObject_GetObjectLevelProperty = NULL;
 	pWrapperTable->m_MeshObject_SetTriangleProperties = NULL;
@@ -170,7 +191,9 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_MeshObject_GetAllTriangleProperties = NULL;
 	pWrapperTable->m_MeshObject_ClearAllProperties = NULL;
 	pWrapperTable->m_MeshObject_SetGeometry = NULL;
+	pWrapperTable->m_MeshObject_ReserveGeometry = NULL;
 	pWrapperTable->m_MeshObject_IsManifoldAndOriented = NULL;
+	pWrapperTable->m_MeshObject_IsGeometryLoaded = NULL;
 	pWrapperTable->m_MeshObject_BeamLattice = NULL;
 	pWrapperTable->m_MeshObject_GetVolumeData = NULL;
 	pWrapperTable->m_MeshObject_SetVolumeData = NULL;
@@ -492,6 +515,14 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_ImplicitFunction_AddLinkByNames = NULL;
 	pWrapperTable->m_ImplicitFunction_Clear = NULL;
 	pWrapperTable->m_ImplicitFunction_SortNodesTopologically = NULL;
+	pWrapperTable->m_ImplicitFunction_CreateEvaluator = NULL;
+	pWrapperTable->m_ImplicitEvaluator_GetInputStride = NULL;
+	pWrapperTable->m_ImplicitEvaluator_GetOutputStride = NULL;
+	pWrapperTable->m_ImplicitEvaluator_SetWorkerThreadCount = NULL;
+	pWrapperTable->m_ImplicitEvaluator_GetWorkerThreadCount = NULL;
+	pWrapperTable->m_ImplicitEvaluator_Evaluate = NULL;
+	pWrapperTable->m_ImplicitEvaluator_EvaluateBatch = NULL;
+	pWrapperTable->m_ImplicitEvaluator_EvaluateBounds = NULL;
 	pWrapperTable->m_FunctionFromImage3D_GetImage3D = NULL;
 	pWrapperTable->m_FunctionFromImage3D_SetImage3D = NULL;
 	pWrapperTable->m_FunctionFromImage3D_SetFilter = NULL;
@@ -502,6 +533,12 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_FunctionFromImage3D_SetOffset = NULL;
 	pWrapperTable->m_FunctionFromImage3D_GetScale = NULL;
 	pWrapperTable->m_FunctionFromImage3D_SetScale = NULL;
+	pWrapperTable->m_FunctionFromImage3D_CreateSampler = NULL;
+	pWrapperTable->m_Image3DSampler_SetCacheSize = NULL;
+	pWrapperTable->m_Image3DSampler_GetCacheSize = NULL;
+	pWrapperTable->m_Image3DSampler_SetWorkerThreadCount = NULL;
+	pWrapperTable->m_Image3DSampler_GetWorkerThreadCount = NULL;
+	pWrapperTable->m_Image3DSampler_Sample = NULL;
 	pWrapperTable->m_BuildItem_GetObjectResource = NULL;
 	pWrapperTable->m_BuildItem_GetUUID = NULL;
 	pWrapperTable->m_BuildItem_SetUUID = NULL;
@@ -654,6 +691,7 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_GetBuildInformation = NULL;
 	pWrapperTable->m_GetSpecificationVersion = NULL;
 	pWrapperTable->m_CreateModel = NULL;
+	pWrapperTable->m_CreateStreamingWriter = NULL;
 	pWrapperTable->m_Release = NULL;
 	pWrapperTable->m_Acquire = NULL;
 	pWrapperTable->m_SetJournal = NULL;
@@ -794,6 +832,60 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_Writer_SetDecimalPrecision == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_SetShortestRoundtripActive = (PLib3MFWriter_SetShortestRoundtripActivePtr) GetProcAddress(hLibrary, "lib3mf_writer_setshortestroundtripactive");
+	#else // _WIN32
+	pWrapperTable->m_Writer_SetShortestRoundtripActive = (PLib3MFWriter_SetShortestRoundtripActivePtr) dlsym(hLibrary, "lib3mf_writer_setshortestroundtripactive");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_SetShortestRoundtripActive == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_GetShortestRoundtripActive = (PLib3MFWriter_GetShortestRoundtripActivePtr) GetProcAddress(hLibrary, "lib3mf_writer_getshortestroundtripactive");
+	#else // _WIN32
+	pWrapperTable->m_Writer_GetShortestRoundtripActive = (PLib3MFWriter_GetShortestRoundtripActivePtr) dlsym(hLibrary, "lib3mf_writer_getshortestroundtripactive");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_GetShortestRoundtripActive == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_SetWorkerThreadCount = (PLib3MFWriter_SetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_writer_setworkerthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Writer_SetWorkerThreadCount = (PLib3MFWriter_SetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_writer_setworkerthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_SetWorkerThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_GetWorkerThreadCount = (PLib3MFWriter_GetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_writer_getworkerthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Writer_GetWorkerThreadCount = (PLib3MFWriter_GetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_writer_getworkerthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_GetWorkerThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_SetCompressionLevel = (PLib3MFWriter_SetCompressionLevelPtr) GetProcAddress(hLibrary, "lib3mf_writer_setcompressionlevel");
+	#else // _WIN32
+	pWrapperTable->m_Writer_SetCompressionLevel = (PLib3MFWriter_SetCompressionLevelPtr) dlsym(hLibrary, "lib3mf_writer_setcompressionlevel");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_SetCompressionLevel == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_GetCompressionLevel = (PLib3MFWriter_GetCompressionLevelPtr) GetProcAddress(hLibrary, "lib3mf_writer_getcompressionlevel");
+	#else // _WIN32
+	pWrapperTable->m_Writer_GetCompressionLevel = (PLib3MFWriter_GetCompressionLevelPtr) dlsym(hLibrary, "lib3mf_writer_getcompressionlevel");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_GetCompressionLevel == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_Writer_SetStrictModeActive = (PLib3MFWriter_SetStrictModeActivePtr) GetProcAddress(hLibrary, "lib3mf_writer_setstrictmodeactive");
 	#else // _WIN32
@@ -920,6 +1012,51 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_Reader_GetStrictModeActive == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_SetWorkerThreadCount = (PLib3MFReader_SetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_reader_setworkerthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Reader_SetWorkerThreadCount = (PLib3MFReader_SetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_reader_setworkerthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_SetWorkerThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_GetWorkerThreadCount = (PLib3MFReader_GetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_reader_getworkerthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Reader_GetWorkerThreadCount = (PLib3MFReader_GetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_reader_getworkerthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_GetWorkerThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_SetMeshStreamCallbacks = (PLib3MFReader_SetMeshStreamCallbacksPtr) GetProcAddress(hLibrary, "lib3mf_reader_setmeshstreamcallbacks");
+	#else // _WIN32
+	pWrapperTable->m_Reader_SetMeshStreamCallbacks = (PLib3MFReader_SetMeshStreamCallbacksPtr) dlsym(hLibrary, "lib3mf_reader_setmeshstreamcallbacks");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_SetMeshStreamCallbacks == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_SetLazyMeshLoadingActive = (PLib3MFReader_SetLazyMeshLoadingActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_setlazymeshloadingactive");
+	#else // _WIN32
+	pWrapperTable->m_Reader_SetLazyMeshLoadingActive = (PLib3MFReader_SetLazyMeshLoadingActivePtr) dlsym(hLibrary, "lib3mf_reader_setlazymeshloadingactive");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_SetLazyMeshLoadingActive == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_GetLazyMeshLoadingActive = (PLib3MFReader_GetLazyMeshLoadingActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_getlazymeshloadingactive");
+	#else // _WIN32
+	pWrapperTable->m_Reader_GetLazyMeshLoadingActive = (PLib3MFReader_GetLazyMeshLoadingActivePtr) dlsym(hLibrary, "lib3mf_reader_getlazymeshloadingactive");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_GetLazyMeshLoadingActive == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_Reader_GetWarning = (PLib3MFReader_GetWarningPtr) GetProcAddress(hLibrary, "lib3mf_reader_getwarning");
 	#else // _WIN32
@@ -956,6 +1093,60 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_Reader_SetContentEncryptionCallback == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_StreamingWriter_BeginMeshObject = (PLib3MFStreamingWriter_BeginMeshObjectPtr) GetProcAddress(hLibrary, "lib3mf_streamingwriter_beginmeshobject");
+	#else // _WIN32
+	pWrapperTable->m_StreamingWriter_BeginMeshObject = (PLib3MFStreamingWriter_BeginMeshObjectPtr) dlsym(hLibrary, "lib3mf_streamingwriter_beginmeshobject");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_StreamingWriter_BeginMeshObject == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_StreamingWriter_AddVertices = (PLib3MFStreamingWriter_AddVerticesPtr) GetProcAddress(hLibrary, "lib3mf_streamingwriter_addvertices");
+	#else // _WIN32
+	pWrapperTable->m_StreamingWriter_AddVertices = (PLib3MFStreamingWriter_AddVerticesPtr) dlsym(hLibrary, "lib3mf_streamingwriter_addvertices");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_StreamingWriter_AddVertices == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_StreamingWriter_AddTriangles = (PLib3MFStreamingWriter_AddTrianglesPtr) GetProcAddress(hLibrary, "lib3mf_streamingwriter_addtriangles");
+	#else // _WIN32
+	pWrapperTable->m_StreamingWriter_AddTriangles = (PLib3MFStreamingWriter_AddTrianglesPtr) dlsym(hLibrary, "lib3mf_streamingwriter_addtriangles");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_StreamingWriter_AddTriangles == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_StreamingWriter_EndMeshObject = (PLib3MFStreamingWriter_EndMeshObjectPtr) GetProcAddress(hLibrary, "lib3mf_streamingwriter_endmeshobject");
+	#else // _WIN32
+	pWrapperTable->m_StreamingWriter_EndMeshObject = (PLib3MFStreamingWriter_EndMeshObjectPtr) dlsym(hLibrary, "lib3mf_streamingwriter_endmeshobject");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_StreamingWriter_EndMeshObject == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_StreamingWriter_AddBuildItem = (PLib3MFStreamingWriter_AddBuildItemPtr) GetProcAddress(hLibrary, "lib3mf_streamingwriter_addbuilditem");
+	#else // _WIN32
+	pWrapperTable->m_StreamingWriter_AddBuildItem = (PLib3MFStreamingWriter_AddBuildItemPtr) dlsym(hLibrary, "lib3mf_streamingwriter_addbuilditem");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_StreamingWriter_AddBuildItem == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_StreamingWriter_Finish = (PLib3MFStreamingWriter_FinishPtr) GetProcAddress(hLibrary, "lib3mf_streamingwriter_finish");
+	#else // _WIN32
+	pWrapperTable->m_StreamingWriter_Finish = (PLib3MFStreamingWriter_FinishPtr) dlsym(hLibrary, "lib3mf_streamingwriter_finish");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_StreamingWriter_Finish == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_PackagePart_GetPath = (PLib3MFPackagePart_GetPathPtr) GetProcAddress(hLibrary, "lib3mf_packagepart_getpath");
 	#else // _WIN32
@@ -1712,6 +1903,24 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_MeshObject_GetVertices == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_MeshObject_GetVertexPageCount = (PLib3MFMeshObject_GetVertexPageCountPtr) GetProcAddress(hLibrary, "lib3mf_meshobject_getvertexpagecount");
+	#else // _WIN32
+	pWrapperTable->m_MeshObject_GetVertexPageCount = (PLib3MFMeshObject_GetVertexPageCountPtr) dlsym(hLibrary, "lib3mf_meshobject_getvertexpagecount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_MeshObject_GetVertexPageCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_MeshObject_GetVertexPage = (PLib3MFMeshObject_GetVertexPagePtr) GetProcAddress(hLibrary, "lib3mf_meshobject_getvertexpage");
+	#else // _WIN32
+	pWrapperTable->m_MeshObject_GetVertexPage = (PLib3MFMeshObject_GetVertexPagePtr) dlsym(hLibrary, "lib3mf_meshobject_getvertexpage");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_MeshObject_GetVertexPage == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_MeshObject_GetTriangle = (PLib3MFMeshObject_GetTrianglePtr) GetProcAddress(hLibrary, "lib3mf_meshobject_gettriangle");
 	#else // _WIN32
@@ -1748,6 +1957,24 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_MeshObject_GetTriangleIndices == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_MeshObject_GetTrianglePageCount = (PLib3MFMeshObject_GetTrianglePageCountPtr) GetProcAddress(hLibrary, "lib3mf_meshobject_gettrianglepagecount");
+	#else // _WIN32
+	pWrapperTable->m_MeshObject_GetTrianglePageCount = (PLib3MFMeshObject_GetTrianglePageCountPtr) dlsym(hLibrary, "lib3mf_meshobject_gettrianglepagecount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_MeshObject_GetTrianglePageCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_MeshObject_GetTrianglePage = (PLib3MFMeshObject_GetTrianglePagePtr) GetProcAddress(hLibrary, "lib3mf_meshobject_gettrianglepage");
+	#else // _WIN32
+	pWrapperTable->m_MeshObject_GetTrianglePage = (PLib3MFMeshObject_GetTrianglePagePtr) dlsym(hLibrary, "lib3mf_meshobject_gettrianglepage");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_MeshObject_GetTrianglePage == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_MeshObject_SetObjectLevelProperty = (PLib3MFMeshObject_SetObjectLevelPropertyPtr) GetProcAddress(hLibrary, "lib3mf_meshobject_setobjectlevelproperty");
 	#else // _WIN32
@@ -1820,6 +2047,15 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_MeshObject_SetGeometry == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_MeshObject_ReserveGeometry = (PLib3MFMeshObject_ReserveGeometryPtr) GetProcAddress(hLibrary, "lib3mf_meshobject_reservegeometry");
+	#else // _WIN32
+	pWrapperTable->m_MeshObject_ReserveGeometry = (PLib3MFMeshObject_ReserveGeometryPtr) dlsym(hLibrary, "lib3mf_meshobject_reservegeometry");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_MeshObject_ReserveGeometry == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_MeshObject_IsManifoldAndOriented = (PLib3MFMeshObject_IsManifoldAndOrientedPtr) GetProcAddress(hLibrary, "lib3mf_meshobject_ismanifoldandoriented");
 	#else // _WIN32
@@ -1829,6 +2065,15 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_MeshObject_IsManifoldAndOriented == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_MeshObject_IsGeometryLoaded = (PLib3MFMeshObject_IsGeometryLoadedPtr) GetProcAddress(hLibrary, "lib3mf_meshobject_isgeometryloaded");
+	#else // _WIN32
+	pWrapperTable->m_MeshObject_IsGeometryLoaded = (PLib3MFMeshObject_IsGeometryLoadedPtr) dlsym(hLibrary, "lib3mf_meshobject_isgeometryloaded");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_MeshObject_IsGeometryLoaded == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_MeshObject_BeamLattice = (PLib3MFMeshObject_BeamLatticePtr) GetProcAddress(hLibrary, "lib3mf_meshobject_beamlattice");
 	#else // _WIN32
@@ -4718,6 +4963,78 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_ImplicitFunction_SortNodesTopologically == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_ImplicitFunction_CreateEvaluator = (PLib3MFImplicitFunction_CreateEvaluatorPtr) GetProcAddress(hLibrary, "lib3mf_implicitfunction_createevaluator");
+	#else // _WIN32
+	pWrapperTable->m_ImplicitFunction_CreateEvaluator = (PLib3MFImplicitFunction_CreateEvaluatorPtr) dlsym(hLibrary, "lib3mf_implicitfunction_createevaluator");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ImplicitFunction_CreateEvaluator == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_ImplicitEvaluator_GetInputStride = (PLib3MFImplicitEvaluator_GetInputStridePtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_getinputstride");
+	#else // _WIN32
+	pWrapperTable->m_ImplicitEvaluator_GetInputStride = (PLib3MFImplicitEvaluator_GetInputStridePtr) dlsym(hLibrary, "lib3mf_implicitevaluator_getinputstride");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ImplicitEvaluator_GetInputStride == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_ImplicitEvaluator_GetOutputStride = (PLib3MFImplicitEvaluator_GetOutputStridePtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_getoutputstride");
+	#else // _WIN32
+	pWrapperTable->m_ImplicitEvaluator_GetOutputStride = (PLib3MFImplicitEvaluator_GetOutputStridePtr) dlsym(hLibrary, "lib3mf_implicitevaluator_getoutputstride");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ImplicitEvaluator_GetOutputStride == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_ImplicitEvaluator_SetWorkerThreadCount = (PLib3MFImplicitEvaluator_SetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_setworkerthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_ImplicitEvaluator_SetWorkerThreadCount = (PLib3MFImplicitEvaluator_SetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_implicitevaluator_setworkerthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ImplicitEvaluator_SetWorkerThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_ImplicitEvaluator_GetWorkerThreadCount = (PLib3MFImplicitEvaluator_GetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_getworkerthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_ImplicitEvaluator_GetWorkerThreadCount = (PLib3MFImplicitEvaluator_GetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_implicitevaluator_getworkerthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ImplicitEvaluator_GetWorkerThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_ImplicitEvaluator_Evaluate = (PLib3MFImplicitEvaluator_EvaluatePtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_evaluate");
+	#else // _WIN32
+	pWrapperTable->m_ImplicitEvaluator_Evaluate = (PLib3MFImplicitEvaluator_EvaluatePtr) dlsym(hLibrary, "lib3mf_implicitevaluator_evaluate");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ImplicitEvaluator_Evaluate == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_ImplicitEvaluator_EvaluateBatch = (PLib3MFImplicitEvaluator_EvaluateBatchPtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_evaluatebatch");
+	#else // _WIN32
+	pWrapperTable->m_ImplicitEvaluator_EvaluateBatch = (PLib3MFImplicitEvaluator_EvaluateBatchPtr) dlsym(hLibrary, "lib3mf_implicitevaluator_evaluatebatch");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ImplicitEvaluator_EvaluateBatch == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_ImplicitEvaluator_EvaluateBounds = (PLib3MFImplicitEvaluator_EvaluateBoundsPtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_evaluatebounds");
+	#else // _WIN32
+	pWrapperTable->m_ImplicitEvaluator_EvaluateBounds = (PLib3MFImplicitEvaluator_EvaluateBoundsPtr) dlsym(hLibrary, "lib3mf_implicitevaluator_evaluatebounds");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ImplicitEvaluator_EvaluateBounds == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_FunctionFromImage3D_GetImage3D = (PLib3MFFunctionFromImage3D_GetImage3DPtr) GetProcAddress(hLibrary, "lib3mf_functionfromimage3d_getimage3d");
 	#else // _WIN32
@@ -4808,6 +5125,60 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_FunctionFromImage3D_SetScale == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_FunctionFromImage3D_CreateSampler = (PLib3MFFunctionFromImage3D_CreateSamplerPtr) GetProcAddress(hLibrary, "lib3mf_functionfromimage3d_createsampler");
+	#else // _WIN32
+	pWrapperTable->m_FunctionFromImage3D_CreateSampler = (PLib3MFFunctionFromImage3D_CreateSamplerPtr) dlsym(hLibrary, "lib3mf_functionfromimage3d_createsampler");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_FunctionFromImage3D_CreateSampler == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Image3DSampler_SetCacheSize = (PLib3MFImage3DSampler_SetCacheSizePtr) GetProcAddress(hLibrary, "lib3mf_image3dsampler_setcachesize");
+	#else // _WIN32
+	pWrapperTable->m_Image3DSampler_SetCacheSize = (PLib3MFImage3DSampler_SetCacheSizePtr) dlsym(hLibrary, "lib3mf_image3dsampler_setcachesize");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Image3DSampler_SetCacheSize == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Image3DSampler_GetCacheSize = (PLib3MFImage3DSampler_GetCacheSizePtr) GetProcAddress(hLibrary, "lib3mf_image3dsampler_getcachesize");
+	#else // _WIN32
+	pWrapperTable->m_Image3DSampler_GetCacheSize = (PLib3MFImage3DSampler_GetCacheSizePtr) dlsym(hLibrary, "lib3mf_image3dsampler_getcachesize");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Image3DSampler_GetCacheSize == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Image3DSampler_SetWorkerThreadCount = (PLib3MFImage3DSampler_SetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_image3dsampler_setworkerthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Image3DSampler_SetWorkerThreadCount = (PLib3MFImage3DSampler_SetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_image3dsampler_setworkerthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Image3DSampler_SetWorkerThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Image3DSampler_GetWorkerThreadCount = (PLib3MFImage3DSampler_GetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_image3dsampler_getworkerthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Image3DSampler_GetWorkerThreadCount = (PLib3MFImage3DSampler_GetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_image3dsampler_getworkerthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Image3DSampler_GetWorkerThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Image3DSampler_Sample = (PLib3MFImage3DSampler_SamplePtr) GetProcAddress(hLibrary, "lib3mf_image3dsampler_sample");
+	#else // _WIN32
+	pWrapperTable->m_Image3DSampler_Sample = (PLib3MFImage3DSampler_SamplePtr) dlsym(hLibrary, "lib3mf_image3dsampler_sample");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Image3DSampler_Sample == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_BuildItem_GetObjectResource = (PLib3MFBuildItem_GetObjectResourcePtr) GetProcAddress(hLibrary, "lib3mf_builditem_getobjectresource");
 	#else // _WIN32
@@ -6176,6 +6547,15 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_CreateModel == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_CreateStreamingWriter = (PLib3MFCreateStreamingWriterPtr) GetProcAddress(hLibrary, "lib3mf_createstreamingwriter");
+	#else // _WIN32
+	pWrapperTable->m_CreateStreamingWriter = (PLib3MFCreateStreamingWriterPtr) dlsym(hLibrary, "lib3mf_createstreamingwriter");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_CreateStreamingWriter == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_Release = (PLib3MFReleasePtr) GetProcAddress(hLibrary, "lib3mf_release");
 	#else // _WIN32
@@ -213,6 +213,7 @@ inline const char * LIB3MF_GETERRORSTRING (Lib3MFResult nErrorCode) {
 typedef Lib3MFHandle Lib3MF_Base;
 typedef Lib3MFHandle Lib3MF_Writer;
 typedef Lib3MFHandle Lib3MF_Reader;
+typedef Lib3MFHandle Lib3MF_StreamingWriter;
 typedef Lib3MFHandle Lib3MF_PackagePart;
 typedef Lib3MFHandle Lib3MF_Resource;
 typedef Lib3MFHandle Lib3MF_ResourceIterator;
@@ -314,7 +315,9 @@ typedef Lib3MFHandle Lib3MF_FunctionCallNode;
 typedef Lib3MFHandle Lib3MF_NodeIterator;
 typedef Lib3MFHandle Lib3MF_Function;
 typedef Lib3MFHandle Lib3MF_ImplicitFunction;
+typedef Lib3MFHandle Lib3MF_ImplicitEvaluator;
 typedef Lib3MFHandle Lib3MF_FunctionFromImage3D;
+typedef Lib3MFHandle Lib3MF_Image3DSampler;
 typedef Lib3MFHandle Lib3MF_BuildItem;
 typedef Lib3MFHandle Lib3MF_BuildItemIterator;
 typedef Lib3MFHandle Lib3MF_Slice;
@@ -451,6 +454,25 @@ typedef enum eLib3MFCompositionSpace {
   eCompositionSpaceLinearColor = 1
 } eLib3MFCompositionSpace;
 
+/**
+* enum eLib3MFPackagePartType - The kind of a part written into the package
+*/
+typedef enum eLib3MFPackagePartType {
+  ePackagePartTypeModel = 0, /** 3D model parts */
+  ePackagePartTypeImage = 1, /** Thumbnails, textures and image stack sheets */
+  ePackagePartTypeAttachment = 2 /** All other attachments */
+} eLib3MFPackagePartType;
+
+/**
+* enum eLib3MFCompressionLevel - The compression of a part in the package
+*/
+typedef enum eLib3MFCompressionLevel {
+  eCompressionLevelStored = 0, /** Part is stored without compression */
+  eCompressionLevelFastest = 1, /** Fastest deflate compression */
+  eCompressionLevelDefault = 6, /** Default deflate compression */
+  eCompressionLevelMaximum = 9 /** Best deflate compression */
+} eLib3MFCompressionLevel;
+
 /**
 * enum eLib3MFImplicitNodeType - The type of the node
 */
@@ -633,6 +655,16 @@ typedef union {
   int m_code;
 } structEnumLib3MFCompositionSpace;
 
+typedef union {
+  eLib3MFPackagePartType m_enum;
+  int m_code;
+} structEnumLib3MFPackagePartType;
+
+typedef union {
+  eLib3MFCompressionLevel m_enum;
+  int m_code;
+} structEnumLib3MFCompressionLevel;
+
 typedef union {
   eLib3MFImplicitNodeType m_enum;
   int m_code;
@@ -798,6 +830,28 @@ typedef void(*Lib3MFSeekCallback)(Lib3MF_uint64, Lib3MF_pvoid);
 */
 typedef void(*Lib3MFRandomNumberCallback)(Lib3MF_uint64, Lib3MF_uint64, Lib3MF_pvoid, Lib3MF_uint64 *);
 
+/**
+* Lib3MFVertexBlockCallback - Callback to receive a block of vertices of a mesh object while it is read
+*
+* @param[in] nUniqueResourceID - Unique resource ID of the mesh object
+* @param[in] nStartIndex - Index of the first vertex of the block within the mesh object
+* @param[in] nVerticesBufferSize - Number of elements in buffer
+* @param[in] pVerticesBuffer - Position buffer of Vertices of the block
+* @param[in] pUserData - Userdata that is passed to the callback function
+*/
+typedef void(*Lib3MFVertexBlockCallback)(Lib3MF_uint32, Lib3MF_uint32, Lib3MF_uint64, const sLib3MFPosition *, Lib3MF_pvoid);
+
+/**
+* Lib3MFTriangleBlockCallback - Callback to receive a block of triangles of a mesh object while it is read
+*
+* @param[in] nUniqueResourceID - Unique resource ID of the mesh object
+* @param[in] nStartIndex - Index of the first triangle of the block within the mesh object
+* @param[in] nTrianglesBufferSize - Number of elements in buffer
+* @param[in] pTrianglesBuffer - Triangle buffer of Vertex indices of the triangles of the block
+* @param[in] pUserData - Userdata that is passed to the callback function
+*/
+typedef void(*Lib3MFTriangleBlockCallback)(Lib3MF_uint32, Lib3MF_uint32, Lib3MF_uint64, const sLib3MFTriangle *, Lib3MF_pvoid);
+
 /**
 * Lib3MFKeyWrappingCallback - A callback used to wrap (encrypt) the content key available in keystore resource group
 *
@@ -159,6 +159,19 @@ namespace Lib3MF {
 		LinearColor = 1
 	};
 
+	public enum ePackagePartType {
+		Model = 0,
+		Image = 1,
+		Attachment = 2
+	};
+
+	public enum eCompressionLevel {
+		Stored = 0,
+		Fastest = 1,
+		Default = 6,
+		Maximum = 9
+	};
+
 	public enum eImplicitNodeType {
 		Addition = 0,
 		Subtraction = 1,
@@ -459,6 +472,24 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_setdecimalprecision", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Writer_SetDecimalPrecision (IntPtr Handle, UInt32 ADecimalPrecision);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_setshortestroundtripactive", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_SetShortestRoundtripActive (IntPtr Handle, Byte AShortestRoundtripActive);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_getshortestroundtripactive", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_GetShortestRoundtripActive (IntPtr Handle, out Byte AShortestRoundtripActive);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_setworkerthreadcount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_SetWorkerThreadCount (IntPtr Handle, UInt32 AThreadCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_getworkerthreadcount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_GetWorkerThreadCount (IntPtr Handle, out UInt32 AThreadCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_setcompressionlevel", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_SetCompressionLevel (IntPtr Handle, Int32 APartType, Int32 ALevel);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_getcompressionlevel", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Writer_GetCompressionLevel (IntPtr Handle, Int32 APartType, out Int32 ALevel);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_writer_setstrictmodeactive", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Writer_SetStrictModeActive (IntPtr Handle, Byte AStrictModeActive);
 
@@ -501,6 +532,21 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_getstrictmodeactive", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Reader_GetStrictModeActive (IntPtr Handle, out Byte AStrictModeActive);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_setworkerthreadcount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_SetWorkerThreadCount (IntPtr Handle, UInt32 AThreadCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_getworkerthreadcount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_GetWorkerThreadCount (IntPtr Handle, out UInt32 AThreadCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_setmeshstreamcallbacks", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_SetMeshStreamCallbacks (IntPtr Handle, IntPtr ATheVertexBlockCallback, IntPtr ATheTriangleBlockCallback, Byte ARetainGeometry, UInt64 AUserData);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_setlazymeshloadingactive", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_SetLazyMeshLoadingActive (IntPtr Handle, Byte ALazyMeshLoadingActive);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_getlazymeshloadingactive", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Reader_GetLazyMeshLoadingActive (IntPtr Handle, out Byte ALazyMeshLoadingActive);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_getwarning", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Reader_GetWarning (IntPtr Handle, UInt32 AIndex, out UInt32 AErrorCode, UInt32 sizeWarning, out UInt32 neededWarning, IntPtr dataWarning);
 
@@ -513,6 +559,24 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_reader_setcontentencryptioncallback", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 Reader_SetContentEncryptionCallback (IntPtr Handle, IntPtr ATheCallback, UInt64 AUserData);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_streamingwriter_beginmeshobject", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 StreamingWriter_BeginMeshObject (IntPtr Handle, byte[] AName, out UInt32 AObjectID);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_streamingwriter_addvertices", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 StreamingWriter_AddVertices (IntPtr Handle, UInt64 sizeVertices, IntPtr dataVertices);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_streamingwriter_addtriangles", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 StreamingWriter_AddTriangles (IntPtr Handle, UInt64 sizeIndices, IntPtr dataIndices);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_streamingwriter_endmeshobject", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 StreamingWriter_EndMeshObject (IntPtr Handle);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_streamingwriter_addbuilditem", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 StreamingWriter_AddBuildItem (IntPtr Handle, UInt32 AObjectID, ref InternalTransform ATransform);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_streamingwriter_finish", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 StreamingWriter_Finish (IntPtr Handle);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_packagepart_getpath", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 PackagePart_GetPath (IntPtr Handle, UInt32 sizePath, out UInt32 neededPath, IntPtr dataPath);
 
@@ -765,6 +829,12 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_meshobject_getvertices", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 MeshObject_GetVertices (IntPtr Handle, UInt64 sizeVertices, out UInt64 neededVertices, IntPtr dataVertices);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_meshobject_getvertexpagecount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 MeshObject_GetVertexPageCount (IntPtr Handle, out UInt32 APageCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_meshobject_getvertexpage", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 MeshObject_GetVertexPage (IntPtr Handle, UInt32 APageIndex, out UInt32 AVertexCount, out UInt32 AStride, out UInt64 ACoordinates);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_meshobject_gettriangle", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 MeshObject_GetTriangle (IntPtr Handle, UInt32 AIndex, out InternalTriangle AIndices);
 
@@ -777,6 +847,12 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_meshobject_gettriangleindices", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 MeshObject_GetTriangleIndices (IntPtr Handle, UInt64 sizeIndices, out UInt64 neededIndices, IntPtr dataIndices);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_meshobject_gettrianglepagecount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 MeshObject_GetTrianglePageCount (IntPtr Handle, out UInt32 APageCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_meshobject_gettrianglepage", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 MeshObject_GetTrianglePage (IntPtr Handle, UInt32 APageIndex, out UInt32 ATriangleCount, out UInt32 AStride, out UInt64 AIndices);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_meshobject_setobjectlevelproperty", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 MeshObject_SetObjectLevelProperty (IntPtr Handle, UInt32 AUniqueResourceID, UInt32 APropertyID);
 
@@ -801,9 +877,15 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_meshobject_setgeometry", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 MeshObject_SetGeometry (IntPtr Handle, UInt64 sizeVertices, IntPtr dataVertices, UInt64 sizeIndices, IntPtr dataIndices);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_meshobject_reservegeometry", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 MeshObject_ReserveGeometry (IntPtr Handle, UInt32 AVertexCount, UInt32 ATriangleCount, UInt32 ABeamCount);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_meshobject_ismanifoldandoriented", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 MeshObject_IsManifoldAndOriented (IntPtr Handle, out Byte AIsManifoldAndOriented);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_meshobject_isgeometryloaded", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 MeshObject_IsGeometryLoaded (IntPtr Handle, out Byte AIsGeometryLoaded);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_meshobject_beamlattice", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 MeshObject_BeamLattice (IntPtr Handle, out IntPtr ATheBeamLattice);
 
@@ -1767,6 +1849,30 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_implicitfunction_sortnodestopologically", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 ImplicitFunction_SortNodesTopologically (IntPtr Handle);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_implicitfunction_createevaluator", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 ImplicitFunction_CreateEvaluator (IntPtr Handle, out IntPtr AEvaluator);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_implicitevaluator_getinputstride", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 ImplicitEvaluator_GetInputStride (IntPtr Handle, out UInt32 AStride);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_implicitevaluator_getoutputstride", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 ImplicitEvaluator_GetOutputStride (IntPtr Handle, out UInt32 AStride);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_implicitevaluator_setworkerthreadcount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 ImplicitEvaluator_SetWorkerThreadCount (IntPtr Handle, UInt32 AThreadCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_implicitevaluator_getworkerthreadcount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 ImplicitEvaluator_GetWorkerThreadCount (IntPtr Handle, out UInt32 AThreadCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_implicitevaluator_evaluate", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 ImplicitEvaluator_Evaluate (IntPtr Handle, UInt64 sizeInputs, IntPtr dataInputs, UInt64 sizeOutputs, out UInt64 neededOutputs, IntPtr dataOutputs);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_implicitevaluator_evaluatebatch", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 ImplicitEvaluator_EvaluateBatch (IntPtr Handle, UInt64 sizeInputs, IntPtr dataInputs, UInt64 sizeOutputs, out UInt64 neededOutputs, IntPtr dataOutputs);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_implicitevaluator_evaluatebounds", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 ImplicitEvaluator_EvaluateBounds (IntPtr Handle, UInt64 sizeInputMinima, IntPtr dataInputMinima, UInt64 sizeInputMaxima, IntPtr dataInputMaxima, UInt64 sizeOutputMinima, out UInt64 neededOutputMinima, IntPtr dataOutputMinima, UInt64 sizeOutputMaxima, out UInt64 neededOutputMaxima, IntPtr dataOutputMaxima);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_functionfromimage3d_getimage3d", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 FunctionFromImage3D_GetImage3D (IntPtr Handle, out IntPtr AImage3D);
 
@@ -1797,6 +1903,24 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_functionfromimage3d_setscale", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 FunctionFromImage3D_SetScale (IntPtr Handle, Double AScale);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_functionfromimage3d_createsampler", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 FunctionFromImage3D_CreateSampler (IntPtr Handle, out IntPtr ASampler);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_image3dsampler_setcachesize", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Image3DSampler_SetCacheSize (IntPtr Handle, UInt64 ACacheSize);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_image3dsampler_getcachesize", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Image3DSampler_GetCacheSize (IntPtr Handle, out UInt64 ACacheSize);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_image3dsampler_setworkerthreadcount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Image3DSampler_SetWorkerThreadCount (IntPtr Handle, UInt32 AThreadCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_image3dsampler_getworkerthreadcount", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Image3DSampler_GetWorkerThreadCount (IntPtr Handle, out UInt32 AThreadCount);
+
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_image3dsampler_sample", CallingConvention=CallingConvention.Cdecl)]
+			public unsafe extern static Int32 Image3DSampler_Sample (IntPtr Handle, UInt64 sizeUVW, IntPtr dataUVW, UInt64 sizeRGBA, out UInt64 neededRGBA, IntPtr dataRGBA);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_builditem_getobjectresource", CallingConvention=CallingConvention.Cdecl)]
 			public unsafe extern static Int32 BuildItem_GetObjectResource (IntPtr Handle, out IntPtr AObjectResource);
 
@@ -2253,6 +2377,9 @@ namespace Lib3MF {
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_createmodel", CharSet = CharSet.Ansi, CallingConvention=CallingConvention.Cdecl)]
 			public extern static Int32 CreateModel (out IntPtr AModel);
 
+			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_createstreamingwriter", CharSet = CharSet.Ansi, CallingConvention=CallingConvention.Cdecl)]
+			public extern static Int32 CreateStreamingWriter (byte[] AFilename, Int32 AUnit, out IntPtr AStreamingWriter);
+
 			[DllImport("lib3mf.dll", EntryPoint = "lib3mf_release", CharSet = CharSet.Ansi, CallingConvention=CallingConvention.Cdecl)]
 			public extern static Int32 Release (IntPtr AInstance);
 
@@ -2653,6 +2780,7 @@ namespace Lib3MF {
 					case 0x856632D0BAF1D8B7: Object = new CBase(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::Base"
 					case 0xE76F642F363FD7E9: Object = new CWriter(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::Writer"
 					case 0x2D86831DA59FBE72: Object = new CReader(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::Reader"
+					case 0x34D1B75E74821821: Object = new CStreamingWriter(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::StreamingWriter"
 					case 0x0E55A826D377483E: Object = new CPackagePart(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::PackagePart"
 					case 0xDFE3889D1B269CBB: Object = new CResource(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::Resource"
 					case 0x460F3515E2621DBE: Object = new CResourceIterator(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::ResourceIterator"
@@ -2754,7 +2882,9 @@ namespace Lib3MF {
 					case 0xFC006BC888CAB4D0: Object = new CNodeIterator(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::NodeIterator"
 					case 0x9EFB2757CA1A5231: Object = new CFunction(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::Function"
 					case 0x6CE54469EEA83BC1: Object = new CImplicitFunction(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::ImplicitFunction"
+					case 0x624A6556CD0D2735: Object = new CImplicitEvaluator(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::ImplicitEvaluator"
 					case 0x9BD7D3C2026B8CE8: Object = new CFunctionFromImage3D(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::FunctionFromImage3D"
+					case 0xABDCDB2C6189432A: Object = new CImage3DSampler(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::Image3DSampler"
 					case 0x68FB2D5FFC4BA12A: Object = new CBuildItem(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::BuildItem"
 					case 0xA7D21BD364910860: Object = new CBuildItemIterator(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::BuildItemIterator"
 					case 0x2198BCF4D8DF9C40: Object = new CSlice(Handle) as T; break; // First 64 bits of SHA1 of a string: "Lib3MF::Slice"
@@ -2888,6 +3018,51 @@ namespace Lib3MF {
 			CheckError(Internal.Lib3MFWrapper.Writer_SetDecimalPrecision (Handle, ADecimalPrecision));
 		}
 
+		public void SetShortestRoundtripActive (bool AShortestRoundtripActive)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Writer_SetShortestRoundtripActive (Handle, (Byte)( AShortestRoundtripActive ? 1 : 0 )));
+		}
+
+		public bool GetShortestRoundtripActive ()
+		{
+			Byte resultShortestRoundtripActive = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Writer_GetShortestRoundtripActive (Handle, out resultShortestRoundtripActive));
+			return (resultShortestRoundtripActive != 0);
+		}
+
+		public void SetWorkerThreadCount (UInt32 AThreadCount)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Writer_SetWorkerThreadCount (Handle, AThreadCount));
+		}
+
+		public UInt32 GetWorkerThreadCount ()
+		{
+			UInt32 resultThreadCount = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Writer_GetWorkerThreadCount (Handle, out resultThreadCount));
+			return resultThreadCount;
+		}
+
+		public void SetCompressionLevel (ePackagePartType APartType, eCompressionLevel ALevel)
+		{
+			Int32 enumPartType = (Int32) APartType;
+			Int32 enumLevel = (Int32) ALevel;
+
+			CheckError(Internal.Lib3MFWrapper.Writer_SetCompressionLevel (Handle, enumPartType, enumLevel));
+		}
+
+		public eCompressionLevel GetCompressionLevel (ePackagePartType APartType)
+		{
+			Int32 enumPartType = (Int32) APartType;
+			Int32 resultLevel = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Writer_GetCompressionLevel (Handle, enumPartType, out resultLevel));
+			return (eCompressionLevel) (resultLevel);
+		}
+
 		public void SetStrictModeActive (bool AStrictModeActive)
 		{
 
@@ -3000,6 +3175,40 @@ namespace Lib3MF {
 			return (resultStrictModeActive != 0);
 		}
 
+		public void SetWorkerThreadCount (UInt32 AThreadCount)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Reader_SetWorkerThreadCount (Handle, AThreadCount));
+		}
+
+		public UInt32 GetWorkerThreadCount ()
+		{
+			UInt32 resultThreadCount = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Reader_GetWorkerThreadCount (Handle, out resultThreadCount));
+			return resultThreadCount;
+		}
+
+		public void SetMeshStreamCallbacks (IntPtr ATheVertexBlockCallback, IntPtr ATheTriangleBlockCallback, bool ARetainGeometry, UInt64 AUserData)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Reader_SetMeshStreamCallbacks (Handle, ATheVertexBlockCallback, ATheTriangleBlockCallback, (Byte)( ARetainGeometry ? 1 : 0 ), AUserData));
+		}
+
+		public void SetLazyMeshLoadingActive (bool ALazyMeshLoadingActive)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Reader_SetLazyMeshLoadingActive (Handle, (Byte)( ALazyMeshLoadingActive ? 1 : 0 )));
+		}
+
+		public bool GetLazyMeshLoadingActive ()
+		{
+			Byte resultLazyMeshLoadingActive = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Reader_GetLazyMeshLoadingActive (Handle, out resultLazyMeshLoadingActive));
+			return (resultLazyMeshLoadingActive != 0);
+		}
+
 		public String GetWarning (UInt32 AIndex, out UInt32 AErrorCode)
 		{
 			UInt32 sizeWarning = 0;
@@ -3037,6 +3246,64 @@ namespace Lib3MF {
 
 	}
 
+	public class CStreamingWriter : CBase
+	{
+		public CStreamingWriter (IntPtr NewHandle) : base (NewHandle)
+		{
+		}
+
+		public UInt32 BeginMeshObject (String AName)
+		{
+			byte[] byteName = Encoding.UTF8.GetBytes(AName + char.MinValue);
+			UInt32 resultObjectID = 0;
+
+			CheckError(Internal.Lib3MFWrapper.StreamingWriter_BeginMeshObject (Handle, byteName, out resultObjectID));
+			return resultObjectID;
+		}
+
+		public void AddVertices (sPosition[] AVertices)
+		{
+			Internal.InternalPosition[] intdataVertices = new Internal.InternalPosition[AVertices.Length];
+			for (int index = 0; index < AVertices.Length; index++)
+				intdataVertices[index] = Internal.Lib3MFWrapper.convertStructToInternal_Position(AVertices[index]);
+			GCHandle dataVertices = GCHandle.Alloc(intdataVertices, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.StreamingWriter_AddVertices (Handle, (UInt64) AVertices.Length, dataVertices.AddrOfPinnedObject()));
+			dataVertices.Free ();
+		}
+
+		public void AddTriangles (sTriangle[] AIndices)
+		{
+			Internal.InternalTriangle[] intdataIndices = new Internal.InternalTriangle[AIndices.Length];
+			for (int index = 0; index < AIndices.Length; index++)
+				intdataIndices[index] = Internal.Lib3MFWrapper.convertStructToInternal_Triangle(AIndices[index]);
+			GCHandle dataIndices = GCHandle.Alloc(intdataIndices, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.StreamingWriter_AddTriangles (Handle, (UInt64) AIndices.Length, dataIndices.AddrOfPinnedObject()));
+			dataIndices.Free ();
+		}
+
+		public void EndMeshObject ()
+		{
+
+			CheckError(Internal.Lib3MFWrapper.StreamingWriter_EndMeshObject (Handle));
+		}
+
+		public void AddBuildItem (UInt32 AObjectID, sTransform ATransform)
+		{
+			Internal.InternalTransform intTransform = Internal.Lib3MFWrapper.convertStructToInternal_Transform (ATransform);
+
+			CheckError(Internal.Lib3MFWrapper.StreamingWriter_AddBuildItem (Handle, AObjectID, ref intTransform));
+		}
+
+		public void Finish ()
+		{
+
+			CheckError(Internal.Lib3MFWrapper.StreamingWriter_Finish (Handle));
+		}
+
+	}
+
 	public class CPackagePart : CBase
 	{
 		public CPackagePart (IntPtr NewHandle) : base (NewHandle)
@@ -3940,6 +4207,22 @@ namespace Lib3MF {
 				AVertices[index] = Internal.Lib3MFWrapper.convertInternalToStruct_Position(arrayVertices[index]);
 		}
 
+		public UInt32 GetVertexPageCount ()
+		{
+			UInt32 resultPageCount = 0;
+
+			CheckError(Internal.Lib3MFWrapper.MeshObject_GetVertexPageCount (Handle, out resultPageCount));
+			return resultPageCount;
+		}
+
+		public UInt64 GetVertexPage (UInt32 APageIndex, out UInt32 AVertexCount, out UInt32 AStride)
+		{
+			UInt64 resultCoordinates = 0;
+
+			CheckError(Internal.Lib3MFWrapper.MeshObject_GetVertexPage (Handle, APageIndex, out AVertexCount, out AStride, out resultCoordinates));
+			return resultCoordinates;
+		}
+
 		public sTriangle GetTriangle (UInt32 AIndex)
 		{
 			Internal.InternalTriangle intresultIndices;
@@ -3980,6 +4263,22 @@ namespace Lib3MF {
 				AIndices[index] = Internal.Lib3MFWrapper.convertInternalToStruct_Triangle(arrayIndices[index]);
 		}
 
+		public UInt32 GetTrianglePageCount ()
+		{
+			UInt32 resultPageCount = 0;
+
+			CheckError(Internal.Lib3MFWrapper.MeshObject_GetTrianglePageCount (Handle, out resultPageCount));
+			return resultPageCount;
+		}
+
+		public UInt64 GetTrianglePage (UInt32 APageIndex, out UInt32 ATriangleCount, out UInt32 AStride)
+		{
+			UInt64 resultIndices = 0;
+
+			CheckError(Internal.Lib3MFWrapper.MeshObject_GetTrianglePage (Handle, APageIndex, out ATriangleCount, out AStride, out resultIndices));
+			return resultIndices;
+		}
+
 		public void SetObjectLevelProperty (UInt32 AUniqueResourceID, UInt32 APropertyID)
 		{
 
@@ -4058,6 +4357,12 @@ namespace Lib3MF {
 			dataIndices.Free ();
 		}
 
+		public void ReserveGeometry (UInt32 AVertexCount, UInt32 ATriangleCount, UInt32 ABeamCount)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.MeshObject_ReserveGeometry (Handle, AVertexCount, ATriangleCount, ABeamCount));
+		}
+
 		public bool IsManifoldAndOriented ()
 		{
 			Byte resultIsManifoldAndOriented = 0;
@@ -4066,6 +4371,14 @@ namespace Lib3MF {
 			return (resultIsManifoldAndOriented != 0);
 		}
 
+		public bool IsGeometryLoaded ()
+		{
+			Byte resultIsGeometryLoaded = 0;
+
+			CheckError(Internal.Lib3MFWrapper.MeshObject_IsGeometryLoaded (Handle, out resultIsGeometryLoaded));
+			return (resultIsGeometryLoaded != 0);
+		}
+
 		public CBeamLattice BeamLattice ()
 		{
 			IntPtr newTheBeamLattice = IntPtr.Zero;
@@ -7626,6 +7939,105 @@ namespace Lib3MF {
 			CheckError(Internal.Lib3MFWrapper.ImplicitFunction_SortNodesTopologically (Handle));
 		}
 
+		public CImplicitEvaluator CreateEvaluator ()
+		{
+			IntPtr newEvaluator = IntPtr.Zero;
+
+			CheckError(Internal.Lib3MFWrapper.ImplicitFunction_CreateEvaluator (Handle, out newEvaluator));
+			return Internal.Lib3MFWrapper.PolymorphicFactory<CImplicitEvaluator>(newEvaluator);
+		}
+
+	}
+
+	public class CImplicitEvaluator : CBase
+	{
+		public CImplicitEvaluator (IntPtr NewHandle) : base (NewHandle)
+		{
+		}
+
+		public UInt32 GetInputStride ()
+		{
+			UInt32 resultStride = 0;
+
+			CheckError(Internal.Lib3MFWrapper.ImplicitEvaluator_GetInputStride (Handle, out resultStride));
+			return resultStride;
+		}
+
+		public UInt32 GetOutputStride ()
+		{
+			UInt32 resultStride = 0;
+
+			CheckError(Internal.Lib3MFWrapper.ImplicitEvaluator_GetOutputStride (Handle, out resultStride));
+			return resultStride;
+		}
+
+		public void SetWorkerThreadCount (UInt32 AThreadCount)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.ImplicitEvaluator_SetWorkerThreadCount (Handle, AThreadCount));
+		}
+
+		public UInt32 GetWorkerThreadCount ()
+		{
+			UInt32 resultThreadCount = 0;
+
+			CheckError(Internal.Lib3MFWrapper.ImplicitEvaluator_GetWorkerThreadCount (Handle, out resultThreadCount));
+			return resultThreadCount;
+		}
+
+		public void Evaluate (Double[] AInputs, out Double[] AOutputs)
+		{
+			GCHandle dataInputs = GCHandle.Alloc(AInputs, GCHandleType.Pinned);
+			UInt64 sizeOutputs = 0;
+			UInt64 neededOutputs = 0;
+			CheckError(Internal.Lib3MFWrapper.ImplicitEvaluator_Evaluate (Handle, (UInt64) AInputs.Length, dataInputs.AddrOfPinnedObject(), sizeOutputs, out neededOutputs, IntPtr.Zero));
+			sizeOutputs = neededOutputs;
+			AOutputs = new Double[sizeOutputs];
+			GCHandle dataOutputs = GCHandle.Alloc(AOutputs, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.ImplicitEvaluator_Evaluate (Handle, (UInt64) AInputs.Length, dataInputs.AddrOfPinnedObject(), sizeOutputs, out neededOutputs, dataOutputs.AddrOfPinnedObject()));
+			dataInputs.Free ();
+			dataOutputs.Free();
+		}
+
+		public void EvaluateBatch (Double[] AInputs, out Double[] AOutputs)
+		{
+			GCHandle dataInputs = GCHandle.Alloc(AInputs, GCHandleType.Pinned);
+			UInt64 sizeOutputs = 0;
+			UInt64 neededOutputs = 0;
+			CheckError(Internal.Lib3MFWrapper.ImplicitEvaluator_EvaluateBatch (Handle, (UInt64) AInputs.Length, dataInputs.AddrOfPinnedObject(), sizeOutputs, out neededOutputs, IntPtr.Zero));
+			sizeOutputs = neededOutputs;
+			AOutputs = new Double[sizeOutputs];
+			GCHandle dataOutputs = GCHandle.Alloc(AOutputs, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.ImplicitEvaluator_EvaluateBatch (Handle, (UInt64) AInputs.Length, dataInputs.AddrOfPinnedObject(), sizeOutputs, out neededOutputs, dataOutputs.AddrOfPinnedObject()));
+			dataInputs.Free ();
+			dataOutputs.Free();
+		}
+
+		public void EvaluateBounds (Double[] AInputMinima, Double[] AInputMaxima, out Double[] AOutputMinima, out Double[] AOutputMaxima)
+		{
+			GCHandle dataInputMinima = GCHandle.Alloc(AInputMinima, GCHandleType.Pinned);
+			GCHandle dataInputMaxima = GCHandle.Alloc(AInputMaxima, GCHandleType.Pinned);
+			UInt64 sizeOutputMinima = 0;
+			UInt64 neededOutputMinima = 0;
+			UInt64 sizeOutputMaxima = 0;
+			UInt64 neededOutputMaxima = 0;
+			CheckError(Internal.Lib3MFWrapper.ImplicitEvaluator_EvaluateBounds (Handle, (UInt64) AInputMinima.Length, dataInputMinima.AddrOfPinnedObject(), (UInt64) AInputMaxima.Length, dataInputMaxima.AddrOfPinnedObject(), sizeOutputMinima, out neededOutputMinima, IntPtr.Zero, sizeOutputMaxima, out neededOutputMaxima, IntPtr.Zero));
+			sizeOutputMinima = neededOutputMinima;
+			AOutputMinima = new Double[sizeOutputMinima];
+			GCHandle dataOutputMinima = GCHandle.Alloc(AOutputMinima, GCHandleType.Pinned);
+			sizeOutputMaxima = neededOutputMaxima;
+			AOutputMaxima = new Double[sizeOutputMaxima];
+			GCHandle dataOutputMaxima = GCHandle.Alloc(AOutputMaxima, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.ImplicitEvaluator_EvaluateBounds (Handle, (UInt64) AInputMinima.Length, dataInputMinima.AddrOfPinnedObject(), (UInt64) AInputMaxima.Length, dataInputMaxima.AddrOfPinnedObject(), sizeOutputMinima, out neededOutputMinima, dataOutputMinima.AddrOfPinnedObject(), sizeOutputMaxima, out neededOutputMaxima, dataOutputMaxima.AddrOfPinnedObject()));
+			dataInputMinima.Free ();
+			dataInputMaxima.Free ();
+			dataOutputMinima.Free();
+			dataOutputMaxima.Free();
+		}
+
 	}
 
 	public class CFunctionFromImage3D : CFunction
@@ -7715,6 +8127,65 @@ namespace Lib3MF {
 			CheckError(Internal.Lib3MFWrapper.FunctionFromImage3D_SetScale (Handle, AScale));
 		}
 
+		public CImage3DSampler CreateSampler ()
+		{
+			IntPtr newSampler = IntPtr.Zero;
+
+			CheckError(Internal.Lib3MFWrapper.FunctionFromImage3D_CreateSampler (Handle, out newSampler));
+			return Internal.Lib3MFWrapper.PolymorphicFactory<CImage3DSampler>(newSampler);
+		}
+
+	}
+
+	public class CImage3DSampler : CBase
+	{
+		public CImage3DSampler (IntPtr NewHandle) : base (NewHandle)
+		{
+		}
+
+		public void SetCacheSize (UInt64 ACacheSize)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Image3DSampler_SetCacheSize (Handle, ACacheSize));
+		}
+
+		public UInt64 GetCacheSize ()
+		{
+			UInt64 resultCacheSize = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Image3DSampler_GetCacheSize (Handle, out resultCacheSize));
+			return resultCacheSize;
+		}
+
+		public void SetWorkerThreadCount (UInt32 AThreadCount)
+		{
+
+			CheckError(Internal.Lib3MFWrapper.Image3DSampler_SetWorkerThreadCount (Handle, AThreadCount));
+		}
+
+		public UInt32 GetWorkerThreadCount ()
+		{
+			UInt32 resultThreadCount = 0;
+
+			CheckError(Internal.Lib3MFWrapper.Image3DSampler_GetWorkerThreadCount (Handle, out resultThreadCount));
+			return resultThreadCount;
+		}
+
+		public void Sample (Double[] AUVW, out Double[] ARGBA)
+		{
+			GCHandle dataUVW = GCHandle.Alloc(AUVW, GCHandleType.Pinned);
+			UInt64 sizeRGBA = 0;
+			UInt64 neededRGBA = 0;
+			CheckError(Internal.Lib3MFWrapper.Image3DSampler_Sample (Handle, (UInt64) AUVW.Length, dataUVW.AddrOfPinnedObject(), sizeRGBA, out neededRGBA, IntPtr.Zero));
+			sizeRGBA = neededRGBA;
+			ARGBA = new Double[sizeRGBA];
+			GCHandle dataRGBA = GCHandle.Alloc(ARGBA, GCHandleType.Pinned);
+
+			CheckError(Internal.Lib3MFWrapper.Image3DSampler_Sample (Handle, (UInt64) AUVW.Length, dataUVW.AddrOfPinnedObject(), sizeRGBA, out neededRGBA, dataRGBA.AddrOfPinnedObject()));
+			dataUVW.Free ();
+			dataRGBA.Free();
+		}
+
 	}
 
 	public class CBuildItem : CBase
@@ -9205,6 +9676,16 @@ namespace Lib3MF {
 			return Internal.Lib3MFWrapper.PolymorphicFactory<CModel>(newModel);
 		}
 
+		public static CStreamingWriter CreateStreamingWriter (String AFilename, eModelUnit AUnit)
+		{
+			byte[] byteFilename = Encoding.UTF8.GetBytes(AFilename + char.MinValue);
+			Int32 enumUnit = (Int32) AUnit;
+			IntPtr newStreamingWriter = IntPtr.Zero;
+
+			CheckError(Internal.Lib3MFWrapper.CreateStreamingWriter (byteFilename, enumUnit, out newStreamingWriter));
+			return Internal.Lib3MFWrapper.PolymorphicFactory<CStreamingWriter>(newStreamingWriter);
+		}
+
 		public static void Release (CBase AInstance)
 		{
 			IntPtr AInstanceHandle = IntPtr.Zero;
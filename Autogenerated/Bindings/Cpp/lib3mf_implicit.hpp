@@ -60,6 +60,7 @@ class CWrapper;
 class CBase;
 class CWriter;
 class CReader;
+class CStreamingWriter;
 class CPackagePart;
 class CResource;
 class CResourceIterator;
@@ -161,7 +162,9 @@ class CFunctionCallNode;
 class CNodeIterator;
 class CFunction;
 class CImplicitFunction;
+class CImplicitEvaluator;
 class CFunctionFromImage3D;
+class CImage3DSampler;
 class CBuildItem;
 class CBuildItemIterator;
 class CSlice;
@@ -181,6 +184,7 @@ typedef CWrapper CLib3MFWrapper;
 typedef CBase CLib3MFBase;
 typedef CWriter CLib3MFWriter;
 typedef CReader CLib3MFReader;
+typedef CStreamingWriter CLib3MFStreamingWriter;
 typedef CPackagePart CLib3MFPackagePart;
 typedef CResource CLib3MFResource;
 typedef CResourceIterator CLib3MFResourceIterator;
@@ -282,7 +286,9 @@ typedef CFunctionCallNode CLib3MFFunctionCallNode;
 typedef CNodeIterator CLib3MFNodeIterator;
 typedef CFunction CLib3MFFunction;
 typedef CImplicitFunction CLib3MFImplicitFunction;
+typedef CImplicitEvaluator CLib3MFImplicitEvaluator;
 typedef CFunctionFromImage3D CLib3MFFunctionFromImage3D;
+typedef CImage3DSampler CLib3MFImage3DSampler;
 typedef CBuildItem CLib3MFBuildItem;
 typedef CBuildItemIterator CLib3MFBuildItemIterator;
 typedef CSlice CLib3MFSlice;
@@ -302,6 +308,7 @@ typedef std::shared_ptr<CWrapper> PWrapper;
 typedef std::shared_ptr<CBase> PBase;
 typedef std::shared_ptr<CWriter> PWriter;
 typedef std::shared_ptr<CReader> PReader;
+typedef std::shared_ptr<CStreamingWriter> PStreamingWriter;
 typedef std::shared_ptr<CPackagePart> PPackagePart;
 typedef std::shared_ptr<CResource> PResource;
 typedef std::shared_ptr<CResourceIterator> PResourceIterator;
@@ -403,7 +410,9 @@ typedef std::shared_ptr<CFunctionCallNode> PFunctionCallNode;
 typedef std::shared_ptr<CNodeIterator> PNodeIterator;
 typedef std::shared_ptr<CFunction> PFunction;
 typedef std::shared_ptr<CImplicitFunction> PImplicitFunction;
+typedef std::shared_ptr<CImplicitEvaluator> PImplicitEvaluator;
 typedef std::shared_ptr<CFunctionFromImage3D> PFunctionFromImage3D;
+typedef std::shared_ptr<CImage3DSampler> PImage3DSampler;
 typedef std::shared_ptr<CBuildItem> PBuildItem;
 typedef std::shared_ptr<CBuildItemIterator> PBuildItemIterator;
 typedef std::shared_ptr<CSlice> PSlice;
@@ -423,6 +432,7 @@ typedef PWrapper PLib3MFWrapper;
 typedef PBase PLib3MFBase;
 typedef PWriter PLib3MFWriter;
 typedef PReader PLib3MFReader;
+typedef PStreamingWriter PLib3MFStreamingWriter;
 typedef PPackagePart PLib3MFPackagePart;
 typedef PResource PLib3MFResource;
 typedef PResourceIterator PLib3MFResourceIterator;
@@ -524,7 +534,9 @@ typedef PFunctionCallNode PLib3MFFunctionCallNode;
 typedef PNodeIterator PLib3MFNodeIterator;
 typedef PFunction PLib3MFFunction;
 typedef PImplicitFunction PLib3MFImplicitFunction;
+typedef PImplicitEvaluator PLib3MFImplicitEvaluator;
 typedef PFunctionFromImage3D PLib3MFFunctionFromImage3D;
+typedef PImage3DSampler PLib3MFImage3DSampler;
 typedef PBuildItem PLib3MFBuildItem;
 typedef PBuildItemIterator PLib3MFBuildItemIterator;
 typedef PSlice PLib3MFSlice;
@@ -804,6 +816,7 @@ public:
 	inline bool GetBuildInformation(std::string & sBuildInformation);
 	inline void GetSpecificationVersion(const std::string & sSpecificationURL, bool & bIsSupported, Lib3MF_uint32 & nMajor, Lib3MF_uint32 & nMinor, Lib3MF_uint32 & nMicro);
 	inline PModel CreateModel();
+	inline PStreamingWriter CreateStreamingWriter(const std::string & sFilename, const eModelUnit eUnit);
 	inline void Release(classParam<CBase> pInstance);
 	inline void Acquire(classParam<CBase> pInstance);
 	inline void SetJournal(const std::string & sJournalPath);
@@ -836,6 +849,7 @@ private:
 	friend class CBase;
 	friend class CWriter;
 	friend class CReader;
+	friend class CStreamingWriter;
 	friend class CPackagePart;
 	friend class CResource;
 	friend class CResourceIterator;
@@ -937,7 +951,9 @@ private:
 	friend class CNodeIterator;
 	friend class CFunction;
 	friend class CImplicitFunction;
+	friend class CImplicitEvaluator;
 	friend class CFunctionFromImage3D;
+	friend class CImage3DSampler;
 	friend class CBuildItem;
 	friend class CBuildItemIterator;
 	friend class CSlice;
@@ -1031,6 +1047,12 @@ public:
 	inline void SetProgressCallback(const ProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData);
 	inline Lib3MF_uint32 GetDecimalPrecision();
 	inline void SetDecimalPrecision(const Lib3MF_uint32 nDecimalPrecision);
+	inline void SetShortestRoundtripActive(const bool bShortestRoundtripActive);
+	inline bool GetShortestRoundtripActive();
+	inline void SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount);
+	inline Lib3MF_uint32 GetWorkerThreadCount();
+	inline void SetCompressionLevel(const ePackagePartType ePartType, const eCompressionLevel eLevel);
+	inline eCompressionLevel GetCompressionLevel(const ePackagePartType ePartType);
 	inline void SetStrictModeActive(const bool bStrictModeActive);
 	inline bool GetStrictModeActive();
 	inline std::string GetWarning(const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErrorCode);
@@ -1061,12 +1083,39 @@ public:
 	inline void RemoveRelationToRead(const std::string & sRelationShipType);
 	inline void SetStrictModeActive(const bool bStrictModeActive);
 	inline bool GetStrictModeActive();
+	inline void SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount);
+	inline Lib3MF_uint32 GetWorkerThreadCount();
+	inline void SetMeshStreamCallbacks(const VertexBlockCallback pTheVertexBlockCallback, const TriangleBlockCallback pTheTriangleBlockCallback, const bool bRetainGeometry, const Lib3MF_pvoid pUserData);
+	inline void SetLazyMeshLoadingActive(const bool bLazyMeshLoadingActive);
+	inline bool GetLazyMeshLoadingActive();
 	inline std::string GetWarning(const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErrorCode);
 	inline Lib3MF_uint32 GetWarningCount();
 	inline void AddKeyWrappingCallback(const std::string & sConsumerID, const KeyWrappingCallback pTheCallback, const Lib3MF_pvoid pUserData);
 	inline void SetContentEncryptionCallback(const ContentEncryptionCallback pTheCallback, const Lib3MF_pvoid pUserData);
 };
 	
+/*************************************************************************************************************************
+ Class CStreamingWriter 
+**************************************************************************************************************************/
+class CStreamingWriter : public CBase {
+public:
+	
+	/**
+	* CStreamingWriter::CStreamingWriter - Constructor for StreamingWriter class.
+	*/
+	CStreamingWriter(CWrapper* pWrapper, Lib3MFHandle pHandle)
+		: CBase(pWrapper, pHandle)
+	{
+	}
+	
+	inline Lib3MF_uint32 BeginMeshObject(const std::string & sName);
+	inline void AddVertices(const CInputVector<sPosition> & VerticesBuffer);
+	inline void AddTriangles(const CInputVector<sTriangle> & IndicesBuffer);
+	inline void EndMeshObject();
+	inline void AddBuildItem(const Lib3MF_uint32 nObjectID, const sTransform & Transform);
+	inline void Finish();
+};
+	
 /*************************************************************************************************************************
  Class CPackagePart 
 **************************************************************************************************************************/
@@ -1485,10 +1534,14 @@ public:
 	inline void SetVertex(const Lib3MF_uint32 nIndex, const sPosition & Coordinates);
 	inline Lib3MF_uint32 AddVertex(const sPosition & Coordinates);
 	inline void GetVertices(std::vector<sPosition> & VerticesBuffer);
+	inline Lib3MF_uint32 GetVertexPageCount();
+	inline Lib3MF_pvoid GetVertexPage(const Lib3MF_uint32 nPageIndex, Lib3MF_uint32 & nVertexCount, Lib3MF_uint32 & nStride);
 	inline sTriangle GetTriangle(const Lib3MF_uint32 nIndex);
 	inline void SetTriangle(const Lib3MF_uint32 nIndex, const sTriangle & Indices);
 	inline Lib3MF_uint32 AddTriangle(const sTriangle & Indices);
 	inline void GetTriangleIndices(std::vector<sTriangle> & IndicesBuffer);
+	inline Lib3MF_uint32 GetTrianglePageCount();
+	inline Lib3MF_pvoid GetTrianglePage(const Lib3MF_uint32 nPageIndex, Lib3MF_uint32 & nTriangleCount, Lib3MF_uint32 & nStride);
 	inline void SetObjectLevelProperty(const Lib3MF_uint32 nUniqueResourceID, const Lib3MF_uint32 nPropertyID);
 	inline bool GetObjectLevelProperty(Lib3MF_uint32 & nUniqueResourceID, Lib3MF_uint32 & nPropertyID);
 	inline void SetTriangleProperties(const Lib3MF_uint32 nIndex, const sTriangleProperties & Properties);
@@ -1497,7 +1550,9 @@ public:
 	inline void GetAllTriangleProperties(std::vector<sTriangleProperties> & PropertiesArrayBuffer);
 	inline void ClearAllProperties();
 	inline void SetGeometry(const CInputVector<sPosition> & VerticesBuffer, const CInputVector<sTriangle> & IndicesBuffer);
+	inline void ReserveGeometry(const Lib3MF_uint32 nVertexCount, const Lib3MF_uint32 nTriangleCount, const Lib3MF_uint32 nBeamCount);
 	inline bool IsManifoldAndOriented();
+	inline bool IsGeometryLoaded();
 	inline PBeamLattice BeamLattice();
 	inline PVolumeData GetVolumeData();
 	inline void SetVolumeData(classParam<CVolumeData> pTheVolumeData);
@@ -3099,6 +3154,30 @@ public:
 	inline void AddLinkByNames(const std::string & sSource, const std::string & sTarget);
 	inline void Clear();
 	inline void SortNodesTopologically();
+	inline PImplicitEvaluator CreateEvaluator();
+};
+	
+/*************************************************************************************************************************
+ Class CImplicitEvaluator 
+**************************************************************************************************************************/
+class CImplicitEvaluator : public CBase {
+public:
+	
+	/**
+	* CImplicitEvaluator::CImplicitEvaluator - Constructor for ImplicitEvaluator class.
+	*/
+	CImplicitEvaluator(CWrapper* pWrapper, Lib3MFHandle pHandle)
+		: CBase(pWrapper, pHandle)
+	{
+	}
+	
+	inline Lib3MF_uint32 GetInputStride();
+	inline Lib3MF_uint32 GetOutputStride();
+	inline void SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount);
+	inline Lib3MF_uint32 GetWorkerThreadCount();
+	inline void Evaluate(const CInputVector<Lib3MF_double> & InputsBuffer, std::vector<Lib3MF_double> & OutputsBuffer);
+	inline void EvaluateBatch(const CInputVector<Lib3MF_double> & InputsBuffer, std::vector<Lib3MF_double> & OutputsBuffer);
+	inline void EvaluateBounds(const CInputVector<Lib3MF_double> & InputMinimaBuffer, const CInputVector<Lib3MF_double> & InputMaximaBuffer, std::vector<Lib3MF_double> & OutputMinimaBuffer, std::vector<Lib3MF_double> & OutputMaximaBuffer);
 };
 	
 /*************************************************************************************************************************
@@ -3125,6 +3204,28 @@ public:
 	inline void SetOffset(const Lib3MF_double dOffset);
 	inline Lib3MF_double GetScale();
 	inline void SetScale(const Lib3MF_double dScale);
+	inline PImage3DSampler CreateSampler();
+};
+	
+/*************************************************************************************************************************
+ Class CImage3DSampler 
+**************************************************************************************************************************/
+class CImage3DSampler : public CBase {
+public:
+	
+	/**
+	* CImage3DSampler::CImage3DSampler - Constructor for Image3DSampler class.
+	*/
+	CImage3DSampler(CWrapper* pWrapper, Lib3MFHandle pHandle)
+		: CBase(pWrapper, pHandle)
+	{
+	}
+	
+	inline void SetCacheSize(const Lib3MF_uint64 nCacheSize);
+	inline Lib3MF_uint64 GetCacheSize();
+	inline void SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount);
+	inline Lib3MF_uint32 GetWorkerThreadCount();
+	inline void Sample(const CInputVector<Lib3MF_double> & UVWBuffer, std::vector<Lib3MF_double> & RGBABuffer);
 };
 	
 /*************************************************************************************************************************
@@ -3469,6 +3570,7 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		case 0x856632D0BAF1D8B7UL: return new CBase(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::Base"
 		case 0xE76F642F363FD7E9UL: return new CWriter(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::Writer"
 		case 0x2D86831DA59FBE72UL: return new CReader(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::Reader"
+		case 0x34D1B75E74821821UL: return new CStreamingWriter(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::StreamingWriter"
 		case 0x0E55A826D377483EUL: return new CPackagePart(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::PackagePart"
 		case 0xDFE3889D1B269CBBUL: return new CResource(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::Resource"
 		case 0x460F3515E2621DBEUL: return new CResourceIterator(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::ResourceIterator"
@@ -3570,7 +3672,9 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		case 0xFC006BC888CAB4D0UL: return new CNodeIterator(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::NodeIterator"
 		case 0x9EFB2757CA1A5231UL: return new CFunction(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::Function"
 		case 0x6CE54469EEA83BC1UL: return new CImplicitFunction(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::ImplicitFunction"
+		case 0x624A6556CD0D2735UL: return new CImplicitEvaluator(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::ImplicitEvaluator"
 		case 0x9BD7D3C2026B8CE8UL: return new CFunctionFromImage3D(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::FunctionFromImage3D"
+		case 0xABDCDB2C6189432AUL: return new CImage3DSampler(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::Image3DSampler"
 		case 0x68FB2D5FFC4BA12AUL: return new CBuildItem(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::BuildItem"
 		case 0xA7D21BD364910860UL: return new CBuildItemIterator(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::BuildItemIterator"
 		case 0x2198BCF4D8DF9C40UL: return new CSlice(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::Slice"
@@ -3661,6 +3765,23 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return std::shared_ptr<CModel>(dynamic_cast<CModel*>(this->polymorphicFactory(hModel)));
 	}
 	
+	/**
+	* CWrapper::CreateStreamingWriter - creates a writer, which streams mesh objects into a new 3MF file while they are generated.
+	* @param[in] sFilename - Filename to write into
+	* @param[in] eUnit - Unit of the model
+	* @return returns the streaming writer instance
+	*/
+	inline PStreamingWriter CWrapper::CreateStreamingWriter(const std::string & sFilename, const eModelUnit eUnit)
+	{
+		Lib3MFHandle hStreamingWriter = (Lib3MFHandle)nullptr;
+		CheckError(nullptr,lib3mf_createstreamingwriter(sFilename.c_str(), eUnit, &hStreamingWriter));
+		
+		if (!hStreamingWriter) {
+			CheckError(nullptr,LIB3MF_ERROR_INVALIDPARAM);
+		}
+		return std::shared_ptr<CStreamingWriter>(dynamic_cast<CStreamingWriter*>(this->polymorphicFactory(hStreamingWriter)));
+	}
+	
 	/**
 	* CWrapper::Release - releases shared ownership of an object instance
 	* @param[in] pInstance - the object instance to release
@@ -3959,6 +4080,71 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(lib3mf_writer_setdecimalprecision(m_pHandle, nDecimalPrecision));
 	}
 	
+	/**
+	* CWriter::SetShortestRoundtripActive - Activates (deactivates) the shortest round-trip output of mesh coordinates and radii. Each value is written with the fewest digits that read back as exactly the same number; the decimal precision is ignored while active.
+	* @param[in] bShortestRoundtripActive - flag whether shortest round-trip output is active or not.
+	*/
+	void CWriter::SetShortestRoundtripActive(const bool bShortestRoundtripActive)
+	{
+		CheckError(lib3mf_writer_setshortestroundtripactive(m_pHandle, bShortestRoundtripActive));
+	}
+	
+	/**
+	* CWriter::GetShortestRoundtripActive - Queries whether the shortest round-trip output of mesh coordinates and radii is active or not.
+	* @return returns flag whether shortest round-trip output is active or not.
+	*/
+	bool CWriter::GetShortestRoundtripActive()
+	{
+		bool resultShortestRoundtripActive = 0;
+		CheckError(lib3mf_writer_getshortestroundtripactive(m_pHandle, &resultShortestRoundtripActive));
+		
+		return resultShortestRoundtripActive;
+	}
+	
+	/**
+	* CWriter::SetWorkerThreadCount - Sets the number of threads the writer may use to compress package parts and to render large meshes. 0 selects the number of hardware threads, 1 disables parallel writing.
+	* @param[in] nThreadCount - Number of threads, including the calling thread. 0 means automatic.
+	*/
+	void CWriter::SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount)
+	{
+		CheckError(lib3mf_writer_setworkerthreadcount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CWriter::GetWorkerThreadCount - Returns the number of threads the writer may use to compress package parts and to render large meshes.
+	* @return Number of threads, including the calling thread. 0 means automatic.
+	*/
+	Lib3MF_uint32 CWriter::GetWorkerThreadCount()
+	{
+		Lib3MF_uint32 resultThreadCount = 0;
+		CheckError(lib3mf_writer_getworkerthreadcount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
+	/**
+	* CWriter::SetCompressionLevel - Sets the compression of all parts of a kind. Already compressed images are best stored without compression.
+	* @param[in] ePartType - The kind of parts to configure.
+	* @param[in] eLevel - The compression level. Defaults to Fastest for all kinds of parts. Once it is set, encrypted parts are deflated with it before encryption and stored without further compression.
+	*/
+	void CWriter::SetCompressionLevel(const ePackagePartType ePartType, const eCompressionLevel eLevel)
+	{
+		CheckError(lib3mf_writer_setcompressionlevel(m_pHandle, ePartType, eLevel));
+	}
+	
+	/**
+	* CWriter::GetCompressionLevel - Returns the compression of all parts of a kind.
+	* @param[in] ePartType - The kind of parts to query.
+	* @return The compression level.
+	*/
+	eCompressionLevel CWriter::GetCompressionLevel(const ePackagePartType ePartType)
+	{
+		eCompressionLevel resultLevel = (eCompressionLevel) 0;
+		CheckError(lib3mf_writer_getcompressionlevel(m_pHandle, ePartType, &resultLevel));
+		
+		return resultLevel;
+	}
+	
 	/**
 	* CWriter::SetStrictModeActive - Activates (deactivates) the strict mode of the reader.
 	* @param[in] bStrictModeActive - flag whether strict mode is active or not.
@@ -4114,6 +4300,60 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return resultStrictModeActive;
 	}
 	
+	/**
+	* CReader::SetWorkerThreadCount - Sets the number of threads the reader may use to decode mesh data. 0 selects the number of hardware threads. With 1 (the default), vertex and triangle lists are still decoded by the streaming mesh decoder, but on the calling thread only.
+	* @param[in] nThreadCount - Number of threads, including the calling thread. 0 means automatic.
+	*/
+	void CReader::SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount)
+	{
+		CheckError(lib3mf_reader_setworkerthreadcount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CReader::GetWorkerThreadCount - Returns the number of threads the reader may use to decode mesh data.
+	* @return Number of threads, including the calling thread. 0 means automatic.
+	*/
+	Lib3MF_uint32 CReader::GetWorkerThreadCount()
+	{
+		Lib3MF_uint32 resultThreadCount = 0;
+		CheckError(lib3mf_reader_getworkerthreadcount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
+	/**
+	* CReader::SetMeshStreamCallbacks - Hands the vertices and triangles of all mesh objects to callbacks in blocks while they are read. Blocks of one mesh object are delivered in document order, and vertices are delivered before the triangles that refer to them. If the geometry is not retained, the meshes of the read model stay empty, while objects, components and build items are still read. Beam lattices and triangle sets require the geometry to be retained.
+	* @param[in] pTheVertexBlockCallback - Callback to call for every block of vertices. May be null.
+	* @param[in] pTheTriangleBlockCallback - Callback to call for every block of triangles. May be null.
+	* @param[in] bRetainGeometry - If true, the geometry is read into the model as well.
+	* @param[in] pUserData - Userdata that is passed to the callback functions
+	*/
+	void CReader::SetMeshStreamCallbacks(const VertexBlockCallback pTheVertexBlockCallback, const TriangleBlockCallback pTheTriangleBlockCallback, const bool bRetainGeometry, const Lib3MF_pvoid pUserData)
+	{
+		CheckError(lib3mf_reader_setmeshstreamcallbacks(m_pHandle, pTheVertexBlockCallback, pTheTriangleBlockCallback, bRetainGeometry, pUserData));
+	}
+	
+	/**
+	* CReader::SetLazyMeshLoadingActive - Defers parsing the geometry of mesh objects until it is first accessed. The model part is kept in memory after reading, and each mesh is parsed from it on first access. Ignored if mesh stream callbacks are set.
+	* @param[in] bLazyMeshLoadingActive - Flag whether mesh geometry is parsed on first access
+	*/
+	void CReader::SetLazyMeshLoadingActive(const bool bLazyMeshLoadingActive)
+	{
+		CheckError(lib3mf_reader_setlazymeshloadingactive(m_pHandle, bLazyMeshLoadingActive));
+	}
+	
+	/**
+	* CReader::GetLazyMeshLoadingActive - Returns whether mesh geometry is parsed on first access.
+	* @return Flag whether mesh geometry is parsed on first access
+	*/
+	bool CReader::GetLazyMeshLoadingActive()
+	{
+		bool resultLazyMeshLoadingActive = 0;
+		CheckError(lib3mf_reader_getlazymeshloadingactive(m_pHandle, &resultLazyMeshLoadingActive));
+		
+		return resultLazyMeshLoadingActive;
+	}
+	
 	/**
 	* CReader::GetWarning - Returns Warning and Error Information of the read process
 	* @param[in] nIndex - Index of the Warning. Valid values are 0 to WarningCount - 1
@@ -4164,6 +4404,67 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(lib3mf_reader_setcontentencryptioncallback(m_pHandle, pTheCallback, pUserData));
 	}
 	
+	/**
+	 * Method definitions for class CStreamingWriter
+	 */
+	
+	/**
+	* CStreamingWriter::BeginMeshObject - Starts a new mesh object. All of its vertices must be added before its triangles.
+	* @param[in] sName - Name of the object. May be empty.
+	* @return Resource ID of the new mesh object.
+	*/
+	Lib3MF_uint32 CStreamingWriter::BeginMeshObject(const std::string & sName)
+	{
+		Lib3MF_uint32 resultObjectID = 0;
+		CheckError(lib3mf_streamingwriter_beginmeshobject(m_pHandle, sName.c_str(), &resultObjectID));
+		
+		return resultObjectID;
+	}
+	
+	/**
+	* CStreamingWriter::AddVertices - Writes a batch of vertices of the current mesh object. Vertex indices continue over all batches of the object.
+	* @param[in] VerticesBuffer - Positions of the vertices
+	*/
+	void CStreamingWriter::AddVertices(const CInputVector<sPosition> & VerticesBuffer)
+	{
+		CheckError(lib3mf_streamingwriter_addvertices(m_pHandle, (Lib3MF_uint64)VerticesBuffer.size(), VerticesBuffer.data()));
+	}
+	
+	/**
+	* CStreamingWriter::AddTriangles - Writes a batch of triangles of the current mesh object. No further vertices may be added to the object afterwards.
+	* @param[in] IndicesBuffer - Vertex indices of the triangles. They must refer to vertices, which have already been added to the object.
+	*/
+	void CStreamingWriter::AddTriangles(const CInputVector<sTriangle> & IndicesBuffer)
+	{
+		CheckError(lib3mf_streamingwriter_addtriangles(m_pHandle, (Lib3MF_uint64)IndicesBuffer.size(), IndicesBuffer.data()));
+	}
+	
+	/**
+	* CStreamingWriter::EndMeshObject - Finishes the current mesh object.
+	*/
+	void CStreamingWriter::EndMeshObject()
+	{
+		CheckError(lib3mf_streamingwriter_endmeshobject(m_pHandle));
+	}
+	
+	/**
+	* CStreamingWriter::AddBuildItem - Adds a build item. It is written when the package is finished.
+	* @param[in] nObjectID - Resource ID of a finished mesh object.
+	* @param[in] Transform - Transformation matrix.
+	*/
+	void CStreamingWriter::AddBuildItem(const Lib3MF_uint32 nObjectID, const sTransform & Transform)
+	{
+		CheckError(lib3mf_streamingwriter_addbuilditem(m_pHandle, nObjectID, &Transform));
+	}
+	
+	/**
+	* CStreamingWriter::Finish - Writes the build items and closes the package. No further calls are allowed afterwards.
+	*/
+	void CStreamingWriter::Finish()
+	{
+		CheckError(lib3mf_streamingwriter_finish(m_pHandle));
+	}
+	
 	/**
 	 * Method definitions for class CPackagePart
 	 */
@@ -5295,6 +5596,33 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(lib3mf_meshobject_getvertices(m_pHandle, elementsNeededVertices, &elementsWrittenVertices, VerticesBuffer.data()));
 	}
 	
+	/**
+	* CMeshObject::GetVertexPageCount - Returns the number of pages in which the vertices of the mesh object are stored.
+	* @return the number of vertex pages.
+	*/
+	Lib3MF_uint32 CMeshObject::GetVertexPageCount()
+	{
+		Lib3MF_uint32 resultPageCount = 0;
+		CheckError(lib3mf_meshobject_getvertexpagecount(m_pHandle, &resultPageCount));
+		
+		return resultPageCount;
+	}
+	
+	/**
+	* CMeshObject::GetVertexPage - Returns direct read access to a page of vertices without copying them. The memory is owned by the mesh object, must not be written to and is only valid until the mesh is modified or released.
+	* @param[in] nPageIndex - index of the page (0 to pagecount - 1).
+	* @param[out] nVertexCount - number of vertices stored in the page.
+	* @param[out] nStride - distance in bytes between two consecutive vertices.
+	* @return pointer to the three single precision coordinates of the first vertex in the page.
+	*/
+	Lib3MF_pvoid CMeshObject::GetVertexPage(const Lib3MF_uint32 nPageIndex, Lib3MF_uint32 & nVertexCount, Lib3MF_uint32 & nStride)
+	{
+		Lib3MF_pvoid resultCoordinates = 0;
+		CheckError(lib3mf_meshobject_getvertexpage(m_pHandle, nPageIndex, &nVertexCount, &nStride, &resultCoordinates));
+		
+		return resultCoordinates;
+	}
+	
 	/**
 	* CMeshObject::GetTriangle - Returns indices of a single triangle of a mesh object.
 	* @param[in] nIndex - Index of the triangle (0 to trianglecount - 1)
@@ -5344,6 +5672,33 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(lib3mf_meshobject_gettriangleindices(m_pHandle, elementsNeededIndices, &elementsWrittenIndices, IndicesBuffer.data()));
 	}
 	
+	/**
+	* CMeshObject::GetTrianglePageCount - Returns the number of pages in which the triangles of the mesh object are stored.
+	* @return the number of triangle pages.
+	*/
+	Lib3MF_uint32 CMeshObject::GetTrianglePageCount()
+	{
+		Lib3MF_uint32 resultPageCount = 0;
+		CheckError(lib3mf_meshobject_gettrianglepagecount(m_pHandle, &resultPageCount));
+		
+		return resultPageCount;
+	}
+	
+	/**
+	* CMeshObject::GetTrianglePage - Returns direct read access to a page of triangles without copying them. The memory is owned by the mesh object, must not be written to and is only valid until the mesh is modified or released.
+	* @param[in] nPageIndex - index of the page (0 to pagecount - 1).
+	* @param[out] nTriangleCount - number of triangles stored in the page.
+	* @param[out] nStride - distance in bytes between two consecutive triangles.
+	* @return pointer to the three 32 bit vertex indices of the first triangle in the page.
+	*/
+	Lib3MF_pvoid CMeshObject::GetTrianglePage(const Lib3MF_uint32 nPageIndex, Lib3MF_uint32 & nTriangleCount, Lib3MF_uint32 & nStride)
+	{
+		Lib3MF_pvoid resultIndices = 0;
+		CheckError(lib3mf_meshobject_gettrianglepage(m_pHandle, nPageIndex, &nTriangleCount, &nStride, &resultIndices));
+		
+		return resultIndices;
+	}
+	
 	/**
 	* CMeshObject::SetObjectLevelProperty - Sets the property at the object-level of the mesh object.
 	* @param[in] nUniqueResourceID - the object-level Property UniqueResourceID.
@@ -5431,6 +5786,17 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(lib3mf_meshobject_setgeometry(m_pHandle, nVerticesSize, VerticesBuffer.data(), nIndicesSize, IndicesBuffer.data()));
 	}
 	
+	/**
+	* CMeshObject::ReserveGeometry - Preallocates memory for the given total numbers of vertices, triangles and beams, so that they can be added without further allocations.
+	* @param[in] nVertexCount - number of vertices to reserve memory for.
+	* @param[in] nTriangleCount - number of triangles to reserve memory for.
+	* @param[in] nBeamCount - number of beams to reserve memory for.
+	*/
+	void CMeshObject::ReserveGeometry(const Lib3MF_uint32 nVertexCount, const Lib3MF_uint32 nTriangleCount, const Lib3MF_uint32 nBeamCount)
+	{
+		CheckError(lib3mf_meshobject_reservegeometry(m_pHandle, nVertexCount, nTriangleCount, nBeamCount));
+	}
+	
 	/**
 	* CMeshObject::IsManifoldAndOriented - Retrieves, if an object describes a topologically oriented and manifold mesh, according to the core spec.
 	* @return returns, if the object is oriented and manifold.
@@ -5443,6 +5809,18 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return resultIsManifoldAndOriented;
 	}
 	
+	/**
+	* CMeshObject::IsGeometryLoaded - Retrieves, if the geometry of an object has been loaded. Meshes read with lazy mesh loading are only loaded when their geometry is accessed for the first time.
+	* @return returns, if the geometry of the object has been loaded.
+	*/
+	bool CMeshObject::IsGeometryLoaded()
+	{
+		bool resultIsGeometryLoaded = 0;
+		CheckError(lib3mf_meshobject_isgeometryloaded(m_pHandle, &resultIsGeometryLoaded));
+		
+		return resultIsGeometryLoaded;
+	}
+	
 	/**
 	* CMeshObject::BeamLattice - Retrieves the BeamLattice within this MeshObject.
 	* @return the BeamLattice within this MeshObject
@@ -10176,6 +10554,117 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(lib3mf_implicitfunction_sortnodestopologically(m_pHandle));
 	}
 	
+	/**
+	* CImplicitFunction::CreateEvaluator - Compiles the function into an evaluator. Later changes of the function do not affect the evaluator.
+	* @return the evaluator
+	*/
+	PImplicitEvaluator CImplicitFunction::CreateEvaluator()
+	{
+		Lib3MFHandle hEvaluator = (Lib3MFHandle)nullptr;
+		CheckError(lib3mf_implicitfunction_createevaluator(m_pHandle, &hEvaluator));
+		
+		if (!hEvaluator) {
+			CheckError(LIB3MF_ERROR_INVALIDPARAM);
+		}
+		return std::shared_ptr<CImplicitEvaluator>(dynamic_cast<CImplicitEvaluator*>(m_pWrapper->polymorphicFactory(hEvaluator)));
+	}
+	
+	/**
+	 * Method definitions for class CImplicitEvaluator
+	 */
+	
+	/**
+	* CImplicitEvaluator::GetInputStride - Returns the number of input values per point. Vector inputs take 3 values, matrix inputs 16.
+	* @return number of input values per point
+	*/
+	Lib3MF_uint32 CImplicitEvaluator::GetInputStride()
+	{
+		Lib3MF_uint32 resultStride = 0;
+		CheckError(lib3mf_implicitevaluator_getinputstride(m_pHandle, &resultStride));
+		
+		return resultStride;
+	}
+	
+	/**
+	* CImplicitEvaluator::GetOutputStride - Returns the number of output values per point. Vector outputs take 3 values, matrix outputs 16.
+	* @return number of output values per point
+	*/
+	Lib3MF_uint32 CImplicitEvaluator::GetOutputStride()
+	{
+		Lib3MF_uint32 resultStride = 0;
+		CheckError(lib3mf_implicitevaluator_getoutputstride(m_pHandle, &resultStride));
+		
+		return resultStride;
+	}
+	
+	/**
+	* CImplicitEvaluator::SetWorkerThreadCount - Sets the number of threads used by Evaluate. 0 selects the number of hardware threads, 1 (default) evaluates on the calling thread.
+	* @param[in] nThreadCount - number of threads
+	*/
+	void CImplicitEvaluator::SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount)
+	{
+		CheckError(lib3mf_implicitevaluator_setworkerthreadcount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CImplicitEvaluator::GetWorkerThreadCount - Returns the number of threads used by Evaluate.
+	* @return number of threads
+	*/
+	Lib3MF_uint32 CImplicitEvaluator::GetWorkerThreadCount()
+	{
+		Lib3MF_uint32 resultThreadCount = 0;
+		CheckError(lib3mf_implicitevaluator_getworkerthreadcount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
+	/**
+	* CImplicitEvaluator::Evaluate - Evaluates the function for a batch of points. The input values of all function inputs of a point are stored consecutively, followed by the next point.
+	* @param[in] InputsBuffer - input values of all points
+	* @param[out] OutputsBuffer - output values of all points
+	*/
+	void CImplicitEvaluator::Evaluate(const CInputVector<Lib3MF_double> & InputsBuffer, std::vector<Lib3MF_double> & OutputsBuffer)
+	{
+		Lib3MF_uint64 elementsNeededOutputs = 0;
+		Lib3MF_uint64 elementsWrittenOutputs = 0;
+		CheckError(lib3mf_implicitevaluator_evaluate(m_pHandle, (Lib3MF_uint64)InputsBuffer.size(), InputsBuffer.data(), 0, &elementsNeededOutputs, nullptr));
+		OutputsBuffer.resize((size_t) elementsNeededOutputs);
+		CheckError(lib3mf_implicitevaluator_evaluate(m_pHandle, (Lib3MF_uint64)InputsBuffer.size(), InputsBuffer.data(), elementsNeededOutputs, &elementsWrittenOutputs, OutputsBuffer.data()));
+	}
+	
+	/**
+	* CImplicitEvaluator::EvaluateBatch - Evaluates the function for a batch of points in structure-of-arrays layout. The values of the first input component of all points are stored consecutively, followed by the values of the next component. The outputs are returned in the same layout.
+	* @param[in] InputsBuffer - input values of all points, one array per component
+	* @param[out] OutputsBuffer - output values of all points, one array per component
+	*/
+	void CImplicitEvaluator::EvaluateBatch(const CInputVector<Lib3MF_double> & InputsBuffer, std::vector<Lib3MF_double> & OutputsBuffer)
+	{
+		Lib3MF_uint64 elementsNeededOutputs = 0;
+		Lib3MF_uint64 elementsWrittenOutputs = 0;
+		CheckError(lib3mf_implicitevaluator_evaluatebatch(m_pHandle, (Lib3MF_uint64)InputsBuffer.size(), InputsBuffer.data(), 0, &elementsNeededOutputs, nullptr));
+		OutputsBuffer.resize((size_t) elementsNeededOutputs);
+		CheckError(lib3mf_implicitevaluator_evaluatebatch(m_pHandle, (Lib3MF_uint64)InputsBuffer.size(), InputsBuffer.data(), elementsNeededOutputs, &elementsWrittenOutputs, OutputsBuffer.data()));
+	}
+	
+	/**
+	* CImplicitEvaluator::EvaluateBounds - Computes bounds of the function outputs for boxes of input values. Every box is given by the minimal and maximal value of each input component, stored like the points of Evaluate. The bounds contain all output values within the box, but are not necessarily tight. Unbounded outputs are reported as infinite.
+	* @param[in] InputMinimaBuffer - minimal input values of all boxes
+	* @param[in] InputMaximaBuffer - maximal input values of all boxes
+	* @param[out] OutputMinimaBuffer - lower bounds of the outputs of all boxes
+	* @param[out] OutputMaximaBuffer - upper bounds of the outputs of all boxes
+	*/
+	void CImplicitEvaluator::EvaluateBounds(const CInputVector<Lib3MF_double> & InputMinimaBuffer, const CInputVector<Lib3MF_double> & InputMaximaBuffer, std::vector<Lib3MF_double> & OutputMinimaBuffer, std::vector<Lib3MF_double> & OutputMaximaBuffer)
+	{
+		Lib3MF_uint64 elementsNeededOutputMinima = 0;
+		Lib3MF_uint64 elementsWrittenOutputMinima = 0;
+		Lib3MF_uint64 elementsNeededOutputMaxima = 0;
+		Lib3MF_uint64 elementsWrittenOutputMaxima = 0;
+		CheckError(lib3mf_implicitevaluator_evaluatebounds(m_pHandle, (Lib3MF_uint64)InputMinimaBuffer.size(), InputMinimaBuffer.data(), (Lib3MF_uint64)InputMaximaBuffer.size(), InputMaximaBuffer.data(), 0, &elementsNeededOutputMinima, nullptr, 0, &elementsNeededOutputMaxima, nullptr));
+		OutputMinimaBuffer.resize((size_t) elementsNeededOutputMinima);
+		OutputMaximaBuffer.resize((size_t) elementsNeededOutputMaxima);
+		CheckError(lib3mf_implicitevaluator_evaluatebounds(m_pHandle, (Lib3MF_uint64)InputMinimaBuffer.size(), InputMinimaBuffer.data(), (Lib3MF_uint64)InputMaximaBuffer.size(), InputMaximaBuffer.data(), elementsNeededOutputMinima, &elementsWrittenOutputMinima, OutputMinimaBuffer.data(), elementsNeededOutputMaxima, &elementsWrittenOutputMaxima, OutputMaximaBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CFunctionFromImage3D
 	 */
@@ -10290,6 +10779,81 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(lib3mf_functionfromimage3d_setscale(m_pHandle, dScale));
 	}
 	
+	/**
+	* CFunctionFromImage3D::CreateSampler - Creates a sampler, which decodes the sheets of the 3D image on demand. Later changes of the function do not affect the sampler.
+	* @return the sampler
+	*/
+	PImage3DSampler CFunctionFromImage3D::CreateSampler()
+	{
+		Lib3MFHandle hSampler = (Lib3MFHandle)nullptr;
+		CheckError(lib3mf_functionfromimage3d_createsampler(m_pHandle, &hSampler));
+		
+		if (!hSampler) {
+			CheckError(LIB3MF_ERROR_INVALIDPARAM);
+		}
+		return std::shared_ptr<CImage3DSampler>(dynamic_cast<CImage3DSampler*>(m_pWrapper->polymorphicFactory(hSampler)));
+	}
+	
+	/**
+	 * Method definitions for class CImage3DSampler
+	 */
+	
+	/**
+	* CImage3DSampler::SetCacheSize - Sets the maximal memory size of the decoded sheets, which are kept for later samples. The most recently used sheet is always kept.
+	* @param[in] nCacheSize - cache size in bytes
+	*/
+	void CImage3DSampler::SetCacheSize(const Lib3MF_uint64 nCacheSize)
+	{
+		CheckError(lib3mf_image3dsampler_setcachesize(m_pHandle, nCacheSize));
+	}
+	
+	/**
+	* CImage3DSampler::GetCacheSize - Returns the maximal memory size of the decoded sheets.
+	* @return cache size in bytes
+	*/
+	Lib3MF_uint64 CImage3DSampler::GetCacheSize()
+	{
+		Lib3MF_uint64 resultCacheSize = 0;
+		CheckError(lib3mf_image3dsampler_getcachesize(m_pHandle, &resultCacheSize));
+		
+		return resultCacheSize;
+	}
+	
+	/**
+	* CImage3DSampler::SetWorkerThreadCount - Sets the number of threads used by Sample. 0 selects the number of hardware threads, 1 (default) samples on the calling thread.
+	* @param[in] nThreadCount - number of threads
+	*/
+	void CImage3DSampler::SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount)
+	{
+		CheckError(lib3mf_image3dsampler_setworkerthreadcount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CImage3DSampler::GetWorkerThreadCount - Returns the number of threads used by Sample.
+	* @return number of threads
+	*/
+	Lib3MF_uint32 CImage3DSampler::GetWorkerThreadCount()
+	{
+		Lib3MF_uint32 resultThreadCount = 0;
+		CheckError(lib3mf_image3dsampler_getworkerthreadcount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
+	/**
+	* CImage3DSampler::Sample - Samples the function from image3D at a batch of points. Every point takes the 3 values u, v and w, every result the 4 values red, green, blue and alpha, including offset and scale.
+	* @param[in] UVWBuffer - u, v and w of all points
+	* @param[out] RGBABuffer - red, green, blue and alpha of all points
+	*/
+	void CImage3DSampler::Sample(const CInputVector<Lib3MF_double> & UVWBuffer, std::vector<Lib3MF_double> & RGBABuffer)
+	{
+		Lib3MF_uint64 elementsNeededRGBA = 0;
+		Lib3MF_uint64 elementsWrittenRGBA = 0;
+		CheckError(lib3mf_image3dsampler_sample(m_pHandle, (Lib3MF_uint64)UVWBuffer.size(), UVWBuffer.data(), 0, &elementsNeededRGBA, nullptr));
+		RGBABuffer.resize((size_t) elementsNeededRGBA);
+		CheckError(lib3mf_image3dsampler_sample(m_pHandle, (Lib3MF_uint64)UVWBuffer.size(), UVWBuffer.data(), elementsNeededRGBA, &elementsWrittenRGBA, RGBABuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CBuildItem
 	 */
@@ -125,6 +125,62 @@ typedef Lib3MFResult (*PLib3MFWriter_GetDecimalPrecisionPtr) (Lib3MF_Writer pWri
 */
 typedef Lib3MFResult (*PLib3MFWriter_SetDecimalPrecisionPtr) (Lib3MF_Writer pWriter, Lib3MF_uint32 nDecimalPrecision);
 
+/**
+* Activates (deactivates) the shortest round-trip output of mesh coordinates and radii. Each value is written with the fewest digits that read back as exactly the same number; the decimal precision is ignored while active.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] bShortestRoundtripActive - flag whether shortest round-trip output is active or not.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_SetShortestRoundtripActivePtr) (Lib3MF_Writer pWriter, bool bShortestRoundtripActive);
+
+/**
+* Queries whether the shortest round-trip output of mesh coordinates and radii is active or not.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pShortestRoundtripActive - returns flag whether shortest round-trip output is active or not.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_GetShortestRoundtripActivePtr) (Lib3MF_Writer pWriter, bool * pShortestRoundtripActive);
+
+/**
+* Sets the number of threads the writer may use to compress package parts and to render large meshes. 0 selects the number of hardware threads, 1 disables parallel writing.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] nThreadCount - Number of threads, including the calling thread. 0 means automatic.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_SetWorkerThreadCountPtr) (Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads the writer may use to compress package parts and to render large meshes.
+*
+* @param[in] pWriter - Writer instance.
+* @param[out] pThreadCount - Number of threads, including the calling thread. 0 means automatic.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_GetWorkerThreadCountPtr) (Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Sets the compression of all parts of a kind. Already compressed images are best stored without compression.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] ePartType - The kind of parts to configure.
+* @param[in] eLevel - The compression level. Defaults to Fastest for all kinds of parts. Once it is set, encrypted parts are deflated with it before encryption and stored without further compression.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_SetCompressionLevelPtr) (Lib3MF_Writer pWriter, Lib3MF::ePackagePartType ePartType, Lib3MF::eCompressionLevel eLevel);
+
+/**
+* Returns the compression of all parts of a kind.
+*
+* @param[in] pWriter - Writer instance.
+* @param[in] ePartType - The kind of parts to query.
+* @param[out] pLevel - The compression level.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFWriter_GetCompressionLevelPtr) (Lib3MF_Writer pWriter, Lib3MF::ePackagePartType ePartType, Lib3MF::eCompressionLevel * pLevel);
+
 /**
 * Activates (deactivates) the strict mode of the reader.
 *
@@ -267,6 +323,54 @@ typedef Lib3MFResult (*PLib3MFReader_SetStrictModeActivePtr) (Lib3MF_Reader pRea
 */
 typedef Lib3MFResult (*PLib3MFReader_GetStrictModeActivePtr) (Lib3MF_Reader pReader, bool * pStrictModeActive);
 
+/**
+* Sets the number of threads the reader may use to decode mesh data. 0 selects the number of hardware threads. With 1 (the default), vertex and triangle lists are still decoded by the streaming mesh decoder, but on the calling thread only.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] nThreadCount - Number of threads, including the calling thread. 0 means automatic.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_SetWorkerThreadCountPtr) (Lib3MF_Reader pReader, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads the reader may use to decode mesh data.
+*
+* @param[in] pReader - Reader instance.
+* @param[out] pThreadCount - Number of threads, including the calling thread. 0 means automatic.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_GetWorkerThreadCountPtr) (Lib3MF_Reader pReader, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Hands the vertices and triangles of all mesh objects to callbacks in blocks while they are read. Blocks of one mesh object are delivered in document order, and vertices are delivered before the triangles that refer to them. If the geometry is not retained, the meshes of the read model stay empty, while objects, components and build items are still read. Beam lattices and triangle sets require the geometry to be retained.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] pTheVertexBlockCallback - Callback to call for every block of vertices. May be null.
+* @param[in] pTheTriangleBlockCallback - Callback to call for every block of triangles. May be null.
+* @param[in] bRetainGeometry - If true, the geometry is read into the model as well.
+* @param[in] pUserData - Userdata that is passed to the callback functions
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_SetMeshStreamCallbacksPtr) (Lib3MF_Reader pReader, Lib3MF::VertexBlockCallback pTheVertexBlockCallback, Lib3MF::TriangleBlockCallback pTheTriangleBlockCallback, bool bRetainGeometry, Lib3MF_pvoid pUserData);
+
+/**
+* Defers parsing the geometry of mesh objects until it is first accessed. The model part is kept in memory after reading, and each mesh is parsed from it on first access. Ignored if mesh stream callbacks are set.
+*
+* @param[in] pReader - Reader instance.
+* @param[in] bLazyMeshLoadingActive - Flag whether mesh geometry is parsed on first access
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_SetLazyMeshLoadingActivePtr) (Lib3MF_Reader pReader, bool bLazyMeshLoadingActive);
+
+/**
+* Returns whether mesh geometry is parsed on first access.
+*
+* @param[in] pReader - Reader instance.
+* @param[out] pLazyMeshLoadingActive - Flag whether mesh geometry is parsed on first access
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFReader_GetLazyMeshLoadingActivePtr) (Lib3MF_Reader pReader, bool * pLazyMeshLoadingActive);
+
 /**
 * Returns Warning and Error Information of the read process
 *
@@ -310,6 +414,66 @@ typedef Lib3MFResult (*PLib3MFReader_AddKeyWrappingCallbackPtr) (Lib3MF_Reader p
 */
 typedef Lib3MFResult (*PLib3MFReader_SetContentEncryptionCallbackPtr) (Lib3MF_Reader pReader, Lib3MF::ContentEncryptionCallback pTheCallback, Lib3MF_pvoid pUserData);
 
+/*************************************************************************************************************************
+ Class definition for StreamingWriter
+**************************************************************************************************************************/
+
+/**
+* Starts a new mesh object. All of its vertices must be added before its triangles.
+*
+* @param[in] pStreamingWriter - StreamingWriter instance.
+* @param[in] pName - Name of the object. May be empty.
+* @param[out] pObjectID - Resource ID of the new mesh object.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFStreamingWriter_BeginMeshObjectPtr) (Lib3MF_StreamingWriter pStreamingWriter, const char * pName, Lib3MF_uint32 * pObjectID);
+
+/**
+* Writes a batch of vertices of the current mesh object. Vertex indices continue over all batches of the object.
+*
+* @param[in] pStreamingWriter - StreamingWriter instance.
+* @param[in] nVerticesBufferSize - Number of elements in buffer
+* @param[in] pVerticesBuffer - Position buffer of Positions of the vertices
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFStreamingWriter_AddVerticesPtr) (Lib3MF_StreamingWriter pStreamingWriter, Lib3MF_uint64 nVerticesBufferSize, const Lib3MF::sPosition * pVerticesBuffer);
+
+/**
+* Writes a batch of triangles of the current mesh object. No further vertices may be added to the object afterwards.
+*
+* @param[in] pStreamingWriter - StreamingWriter instance.
+* @param[in] nIndicesBufferSize - Number of elements in buffer
+* @param[in] pIndicesBuffer - Triangle buffer of Vertex indices of the triangles. They must refer to vertices, which have already been added to the object.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFStreamingWriter_AddTrianglesPtr) (Lib3MF_StreamingWriter pStreamingWriter, Lib3MF_uint64 nIndicesBufferSize, const Lib3MF::sTriangle * pIndicesBuffer);
+
+/**
+* Finishes the current mesh object.
+*
+* @param[in] pStreamingWriter - StreamingWriter instance.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFStreamingWriter_EndMeshObjectPtr) (Lib3MF_StreamingWriter pStreamingWriter);
+
+/**
+* Adds a build item. It is written when the package is finished.
+*
+* @param[in] pStreamingWriter - StreamingWriter instance.
+* @param[in] nObjectID - Resource ID of a finished mesh object.
+* @param[in] pTransform - Transformation matrix.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFStreamingWriter_AddBuildItemPtr) (Lib3MF_StreamingWriter pStreamingWriter, Lib3MF_uint32 nObjectID, const Lib3MF::sTransform * pTransform);
+
+/**
+* Writes the build items and closes the package. No further calls are allowed afterwards.
+*
+* @param[in] pStreamingWriter - StreamingWriter instance.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFStreamingWriter_FinishPtr) (Lib3MF_StreamingWriter pStreamingWriter);
+
 /*************************************************************************************************************************
  Class definition for PackagePart
 **************************************************************************************************************************/
@@ -1189,6 +1353,27 @@ typedef Lib3MFResult (*PLib3MFMeshObject_AddVertexPtr) (Lib3MF_MeshObject pMeshO
 */
 typedef Lib3MFResult (*PLib3MFMeshObject_GetVerticesPtr) (Lib3MF_MeshObject pMeshObject, const Lib3MF_uint64 nVerticesBufferSize, Lib3MF_uint64* pVerticesNeededCount, Lib3MF::sPosition * pVerticesBuffer);
 
+/**
+* Returns the number of pages in which the vertices of the mesh object are stored.
+*
+* @param[in] pMeshObject - MeshObject instance.
+* @param[out] pPageCount - the number of vertex pages.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFMeshObject_GetVertexPageCountPtr) (Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 * pPageCount);
+
+/**
+* Returns direct read access to a page of vertices without copying them. The memory is owned by the mesh object, must not be written to and is only valid until the mesh is modified or released.
+*
+* @param[in] pMeshObject - MeshObject instance.
+* @param[in] nPageIndex - index of the page (0 to pagecount - 1).
+* @param[out] pVertexCount - number of vertices stored in the page.
+* @param[out] pStride - distance in bytes between two consecutive vertices.
+* @param[out] pCoordinates - pointer to the three single precision coordinates of the first vertex in the page.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFMeshObject_GetVertexPagePtr) (Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nPageIndex, Lib3MF_uint32 * pVertexCount, Lib3MF_uint32 * pStride, Lib3MF_pvoid * pCoordinates);
+
 /**
 * Returns indices of a single triangle of a mesh object.
 *
@@ -1230,6 +1415,27 @@ typedef Lib3MFResult (*PLib3MFMeshObject_AddTrianglePtr) (Lib3MF_MeshObject pMes
 */
 typedef Lib3MFResult (*PLib3MFMeshObject_GetTriangleIndicesPtr) (Lib3MF_MeshObject pMeshObject, const Lib3MF_uint64 nIndicesBufferSize, Lib3MF_uint64* pIndicesNeededCount, Lib3MF::sTriangle * pIndicesBuffer);
 
+/**
+* Returns the number of pages in which the triangles of the mesh object are stored.
+*
+* @param[in] pMeshObject - MeshObject instance.
+* @param[out] pPageCount - the number of triangle pages.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFMeshObject_GetTrianglePageCountPtr) (Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 * pPageCount);
+
+/**
+* Returns direct read access to a page of triangles without copying them. The memory is owned by the mesh object, must not be written to and is only valid until the mesh is modified or released.
+*
+* @param[in] pMeshObject - MeshObject instance.
+* @param[in] nPageIndex - index of the page (0 to pagecount - 1).
+* @param[out] pTriangleCount - number of triangles stored in the page.
+* @param[out] pStride - distance in bytes between two consecutive triangles.
+* @param[out] pIndices - pointer to the three 32 bit vertex indices of the first triangle in the page.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFMeshObject_GetTrianglePagePtr) (Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nPageIndex, Lib3MF_uint32 * pTriangleCount, Lib3MF_uint32 * pStride, Lib3MF_pvoid * pIndices);
+
 /**
 * Sets the property at the object-level of the mesh object.
 *
@@ -1312,6 +1518,17 @@ typedef Lib3MFResult (*PLib3MFMeshObject_ClearAllPropertiesPtr) (Lib3MF_MeshObje
 */
 typedef Lib3MFResult (*PLib3MFMeshObject_SetGeometryPtr) (Lib3MF_MeshObject pMeshObject, Lib3MF_uint64 nVerticesBufferSize, const Lib3MF::sPosition * pVerticesBuffer, Lib3MF_uint64 nIndicesBufferSize, const Lib3MF::sTriangle * pIndicesBuffer);
 
+/**
+* Preallocates memory for the given total numbers of vertices, triangles and beams, so that they can be added without further allocations.
+*
+* @param[in] pMeshObject - MeshObject instance.
+* @param[in] nVertexCount - number of vertices to reserve memory for.
+* @param[in] nTriangleCount - number of triangles to reserve memory for.
+* @param[in] nBeamCount - number of beams to reserve memory for.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFMeshObject_ReserveGeometryPtr) (Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nVertexCount, Lib3MF_uint32 nTriangleCount, Lib3MF_uint32 nBeamCount);
+
 /**
 * Retrieves, if an object describes a topologically oriented and manifold mesh, according to the core spec.
 *
@@ -1321,6 +1538,15 @@ typedef Lib3MFResult (*PLib3MFMeshObject_SetGeometryPtr) (Lib3MF_MeshObject pMes
 */
 typedef Lib3MFResult (*PLib3MFMeshObject_IsManifoldAndOrientedPtr) (Lib3MF_MeshObject pMeshObject, bool * pIsManifoldAndOriented);
 
+/**
+* Retrieves, if the geometry of an object has been loaded. Meshes read with lazy mesh loading are only loaded when their geometry is accessed for the first time.
+*
+* @param[in] pMeshObject - MeshObject instance.
+* @param[out] pIsGeometryLoaded - returns, if the geometry of the object has been loaded.
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFMeshObject_IsGeometryLoadedPtr) (Lib3MF_MeshObject pMeshObject, bool * pIsGeometryLoaded);
+
 /**
 * Retrieves the BeamLattice within this MeshObject.
 *
@@ -4854,6 +5080,99 @@ typedef Lib3MFResult (*PLib3MFImplicitFunction_ClearPtr) (Lib3MF_ImplicitFunctio
 */
 typedef Lib3MFResult (*PLib3MFImplicitFunction_SortNodesTopologicallyPtr) (Lib3MF_ImplicitFunction pImplicitFunction);
 
+/**
+* Compiles the function into an evaluator. Later changes of the function do not affect the evaluator.
+*
+* @param[in] pImplicitFunction - ImplicitFunction instance.
+* @param[out] pEvaluator - the evaluator
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFImplicitFunction_CreateEvaluatorPtr) (Lib3MF_ImplicitFunction pImplicitFunction, Lib3MF_ImplicitEvaluator * pEvaluator);
+
+/*************************************************************************************************************************
+ Class definition for ImplicitEvaluator
+**************************************************************************************************************************/
+
+/**
+* Returns the number of input values per point. Vector inputs take 3 values, matrix inputs 16.
+*
+* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+* @param[out] pStride - number of input values per point
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFImplicitEvaluator_GetInputStridePtr) (Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint32 * pStride);
+
+/**
+* Returns the number of output values per point. Vector outputs take 3 values, matrix outputs 16.
+*
+* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+* @param[out] pStride - number of output values per point
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFImplicitEvaluator_GetOutputStridePtr) (Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint32 * pStride);
+
+/**
+* Sets the number of threads used by Evaluate. 0 selects the number of hardware threads, 1 (default) evaluates on the calling thread.
+*
+* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+* @param[in] nThreadCount - number of threads
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFImplicitEvaluator_SetWorkerThreadCountPtr) (Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads used by Evaluate.
+*
+* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+* @param[out] pThreadCount - number of threads
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFImplicitEvaluator_GetWorkerThreadCountPtr) (Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Evaluates the function for a batch of points. The input values of all function inputs of a point are stored consecutively, followed by the next point.
+*
+* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+* @param[in] nInputsBufferSize - Number of elements in buffer
+* @param[in] pInputsBuffer - double buffer of input values of all points
+* @param[in] nOutputsBufferSize - Number of elements in buffer
+* @param[out] pOutputsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pOutputsBuffer - double buffer of output values of all points
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFImplicitEvaluator_EvaluatePtr) (Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint64 nInputsBufferSize, const Lib3MF_double * pInputsBuffer, const Lib3MF_uint64 nOutputsBufferSize, Lib3MF_uint64* pOutputsNeededCount, Lib3MF_double * pOutputsBuffer);
+
+/**
+* Evaluates the function for a batch of points in structure-of-arrays layout. The values of the first input component of all points are stored consecutively, followed by the values of the next component. The outputs are returned in the same layout.
+*
+* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+* @param[in] nInputsBufferSize - Number of elements in buffer
+* @param[in] pInputsBuffer - double buffer of input values of all points, one array per component
+* @param[in] nOutputsBufferSize - Number of elements in buffer
+* @param[out] pOutputsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pOutputsBuffer - double buffer of output values of all points, one array per component
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFImplicitEvaluator_EvaluateBatchPtr) (Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint64 nInputsBufferSize, const Lib3MF_double * pInputsBuffer, const Lib3MF_uint64 nOutputsBufferSize, Lib3MF_uint64* pOutputsNeededCount, Lib3MF_double * pOutputsBuffer);
+
+/**
+* Computes bounds of the function outputs for boxes of input values. Every box is given by the minimal and maximal value of each input component, stored like the points of Evaluate. The bounds contain all output values within the box, but are not necessarily tight. Unbounded outputs are reported as infinite.
+*
+* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+* @param[in] nInputMinimaBufferSize - Number of elements in buffer
+* @param[in] pInputMinimaBuffer - double buffer of minimal input values of all boxes
+* @param[in] nInputMaximaBufferSize - Number of elements in buffer
+* @param[in] pInputMaximaBuffer - double buffer of maximal input values of all boxes
+* @param[in] nOutputMinimaBufferSize - Number of elements in buffer
+* @param[out] pOutputMinimaNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pOutputMinimaBuffer - double buffer of lower bounds of the outputs of all boxes
+* @param[in] nOutputMaximaBufferSize - Number of elements in buffer
+* @param[out] pOutputMaximaNeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pOutputMaximaBuffer - double buffer of upper bounds of the outputs of all boxes
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFImplicitEvaluator_EvaluateBoundsPtr) (Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint64 nInputMinimaBufferSize, const Lib3MF_double * pInputMinimaBuffer, Lib3MF_uint64 nInputMaximaBufferSize, const Lib3MF_double * pInputMaximaBuffer, const Lib3MF_uint64 nOutputMinimaBufferSize, Lib3MF_uint64* pOutputMinimaNeededCount, Lib3MF_double * pOutputMinimaBuffer, const Lib3MF_uint64 nOutputMaximaBufferSize, Lib3MF_uint64* pOutputMaximaNeededCount, Lib3MF_double * pOutputMaximaBuffer);
+
 /*************************************************************************************************************************
  Class definition for FunctionFromImage3D
 **************************************************************************************************************************/
@@ -4952,6 +5271,68 @@ typedef Lib3MFResult (*PLib3MFFunctionFromImage3D_GetScalePtr) (Lib3MF_FunctionF
 */
 typedef Lib3MFResult (*PLib3MFFunctionFromImage3D_SetScalePtr) (Lib3MF_FunctionFromImage3D pFunctionFromImage3D, Lib3MF_double dScale);
 
+/**
+* Creates a sampler, which decodes the sheets of the 3D image on demand. Later changes of the function do not affect the sampler.
+*
+* @param[in] pFunctionFromImage3D - FunctionFromImage3D instance.
+* @param[out] pSampler - the sampler
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFFunctionFromImage3D_CreateSamplerPtr) (Lib3MF_FunctionFromImage3D pFunctionFromImage3D, Lib3MF_Image3DSampler * pSampler);
+
+/*************************************************************************************************************************
+ Class definition for Image3DSampler
+**************************************************************************************************************************/
+
+/**
+* Sets the maximal memory size of the decoded sheets, which are kept for later samples. The most recently used sheet is always kept.
+*
+* @param[in] pImage3DSampler - Image3DSampler instance.
+* @param[in] nCacheSize - cache size in bytes
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFImage3DSampler_SetCacheSizePtr) (Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint64 nCacheSize);
+
+/**
+* Returns the maximal memory size of the decoded sheets.
+*
+* @param[in] pImage3DSampler - Image3DSampler instance.
+* @param[out] pCacheSize - cache size in bytes
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFImage3DSampler_GetCacheSizePtr) (Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint64 * pCacheSize);
+
+/**
+* Sets the number of threads used by Sample. 0 selects the number of hardware threads, 1 (default) samples on the calling thread.
+*
+* @param[in] pImage3DSampler - Image3DSampler instance.
+* @param[in] nThreadCount - number of threads
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFImage3DSampler_SetWorkerThreadCountPtr) (Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint32 nThreadCount);
+
+/**
+* Returns the number of threads used by Sample.
+*
+* @param[in] pImage3DSampler - Image3DSampler instance.
+* @param[out] pThreadCount - number of threads
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFImage3DSampler_GetWorkerThreadCountPtr) (Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint32 * pThreadCount);
+
+/**
+* Samples the function from image3D at a batch of points. Every point takes the 3 values u, v and w, every result the 4 values red, green, blue and alpha, including offset and scale.
+*
+* @param[in] pImage3DSampler - Image3DSampler instance.
+* @param[in] nUVWBufferSize - Number of elements in buffer
+* @param[in] pUVWBuffer - double buffer of u, v and w of all points
+* @param[in] nRGBABufferSize - Number of elements in buffer
+* @param[out] pRGBANeededCount - will be filled with the count of the written elements, or needed buffer size.
+* @param[out] pRGBABuffer - double buffer of red, green, blue and alpha of all points
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFImage3DSampler_SamplePtr) (Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint64 nUVWBufferSize, const Lib3MF_double * pUVWBuffer, const Lib3MF_uint64 nRGBABufferSize, Lib3MF_uint64* pRGBANeededCount, Lib3MF_double * pRGBABuffer);
+
 /*************************************************************************************************************************
  Class definition for BuildItem
 **************************************************************************************************************************/
@@ -6475,6 +6856,16 @@ typedef Lib3MFResult (*PLib3MFGetSpecificationVersionPtr) (const char * pSpecifi
 */
 typedef Lib3MFResult (*PLib3MFCreateModelPtr) (Lib3MF_Model * pModel);
 
+/**
+* creates a writer, which streams mesh objects into a new 3MF file while they are generated.
+*
+* @param[in] pFilename - Filename to write into
+* @param[in] eUnit - Unit of the model
+* @param[out] pStreamingWriter - returns the streaming writer instance
+* @return error code or 0 (success)
+*/
+typedef Lib3MFResult (*PLib3MFCreateStreamingWriterPtr) (const char * pFilename, Lib3MF::eModelUnit eUnit, Lib3MF_StreamingWriter * pStreamingWriter);
+
 /**
 * releases shared ownership of an object instance
 *
@@ -6631,6 +7022,12 @@ typedef struct {
 	PLib3MFWriter_SetProgressCallbackPtr m_Writer_SetProgressCallback;
 	PLib3MFWriter_GetDecimalPrecisionPtr m_Writer_GetDecimalPrecision;
 	PLib3MFWriter_SetDecimalPrecisionPtr m_Writer_SetDecimalPrecision;
+	PLib3MFWriter_SetShortestRoundtripActivePtr m_Writer_SetShortestRoundtripActive;
+	PLib3MFWriter_GetShortestRoundtripActivePtr m_Writer_GetShortestRoundtripActive;
+	PLib3MFWriter_SetWorkerThreadCountPtr m_Writer_SetWorkerThreadCount;
+	PLib3MFWriter_GetWorkerThreadCountPtr m_Writer_GetWorkerThreadCount;
+	PLib3MFWriter_SetCompressionLevelPtr m_Writer_SetCompressionLevel;
+	PLib3MFWriter_GetCompressionLevelPtr m_Writer_GetCompressionLevel;
 	PLib3MFWriter_SetStrictModeActivePtr m_Writer_SetStrictModeActive;
 	PLib3MFWriter_GetStrictModeActivePtr m_Writer_GetStrictModeActive;
 	PLib3MFWriter_GetWarningPtr m_Writer_GetWarning;
@@ -6645,10 +7042,21 @@ typedef struct {
 	PLib3MFReader_RemoveRelationToReadPtr m_Reader_RemoveRelationToRead;
 	PLib3MFReader_SetStrictModeActivePtr m_Reader_SetStrictModeActive;
 	PLib3MFReader_GetStrictModeActivePtr m_Reader_GetStrictModeActive;
+	PLib3MFReader_SetWorkerThreadCountPtr m_Reader_SetWorkerThreadCount;
+	PLib3MFReader_GetWorkerThreadCountPtr m_Reader_GetWorkerThreadCount;
+	PLib3MFReader_SetMeshStreamCallbacksPtr m_Reader_SetMeshStreamCallbacks;
+	PLib3MFReader_SetLazyMeshLoadingActivePtr m_Reader_SetLazyMeshLoadingActive;
+	PLib3MFReader_GetLazyMeshLoadingActivePtr m_Reader_GetLazyMeshLoadingActive;
 	PLib3MFReader_GetWarningPtr m_Reader_GetWarning;
 	PLib3MFReader_GetWarningCountPtr m_Reader_GetWarningCount;
 	PLib3MFReader_AddKeyWrappingCallbackPtr m_Reader_AddKeyWrappingCallback;
 	PLib3MFReader_SetContentEncryptionCallbackPtr m_Reader_SetContentEncryptionCallback;
+	PLib3MFStreamingWriter_BeginMeshObjectPtr m_StreamingWriter_BeginMeshObject;
+	PLib3MFStreamingWriter_AddVerticesPtr m_StreamingWriter_AddVertices;
+	PLib3MFStreamingWriter_AddTrianglesPtr m_StreamingWriter_AddTriangles;
+	PLib3MFStreamingWriter_EndMeshObjectPtr m_StreamingWriter_EndMeshObject;
+	PLib3MFStreamingWriter_AddBuildItemPtr m_StreamingWriter_AddBuildItem;
+	PLib3MFStreamingWriter_FinishPtr m_StreamingWriter_Finish;
 	PLib3MFPackagePart_GetPathPtr m_PackagePart_GetPath;
 	PLib3MFPackagePart_SetPathPtr m_PackagePart_SetPath;
 	PLib3MFResource_GetResourceIDPtr m_Resource_GetResourceID;
@@ -6733,10 +7141,14 @@ typedef struct {
 	PLib3MFMeshObject_SetVertexPtr m_MeshObject_SetVertex;
 	PLib3MFMeshObject_AddVertexPtr m_MeshObject_AddVertex;
 	PLib3MFMeshObject_GetVerticesPtr m_MeshObject_GetVertices;
+	PLib3MFMeshObject_GetVertexPageCountPtr m_MeshObject_GetVertexPageCount;
+	PLib3MFMeshObject_GetVertexPagePtr m_MeshObject_GetVertexPage;
 	PLib3MFMeshObject_GetTrianglePtr m_MeshObject_GetTriangle;
 	PLib3MFMeshObject_SetTrianglePtr m_MeshObject_SetTriangle;
 	PLib3MFMeshObject_AddTrianglePtr m_MeshObject_AddTriangle;
 	PLib3MFMeshObject_GetTriangleIndicesPtr m_MeshObject_GetTriangleIndices;
+	PLib3MFMeshObject_GetTrianglePageCountPtr m_MeshObject_GetTrianglePageCount;
+	PLib3MFMeshObject_GetTrianglePagePtr m_MeshObject_GetTrianglePage;
 	PLib3MFMeshObject_SetObjectLevelPropertyPtr m_MeshObject_SetObjectLevelProperty;
 	PLib3MFMeshObject_GetObjectLevelPropertyPtr m_MeshObject_GetObjectLevelProperty;
 	PLib3MFMeshObject_SetTrianglePropertiesPtr m_MeshObject_SetTriangleProperties;
@@ -6745,7 +7157,9 @@ typedef struct {
 	PLib3MFMeshObject_GetAllTrianglePropertiesPtr m_MeshObject_GetAllTriangleProperties;
 	PLib3MFMeshObject_ClearAllPropertiesPtr m_MeshObject_ClearAllProperties;
 	PLib3MFMeshObject_SetGeometryPtr m_MeshObject_SetGeometry;
+	PLib3MFMeshObject_ReserveGeometryPtr m_MeshObject_ReserveGeometry;
 	PLib3MFMeshObject_IsManifoldAndOrientedPtr m_MeshObject_IsManifoldAndOriented;
+	PLib3MFMeshObject_IsGeometryLoadedPtr m_MeshObject_IsGeometryLoaded;
 	PLib3MFMeshObject_BeamLatticePtr m_MeshObject_BeamLattice;
 	PLib3MFMeshObject_GetVolumeDataPtr m_MeshObject_GetVolumeData;
 	PLib3MFMeshObject_SetVolumeDataPtr m_MeshObject_SetVolumeData;
@@ -7067,6 +7481,14 @@ typedef struct {
 	PLib3MFImplicitFunction_AddLinkByNamesPtr m_ImplicitFunction_AddLinkByNames;
 	PLib3MFImplicitFunction_ClearPtr m_ImplicitFunction_Clear;
 	PLib3MFImplicitFunction_SortNodesTopologicallyPtr m_ImplicitFunction_SortNodesTopologically;
+	PLib3MFImplicitFunction_CreateEvaluatorPtr m_ImplicitFunction_CreateEvaluator;
+	PLib3MFImplicitEvaluator_GetInputStridePtr m_ImplicitEvaluator_GetInputStride;
+	PLib3MFImplicitEvaluator_GetOutputStridePtr m_ImplicitEvaluator_GetOutputStride;
+	PLib3MFImplicitEvaluator_SetWorkerThreadCountPtr m_ImplicitEvaluator_SetWorkerThreadCount;
+	PLib3MFImplicitEvaluator_GetWorkerThreadCountPtr m_ImplicitEvaluator_GetWorkerThreadCount;
+	PLib3MFImplicitEvaluator_EvaluatePtr m_ImplicitEvaluator_Evaluate;
+	PLib3MFImplicitEvaluator_EvaluateBatchPtr m_ImplicitEvaluator_EvaluateBatch;
+	PLib3MFImplicitEvaluator_EvaluateBoundsPtr m_ImplicitEvaluator_EvaluateBounds;
 	PLib3MFFunctionFromImage3D_GetImage3DPtr m_FunctionFromImage3D_GetImage3D;
 	PLib3MFFunctionFromImage3D_SetImage3DPtr m_FunctionFromImage3D_SetImage3D;
 	PLib3MFFunctionFromImage3D_SetFilterPtr m_FunctionFromImage3D_SetFilter;
@@ -7077,6 +7499,12 @@ typedef struct {
 	PLib3MFFunctionFromImage3D_SetOffsetPtr m_FunctionFromImage3D_SetOffset;
 	PLib3MFFunctionFromImage3D_GetScalePtr m_FunctionFromImage3D_GetScale;
 	PLib3MFFunctionFromImage3D_SetScalePtr m_FunctionFromImage3D_SetScale;
+	PLib3MFFunctionFromImage3D_CreateSamplerPtr m_FunctionFromImage3D_CreateSampler;
+	PLib3MFImage3DSampler_SetCacheSizePtr m_Image3DSampler_SetCacheSize;
+	PLib3MFImage3DSampler_GetCacheSizePtr m_Image3DSampler_GetCacheSize;
+	PLib3MFImage3DSampler_SetWorkerThreadCountPtr m_Image3DSampler_SetWorkerThreadCount;
+	PLib3MFImage3DSampler_GetWorkerThreadCountPtr m_Image3DSampler_GetWorkerThreadCount;
+	PLib3MFImage3DSampler_SamplePtr m_Image3DSampler_Sample;
 	PLib3MFBuildItem_GetObjectResourcePtr m_BuildItem_GetObjectResource;
 	PLib3MFBuildItem_GetUUIDPtr m_BuildItem_GetUUID;
 	PLib3MFBuildItem_SetUUIDPtr m_BuildItem_SetUUID;
@@ -7229,6 +7657,7 @@ typedef struct {
 	PLib3MFGetBuildInformationPtr m_GetBuildInformation;
 	PLib3MFGetSpecificationVersionPtr m_GetSpecificationVersion;
 	PLib3MFCreateModelPtr m_CreateModel;
+	PLib3MFCreateStreamingWriterPtr m_CreateStreamingWriter;
 	PLib3MFReleasePtr m_Release;
 	PLib3MFAcquirePtr m_Acquire;
 	PLib3MFSetJournalPtr m_SetJournal;
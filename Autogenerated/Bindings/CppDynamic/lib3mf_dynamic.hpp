@@ -60,6 +60,7 @@ class CWrapper;
 class CBase;
 class CWriter;
 class CReader;
+class CStreamingWriter;
 class CPackagePart;
 class CResource;
 class CResourceIterator;
@@ -161,7 +162,9 @@ class CFunctionCallNode;
 class CNodeIterator;
 class CFunction;
 class CImplicitFunction;
+class CImplicitEvaluator;
 class CFunctionFromImage3D;
+class CImage3DSampler;
 class CBuildItem;
 class CBuildItemIterator;
 class CSlice;
@@ -181,6 +184,7 @@ typedef CWrapper CLib3MFWrapper;
 typedef CBase CLib3MFBase;
 typedef CWriter CLib3MFWriter;
 typedef CReader CLib3MFReader;
+typedef CStreamingWriter CLib3MFStreamingWriter;
 typedef CPackagePart CLib3MFPackagePart;
 typedef CResource CLib3MFResource;
 typedef CResourceIterator CLib3MFResourceIterator;
@@ -282,7 +286,9 @@ typedef CFunctionCallNode CLib3MFFunctionCallNode;
 typedef CNodeIterator CLib3MFNodeIterator;
 typedef CFunction CLib3MFFunction;
 typedef CImplicitFunction CLib3MFImplicitFunction;
+typedef CImplicitEvaluator CLib3MFImplicitEvaluator;
 typedef CFunctionFromImage3D CLib3MFFunctionFromImage3D;
+typedef CImage3DSampler CLib3MFImage3DSampler;
 typedef CBuildItem CLib3MFBuildItem;
 typedef CBuildItemIterator CLib3MFBuildItemIterator;
 typedef CSlice CLib3MFSlice;
@@ -302,6 +308,7 @@ typedef std::shared_ptr<CWrapper> PWrapper;
 typedef std::shared_ptr<CBase> PBase;
 typedef std::shared_ptr<CWriter> PWriter;
 typedef std::shared_ptr<CReader> PReader;
+typedef std::shared_ptr<CStreamingWriter> PStreamingWriter;
 typedef std::shared_ptr<CPackagePart> PPackagePart;
 typedef std::shared_ptr<CResource> PResource;
 typedef std::shared_ptr<CResourceIterator> PResourceIterator;
@@ -403,7 +410,9 @@ typedef std::shared_ptr<CFunctionCallNode> PFunctionCallNode;
 typedef std::shared_ptr<CNodeIterator> PNodeIterator;
 typedef std::shared_ptr<CFunction> PFunction;
 typedef std::shared_ptr<CImplicitFunction> PImplicitFunction;
+typedef std::shared_ptr<CImplicitEvaluator> PImplicitEvaluator;
 typedef std::shared_ptr<CFunctionFromImage3D> PFunctionFromImage3D;
+typedef std::shared_ptr<CImage3DSampler> PImage3DSampler;
 typedef std::shared_ptr<CBuildItem> PBuildItem;
 typedef std::shared_ptr<CBuildItemIterator> PBuildItemIterator;
 typedef std::shared_ptr<CSlice> PSlice;
@@ -423,6 +432,7 @@ typedef PWrapper PLib3MFWrapper;
 typedef PBase PLib3MFBase;
 typedef PWriter PLib3MFWriter;
 typedef PReader PLib3MFReader;
+typedef PStreamingWriter PLib3MFStreamingWriter;
 typedef PPackagePart PLib3MFPackagePart;
 typedef PResource PLib3MFResource;
 typedef PResourceIterator PLib3MFResourceIterator;
@@ -524,7 +534,9 @@ typedef PFunctionCallNode PLib3MFFunctionCallNode;
 typedef PNodeIterator PLib3MFNodeIterator;
 typedef PFunction PLib3MFFunction;
 typedef PImplicitFunction PLib3MFImplicitFunction;
+typedef PImplicitEvaluator PLib3MFImplicitEvaluator;
 typedef PFunctionFromImage3D PLib3MFFunctionFromImage3D;
+typedef PImage3DSampler PLib3MFImage3DSampler;
 typedef PBuildItem PLib3MFBuildItem;
 typedef PBuildItemIterator PLib3MFBuildItemIterator;
 typedef PSlice PLib3MFSlice;
@@ -823,6 +835,7 @@ public:
 	inline bool GetBuildInformation(std::string & sBuildInformation);
 	inline void GetSpecificationVersion(const std::string & sSpecificationURL, bool & bIsSupported, Lib3MF_uint32 & nMajor, Lib3MF_uint32 & nMinor, Lib3MF_uint32 & nMicro);
 	inline PModel CreateModel();
+	inline PStreamingWriter CreateStreamingWriter(const std::string & sFilename, const eModelUnit eUnit);
 	inline void Release(classParam<CBase> pInstance);
 	inline void Acquire(classParam<CBase> pInstance);
 	inline void SetJournal(const std::string & sJournalPath);
@@ -860,6 +873,7 @@ private:
 	friend class CBase;
 	friend class CWriter;
 	friend class CReader;
+	friend class CStreamingWriter;
 	friend class CPackagePart;
 	friend class CResource;
 	friend class CResourceIterator;
@@ -961,7 +975,9 @@ private:
 	friend class CNodeIterator;
 	friend class CFunction;
 	friend class CImplicitFunction;
+	friend class CImplicitEvaluator;
 	friend class CFunctionFromImage3D;
+	friend class CImage3DSampler;
 	friend class CBuildItem;
 	friend class CBuildItemIterator;
 	friend class CSlice;
@@ -1055,6 +1071,12 @@ public:
 	inline void SetProgressCallback(const ProgressCallback pProgressCallback, const Lib3MF_pvoid pUserData);
 	inline Lib3MF_uint32 GetDecimalPrecision();
 	inline void SetDecimalPrecision(const Lib3MF_uint32 nDecimalPrecision);
+	inline void SetShortestRoundtripActive(const bool bShortestRoundtripActive);
+	inline bool GetShortestRoundtripActive();
+	inline void SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount);
+	inline Lib3MF_uint32 GetWorkerThreadCount();
+	inline void SetCompressionLevel(const ePackagePartType ePartType, const eCompressionLevel eLevel);
+	inline eCompressionLevel GetCompressionLevel(const ePackagePartType ePartType);
 	inline void SetStrictModeActive(const bool bStrictModeActive);
 	inline bool GetStrictModeActive();
 	inline std::string GetWarning(const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErrorCode);
@@ -1085,12 +1107,39 @@ public:
 	inline void RemoveRelationToRead(const std::string & sRelationShipType);
 	inline void SetStrictModeActive(const bool bStrictModeActive);
 	inline bool GetStrictModeActive();
+	inline void SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount);
+	inline Lib3MF_uint32 GetWorkerThreadCount();
+	inline void SetMeshStreamCallbacks(const VertexBlockCallback pTheVertexBlockCallback, const TriangleBlockCallback pTheTriangleBlockCallback, const bool bRetainGeometry, const Lib3MF_pvoid pUserData);
+	inline void SetLazyMeshLoadingActive(const bool bLazyMeshLoadingActive);
+	inline bool GetLazyMeshLoadingActive();
 	inline std::string GetWarning(const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErrorCode);
 	inline Lib3MF_uint32 GetWarningCount();
 	inline void AddKeyWrappingCallback(const std::string & sConsumerID, const KeyWrappingCallback pTheCallback, const Lib3MF_pvoid pUserData);
 	inline void SetContentEncryptionCallback(const ContentEncryptionCallback pTheCallback, const Lib3MF_pvoid pUserData);
 };
 	
+/*************************************************************************************************************************
+ Class CStreamingWriter 
+**************************************************************************************************************************/
+class CStreamingWriter : public CBase {
+public:
+	
+	/**
+	* CStreamingWriter::CStreamingWriter - Constructor for StreamingWriter class.
+	*/
+	CStreamingWriter(CWrapper* pWrapper, Lib3MFHandle pHandle)
+		: CBase(pWrapper, pHandle)
+	{
+	}
+	
+	inline Lib3MF_uint32 BeginMeshObject(const std::string & sName);
+	inline void AddVertices(const CInputVector<sPosition> & VerticesBuffer);
+	inline void AddTriangles(const CInputVector<sTriangle> & IndicesBuffer);
+	inline void EndMeshObject();
+	inline void AddBuildItem(const Lib3MF_uint32 nObjectID, const sTransform & Transform);
+	inline void Finish();
+};
+	
 /*************************************************************************************************************************
  Class CPackagePart 
 **************************************************************************************************************************/
@@ -1509,10 +1558,14 @@ public:
 	inline void SetVertex(const Lib3MF_uint32 nIndex, const sPosition & Coordinates);
 	inline Lib3MF_uint32 AddVertex(const sPosition & Coordinates);
 	inline void GetVertices(std::vector<sPosition> & VerticesBuffer);
+	inline Lib3MF_uint32 GetVertexPageCount();
+	inline Lib3MF_pvoid GetVertexPage(const Lib3MF_uint32 nPageIndex, Lib3MF_uint32 & nVertexCount, Lib3MF_uint32 & nStride);
 	inline sTriangle GetTriangle(const Lib3MF_uint32 nIndex);
 	inline void SetTriangle(const Lib3MF_uint32 nIndex, const sTriangle & Indices);
 	inline Lib3MF_uint32 AddTriangle(const sTriangle & Indices);
 	inline void GetTriangleIndices(std::vector<sTriangle> & IndicesBuffer);
+	inline Lib3MF_uint32 GetTrianglePageCount();
+	inline Lib3MF_pvoid GetTrianglePage(const Lib3MF_uint32 nPageIndex, Lib3MF_uint32 & nTriangleCount, Lib3MF_uint32 & nStride);
 	inline void SetObjectLevelProperty(const Lib3MF_uint32 nUniqueResourceID, const Lib3MF_uint32 nPropertyID);
 	inline bool GetObjectLevelProperty(Lib3MF_uint32 & nUniqueResourceID, Lib3MF_uint32 & nPropertyID);
 	inline void SetTriangleProperties(const Lib3MF_uint32 nIndex, const sTriangleProperties & Properties);
@@ -1521,7 +1574,9 @@ public:
 	inline void GetAllTriangleProperties(std::vector<sTriangleProperties> & PropertiesArrayBuffer);
 	inline void ClearAllProperties();
 	inline void SetGeometry(const CInputVector<sPosition> & VerticesBuffer, const CInputVector<sTriangle> & IndicesBuffer);
+	inline void ReserveGeometry(const Lib3MF_uint32 nVertexCount, const Lib3MF_uint32 nTriangleCount, const Lib3MF_uint32 nBeamCount);
 	inline bool IsManifoldAndOriented();
+	inline bool IsGeometryLoaded();
 	inline PBeamLattice BeamLattice();
 	inline PVolumeData GetVolumeData();
 	inline void SetVolumeData(classParam<CVolumeData> pTheVolumeData);
@@ -3123,6 +3178,30 @@ public:
 	inline void AddLinkByNames(const std::string & sSource, const std::string & sTarget);
 	inline void Clear();
 	inline void SortNodesTopologically();
+	inline PImplicitEvaluator CreateEvaluator();
+};
+	
+/*************************************************************************************************************************
+ Class CImplicitEvaluator 
+**************************************************************************************************************************/
+class CImplicitEvaluator : public CBase {
+public:
+	
+	/**
+	* CImplicitEvaluator::CImplicitEvaluator - Constructor for ImplicitEvaluator class.
+	*/
+	CImplicitEvaluator(CWrapper* pWrapper, Lib3MFHandle pHandle)
+		: CBase(pWrapper, pHandle)
+	{
+	}
+	
+	inline Lib3MF_uint32 GetInputStride();
+	inline Lib3MF_uint32 GetOutputStride();
+	inline void SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount);
+	inline Lib3MF_uint32 GetWorkerThreadCount();
+	inline void Evaluate(const CInputVector<Lib3MF_double> & InputsBuffer, std::vector<Lib3MF_double> & OutputsBuffer);
+	inline void EvaluateBatch(const CInputVector<Lib3MF_double> & InputsBuffer, std::vector<Lib3MF_double> & OutputsBuffer);
+	inline void EvaluateBounds(const CInputVector<Lib3MF_double> & InputMinimaBuffer, const CInputVector<Lib3MF_double> & InputMaximaBuffer, std::vector<Lib3MF_double> & OutputMinimaBuffer, std::vector<Lib3MF_double> & OutputMaximaBuffer);
 };
 	
 /*************************************************************************************************************************
@@ -3149,6 +3228,28 @@ public:
 	inline void SetOffset(const Lib3MF_double dOffset);
 	inline Lib3MF_double GetScale();
 	inline void SetScale(const Lib3MF_double dScale);
+	inline PImage3DSampler CreateSampler();
+};
+	
+/*************************************************************************************************************************
+ Class CImage3DSampler 
+**************************************************************************************************************************/
+class CImage3DSampler : public CBase {
+public:
+	
+	/**
+	* CImage3DSampler::CImage3DSampler - Constructor for Image3DSampler class.
+	*/
+	CImage3DSampler(CWrapper* pWrapper, Lib3MFHandle pHandle)
+		: CBase(pWrapper, pHandle)
+	{
+	}
+	
+	inline void SetCacheSize(const Lib3MF_uint64 nCacheSize);
+	inline Lib3MF_uint64 GetCacheSize();
+	inline void SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount);
+	inline Lib3MF_uint32 GetWorkerThreadCount();
+	inline void Sample(const CInputVector<Lib3MF_double> & UVWBuffer, std::vector<Lib3MF_double> & RGBABuffer);
 };
 	
 /*************************************************************************************************************************
@@ -3493,6 +3594,7 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		case 0x856632D0BAF1D8B7UL: return new CBase(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::Base"
 		case 0xE76F642F363FD7E9UL: return new CWriter(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::Writer"
 		case 0x2D86831DA59FBE72UL: return new CReader(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::Reader"
+		case 0x34D1B75E74821821UL: return new CStreamingWriter(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::StreamingWriter"
 		case 0x0E55A826D377483EUL: return new CPackagePart(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::PackagePart"
 		case 0xDFE3889D1B269CBBUL: return new CResource(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::Resource"
 		case 0x460F3515E2621DBEUL: return new CResourceIterator(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::ResourceIterator"
@@ -3594,7 +3696,9 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		case 0xFC006BC888CAB4D0UL: return new CNodeIterator(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::NodeIterator"
 		case 0x9EFB2757CA1A5231UL: return new CFunction(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::Function"
 		case 0x6CE54469EEA83BC1UL: return new CImplicitFunction(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::ImplicitFunction"
+		case 0x624A6556CD0D2735UL: return new CImplicitEvaluator(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::ImplicitEvaluator"
 		case 0x9BD7D3C2026B8CE8UL: return new CFunctionFromImage3D(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::FunctionFromImage3D"
+		case 0xABDCDB2C6189432AUL: return new CImage3DSampler(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::Image3DSampler"
 		case 0x68FB2D5FFC4BA12AUL: return new CBuildItem(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::BuildItem"
 		case 0xA7D21BD364910860UL: return new CBuildItemIterator(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::BuildItemIterator"
 		case 0x2198BCF4D8DF9C40UL: return new CSlice(this, pHandle); break; // First 64 bits of SHA1 of a string: "Lib3MF::Slice"
@@ -3685,6 +3789,23 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return std::shared_ptr<CModel>(dynamic_cast<CModel*>(this->polymorphicFactory(hModel)));
 	}
 	
+	/**
+	* CWrapper::CreateStreamingWriter - creates a writer, which streams mesh objects into a new 3MF file while they are generated.
+	* @param[in] sFilename - Filename to write into
+	* @param[in] eUnit - Unit of the model
+	* @return returns the streaming writer instance
+	*/
+	inline PStreamingWriter CWrapper::CreateStreamingWriter(const std::string & sFilename, const eModelUnit eUnit)
+	{
+		Lib3MFHandle hStreamingWriter = (Lib3MFHandle)nullptr;
+		CheckError(nullptr,m_WrapperTable.m_CreateStreamingWriter(sFilename.c_str(), eUnit, &hStreamingWriter));
+		
+		if (!hStreamingWriter) {
+			CheckError(nullptr,LIB3MF_ERROR_INVALIDPARAM);
+		}
+		return std::shared_ptr<CStreamingWriter>(dynamic_cast<CStreamingWriter*>(this->polymorphicFactory(hStreamingWriter)));
+	}
+	
 	/**
 	* CWrapper::Release - releases shared ownership of an object instance
 	* @param[in] pInstance - the object instance to release
@@ -3900,6 +4021,12 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_Writer_SetProgressCallback = nullptr;
 		pWrapperTable->m_Writer_GetDecimalPrecision = nullptr;
 		pWrapperTable->m_Writer_SetDecimalPrecision = nullptr;
+		pWrapperTable->m_Writer_SetShortestRoundtripActive = nullptr;
+		pWrapperTable->m_Writer_GetShortestRoundtripActive = nullptr;
+		pWrapperTable->m_Writer_SetWorkerThreadCount = nullptr;
+		pWrapperTable->m_Writer_GetWorkerThreadCount = nullptr;
+		pWrapperTable->m_Writer_SetCompressionLevel = nullptr;
+		pWrapperTable->m_Writer_GetCompressionLevel = nullptr;
 		pWrapperTable->m_Writer_SetStrictModeActive = nullptr;
 		pWrapperTable->m_Writer_GetStrictModeActive = nullptr;
 		pWrapperTable->m_Writer_GetWarning = nullptr;
@@ -3914,10 +4041,21 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_Reader_RemoveRelationToRead = nullptr;
 		pWrapperTable->m_Reader_SetStrictModeActive = nullptr;
 		pWrapperTable->m_Reader_GetStrictModeActive = nullptr;
+		pWrapperTable->m_Reader_SetWorkerThreadCount = nullptr;
+		pWrapperTable->m_Reader_GetWorkerThreadCount = nullptr;
+		pWrapperTable->m_Reader_SetMeshStreamCallbacks = nullptr;
+		pWrapperTable->m_Reader_SetLazyMeshLoadingActive = nullptr;
+		pWrapperTable->m_Reader_GetLazyMeshLoadingActive = nullptr;
 		pWrapperTable->m_Reader_GetWarning = nullptr;
 		pWrapperTable->m_Reader_GetWarningCount = nullptr;
 		pWrapperTable->m_Reader_AddKeyWrappingCallback = nullptr;
 		pWrapperTable->m_Reader_SetContentEncryptionCallback = nullptr;
+		pWrapperTable->m_StreamingWriter_BeginMeshObject = nullptr;
+		pWrapperTable->m_StreamingWriter_AddVertices = nullptr;
+		pWrapperTable->m_StreamingWriter_AddTriangles = nullptr;
+		pWrapperTable->m_StreamingWriter_EndMeshObject = nullptr;
+		pWrapperTable->m_StreamingWriter_AddBuildItem = nullptr;
+		pWrapperTable->m_StreamingWriter_Finish = nullptr;
 		pWrapperTable->m_PackagePart_GetPath = nullptr;
 		pWrapperTable->m_PackagePart_SetPath = nullptr;
 		pWrapperTable->m_Resource_GetResourceID = nullptr;
@@ -4002,10 +4140,14 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_MeshObject_SetVertex = nullptr;
 		pWrapperTable->m_MeshObject_AddVertex = nullptr;
 		pWrapperTable->m_MeshObject_GetVertices = nullptr;
+		pWrapperTable->m_MeshObject_GetVertexPageCount = nullptr;
+		pWrapperTable->m_MeshObject_GetVertexPage = nullptr;
 		pWrapperTable->m_MeshObject_GetTriangle = nullptr;
 		pWrapperTable->m_MeshObject_SetTriangle = nullptr;
 		pWrapperTable->m_MeshObject_AddTriangle = nullptr;
 		pWrapperTable->m_MeshObject_GetTriangleIndices = nullptr;
+		pWrapperTable->m_MeshObject_GetTrianglePageCount = nullptr;
+		pWrapperTable->m_MeshObject_GetTrianglePage = nullptr;
 		pWrapperTable->m_MeshObject_SetObjectLevelProperty = nullptr;
 		pWrapperTable->m_MeshObject_GetObjectLevelProperty = nullptr;
 		pWrapperTable->m_MeshObject_SetTriangleProperties = nullptr;
@@ -4014,7 +4156,9 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_MeshObject_GetAllTriangleProperties = nullptr;
 		pWrapperTable->m_MeshObject_ClearAllProperties = nullptr;
 		pWrapperTable->m_MeshObject_SetGeometry = nullptr;
+		pWrapperTable->m_MeshObject_ReserveGeometry = nullptr;
 		pWrapperTable->m_MeshObject_IsManifoldAndOriented = nullptr;
+		pWrapperTable->m_MeshObject_IsGeometryLoaded = nullptr;
 		pWrapperTable->m_MeshObject_BeamLattice = nullptr;
 		pWrapperTable->m_MeshObject_GetVolumeData = nullptr;
 		pWrapperTable->m_MeshObject_SetVolumeData = nullptr;
@@ -4336,6 +4480,14 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_ImplicitFunction_AddLinkByNames = nullptr;
 		pWrapperTable->m_ImplicitFunction_Clear = nullptr;
 		pWrapperTable->m_ImplicitFunction_SortNodesTopologically = nullptr;
+		pWrapperTable->m_ImplicitFunction_CreateEvaluator = nullptr;
+		pWrapperTable->m_ImplicitEvaluator_GetInputStride = nullptr;
+		pWrapperTable->m_ImplicitEvaluator_GetOutputStride = nullptr;
+		pWrapperTable->m_ImplicitEvaluator_SetWorkerThreadCount = nullptr;
+		pWrapperTable->m_ImplicitEvaluator_GetWorkerThreadCount = nullptr;
+		pWrapperTable->m_ImplicitEvaluator_Evaluate = nullptr;
+		pWrapperTable->m_ImplicitEvaluator_EvaluateBatch = nullptr;
+		pWrapperTable->m_ImplicitEvaluator_EvaluateBounds = nullptr;
 		pWrapperTable->m_FunctionFromImage3D_GetImage3D = nullptr;
 		pWrapperTable->m_FunctionFromImage3D_SetImage3D = nullptr;
 		pWrapperTable->m_FunctionFromImage3D_SetFilter = nullptr;
@@ -4346,6 +4498,12 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_FunctionFromImage3D_SetOffset = nullptr;
 		pWrapperTable->m_FunctionFromImage3D_GetScale = nullptr;
 		pWrapperTable->m_FunctionFromImage3D_SetScale = nullptr;
+		pWrapperTable->m_FunctionFromImage3D_CreateSampler = nullptr;
+		pWrapperTable->m_Image3DSampler_SetCacheSize = nullptr;
+		pWrapperTable->m_Image3DSampler_GetCacheSize = nullptr;
+		pWrapperTable->m_Image3DSampler_SetWorkerThreadCount = nullptr;
+		pWrapperTable->m_Image3DSampler_GetWorkerThreadCount = nullptr;
+		pWrapperTable->m_Image3DSampler_Sample = nullptr;
 		pWrapperTable->m_BuildItem_GetObjectResource = nullptr;
 		pWrapperTable->m_BuildItem_GetUUID = nullptr;
 		pWrapperTable->m_BuildItem_SetUUID = nullptr;
@@ -4498,6 +4656,7 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		pWrapperTable->m_GetBuildInformation = nullptr;
 		pWrapperTable->m_GetSpecificationVersion = nullptr;
 		pWrapperTable->m_CreateModel = nullptr;
+		pWrapperTable->m_CreateStreamingWriter = nullptr;
 		pWrapperTable->m_Release = nullptr;
 		pWrapperTable->m_Acquire = nullptr;
 		pWrapperTable->m_SetJournal = nullptr;
@@ -4634,6 +4793,60 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_Writer_SetDecimalPrecision == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_SetShortestRoundtripActive = (PLib3MFWriter_SetShortestRoundtripActivePtr) GetProcAddress(hLibrary, "lib3mf_writer_setshortestroundtripactive");
+		#else // _WIN32
+		pWrapperTable->m_Writer_SetShortestRoundtripActive = (PLib3MFWriter_SetShortestRoundtripActivePtr) dlsym(hLibrary, "lib3mf_writer_setshortestroundtripactive");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_SetShortestRoundtripActive == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_GetShortestRoundtripActive = (PLib3MFWriter_GetShortestRoundtripActivePtr) GetProcAddress(hLibrary, "lib3mf_writer_getshortestroundtripactive");
+		#else // _WIN32
+		pWrapperTable->m_Writer_GetShortestRoundtripActive = (PLib3MFWriter_GetShortestRoundtripActivePtr) dlsym(hLibrary, "lib3mf_writer_getshortestroundtripactive");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_GetShortestRoundtripActive == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_SetWorkerThreadCount = (PLib3MFWriter_SetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_writer_setworkerthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_Writer_SetWorkerThreadCount = (PLib3MFWriter_SetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_writer_setworkerthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_SetWorkerThreadCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_GetWorkerThreadCount = (PLib3MFWriter_GetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_writer_getworkerthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_Writer_GetWorkerThreadCount = (PLib3MFWriter_GetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_writer_getworkerthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_GetWorkerThreadCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_SetCompressionLevel = (PLib3MFWriter_SetCompressionLevelPtr) GetProcAddress(hLibrary, "lib3mf_writer_setcompressionlevel");
+		#else // _WIN32
+		pWrapperTable->m_Writer_SetCompressionLevel = (PLib3MFWriter_SetCompressionLevelPtr) dlsym(hLibrary, "lib3mf_writer_setcompressionlevel");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_SetCompressionLevel == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Writer_GetCompressionLevel = (PLib3MFWriter_GetCompressionLevelPtr) GetProcAddress(hLibrary, "lib3mf_writer_getcompressionlevel");
+		#else // _WIN32
+		pWrapperTable->m_Writer_GetCompressionLevel = (PLib3MFWriter_GetCompressionLevelPtr) dlsym(hLibrary, "lib3mf_writer_getcompressionlevel");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Writer_GetCompressionLevel == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Writer_SetStrictModeActive = (PLib3MFWriter_SetStrictModeActivePtr) GetProcAddress(hLibrary, "lib3mf_writer_setstrictmodeactive");
 		#else // _WIN32
@@ -4760,6 +4973,51 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_Reader_GetStrictModeActive == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_SetWorkerThreadCount = (PLib3MFReader_SetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_reader_setworkerthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_Reader_SetWorkerThreadCount = (PLib3MFReader_SetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_reader_setworkerthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_SetWorkerThreadCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_GetWorkerThreadCount = (PLib3MFReader_GetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_reader_getworkerthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_Reader_GetWorkerThreadCount = (PLib3MFReader_GetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_reader_getworkerthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_GetWorkerThreadCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_SetMeshStreamCallbacks = (PLib3MFReader_SetMeshStreamCallbacksPtr) GetProcAddress(hLibrary, "lib3mf_reader_setmeshstreamcallbacks");
+		#else // _WIN32
+		pWrapperTable->m_Reader_SetMeshStreamCallbacks = (PLib3MFReader_SetMeshStreamCallbacksPtr) dlsym(hLibrary, "lib3mf_reader_setmeshstreamcallbacks");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_SetMeshStreamCallbacks == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_SetLazyMeshLoadingActive = (PLib3MFReader_SetLazyMeshLoadingActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_setlazymeshloadingactive");
+		#else // _WIN32
+		pWrapperTable->m_Reader_SetLazyMeshLoadingActive = (PLib3MFReader_SetLazyMeshLoadingActivePtr) dlsym(hLibrary, "lib3mf_reader_setlazymeshloadingactive");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_SetLazyMeshLoadingActive == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Reader_GetLazyMeshLoadingActive = (PLib3MFReader_GetLazyMeshLoadingActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_getlazymeshloadingactive");
+		#else // _WIN32
+		pWrapperTable->m_Reader_GetLazyMeshLoadingActive = (PLib3MFReader_GetLazyMeshLoadingActivePtr) dlsym(hLibrary, "lib3mf_reader_getlazymeshloadingactive");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Reader_GetLazyMeshLoadingActive == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Reader_GetWarning = (PLib3MFReader_GetWarningPtr) GetProcAddress(hLibrary, "lib3mf_reader_getwarning");
 		#else // _WIN32
@@ -4796,6 +5054,60 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_Reader_SetContentEncryptionCallback == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_StreamingWriter_BeginMeshObject = (PLib3MFStreamingWriter_BeginMeshObjectPtr) GetProcAddress(hLibrary, "lib3mf_streamingwriter_beginmeshobject");
+		#else // _WIN32
+		pWrapperTable->m_StreamingWriter_BeginMeshObject = (PLib3MFStreamingWriter_BeginMeshObjectPtr) dlsym(hLibrary, "lib3mf_streamingwriter_beginmeshobject");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_StreamingWriter_BeginMeshObject == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_StreamingWriter_AddVertices = (PLib3MFStreamingWriter_AddVerticesPtr) GetProcAddress(hLibrary, "lib3mf_streamingwriter_addvertices");
+		#else // _WIN32
+		pWrapperTable->m_StreamingWriter_AddVertices = (PLib3MFStreamingWriter_AddVerticesPtr) dlsym(hLibrary, "lib3mf_streamingwriter_addvertices");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_StreamingWriter_AddVertices == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_StreamingWriter_AddTriangles = (PLib3MFStreamingWriter_AddTrianglesPtr) GetProcAddress(hLibrary, "lib3mf_streamingwriter_addtriangles");
+		#else // _WIN32
+		pWrapperTable->m_StreamingWriter_AddTriangles = (PLib3MFStreamingWriter_AddTrianglesPtr) dlsym(hLibrary, "lib3mf_streamingwriter_addtriangles");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_StreamingWriter_AddTriangles == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_StreamingWriter_EndMeshObject = (PLib3MFStreamingWriter_EndMeshObjectPtr) GetProcAddress(hLibrary, "lib3mf_streamingwriter_endmeshobject");
+		#else // _WIN32
+		pWrapperTable->m_StreamingWriter_EndMeshObject = (PLib3MFStreamingWriter_EndMeshObjectPtr) dlsym(hLibrary, "lib3mf_streamingwriter_endmeshobject");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_StreamingWriter_EndMeshObject == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_StreamingWriter_AddBuildItem = (PLib3MFStreamingWriter_AddBuildItemPtr) GetProcAddress(hLibrary, "lib3mf_streamingwriter_addbuilditem");
+		#else // _WIN32
+		pWrapperTable->m_StreamingWriter_AddBuildItem = (PLib3MFStreamingWriter_AddBuildItemPtr) dlsym(hLibrary, "lib3mf_streamingwriter_addbuilditem");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_StreamingWriter_AddBuildItem == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_StreamingWriter_Finish = (PLib3MFStreamingWriter_FinishPtr) GetProcAddress(hLibrary, "lib3mf_streamingwriter_finish");
+		#else // _WIN32
+		pWrapperTable->m_StreamingWriter_Finish = (PLib3MFStreamingWriter_FinishPtr) dlsym(hLibrary, "lib3mf_streamingwriter_finish");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_StreamingWriter_Finish == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_PackagePart_GetPath = (PLib3MFPackagePart_GetPathPtr) GetProcAddress(hLibrary, "lib3mf_packagepart_getpath");
 		#else // _WIN32
@@ -5552,6 +5864,24 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_MeshObject_GetVertices == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_MeshObject_GetVertexPageCount = (PLib3MFMeshObject_GetVertexPageCountPtr) GetProcAddress(hLibrary, "lib3mf_meshobject_getvertexpagecount");
+		#else // _WIN32
+		pWrapperTable->m_MeshObject_GetVertexPageCount = (PLib3MFMeshObject_GetVertexPageCountPtr) dlsym(hLibrary, "lib3mf_meshobject_getvertexpagecount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_MeshObject_GetVertexPageCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_MeshObject_GetVertexPage = (PLib3MFMeshObject_GetVertexPagePtr) GetProcAddress(hLibrary, "lib3mf_meshobject_getvertexpage");
+		#else // _WIN32
+		pWrapperTable->m_MeshObject_GetVertexPage = (PLib3MFMeshObject_GetVertexPagePtr) dlsym(hLibrary, "lib3mf_meshobject_getvertexpage");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_MeshObject_GetVertexPage == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_MeshObject_GetTriangle = (PLib3MFMeshObject_GetTrianglePtr) GetProcAddress(hLibrary, "lib3mf_meshobject_gettriangle");
 		#else // _WIN32
@@ -5588,6 +5918,24 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_MeshObject_GetTriangleIndices == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_MeshObject_GetTrianglePageCount = (PLib3MFMeshObject_GetTrianglePageCountPtr) GetProcAddress(hLibrary, "lib3mf_meshobject_gettrianglepagecount");
+		#else // _WIN32
+		pWrapperTable->m_MeshObject_GetTrianglePageCount = (PLib3MFMeshObject_GetTrianglePageCountPtr) dlsym(hLibrary, "lib3mf_meshobject_gettrianglepagecount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_MeshObject_GetTrianglePageCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_MeshObject_GetTrianglePage = (PLib3MFMeshObject_GetTrianglePagePtr) GetProcAddress(hLibrary, "lib3mf_meshobject_gettrianglepage");
+		#else // _WIN32
+		pWrapperTable->m_MeshObject_GetTrianglePage = (PLib3MFMeshObject_GetTrianglePagePtr) dlsym(hLibrary, "lib3mf_meshobject_gettrianglepage");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_MeshObject_GetTrianglePage == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_MeshObject_SetObjectLevelProperty = (PLib3MFMeshObject_SetObjectLevelPropertyPtr) GetProcAddress(hLibrary, "lib3mf_meshobject_setobjectlevelproperty");
 		#else // _WIN32
@@ -5660,6 +6008,15 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_MeshObject_SetGeometry == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_MeshObject_ReserveGeometry = (PLib3MFMeshObject_ReserveGeometryPtr) GetProcAddress(hLibrary, "lib3mf_meshobject_reservegeometry");
+		#else // _WIN32
+		pWrapperTable->m_MeshObject_ReserveGeometry = (PLib3MFMeshObject_ReserveGeometryPtr) dlsym(hLibrary, "lib3mf_meshobject_reservegeometry");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_MeshObject_ReserveGeometry == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_MeshObject_IsManifoldAndOriented = (PLib3MFMeshObject_IsManifoldAndOrientedPtr) GetProcAddress(hLibrary, "lib3mf_meshobject_ismanifoldandoriented");
 		#else // _WIN32
@@ -5669,6 +6026,15 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_MeshObject_IsManifoldAndOriented == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_MeshObject_IsGeometryLoaded = (PLib3MFMeshObject_IsGeometryLoadedPtr) GetProcAddress(hLibrary, "lib3mf_meshobject_isgeometryloaded");
+		#else // _WIN32
+		pWrapperTable->m_MeshObject_IsGeometryLoaded = (PLib3MFMeshObject_IsGeometryLoadedPtr) dlsym(hLibrary, "lib3mf_meshobject_isgeometryloaded");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_MeshObject_IsGeometryLoaded == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_MeshObject_BeamLattice = (PLib3MFMeshObject_BeamLatticePtr) GetProcAddress(hLibrary, "lib3mf_meshobject_beamlattice");
 		#else // _WIN32
@@ -8558,6 +8924,78 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_ImplicitFunction_SortNodesTopologically == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_ImplicitFunction_CreateEvaluator = (PLib3MFImplicitFunction_CreateEvaluatorPtr) GetProcAddress(hLibrary, "lib3mf_implicitfunction_createevaluator");
+		#else // _WIN32
+		pWrapperTable->m_ImplicitFunction_CreateEvaluator = (PLib3MFImplicitFunction_CreateEvaluatorPtr) dlsym(hLibrary, "lib3mf_implicitfunction_createevaluator");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ImplicitFunction_CreateEvaluator == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_ImplicitEvaluator_GetInputStride = (PLib3MFImplicitEvaluator_GetInputStridePtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_getinputstride");
+		#else // _WIN32
+		pWrapperTable->m_ImplicitEvaluator_GetInputStride = (PLib3MFImplicitEvaluator_GetInputStridePtr) dlsym(hLibrary, "lib3mf_implicitevaluator_getinputstride");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ImplicitEvaluator_GetInputStride == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_ImplicitEvaluator_GetOutputStride = (PLib3MFImplicitEvaluator_GetOutputStridePtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_getoutputstride");
+		#else // _WIN32
+		pWrapperTable->m_ImplicitEvaluator_GetOutputStride = (PLib3MFImplicitEvaluator_GetOutputStridePtr) dlsym(hLibrary, "lib3mf_implicitevaluator_getoutputstride");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ImplicitEvaluator_GetOutputStride == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_ImplicitEvaluator_SetWorkerThreadCount = (PLib3MFImplicitEvaluator_SetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_setworkerthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_ImplicitEvaluator_SetWorkerThreadCount = (PLib3MFImplicitEvaluator_SetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_implicitevaluator_setworkerthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ImplicitEvaluator_SetWorkerThreadCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_ImplicitEvaluator_GetWorkerThreadCount = (PLib3MFImplicitEvaluator_GetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_getworkerthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_ImplicitEvaluator_GetWorkerThreadCount = (PLib3MFImplicitEvaluator_GetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_implicitevaluator_getworkerthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ImplicitEvaluator_GetWorkerThreadCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_ImplicitEvaluator_Evaluate = (PLib3MFImplicitEvaluator_EvaluatePtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_evaluate");
+		#else // _WIN32
+		pWrapperTable->m_ImplicitEvaluator_Evaluate = (PLib3MFImplicitEvaluator_EvaluatePtr) dlsym(hLibrary, "lib3mf_implicitevaluator_evaluate");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ImplicitEvaluator_Evaluate == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_ImplicitEvaluator_EvaluateBatch = (PLib3MFImplicitEvaluator_EvaluateBatchPtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_evaluatebatch");
+		#else // _WIN32
+		pWrapperTable->m_ImplicitEvaluator_EvaluateBatch = (PLib3MFImplicitEvaluator_EvaluateBatchPtr) dlsym(hLibrary, "lib3mf_implicitevaluator_evaluatebatch");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ImplicitEvaluator_EvaluateBatch == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_ImplicitEvaluator_EvaluateBounds = (PLib3MFImplicitEvaluator_EvaluateBoundsPtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_evaluatebounds");
+		#else // _WIN32
+		pWrapperTable->m_ImplicitEvaluator_EvaluateBounds = (PLib3MFImplicitEvaluator_EvaluateBoundsPtr) dlsym(hLibrary, "lib3mf_implicitevaluator_evaluatebounds");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_ImplicitEvaluator_EvaluateBounds == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_FunctionFromImage3D_GetImage3D = (PLib3MFFunctionFromImage3D_GetImage3DPtr) GetProcAddress(hLibrary, "lib3mf_functionfromimage3d_getimage3d");
 		#else // _WIN32
@@ -8648,6 +9086,60 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_FunctionFromImage3D_SetScale == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_FunctionFromImage3D_CreateSampler = (PLib3MFFunctionFromImage3D_CreateSamplerPtr) GetProcAddress(hLibrary, "lib3mf_functionfromimage3d_createsampler");
+		#else // _WIN32
+		pWrapperTable->m_FunctionFromImage3D_CreateSampler = (PLib3MFFunctionFromImage3D_CreateSamplerPtr) dlsym(hLibrary, "lib3mf_functionfromimage3d_createsampler");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_FunctionFromImage3D_CreateSampler == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Image3DSampler_SetCacheSize = (PLib3MFImage3DSampler_SetCacheSizePtr) GetProcAddress(hLibrary, "lib3mf_image3dsampler_setcachesize");
+		#else // _WIN32
+		pWrapperTable->m_Image3DSampler_SetCacheSize = (PLib3MFImage3DSampler_SetCacheSizePtr) dlsym(hLibrary, "lib3mf_image3dsampler_setcachesize");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Image3DSampler_SetCacheSize == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Image3DSampler_GetCacheSize = (PLib3MFImage3DSampler_GetCacheSizePtr) GetProcAddress(hLibrary, "lib3mf_image3dsampler_getcachesize");
+		#else // _WIN32
+		pWrapperTable->m_Image3DSampler_GetCacheSize = (PLib3MFImage3DSampler_GetCacheSizePtr) dlsym(hLibrary, "lib3mf_image3dsampler_getcachesize");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Image3DSampler_GetCacheSize == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Image3DSampler_SetWorkerThreadCount = (PLib3MFImage3DSampler_SetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_image3dsampler_setworkerthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_Image3DSampler_SetWorkerThreadCount = (PLib3MFImage3DSampler_SetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_image3dsampler_setworkerthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Image3DSampler_SetWorkerThreadCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Image3DSampler_GetWorkerThreadCount = (PLib3MFImage3DSampler_GetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_image3dsampler_getworkerthreadcount");
+		#else // _WIN32
+		pWrapperTable->m_Image3DSampler_GetWorkerThreadCount = (PLib3MFImage3DSampler_GetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_image3dsampler_getworkerthreadcount");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Image3DSampler_GetWorkerThreadCount == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		#ifdef _WIN32
+		pWrapperTable->m_Image3DSampler_Sample = (PLib3MFImage3DSampler_SamplePtr) GetProcAddress(hLibrary, "lib3mf_image3dsampler_sample");
+		#else // _WIN32
+		pWrapperTable->m_Image3DSampler_Sample = (PLib3MFImage3DSampler_SamplePtr) dlsym(hLibrary, "lib3mf_image3dsampler_sample");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_Image3DSampler_Sample == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_BuildItem_GetObjectResource = (PLib3MFBuildItem_GetObjectResourcePtr) GetProcAddress(hLibrary, "lib3mf_builditem_getobjectresource");
 		#else // _WIN32
@@ -10016,6 +10508,15 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if (pWrapperTable->m_CreateModel == nullptr)
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		#ifdef _WIN32
+		pWrapperTable->m_CreateStreamingWriter = (PLib3MFCreateStreamingWriterPtr) GetProcAddress(hLibrary, "lib3mf_createstreamingwriter");
+		#else // _WIN32
+		pWrapperTable->m_CreateStreamingWriter = (PLib3MFCreateStreamingWriterPtr) dlsym(hLibrary, "lib3mf_createstreamingwriter");
+		dlerror();
+		#endif // _WIN32
+		if (pWrapperTable->m_CreateStreamingWriter == nullptr)
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		#ifdef _WIN32
 		pWrapperTable->m_Release = (PLib3MFReleasePtr) GetProcAddress(hLibrary, "lib3mf_release");
 		#else // _WIN32
@@ -10190,6 +10691,30 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_SetDecimalPrecision == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_writer_setshortestroundtripactive", (void**)&(pWrapperTable->m_Writer_SetShortestRoundtripActive));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_SetShortestRoundtripActive == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_writer_getshortestroundtripactive", (void**)&(pWrapperTable->m_Writer_GetShortestRoundtripActive));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_GetShortestRoundtripActive == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_writer_setworkerthreadcount", (void**)&(pWrapperTable->m_Writer_SetWorkerThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_SetWorkerThreadCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_writer_getworkerthreadcount", (void**)&(pWrapperTable->m_Writer_GetWorkerThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_GetWorkerThreadCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_writer_setcompressionlevel", (void**)&(pWrapperTable->m_Writer_SetCompressionLevel));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_SetCompressionLevel == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_writer_getcompressionlevel", (void**)&(pWrapperTable->m_Writer_GetCompressionLevel));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_GetCompressionLevel == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_writer_setstrictmodeactive", (void**)&(pWrapperTable->m_Writer_SetStrictModeActive));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Writer_SetStrictModeActive == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -10246,6 +10771,26 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_GetStrictModeActive == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_reader_setworkerthreadcount", (void**)&(pWrapperTable->m_Reader_SetWorkerThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_SetWorkerThreadCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_reader_getworkerthreadcount", (void**)&(pWrapperTable->m_Reader_GetWorkerThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_GetWorkerThreadCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_reader_setmeshstreamcallbacks", (void**)&(pWrapperTable->m_Reader_SetMeshStreamCallbacks));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_SetMeshStreamCallbacks == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_reader_setlazymeshloadingactive", (void**)&(pWrapperTable->m_Reader_SetLazyMeshLoadingActive));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_SetLazyMeshLoadingActive == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_reader_getlazymeshloadingactive", (void**)&(pWrapperTable->m_Reader_GetLazyMeshLoadingActive));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_GetLazyMeshLoadingActive == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_reader_getwarning", (void**)&(pWrapperTable->m_Reader_GetWarning));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_GetWarning == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -10262,6 +10807,30 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_Reader_SetContentEncryptionCallback == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_streamingwriter_beginmeshobject", (void**)&(pWrapperTable->m_StreamingWriter_BeginMeshObject));
+		if ( (eLookupError != 0) || (pWrapperTable->m_StreamingWriter_BeginMeshObject == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_streamingwriter_addvertices", (void**)&(pWrapperTable->m_StreamingWriter_AddVertices));
+		if ( (eLookupError != 0) || (pWrapperTable->m_StreamingWriter_AddVertices == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_streamingwriter_addtriangles", (void**)&(pWrapperTable->m_StreamingWriter_AddTriangles));
+		if ( (eLookupError != 0) || (pWrapperTable->m_StreamingWriter_AddTriangles == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_streamingwriter_endmeshobject", (void**)&(pWrapperTable->m_StreamingWriter_EndMeshObject));
+		if ( (eLookupError != 0) || (pWrapperTable->m_StreamingWriter_EndMeshObject == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_streamingwriter_addbuilditem", (void**)&(pWrapperTable->m_StreamingWriter_AddBuildItem));
+		if ( (eLookupError != 0) || (pWrapperTable->m_StreamingWriter_AddBuildItem == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_streamingwriter_finish", (void**)&(pWrapperTable->m_StreamingWriter_Finish));
+		if ( (eLookupError != 0) || (pWrapperTable->m_StreamingWriter_Finish == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_packagepart_getpath", (void**)&(pWrapperTable->m_PackagePart_GetPath));
 		if ( (eLookupError != 0) || (pWrapperTable->m_PackagePart_GetPath == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -10598,6 +11167,14 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_MeshObject_GetVertices == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_meshobject_getvertexpagecount", (void**)&(pWrapperTable->m_MeshObject_GetVertexPageCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_MeshObject_GetVertexPageCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_meshobject_getvertexpage", (void**)&(pWrapperTable->m_MeshObject_GetVertexPage));
+		if ( (eLookupError != 0) || (pWrapperTable->m_MeshObject_GetVertexPage == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_meshobject_gettriangle", (void**)&(pWrapperTable->m_MeshObject_GetTriangle));
 		if ( (eLookupError != 0) || (pWrapperTable->m_MeshObject_GetTriangle == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -10610,8 +11187,16 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_MeshObject_AddTriangle == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
-		eLookupError = (*pLookup)("lib3mf_meshobject_gettriangleindices", (void**)&(pWrapperTable->m_MeshObject_GetTriangleIndices));
-		if ( (eLookupError != 0) || (pWrapperTable->m_MeshObject_GetTriangleIndices == nullptr) )
+		eLookupError = (*pLookup)("lib3mf_meshobject_gettriangleindices", (void**)&(pWrapperTable->m_MeshObject_GetTriangleIndices));
+		if ( (eLookupError != 0) || (pWrapperTable->m_MeshObject_GetTriangleIndices == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_meshobject_gettrianglepagecount", (void**)&(pWrapperTable->m_MeshObject_GetTrianglePageCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_MeshObject_GetTrianglePageCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_meshobject_gettrianglepage", (void**)&(pWrapperTable->m_MeshObject_GetTrianglePage));
+		if ( (eLookupError != 0) || (pWrapperTable->m_MeshObject_GetTrianglePage == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
 		eLookupError = (*pLookup)("lib3mf_meshobject_setobjectlevelproperty", (void**)&(pWrapperTable->m_MeshObject_SetObjectLevelProperty));
@@ -10646,10 +11231,18 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_MeshObject_SetGeometry == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_meshobject_reservegeometry", (void**)&(pWrapperTable->m_MeshObject_ReserveGeometry));
+		if ( (eLookupError != 0) || (pWrapperTable->m_MeshObject_ReserveGeometry == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_meshobject_ismanifoldandoriented", (void**)&(pWrapperTable->m_MeshObject_IsManifoldAndOriented));
 		if ( (eLookupError != 0) || (pWrapperTable->m_MeshObject_IsManifoldAndOriented == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_meshobject_isgeometryloaded", (void**)&(pWrapperTable->m_MeshObject_IsGeometryLoaded));
+		if ( (eLookupError != 0) || (pWrapperTable->m_MeshObject_IsGeometryLoaded == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_meshobject_beamlattice", (void**)&(pWrapperTable->m_MeshObject_BeamLattice));
 		if ( (eLookupError != 0) || (pWrapperTable->m_MeshObject_BeamLattice == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -11934,6 +12527,38 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_ImplicitFunction_SortNodesTopologically == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_implicitfunction_createevaluator", (void**)&(pWrapperTable->m_ImplicitFunction_CreateEvaluator));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ImplicitFunction_CreateEvaluator == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_implicitevaluator_getinputstride", (void**)&(pWrapperTable->m_ImplicitEvaluator_GetInputStride));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ImplicitEvaluator_GetInputStride == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_implicitevaluator_getoutputstride", (void**)&(pWrapperTable->m_ImplicitEvaluator_GetOutputStride));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ImplicitEvaluator_GetOutputStride == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_implicitevaluator_setworkerthreadcount", (void**)&(pWrapperTable->m_ImplicitEvaluator_SetWorkerThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ImplicitEvaluator_SetWorkerThreadCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_implicitevaluator_getworkerthreadcount", (void**)&(pWrapperTable->m_ImplicitEvaluator_GetWorkerThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ImplicitEvaluator_GetWorkerThreadCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_implicitevaluator_evaluate", (void**)&(pWrapperTable->m_ImplicitEvaluator_Evaluate));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ImplicitEvaluator_Evaluate == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_implicitevaluator_evaluatebatch", (void**)&(pWrapperTable->m_ImplicitEvaluator_EvaluateBatch));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ImplicitEvaluator_EvaluateBatch == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_implicitevaluator_evaluatebounds", (void**)&(pWrapperTable->m_ImplicitEvaluator_EvaluateBounds));
+		if ( (eLookupError != 0) || (pWrapperTable->m_ImplicitEvaluator_EvaluateBounds == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_functionfromimage3d_getimage3d", (void**)&(pWrapperTable->m_FunctionFromImage3D_GetImage3D));
 		if ( (eLookupError != 0) || (pWrapperTable->m_FunctionFromImage3D_GetImage3D == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -11974,6 +12599,30 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_FunctionFromImage3D_SetScale == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_functionfromimage3d_createsampler", (void**)&(pWrapperTable->m_FunctionFromImage3D_CreateSampler));
+		if ( (eLookupError != 0) || (pWrapperTable->m_FunctionFromImage3D_CreateSampler == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_image3dsampler_setcachesize", (void**)&(pWrapperTable->m_Image3DSampler_SetCacheSize));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Image3DSampler_SetCacheSize == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_image3dsampler_getcachesize", (void**)&(pWrapperTable->m_Image3DSampler_GetCacheSize));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Image3DSampler_GetCacheSize == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_image3dsampler_setworkerthreadcount", (void**)&(pWrapperTable->m_Image3DSampler_SetWorkerThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Image3DSampler_SetWorkerThreadCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_image3dsampler_getworkerthreadcount", (void**)&(pWrapperTable->m_Image3DSampler_GetWorkerThreadCount));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Image3DSampler_GetWorkerThreadCount == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
+		eLookupError = (*pLookup)("lib3mf_image3dsampler_sample", (void**)&(pWrapperTable->m_Image3DSampler_Sample));
+		if ( (eLookupError != 0) || (pWrapperTable->m_Image3DSampler_Sample == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_builditem_getobjectresource", (void**)&(pWrapperTable->m_BuildItem_GetObjectResource));
 		if ( (eLookupError != 0) || (pWrapperTable->m_BuildItem_GetObjectResource == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -12582,6 +13231,10 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		if ( (eLookupError != 0) || (pWrapperTable->m_CreateModel == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 		
+		eLookupError = (*pLookup)("lib3mf_createstreamingwriter", (void**)&(pWrapperTable->m_CreateStreamingWriter));
+		if ( (eLookupError != 0) || (pWrapperTable->m_CreateStreamingWriter == nullptr) )
+			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+		
 		eLookupError = (*pLookup)("lib3mf_release", (void**)&(pWrapperTable->m_Release));
 		if ( (eLookupError != 0) || (pWrapperTable->m_Release == nullptr) )
 			return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
@@ -12738,6 +13391,71 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(m_pWrapper->m_WrapperTable.m_Writer_SetDecimalPrecision(m_pHandle, nDecimalPrecision));
 	}
 	
+	/**
+	* CWriter::SetShortestRoundtripActive - Activates (deactivates) the shortest round-trip output of mesh coordinates and radii. Each value is written with the fewest digits that read back as exactly the same number; the decimal precision is ignored while active.
+	* @param[in] bShortestRoundtripActive - flag whether shortest round-trip output is active or not.
+	*/
+	void CWriter::SetShortestRoundtripActive(const bool bShortestRoundtripActive)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_SetShortestRoundtripActive(m_pHandle, bShortestRoundtripActive));
+	}
+	
+	/**
+	* CWriter::GetShortestRoundtripActive - Queries whether the shortest round-trip output of mesh coordinates and radii is active or not.
+	* @return returns flag whether shortest round-trip output is active or not.
+	*/
+	bool CWriter::GetShortestRoundtripActive()
+	{
+		bool resultShortestRoundtripActive = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_GetShortestRoundtripActive(m_pHandle, &resultShortestRoundtripActive));
+		
+		return resultShortestRoundtripActive;
+	}
+	
+	/**
+	* CWriter::SetWorkerThreadCount - Sets the number of threads the writer may use to compress package parts and to render large meshes. 0 selects the number of hardware threads, 1 disables parallel writing.
+	* @param[in] nThreadCount - Number of threads, including the calling thread. 0 means automatic.
+	*/
+	void CWriter::SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_SetWorkerThreadCount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CWriter::GetWorkerThreadCount - Returns the number of threads the writer may use to compress package parts and to render large meshes.
+	* @return Number of threads, including the calling thread. 0 means automatic.
+	*/
+	Lib3MF_uint32 CWriter::GetWorkerThreadCount()
+	{
+		Lib3MF_uint32 resultThreadCount = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_GetWorkerThreadCount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
+	/**
+	* CWriter::SetCompressionLevel - Sets the compression of all parts of a kind. Already compressed images are best stored without compression.
+	* @param[in] ePartType - The kind of parts to configure.
+	* @param[in] eLevel - The compression level. Defaults to Fastest for all kinds of parts. Once it is set, encrypted parts are deflated with it before encryption and stored without further compression.
+	*/
+	void CWriter::SetCompressionLevel(const ePackagePartType ePartType, const eCompressionLevel eLevel)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_SetCompressionLevel(m_pHandle, ePartType, eLevel));
+	}
+	
+	/**
+	* CWriter::GetCompressionLevel - Returns the compression of all parts of a kind.
+	* @param[in] ePartType - The kind of parts to query.
+	* @return The compression level.
+	*/
+	eCompressionLevel CWriter::GetCompressionLevel(const ePackagePartType ePartType)
+	{
+		eCompressionLevel resultLevel = (eCompressionLevel) 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Writer_GetCompressionLevel(m_pHandle, ePartType, &resultLevel));
+		
+		return resultLevel;
+	}
+	
 	/**
 	* CWriter::SetStrictModeActive - Activates (deactivates) the strict mode of the reader.
 	* @param[in] bStrictModeActive - flag whether strict mode is active or not.
@@ -12893,6 +13611,60 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return resultStrictModeActive;
 	}
 	
+	/**
+	* CReader::SetWorkerThreadCount - Sets the number of threads the reader may use to decode mesh data. 0 selects the number of hardware threads. With 1 (the default), vertex and triangle lists are still decoded by the streaming mesh decoder, but on the calling thread only.
+	* @param[in] nThreadCount - Number of threads, including the calling thread. 0 means automatic.
+	*/
+	void CReader::SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_SetWorkerThreadCount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CReader::GetWorkerThreadCount - Returns the number of threads the reader may use to decode mesh data.
+	* @return Number of threads, including the calling thread. 0 means automatic.
+	*/
+	Lib3MF_uint32 CReader::GetWorkerThreadCount()
+	{
+		Lib3MF_uint32 resultThreadCount = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_GetWorkerThreadCount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
+	/**
+	* CReader::SetMeshStreamCallbacks - Hands the vertices and triangles of all mesh objects to callbacks in blocks while they are read. Blocks of one mesh object are delivered in document order, and vertices are delivered before the triangles that refer to them. If the geometry is not retained, the meshes of the read model stay empty, while objects, components and build items are still read. Beam lattices and triangle sets require the geometry to be retained.
+	* @param[in] pTheVertexBlockCallback - Callback to call for every block of vertices. May be null.
+	* @param[in] pTheTriangleBlockCallback - Callback to call for every block of triangles. May be null.
+	* @param[in] bRetainGeometry - If true, the geometry is read into the model as well.
+	* @param[in] pUserData - Userdata that is passed to the callback functions
+	*/
+	void CReader::SetMeshStreamCallbacks(const VertexBlockCallback pTheVertexBlockCallback, const TriangleBlockCallback pTheTriangleBlockCallback, const bool bRetainGeometry, const Lib3MF_pvoid pUserData)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_SetMeshStreamCallbacks(m_pHandle, pTheVertexBlockCallback, pTheTriangleBlockCallback, bRetainGeometry, pUserData));
+	}
+	
+	/**
+	* CReader::SetLazyMeshLoadingActive - Defers parsing the geometry of mesh objects until it is first accessed. The model part is kept in memory after reading, and each mesh is parsed from it on first access. Ignored if mesh stream callbacks are set.
+	* @param[in] bLazyMeshLoadingActive - Flag whether mesh geometry is parsed on first access
+	*/
+	void CReader::SetLazyMeshLoadingActive(const bool bLazyMeshLoadingActive)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_SetLazyMeshLoadingActive(m_pHandle, bLazyMeshLoadingActive));
+	}
+	
+	/**
+	* CReader::GetLazyMeshLoadingActive - Returns whether mesh geometry is parsed on first access.
+	* @return Flag whether mesh geometry is parsed on first access
+	*/
+	bool CReader::GetLazyMeshLoadingActive()
+	{
+		bool resultLazyMeshLoadingActive = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Reader_GetLazyMeshLoadingActive(m_pHandle, &resultLazyMeshLoadingActive));
+		
+		return resultLazyMeshLoadingActive;
+	}
+	
 	/**
 	* CReader::GetWarning - Returns Warning and Error Information of the read process
 	* @param[in] nIndex - Index of the Warning. Valid values are 0 to WarningCount - 1
@@ -12943,6 +13715,67 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(m_pWrapper->m_WrapperTable.m_Reader_SetContentEncryptionCallback(m_pHandle, pTheCallback, pUserData));
 	}
 	
+	/**
+	 * Method definitions for class CStreamingWriter
+	 */
+	
+	/**
+	* CStreamingWriter::BeginMeshObject - Starts a new mesh object. All of its vertices must be added before its triangles.
+	* @param[in] sName - Name of the object. May be empty.
+	* @return Resource ID of the new mesh object.
+	*/
+	Lib3MF_uint32 CStreamingWriter::BeginMeshObject(const std::string & sName)
+	{
+		Lib3MF_uint32 resultObjectID = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_StreamingWriter_BeginMeshObject(m_pHandle, sName.c_str(), &resultObjectID));
+		
+		return resultObjectID;
+	}
+	
+	/**
+	* CStreamingWriter::AddVertices - Writes a batch of vertices of the current mesh object. Vertex indices continue over all batches of the object.
+	* @param[in] VerticesBuffer - Positions of the vertices
+	*/
+	void CStreamingWriter::AddVertices(const CInputVector<sPosition> & VerticesBuffer)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_StreamingWriter_AddVertices(m_pHandle, (Lib3MF_uint64)VerticesBuffer.size(), VerticesBuffer.data()));
+	}
+	
+	/**
+	* CStreamingWriter::AddTriangles - Writes a batch of triangles of the current mesh object. No further vertices may be added to the object afterwards.
+	* @param[in] IndicesBuffer - Vertex indices of the triangles. They must refer to vertices, which have already been added to the object.
+	*/
+	void CStreamingWriter::AddTriangles(const CInputVector<sTriangle> & IndicesBuffer)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_StreamingWriter_AddTriangles(m_pHandle, (Lib3MF_uint64)IndicesBuffer.size(), IndicesBuffer.data()));
+	}
+	
+	/**
+	* CStreamingWriter::EndMeshObject - Finishes the current mesh object.
+	*/
+	void CStreamingWriter::EndMeshObject()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_StreamingWriter_EndMeshObject(m_pHandle));
+	}
+	
+	/**
+	* CStreamingWriter::AddBuildItem - Adds a build item. It is written when the package is finished.
+	* @param[in] nObjectID - Resource ID of a finished mesh object.
+	* @param[in] Transform - Transformation matrix.
+	*/
+	void CStreamingWriter::AddBuildItem(const Lib3MF_uint32 nObjectID, const sTransform & Transform)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_StreamingWriter_AddBuildItem(m_pHandle, nObjectID, &Transform));
+	}
+	
+	/**
+	* CStreamingWriter::Finish - Writes the build items and closes the package. No further calls are allowed afterwards.
+	*/
+	void CStreamingWriter::Finish()
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_StreamingWriter_Finish(m_pHandle));
+	}
+	
 	/**
 	 * Method definitions for class CPackagePart
 	 */
@@ -14074,6 +14907,33 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(m_pWrapper->m_WrapperTable.m_MeshObject_GetVertices(m_pHandle, elementsNeededVertices, &elementsWrittenVertices, VerticesBuffer.data()));
 	}
 	
+	/**
+	* CMeshObject::GetVertexPageCount - Returns the number of pages in which the vertices of the mesh object are stored.
+	* @return the number of vertex pages.
+	*/
+	Lib3MF_uint32 CMeshObject::GetVertexPageCount()
+	{
+		Lib3MF_uint32 resultPageCount = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_MeshObject_GetVertexPageCount(m_pHandle, &resultPageCount));
+		
+		return resultPageCount;
+	}
+	
+	/**
+	* CMeshObject::GetVertexPage - Returns direct read access to a page of vertices without copying them. The memory is owned by the mesh object, must not be written to and is only valid until the mesh is modified or released.
+	* @param[in] nPageIndex - index of the page (0 to pagecount - 1).
+	* @param[out] nVertexCount - number of vertices stored in the page.
+	* @param[out] nStride - distance in bytes between two consecutive vertices.
+	* @return pointer to the three single precision coordinates of the first vertex in the page.
+	*/
+	Lib3MF_pvoid CMeshObject::GetVertexPage(const Lib3MF_uint32 nPageIndex, Lib3MF_uint32 & nVertexCount, Lib3MF_uint32 & nStride)
+	{
+		Lib3MF_pvoid resultCoordinates = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_MeshObject_GetVertexPage(m_pHandle, nPageIndex, &nVertexCount, &nStride, &resultCoordinates));
+		
+		return resultCoordinates;
+	}
+	
 	/**
 	* CMeshObject::GetTriangle - Returns indices of a single triangle of a mesh object.
 	* @param[in] nIndex - Index of the triangle (0 to trianglecount - 1)
@@ -14123,6 +14983,33 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(m_pWrapper->m_WrapperTable.m_MeshObject_GetTriangleIndices(m_pHandle, elementsNeededIndices, &elementsWrittenIndices, IndicesBuffer.data()));
 	}
 	
+	/**
+	* CMeshObject::GetTrianglePageCount - Returns the number of pages in which the triangles of the mesh object are stored.
+	* @return the number of triangle pages.
+	*/
+	Lib3MF_uint32 CMeshObject::GetTrianglePageCount()
+	{
+		Lib3MF_uint32 resultPageCount = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_MeshObject_GetTrianglePageCount(m_pHandle, &resultPageCount));
+		
+		return resultPageCount;
+	}
+	
+	/**
+	* CMeshObject::GetTrianglePage - Returns direct read access to a page of triangles without copying them. The memory is owned by the mesh object, must not be written to and is only valid until the mesh is modified or released.
+	* @param[in] nPageIndex - index of the page (0 to pagecount - 1).
+	* @param[out] nTriangleCount - number of triangles stored in the page.
+	* @param[out] nStride - distance in bytes between two consecutive triangles.
+	* @return pointer to the three 32 bit vertex indices of the first triangle in the page.
+	*/
+	Lib3MF_pvoid CMeshObject::GetTrianglePage(const Lib3MF_uint32 nPageIndex, Lib3MF_uint32 & nTriangleCount, Lib3MF_uint32 & nStride)
+	{
+		Lib3MF_pvoid resultIndices = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_MeshObject_GetTrianglePage(m_pHandle, nPageIndex, &nTriangleCount, &nStride, &resultIndices));
+		
+		return resultIndices;
+	}
+	
 	/**
 	* CMeshObject::SetObjectLevelProperty - Sets the property at the object-level of the mesh object.
 	* @param[in] nUniqueResourceID - the object-level Property UniqueResourceID.
@@ -14210,6 +15097,17 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(m_pWrapper->m_WrapperTable.m_MeshObject_SetGeometry(m_pHandle, nVerticesSize, VerticesBuffer.data(), nIndicesSize, IndicesBuffer.data()));
 	}
 	
+	/**
+	* CMeshObject::ReserveGeometry - Preallocates memory for the given total numbers of vertices, triangles and beams, so that they can be added without further allocations.
+	* @param[in] nVertexCount - number of vertices to reserve memory for.
+	* @param[in] nTriangleCount - number of triangles to reserve memory for.
+	* @param[in] nBeamCount - number of beams to reserve memory for.
+	*/
+	void CMeshObject::ReserveGeometry(const Lib3MF_uint32 nVertexCount, const Lib3MF_uint32 nTriangleCount, const Lib3MF_uint32 nBeamCount)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_MeshObject_ReserveGeometry(m_pHandle, nVertexCount, nTriangleCount, nBeamCount));
+	}
+	
 	/**
 	* CMeshObject::IsManifoldAndOriented - Retrieves, if an object describes a topologically oriented and manifold mesh, according to the core spec.
 	* @return returns, if the object is oriented and manifold.
@@ -14222,6 +15120,18 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		return resultIsManifoldAndOriented;
 	}
 	
+	/**
+	* CMeshObject::IsGeometryLoaded - Retrieves, if the geometry of an object has been loaded. Meshes read with lazy mesh loading are only loaded when their geometry is accessed for the first time.
+	* @return returns, if the geometry of the object has been loaded.
+	*/
+	bool CMeshObject::IsGeometryLoaded()
+	{
+		bool resultIsGeometryLoaded = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_MeshObject_IsGeometryLoaded(m_pHandle, &resultIsGeometryLoaded));
+		
+		return resultIsGeometryLoaded;
+	}
+	
 	/**
 	* CMeshObject::BeamLattice - Retrieves the BeamLattice within this MeshObject.
 	* @return the BeamLattice within this MeshObject
@@ -18955,6 +19865,117 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(m_pWrapper->m_WrapperTable.m_ImplicitFunction_SortNodesTopologically(m_pHandle));
 	}
 	
+	/**
+	* CImplicitFunction::CreateEvaluator - Compiles the function into an evaluator. Later changes of the function do not affect the evaluator.
+	* @return the evaluator
+	*/
+	PImplicitEvaluator CImplicitFunction::CreateEvaluator()
+	{
+		Lib3MFHandle hEvaluator = (Lib3MFHandle)nullptr;
+		CheckError(m_pWrapper->m_WrapperTable.m_ImplicitFunction_CreateEvaluator(m_pHandle, &hEvaluator));
+		
+		if (!hEvaluator) {
+			CheckError(LIB3MF_ERROR_INVALIDPARAM);
+		}
+		return std::shared_ptr<CImplicitEvaluator>(dynamic_cast<CImplicitEvaluator*>(m_pWrapper->polymorphicFactory(hEvaluator)));
+	}
+	
+	/**
+	 * Method definitions for class CImplicitEvaluator
+	 */
+	
+	/**
+	* CImplicitEvaluator::GetInputStride - Returns the number of input values per point. Vector inputs take 3 values, matrix inputs 16.
+	* @return number of input values per point
+	*/
+	Lib3MF_uint32 CImplicitEvaluator::GetInputStride()
+	{
+		Lib3MF_uint32 resultStride = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ImplicitEvaluator_GetInputStride(m_pHandle, &resultStride));
+		
+		return resultStride;
+	}
+	
+	/**
+	* CImplicitEvaluator::GetOutputStride - Returns the number of output values per point. Vector outputs take 3 values, matrix outputs 16.
+	* @return number of output values per point
+	*/
+	Lib3MF_uint32 CImplicitEvaluator::GetOutputStride()
+	{
+		Lib3MF_uint32 resultStride = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ImplicitEvaluator_GetOutputStride(m_pHandle, &resultStride));
+		
+		return resultStride;
+	}
+	
+	/**
+	* CImplicitEvaluator::SetWorkerThreadCount - Sets the number of threads used by Evaluate. 0 selects the number of hardware threads, 1 (default) evaluates on the calling thread.
+	* @param[in] nThreadCount - number of threads
+	*/
+	void CImplicitEvaluator::SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_ImplicitEvaluator_SetWorkerThreadCount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CImplicitEvaluator::GetWorkerThreadCount - Returns the number of threads used by Evaluate.
+	* @return number of threads
+	*/
+	Lib3MF_uint32 CImplicitEvaluator::GetWorkerThreadCount()
+	{
+		Lib3MF_uint32 resultThreadCount = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ImplicitEvaluator_GetWorkerThreadCount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
+	/**
+	* CImplicitEvaluator::Evaluate - Evaluates the function for a batch of points. The input values of all function inputs of a point are stored consecutively, followed by the next point.
+	* @param[in] InputsBuffer - input values of all points
+	* @param[out] OutputsBuffer - output values of all points
+	*/
+	void CImplicitEvaluator::Evaluate(const CInputVector<Lib3MF_double> & InputsBuffer, std::vector<Lib3MF_double> & OutputsBuffer)
+	{
+		Lib3MF_uint64 elementsNeededOutputs = 0;
+		Lib3MF_uint64 elementsWrittenOutputs = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ImplicitEvaluator_Evaluate(m_pHandle, (Lib3MF_uint64)InputsBuffer.size(), InputsBuffer.data(), 0, &elementsNeededOutputs, nullptr));
+		OutputsBuffer.resize((size_t) elementsNeededOutputs);
+		CheckError(m_pWrapper->m_WrapperTable.m_ImplicitEvaluator_Evaluate(m_pHandle, (Lib3MF_uint64)InputsBuffer.size(), InputsBuffer.data(), elementsNeededOutputs, &elementsWrittenOutputs, OutputsBuffer.data()));
+	}
+	
+	/**
+	* CImplicitEvaluator::EvaluateBatch - Evaluates the function for a batch of points in structure-of-arrays layout. The values of the first input component of all points are stored consecutively, followed by the values of the next component. The outputs are returned in the same layout.
+	* @param[in] InputsBuffer - input values of all points, one array per component
+	* @param[out] OutputsBuffer - output values of all points, one array per component
+	*/
+	void CImplicitEvaluator::EvaluateBatch(const CInputVector<Lib3MF_double> & InputsBuffer, std::vector<Lib3MF_double> & OutputsBuffer)
+	{
+		Lib3MF_uint64 elementsNeededOutputs = 0;
+		Lib3MF_uint64 elementsWrittenOutputs = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ImplicitEvaluator_EvaluateBatch(m_pHandle, (Lib3MF_uint64)InputsBuffer.size(), InputsBuffer.data(), 0, &elementsNeededOutputs, nullptr));
+		OutputsBuffer.resize((size_t) elementsNeededOutputs);
+		CheckError(m_pWrapper->m_WrapperTable.m_ImplicitEvaluator_EvaluateBatch(m_pHandle, (Lib3MF_uint64)InputsBuffer.size(), InputsBuffer.data(), elementsNeededOutputs, &elementsWrittenOutputs, OutputsBuffer.data()));
+	}
+	
+	/**
+	* CImplicitEvaluator::EvaluateBounds - Computes bounds of the function outputs for boxes of input values. Every box is given by the minimal and maximal value of each input component, stored like the points of Evaluate. The bounds contain all output values within the box, but are not necessarily tight. Unbounded outputs are reported as infinite.
+	* @param[in] InputMinimaBuffer - minimal input values of all boxes
+	* @param[in] InputMaximaBuffer - maximal input values of all boxes
+	* @param[out] OutputMinimaBuffer - lower bounds of the outputs of all boxes
+	* @param[out] OutputMaximaBuffer - upper bounds of the outputs of all boxes
+	*/
+	void CImplicitEvaluator::EvaluateBounds(const CInputVector<Lib3MF_double> & InputMinimaBuffer, const CInputVector<Lib3MF_double> & InputMaximaBuffer, std::vector<Lib3MF_double> & OutputMinimaBuffer, std::vector<Lib3MF_double> & OutputMaximaBuffer)
+	{
+		Lib3MF_uint64 elementsNeededOutputMinima = 0;
+		Lib3MF_uint64 elementsWrittenOutputMinima = 0;
+		Lib3MF_uint64 elementsNeededOutputMaxima = 0;
+		Lib3MF_uint64 elementsWrittenOutputMaxima = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_ImplicitEvaluator_EvaluateBounds(m_pHandle, (Lib3MF_uint64)InputMinimaBuffer.size(), InputMinimaBuffer.data(), (Lib3MF_uint64)InputMaximaBuffer.size(), InputMaximaBuffer.data(), 0, &elementsNeededOutputMinima, nullptr, 0, &elementsNeededOutputMaxima, nullptr));
+		OutputMinimaBuffer.resize((size_t) elementsNeededOutputMinima);
+		OutputMaximaBuffer.resize((size_t) elementsNeededOutputMaxima);
+		CheckError(m_pWrapper->m_WrapperTable.m_ImplicitEvaluator_EvaluateBounds(m_pHandle, (Lib3MF_uint64)InputMinimaBuffer.size(), InputMinimaBuffer.data(), (Lib3MF_uint64)InputMaximaBuffer.size(), InputMaximaBuffer.data(), elementsNeededOutputMinima, &elementsWrittenOutputMinima, OutputMinimaBuffer.data(), elementsNeededOutputMaxima, &elementsWrittenOutputMaxima, OutputMaximaBuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CFunctionFromImage3D
 	 */
@@ -19069,6 +20090,81 @@ inline CBase* CWrapper::polymorphicFactory(Lib3MFHandle pHandle)
 		CheckError(m_pWrapper->m_WrapperTable.m_FunctionFromImage3D_SetScale(m_pHandle, dScale));
 	}
 	
+	/**
+	* CFunctionFromImage3D::CreateSampler - Creates a sampler, which decodes the sheets of the 3D image on demand. Later changes of the function do not affect the sampler.
+	* @return the sampler
+	*/
+	PImage3DSampler CFunctionFromImage3D::CreateSampler()
+	{
+		Lib3MFHandle hSampler = (Lib3MFHandle)nullptr;
+		CheckError(m_pWrapper->m_WrapperTable.m_FunctionFromImage3D_CreateSampler(m_pHandle, &hSampler));
+		
+		if (!hSampler) {
+			CheckError(LIB3MF_ERROR_INVALIDPARAM);
+		}
+		return std::shared_ptr<CImage3DSampler>(dynamic_cast<CImage3DSampler*>(m_pWrapper->polymorphicFactory(hSampler)));
+	}
+	
+	/**
+	 * Method definitions for class CImage3DSampler
+	 */
+	
+	/**
+	* CImage3DSampler::SetCacheSize - Sets the maximal memory size of the decoded sheets, which are kept for later samples. The most recently used sheet is always kept.
+	* @param[in] nCacheSize - cache size in bytes
+	*/
+	void CImage3DSampler::SetCacheSize(const Lib3MF_uint64 nCacheSize)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Image3DSampler_SetCacheSize(m_pHandle, nCacheSize));
+	}
+	
+	/**
+	* CImage3DSampler::GetCacheSize - Returns the maximal memory size of the decoded sheets.
+	* @return cache size in bytes
+	*/
+	Lib3MF_uint64 CImage3DSampler::GetCacheSize()
+	{
+		Lib3MF_uint64 resultCacheSize = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Image3DSampler_GetCacheSize(m_pHandle, &resultCacheSize));
+		
+		return resultCacheSize;
+	}
+	
+	/**
+	* CImage3DSampler::SetWorkerThreadCount - Sets the number of threads used by Sample. 0 selects the number of hardware threads, 1 (default) samples on the calling thread.
+	* @param[in] nThreadCount - number of threads
+	*/
+	void CImage3DSampler::SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount)
+	{
+		CheckError(m_pWrapper->m_WrapperTable.m_Image3DSampler_SetWorkerThreadCount(m_pHandle, nThreadCount));
+	}
+	
+	/**
+	* CImage3DSampler::GetWorkerThreadCount - Returns the number of threads used by Sample.
+	* @return number of threads
+	*/
+	Lib3MF_uint32 CImage3DSampler::GetWorkerThreadCount()
+	{
+		Lib3MF_uint32 resultThreadCount = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Image3DSampler_GetWorkerThreadCount(m_pHandle, &resultThreadCount));
+		
+		return resultThreadCount;
+	}
+	
+	/**
+	* CImage3DSampler::Sample - Samples the function from image3D at a batch of points. Every point takes the 3 values u, v and w, every result the 4 values red, green, blue and alpha, including offset and scale.
+	* @param[in] UVWBuffer - u, v and w of all points
+	* @param[out] RGBABuffer - red, green, blue and alpha of all points
+	*/
+	void CImage3DSampler::Sample(const CInputVector<Lib3MF_double> & UVWBuffer, std::vector<Lib3MF_double> & RGBABuffer)
+	{
+		Lib3MF_uint64 elementsNeededRGBA = 0;
+		Lib3MF_uint64 elementsWrittenRGBA = 0;
+		CheckError(m_pWrapper->m_WrapperTable.m_Image3DSampler_Sample(m_pHandle, (Lib3MF_uint64)UVWBuffer.size(), UVWBuffer.data(), 0, &elementsNeededRGBA, nullptr));
+		RGBABuffer.resize((size_t) elementsNeededRGBA);
+		CheckError(m_pWrapper->m_WrapperTable.m_Image3DSampler_Sample(m_pHandle, (Lib3MF_uint64)UVWBuffer.size(), UVWBuffer.data(), elementsNeededRGBA, &elementsWrittenRGBA, RGBABuffer.data()));
+	}
+	
 	/**
 	 * Method definitions for class CBuildItem
 	 */
@@ -218,6 +218,25 @@ const (
 	CompositionSpace_LinearColor = 1
 )
 
+// PackagePartType represents a Lib3MF enum.
+type PackagePartType int
+
+const (
+	PackagePartType_Model = 0
+	PackagePartType_Image = 1
+	PackagePartType_Attachment = 2
+)
+
+// CompressionLevel represents a Lib3MF enum.
+type CompressionLevel int
+
+const (
+	CompressionLevel_Stored = 0
+	CompressionLevel_Fastest = 1
+	CompressionLevel_Default = 6
+	CompressionLevel_Maximum = 9
+)
+
 // ImplicitNodeType represents a Lib3MF enum.
 type ImplicitNodeType int
 
@@ -655,6 +674,32 @@ func randomNumberCallback(byteData C.uint64_t, numBytes C.uint64_t, userData C.L
 	randomNumberCallbackFunc(uint64(byteData), uint64(numBytes), uintptr(userData), (*uint64)(bytesWritten))
 }
 
+// VertexBlockCallbackFunc callback to receive a block of vertices of a mesh object while it is read.
+type VertexBlockCallbackFunc = func(uniqueResourceID uint32, startIndex uint32, vertices []Position, userData uintptr)
+
+var vertexBlockCallbackFunc VertexBlockCallbackFunc
+
+//export vertexBlockCallback
+func vertexBlockCallback(uniqueResourceID C.uint32_t, startIndex C.uint32_t, vertices *C.sLib3MFPosition, userData C.Lib3MF_pvoid) {
+	if vertexBlockCallbackFunc == nil {
+		return
+	}
+	vertexBlockCallbackFunc(uint32(uniqueResourceID), uint32(startIndex), *(*[]Position)(unsafe.Pointer(vertices)), uintptr(userData))
+}
+
+// TriangleBlockCallbackFunc callback to receive a block of triangles of a mesh object while it is read.
+type TriangleBlockCallbackFunc = func(uniqueResourceID uint32, startIndex uint32, triangles []Triangle, userData uintptr)
+
+var triangleBlockCallbackFunc TriangleBlockCallbackFunc
+
+//export triangleBlockCallback
+func triangleBlockCallback(uniqueResourceID C.uint32_t, startIndex C.uint32_t, triangles *C.sLib3MFTriangle, userData C.Lib3MF_pvoid) {
+	if triangleBlockCallbackFunc == nil {
+		return
+	}
+	triangleBlockCallbackFunc(uint32(uniqueResourceID), uint32(startIndex), *(*[]Triangle)(unsafe.Pointer(triangles)), uintptr(userData))
+}
+
 // KeyWrappingCallbackFunc a callback used to wrap (encrypt) the content key available in keystore resource group.
 type KeyWrappingCallbackFunc = func(kEKParams AccessRight, inBuffer []uint8, outBuffer []uint8, userData uintptr, status *uint64)
 
@@ -812,6 +857,63 @@ func (inst Writer) SetDecimalPrecision(decimalPrecision uint32) error {
 	return nil
 }
 
+// SetShortestRoundtripActive activates (deactivates) the shortest round-trip output of mesh coordinates and radii. Each value is written with the fewest digits that read back as exactly the same number; the decimal precision is ignored while active.
+func (inst Writer) SetShortestRoundtripActive(shortestRoundtripActive bool) error {
+	ret := C.CCall_lib3mf_writer_setshortestroundtripactive(inst.wrapperRef.LibraryHandle, inst.Ref, C.bool(shortestRoundtripActive))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetShortestRoundtripActive queries whether the shortest round-trip output of mesh coordinates and radii is active or not.
+func (inst Writer) GetShortestRoundtripActive() (bool, error) {
+	var shortestRoundtripActive C.bool
+	ret := C.CCall_lib3mf_writer_getshortestroundtripactive(inst.wrapperRef.LibraryHandle, inst.Ref, &shortestRoundtripActive)
+	if ret != 0 {
+		return false, makeError(uint32(ret))
+	}
+	return bool(shortestRoundtripActive), nil
+}
+
+// SetWorkerThreadCount sets the number of threads the writer may use to compress package parts and to render large meshes. 0 selects the number of hardware threads, 1 disables parallel writing.
+func (inst Writer) SetWorkerThreadCount(threadCount uint32) error {
+	ret := C.CCall_lib3mf_writer_setworkerthreadcount(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint32_t(threadCount))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetWorkerThreadCount returns the number of threads the writer may use to compress package parts and to render large meshes.
+func (inst Writer) GetWorkerThreadCount() (uint32, error) {
+	var threadCount C.uint32_t
+	ret := C.CCall_lib3mf_writer_getworkerthreadcount(inst.wrapperRef.LibraryHandle, inst.Ref, &threadCount)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(threadCount), nil
+}
+
+// SetCompressionLevel sets the compression of all parts of a kind. Already compressed images are best stored without compression.
+func (inst Writer) SetCompressionLevel(partType PackagePartType, level CompressionLevel) error {
+	ret := C.CCall_lib3mf_writer_setcompressionlevel(inst.wrapperRef.LibraryHandle, inst.Ref, C.eLib3MFPackagePartType(partType), C.eLib3MFCompressionLevel(level))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetCompressionLevel returns the compression of all parts of a kind.
+func (inst Writer) GetCompressionLevel(partType PackagePartType) (CompressionLevel, error) {
+	var level C.eLib3MFCompressionLevel
+	ret := C.CCall_lib3mf_writer_getcompressionlevel(inst.wrapperRef.LibraryHandle, inst.Ref, C.eLib3MFPackagePartType(partType), &level)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return CompressionLevel(level), nil
+}
+
 // SetStrictModeActive activates (deactivates) the strict mode of the reader.
 func (inst Writer) SetStrictModeActive(strictModeActive bool) error {
 	ret := C.CCall_lib3mf_writer_setstrictmodeactive(inst.wrapperRef.LibraryHandle, inst.Ref, C.bool(strictModeActive))
@@ -965,6 +1067,55 @@ func (inst Reader) GetStrictModeActive() (bool, error) {
 	return bool(strictModeActive), nil
 }
 
+// SetWorkerThreadCount sets the number of threads the reader may use to decode mesh data. 0 selects the number of hardware threads. With 1 (the default), vertex and triangle lists are still decoded by the streaming mesh decoder, but on the calling thread only.
+func (inst Reader) SetWorkerThreadCount(threadCount uint32) error {
+	ret := C.CCall_lib3mf_reader_setworkerthreadcount(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint32_t(threadCount))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetWorkerThreadCount returns the number of threads the reader may use to decode mesh data.
+func (inst Reader) GetWorkerThreadCount() (uint32, error) {
+	var threadCount C.uint32_t
+	ret := C.CCall_lib3mf_reader_getworkerthreadcount(inst.wrapperRef.LibraryHandle, inst.Ref, &threadCount)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(threadCount), nil
+}
+
+// SetMeshStreamCallbacks hands the vertices and triangles of all mesh objects to callbacks in blocks while they are read. Blocks of one mesh object are delivered in document order, and vertices are delivered before the triangles that refer to them. If the geometry is not retained, the meshes of the read model stay empty, while objects, components and build items are still read. Beam lattices and triangle sets require the geometry to be retained.
+func (inst Reader) SetMeshStreamCallbacks(theVertexBlockCallback VertexBlockCallbackFunc, theTriangleBlockCallback TriangleBlockCallbackFunc, retainGeometry bool, userData uintptr) error {
+	ret := C.CCall_lib3mf_reader_setmeshstreamcallbacks(inst.wrapperRef.LibraryHandle, inst.Ref, (C.Lib3MFVertexBlockCallback)(unsafe.Pointer(&theVertexBlockCallback)), (C.Lib3MFTriangleBlockCallback)(unsafe.Pointer(&theTriangleBlockCallback)), C.bool(retainGeometry), (C.Lib3MF_pvoid)(userData))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	vertexBlockCallbackFunc = theVertexBlockCallback
+	triangleBlockCallbackFunc = theTriangleBlockCallback
+	return nil
+}
+
+// SetLazyMeshLoadingActive defers parsing the geometry of mesh objects until it is first accessed. The model part is kept in memory after reading, and each mesh is parsed from it on first access. Ignored if mesh stream callbacks are set.
+func (inst Reader) SetLazyMeshLoadingActive(lazyMeshLoadingActive bool) error {
+	ret := C.CCall_lib3mf_reader_setlazymeshloadingactive(inst.wrapperRef.LibraryHandle, inst.Ref, C.bool(lazyMeshLoadingActive))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetLazyMeshLoadingActive returns whether mesh geometry is parsed on first access.
+func (inst Reader) GetLazyMeshLoadingActive() (bool, error) {
+	var lazyMeshLoadingActive C.bool
+	ret := C.CCall_lib3mf_reader_getlazymeshloadingactive(inst.wrapperRef.LibraryHandle, inst.Ref, &lazyMeshLoadingActive)
+	if ret != 0 {
+		return false, makeError(uint32(ret))
+	}
+	return bool(lazyMeshLoadingActive), nil
+}
+
 // GetWarning returns Warning and Error Information of the read process.
 func (inst Reader) GetWarning(index uint32) (uint32, string, error) {
 	var errorCode C.uint32_t
@@ -1013,6 +1164,70 @@ func (inst Reader) SetContentEncryptionCallback(theCallback ContentEncryptionCal
 	return nil
 }
 
+// StreamingWriter represents a Lib3MF class.
+type StreamingWriter struct {
+	Base
+}
+
+func (wrapper Wrapper) NewStreamingWriter(r ref) StreamingWriter {
+	return StreamingWriter{wrapper.NewBase(r)}
+}
+
+// BeginMeshObject starts a new mesh object. All of its vertices must be added before its triangles.
+func (inst StreamingWriter) BeginMeshObject(name string) (uint32, error) {
+	var objectID C.uint32_t
+	ret := C.CCall_lib3mf_streamingwriter_beginmeshobject(inst.wrapperRef.LibraryHandle, inst.Ref, (*C.char)(unsafe.Pointer(&[]byte(name)[0])), &objectID)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(objectID), nil
+}
+
+// AddVertices writes a batch of vertices of the current mesh object. Vertex indices continue over all batches of the object.
+func (inst StreamingWriter) AddVertices(vertices []Position) error {
+	ret := C.CCall_lib3mf_streamingwriter_addvertices(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint64_t(len(vertices)), (*C.sLib3MFPosition)(unsafe.Pointer(&vertices[0])))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// AddTriangles writes a batch of triangles of the current mesh object. No further vertices may be added to the object afterwards.
+func (inst StreamingWriter) AddTriangles(indices []Triangle) error {
+	ret := C.CCall_lib3mf_streamingwriter_addtriangles(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint64_t(len(indices)), (*C.sLib3MFTriangle)(unsafe.Pointer(&indices[0])))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// EndMeshObject finishes the current mesh object.
+func (inst StreamingWriter) EndMeshObject() error {
+	ret := C.CCall_lib3mf_streamingwriter_endmeshobject(inst.wrapperRef.LibraryHandle, inst.Ref)
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// AddBuildItem adds a build item. It is written when the package is finished.
+func (inst StreamingWriter) AddBuildItem(objectID uint32, transform Transform) error {
+	ret := C.CCall_lib3mf_streamingwriter_addbuilditem(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint32_t(objectID), (*C.sLib3MFTransform)(unsafe.Pointer(&transform)))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// Finish writes the build items and closes the package. No further calls are allowed afterwards.
+func (inst StreamingWriter) Finish() error {
+	ret := C.CCall_lib3mf_streamingwriter_finish(inst.wrapperRef.LibraryHandle, inst.Ref)
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
 
 // PackagePart represents a Lib3MF class.
 type PackagePart struct {
@@ -2132,6 +2347,28 @@ func (inst MeshObject) GetVertices(vertices []Position) ([]Position, error) {
 	return vertices[:int(neededforvertices)], nil
 }
 
+// GetVertexPageCount returns the number of pages in which the vertices of the mesh object are stored.
+func (inst MeshObject) GetVertexPageCount() (uint32, error) {
+	var pageCount C.uint32_t
+	ret := C.CCall_lib3mf_meshobject_getvertexpagecount(inst.wrapperRef.LibraryHandle, inst.Ref, &pageCount)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(pageCount), nil
+}
+
+// GetVertexPage returns direct read access to a page of vertices without copying them. The memory is owned by the mesh object, must not be written to and is only valid until the mesh is modified or released.
+func (inst MeshObject) GetVertexPage(pageIndex uint32) (uint32, uint32, uintptr, error) {
+	var vertexCount C.uint32_t
+	var stride C.uint32_t
+	var coordinates C.Lib3MF_pvoid
+	ret := C.CCall_lib3mf_meshobject_getvertexpage(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint32_t(pageIndex), &vertexCount, &stride, &coordinates)
+	if ret != 0 {
+		return 0, 0, 0, makeError(uint32(ret))
+	}
+	return uint32(vertexCount), uint32(stride), uintptr(coordinates), nil
+}
+
 // GetTriangle returns indices of a single triangle of a mesh object.
 func (inst MeshObject) GetTriangle(index uint32) (Triangle, error) {
 	var indices C.sLib3MFTriangle
@@ -2178,6 +2415,28 @@ func (inst MeshObject) GetTriangleIndices(indices []Triangle) ([]Triangle, error
 	return indices[:int(neededforindices)], nil
 }
 
+// GetTrianglePageCount returns the number of pages in which the triangles of the mesh object are stored.
+func (inst MeshObject) GetTrianglePageCount() (uint32, error) {
+	var pageCount C.uint32_t
+	ret := C.CCall_lib3mf_meshobject_gettrianglepagecount(inst.wrapperRef.LibraryHandle, inst.Ref, &pageCount)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(pageCount), nil
+}
+
+// GetTrianglePage returns direct read access to a page of triangles without copying them. The memory is owned by the mesh object, must not be written to and is only valid until the mesh is modified or released.
+func (inst MeshObject) GetTrianglePage(pageIndex uint32) (uint32, uint32, uintptr, error) {
+	var triangleCount C.uint32_t
+	var stride C.uint32_t
+	var indices C.Lib3MF_pvoid
+	ret := C.CCall_lib3mf_meshobject_gettrianglepage(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint32_t(pageIndex), &triangleCount, &stride, &indices)
+	if ret != 0 {
+		return 0, 0, 0, makeError(uint32(ret))
+	}
+	return uint32(triangleCount), uint32(stride), uintptr(indices), nil
+}
+
 // SetObjectLevelProperty sets the property at the object-level of the mesh object.
 func (inst MeshObject) SetObjectLevelProperty(uniqueResourceID uint32, propertyID uint32) error {
 	ret := C.CCall_lib3mf_meshobject_setobjectlevelproperty(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint32_t(uniqueResourceID), C.uint32_t(propertyID))
@@ -2262,6 +2521,15 @@ func (inst MeshObject) SetGeometry(vertices []Position, indices []Triangle) erro
 	return nil
 }
 
+// ReserveGeometry preallocates memory for the given total numbers of vertices, triangles and beams, so that they can be added without further allocations.
+func (inst MeshObject) ReserveGeometry(vertexCount uint32, triangleCount uint32, beamCount uint32) error {
+	ret := C.CCall_lib3mf_meshobject_reservegeometry(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint32_t(vertexCount), C.uint32_t(triangleCount), C.uint32_t(beamCount))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
 // IsManifoldAndOriented retrieves, if an object describes a topologically oriented and manifold mesh, according to the core spec.
 func (inst MeshObject) IsManifoldAndOriented() (bool, error) {
 	var isManifoldAndOriented C.bool
@@ -2272,6 +2540,16 @@ func (inst MeshObject) IsManifoldAndOriented() (bool, error) {
 	return bool(isManifoldAndOriented), nil
 }
 
+// IsGeometryLoaded retrieves, if the geometry of an object has been loaded. Meshes read with lazy mesh loading are only loaded when their geometry is accessed for the first time.
+func (inst MeshObject) IsGeometryLoaded() (bool, error) {
+	var isGeometryLoaded C.bool
+	ret := C.CCall_lib3mf_meshobject_isgeometryloaded(inst.wrapperRef.LibraryHandle, inst.Ref, &isGeometryLoaded)
+	if ret != 0 {
+		return false, makeError(uint32(ret))
+	}
+	return bool(isGeometryLoaded), nil
+}
+
 // BeamLattice retrieves the BeamLattice within this MeshObject.
 func (inst MeshObject) BeamLattice() (BeamLattice, error) {
 	var theBeamLattice ref
@@ -6461,6 +6739,119 @@ func (inst ImplicitFunction) SortNodesTopologically() error {
 	return nil
 }
 
+// CreateEvaluator compiles the function into an evaluator. Later changes of the function do not affect the evaluator.
+func (inst ImplicitFunction) CreateEvaluator() (ImplicitEvaluator, error) {
+	var evaluator ref
+	ret := C.CCall_lib3mf_implicitfunction_createevaluator(inst.wrapperRef.LibraryHandle, inst.Ref, &evaluator)
+	if ret != 0 {
+		return ImplicitEvaluator{}, makeError(uint32(ret))
+	}
+	return inst.wrapperRef.NewImplicitEvaluator(evaluator), nil
+}
+
+// ImplicitEvaluator represents a Lib3MF class.
+type ImplicitEvaluator struct {
+	Base
+}
+
+func (wrapper Wrapper) NewImplicitEvaluator(r ref) ImplicitEvaluator {
+	return ImplicitEvaluator{wrapper.NewBase(r)}
+}
+
+// GetInputStride returns the number of input values per point. Vector inputs take 3 values, matrix inputs 16.
+func (inst ImplicitEvaluator) GetInputStride() (uint32, error) {
+	var stride C.uint32_t
+	ret := C.CCall_lib3mf_implicitevaluator_getinputstride(inst.wrapperRef.LibraryHandle, inst.Ref, &stride)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(stride), nil
+}
+
+// GetOutputStride returns the number of output values per point. Vector outputs take 3 values, matrix outputs 16.
+func (inst ImplicitEvaluator) GetOutputStride() (uint32, error) {
+	var stride C.uint32_t
+	ret := C.CCall_lib3mf_implicitevaluator_getoutputstride(inst.wrapperRef.LibraryHandle, inst.Ref, &stride)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(stride), nil
+}
+
+// SetWorkerThreadCount sets the number of threads used by Evaluate. 0 selects the number of hardware threads, 1 (default) evaluates on the calling thread.
+func (inst ImplicitEvaluator) SetWorkerThreadCount(threadCount uint32) error {
+	ret := C.CCall_lib3mf_implicitevaluator_setworkerthreadcount(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint32_t(threadCount))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetWorkerThreadCount returns the number of threads used by Evaluate.
+func (inst ImplicitEvaluator) GetWorkerThreadCount() (uint32, error) {
+	var threadCount C.uint32_t
+	ret := C.CCall_lib3mf_implicitevaluator_getworkerthreadcount(inst.wrapperRef.LibraryHandle, inst.Ref, &threadCount)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(threadCount), nil
+}
+
+// Evaluate evaluates the function for a batch of points. The input values of all function inputs of a point are stored consecutively, followed by the next point.
+func (inst ImplicitEvaluator) Evaluate(inputs []float64, outputs []float64) ([]float64, error) {
+	var neededforoutputs C.uint64_t
+	ret := C.CCall_lib3mf_implicitevaluator_evaluate(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint64_t(len(inputs)), (*C.double)(unsafe.Pointer(&inputs[0])), 0, &neededforoutputs, nil)
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	if len(outputs) < int(neededforoutputs) {
+	 outputs = append(outputs, make([]float64, int(neededforoutputs)-len(outputs))...)
+	}
+	ret = C.CCall_lib3mf_implicitevaluator_evaluate(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint64_t(len(inputs)), (*C.double)(unsafe.Pointer(&inputs[0])), neededforoutputs, nil, (*C.double)(unsafe.Pointer(&outputs[0])))
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	return outputs[:int(neededforoutputs)], nil
+}
+
+// EvaluateBatch evaluates the function for a batch of points in structure-of-arrays layout. The values of the first input component of all points are stored consecutively, followed by the values of the next component. The outputs are returned in the same layout.
+func (inst ImplicitEvaluator) EvaluateBatch(inputs []float64, outputs []float64) ([]float64, error) {
+	var neededforoutputs C.uint64_t
+	ret := C.CCall_lib3mf_implicitevaluator_evaluatebatch(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint64_t(len(inputs)), (*C.double)(unsafe.Pointer(&inputs[0])), 0, &neededforoutputs, nil)
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	if len(outputs) < int(neededforoutputs) {
+	 outputs = append(outputs, make([]float64, int(neededforoutputs)-len(outputs))...)
+	}
+	ret = C.CCall_lib3mf_implicitevaluator_evaluatebatch(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint64_t(len(inputs)), (*C.double)(unsafe.Pointer(&inputs[0])), neededforoutputs, nil, (*C.double)(unsafe.Pointer(&outputs[0])))
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	return outputs[:int(neededforoutputs)], nil
+}
+
+// EvaluateBounds computes bounds of the function outputs for boxes of input values. Every box is given by the minimal and maximal value of each input component, stored like the points of Evaluate. The bounds contain all output values within the box, but are not necessarily tight. Unbounded outputs are reported as infinite.
+func (inst ImplicitEvaluator) EvaluateBounds(inputMinima []float64, inputMaxima []float64, outputMinima []float64, outputMaxima []float64) ([]float64, []float64, error) {
+	var neededforoutputMinima C.uint64_t
+	var neededforoutputMaxima C.uint64_t
+	ret := C.CCall_lib3mf_implicitevaluator_evaluatebounds(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint64_t(len(inputMinima)), (*C.double)(unsafe.Pointer(&inputMinima[0])), C.uint64_t(len(inputMaxima)), (*C.double)(unsafe.Pointer(&inputMaxima[0])), 0, &neededforoutputMinima, nil, 0, &neededforoutputMaxima, nil)
+	if ret != 0 {
+		return nil, nil, makeError(uint32(ret))
+	}
+	if len(outputMinima) < int(neededforoutputMinima) {
+	 outputMinima = append(outputMinima, make([]float64, int(neededforoutputMinima)-len(outputMinima))...)
+	}
+	if len(outputMaxima) < int(neededforoutputMaxima) {
+	 outputMaxima = append(outputMaxima, make([]float64, int(neededforoutputMaxima)-len(outputMaxima))...)
+	}
+	ret = C.CCall_lib3mf_implicitevaluator_evaluatebounds(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint64_t(len(inputMinima)), (*C.double)(unsafe.Pointer(&inputMinima[0])), C.uint64_t(len(inputMaxima)), (*C.double)(unsafe.Pointer(&inputMaxima[0])), neededforoutputMinima, nil, (*C.double)(unsafe.Pointer(&outputMinima[0])), neededforoutputMaxima, nil, (*C.double)(unsafe.Pointer(&outputMaxima[0])))
+	if ret != 0 {
+		return nil, nil, makeError(uint32(ret))
+	}
+	return outputMinima[:int(neededforoutputMinima)], outputMaxima[:int(neededforoutputMaxima)], nil
+}
+
 
 // FunctionFromImage3D represents a Lib3MF class.
 type FunctionFromImage3D struct {
@@ -6568,6 +6959,80 @@ func (inst FunctionFromImage3D) SetScale(scale float64) error {
 	return nil
 }
 
+// CreateSampler creates a sampler, which decodes the sheets of the 3D image on demand. Later changes of the function do not affect the sampler.
+func (inst FunctionFromImage3D) CreateSampler() (Image3DSampler, error) {
+	var sampler ref
+	ret := C.CCall_lib3mf_functionfromimage3d_createsampler(inst.wrapperRef.LibraryHandle, inst.Ref, &sampler)
+	if ret != 0 {
+		return Image3DSampler{}, makeError(uint32(ret))
+	}
+	return inst.wrapperRef.NewImage3DSampler(sampler), nil
+}
+
+// Image3DSampler represents a Lib3MF class.
+type Image3DSampler struct {
+	Base
+}
+
+func (wrapper Wrapper) NewImage3DSampler(r ref) Image3DSampler {
+	return Image3DSampler{wrapper.NewBase(r)}
+}
+
+// SetCacheSize sets the maximal memory size of the decoded sheets, which are kept for later samples. The most recently used sheet is always kept.
+func (inst Image3DSampler) SetCacheSize(cacheSize uint64) error {
+	ret := C.CCall_lib3mf_image3dsampler_setcachesize(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint64_t(cacheSize))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetCacheSize returns the maximal memory size of the decoded sheets.
+func (inst Image3DSampler) GetCacheSize() (uint64, error) {
+	var cacheSize C.uint64_t
+	ret := C.CCall_lib3mf_image3dsampler_getcachesize(inst.wrapperRef.LibraryHandle, inst.Ref, &cacheSize)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint64(cacheSize), nil
+}
+
+// SetWorkerThreadCount sets the number of threads used by Sample. 0 selects the number of hardware threads, 1 (default) samples on the calling thread.
+func (inst Image3DSampler) SetWorkerThreadCount(threadCount uint32) error {
+	ret := C.CCall_lib3mf_image3dsampler_setworkerthreadcount(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint32_t(threadCount))
+	if ret != 0 {
+		return makeError(uint32(ret))
+	}
+	return nil
+}
+
+// GetWorkerThreadCount returns the number of threads used by Sample.
+func (inst Image3DSampler) GetWorkerThreadCount() (uint32, error) {
+	var threadCount C.uint32_t
+	ret := C.CCall_lib3mf_image3dsampler_getworkerthreadcount(inst.wrapperRef.LibraryHandle, inst.Ref, &threadCount)
+	if ret != 0 {
+		return 0, makeError(uint32(ret))
+	}
+	return uint32(threadCount), nil
+}
+
+// Sample samples the function from image3D at a batch of points. Every point takes the 3 values u, v and w, every result the 4 values red, green, blue and alpha, including offset and scale.
+func (inst Image3DSampler) Sample(uVW []float64, rGBA []float64) ([]float64, error) {
+	var neededforrGBA C.uint64_t
+	ret := C.CCall_lib3mf_image3dsampler_sample(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint64_t(len(uVW)), (*C.double)(unsafe.Pointer(&uVW[0])), 0, &neededforrGBA, nil)
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	if len(rGBA) < int(neededforrGBA) {
+	 rGBA = append(rGBA, make([]float64, int(neededforrGBA)-len(rGBA))...)
+	}
+	ret = C.CCall_lib3mf_image3dsampler_sample(inst.wrapperRef.LibraryHandle, inst.Ref, C.uint64_t(len(uVW)), (*C.double)(unsafe.Pointer(&uVW[0])), neededforrGBA, nil, (*C.double)(unsafe.Pointer(&rGBA[0])))
+	if ret != 0 {
+		return nil, makeError(uint32(ret))
+	}
+	return rGBA[:int(neededforrGBA)], nil
+}
+
 
 // BuildItem represents a Lib3MF class.
 type BuildItem struct {
@@ -8350,6 +8815,16 @@ func (wrapper Wrapper) CreateModel() (Model, error) {
 	return wrapper.NewModel(model), nil
 }
 
+// CreateStreamingWriter creates a writer, which streams mesh objects into a new 3MF file while they are generated.
+func (wrapper Wrapper) CreateStreamingWriter(filename string, unit ModelUnit) (StreamingWriter, error) {
+	var streamingWriter ref
+	ret := C.CCall_lib3mf_createstreamingwriter(wrapper.LibraryHandle, (*C.char)(unsafe.Pointer(&[]byte(filename)[0])), C.eLib3MFModelUnit(unit), &streamingWriter)
+	if ret != 0 {
+		return StreamingWriter{}, makeError(uint32(ret))
+	}
+	return wrapper.NewStreamingWriter(streamingWriter), nil
+}
+
 // Release releases shared ownership of an object instance.
 func (wrapper Wrapper) Release(instance Base) error {
 	ret := C.CCall_lib3mf_release(wrapper.LibraryHandle, instance.Ref)
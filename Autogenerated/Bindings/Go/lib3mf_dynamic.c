@@ -56,6 +56,12 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_Writer_SetProgressCallback = NULL;
 	pWrapperTable->m_Writer_GetDecimalPrecision = NULL;
 	pWrapperTable->m_Writer_SetDecimalPrecision = NULL;
+	pWrapperTable->m_Writer_SetShortestRoundtripActive = NULL;
+	pWrapperTable->m_Writer_GetShortestRoundtripActive = NULL;
+	pWrapperTable->m_Writer_SetWorkerThreadCount = NULL;
+	pWrapperTable->m_Writer_GetWorkerThreadCount = NULL;
+	pWrapperTable->m_Writer_SetCompressionLevel = NULL;
+	pWrapperTable->m_Writer_GetCompressionLevel = NULL;
 	pWrapperTable->m_Writer_SetStrictModeActive = NULL;
 	pWrapperTable->m_Writer_GetStrictModeActive = NULL;
 	pWrapperTable->m_Writer_GetWarning = NULL;
@@ -70,10 +76,21 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_Reader_RemoveRelationToRead = NULL;
 	pWrapperTable->m_Reader_SetStrictModeActive = NULL;
 	pWrapperTable->m_Reader_GetStrictModeActive = NULL;
+	pWrapperTable->m_Reader_SetWorkerThreadCount = NULL;
+	pWrapperTable->m_Reader_GetWorkerThreadCount = NULL;
+	pWrapperTable->m_Reader_SetMeshStreamCallbacks = NULL;
+	pWrapperTable->m_Reader_SetLazyMeshLoadingActive = NULL;
+	pWrapperTable->m_Reader_GetLazyMeshLoadingActive = NULL;
 	pWrapperTable->m_Reader_GetWarning = NULL;
 	pWrapperTable->m_Reader_GetWarningCount = NULL;
 	pWrapperTable->m_Reader_AddKeyWrappingCallback = NULL;
 	pWrapperTable->m_Reader_SetContentEncryptionCallback = NULL;
+	pWrapperTable->m_StreamingWriter_BeginMeshObject = NULL;
+	pWrapperTable->m_StreamingWriter_AddVertices = NULL;
+	pWrapperTable->m_StreamingWriter_AddTriangles = NULL;
+	pWrapperTable->m_StreamingWriter_EndMeshObject = NULL;
+	pWrapperTable->m_StreamingWriter_AddBuildItem = NULL;
+	pWrapperTable->m_StreamingWriter_Finish = NULL;
 	pWrapperTable->m_PackagePart_GetPath = NULL;
 	pWrapperTable->m_PackagePart_SetPath = NULL;
 	pWrapperTable->m_Resource_GetResourceID = NULL;
@@ -158,10 +175,14 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_MeshObject_SetVertex = NULL;
 	pWrapperTable->m_MeshObject_AddVertex = NULL;
 	pWrapperTable->m_MeshObject_GetVertices = NULL;
+	pWrapperTable->m_MeshObject_GetVertexPageCount = NULL;
+	pWrapperTable->m_MeshObject_GetVertexPage = NULL;
 	pWrapperTable->m_MeshObject_GetTriangle = NULL;
 	pWrapperTable->m_MeshObject_SetTriangle = NULL;
 	pWrapperTable->m_MeshObject_AddTriangle = NULL;
 	pWrapperTable->m_MeshObject_GetTriangleIndices = NULL;
+	pWrapperTable->m_MeshObject_GetTrianglePageCount = NULL;
+	pWrapperTable->m_MeshObject_GetTrianglePage = NULL;
 	pWrapperTable->m_MeshObject_SetObjectLevelProperty = NULL;
 	pWrapperTable->m_MeshObject_GetObjectLevelProperty = NULL;
 	pWrapperTable->m_MeshObject_SetTriangleProperties = NULL;
@@ -170,7 +191,9 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_MeshObject_GetAllTriangleProperties = NULL;
 	pWrapperTable->m_MeshObject_ClearAllProperties = NULL;
 	pWrapperTable->m_MeshObject_SetGeometry = NULL;
+	pWrapperTable->m_MeshObject_ReserveGeometry = NULL;
 	pWrapperTable->m_MeshObject_IsManifoldAndOriented = NULL;
+	pWrapperTable->m_MeshObject_IsGeometryLoaded = NULL;
 	pWrapperTable->m_MeshObject_BeamLattice = NULL;
 	pWrapperTable->m_MeshObject_GetVolumeData = NULL;
 	pWrapperTable->m_MeshObject_SetVolumeData = NULL;
@@ -492,6 +515,14 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_ImplicitFunction_AddLinkByNames = NULL;
 	pWrapperTable->m_ImplicitFunction_Clear = NULL;
 	pWrapperTable->m_ImplicitFunction_SortNodesTopologically = NULL;
+	pWrapperTable->m_ImplicitFunction_CreateEvaluator = NULL;
+	pWrapperTable->m_ImplicitEvaluator_GetInputStride = NULL;
+	pWrapperTable->m_ImplicitEvaluator_GetOutputStride = NULL;
+	pWrapperTable->m_ImplicitEvaluator_SetWorkerThreadCount = NULL;
+	pWrapperTable->m_ImplicitEvaluator_GetWorkerThreadCount = NULL;
+	pWrapperTable->m_ImplicitEvaluator_Evaluate = NULL;
+	pWrapperTable->m_ImplicitEvaluator_EvaluateBatch = NULL;
+	pWrapperTable->m_ImplicitEvaluator_EvaluateBounds = NULL;
 	pWrapperTable->m_FunctionFromImage3D_GetImage3D = NULL;
 	pWrapperTable->m_FunctionFromImage3D_SetImage3D = NULL;
 	pWrapperTable->m_FunctionFromImage3D_SetFilter = NULL;
@@ -502,6 +533,12 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_FunctionFromImage3D_SetOffset = NULL;
 	pWrapperTable->m_FunctionFromImage3D_GetScale = NULL;
 	pWrapperTable->m_FunctionFromImage3D_SetScale = NULL;
+	pWrapperTable->m_FunctionFromImage3D_CreateSampler = NULL;
+	pWrapperTable->m_Image3DSampler_SetCacheSize = NULL;
+	pWrapperTable->m_Image3DSampler_GetCacheSize = NULL;
+	pWrapperTable->m_Image3DSampler_SetWorkerThreadCount = NULL;
+	pWrapperTable->m_Image3DSampler_GetWorkerThreadCount = NULL;
+	pWrapperTable->m_Image3DSampler_Sample = NULL;
 	pWrapperTable->m_BuildItem_GetObjectResource = NULL;
 	pWrapperTable->m_BuildItem_GetUUID = NULL;
 	pWrapperTable->m_BuildItem_SetUUID = NULL;
@@ -654,6 +691,7 @@ Lib3MFResult InitLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable)
 	pWrapperTable->m_GetBuildInformation = NULL;
 	pWrapperTable->m_GetSpecificationVersion = NULL;
 	pWrapperTable->m_CreateModel = NULL;
+	pWrapperTable->m_CreateStreamingWriter = NULL;
 	pWrapperTable->m_Release = NULL;
 	pWrapperTable->m_Acquire = NULL;
 	pWrapperTable->m_SetJournal = NULL;
@@ -794,6 +832,60 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_Writer_SetDecimalPrecision == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_SetShortestRoundtripActive = (PLib3MFWriter_SetShortestRoundtripActivePtr) GetProcAddress(hLibrary, "lib3mf_writer_setshortestroundtripactive");
+	#else // _WIN32
+	pWrapperTable->m_Writer_SetShortestRoundtripActive = (PLib3MFWriter_SetShortestRoundtripActivePtr) dlsym(hLibrary, "lib3mf_writer_setshortestroundtripactive");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_SetShortestRoundtripActive == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_GetShortestRoundtripActive = (PLib3MFWriter_GetShortestRoundtripActivePtr) GetProcAddress(hLibrary, "lib3mf_writer_getshortestroundtripactive");
+	#else // _WIN32
+	pWrapperTable->m_Writer_GetShortestRoundtripActive = (PLib3MFWriter_GetShortestRoundtripActivePtr) dlsym(hLibrary, "lib3mf_writer_getshortestroundtripactive");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_GetShortestRoundtripActive == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_SetWorkerThreadCount = (PLib3MFWriter_SetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_writer_setworkerthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Writer_SetWorkerThreadCount = (PLib3MFWriter_SetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_writer_setworkerthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_SetWorkerThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_GetWorkerThreadCount = (PLib3MFWriter_GetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_writer_getworkerthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Writer_GetWorkerThreadCount = (PLib3MFWriter_GetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_writer_getworkerthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_GetWorkerThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_SetCompressionLevel = (PLib3MFWriter_SetCompressionLevelPtr) GetProcAddress(hLibrary, "lib3mf_writer_setcompressionlevel");
+	#else // _WIN32
+	pWrapperTable->m_Writer_SetCompressionLevel = (PLib3MFWriter_SetCompressionLevelPtr) dlsym(hLibrary, "lib3mf_writer_setcompressionlevel");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_SetCompressionLevel == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Writer_GetCompressionLevel = (PLib3MFWriter_GetCompressionLevelPtr) GetProcAddress(hLibrary, "lib3mf_writer_getcompressionlevel");
+	#else // _WIN32
+	pWrapperTable->m_Writer_GetCompressionLevel = (PLib3MFWriter_GetCompressionLevelPtr) dlsym(hLibrary, "lib3mf_writer_getcompressionlevel");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Writer_GetCompressionLevel == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_Writer_SetStrictModeActive = (PLib3MFWriter_SetStrictModeActivePtr) GetProcAddress(hLibrary, "lib3mf_writer_setstrictmodeactive");
 	#else // _WIN32
@@ -920,6 +1012,51 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_Reader_GetStrictModeActive == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_SetWorkerThreadCount = (PLib3MFReader_SetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_reader_setworkerthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Reader_SetWorkerThreadCount = (PLib3MFReader_SetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_reader_setworkerthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_SetWorkerThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_GetWorkerThreadCount = (PLib3MFReader_GetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_reader_getworkerthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Reader_GetWorkerThreadCount = (PLib3MFReader_GetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_reader_getworkerthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_GetWorkerThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_SetMeshStreamCallbacks = (PLib3MFReader_SetMeshStreamCallbacksPtr) GetProcAddress(hLibrary, "lib3mf_reader_setmeshstreamcallbacks");
+	#else // _WIN32
+	pWrapperTable->m_Reader_SetMeshStreamCallbacks = (PLib3MFReader_SetMeshStreamCallbacksPtr) dlsym(hLibrary, "lib3mf_reader_setmeshstreamcallbacks");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_SetMeshStreamCallbacks == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_SetLazyMeshLoadingActive = (PLib3MFReader_SetLazyMeshLoadingActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_setlazymeshloadingactive");
+	#else // _WIN32
+	pWrapperTable->m_Reader_SetLazyMeshLoadingActive = (PLib3MFReader_SetLazyMeshLoadingActivePtr) dlsym(hLibrary, "lib3mf_reader_setlazymeshloadingactive");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_SetLazyMeshLoadingActive == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Reader_GetLazyMeshLoadingActive = (PLib3MFReader_GetLazyMeshLoadingActivePtr) GetProcAddress(hLibrary, "lib3mf_reader_getlazymeshloadingactive");
+	#else // _WIN32
+	pWrapperTable->m_Reader_GetLazyMeshLoadingActive = (PLib3MFReader_GetLazyMeshLoadingActivePtr) dlsym(hLibrary, "lib3mf_reader_getlazymeshloadingactive");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Reader_GetLazyMeshLoadingActive == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_Reader_GetWarning = (PLib3MFReader_GetWarningPtr) GetProcAddress(hLibrary, "lib3mf_reader_getwarning");
 	#else // _WIN32
@@ -956,6 +1093,60 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_Reader_SetContentEncryptionCallback == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_StreamingWriter_BeginMeshObject = (PLib3MFStreamingWriter_BeginMeshObjectPtr) GetProcAddress(hLibrary, "lib3mf_streamingwriter_beginmeshobject");
+	#else // _WIN32
+	pWrapperTable->m_StreamingWriter_BeginMeshObject = (PLib3MFStreamingWriter_BeginMeshObjectPtr) dlsym(hLibrary, "lib3mf_streamingwriter_beginmeshobject");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_StreamingWriter_BeginMeshObject == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_StreamingWriter_AddVertices = (PLib3MFStreamingWriter_AddVerticesPtr) GetProcAddress(hLibrary, "lib3mf_streamingwriter_addvertices");
+	#else // _WIN32
+	pWrapperTable->m_StreamingWriter_AddVertices = (PLib3MFStreamingWriter_AddVerticesPtr) dlsym(hLibrary, "lib3mf_streamingwriter_addvertices");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_StreamingWriter_AddVertices == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_StreamingWriter_AddTriangles = (PLib3MFStreamingWriter_AddTrianglesPtr) GetProcAddress(hLibrary, "lib3mf_streamingwriter_addtriangles");
+	#else // _WIN32
+	pWrapperTable->m_StreamingWriter_AddTriangles = (PLib3MFStreamingWriter_AddTrianglesPtr) dlsym(hLibrary, "lib3mf_streamingwriter_addtriangles");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_StreamingWriter_AddTriangles == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_StreamingWriter_EndMeshObject = (PLib3MFStreamingWriter_EndMeshObjectPtr) GetProcAddress(hLibrary, "lib3mf_streamingwriter_endmeshobject");
+	#else // _WIN32
+	pWrapperTable->m_StreamingWriter_EndMeshObject = (PLib3MFStreamingWriter_EndMeshObjectPtr) dlsym(hLibrary, "lib3mf_streamingwriter_endmeshobject");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_StreamingWriter_EndMeshObject == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_StreamingWriter_AddBuildItem = (PLib3MFStreamingWriter_AddBuildItemPtr) GetProcAddress(hLibrary, "lib3mf_streamingwriter_addbuilditem");
+	#else // _WIN32
+	pWrapperTable->m_StreamingWriter_AddBuildItem = (PLib3MFStreamingWriter_AddBuildItemPtr) dlsym(hLibrary, "lib3mf_streamingwriter_addbuilditem");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_StreamingWriter_AddBuildItem == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_StreamingWriter_Finish = (PLib3MFStreamingWriter_FinishPtr) GetProcAddress(hLibrary, "lib3mf_streamingwriter_finish");
+	#else // _WIN32
+	pWrapperTable->m_StreamingWriter_Finish = (PLib3MFStreamingWriter_FinishPtr) dlsym(hLibrary, "lib3mf_streamingwriter_finish");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_StreamingWriter_Finish == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_PackagePart_GetPath = (PLib3MFPackagePart_GetPathPtr) GetProcAddress(hLibrary, "lib3mf_packagepart_getpath");
 	#else // _WIN32
@@ -1712,6 +1903,24 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_MeshObject_GetVertices == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_MeshObject_GetVertexPageCount = (PLib3MFMeshObject_GetVertexPageCountPtr) GetProcAddress(hLibrary, "lib3mf_meshobject_getvertexpagecount");
+	#else // _WIN32
+	pWrapperTable->m_MeshObject_GetVertexPageCount = (PLib3MFMeshObject_GetVertexPageCountPtr) dlsym(hLibrary, "lib3mf_meshobject_getvertexpagecount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_MeshObject_GetVertexPageCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_MeshObject_GetVertexPage = (PLib3MFMeshObject_GetVertexPagePtr) GetProcAddress(hLibrary, "lib3mf_meshobject_getvertexpage");
+	#else // _WIN32
+	pWrapperTable->m_MeshObject_GetVertexPage = (PLib3MFMeshObject_GetVertexPagePtr) dlsym(hLibrary, "lib3mf_meshobject_getvertexpage");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_MeshObject_GetVertexPage == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_MeshObject_GetTriangle = (PLib3MFMeshObject_GetTrianglePtr) GetProcAddress(hLibrary, "lib3mf_meshobject_gettriangle");
 	#else // _WIN32
@@ -1748,6 +1957,24 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_MeshObject_GetTriangleIndices == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_MeshObject_GetTrianglePageCount = (PLib3MFMeshObject_GetTrianglePageCountPtr) GetProcAddress(hLibrary, "lib3mf_meshobject_gettrianglepagecount");
+	#else // _WIN32
+	pWrapperTable->m_MeshObject_GetTrianglePageCount = (PLib3MFMeshObject_GetTrianglePageCountPtr) dlsym(hLibrary, "lib3mf_meshobject_gettrianglepagecount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_MeshObject_GetTrianglePageCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_MeshObject_GetTrianglePage = (PLib3MFMeshObject_GetTrianglePagePtr) GetProcAddress(hLibrary, "lib3mf_meshobject_gettrianglepage");
+	#else // _WIN32
+	pWrapperTable->m_MeshObject_GetTrianglePage = (PLib3MFMeshObject_GetTrianglePagePtr) dlsym(hLibrary, "lib3mf_meshobject_gettrianglepage");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_MeshObject_GetTrianglePage == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_MeshObject_SetObjectLevelProperty = (PLib3MFMeshObject_SetObjectLevelPropertyPtr) GetProcAddress(hLibrary, "lib3mf_meshobject_setobjectlevelproperty");
 	#else // _WIN32
@@ -1820,6 +2047,15 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_MeshObject_SetGeometry == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_MeshObject_ReserveGeometry = (PLib3MFMeshObject_ReserveGeometryPtr) GetProcAddress(hLibrary, "lib3mf_meshobject_reservegeometry");
+	#else // _WIN32
+	pWrapperTable->m_MeshObject_ReserveGeometry = (PLib3MFMeshObject_ReserveGeometryPtr) dlsym(hLibrary, "lib3mf_meshobject_reservegeometry");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_MeshObject_ReserveGeometry == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_MeshObject_IsManifoldAndOriented = (PLib3MFMeshObject_IsManifoldAndOrientedPtr) GetProcAddress(hLibrary, "lib3mf_meshobject_ismanifoldandoriented");
 	#else // _WIN32
@@ -1829,6 +2065,15 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_MeshObject_IsManifoldAndOriented == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_MeshObject_IsGeometryLoaded = (PLib3MFMeshObject_IsGeometryLoadedPtr) GetProcAddress(hLibrary, "lib3mf_meshobject_isgeometryloaded");
+	#else // _WIN32
+	pWrapperTable->m_MeshObject_IsGeometryLoaded = (PLib3MFMeshObject_IsGeometryLoadedPtr) dlsym(hLibrary, "lib3mf_meshobject_isgeometryloaded");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_MeshObject_IsGeometryLoaded == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_MeshObject_BeamLattice = (PLib3MFMeshObject_BeamLatticePtr) GetProcAddress(hLibrary, "lib3mf_meshobject_beamlattice");
 	#else // _WIN32
@@ -4718,6 +4963,78 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_ImplicitFunction_SortNodesTopologically == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_ImplicitFunction_CreateEvaluator = (PLib3MFImplicitFunction_CreateEvaluatorPtr) GetProcAddress(hLibrary, "lib3mf_implicitfunction_createevaluator");
+	#else // _WIN32
+	pWrapperTable->m_ImplicitFunction_CreateEvaluator = (PLib3MFImplicitFunction_CreateEvaluatorPtr) dlsym(hLibrary, "lib3mf_implicitfunction_createevaluator");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ImplicitFunction_CreateEvaluator == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_ImplicitEvaluator_GetInputStride = (PLib3MFImplicitEvaluator_GetInputStridePtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_getinputstride");
+	#else // _WIN32
+	pWrapperTable->m_ImplicitEvaluator_GetInputStride = (PLib3MFImplicitEvaluator_GetInputStridePtr) dlsym(hLibrary, "lib3mf_implicitevaluator_getinputstride");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ImplicitEvaluator_GetInputStride == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_ImplicitEvaluator_GetOutputStride = (PLib3MFImplicitEvaluator_GetOutputStridePtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_getoutputstride");
+	#else // _WIN32
+	pWrapperTable->m_ImplicitEvaluator_GetOutputStride = (PLib3MFImplicitEvaluator_GetOutputStridePtr) dlsym(hLibrary, "lib3mf_implicitevaluator_getoutputstride");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ImplicitEvaluator_GetOutputStride == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_ImplicitEvaluator_SetWorkerThreadCount = (PLib3MFImplicitEvaluator_SetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_setworkerthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_ImplicitEvaluator_SetWorkerThreadCount = (PLib3MFImplicitEvaluator_SetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_implicitevaluator_setworkerthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ImplicitEvaluator_SetWorkerThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_ImplicitEvaluator_GetWorkerThreadCount = (PLib3MFImplicitEvaluator_GetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_getworkerthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_ImplicitEvaluator_GetWorkerThreadCount = (PLib3MFImplicitEvaluator_GetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_implicitevaluator_getworkerthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ImplicitEvaluator_GetWorkerThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_ImplicitEvaluator_Evaluate = (PLib3MFImplicitEvaluator_EvaluatePtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_evaluate");
+	#else // _WIN32
+	pWrapperTable->m_ImplicitEvaluator_Evaluate = (PLib3MFImplicitEvaluator_EvaluatePtr) dlsym(hLibrary, "lib3mf_implicitevaluator_evaluate");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ImplicitEvaluator_Evaluate == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_ImplicitEvaluator_EvaluateBatch = (PLib3MFImplicitEvaluator_EvaluateBatchPtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_evaluatebatch");
+	#else // _WIN32
+	pWrapperTable->m_ImplicitEvaluator_EvaluateBatch = (PLib3MFImplicitEvaluator_EvaluateBatchPtr) dlsym(hLibrary, "lib3mf_implicitevaluator_evaluatebatch");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ImplicitEvaluator_EvaluateBatch == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_ImplicitEvaluator_EvaluateBounds = (PLib3MFImplicitEvaluator_EvaluateBoundsPtr) GetProcAddress(hLibrary, "lib3mf_implicitevaluator_evaluatebounds");
+	#else // _WIN32
+	pWrapperTable->m_ImplicitEvaluator_EvaluateBounds = (PLib3MFImplicitEvaluator_EvaluateBoundsPtr) dlsym(hLibrary, "lib3mf_implicitevaluator_evaluatebounds");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_ImplicitEvaluator_EvaluateBounds == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_FunctionFromImage3D_GetImage3D = (PLib3MFFunctionFromImage3D_GetImage3DPtr) GetProcAddress(hLibrary, "lib3mf_functionfromimage3d_getimage3d");
 	#else // _WIN32
@@ -4808,6 +5125,60 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_FunctionFromImage3D_SetScale == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_FunctionFromImage3D_CreateSampler = (PLib3MFFunctionFromImage3D_CreateSamplerPtr) GetProcAddress(hLibrary, "lib3mf_functionfromimage3d_createsampler");
+	#else // _WIN32
+	pWrapperTable->m_FunctionFromImage3D_CreateSampler = (PLib3MFFunctionFromImage3D_CreateSamplerPtr) dlsym(hLibrary, "lib3mf_functionfromimage3d_createsampler");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_FunctionFromImage3D_CreateSampler == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Image3DSampler_SetCacheSize = (PLib3MFImage3DSampler_SetCacheSizePtr) GetProcAddress(hLibrary, "lib3mf_image3dsampler_setcachesize");
+	#else // _WIN32
+	pWrapperTable->m_Image3DSampler_SetCacheSize = (PLib3MFImage3DSampler_SetCacheSizePtr) dlsym(hLibrary, "lib3mf_image3dsampler_setcachesize");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Image3DSampler_SetCacheSize == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Image3DSampler_GetCacheSize = (PLib3MFImage3DSampler_GetCacheSizePtr) GetProcAddress(hLibrary, "lib3mf_image3dsampler_getcachesize");
+	#else // _WIN32
+	pWrapperTable->m_Image3DSampler_GetCacheSize = (PLib3MFImage3DSampler_GetCacheSizePtr) dlsym(hLibrary, "lib3mf_image3dsampler_getcachesize");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Image3DSampler_GetCacheSize == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Image3DSampler_SetWorkerThreadCount = (PLib3MFImage3DSampler_SetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_image3dsampler_setworkerthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Image3DSampler_SetWorkerThreadCount = (PLib3MFImage3DSampler_SetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_image3dsampler_setworkerthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Image3DSampler_SetWorkerThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Image3DSampler_GetWorkerThreadCount = (PLib3MFImage3DSampler_GetWorkerThreadCountPtr) GetProcAddress(hLibrary, "lib3mf_image3dsampler_getworkerthreadcount");
+	#else // _WIN32
+	pWrapperTable->m_Image3DSampler_GetWorkerThreadCount = (PLib3MFImage3DSampler_GetWorkerThreadCountPtr) dlsym(hLibrary, "lib3mf_image3dsampler_getworkerthreadcount");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Image3DSampler_GetWorkerThreadCount == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
+	#ifdef _WIN32
+	pWrapperTable->m_Image3DSampler_Sample = (PLib3MFImage3DSampler_SamplePtr) GetProcAddress(hLibrary, "lib3mf_image3dsampler_sample");
+	#else // _WIN32
+	pWrapperTable->m_Image3DSampler_Sample = (PLib3MFImage3DSampler_SamplePtr) dlsym(hLibrary, "lib3mf_image3dsampler_sample");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_Image3DSampler_Sample == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_BuildItem_GetObjectResource = (PLib3MFBuildItem_GetObjectResourcePtr) GetProcAddress(hLibrary, "lib3mf_builditem_getobjectresource");
 	#else // _WIN32
@@ -6176,6 +6547,15 @@ Lib3MFResult LoadLib3MFWrapperTable(sLib3MFDynamicWrapperTable * pWrapperTable,
 	if (pWrapperTable->m_CreateModel == NULL)
 		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
 	
+	#ifdef _WIN32
+	pWrapperTable->m_CreateStreamingWriter = (PLib3MFCreateStreamingWriterPtr) GetProcAddress(hLibrary, "lib3mf_createstreamingwriter");
+	#else // _WIN32
+	pWrapperTable->m_CreateStreamingWriter = (PLib3MFCreateStreamingWriterPtr) dlsym(hLibrary, "lib3mf_createstreamingwriter");
+	dlerror();
+	#endif // _WIN32
+	if (pWrapperTable->m_CreateStreamingWriter == NULL)
+		return LIB3MF_ERROR_COULDNOTFINDLIBRARYEXPORT;
+	
 	#ifdef _WIN32
 	pWrapperTable->m_Release = (PLib3MFReleasePtr) GetProcAddress(hLibrary, "lib3mf_release");
 	#else // _WIN32
@@ -6409,6 +6789,60 @@ Lib3MFResult CCall_lib3mf_writer_setdecimalprecision(Lib3MFHandle libraryHandle,
 }
 
 
+Lib3MFResult CCall_lib3mf_writer_setshortestroundtripactive(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, bool bShortestRoundtripActive)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_SetShortestRoundtripActive (pWriter, bShortestRoundtripActive);
+}
+
+
+Lib3MFResult CCall_lib3mf_writer_getshortestroundtripactive(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, bool * pShortestRoundtripActive)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_GetShortestRoundtripActive (pWriter, pShortestRoundtripActive);
+}
+
+
+Lib3MFResult CCall_lib3mf_writer_setworkerthreadcount(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_SetWorkerThreadCount (pWriter, nThreadCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_writer_getworkerthreadcount(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_GetWorkerThreadCount (pWriter, pThreadCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_writer_setcompressionlevel(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, eLib3MFPackagePartType ePartType, eLib3MFCompressionLevel eLevel)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_SetCompressionLevel (pWriter, ePartType, eLevel);
+}
+
+
+Lib3MFResult CCall_lib3mf_writer_getcompressionlevel(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, eLib3MFPackagePartType ePartType, eLib3MFCompressionLevel * pLevel)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Writer_GetCompressionLevel (pWriter, ePartType, pLevel);
+}
+
+
 Lib3MFResult CCall_lib3mf_writer_setstrictmodeactive(Lib3MFHandle libraryHandle, Lib3MF_Writer pWriter, bool bStrictModeActive)
 {
 	if (libraryHandle == 0) 
@@ -6535,6 +6969,51 @@ Lib3MFResult CCall_lib3mf_reader_getstrictmodeactive(Lib3MFHandle libraryHandle,
 }
 
 
+Lib3MFResult CCall_lib3mf_reader_setworkerthreadcount(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, Lib3MF_uint32 nThreadCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_SetWorkerThreadCount (pReader, nThreadCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_reader_getworkerthreadcount(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, Lib3MF_uint32 * pThreadCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_GetWorkerThreadCount (pReader, pThreadCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_reader_setmeshstreamcallbacks(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, Lib3MFVertexBlockCallback pTheVertexBlockCallback, Lib3MFTriangleBlockCallback pTheTriangleBlockCallback, bool bRetainGeometry, Lib3MF_pvoid pUserData)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_SetMeshStreamCallbacks (pReader, pTheVertexBlockCallback, pTheTriangleBlockCallback, bRetainGeometry, pUserData);
+}
+
+
+Lib3MFResult CCall_lib3mf_reader_setlazymeshloadingactive(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, bool bLazyMeshLoadingActive)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_SetLazyMeshLoadingActive (pReader, bLazyMeshLoadingActive);
+}
+
+
+Lib3MFResult CCall_lib3mf_reader_getlazymeshloadingactive(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, bool * pLazyMeshLoadingActive)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Reader_GetLazyMeshLoadingActive (pReader, pLazyMeshLoadingActive);
+}
+
+
 Lib3MFResult CCall_lib3mf_reader_getwarning(Lib3MFHandle libraryHandle, Lib3MF_Reader pReader, Lib3MF_uint32 nIndex, Lib3MF_uint32 * pErrorCode, const Lib3MF_uint32 nWarningBufferSize, Lib3MF_uint32* pWarningNeededChars, char * pWarningBuffer)
 {
 	if (libraryHandle == 0) 
@@ -6571,6 +7050,60 @@ Lib3MFResult CCall_lib3mf_reader_setcontentencryptioncallback(Lib3MFHandle libra
 }
 
 
+Lib3MFResult CCall_lib3mf_streamingwriter_beginmeshobject(Lib3MFHandle libraryHandle, Lib3MF_StreamingWriter pStreamingWriter, const char * pName, Lib3MF_uint32 * pObjectID)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_StreamingWriter_BeginMeshObject (pStreamingWriter, pName, pObjectID);
+}
+
+
+Lib3MFResult CCall_lib3mf_streamingwriter_addvertices(Lib3MFHandle libraryHandle, Lib3MF_StreamingWriter pStreamingWriter, Lib3MF_uint64 nVerticesBufferSize, const sLib3MFPosition * pVerticesBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_StreamingWriter_AddVertices (pStreamingWriter, nVerticesBufferSize, pVerticesBuffer);
+}
+
+
+Lib3MFResult CCall_lib3mf_streamingwriter_addtriangles(Lib3MFHandle libraryHandle, Lib3MF_StreamingWriter pStreamingWriter, Lib3MF_uint64 nIndicesBufferSize, const sLib3MFTriangle * pIndicesBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_StreamingWriter_AddTriangles (pStreamingWriter, nIndicesBufferSize, pIndicesBuffer);
+}
+
+
+Lib3MFResult CCall_lib3mf_streamingwriter_endmeshobject(Lib3MFHandle libraryHandle, Lib3MF_StreamingWriter pStreamingWriter)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_StreamingWriter_EndMeshObject (pStreamingWriter);
+}
+
+
+Lib3MFResult CCall_lib3mf_streamingwriter_addbuilditem(Lib3MFHandle libraryHandle, Lib3MF_StreamingWriter pStreamingWriter, Lib3MF_uint32 nObjectID, const sLib3MFTransform * pTransform)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_StreamingWriter_AddBuildItem (pStreamingWriter, nObjectID, pTransform);
+}
+
+
+Lib3MFResult CCall_lib3mf_streamingwriter_finish(Lib3MFHandle libraryHandle, Lib3MF_StreamingWriter pStreamingWriter)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_StreamingWriter_Finish (pStreamingWriter);
+}
+
+
 Lib3MFResult CCall_lib3mf_packagepart_getpath(Lib3MFHandle libraryHandle, Lib3MF_PackagePart pPackagePart, const Lib3MF_uint32 nPathBufferSize, Lib3MF_uint32* pPathNeededChars, char * pPathBuffer)
 {
 	if (libraryHandle == 0) 
@@ -7327,6 +7860,24 @@ Lib3MFResult CCall_lib3mf_meshobject_getvertices(Lib3MFHandle libraryHandle, Lib
 }
 
 
+Lib3MFResult CCall_lib3mf_meshobject_getvertexpagecount(Lib3MFHandle libraryHandle, Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 * pPageCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_MeshObject_GetVertexPageCount (pMeshObject, pPageCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_meshobject_getvertexpage(Lib3MFHandle libraryHandle, Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nPageIndex, Lib3MF_uint32 * pVertexCount, Lib3MF_uint32 * pStride, Lib3MF_pvoid * pCoordinates)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_MeshObject_GetVertexPage (pMeshObject, nPageIndex, pVertexCount, pStride, pCoordinates);
+}
+
+
 Lib3MFResult CCall_lib3mf_meshobject_gettriangle(Lib3MFHandle libraryHandle, Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nIndex, sLib3MFTriangle * pIndices)
 {
 	if (libraryHandle == 0) 
@@ -7363,6 +7914,24 @@ Lib3MFResult CCall_lib3mf_meshobject_gettriangleindices(Lib3MFHandle libraryHand
 }
 
 
+Lib3MFResult CCall_lib3mf_meshobject_gettrianglepagecount(Lib3MFHandle libraryHandle, Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 * pPageCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_MeshObject_GetTrianglePageCount (pMeshObject, pPageCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_meshobject_gettrianglepage(Lib3MFHandle libraryHandle, Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nPageIndex, Lib3MF_uint32 * pTriangleCount, Lib3MF_uint32 * pStride, Lib3MF_pvoid * pIndices)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_MeshObject_GetTrianglePage (pMeshObject, nPageIndex, pTriangleCount, pStride, pIndices);
+}
+
+
 Lib3MFResult CCall_lib3mf_meshobject_setobjectlevelproperty(Lib3MFHandle libraryHandle, Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nUniqueResourceID, Lib3MF_uint32 nPropertyID)
 {
 	if (libraryHandle == 0) 
@@ -7435,6 +8004,15 @@ Lib3MFResult CCall_lib3mf_meshobject_setgeometry(Lib3MFHandle libraryHandle, Lib
 }
 
 
+Lib3MFResult CCall_lib3mf_meshobject_reservegeometry(Lib3MFHandle libraryHandle, Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nVertexCount, Lib3MF_uint32 nTriangleCount, Lib3MF_uint32 nBeamCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_MeshObject_ReserveGeometry (pMeshObject, nVertexCount, nTriangleCount, nBeamCount);
+}
+
+
 Lib3MFResult CCall_lib3mf_meshobject_ismanifoldandoriented(Lib3MFHandle libraryHandle, Lib3MF_MeshObject pMeshObject, bool * pIsManifoldAndOriented)
 {
 	if (libraryHandle == 0) 
@@ -7444,6 +8022,15 @@ Lib3MFResult CCall_lib3mf_meshobject_ismanifoldandoriented(Lib3MFHandle libraryH
 }
 
 
+Lib3MFResult CCall_lib3mf_meshobject_isgeometryloaded(Lib3MFHandle libraryHandle, Lib3MF_MeshObject pMeshObject, bool * pIsGeometryLoaded)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_MeshObject_IsGeometryLoaded (pMeshObject, pIsGeometryLoaded);
+}
+
+
 Lib3MFResult CCall_lib3mf_meshobject_beamlattice(Lib3MFHandle libraryHandle, Lib3MF_MeshObject pMeshObject, Lib3MF_BeamLattice * pTheBeamLattice)
 {
 	if (libraryHandle == 0) 
@@ -10333,6 +10920,78 @@ Lib3MFResult CCall_lib3mf_implicitfunction_sortnodestopologically(Lib3MFHandle l
 }
 
 
+Lib3MFResult CCall_lib3mf_implicitfunction_createevaluator(Lib3MFHandle libraryHandle, Lib3MF_ImplicitFunction pImplicitFunction, Lib3MF_ImplicitEvaluator * pEvaluator)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_ImplicitFunction_CreateEvaluator (pImplicitFunction, pEvaluator);
+}
+
+
+Lib3MFResult CCall_lib3mf_implicitevaluator_getinputstride(Lib3MFHandle libraryHandle, Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint32 * pStride)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_ImplicitEvaluator_GetInputStride (pImplicitEvaluator, pStride);
+}
+
+
+Lib3MFResult CCall_lib3mf_implicitevaluator_getoutputstride(Lib3MFHandle libraryHandle, Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint32 * pStride)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_ImplicitEvaluator_GetOutputStride (pImplicitEvaluator, pStride);
+}
+
+
+Lib3MFResult CCall_lib3mf_implicitevaluator_setworkerthreadcount(Lib3MFHandle libraryHandle, Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint32 nThreadCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_ImplicitEvaluator_SetWorkerThreadCount (pImplicitEvaluator, nThreadCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_implicitevaluator_getworkerthreadcount(Lib3MFHandle libraryHandle, Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint32 * pThreadCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_ImplicitEvaluator_GetWorkerThreadCount (pImplicitEvaluator, pThreadCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_implicitevaluator_evaluate(Lib3MFHandle libraryHandle, Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint64 nInputsBufferSize, const Lib3MF_double * pInputsBuffer, const Lib3MF_uint64 nOutputsBufferSize, Lib3MF_uint64* pOutputsNeededCount, Lib3MF_double * pOutputsBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_ImplicitEvaluator_Evaluate (pImplicitEvaluator, nInputsBufferSize, pInputsBuffer, nOutputsBufferSize, pOutputsNeededCount, pOutputsBuffer);
+}
+
+
+Lib3MFResult CCall_lib3mf_implicitevaluator_evaluatebatch(Lib3MFHandle libraryHandle, Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint64 nInputsBufferSize, const Lib3MF_double * pInputsBuffer, const Lib3MF_uint64 nOutputsBufferSize, Lib3MF_uint64* pOutputsNeededCount, Lib3MF_double * pOutputsBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_ImplicitEvaluator_EvaluateBatch (pImplicitEvaluator, nInputsBufferSize, pInputsBuffer, nOutputsBufferSize, pOutputsNeededCount, pOutputsBuffer);
+}
+
+
+Lib3MFResult CCall_lib3mf_implicitevaluator_evaluatebounds(Lib3MFHandle libraryHandle, Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint64 nInputMinimaBufferSize, const Lib3MF_double * pInputMinimaBuffer, Lib3MF_uint64 nInputMaximaBufferSize, const Lib3MF_double * pInputMaximaBuffer, const Lib3MF_uint64 nOutputMinimaBufferSize, Lib3MF_uint64* pOutputMinimaNeededCount, Lib3MF_double * pOutputMinimaBuffer, const Lib3MF_uint64 nOutputMaximaBufferSize, Lib3MF_uint64* pOutputMaximaNeededCount, Lib3MF_double * pOutputMaximaBuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_ImplicitEvaluator_EvaluateBounds (pImplicitEvaluator, nInputMinimaBufferSize, pInputMinimaBuffer, nInputMaximaBufferSize, pInputMaximaBuffer, nOutputMinimaBufferSize, pOutputMinimaNeededCount, pOutputMinimaBuffer, nOutputMaximaBufferSize, pOutputMaximaNeededCount, pOutputMaximaBuffer);
+}
+
+
 Lib3MFResult CCall_lib3mf_functionfromimage3d_getimage3d(Lib3MFHandle libraryHandle, Lib3MF_FunctionFromImage3D pFunctionFromImage3D, Lib3MF_Image3D * pImage3D)
 {
 	if (libraryHandle == 0) 
@@ -10423,6 +11082,60 @@ Lib3MFResult CCall_lib3mf_functionfromimage3d_setscale(Lib3MFHandle libraryHandl
 }
 
 
+Lib3MFResult CCall_lib3mf_functionfromimage3d_createsampler(Lib3MFHandle libraryHandle, Lib3MF_FunctionFromImage3D pFunctionFromImage3D, Lib3MF_Image3DSampler * pSampler)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_FunctionFromImage3D_CreateSampler (pFunctionFromImage3D, pSampler);
+}
+
+
+Lib3MFResult CCall_lib3mf_image3dsampler_setcachesize(Lib3MFHandle libraryHandle, Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint64 nCacheSize)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Image3DSampler_SetCacheSize (pImage3DSampler, nCacheSize);
+}
+
+
+Lib3MFResult CCall_lib3mf_image3dsampler_getcachesize(Lib3MFHandle libraryHandle, Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint64 * pCacheSize)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Image3DSampler_GetCacheSize (pImage3DSampler, pCacheSize);
+}
+
+
+Lib3MFResult CCall_lib3mf_image3dsampler_setworkerthreadcount(Lib3MFHandle libraryHandle, Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint32 nThreadCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Image3DSampler_SetWorkerThreadCount (pImage3DSampler, nThreadCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_image3dsampler_getworkerthreadcount(Lib3MFHandle libraryHandle, Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint32 * pThreadCount)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Image3DSampler_GetWorkerThreadCount (pImage3DSampler, pThreadCount);
+}
+
+
+Lib3MFResult CCall_lib3mf_image3dsampler_sample(Lib3MFHandle libraryHandle, Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint64 nUVWBufferSize, const Lib3MF_double * pUVWBuffer, const Lib3MF_uint64 nRGBABufferSize, Lib3MF_uint64* pRGBANeededCount, Lib3MF_double * pRGBABuffer)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_Image3DSampler_Sample (pImage3DSampler, nUVWBufferSize, pUVWBuffer, nRGBABufferSize, pRGBANeededCount, pRGBABuffer);
+}
+
+
 Lib3MFResult CCall_lib3mf_builditem_getobjectresource(Lib3MFHandle libraryHandle, Lib3MF_BuildItem pBuildItem, Lib3MF_Object * pObjectResource)
 {
 	if (libraryHandle == 0) 
@@ -11791,6 +12504,15 @@ Lib3MFResult CCall_lib3mf_createmodel(Lib3MFHandle libraryHandle, Lib3MF_Model *
 }
 
 
+Lib3MFResult CCall_lib3mf_createstreamingwriter(Lib3MFHandle libraryHandle, const char * pFilename, eLib3MFModelUnit eUnit, Lib3MF_StreamingWriter * pStreamingWriter)
+{
+	if (libraryHandle == 0) 
+		return LIB3MF_ERROR_INVALIDCAST;
+	sLib3MFDynamicWrapperTable * wrapperTable = (sLib3MFDynamicWrapperTable *) libraryHandle;
+	return wrapperTable->m_CreateStreamingWriter (pFilename, eUnit, pStreamingWriter);
+}
+
+
 Lib3MFResult CCall_lib3mf_release(Lib3MFHandle libraryHandle, Lib3MF_Base pInstance)
 {
 	if (libraryHandle == 0) 
@@ -51,6 +51,7 @@ void InitAll(v8::Local<Object> exports, v8::Local<Object> module)
 	CLib3MFBase::Init();
 	CLib3MFWriter::Init();
 	CLib3MFReader::Init();
+	CLib3MFStreamingWriter::Init();
 	CLib3MFPackagePart::Init();
 	CLib3MFResource::Init();
 	CLib3MFResourceIterator::Init();
@@ -152,7 +153,9 @@ void InitAll(v8::Local<Object> exports, v8::Local<Object> module)
 	CLib3MFNodeIterator::Init();
 	CLib3MFFunction::Init();
 	CLib3MFImplicitFunction::Init();
+	CLib3MFImplicitEvaluator::Init();
 	CLib3MFFunctionFromImage3D::Init();
+	CLib3MFImage3DSampler::Init();
 	CLib3MFBuildItem::Init();
 	CLib3MFBuildItemIterator::Init();
 	CLib3MFSlice::Init();
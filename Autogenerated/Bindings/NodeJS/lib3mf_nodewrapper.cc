@@ -44,6 +44,7 @@ Persistent<Function> CLib3MFWrapper::constructor;
 Persistent<Function> CLib3MFBase::constructor;
 Persistent<Function> CLib3MFWriter::constructor;
 Persistent<Function> CLib3MFReader::constructor;
+Persistent<Function> CLib3MFStreamingWriter::constructor;
 Persistent<Function> CLib3MFPackagePart::constructor;
 Persistent<Function> CLib3MFResource::constructor;
 Persistent<Function> CLib3MFResourceIterator::constructor;
@@ -145,7 +146,9 @@ Persistent<Function> CLib3MFFunctionCallNode::constructor;
 Persistent<Function> CLib3MFNodeIterator::constructor;
 Persistent<Function> CLib3MFFunction::constructor;
 Persistent<Function> CLib3MFImplicitFunction::constructor;
+Persistent<Function> CLib3MFImplicitEvaluator::constructor;
 Persistent<Function> CLib3MFFunctionFromImage3D::constructor;
+Persistent<Function> CLib3MFImage3DSampler::constructor;
 Persistent<Function> CLib3MFBuildItem::constructor;
 Persistent<Function> CLib3MFBuildItemIterator::constructor;
 Persistent<Function> CLib3MFSlice::constructor;
@@ -1491,6 +1494,12 @@ void CLib3MFWriter::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetProgressCallback", SetProgressCallback);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetDecimalPrecision", GetDecimalPrecision);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetDecimalPrecision", SetDecimalPrecision);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetShortestRoundtripActive", SetShortestRoundtripActive);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetShortestRoundtripActive", GetShortestRoundtripActive);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetWorkerThreadCount", SetWorkerThreadCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetWorkerThreadCount", GetWorkerThreadCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetCompressionLevel", SetCompressionLevel);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetCompressionLevel", GetCompressionLevel);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetStrictModeActive", SetStrictModeActive);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetStrictModeActive", GetStrictModeActive);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetWarning", GetWarning);
@@ -1695,6 +1704,152 @@ void CLib3MFWriter::SetDecimalPrecision(const FunctionCallbackInfo<Value>& args)
 }
 
 
+void CLib3MFWriter::SetShortestRoundtripActive(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsBoolean()) {
+            throw std::runtime_error("Expected bool parameter 0 (ShortestRoundtripActive)");
+        }
+        bool bShortestRoundtripActive = args[0]->BooleanValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetShortestRoundtripActive.");
+        if (wrapperTable->m_Writer_SetShortestRoundtripActive == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::SetShortestRoundtripActive.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_SetShortestRoundtripActive(instanceHandle, bShortestRoundtripActive);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFWriter::GetShortestRoundtripActive(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        bool bReturnShortestRoundtripActive = false;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetShortestRoundtripActive.");
+        if (wrapperTable->m_Writer_GetShortestRoundtripActive == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::GetShortestRoundtripActive.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_GetShortestRoundtripActive(instanceHandle, &bReturnShortestRoundtripActive);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Boolean::New(isolate, bReturnShortestRoundtripActive));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFWriter::SetWorkerThreadCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 0 (ThreadCount)");
+        }
+        unsigned int nThreadCount = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetWorkerThreadCount.");
+        if (wrapperTable->m_Writer_SetWorkerThreadCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::SetWorkerThreadCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_SetWorkerThreadCount(instanceHandle, nThreadCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFWriter::GetWorkerThreadCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        unsigned int nReturnThreadCount = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetWorkerThreadCount.");
+        if (wrapperTable->m_Writer_GetWorkerThreadCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::GetWorkerThreadCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_GetWorkerThreadCount(instanceHandle, &nReturnThreadCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnThreadCount));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFWriter::SetCompressionLevel(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected enum parameter 0 (PartType)");
+        }
+        if (!args[1]->IsUint32()) {
+            throw std::runtime_error("Expected enum parameter 1 (Level)");
+        }
+        unsigned int ePartType = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        unsigned int eLevel = (unsigned int) args[1]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetCompressionLevel.");
+        if (wrapperTable->m_Writer_SetCompressionLevel == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::SetCompressionLevel.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_SetCompressionLevel(instanceHandle, (eLib3MFPackagePartType) ePartType, (eLib3MFCompressionLevel) eLevel);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFWriter::GetCompressionLevel(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected enum parameter 0 (PartType)");
+        }
+        unsigned int ePartType = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        eLib3MFCompressionLevel eReturnLevel;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetCompressionLevel.");
+        if (wrapperTable->m_Writer_GetCompressionLevel == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Writer::GetCompressionLevel.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Writer_GetCompressionLevel(instanceHandle, (eLib3MFPackagePartType) ePartType, &eReturnLevel);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Integer::New(isolate, (int)eReturnLevel));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
 void CLib3MFWriter::SetStrictModeActive(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
@@ -1885,6 +2040,11 @@ void CLib3MFReader::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "RemoveRelationToRead", RemoveRelationToRead);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetStrictModeActive", SetStrictModeActive);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetStrictModeActive", GetStrictModeActive);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetWorkerThreadCount", SetWorkerThreadCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetWorkerThreadCount", GetWorkerThreadCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetMeshStreamCallbacks", SetMeshStreamCallbacks);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetLazyMeshLoadingActive", SetLazyMeshLoadingActive);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetLazyMeshLoadingActive", GetLazyMeshLoadingActive);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetWarning", GetWarning);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetWarningCount", GetWarningCount);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "AddKeyWrappingCallback", AddKeyWrappingCallback);
@@ -2121,6 +2281,128 @@ void CLib3MFReader::GetStrictModeActive(const FunctionCallbackInfo<Value>& args)
 }
 
 
+void CLib3MFReader::SetWorkerThreadCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 0 (ThreadCount)");
+        }
+        unsigned int nThreadCount = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetWorkerThreadCount.");
+        if (wrapperTable->m_Reader_SetWorkerThreadCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::SetWorkerThreadCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_SetWorkerThreadCount(instanceHandle, nThreadCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFReader::GetWorkerThreadCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        unsigned int nReturnThreadCount = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetWorkerThreadCount.");
+        if (wrapperTable->m_Reader_GetWorkerThreadCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::GetWorkerThreadCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_GetWorkerThreadCount(instanceHandle, &nReturnThreadCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnThreadCount));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFReader::SetMeshStreamCallbacks(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[2]->IsBoolean()) {
+            throw std::runtime_error("Expected bool parameter 2 (RetainGeometry)");
+        }
+        if (!args[3]->IsString()) {
+            throw std::runtime_error("Expected pointer parameter 3 (UserData)");
+        }
+        bool bRetainGeometry = args[2]->BooleanValue(isolate->GetCurrentContext()).ToChecked();
+        v8::String::Utf8Value sutf8UserData(isolate, args[3]);
+        std::string sUserData = *sutf8UserData;
+        uint64_t nUserData = stoull(sUserData);
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetMeshStreamCallbacks.");
+        if (wrapperTable->m_Reader_SetMeshStreamCallbacks == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::SetMeshStreamCallbacks.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_SetMeshStreamCallbacks(instanceHandle, nullptr, nullptr, bRetainGeometry, (void*) nUserData);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFReader::SetLazyMeshLoadingActive(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsBoolean()) {
+            throw std::runtime_error("Expected bool parameter 0 (LazyMeshLoadingActive)");
+        }
+        bool bLazyMeshLoadingActive = args[0]->BooleanValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetLazyMeshLoadingActive.");
+        if (wrapperTable->m_Reader_SetLazyMeshLoadingActive == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::SetLazyMeshLoadingActive.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_SetLazyMeshLoadingActive(instanceHandle, bLazyMeshLoadingActive);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFReader::GetLazyMeshLoadingActive(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        bool bReturnLazyMeshLoadingActive = false;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetLazyMeshLoadingActive.");
+        if (wrapperTable->m_Reader_GetLazyMeshLoadingActive == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Reader::GetLazyMeshLoadingActive.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Reader_GetLazyMeshLoadingActive(instanceHandle, &bReturnLazyMeshLoadingActive);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Boolean::New(isolate, bReturnLazyMeshLoadingActive));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
 void CLib3MFReader::GetWarning(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
@@ -2234,6 +2516,202 @@ void CLib3MFReader::SetContentEncryptionCallback(const FunctionCallbackInfo<Valu
 		}
 }
 
+/*************************************************************************************************************************
+ Class CLib3MFStreamingWriter Implementation
+**************************************************************************************************************************/
+
+CLib3MFStreamingWriter::CLib3MFStreamingWriter()
+		: CLib3MFBaseClass()
+{
+}
+
+CLib3MFStreamingWriter::~CLib3MFStreamingWriter()
+{
+}
+
+void CLib3MFStreamingWriter::Init()
+{
+		Isolate* isolate = Isolate::GetCurrent();
+
+		// Prepare constructor template
+		Local<FunctionTemplate> tpl = FunctionTemplate::New(isolate, New);
+		tpl->SetClassName(String::NewFromUtf8(isolate, "Lib3MFStreamingWriter"));
+		tpl->InstanceTemplate()->SetInternalFieldCount(NODEWRAPPER_FIELDCOUNT);
+
+		// Prototype
+		NODE_SET_PROTOTYPE_METHOD(tpl, "BeginMeshObject", BeginMeshObject);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "AddVertices", AddVertices);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "AddTriangles", AddTriangles);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "EndMeshObject", EndMeshObject);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "AddBuildItem", AddBuildItem);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "Finish", Finish);
+		constructor.Reset(isolate, tpl->GetFunction(isolate->GetCurrentContext()).ToLocalChecked());
+
+}
+
+void CLib3MFStreamingWriter::New(const FunctionCallbackInfo<Value>& args)
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+
+		if (args.IsConstructCall()) {
+				CLib3MFBaseClass * holderObj = ObjectWrap::Unwrap<CLib3MFBaseClass>(args.Holder());
+				CLib3MFStreamingWriter * streamingwriterInstance = new CLib3MFStreamingWriter();
+				streamingwriterInstance->Wrap(args.This());
+				args.GetReturnValue().Set(args.This());
+		} else {
+				RaiseError(isolate, "Lib3MFStreamingWriter: Invalid call to Constructor");
+		}
+}
+
+Local<Object> CLib3MFStreamingWriter::NewInstance(Local<Object> pParent, Lib3MFHandle pHandle)
+{
+		Isolate* isolate = Isolate::GetCurrent();
+		HandleScope scope(isolate);
+		Local<Function> cons = Local<Function>::New(isolate, constructor);
+		Local<Object> instance;
+		if (cons->NewInstance(isolate->GetCurrentContext()).ToLocal(&instance)) {
+			instance->SetInternalField(NODEWRAPPER_TABLEINDEX, External::New(isolate, CLib3MFBaseClass::getDynamicWrapperTable(pParent)));
+			instance->SetInternalField(NODEWRAPPER_HANDLEINDEX, External::New(isolate, pHandle));
+		}
+		return instance;
+}
+
+
+void CLib3MFStreamingWriter::BeginMeshObject(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsString()) {
+            throw std::runtime_error("Expected string parameter 0 (Name)");
+        }
+        v8::String::Utf8Value sutf8Name(isolate, args[0]);
+        std::string sName = *sutf8Name;
+        unsigned int nReturnObjectID = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method BeginMeshObject.");
+        if (wrapperTable->m_StreamingWriter_BeginMeshObject == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method StreamingWriter::BeginMeshObject.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_StreamingWriter_BeginMeshObject(instanceHandle, sName.c_str(), &nReturnObjectID);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnObjectID));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFStreamingWriter::AddVertices(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method AddVertices.");
+        if (wrapperTable->m_StreamingWriter_AddVertices == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method StreamingWriter::AddVertices.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_StreamingWriter_AddVertices(instanceHandle, 0, nullptr);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFStreamingWriter::AddTriangles(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method AddTriangles.");
+        if (wrapperTable->m_StreamingWriter_AddTriangles == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method StreamingWriter::AddTriangles.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_StreamingWriter_AddTriangles(instanceHandle, 0, nullptr);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFStreamingWriter::EndMeshObject(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method EndMeshObject.");
+        if (wrapperTable->m_StreamingWriter_EndMeshObject == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method StreamingWriter::EndMeshObject.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_StreamingWriter_EndMeshObject(instanceHandle);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFStreamingWriter::AddBuildItem(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 0 (ObjectID)");
+        }
+        if (!args[1]->IsObject()) {
+            throw std::runtime_error("Expected struct parameter 1 (Transform)");
+        }
+        unsigned int nObjectID = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFTransform sTransform = convertObjectToLib3MFTransform(isolate, args[1]);
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method AddBuildItem.");
+        if (wrapperTable->m_StreamingWriter_AddBuildItem == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method StreamingWriter::AddBuildItem.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_StreamingWriter_AddBuildItem(instanceHandle, nObjectID, &sTransform);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFStreamingWriter::Finish(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method Finish.");
+        if (wrapperTable->m_StreamingWriter_Finish == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method StreamingWriter::Finish.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_StreamingWriter_Finish(instanceHandle);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
 /*************************************************************************************************************************
  Class CLib3MFPackagePart Implementation
 **************************************************************************************************************************/
@@ -5348,10 +5826,14 @@ void CLib3MFMeshObject::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetVertex", SetVertex);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "AddVertex", AddVertex);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetVertices", GetVertices);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetVertexPageCount", GetVertexPageCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetVertexPage", GetVertexPage);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetTriangle", GetTriangle);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetTriangle", SetTriangle);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "AddTriangle", AddTriangle);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetTriangleIndices", GetTriangleIndices);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetTrianglePageCount", GetTrianglePageCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetTrianglePage", GetTrianglePage);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetObjectLevelProperty", SetObjectLevelProperty);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetObjectLevelProperty", GetObjectLevelProperty);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetTriangleProperties", SetTriangleProperties);
@@ -5360,7 +5842,9 @@ void CLib3MFMeshObject::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetAllTriangleProperties", GetAllTriangleProperties);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "ClearAllProperties", ClearAllProperties);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetGeometry", SetGeometry);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "ReserveGeometry", ReserveGeometry);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "IsManifoldAndOriented", IsManifoldAndOriented);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "IsGeometryLoaded", IsGeometryLoaded);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "BeamLattice", BeamLattice);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetVolumeData", GetVolumeData);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetVolumeData", SetVolumeData);
@@ -5546,6 +6030,60 @@ void CLib3MFMeshObject::GetVertices(const FunctionCallbackInfo<Value>& args)
 }
 
 
+void CLib3MFMeshObject::GetVertexPageCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        unsigned int nReturnPageCount = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetVertexPageCount.");
+        if (wrapperTable->m_MeshObject_GetVertexPageCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method MeshObject::GetVertexPageCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_MeshObject_GetVertexPageCount(instanceHandle, &nReturnPageCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnPageCount));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFMeshObject::GetVertexPage(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 0 (PageIndex)");
+        }
+        Local<Object> outObject = Object::New(isolate);
+        unsigned int nPageIndex = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        unsigned int nReturnVertexCount = 0;
+        unsigned int nReturnStride = 0;
+        uint64_t nReturnCoordinates = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetVertexPage.");
+        if (wrapperTable->m_MeshObject_GetVertexPage == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method MeshObject::GetVertexPage.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_MeshObject_GetVertexPage(instanceHandle, nPageIndex, &nReturnVertexCount, &nReturnStride, &nReturnCoordinates);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        outObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "VertexCount"), Integer::NewFromUnsigned(isolate, nReturnVertexCount));
+        outObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "Stride"), Integer::NewFromUnsigned(isolate, nReturnStride));
+        outObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "Coordinates"), String::NewFromUtf8(isolate, std::to_string(nReturnCoordinates).c_str()));
+        args.GetReturnValue().Set(outObject);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
 void CLib3MFMeshObject::GetTriangle(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
@@ -5646,6 +6184,60 @@ void CLib3MFMeshObject::GetTriangleIndices(const FunctionCallbackInfo<Value>& ar
 }
 
 
+void CLib3MFMeshObject::GetTrianglePageCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        unsigned int nReturnPageCount = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetTrianglePageCount.");
+        if (wrapperTable->m_MeshObject_GetTrianglePageCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method MeshObject::GetTrianglePageCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_MeshObject_GetTrianglePageCount(instanceHandle, &nReturnPageCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnPageCount));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFMeshObject::GetTrianglePage(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 0 (PageIndex)");
+        }
+        Local<Object> outObject = Object::New(isolate);
+        unsigned int nPageIndex = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        unsigned int nReturnTriangleCount = 0;
+        unsigned int nReturnStride = 0;
+        uint64_t nReturnIndices = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetTrianglePage.");
+        if (wrapperTable->m_MeshObject_GetTrianglePage == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method MeshObject::GetTrianglePage.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_MeshObject_GetTrianglePage(instanceHandle, nPageIndex, &nReturnTriangleCount, &nReturnStride, &nReturnIndices);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        outObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "TriangleCount"), Integer::NewFromUnsigned(isolate, nReturnTriangleCount));
+        outObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "Stride"), Integer::NewFromUnsigned(isolate, nReturnStride));
+        outObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "Indices"), String::NewFromUtf8(isolate, std::to_string(nReturnIndices).c_str()));
+        args.GetReturnValue().Set(outObject);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
 void CLib3MFMeshObject::SetObjectLevelProperty(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
@@ -5836,21 +6428,75 @@ void CLib3MFMeshObject::SetGeometry(const FunctionCallbackInfo<Value>& args)
 }
 
 
-void CLib3MFMeshObject::IsManifoldAndOriented(const FunctionCallbackInfo<Value>& args) 
+void CLib3MFMeshObject::ReserveGeometry(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 0 (VertexCount)");
+        }
+        if (!args[1]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 1 (TriangleCount)");
+        }
+        if (!args[2]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 2 (BeamCount)");
+        }
+        unsigned int nVertexCount = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        unsigned int nTriangleCount = (unsigned int) args[1]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        unsigned int nBeamCount = (unsigned int) args[2]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method ReserveGeometry.");
+        if (wrapperTable->m_MeshObject_ReserveGeometry == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method MeshObject::ReserveGeometry.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_MeshObject_ReserveGeometry(instanceHandle, nVertexCount, nTriangleCount, nBeamCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFMeshObject::IsManifoldAndOriented(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        bool bReturnIsManifoldAndOriented = false;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method IsManifoldAndOriented.");
+        if (wrapperTable->m_MeshObject_IsManifoldAndOriented == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method MeshObject::IsManifoldAndOriented.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_MeshObject_IsManifoldAndOriented(instanceHandle, &bReturnIsManifoldAndOriented);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Boolean::New(isolate, bReturnIsManifoldAndOriented));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFMeshObject::IsGeometryLoaded(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
 		HandleScope scope(isolate);
 		try {
-        bool bReturnIsManifoldAndOriented = false;
+        bool bReturnIsGeometryLoaded = false;
         sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
         if (wrapperTable == nullptr)
-            throw std::runtime_error("Could not get wrapper table for Lib3MF method IsManifoldAndOriented.");
-        if (wrapperTable->m_MeshObject_IsManifoldAndOriented == nullptr)
-            throw std::runtime_error("Could not call Lib3MF method MeshObject::IsManifoldAndOriented.");
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method IsGeometryLoaded.");
+        if (wrapperTable->m_MeshObject_IsGeometryLoaded == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method MeshObject::IsGeometryLoaded.");
         Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
-        Lib3MFResult errorCode = wrapperTable->m_MeshObject_IsManifoldAndOriented(instanceHandle, &bReturnIsManifoldAndOriented);
+        Lib3MFResult errorCode = wrapperTable->m_MeshObject_IsGeometryLoaded(instanceHandle, &bReturnIsGeometryLoaded);
         CheckError(isolate, wrapperTable, instanceHandle, errorCode);
-        args.GetReturnValue().Set(Boolean::New(isolate, bReturnIsManifoldAndOriented));
+        args.GetReturnValue().Set(Boolean::New(isolate, bReturnIsGeometryLoaded));
 
 		} catch (std::exception & E) {
 				RaiseError(isolate, E.what());
@@ -16968,6 +17614,7 @@ void CLib3MFImplicitFunction::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "AddLinkByNames", AddLinkByNames);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "Clear", Clear);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SortNodesTopologically", SortNodesTopologically);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "CreateEvaluator", CreateEvaluator);
 		constructor.Reset(isolate, tpl->GetFunction(isolate->GetCurrentContext()).ToLocalChecked());
 
 }
@@ -19047,37 +19694,301 @@ void CLib3MFImplicitFunction::AddUnsignedMeshNode(const FunctionCallbackInfo<Val
 }
 
 
-void CLib3MFImplicitFunction::AddFunctionCallNode(const FunctionCallbackInfo<Value>& args) 
+void CLib3MFImplicitFunction::AddFunctionCallNode(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsString()) {
+            throw std::runtime_error("Expected string parameter 0 (Identifier)");
+        }
+        if (!args[1]->IsString()) {
+            throw std::runtime_error("Expected string parameter 1 (DisplayName)");
+        }
+        if (!args[2]->IsString()) {
+            throw std::runtime_error("Expected string parameter 2 (Tag)");
+        }
+        v8::String::Utf8Value sutf8Identifier(isolate, args[0]);
+        std::string sIdentifier = *sutf8Identifier;
+        v8::String::Utf8Value sutf8DisplayName(isolate, args[1]);
+        std::string sDisplayName = *sutf8DisplayName;
+        v8::String::Utf8Value sutf8Tag(isolate, args[2]);
+        std::string sTag = *sutf8Tag;
+        Lib3MFHandle hReturnNode = nullptr;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method AddFunctionCallNode.");
+        if (wrapperTable->m_ImplicitFunction_AddFunctionCallNode == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method ImplicitFunction::AddFunctionCallNode.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_ImplicitFunction_AddFunctionCallNode(instanceHandle, sIdentifier.c_str(), sDisplayName.c_str(), sTag.c_str(), &hReturnNode);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        Local<Object> instanceObjNode = CLib3MFFunctionCallNode::NewInstance(args.Holder(), hReturnNode);
+        args.GetReturnValue().Set(instanceObjNode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFImplicitFunction::GetNodes(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        Lib3MFHandle hReturnIterator = nullptr;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetNodes.");
+        if (wrapperTable->m_ImplicitFunction_GetNodes == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method ImplicitFunction::GetNodes.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_ImplicitFunction_GetNodes(instanceHandle, &hReturnIterator);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        Local<Object> instanceObjIterator = CLib3MFNodeIterator::NewInstance(args.Holder(), hReturnIterator);
+        args.GetReturnValue().Set(instanceObjIterator);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFImplicitFunction::RemoveNode(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsObject()) {
+            throw std::runtime_error("Expected class parameter 0 (Node)");
+        }
+        Local<Object> objNode = args[0]->ToObject(isolate->GetCurrentContext()).ToLocalChecked();
+        CLib3MFImplicitNode * instanceNode = ObjectWrap::Unwrap<CLib3MFImplicitNode>(objNode);
+        if (instanceNode == nullptr)
+            throw std::runtime_error("Invalid Object parameter 0 (Node)");
+        Lib3MFHandle hNode = instanceNode->getHandle( objNode );
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method RemoveNode.");
+        if (wrapperTable->m_ImplicitFunction_RemoveNode == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method ImplicitFunction::RemoveNode.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_ImplicitFunction_RemoveNode(instanceHandle, hNode);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFImplicitFunction::AddLink(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsObject()) {
+            throw std::runtime_error("Expected class parameter 0 (Source)");
+        }
+        if (!args[1]->IsObject()) {
+            throw std::runtime_error("Expected class parameter 1 (Target)");
+        }
+        Local<Object> objSource = args[0]->ToObject(isolate->GetCurrentContext()).ToLocalChecked();
+        CLib3MFImplicitPort * instanceSource = ObjectWrap::Unwrap<CLib3MFImplicitPort>(objSource);
+        if (instanceSource == nullptr)
+            throw std::runtime_error("Invalid Object parameter 0 (Source)");
+        Lib3MFHandle hSource = instanceSource->getHandle( objSource );
+        Local<Object> objTarget = args[1]->ToObject(isolate->GetCurrentContext()).ToLocalChecked();
+        CLib3MFImplicitPort * instanceTarget = ObjectWrap::Unwrap<CLib3MFImplicitPort>(objTarget);
+        if (instanceTarget == nullptr)
+            throw std::runtime_error("Invalid Object parameter 1 (Target)");
+        Lib3MFHandle hTarget = instanceTarget->getHandle( objTarget );
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method AddLink.");
+        if (wrapperTable->m_ImplicitFunction_AddLink == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method ImplicitFunction::AddLink.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_ImplicitFunction_AddLink(instanceHandle, hSource, hTarget);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFImplicitFunction::AddLinkByNames(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsString()) {
+            throw std::runtime_error("Expected string parameter 0 (Source)");
+        }
+        if (!args[1]->IsString()) {
+            throw std::runtime_error("Expected string parameter 1 (Target)");
+        }
+        v8::String::Utf8Value sutf8Source(isolate, args[0]);
+        std::string sSource = *sutf8Source;
+        v8::String::Utf8Value sutf8Target(isolate, args[1]);
+        std::string sTarget = *sutf8Target;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method AddLinkByNames.");
+        if (wrapperTable->m_ImplicitFunction_AddLinkByNames == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method ImplicitFunction::AddLinkByNames.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_ImplicitFunction_AddLinkByNames(instanceHandle, sSource.c_str(), sTarget.c_str());
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFImplicitFunction::Clear(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method Clear.");
+        if (wrapperTable->m_ImplicitFunction_Clear == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method ImplicitFunction::Clear.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_ImplicitFunction_Clear(instanceHandle);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFImplicitFunction::SortNodesTopologically(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SortNodesTopologically.");
+        if (wrapperTable->m_ImplicitFunction_SortNodesTopologically == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method ImplicitFunction::SortNodesTopologically.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_ImplicitFunction_SortNodesTopologically(instanceHandle);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFImplicitFunction::CreateEvaluator(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        Lib3MFHandle hReturnEvaluator = nullptr;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method CreateEvaluator.");
+        if (wrapperTable->m_ImplicitFunction_CreateEvaluator == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method ImplicitFunction::CreateEvaluator.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_ImplicitFunction_CreateEvaluator(instanceHandle, &hReturnEvaluator);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        Local<Object> instanceObjEvaluator = CLib3MFImplicitEvaluator::NewInstance(args.Holder(), hReturnEvaluator);
+        args.GetReturnValue().Set(instanceObjEvaluator);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+/*************************************************************************************************************************
+ Class CLib3MFImplicitEvaluator Implementation
+**************************************************************************************************************************/
+
+CLib3MFImplicitEvaluator::CLib3MFImplicitEvaluator()
+		: CLib3MFBaseClass()
+{
+}
+
+CLib3MFImplicitEvaluator::~CLib3MFImplicitEvaluator()
+{
+}
+
+void CLib3MFImplicitEvaluator::Init()
+{
+		Isolate* isolate = Isolate::GetCurrent();
+
+		// Prepare constructor template
+		Local<FunctionTemplate> tpl = FunctionTemplate::New(isolate, New);
+		tpl->SetClassName(String::NewFromUtf8(isolate, "Lib3MFImplicitEvaluator"));
+		tpl->InstanceTemplate()->SetInternalFieldCount(NODEWRAPPER_FIELDCOUNT);
+
+		// Prototype
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetInputStride", GetInputStride);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetOutputStride", GetOutputStride);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetWorkerThreadCount", SetWorkerThreadCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetWorkerThreadCount", GetWorkerThreadCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "Evaluate", Evaluate);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "EvaluateBatch", EvaluateBatch);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "EvaluateBounds", EvaluateBounds);
+		constructor.Reset(isolate, tpl->GetFunction(isolate->GetCurrentContext()).ToLocalChecked());
+
+}
+
+void CLib3MFImplicitEvaluator::New(const FunctionCallbackInfo<Value>& args)
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+
+		if (args.IsConstructCall()) {
+				CLib3MFBaseClass * holderObj = ObjectWrap::Unwrap<CLib3MFBaseClass>(args.Holder());
+				CLib3MFImplicitEvaluator * implicitevaluatorInstance = new CLib3MFImplicitEvaluator();
+				implicitevaluatorInstance->Wrap(args.This());
+				args.GetReturnValue().Set(args.This());
+		} else {
+				RaiseError(isolate, "Lib3MFImplicitEvaluator: Invalid call to Constructor");
+		}
+}
+
+Local<Object> CLib3MFImplicitEvaluator::NewInstance(Local<Object> pParent, Lib3MFHandle pHandle)
+{
+		Isolate* isolate = Isolate::GetCurrent();
+		HandleScope scope(isolate);
+		Local<Function> cons = Local<Function>::New(isolate, constructor);
+		Local<Object> instance;
+		if (cons->NewInstance(isolate->GetCurrentContext()).ToLocal(&instance)) {
+			instance->SetInternalField(NODEWRAPPER_TABLEINDEX, External::New(isolate, CLib3MFBaseClass::getDynamicWrapperTable(pParent)));
+			instance->SetInternalField(NODEWRAPPER_HANDLEINDEX, External::New(isolate, pHandle));
+		}
+		return instance;
+}
+
+
+void CLib3MFImplicitEvaluator::GetInputStride(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
 		HandleScope scope(isolate);
 		try {
-        if (!args[0]->IsString()) {
-            throw std::runtime_error("Expected string parameter 0 (Identifier)");
-        }
-        if (!args[1]->IsString()) {
-            throw std::runtime_error("Expected string parameter 1 (DisplayName)");
-        }
-        if (!args[2]->IsString()) {
-            throw std::runtime_error("Expected string parameter 2 (Tag)");
-        }
-        v8::String::Utf8Value sutf8Identifier(isolate, args[0]);
-        std::string sIdentifier = *sutf8Identifier;
-        v8::String::Utf8Value sutf8DisplayName(isolate, args[1]);
-        std::string sDisplayName = *sutf8DisplayName;
-        v8::String::Utf8Value sutf8Tag(isolate, args[2]);
-        std::string sTag = *sutf8Tag;
-        Lib3MFHandle hReturnNode = nullptr;
+        unsigned int nReturnStride = 0;
         sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
         if (wrapperTable == nullptr)
-            throw std::runtime_error("Could not get wrapper table for Lib3MF method AddFunctionCallNode.");
-        if (wrapperTable->m_ImplicitFunction_AddFunctionCallNode == nullptr)
-            throw std::runtime_error("Could not call Lib3MF method ImplicitFunction::AddFunctionCallNode.");
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetInputStride.");
+        if (wrapperTable->m_ImplicitEvaluator_GetInputStride == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method ImplicitEvaluator::GetInputStride.");
         Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
-        Lib3MFResult errorCode = wrapperTable->m_ImplicitFunction_AddFunctionCallNode(instanceHandle, sIdentifier.c_str(), sDisplayName.c_str(), sTag.c_str(), &hReturnNode);
+        Lib3MFResult errorCode = wrapperTable->m_ImplicitEvaluator_GetInputStride(instanceHandle, &nReturnStride);
         CheckError(isolate, wrapperTable, instanceHandle, errorCode);
-        Local<Object> instanceObjNode = CLib3MFFunctionCallNode::NewInstance(args.Holder(), hReturnNode);
-        args.GetReturnValue().Set(instanceObjNode);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnStride));
 
 		} catch (std::exception & E) {
 				RaiseError(isolate, E.what());
@@ -19085,22 +19996,21 @@ void CLib3MFImplicitFunction::AddFunctionCallNode(const FunctionCallbackInfo<Val
 }
 
 
-void CLib3MFImplicitFunction::GetNodes(const FunctionCallbackInfo<Value>& args) 
+void CLib3MFImplicitEvaluator::GetOutputStride(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
 		HandleScope scope(isolate);
 		try {
-        Lib3MFHandle hReturnIterator = nullptr;
+        unsigned int nReturnStride = 0;
         sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
         if (wrapperTable == nullptr)
-            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetNodes.");
-        if (wrapperTable->m_ImplicitFunction_GetNodes == nullptr)
-            throw std::runtime_error("Could not call Lib3MF method ImplicitFunction::GetNodes.");
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetOutputStride.");
+        if (wrapperTable->m_ImplicitEvaluator_GetOutputStride == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method ImplicitEvaluator::GetOutputStride.");
         Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
-        Lib3MFResult errorCode = wrapperTable->m_ImplicitFunction_GetNodes(instanceHandle, &hReturnIterator);
+        Lib3MFResult errorCode = wrapperTable->m_ImplicitEvaluator_GetOutputStride(instanceHandle, &nReturnStride);
         CheckError(isolate, wrapperTable, instanceHandle, errorCode);
-        Local<Object> instanceObjIterator = CLib3MFNodeIterator::NewInstance(args.Holder(), hReturnIterator);
-        args.GetReturnValue().Set(instanceObjIterator);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnStride));
 
 		} catch (std::exception & E) {
 				RaiseError(isolate, E.what());
@@ -19108,26 +20018,22 @@ void CLib3MFImplicitFunction::GetNodes(const FunctionCallbackInfo<Value>& args)
 }
 
 
-void CLib3MFImplicitFunction::RemoveNode(const FunctionCallbackInfo<Value>& args) 
+void CLib3MFImplicitEvaluator::SetWorkerThreadCount(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
 		HandleScope scope(isolate);
 		try {
-        if (!args[0]->IsObject()) {
-            throw std::runtime_error("Expected class parameter 0 (Node)");
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 0 (ThreadCount)");
         }
-        Local<Object> objNode = args[0]->ToObject(isolate->GetCurrentContext()).ToLocalChecked();
-        CLib3MFImplicitNode * instanceNode = ObjectWrap::Unwrap<CLib3MFImplicitNode>(objNode);
-        if (instanceNode == nullptr)
-            throw std::runtime_error("Invalid Object parameter 0 (Node)");
-        Lib3MFHandle hNode = instanceNode->getHandle( objNode );
+        unsigned int nThreadCount = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
         sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
         if (wrapperTable == nullptr)
-            throw std::runtime_error("Could not get wrapper table for Lib3MF method RemoveNode.");
-        if (wrapperTable->m_ImplicitFunction_RemoveNode == nullptr)
-            throw std::runtime_error("Could not call Lib3MF method ImplicitFunction::RemoveNode.");
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetWorkerThreadCount.");
+        if (wrapperTable->m_ImplicitEvaluator_SetWorkerThreadCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method ImplicitEvaluator::SetWorkerThreadCount.");
         Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
-        Lib3MFResult errorCode = wrapperTable->m_ImplicitFunction_RemoveNode(instanceHandle, hNode);
+        Lib3MFResult errorCode = wrapperTable->m_ImplicitEvaluator_SetWorkerThreadCount(instanceHandle, nThreadCount);
         CheckError(isolate, wrapperTable, instanceHandle, errorCode);
 
 		} catch (std::exception & E) {
@@ -19136,35 +20042,21 @@ void CLib3MFImplicitFunction::RemoveNode(const FunctionCallbackInfo<Value>& args
 }
 
 
-void CLib3MFImplicitFunction::AddLink(const FunctionCallbackInfo<Value>& args) 
+void CLib3MFImplicitEvaluator::GetWorkerThreadCount(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
 		HandleScope scope(isolate);
 		try {
-        if (!args[0]->IsObject()) {
-            throw std::runtime_error("Expected class parameter 0 (Source)");
-        }
-        if (!args[1]->IsObject()) {
-            throw std::runtime_error("Expected class parameter 1 (Target)");
-        }
-        Local<Object> objSource = args[0]->ToObject(isolate->GetCurrentContext()).ToLocalChecked();
-        CLib3MFImplicitPort * instanceSource = ObjectWrap::Unwrap<CLib3MFImplicitPort>(objSource);
-        if (instanceSource == nullptr)
-            throw std::runtime_error("Invalid Object parameter 0 (Source)");
-        Lib3MFHandle hSource = instanceSource->getHandle( objSource );
-        Local<Object> objTarget = args[1]->ToObject(isolate->GetCurrentContext()).ToLocalChecked();
-        CLib3MFImplicitPort * instanceTarget = ObjectWrap::Unwrap<CLib3MFImplicitPort>(objTarget);
-        if (instanceTarget == nullptr)
-            throw std::runtime_error("Invalid Object parameter 1 (Target)");
-        Lib3MFHandle hTarget = instanceTarget->getHandle( objTarget );
+        unsigned int nReturnThreadCount = 0;
         sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
         if (wrapperTable == nullptr)
-            throw std::runtime_error("Could not get wrapper table for Lib3MF method AddLink.");
-        if (wrapperTable->m_ImplicitFunction_AddLink == nullptr)
-            throw std::runtime_error("Could not call Lib3MF method ImplicitFunction::AddLink.");
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetWorkerThreadCount.");
+        if (wrapperTable->m_ImplicitEvaluator_GetWorkerThreadCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method ImplicitEvaluator::GetWorkerThreadCount.");
         Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
-        Lib3MFResult errorCode = wrapperTable->m_ImplicitFunction_AddLink(instanceHandle, hSource, hTarget);
+        Lib3MFResult errorCode = wrapperTable->m_ImplicitEvaluator_GetWorkerThreadCount(instanceHandle, &nReturnThreadCount);
         CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnThreadCount));
 
 		} catch (std::exception & E) {
 				RaiseError(isolate, E.what());
@@ -19172,28 +20064,18 @@ void CLib3MFImplicitFunction::AddLink(const FunctionCallbackInfo<Value>& args)
 }
 
 
-void CLib3MFImplicitFunction::AddLinkByNames(const FunctionCallbackInfo<Value>& args) 
+void CLib3MFImplicitEvaluator::Evaluate(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
 		HandleScope scope(isolate);
 		try {
-        if (!args[0]->IsString()) {
-            throw std::runtime_error("Expected string parameter 0 (Source)");
-        }
-        if (!args[1]->IsString()) {
-            throw std::runtime_error("Expected string parameter 1 (Target)");
-        }
-        v8::String::Utf8Value sutf8Source(isolate, args[0]);
-        std::string sSource = *sutf8Source;
-        v8::String::Utf8Value sutf8Target(isolate, args[1]);
-        std::string sTarget = *sutf8Target;
         sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
         if (wrapperTable == nullptr)
-            throw std::runtime_error("Could not get wrapper table for Lib3MF method AddLinkByNames.");
-        if (wrapperTable->m_ImplicitFunction_AddLinkByNames == nullptr)
-            throw std::runtime_error("Could not call Lib3MF method ImplicitFunction::AddLinkByNames.");
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method Evaluate.");
+        if (wrapperTable->m_ImplicitEvaluator_Evaluate == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method ImplicitEvaluator::Evaluate.");
         Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
-        Lib3MFResult errorCode = wrapperTable->m_ImplicitFunction_AddLinkByNames(instanceHandle, sSource.c_str(), sTarget.c_str());
+        Lib3MFResult errorCode = wrapperTable->m_ImplicitEvaluator_Evaluate(instanceHandle, 0, nullptr, 0, nullptr, nullptr);
         CheckError(isolate, wrapperTable, instanceHandle, errorCode);
 
 		} catch (std::exception & E) {
@@ -19202,18 +20084,18 @@ void CLib3MFImplicitFunction::AddLinkByNames(const FunctionCallbackInfo<Value>&
 }
 
 
-void CLib3MFImplicitFunction::Clear(const FunctionCallbackInfo<Value>& args) 
+void CLib3MFImplicitEvaluator::EvaluateBatch(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
 		HandleScope scope(isolate);
 		try {
         sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
         if (wrapperTable == nullptr)
-            throw std::runtime_error("Could not get wrapper table for Lib3MF method Clear.");
-        if (wrapperTable->m_ImplicitFunction_Clear == nullptr)
-            throw std::runtime_error("Could not call Lib3MF method ImplicitFunction::Clear.");
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method EvaluateBatch.");
+        if (wrapperTable->m_ImplicitEvaluator_EvaluateBatch == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method ImplicitEvaluator::EvaluateBatch.");
         Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
-        Lib3MFResult errorCode = wrapperTable->m_ImplicitFunction_Clear(instanceHandle);
+        Lib3MFResult errorCode = wrapperTable->m_ImplicitEvaluator_EvaluateBatch(instanceHandle, 0, nullptr, 0, nullptr, nullptr);
         CheckError(isolate, wrapperTable, instanceHandle, errorCode);
 
 		} catch (std::exception & E) {
@@ -19222,18 +20104,18 @@ void CLib3MFImplicitFunction::Clear(const FunctionCallbackInfo<Value>& args)
 }
 
 
-void CLib3MFImplicitFunction::SortNodesTopologically(const FunctionCallbackInfo<Value>& args) 
+void CLib3MFImplicitEvaluator::EvaluateBounds(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
 		HandleScope scope(isolate);
 		try {
         sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
         if (wrapperTable == nullptr)
-            throw std::runtime_error("Could not get wrapper table for Lib3MF method SortNodesTopologically.");
-        if (wrapperTable->m_ImplicitFunction_SortNodesTopologically == nullptr)
-            throw std::runtime_error("Could not call Lib3MF method ImplicitFunction::SortNodesTopologically.");
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method EvaluateBounds.");
+        if (wrapperTable->m_ImplicitEvaluator_EvaluateBounds == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method ImplicitEvaluator::EvaluateBounds.");
         Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
-        Lib3MFResult errorCode = wrapperTable->m_ImplicitFunction_SortNodesTopologically(instanceHandle);
+        Lib3MFResult errorCode = wrapperTable->m_ImplicitEvaluator_EvaluateBounds(instanceHandle, 0, nullptr, 0, nullptr, 0, nullptr, nullptr, 0, nullptr, nullptr);
         CheckError(isolate, wrapperTable, instanceHandle, errorCode);
 
 		} catch (std::exception & E) {
@@ -19274,6 +20156,7 @@ void CLib3MFFunctionFromImage3D::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetOffset", SetOffset);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetScale", GetScale);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetScale", SetScale);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "CreateSampler", CreateSampler);
 		constructor.Reset(isolate, tpl->GetFunction(isolate->GetCurrentContext()).ToLocalChecked());
 
 }
@@ -19555,6 +20438,203 @@ void CLib3MFFunctionFromImage3D::SetScale(const FunctionCallbackInfo<Value>& arg
 		}
 }
 
+
+void CLib3MFFunctionFromImage3D::CreateSampler(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        Lib3MFHandle hReturnSampler = nullptr;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method CreateSampler.");
+        if (wrapperTable->m_FunctionFromImage3D_CreateSampler == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method FunctionFromImage3D::CreateSampler.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_FunctionFromImage3D_CreateSampler(instanceHandle, &hReturnSampler);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        Local<Object> instanceObjSampler = CLib3MFImage3DSampler::NewInstance(args.Holder(), hReturnSampler);
+        args.GetReturnValue().Set(instanceObjSampler);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+/*************************************************************************************************************************
+ Class CLib3MFImage3DSampler Implementation
+**************************************************************************************************************************/
+
+CLib3MFImage3DSampler::CLib3MFImage3DSampler()
+		: CLib3MFBaseClass()
+{
+}
+
+CLib3MFImage3DSampler::~CLib3MFImage3DSampler()
+{
+}
+
+void CLib3MFImage3DSampler::Init()
+{
+		Isolate* isolate = Isolate::GetCurrent();
+
+		// Prepare constructor template
+		Local<FunctionTemplate> tpl = FunctionTemplate::New(isolate, New);
+		tpl->SetClassName(String::NewFromUtf8(isolate, "Lib3MFImage3DSampler"));
+		tpl->InstanceTemplate()->SetInternalFieldCount(NODEWRAPPER_FIELDCOUNT);
+
+		// Prototype
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetCacheSize", SetCacheSize);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetCacheSize", GetCacheSize);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "SetWorkerThreadCount", SetWorkerThreadCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "GetWorkerThreadCount", GetWorkerThreadCount);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "Sample", Sample);
+		constructor.Reset(isolate, tpl->GetFunction(isolate->GetCurrentContext()).ToLocalChecked());
+
+}
+
+void CLib3MFImage3DSampler::New(const FunctionCallbackInfo<Value>& args)
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+
+		if (args.IsConstructCall()) {
+				CLib3MFBaseClass * holderObj = ObjectWrap::Unwrap<CLib3MFBaseClass>(args.Holder());
+				CLib3MFImage3DSampler * image3dsamplerInstance = new CLib3MFImage3DSampler();
+				image3dsamplerInstance->Wrap(args.This());
+				args.GetReturnValue().Set(args.This());
+		} else {
+				RaiseError(isolate, "Lib3MFImage3DSampler: Invalid call to Constructor");
+		}
+}
+
+Local<Object> CLib3MFImage3DSampler::NewInstance(Local<Object> pParent, Lib3MFHandle pHandle)
+{
+		Isolate* isolate = Isolate::GetCurrent();
+		HandleScope scope(isolate);
+		Local<Function> cons = Local<Function>::New(isolate, constructor);
+		Local<Object> instance;
+		if (cons->NewInstance(isolate->GetCurrentContext()).ToLocal(&instance)) {
+			instance->SetInternalField(NODEWRAPPER_TABLEINDEX, External::New(isolate, CLib3MFBaseClass::getDynamicWrapperTable(pParent)));
+			instance->SetInternalField(NODEWRAPPER_HANDLEINDEX, External::New(isolate, pHandle));
+		}
+		return instance;
+}
+
+
+void CLib3MFImage3DSampler::SetCacheSize(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsString()) {
+            throw std::runtime_error("Expected uint64 parameter 0 (CacheSize)");
+        }
+        v8::String::Utf8Value sutf8CacheSize(isolate, args[0]);
+        std::string sCacheSize = *sutf8CacheSize;
+        uint64_t nCacheSize = stoull(sCacheSize);
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetCacheSize.");
+        if (wrapperTable->m_Image3DSampler_SetCacheSize == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Image3DSampler::SetCacheSize.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Image3DSampler_SetCacheSize(instanceHandle, nCacheSize);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFImage3DSampler::GetCacheSize(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        uint64_t nReturnCacheSize = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetCacheSize.");
+        if (wrapperTable->m_Image3DSampler_GetCacheSize == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Image3DSampler::GetCacheSize.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Image3DSampler_GetCacheSize(instanceHandle, &nReturnCacheSize);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(String::NewFromUtf8(isolate, std::to_string(nReturnCacheSize).c_str()));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFImage3DSampler::SetWorkerThreadCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsUint32()) {
+            throw std::runtime_error("Expected uint32 parameter 0 (ThreadCount)");
+        }
+        unsigned int nThreadCount = (unsigned int) args[0]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method SetWorkerThreadCount.");
+        if (wrapperTable->m_Image3DSampler_SetWorkerThreadCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Image3DSampler::SetWorkerThreadCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Image3DSampler_SetWorkerThreadCount(instanceHandle, nThreadCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFImage3DSampler::GetWorkerThreadCount(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        unsigned int nReturnThreadCount = 0;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method GetWorkerThreadCount.");
+        if (wrapperTable->m_Image3DSampler_GetWorkerThreadCount == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Image3DSampler::GetWorkerThreadCount.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Image3DSampler_GetWorkerThreadCount(instanceHandle, &nReturnThreadCount);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+        args.GetReturnValue().Set(Integer::NewFromUnsigned(isolate, nReturnThreadCount));
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
+void CLib3MFImage3DSampler::Sample(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method Sample.");
+        if (wrapperTable->m_Image3DSampler_Sample == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method Image3DSampler::Sample.");
+        Lib3MFHandle instanceHandle = CLib3MFBaseClass::getHandle(args.Holder());
+        Lib3MFResult errorCode = wrapperTable->m_Image3DSampler_Sample(instanceHandle, 0, nullptr, 0, nullptr, nullptr);
+        CheckError(isolate, wrapperTable, instanceHandle, errorCode);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
 /*************************************************************************************************************************
  Class CLib3MFBuildItem Implementation
 **************************************************************************************************************************/
@@ -24064,6 +25144,7 @@ void CLib3MFWrapper::Init()
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetBuildInformation", GetBuildInformation);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "GetSpecificationVersion", GetSpecificationVersion);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "CreateModel", CreateModel);
+		NODE_SET_PROTOTYPE_METHOD(tpl, "CreateStreamingWriter", CreateStreamingWriter);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "Release", Release);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "Acquire", Acquire);
 		NODE_SET_PROTOTYPE_METHOD(tpl, "SetJournal", SetJournal);
@@ -24181,6 +25262,13 @@ void CLib3MFWrapper::New(const FunctionCallbackInfo<Value>& args)
 						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "eCompositionMethod_Mask"), Integer::New(isolate, 4));
 						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "eCompositionSpace_Raw"), Integer::New(isolate, 0));
 						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "eCompositionSpace_LinearColor"), Integer::New(isolate, 1));
+						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "ePackagePartType_Model"), Integer::New(isolate, 0));
+						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "ePackagePartType_Image"), Integer::New(isolate, 1));
+						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "ePackagePartType_Attachment"), Integer::New(isolate, 2));
+						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "eCompressionLevel_Stored"), Integer::New(isolate, 0));
+						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "eCompressionLevel_Fastest"), Integer::New(isolate, 1));
+						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "eCompressionLevel_Default"), Integer::New(isolate, 6));
+						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "eCompressionLevel_Maximum"), Integer::New(isolate, 9));
 						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "eImplicitNodeType_Addition"), Integer::New(isolate, 0));
 						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "eImplicitNodeType_Subtraction"), Integer::New(isolate, 1));
 						newObject->Set(isolate->GetCurrentContext(), String::NewFromUtf8(isolate, "eImplicitNodeType_Multiplication"), Integer::New(isolate, 2));
@@ -24421,6 +25509,37 @@ void CLib3MFWrapper::CreateModel(const FunctionCallbackInfo<Value>& args)
 }
 
 
+void CLib3MFWrapper::CreateStreamingWriter(const FunctionCallbackInfo<Value>& args) 
+{
+		Isolate* isolate = args.GetIsolate();
+		HandleScope scope(isolate);
+		try {
+        if (!args[0]->IsString()) {
+            throw std::runtime_error("Expected string parameter 0 (Filename)");
+        }
+        if (!args[1]->IsUint32()) {
+            throw std::runtime_error("Expected enum parameter 1 (Unit)");
+        }
+        v8::String::Utf8Value sutf8Filename(isolate, args[0]);
+        std::string sFilename = *sutf8Filename;
+        unsigned int eUnit = (unsigned int) args[1]->IntegerValue(isolate->GetCurrentContext()).ToChecked();
+        Lib3MFHandle hReturnStreamingWriter = nullptr;
+        sLib3MFDynamicWrapperTable * wrapperTable = CLib3MFBaseClass::getDynamicWrapperTable(args.Holder());
+        if (wrapperTable == nullptr)
+            throw std::runtime_error("Could not get wrapper table for Lib3MF method CreateStreamingWriter.");
+        if (wrapperTable->m_CreateStreamingWriter == nullptr)
+            throw std::runtime_error("Could not call Lib3MF method CreateStreamingWriter.");
+        Lib3MFResult errorCode = wrapperTable->m_CreateStreamingWriter(sFilename.c_str(), (eLib3MFModelUnit) eUnit, &hReturnStreamingWriter);
+        CheckError(isolate, wrapperTable, nullptr, errorCode);
+        Local<Object> instanceObjStreamingWriter = CLib3MFStreamingWriter::NewInstance(args.Holder(), hReturnStreamingWriter);
+        args.GetReturnValue().Set(instanceObjStreamingWriter);
+
+		} catch (std::exception & E) {
+				RaiseError(isolate, E.what());
+		}
+}
+
+
 void CLib3MFWrapper::Release(const FunctionCallbackInfo<Value>& args) 
 {
 		Isolate* isolate = args.GetIsolate();
@@ -101,6 +101,12 @@ private:
 	static void SetProgressCallback(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetDecimalPrecision(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetDecimalPrecision(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetShortestRoundtripActive(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetShortestRoundtripActive(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetWorkerThreadCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetWorkerThreadCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetCompressionLevel(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetCompressionLevel(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetStrictModeActive(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetStrictModeActive(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetWarning(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -132,6 +138,11 @@ private:
 	static void RemoveRelationToRead(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetStrictModeActive(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetStrictModeActive(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetWorkerThreadCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetWorkerThreadCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetMeshStreamCallbacks(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetLazyMeshLoadingActive(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetLazyMeshLoadingActive(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetWarning(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetWarningCount(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void AddKeyWrappingCallback(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -146,6 +157,29 @@ public:
 	
 };
 
+/*************************************************************************************************************************
+ Class CLib3MFStreamingWriter 
+**************************************************************************************************************************/
+class CLib3MFStreamingWriter : public CLib3MFBaseClass {
+private:
+	static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static v8::Persistent<v8::Function> constructor;
+	static void BeginMeshObject(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void AddVertices(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void AddTriangles(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void EndMeshObject(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void AddBuildItem(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void Finish(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+public:
+	CLib3MFStreamingWriter();
+	~CLib3MFStreamingWriter();
+	
+	static void Init();
+	static v8::Local<v8::Object> NewInstance(v8::Local<v8::Object>, Lib3MFHandle pHandle);
+	
+};
+
 /*************************************************************************************************************************
  Class CLib3MFPackagePart 
 **************************************************************************************************************************/
@@ -577,10 +611,14 @@ private:
 	static void SetVertex(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void AddVertex(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetVertices(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetVertexPageCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetVertexPage(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetTriangle(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetTriangle(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void AddTriangle(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetTriangleIndices(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetTrianglePageCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetTrianglePage(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetObjectLevelProperty(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetObjectLevelProperty(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetTriangleProperties(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -589,7 +627,9 @@ private:
 	static void GetAllTriangleProperties(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void ClearAllProperties(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetGeometry(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void ReserveGeometry(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void IsManifoldAndOriented(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void IsGeometryLoaded(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void BeamLattice(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetVolumeData(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetVolumeData(const v8::FunctionCallbackInfo<v8::Value>& args);
@@ -2271,6 +2311,7 @@ private:
 	static void AddLinkByNames(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void Clear(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SortNodesTopologically(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void CreateEvaluator(const v8::FunctionCallbackInfo<v8::Value>& args);
 
 public:
 	CLib3MFImplicitFunction();
@@ -2281,6 +2322,30 @@ public:
 	
 };
 
+/*************************************************************************************************************************
+ Class CLib3MFImplicitEvaluator 
+**************************************************************************************************************************/
+class CLib3MFImplicitEvaluator : public CLib3MFBaseClass {
+private:
+	static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static v8::Persistent<v8::Function> constructor;
+	static void GetInputStride(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetOutputStride(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetWorkerThreadCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetWorkerThreadCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void Evaluate(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void EvaluateBatch(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void EvaluateBounds(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+public:
+	CLib3MFImplicitEvaluator();
+	~CLib3MFImplicitEvaluator();
+	
+	static void Init();
+	static v8::Local<v8::Object> NewInstance(v8::Local<v8::Object>, Lib3MFHandle pHandle);
+	
+};
+
 /*************************************************************************************************************************
  Class CLib3MFFunctionFromImage3D 
 **************************************************************************************************************************/
@@ -2298,6 +2363,7 @@ private:
 	static void SetOffset(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetScale(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetScale(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void CreateSampler(const v8::FunctionCallbackInfo<v8::Value>& args);
 
 public:
 	CLib3MFFunctionFromImage3D();
@@ -2308,6 +2374,28 @@ public:
 	
 };
 
+/*************************************************************************************************************************
+ Class CLib3MFImage3DSampler 
+**************************************************************************************************************************/
+class CLib3MFImage3DSampler : public CLib3MFBaseClass {
+private:
+	static void New(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static v8::Persistent<v8::Function> constructor;
+	static void SetCacheSize(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetCacheSize(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void SetWorkerThreadCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void GetWorkerThreadCount(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void Sample(const v8::FunctionCallbackInfo<v8::Value>& args);
+
+public:
+	CLib3MFImage3DSampler();
+	~CLib3MFImage3DSampler();
+	
+	static void Init();
+	static v8::Local<v8::Object> NewInstance(v8::Local<v8::Object>, Lib3MFHandle pHandle);
+	
+};
+
 /*************************************************************************************************************************
  Class CLib3MFBuildItem 
 **************************************************************************************************************************/
@@ -2655,6 +2743,7 @@ private:
 	static void GetBuildInformation(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void GetSpecificationVersion(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void CreateModel(const v8::FunctionCallbackInfo<v8::Value>& args);
+	static void CreateStreamingWriter(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void Release(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void Acquire(const v8::FunctionCallbackInfo<v8::Value>& args);
 	static void SetJournal(const v8::FunctionCallbackInfo<v8::Value>& args);
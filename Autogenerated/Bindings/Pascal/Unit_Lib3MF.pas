@@ -254,6 +254,19 @@ type
 		eCompositionSpaceLinearColor
 	);
 
+	TLib3MFPackagePartType = (
+		ePackagePartTypeModel,
+		ePackagePartTypeImage,
+		ePackagePartTypeAttachment
+	);
+
+	TLib3MFCompressionLevel = (
+		eCompressionLevelStored,
+		eCompressionLevelFastest,
+		eCompressionLevelDefault,
+		eCompressionLevelMaximum
+	);
+
 	TLib3MFImplicitNodeType = (
 		eImplicitNodeTypeAddition,
 		eImplicitNodeTypeSubtraction,
@@ -466,6 +479,8 @@ type
 	PLib3MF_ReadCallback = function(const nByteData: QWord; const nNumBytes: QWord; const pUserData: Pointer): Integer; cdecl;
 	PLib3MF_SeekCallback = function(const nPosition: QWord; const pUserData: Pointer): Integer; cdecl;
 	PLib3MF_RandomNumberCallback = function(const nByteData: QWord; const nNumBytes: QWord; const pUserData: Pointer; out pBytesWritten: QWord): Integer; cdecl;
+	PLib3MF_VertexBlockCallback = function(const nUniqueResourceID: Cardinal; const nStartIndex: Cardinal; const nVerticesCount: QWord; const pVerticesBuffer: PLib3MFPosition; const pUserData: Pointer): Integer; cdecl;
+	PLib3MF_TriangleBlockCallback = function(const nUniqueResourceID: Cardinal; const nStartIndex: Cardinal; const nTrianglesCount: QWord; const pTrianglesBuffer: PLib3MFTriangle; const pUserData: Pointer): Integer; cdecl;
 	PLib3MF_KeyWrappingCallback = function(const pKEKParams: TLib3MFHandle; const nInBufferCount: QWord; const nOutBufferCount: QWord; const pUserData: Pointer; out pStatus: QWord): Integer; cdecl;
 	PLib3MF_ContentEncryptionCallback = function(const pCEKParams: TLib3MFHandle; const nInputCount: QWord; const nOutputCount: QWord; const pUserData: Pointer; out pStatus: QWord): Integer; cdecl;
 
@@ -478,6 +493,7 @@ type
 	TLib3MFBase = class;
 	TLib3MFWriter = class;
 	TLib3MFReader = class;
+	TLib3MFStreamingWriter = class;
 	TLib3MFPackagePart = class;
 	TLib3MFResource = class;
 	TLib3MFResourceIterator = class;
@@ -579,7 +595,9 @@ type
 	TLib3MFNodeIterator = class;
 	TLib3MFFunction = class;
 	TLib3MFImplicitFunction = class;
+	TLib3MFImplicitEvaluator = class;
 	TLib3MFFunctionFromImage3D = class;
+	TLib3MFImage3DSampler = class;
 	TLib3MFBuildItem = class;
 	TLib3MFBuildItemIterator = class;
 	TLib3MFSlice = class;
@@ -679,6 +697,62 @@ type
 	*)
 	TLib3MFWriter_SetDecimalPrecisionFunc = function(pWriter: TLib3MFHandle; const nDecimalPrecision: Cardinal): TLib3MFResult; cdecl;
 	
+	(**
+	* Activates (deactivates) the shortest round-trip output of mesh coordinates and radii. Each value is written with the fewest digits that read back as exactly the same number; the decimal precision is ignored while active.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[in] bShortestRoundtripActive - flag whether shortest round-trip output is active or not.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_SetShortestRoundtripActiveFunc = function(pWriter: TLib3MFHandle; const bShortestRoundtripActive: Byte): TLib3MFResult; cdecl;
+	
+	(**
+	* Queries whether the shortest round-trip output of mesh coordinates and radii is active or not.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[out] pShortestRoundtripActive - returns flag whether shortest round-trip output is active or not.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_GetShortestRoundtripActiveFunc = function(pWriter: TLib3MFHandle; out pShortestRoundtripActive: Byte): TLib3MFResult; cdecl;
+	
+	(**
+	* Sets the number of threads the writer may use to compress package parts and to render large meshes. 0 selects the number of hardware threads, 1 disables parallel writing.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[in] nThreadCount - Number of threads, including the calling thread. 0 means automatic.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_SetWorkerThreadCountFunc = function(pWriter: TLib3MFHandle; const nThreadCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the number of threads the writer may use to compress package parts and to render large meshes.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[out] pThreadCount - Number of threads, including the calling thread. 0 means automatic.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_GetWorkerThreadCountFunc = function(pWriter: TLib3MFHandle; out pThreadCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Sets the compression of all parts of a kind. Already compressed images are best stored without compression.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[in] ePartType - The kind of parts to configure.
+	* @param[in] eLevel - The compression level. Defaults to Fastest for all kinds of parts. Once it is set, encrypted parts are deflated with it before encryption and stored without further compression.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_SetCompressionLevelFunc = function(pWriter: TLib3MFHandle; const ePartType: Integer; const eLevel: Integer): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the compression of all parts of a kind.
+	*
+	* @param[in] pWriter - Writer instance.
+	* @param[in] ePartType - The kind of parts to query.
+	* @param[out] pLevel - The compression level.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFWriter_GetCompressionLevelFunc = function(pWriter: TLib3MFHandle; const ePartType: Integer; out pLevel: Integer): TLib3MFResult; cdecl;
+	
 	(**
 	* Activates (deactivates) the strict mode of the reader.
 	*
@@ -822,6 +896,54 @@ type
 	*)
 	TLib3MFReader_GetStrictModeActiveFunc = function(pReader: TLib3MFHandle; out pStrictModeActive: Byte): TLib3MFResult; cdecl;
 	
+	(**
+	* Sets the number of threads the reader may use to decode mesh data. 0 selects the number of hardware threads. With 1 (the default), vertex and triangle lists are still decoded by the streaming mesh decoder, but on the calling thread only.
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[in] nThreadCount - Number of threads, including the calling thread. 0 means automatic.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_SetWorkerThreadCountFunc = function(pReader: TLib3MFHandle; const nThreadCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the number of threads the reader may use to decode mesh data.
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[out] pThreadCount - Number of threads, including the calling thread. 0 means automatic.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_GetWorkerThreadCountFunc = function(pReader: TLib3MFHandle; out pThreadCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Hands the vertices and triangles of all mesh objects to callbacks in blocks while they are read. Blocks of one mesh object are delivered in document order, and vertices are delivered before the triangles that refer to them. If the geometry is not retained, the meshes of the read model stay empty, while objects, components and build items are still read. Beam lattices and triangle sets require the geometry to be retained.
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[in] pTheVertexBlockCallback - Callback to call for every block of vertices. May be null.
+	* @param[in] pTheTriangleBlockCallback - Callback to call for every block of triangles. May be null.
+	* @param[in] bRetainGeometry - If true, the geometry is read into the model as well.
+	* @param[in] pUserData - Userdata that is passed to the callback functions
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_SetMeshStreamCallbacksFunc = function(pReader: TLib3MFHandle; const pTheVertexBlockCallback: PLib3MF_VertexBlockCallback; const pTheTriangleBlockCallback: PLib3MF_TriangleBlockCallback; const bRetainGeometry: Byte; const pUserData: Pointer): TLib3MFResult; cdecl;
+	
+	(**
+	* Defers parsing the geometry of mesh objects until it is first accessed. The model part is kept in memory after reading, and each mesh is parsed from it on first access. Ignored if mesh stream callbacks are set.
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[in] bLazyMeshLoadingActive - Flag whether mesh geometry is parsed on first access
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_SetLazyMeshLoadingActiveFunc = function(pReader: TLib3MFHandle; const bLazyMeshLoadingActive: Byte): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns whether mesh geometry is parsed on first access.
+	*
+	* @param[in] pReader - Reader instance.
+	* @param[out] pLazyMeshLoadingActive - Flag whether mesh geometry is parsed on first access
+	* @return error code or 0 (success)
+	*)
+	TLib3MFReader_GetLazyMeshLoadingActiveFunc = function(pReader: TLib3MFHandle; out pLazyMeshLoadingActive: Byte): TLib3MFResult; cdecl;
+	
 	(**
 	* Returns Warning and Error Information of the read process
 	*
@@ -866,6 +988,67 @@ type
 	TLib3MFReader_SetContentEncryptionCallbackFunc = function(pReader: TLib3MFHandle; const pTheCallback: PLib3MF_ContentEncryptionCallback; const pUserData: Pointer): TLib3MFResult; cdecl;
 	
 
+(*************************************************************************************************************************
+ Function type definitions for StreamingWriter
+**************************************************************************************************************************)
+
+	(**
+	* Starts a new mesh object. All of its vertices must be added before its triangles.
+	*
+	* @param[in] pStreamingWriter - StreamingWriter instance.
+	* @param[in] pName - Name of the object. May be empty.
+	* @param[out] pObjectID - Resource ID of the new mesh object.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFStreamingWriter_BeginMeshObjectFunc = function(pStreamingWriter: TLib3MFHandle; const pName: PAnsiChar; out pObjectID: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Writes a batch of vertices of the current mesh object. Vertex indices continue over all batches of the object.
+	*
+	* @param[in] pStreamingWriter - StreamingWriter instance.
+	* @param[in] nVerticesCount - Number of elements in buffer
+	* @param[in] pVerticesBuffer - Position buffer of Positions of the vertices
+	* @return error code or 0 (success)
+	*)
+	TLib3MFStreamingWriter_AddVerticesFunc = function(pStreamingWriter: TLib3MFHandle; const nVerticesCount: QWord; const pVerticesBuffer: PLib3MFPosition): TLib3MFResult; cdecl;
+	
+	(**
+	* Writes a batch of triangles of the current mesh object. No further vertices may be added to the object afterwards.
+	*
+	* @param[in] pStreamingWriter - StreamingWriter instance.
+	* @param[in] nIndicesCount - Number of elements in buffer
+	* @param[in] pIndicesBuffer - Triangle buffer of Vertex indices of the triangles. They must refer to vertices, which have already been added to the object.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFStreamingWriter_AddTrianglesFunc = function(pStreamingWriter: TLib3MFHandle; const nIndicesCount: QWord; const pIndicesBuffer: PLib3MFTriangle): TLib3MFResult; cdecl;
+	
+	(**
+	* Finishes the current mesh object.
+	*
+	* @param[in] pStreamingWriter - StreamingWriter instance.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFStreamingWriter_EndMeshObjectFunc = function(pStreamingWriter: TLib3MFHandle): TLib3MFResult; cdecl;
+	
+	(**
+	* Adds a build item. It is written when the package is finished.
+	*
+	* @param[in] pStreamingWriter - StreamingWriter instance.
+	* @param[in] nObjectID - Resource ID of a finished mesh object.
+	* @param[in] pTransform - Transformation matrix.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFStreamingWriter_AddBuildItemFunc = function(pStreamingWriter: TLib3MFHandle; const nObjectID: Cardinal; const pTransform: PLib3MFTransform): TLib3MFResult; cdecl;
+	
+	(**
+	* Writes the build items and closes the package. No further calls are allowed afterwards.
+	*
+	* @param[in] pStreamingWriter - StreamingWriter instance.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFStreamingWriter_FinishFunc = function(pStreamingWriter: TLib3MFHandle): TLib3MFResult; cdecl;
+	
+
 (*************************************************************************************************************************
  Function type definitions for PackagePart
 **************************************************************************************************************************)
@@ -1765,6 +1948,27 @@ type
 	*)
 	TLib3MFMeshObject_GetVerticesFunc = function(pMeshObject: TLib3MFHandle; const nVerticesCount: QWord; out pVerticesNeededCount: QWord; pVerticesBuffer: PLib3MFPosition): TLib3MFResult; cdecl;
 	
+	(**
+	* Returns the number of pages in which the vertices of the mesh object are stored.
+	*
+	* @param[in] pMeshObject - MeshObject instance.
+	* @param[out] pPageCount - the number of vertex pages.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFMeshObject_GetVertexPageCountFunc = function(pMeshObject: TLib3MFHandle; out pPageCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns direct read access to a page of vertices without copying them. The memory is owned by the mesh object, must not be written to and is only valid until the mesh is modified or released.
+	*
+	* @param[in] pMeshObject - MeshObject instance.
+	* @param[in] nPageIndex - index of the page (0 to pagecount - 1).
+	* @param[out] pVertexCount - number of vertices stored in the page.
+	* @param[out] pStride - distance in bytes between two consecutive vertices.
+	* @param[out] pCoordinates - pointer to the three single precision coordinates of the first vertex in the page.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFMeshObject_GetVertexPageFunc = function(pMeshObject: TLib3MFHandle; const nPageIndex: Cardinal; out pVertexCount: Cardinal; out pStride: Cardinal; out pCoordinates: Pointer): TLib3MFResult; cdecl;
+	
 	(**
 	* Returns indices of a single triangle of a mesh object.
 	*
@@ -1806,6 +2010,27 @@ type
 	*)
 	TLib3MFMeshObject_GetTriangleIndicesFunc = function(pMeshObject: TLib3MFHandle; const nIndicesCount: QWord; out pIndicesNeededCount: QWord; pIndicesBuffer: PLib3MFTriangle): TLib3MFResult; cdecl;
 	
+	(**
+	* Returns the number of pages in which the triangles of the mesh object are stored.
+	*
+	* @param[in] pMeshObject - MeshObject instance.
+	* @param[out] pPageCount - the number of triangle pages.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFMeshObject_GetTrianglePageCountFunc = function(pMeshObject: TLib3MFHandle; out pPageCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns direct read access to a page of triangles without copying them. The memory is owned by the mesh object, must not be written to and is only valid until the mesh is modified or released.
+	*
+	* @param[in] pMeshObject - MeshObject instance.
+	* @param[in] nPageIndex - index of the page (0 to pagecount - 1).
+	* @param[out] pTriangleCount - number of triangles stored in the page.
+	* @param[out] pStride - distance in bytes between two consecutive triangles.
+	* @param[out] pIndices - pointer to the three 32 bit vertex indices of the first triangle in the page.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFMeshObject_GetTrianglePageFunc = function(pMeshObject: TLib3MFHandle; const nPageIndex: Cardinal; out pTriangleCount: Cardinal; out pStride: Cardinal; out pIndices: Pointer): TLib3MFResult; cdecl;
+	
 	(**
 	* Sets the property at the object-level of the mesh object.
 	*
@@ -1888,6 +2113,17 @@ type
 	*)
 	TLib3MFMeshObject_SetGeometryFunc = function(pMeshObject: TLib3MFHandle; const nVerticesCount: QWord; const pVerticesBuffer: PLib3MFPosition; const nIndicesCount: QWord; const pIndicesBuffer: PLib3MFTriangle): TLib3MFResult; cdecl;
 	
+	(**
+	* Preallocates memory for the given total numbers of vertices, triangles and beams, so that they can be added without further allocations.
+	*
+	* @param[in] pMeshObject - MeshObject instance.
+	* @param[in] nVertexCount - number of vertices to reserve memory for.
+	* @param[in] nTriangleCount - number of triangles to reserve memory for.
+	* @param[in] nBeamCount - number of beams to reserve memory for.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFMeshObject_ReserveGeometryFunc = function(pMeshObject: TLib3MFHandle; const nVertexCount: Cardinal; const nTriangleCount: Cardinal; const nBeamCount: Cardinal): TLib3MFResult; cdecl;
+	
 	(**
 	* Retrieves, if an object describes a topologically oriented and manifold mesh, according to the core spec.
 	*
@@ -1897,6 +2133,15 @@ type
 	*)
 	TLib3MFMeshObject_IsManifoldAndOrientedFunc = function(pMeshObject: TLib3MFHandle; out pIsManifoldAndOriented: Byte): TLib3MFResult; cdecl;
 	
+	(**
+	* Retrieves, if the geometry of an object has been loaded. Meshes read with lazy mesh loading are only loaded when their geometry is accessed for the first time.
+	*
+	* @param[in] pMeshObject - MeshObject instance.
+	* @param[out] pIsGeometryLoaded - returns, if the geometry of the object has been loaded.
+	* @return error code or 0 (success)
+	*)
+	TLib3MFMeshObject_IsGeometryLoadedFunc = function(pMeshObject: TLib3MFHandle; out pIsGeometryLoaded: Byte): TLib3MFResult; cdecl;
+	
 	(**
 	* Retrieves the BeamLattice within this MeshObject.
 	*
@@ -5510,6 +5755,100 @@ type
 	*)
 	TLib3MFImplicitFunction_SortNodesTopologicallyFunc = function(pImplicitFunction: TLib3MFHandle): TLib3MFResult; cdecl;
 	
+	(**
+	* Compiles the function into an evaluator. Later changes of the function do not affect the evaluator.
+	*
+	* @param[in] pImplicitFunction - ImplicitFunction instance.
+	* @param[out] pEvaluator - the evaluator
+	* @return error code or 0 (success)
+	*)
+	TLib3MFImplicitFunction_CreateEvaluatorFunc = function(pImplicitFunction: TLib3MFHandle; out pEvaluator: TLib3MFHandle): TLib3MFResult; cdecl;
+	
+
+(*************************************************************************************************************************
+ Function type definitions for ImplicitEvaluator
+**************************************************************************************************************************)
+
+	(**
+	* Returns the number of input values per point. Vector inputs take 3 values, matrix inputs 16.
+	*
+	* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+	* @param[out] pStride - number of input values per point
+	* @return error code or 0 (success)
+	*)
+	TLib3MFImplicitEvaluator_GetInputStrideFunc = function(pImplicitEvaluator: TLib3MFHandle; out pStride: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the number of output values per point. Vector outputs take 3 values, matrix outputs 16.
+	*
+	* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+	* @param[out] pStride - number of output values per point
+	* @return error code or 0 (success)
+	*)
+	TLib3MFImplicitEvaluator_GetOutputStrideFunc = function(pImplicitEvaluator: TLib3MFHandle; out pStride: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Sets the number of threads used by Evaluate. 0 selects the number of hardware threads, 1 (default) evaluates on the calling thread.
+	*
+	* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+	* @param[in] nThreadCount - number of threads
+	* @return error code or 0 (success)
+	*)
+	TLib3MFImplicitEvaluator_SetWorkerThreadCountFunc = function(pImplicitEvaluator: TLib3MFHandle; const nThreadCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the number of threads used by Evaluate.
+	*
+	* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+	* @param[out] pThreadCount - number of threads
+	* @return error code or 0 (success)
+	*)
+	TLib3MFImplicitEvaluator_GetWorkerThreadCountFunc = function(pImplicitEvaluator: TLib3MFHandle; out pThreadCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Evaluates the function for a batch of points. The input values of all function inputs of a point are stored consecutively, followed by the next point.
+	*
+	* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+	* @param[in] nInputsCount - Number of elements in buffer
+	* @param[in] pInputsBuffer - double buffer of input values of all points
+	* @param[in] nOutputsCount - Number of elements in buffer
+	* @param[out] pOutputsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+	* @param[out] pOutputsBuffer - double buffer of output values of all points
+	* @return error code or 0 (success)
+	*)
+	TLib3MFImplicitEvaluator_EvaluateFunc = function(pImplicitEvaluator: TLib3MFHandle; const nInputsCount: QWord; const pInputsBuffer: PDouble; const nOutputsCount: QWord; out pOutputsNeededCount: QWord; pOutputsBuffer: PDouble): TLib3MFResult; cdecl;
+	
+	(**
+	* Evaluates the function for a batch of points in structure-of-arrays layout. The values of the first input component of all points are stored consecutively, followed by the values of the next component. The outputs are returned in the same layout.
+	*
+	* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+	* @param[in] nInputsCount - Number of elements in buffer
+	* @param[in] pInputsBuffer - double buffer of input values of all points, one array per component
+	* @param[in] nOutputsCount - Number of elements in buffer
+	* @param[out] pOutputsNeededCount - will be filled with the count of the written elements, or needed buffer size.
+	* @param[out] pOutputsBuffer - double buffer of output values of all points, one array per component
+	* @return error code or 0 (success)
+	*)
+	TLib3MFImplicitEvaluator_EvaluateBatchFunc = function(pImplicitEvaluator: TLib3MFHandle; const nInputsCount: QWord; const pInputsBuffer: PDouble; const nOutputsCount: QWord; out pOutputsNeededCount: QWord; pOutputsBuffer: PDouble): TLib3MFResult; cdecl;
+	
+	(**
+	* Computes bounds of the function outputs for boxes of input values. Every box is given by the minimal and maximal value of each input component, stored like the points of Evaluate. The bounds contain all output values within the box, but are not necessarily tight. Unbounded outputs are reported as infinite.
+	*
+	* @param[in] pImplicitEvaluator - ImplicitEvaluator instance.
+	* @param[in] nInputMinimaCount - Number of elements in buffer
+	* @param[in] pInputMinimaBuffer - double buffer of minimal input values of all boxes
+	* @param[in] nInputMaximaCount - Number of elements in buffer
+	* @param[in] pInputMaximaBuffer - double buffer of maximal input values of all boxes
+	* @param[in] nOutputMinimaCount - Number of elements in buffer
+	* @param[out] pOutputMinimaNeededCount - will be filled with the count of the written elements, or needed buffer size.
+	* @param[out] pOutputMinimaBuffer - double buffer of lower bounds of the outputs of all boxes
+	* @param[in] nOutputMaximaCount - Number of elements in buffer
+	* @param[out] pOutputMaximaNeededCount - will be filled with the count of the written elements, or needed buffer size.
+	* @param[out] pOutputMaximaBuffer - double buffer of upper bounds of the outputs of all boxes
+	* @return error code or 0 (success)
+	*)
+	TLib3MFImplicitEvaluator_EvaluateBoundsFunc = function(pImplicitEvaluator: TLib3MFHandle; const nInputMinimaCount: QWord; const pInputMinimaBuffer: PDouble; const nInputMaximaCount: QWord; const pInputMaximaBuffer: PDouble; const nOutputMinimaCount: QWord; out pOutputMinimaNeededCount: QWord; pOutputMinimaBuffer: PDouble; const nOutputMaximaCount: QWord; out pOutputMaximaNeededCount: QWord; pOutputMaximaBuffer: PDouble): TLib3MFResult; cdecl;
+	
 
 (*************************************************************************************************************************
  Function type definitions for FunctionFromImage3D
@@ -5609,6 +5948,69 @@ type
 	*)
 	TLib3MFFunctionFromImage3D_SetScaleFunc = function(pFunctionFromImage3D: TLib3MFHandle; const dScale: Double): TLib3MFResult; cdecl;
 	
+	(**
+	* Creates a sampler, which decodes the sheets of the 3D image on demand. Later changes of the function do not affect the sampler.
+	*
+	* @param[in] pFunctionFromImage3D - FunctionFromImage3D instance.
+	* @param[out] pSampler - the sampler
+	* @return error code or 0 (success)
+	*)
+	TLib3MFFunctionFromImage3D_CreateSamplerFunc = function(pFunctionFromImage3D: TLib3MFHandle; out pSampler: TLib3MFHandle): TLib3MFResult; cdecl;
+	
+
+(*************************************************************************************************************************
+ Function type definitions for Image3DSampler
+**************************************************************************************************************************)
+
+	(**
+	* Sets the maximal memory size of the decoded sheets, which are kept for later samples. The most recently used sheet is always kept.
+	*
+	* @param[in] pImage3DSampler - Image3DSampler instance.
+	* @param[in] nCacheSize - cache size in bytes
+	* @return error code or 0 (success)
+	*)
+	TLib3MFImage3DSampler_SetCacheSizeFunc = function(pImage3DSampler: TLib3MFHandle; const nCacheSize: QWord): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the maximal memory size of the decoded sheets.
+	*
+	* @param[in] pImage3DSampler - Image3DSampler instance.
+	* @param[out] pCacheSize - cache size in bytes
+	* @return error code or 0 (success)
+	*)
+	TLib3MFImage3DSampler_GetCacheSizeFunc = function(pImage3DSampler: TLib3MFHandle; out pCacheSize: QWord): TLib3MFResult; cdecl;
+	
+	(**
+	* Sets the number of threads used by Sample. 0 selects the number of hardware threads, 1 (default) samples on the calling thread.
+	*
+	* @param[in] pImage3DSampler - Image3DSampler instance.
+	* @param[in] nThreadCount - number of threads
+	* @return error code or 0 (success)
+	*)
+	TLib3MFImage3DSampler_SetWorkerThreadCountFunc = function(pImage3DSampler: TLib3MFHandle; const nThreadCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Returns the number of threads used by Sample.
+	*
+	* @param[in] pImage3DSampler - Image3DSampler instance.
+	* @param[out] pThreadCount - number of threads
+	* @return error code or 0 (success)
+	*)
+	TLib3MFImage3DSampler_GetWorkerThreadCountFunc = function(pImage3DSampler: TLib3MFHandle; out pThreadCount: Cardinal): TLib3MFResult; cdecl;
+	
+	(**
+	* Samples the function from image3D at a batch of points. Every point takes the 3 values u, v and w, every result the 4 values red, green, blue and alpha, including offset and scale.
+	*
+	* @param[in] pImage3DSampler - Image3DSampler instance.
+	* @param[in] nUVWCount - Number of elements in buffer
+	* @param[in] pUVWBuffer - double buffer of u, v and w of all points
+	* @param[in] nRGBACount - Number of elements in buffer
+	* @param[out] pRGBANeededCount - will be filled with the count of the written elements, or needed buffer size.
+	* @param[out] pRGBABuffer - double buffer of red, green, blue and alpha of all points
+	* @return error code or 0 (success)
+	*)
+	TLib3MFImage3DSampler_SampleFunc = function(pImage3DSampler: TLib3MFHandle; const nUVWCount: QWord; const pUVWBuffer: PDouble; const nRGBACount: QWord; out pRGBANeededCount: QWord; pRGBABuffer: PDouble): TLib3MFResult; cdecl;
+	
 
 (*************************************************************************************************************************
  Function type definitions for BuildItem
@@ -7143,6 +7545,16 @@ type
 	*)
 	TLib3MFCreateModelFunc = function(out pModel: TLib3MFHandle): TLib3MFResult; cdecl;
 	
+	(**
+	* creates a writer, which streams mesh objects into a new 3MF file while they are generated.
+	*
+	* @param[in] pFilename - Filename to write into
+	* @param[in] eUnit - Unit of the model
+	* @param[out] pStreamingWriter - returns the streaming writer instance
+	* @return error code or 0 (success)
+	*)
+	TLib3MFCreateStreamingWriterFunc = function(const pFilename: PAnsiChar; const eUnit: Integer; out pStreamingWriter: TLib3MFHandle): TLib3MFResult; cdecl;
+	
 	(**
 	* releases shared ownership of an object instance
 	*
@@ -7338,6 +7750,12 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		procedure SetProgressCallback(const AProgressCallback: PLib3MF_ProgressCallback; const AUserData: Pointer);
 		function GetDecimalPrecision(): Cardinal;
 		procedure SetDecimalPrecision(const ADecimalPrecision: Cardinal);
+		procedure SetShortestRoundtripActive(const AShortestRoundtripActive: Boolean);
+		function GetShortestRoundtripActive(): Boolean;
+		procedure SetWorkerThreadCount(const AThreadCount: Cardinal);
+		function GetWorkerThreadCount(): Cardinal;
+		procedure SetCompressionLevel(const APartType: TLib3MFPackagePartType; const ALevel: TLib3MFCompressionLevel);
+		function GetCompressionLevel(const APartType: TLib3MFPackagePartType): TLib3MFCompressionLevel;
 		procedure SetStrictModeActive(const AStrictModeActive: Boolean);
 		function GetStrictModeActive(): Boolean;
 		function GetWarning(const AIndex: Cardinal; out AErrorCode: Cardinal): String;
@@ -7363,6 +7781,11 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		procedure RemoveRelationToRead(const ARelationShipType: String);
 		procedure SetStrictModeActive(const AStrictModeActive: Boolean);
 		function GetStrictModeActive(): Boolean;
+		procedure SetWorkerThreadCount(const AThreadCount: Cardinal);
+		function GetWorkerThreadCount(): Cardinal;
+		procedure SetMeshStreamCallbacks(const ATheVertexBlockCallback: PLib3MF_VertexBlockCallback; const ATheTriangleBlockCallback: PLib3MF_TriangleBlockCallback; const ARetainGeometry: Boolean; const AUserData: Pointer);
+		procedure SetLazyMeshLoadingActive(const ALazyMeshLoadingActive: Boolean);
+		function GetLazyMeshLoadingActive(): Boolean;
 		function GetWarning(const AIndex: Cardinal; out AErrorCode: Cardinal): String;
 		function GetWarningCount(): Cardinal;
 		procedure AddKeyWrappingCallback(const AConsumerID: String; const ATheCallback: PLib3MF_KeyWrappingCallback; const AUserData: Pointer);
@@ -7370,6 +7793,23 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 	end;
 
 
+(*************************************************************************************************************************
+ Class definition for StreamingWriter
+**************************************************************************************************************************)
+
+	TLib3MFStreamingWriter = class(TLib3MFBase)
+	public
+		constructor Create(AWrapper: TLib3MFWrapper; AHandle: TLib3MFHandle);
+		destructor Destroy; override;
+		function BeginMeshObject(const AName: String): Cardinal;
+		procedure AddVertices(const AVertices: ArrayOfLib3MFPosition);
+		procedure AddTriangles(const AIndices: ArrayOfLib3MFTriangle);
+		procedure EndMeshObject();
+		procedure AddBuildItem(const AObjectID: Cardinal; const ATransform: TLib3MFTransform);
+		procedure Finish();
+	end;
+
+
 (*************************************************************************************************************************
  Class definition for PackagePart
 **************************************************************************************************************************)
@@ -7682,10 +8122,14 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		procedure SetVertex(const AIndex: Cardinal; const ACoordinates: TLib3MFPosition);
 		function AddVertex(const ACoordinates: TLib3MFPosition): Cardinal;
 		procedure GetVertices(out AVertices: ArrayOfLib3MFPosition);
+		function GetVertexPageCount(): Cardinal;
+		function GetVertexPage(const APageIndex: Cardinal; out AVertexCount: Cardinal; out AStride: Cardinal): Pointer;
 		function GetTriangle(const AIndex: Cardinal): TLib3MFTriangle;
 		procedure SetTriangle(const AIndex: Cardinal; const AIndices: TLib3MFTriangle);
 		function AddTriangle(const AIndices: TLib3MFTriangle): Cardinal;
 		procedure GetTriangleIndices(out AIndices: ArrayOfLib3MFTriangle);
+		function GetTrianglePageCount(): Cardinal;
+		function GetTrianglePage(const APageIndex: Cardinal; out ATriangleCount: Cardinal; out AStride: Cardinal): Pointer;
 		procedure SetObjectLevelProperty(const AUniqueResourceID: Cardinal; const APropertyID: Cardinal);
 		function GetObjectLevelProperty(out AUniqueResourceID: Cardinal; out APropertyID: Cardinal): Boolean;
 		procedure SetTriangleProperties(const AIndex: Cardinal; const AProperties: TLib3MFTriangleProperties);
@@ -7694,7 +8138,9 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		procedure GetAllTriangleProperties(out APropertiesArray: ArrayOfLib3MFTriangleProperties);
 		procedure ClearAllProperties();
 		procedure SetGeometry(const AVertices: ArrayOfLib3MFPosition; const AIndices: ArrayOfLib3MFTriangle);
+		procedure ReserveGeometry(const AVertexCount: Cardinal; const ATriangleCount: Cardinal; const ABeamCount: Cardinal);
 		function IsManifoldAndOriented(): Boolean;
+		function IsGeometryLoaded(): Boolean;
 		function BeamLattice(): TLib3MFBeamLattice;
 		function GetVolumeData(): TLib3MFVolumeData;
 		procedure SetVolumeData(const ATheVolumeData: TLib3MFVolumeData);
@@ -8896,6 +9342,25 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		procedure AddLinkByNames(const ASource: String; const ATarget: String);
 		procedure Clear();
 		procedure SortNodesTopologically();
+		function CreateEvaluator(): TLib3MFImplicitEvaluator;
+	end;
+
+
+(*************************************************************************************************************************
+ Class definition for ImplicitEvaluator
+**************************************************************************************************************************)
+
+	TLib3MFImplicitEvaluator = class(TLib3MFBase)
+	public
+		constructor Create(AWrapper: TLib3MFWrapper; AHandle: TLib3MFHandle);
+		destructor Destroy; override;
+		function GetInputStride(): Cardinal;
+		function GetOutputStride(): Cardinal;
+		procedure SetWorkerThreadCount(const AThreadCount: Cardinal);
+		function GetWorkerThreadCount(): Cardinal;
+		procedure Evaluate(const AInputs: TDoubleDynArray; out AOutputs: TDoubleDynArray);
+		procedure EvaluateBatch(const AInputs: TDoubleDynArray; out AOutputs: TDoubleDynArray);
+		procedure EvaluateBounds(const AInputMinima: TDoubleDynArray; const AInputMaxima: TDoubleDynArray; out AOutputMinima: TDoubleDynArray; out AOutputMaxima: TDoubleDynArray);
 	end;
 
 
@@ -8917,6 +9382,23 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		procedure SetOffset(const AOffset: Double);
 		function GetScale(): Double;
 		procedure SetScale(const AScale: Double);
+		function CreateSampler(): TLib3MFImage3DSampler;
+	end;
+
+
+(*************************************************************************************************************************
+ Class definition for Image3DSampler
+**************************************************************************************************************************)
+
+	TLib3MFImage3DSampler = class(TLib3MFBase)
+	public
+		constructor Create(AWrapper: TLib3MFWrapper; AHandle: TLib3MFHandle);
+		destructor Destroy; override;
+		procedure SetCacheSize(const ACacheSize: QWord);
+		function GetCacheSize(): QWord;
+		procedure SetWorkerThreadCount(const AThreadCount: Cardinal);
+		function GetWorkerThreadCount(): Cardinal;
+		procedure Sample(const AUVW: TDoubleDynArray; out ARGBA: TDoubleDynArray);
 	end;
 
 
@@ -9202,6 +9684,12 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFWriter_SetProgressCallbackFunc: TLib3MFWriter_SetProgressCallbackFunc;
 		FLib3MFWriter_GetDecimalPrecisionFunc: TLib3MFWriter_GetDecimalPrecisionFunc;
 		FLib3MFWriter_SetDecimalPrecisionFunc: TLib3MFWriter_SetDecimalPrecisionFunc;
+		FLib3MFWriter_SetShortestRoundtripActiveFunc: TLib3MFWriter_SetShortestRoundtripActiveFunc;
+		FLib3MFWriter_GetShortestRoundtripActiveFunc: TLib3MFWriter_GetShortestRoundtripActiveFunc;
+		FLib3MFWriter_SetWorkerThreadCountFunc: TLib3MFWriter_SetWorkerThreadCountFunc;
+		FLib3MFWriter_GetWorkerThreadCountFunc: TLib3MFWriter_GetWorkerThreadCountFunc;
+		FLib3MFWriter_SetCompressionLevelFunc: TLib3MFWriter_SetCompressionLevelFunc;
+		FLib3MFWriter_GetCompressionLevelFunc: TLib3MFWriter_GetCompressionLevelFunc;
 		FLib3MFWriter_SetStrictModeActiveFunc: TLib3MFWriter_SetStrictModeActiveFunc;
 		FLib3MFWriter_GetStrictModeActiveFunc: TLib3MFWriter_GetStrictModeActiveFunc;
 		FLib3MFWriter_GetWarningFunc: TLib3MFWriter_GetWarningFunc;
@@ -9216,10 +9704,21 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFReader_RemoveRelationToReadFunc: TLib3MFReader_RemoveRelationToReadFunc;
 		FLib3MFReader_SetStrictModeActiveFunc: TLib3MFReader_SetStrictModeActiveFunc;
 		FLib3MFReader_GetStrictModeActiveFunc: TLib3MFReader_GetStrictModeActiveFunc;
+		FLib3MFReader_SetWorkerThreadCountFunc: TLib3MFReader_SetWorkerThreadCountFunc;
+		FLib3MFReader_GetWorkerThreadCountFunc: TLib3MFReader_GetWorkerThreadCountFunc;
+		FLib3MFReader_SetMeshStreamCallbacksFunc: TLib3MFReader_SetMeshStreamCallbacksFunc;
+		FLib3MFReader_SetLazyMeshLoadingActiveFunc: TLib3MFReader_SetLazyMeshLoadingActiveFunc;
+		FLib3MFReader_GetLazyMeshLoadingActiveFunc: TLib3MFReader_GetLazyMeshLoadingActiveFunc;
 		FLib3MFReader_GetWarningFunc: TLib3MFReader_GetWarningFunc;
 		FLib3MFReader_GetWarningCountFunc: TLib3MFReader_GetWarningCountFunc;
 		FLib3MFReader_AddKeyWrappingCallbackFunc: TLib3MFReader_AddKeyWrappingCallbackFunc;
 		FLib3MFReader_SetContentEncryptionCallbackFunc: TLib3MFReader_SetContentEncryptionCallbackFunc;
+		FLib3MFStreamingWriter_BeginMeshObjectFunc: TLib3MFStreamingWriter_BeginMeshObjectFunc;
+		FLib3MFStreamingWriter_AddVerticesFunc: TLib3MFStreamingWriter_AddVerticesFunc;
+		FLib3MFStreamingWriter_AddTrianglesFunc: TLib3MFStreamingWriter_AddTrianglesFunc;
+		FLib3MFStreamingWriter_EndMeshObjectFunc: TLib3MFStreamingWriter_EndMeshObjectFunc;
+		FLib3MFStreamingWriter_AddBuildItemFunc: TLib3MFStreamingWriter_AddBuildItemFunc;
+		FLib3MFStreamingWriter_FinishFunc: TLib3MFStreamingWriter_FinishFunc;
 		FLib3MFPackagePart_GetPathFunc: TLib3MFPackagePart_GetPathFunc;
 		FLib3MFPackagePart_SetPathFunc: TLib3MFPackagePart_SetPathFunc;
 		FLib3MFResource_GetResourceIDFunc: TLib3MFResource_GetResourceIDFunc;
@@ -9304,10 +9803,14 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFMeshObject_SetVertexFunc: TLib3MFMeshObject_SetVertexFunc;
 		FLib3MFMeshObject_AddVertexFunc: TLib3MFMeshObject_AddVertexFunc;
 		FLib3MFMeshObject_GetVerticesFunc: TLib3MFMeshObject_GetVerticesFunc;
+		FLib3MFMeshObject_GetVertexPageCountFunc: TLib3MFMeshObject_GetVertexPageCountFunc;
+		FLib3MFMeshObject_GetVertexPageFunc: TLib3MFMeshObject_GetVertexPageFunc;
 		FLib3MFMeshObject_GetTriangleFunc: TLib3MFMeshObject_GetTriangleFunc;
 		FLib3MFMeshObject_SetTriangleFunc: TLib3MFMeshObject_SetTriangleFunc;
 		FLib3MFMeshObject_AddTriangleFunc: TLib3MFMeshObject_AddTriangleFunc;
 		FLib3MFMeshObject_GetTriangleIndicesFunc: TLib3MFMeshObject_GetTriangleIndicesFunc;
+		FLib3MFMeshObject_GetTrianglePageCountFunc: TLib3MFMeshObject_GetTrianglePageCountFunc;
+		FLib3MFMeshObject_GetTrianglePageFunc: TLib3MFMeshObject_GetTrianglePageFunc;
 		FLib3MFMeshObject_SetObjectLevelPropertyFunc: TLib3MFMeshObject_SetObjectLevelPropertyFunc;
 		FLib3MFMeshObject_GetObjectLevelPropertyFunc: TLib3MFMeshObject_GetObjectLevelPropertyFunc;
 		FLib3MFMeshObject_SetTrianglePropertiesFunc: TLib3MFMeshObject_SetTrianglePropertiesFunc;
@@ -9316,7 +9819,9 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFMeshObject_GetAllTrianglePropertiesFunc: TLib3MFMeshObject_GetAllTrianglePropertiesFunc;
 		FLib3MFMeshObject_ClearAllPropertiesFunc: TLib3MFMeshObject_ClearAllPropertiesFunc;
 		FLib3MFMeshObject_SetGeometryFunc: TLib3MFMeshObject_SetGeometryFunc;
+		FLib3MFMeshObject_ReserveGeometryFunc: TLib3MFMeshObject_ReserveGeometryFunc;
 		FLib3MFMeshObject_IsManifoldAndOrientedFunc: TLib3MFMeshObject_IsManifoldAndOrientedFunc;
+		FLib3MFMeshObject_IsGeometryLoadedFunc: TLib3MFMeshObject_IsGeometryLoadedFunc;
 		FLib3MFMeshObject_BeamLatticeFunc: TLib3MFMeshObject_BeamLatticeFunc;
 		FLib3MFMeshObject_GetVolumeDataFunc: TLib3MFMeshObject_GetVolumeDataFunc;
 		FLib3MFMeshObject_SetVolumeDataFunc: TLib3MFMeshObject_SetVolumeDataFunc;
@@ -9638,6 +10143,14 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFImplicitFunction_AddLinkByNamesFunc: TLib3MFImplicitFunction_AddLinkByNamesFunc;
 		FLib3MFImplicitFunction_ClearFunc: TLib3MFImplicitFunction_ClearFunc;
 		FLib3MFImplicitFunction_SortNodesTopologicallyFunc: TLib3MFImplicitFunction_SortNodesTopologicallyFunc;
+		FLib3MFImplicitFunction_CreateEvaluatorFunc: TLib3MFImplicitFunction_CreateEvaluatorFunc;
+		FLib3MFImplicitEvaluator_GetInputStrideFunc: TLib3MFImplicitEvaluator_GetInputStrideFunc;
+		FLib3MFImplicitEvaluator_GetOutputStrideFunc: TLib3MFImplicitEvaluator_GetOutputStrideFunc;
+		FLib3MFImplicitEvaluator_SetWorkerThreadCountFunc: TLib3MFImplicitEvaluator_SetWorkerThreadCountFunc;
+		FLib3MFImplicitEvaluator_GetWorkerThreadCountFunc: TLib3MFImplicitEvaluator_GetWorkerThreadCountFunc;
+		FLib3MFImplicitEvaluator_EvaluateFunc: TLib3MFImplicitEvaluator_EvaluateFunc;
+		FLib3MFImplicitEvaluator_EvaluateBatchFunc: TLib3MFImplicitEvaluator_EvaluateBatchFunc;
+		FLib3MFImplicitEvaluator_EvaluateBoundsFunc: TLib3MFImplicitEvaluator_EvaluateBoundsFunc;
 		FLib3MFFunctionFromImage3D_GetImage3DFunc: TLib3MFFunctionFromImage3D_GetImage3DFunc;
 		FLib3MFFunctionFromImage3D_SetImage3DFunc: TLib3MFFunctionFromImage3D_SetImage3DFunc;
 		FLib3MFFunctionFromImage3D_SetFilterFunc: TLib3MFFunctionFromImage3D_SetFilterFunc;
@@ -9648,6 +10161,12 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFFunctionFromImage3D_SetOffsetFunc: TLib3MFFunctionFromImage3D_SetOffsetFunc;
 		FLib3MFFunctionFromImage3D_GetScaleFunc: TLib3MFFunctionFromImage3D_GetScaleFunc;
 		FLib3MFFunctionFromImage3D_SetScaleFunc: TLib3MFFunctionFromImage3D_SetScaleFunc;
+		FLib3MFFunctionFromImage3D_CreateSamplerFunc: TLib3MFFunctionFromImage3D_CreateSamplerFunc;
+		FLib3MFImage3DSampler_SetCacheSizeFunc: TLib3MFImage3DSampler_SetCacheSizeFunc;
+		FLib3MFImage3DSampler_GetCacheSizeFunc: TLib3MFImage3DSampler_GetCacheSizeFunc;
+		FLib3MFImage3DSampler_SetWorkerThreadCountFunc: TLib3MFImage3DSampler_SetWorkerThreadCountFunc;
+		FLib3MFImage3DSampler_GetWorkerThreadCountFunc: TLib3MFImage3DSampler_GetWorkerThreadCountFunc;
+		FLib3MFImage3DSampler_SampleFunc: TLib3MFImage3DSampler_SampleFunc;
 		FLib3MFBuildItem_GetObjectResourceFunc: TLib3MFBuildItem_GetObjectResourceFunc;
 		FLib3MFBuildItem_GetUUIDFunc: TLib3MFBuildItem_GetUUIDFunc;
 		FLib3MFBuildItem_SetUUIDFunc: TLib3MFBuildItem_SetUUIDFunc;
@@ -9800,6 +10319,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		FLib3MFGetBuildInformationFunc: TLib3MFGetBuildInformationFunc;
 		FLib3MFGetSpecificationVersionFunc: TLib3MFGetSpecificationVersionFunc;
 		FLib3MFCreateModelFunc: TLib3MFCreateModelFunc;
+		FLib3MFCreateStreamingWriterFunc: TLib3MFCreateStreamingWriterFunc;
 		FLib3MFReleaseFunc: TLib3MFReleaseFunc;
 		FLib3MFAcquireFunc: TLib3MFAcquireFunc;
 		FLib3MFSetJournalFunc: TLib3MFSetJournalFunc;
@@ -9832,6 +10352,12 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFWriter_SetProgressCallbackFunc: TLib3MFWriter_SetProgressCallbackFunc read FLib3MFWriter_SetProgressCallbackFunc;
 		property Lib3MFWriter_GetDecimalPrecisionFunc: TLib3MFWriter_GetDecimalPrecisionFunc read FLib3MFWriter_GetDecimalPrecisionFunc;
 		property Lib3MFWriter_SetDecimalPrecisionFunc: TLib3MFWriter_SetDecimalPrecisionFunc read FLib3MFWriter_SetDecimalPrecisionFunc;
+		property Lib3MFWriter_SetShortestRoundtripActiveFunc: TLib3MFWriter_SetShortestRoundtripActiveFunc read FLib3MFWriter_SetShortestRoundtripActiveFunc;
+		property Lib3MFWriter_GetShortestRoundtripActiveFunc: TLib3MFWriter_GetShortestRoundtripActiveFunc read FLib3MFWriter_GetShortestRoundtripActiveFunc;
+		property Lib3MFWriter_SetWorkerThreadCountFunc: TLib3MFWriter_SetWorkerThreadCountFunc read FLib3MFWriter_SetWorkerThreadCountFunc;
+		property Lib3MFWriter_GetWorkerThreadCountFunc: TLib3MFWriter_GetWorkerThreadCountFunc read FLib3MFWriter_GetWorkerThreadCountFunc;
+		property Lib3MFWriter_SetCompressionLevelFunc: TLib3MFWriter_SetCompressionLevelFunc read FLib3MFWriter_SetCompressionLevelFunc;
+		property Lib3MFWriter_GetCompressionLevelFunc: TLib3MFWriter_GetCompressionLevelFunc read FLib3MFWriter_GetCompressionLevelFunc;
 		property Lib3MFWriter_SetStrictModeActiveFunc: TLib3MFWriter_SetStrictModeActiveFunc read FLib3MFWriter_SetStrictModeActiveFunc;
 		property Lib3MFWriter_GetStrictModeActiveFunc: TLib3MFWriter_GetStrictModeActiveFunc read FLib3MFWriter_GetStrictModeActiveFunc;
 		property Lib3MFWriter_GetWarningFunc: TLib3MFWriter_GetWarningFunc read FLib3MFWriter_GetWarningFunc;
@@ -9846,10 +10372,21 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFReader_RemoveRelationToReadFunc: TLib3MFReader_RemoveRelationToReadFunc read FLib3MFReader_RemoveRelationToReadFunc;
 		property Lib3MFReader_SetStrictModeActiveFunc: TLib3MFReader_SetStrictModeActiveFunc read FLib3MFReader_SetStrictModeActiveFunc;
 		property Lib3MFReader_GetStrictModeActiveFunc: TLib3MFReader_GetStrictModeActiveFunc read FLib3MFReader_GetStrictModeActiveFunc;
+		property Lib3MFReader_SetWorkerThreadCountFunc: TLib3MFReader_SetWorkerThreadCountFunc read FLib3MFReader_SetWorkerThreadCountFunc;
+		property Lib3MFReader_GetWorkerThreadCountFunc: TLib3MFReader_GetWorkerThreadCountFunc read FLib3MFReader_GetWorkerThreadCountFunc;
+		property Lib3MFReader_SetMeshStreamCallbacksFunc: TLib3MFReader_SetMeshStreamCallbacksFunc read FLib3MFReader_SetMeshStreamCallbacksFunc;
+		property Lib3MFReader_SetLazyMeshLoadingActiveFunc: TLib3MFReader_SetLazyMeshLoadingActiveFunc read FLib3MFReader_SetLazyMeshLoadingActiveFunc;
+		property Lib3MFReader_GetLazyMeshLoadingActiveFunc: TLib3MFReader_GetLazyMeshLoadingActiveFunc read FLib3MFReader_GetLazyMeshLoadingActiveFunc;
 		property Lib3MFReader_GetWarningFunc: TLib3MFReader_GetWarningFunc read FLib3MFReader_GetWarningFunc;
 		property Lib3MFReader_GetWarningCountFunc: TLib3MFReader_GetWarningCountFunc read FLib3MFReader_GetWarningCountFunc;
 		property Lib3MFReader_AddKeyWrappingCallbackFunc: TLib3MFReader_AddKeyWrappingCallbackFunc read FLib3MFReader_AddKeyWrappingCallbackFunc;
 		property Lib3MFReader_SetContentEncryptionCallbackFunc: TLib3MFReader_SetContentEncryptionCallbackFunc read FLib3MFReader_SetContentEncryptionCallbackFunc;
+		property Lib3MFStreamingWriter_BeginMeshObjectFunc: TLib3MFStreamingWriter_BeginMeshObjectFunc read FLib3MFStreamingWriter_BeginMeshObjectFunc;
+		property Lib3MFStreamingWriter_AddVerticesFunc: TLib3MFStreamingWriter_AddVerticesFunc read FLib3MFStreamingWriter_AddVerticesFunc;
+		property Lib3MFStreamingWriter_AddTrianglesFunc: TLib3MFStreamingWriter_AddTrianglesFunc read FLib3MFStreamingWriter_AddTrianglesFunc;
+		property Lib3MFStreamingWriter_EndMeshObjectFunc: TLib3MFStreamingWriter_EndMeshObjectFunc read FLib3MFStreamingWriter_EndMeshObjectFunc;
+		property Lib3MFStreamingWriter_AddBuildItemFunc: TLib3MFStreamingWriter_AddBuildItemFunc read FLib3MFStreamingWriter_AddBuildItemFunc;
+		property Lib3MFStreamingWriter_FinishFunc: TLib3MFStreamingWriter_FinishFunc read FLib3MFStreamingWriter_FinishFunc;
 		property Lib3MFPackagePart_GetPathFunc: TLib3MFPackagePart_GetPathFunc read FLib3MFPackagePart_GetPathFunc;
 		property Lib3MFPackagePart_SetPathFunc: TLib3MFPackagePart_SetPathFunc read FLib3MFPackagePart_SetPathFunc;
 		property Lib3MFResource_GetResourceIDFunc: TLib3MFResource_GetResourceIDFunc read FLib3MFResource_GetResourceIDFunc;
@@ -9934,10 +10471,14 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFMeshObject_SetVertexFunc: TLib3MFMeshObject_SetVertexFunc read FLib3MFMeshObject_SetVertexFunc;
 		property Lib3MFMeshObject_AddVertexFunc: TLib3MFMeshObject_AddVertexFunc read FLib3MFMeshObject_AddVertexFunc;
 		property Lib3MFMeshObject_GetVerticesFunc: TLib3MFMeshObject_GetVerticesFunc read FLib3MFMeshObject_GetVerticesFunc;
+		property Lib3MFMeshObject_GetVertexPageCountFunc: TLib3MFMeshObject_GetVertexPageCountFunc read FLib3MFMeshObject_GetVertexPageCountFunc;
+		property Lib3MFMeshObject_GetVertexPageFunc: TLib3MFMeshObject_GetVertexPageFunc read FLib3MFMeshObject_GetVertexPageFunc;
 		property Lib3MFMeshObject_GetTriangleFunc: TLib3MFMeshObject_GetTriangleFunc read FLib3MFMeshObject_GetTriangleFunc;
 		property Lib3MFMeshObject_SetTriangleFunc: TLib3MFMeshObject_SetTriangleFunc read FLib3MFMeshObject_SetTriangleFunc;
 		property Lib3MFMeshObject_AddTriangleFunc: TLib3MFMeshObject_AddTriangleFunc read FLib3MFMeshObject_AddTriangleFunc;
 		property Lib3MFMeshObject_GetTriangleIndicesFunc: TLib3MFMeshObject_GetTriangleIndicesFunc read FLib3MFMeshObject_GetTriangleIndicesFunc;
+		property Lib3MFMeshObject_GetTrianglePageCountFunc: TLib3MFMeshObject_GetTrianglePageCountFunc read FLib3MFMeshObject_GetTrianglePageCountFunc;
+		property Lib3MFMeshObject_GetTrianglePageFunc: TLib3MFMeshObject_GetTrianglePageFunc read FLib3MFMeshObject_GetTrianglePageFunc;
 		property Lib3MFMeshObject_SetObjectLevelPropertyFunc: TLib3MFMeshObject_SetObjectLevelPropertyFunc read FLib3MFMeshObject_SetObjectLevelPropertyFunc;
 		property Lib3MFMeshObject_GetObjectLevelPropertyFunc: TLib3MFMeshObject_GetObjectLevelPropertyFunc read FLib3MFMeshObject_GetObjectLevelPropertyFunc;
 		property Lib3MFMeshObject_SetTrianglePropertiesFunc: TLib3MFMeshObject_SetTrianglePropertiesFunc read FLib3MFMeshObject_SetTrianglePropertiesFunc;
@@ -9946,7 +10487,9 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFMeshObject_GetAllTrianglePropertiesFunc: TLib3MFMeshObject_GetAllTrianglePropertiesFunc read FLib3MFMeshObject_GetAllTrianglePropertiesFunc;
 		property Lib3MFMeshObject_ClearAllPropertiesFunc: TLib3MFMeshObject_ClearAllPropertiesFunc read FLib3MFMeshObject_ClearAllPropertiesFunc;
 		property Lib3MFMeshObject_SetGeometryFunc: TLib3MFMeshObject_SetGeometryFunc read FLib3MFMeshObject_SetGeometryFunc;
+		property Lib3MFMeshObject_ReserveGeometryFunc: TLib3MFMeshObject_ReserveGeometryFunc read FLib3MFMeshObject_ReserveGeometryFunc;
 		property Lib3MFMeshObject_IsManifoldAndOrientedFunc: TLib3MFMeshObject_IsManifoldAndOrientedFunc read FLib3MFMeshObject_IsManifoldAndOrientedFunc;
+		property Lib3MFMeshObject_IsGeometryLoadedFunc: TLib3MFMeshObject_IsGeometryLoadedFunc read FLib3MFMeshObject_IsGeometryLoadedFunc;
 		property Lib3MFMeshObject_BeamLatticeFunc: TLib3MFMeshObject_BeamLatticeFunc read FLib3MFMeshObject_BeamLatticeFunc;
 		property Lib3MFMeshObject_GetVolumeDataFunc: TLib3MFMeshObject_GetVolumeDataFunc read FLib3MFMeshObject_GetVolumeDataFunc;
 		property Lib3MFMeshObject_SetVolumeDataFunc: TLib3MFMeshObject_SetVolumeDataFunc read FLib3MFMeshObject_SetVolumeDataFunc;
@@ -10268,6 +10811,14 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFImplicitFunction_AddLinkByNamesFunc: TLib3MFImplicitFunction_AddLinkByNamesFunc read FLib3MFImplicitFunction_AddLinkByNamesFunc;
 		property Lib3MFImplicitFunction_ClearFunc: TLib3MFImplicitFunction_ClearFunc read FLib3MFImplicitFunction_ClearFunc;
 		property Lib3MFImplicitFunction_SortNodesTopologicallyFunc: TLib3MFImplicitFunction_SortNodesTopologicallyFunc read FLib3MFImplicitFunction_SortNodesTopologicallyFunc;
+		property Lib3MFImplicitFunction_CreateEvaluatorFunc: TLib3MFImplicitFunction_CreateEvaluatorFunc read FLib3MFImplicitFunction_CreateEvaluatorFunc;
+		property Lib3MFImplicitEvaluator_GetInputStrideFunc: TLib3MFImplicitEvaluator_GetInputStrideFunc read FLib3MFImplicitEvaluator_GetInputStrideFunc;
+		property Lib3MFImplicitEvaluator_GetOutputStrideFunc: TLib3MFImplicitEvaluator_GetOutputStrideFunc read FLib3MFImplicitEvaluator_GetOutputStrideFunc;
+		property Lib3MFImplicitEvaluator_SetWorkerThreadCountFunc: TLib3MFImplicitEvaluator_SetWorkerThreadCountFunc read FLib3MFImplicitEvaluator_SetWorkerThreadCountFunc;
+		property Lib3MFImplicitEvaluator_GetWorkerThreadCountFunc: TLib3MFImplicitEvaluator_GetWorkerThreadCountFunc read FLib3MFImplicitEvaluator_GetWorkerThreadCountFunc;
+		property Lib3MFImplicitEvaluator_EvaluateFunc: TLib3MFImplicitEvaluator_EvaluateFunc read FLib3MFImplicitEvaluator_EvaluateFunc;
+		property Lib3MFImplicitEvaluator_EvaluateBatchFunc: TLib3MFImplicitEvaluator_EvaluateBatchFunc read FLib3MFImplicitEvaluator_EvaluateBatchFunc;
+		property Lib3MFImplicitEvaluator_EvaluateBoundsFunc: TLib3MFImplicitEvaluator_EvaluateBoundsFunc read FLib3MFImplicitEvaluator_EvaluateBoundsFunc;
 		property Lib3MFFunctionFromImage3D_GetImage3DFunc: TLib3MFFunctionFromImage3D_GetImage3DFunc read FLib3MFFunctionFromImage3D_GetImage3DFunc;
 		property Lib3MFFunctionFromImage3D_SetImage3DFunc: TLib3MFFunctionFromImage3D_SetImage3DFunc read FLib3MFFunctionFromImage3D_SetImage3DFunc;
 		property Lib3MFFunctionFromImage3D_SetFilterFunc: TLib3MFFunctionFromImage3D_SetFilterFunc read FLib3MFFunctionFromImage3D_SetFilterFunc;
@@ -10278,6 +10829,12 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFFunctionFromImage3D_SetOffsetFunc: TLib3MFFunctionFromImage3D_SetOffsetFunc read FLib3MFFunctionFromImage3D_SetOffsetFunc;
 		property Lib3MFFunctionFromImage3D_GetScaleFunc: TLib3MFFunctionFromImage3D_GetScaleFunc read FLib3MFFunctionFromImage3D_GetScaleFunc;
 		property Lib3MFFunctionFromImage3D_SetScaleFunc: TLib3MFFunctionFromImage3D_SetScaleFunc read FLib3MFFunctionFromImage3D_SetScaleFunc;
+		property Lib3MFFunctionFromImage3D_CreateSamplerFunc: TLib3MFFunctionFromImage3D_CreateSamplerFunc read FLib3MFFunctionFromImage3D_CreateSamplerFunc;
+		property Lib3MFImage3DSampler_SetCacheSizeFunc: TLib3MFImage3DSampler_SetCacheSizeFunc read FLib3MFImage3DSampler_SetCacheSizeFunc;
+		property Lib3MFImage3DSampler_GetCacheSizeFunc: TLib3MFImage3DSampler_GetCacheSizeFunc read FLib3MFImage3DSampler_GetCacheSizeFunc;
+		property Lib3MFImage3DSampler_SetWorkerThreadCountFunc: TLib3MFImage3DSampler_SetWorkerThreadCountFunc read FLib3MFImage3DSampler_SetWorkerThreadCountFunc;
+		property Lib3MFImage3DSampler_GetWorkerThreadCountFunc: TLib3MFImage3DSampler_GetWorkerThreadCountFunc read FLib3MFImage3DSampler_GetWorkerThreadCountFunc;
+		property Lib3MFImage3DSampler_SampleFunc: TLib3MFImage3DSampler_SampleFunc read FLib3MFImage3DSampler_SampleFunc;
 		property Lib3MFBuildItem_GetObjectResourceFunc: TLib3MFBuildItem_GetObjectResourceFunc read FLib3MFBuildItem_GetObjectResourceFunc;
 		property Lib3MFBuildItem_GetUUIDFunc: TLib3MFBuildItem_GetUUIDFunc read FLib3MFBuildItem_GetUUIDFunc;
 		property Lib3MFBuildItem_SetUUIDFunc: TLib3MFBuildItem_SetUUIDFunc read FLib3MFBuildItem_SetUUIDFunc;
@@ -10430,6 +10987,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		property Lib3MFGetBuildInformationFunc: TLib3MFGetBuildInformationFunc read FLib3MFGetBuildInformationFunc;
 		property Lib3MFGetSpecificationVersionFunc: TLib3MFGetSpecificationVersionFunc read FLib3MFGetSpecificationVersionFunc;
 		property Lib3MFCreateModelFunc: TLib3MFCreateModelFunc read FLib3MFCreateModelFunc;
+		property Lib3MFCreateStreamingWriterFunc: TLib3MFCreateStreamingWriterFunc read FLib3MFCreateStreamingWriterFunc;
 		property Lib3MFReleaseFunc: TLib3MFReleaseFunc read FLib3MFReleaseFunc;
 		property Lib3MFAcquireFunc: TLib3MFAcquireFunc read FLib3MFAcquireFunc;
 		property Lib3MFSetJournalFunc: TLib3MFSetJournalFunc read FLib3MFSetJournalFunc;
@@ -10454,6 +11012,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 		function GetBuildInformation(out ABuildInformation: String): Boolean;
 		procedure GetSpecificationVersion(const ASpecificationURL: String; out AIsSupported: Boolean; out AMajor: Cardinal; out AMinor: Cardinal; out AMicro: Cardinal);
 		function CreateModel(): TLib3MFModel;
+		function CreateStreamingWriter(const AFilename: String; const AUnit: TLib3MFModelUnit): TLib3MFStreamingWriter;
 		procedure Release(const AInstance: TLib3MFBase);
 		procedure Acquire(const AInstance: TLib3MFBase);
 		procedure SetJournal(const AJournalPath: String);
@@ -10504,6 +11063,10 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 	function convertConstToCompositionMethod(const AValue: Integer): TLib3MFCompositionMethod;
 	function convertCompositionSpaceToConst(const AValue: TLib3MFCompositionSpace): Integer;
 	function convertConstToCompositionSpace(const AValue: Integer): TLib3MFCompositionSpace;
+	function convertPackagePartTypeToConst(const AValue: TLib3MFPackagePartType): Integer;
+	function convertConstToPackagePartType(const AValue: Integer): TLib3MFPackagePartType;
+	function convertCompressionLevelToConst(const AValue: TLib3MFCompressionLevel): Integer;
+	function convertConstToCompressionLevel(const AValue: Integer): TLib3MFCompressionLevel;
 	function convertImplicitNodeTypeToConst(const AValue: TLib3MFImplicitNodeType): Integer;
 	function convertConstToImplicitNodeType(const AValue: Integer): TLib3MFImplicitNodeType;
 	function convertImplicitPortTypeToConst(const AValue: TLib3MFImplicitPortType): Integer;
@@ -10527,6 +11090,7 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 	function TLib3MFPolymorphicFactoryMakeBase(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFBase;
 	function TLib3MFPolymorphicFactoryMakeWriter(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFWriter;
 	function TLib3MFPolymorphicFactoryMakeReader(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFReader;
+	function TLib3MFPolymorphicFactoryMakeStreamingWriter(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFStreamingWriter;
 	function TLib3MFPolymorphicFactoryMakePackagePart(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFPackagePart;
 	function TLib3MFPolymorphicFactoryMakeResource(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFResource;
 	function TLib3MFPolymorphicFactoryMakeResourceIterator(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFResourceIterator;
@@ -10628,7 +11192,9 @@ TLib3MFSymbolLookupMethod = function(const pSymbolName: PAnsiChar; out pValue: P
 	function TLib3MFPolymorphicFactoryMakeNodeIterator(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFNodeIterator;
 	function TLib3MFPolymorphicFactoryMakeFunction(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFFunction;
 	function TLib3MFPolymorphicFactoryMakeImplicitFunction(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFImplicitFunction;
+	function TLib3MFPolymorphicFactoryMakeImplicitEvaluator(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFImplicitEvaluator;
 	function TLib3MFPolymorphicFactoryMakeFunctionFromImage3D(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFFunctionFromImage3D;
+	function TLib3MFPolymorphicFactoryMakeImage3DSampler(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFImage3DSampler;
 	function TLib3MFPolymorphicFactoryMakeBuildItem(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFBuildItem;
 	function TLib3MFPolymorphicFactoryMakeBuildItemIterator(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFBuildItemIterator;
 	function TLib3MFPolymorphicFactoryMakeSlice(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFSlice;
@@ -11052,6 +11618,54 @@ implementation
 	end;
 	
 	
+	function convertPackagePartTypeToConst(const AValue: TLib3MFPackagePartType): Integer;
+	begin
+		case AValue of
+			ePackagePartTypeModel: Result := 0;
+			ePackagePartTypeImage: Result := 1;
+			ePackagePartTypeAttachment: Result := 2;
+			else 
+				raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'invalid enum value');
+		end;
+	end;
+	
+	function convertConstToPackagePartType(const AValue: Integer): TLib3MFPackagePartType;
+	begin
+		case AValue of
+			0: Result := ePackagePartTypeModel;
+			1: Result := ePackagePartTypeImage;
+			2: Result := ePackagePartTypeAttachment;
+			else 
+				raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'invalid enum constant');
+		end;
+	end;
+	
+	
+	function convertCompressionLevelToConst(const AValue: TLib3MFCompressionLevel): Integer;
+	begin
+		case AValue of
+			eCompressionLevelStored: Result := 0;
+			eCompressionLevelFastest: Result := 1;
+			eCompressionLevelDefault: Result := 6;
+			eCompressionLevelMaximum: Result := 9;
+			else 
+				raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'invalid enum value');
+		end;
+	end;
+	
+	function convertConstToCompressionLevel(const AValue: Integer): TLib3MFCompressionLevel;
+	begin
+		case AValue of
+			0: Result := eCompressionLevelStored;
+			1: Result := eCompressionLevelFastest;
+			6: Result := eCompressionLevelDefault;
+			9: Result := eCompressionLevelMaximum;
+			else 
+				raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'invalid enum constant');
+		end;
+	end;
+	
+	
 	function convertImplicitNodeTypeToConst(const AValue: TLib3MFImplicitNodeType): Integer;
 	begin
 		case AValue of
@@ -11352,6 +11966,7 @@ implementation
 			QWord($856632D0BAF1D8B7): begin Obj := TLIB3MFBase.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::Base"
 			QWord($E76F642F363FD7E9): begin Obj := TLIB3MFWriter.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::Writer"
 			QWord($2D86831DA59FBE72): begin Obj := TLIB3MFReader.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::Reader"
+			QWord($34D1B75E74821821): begin Obj := TLIB3MFStreamingWriter.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::StreamingWriter"
 			QWord($0E55A826D377483E): begin Obj := TLIB3MFPackagePart.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::PackagePart"
 			QWord($DFE3889D1B269CBB): begin Obj := TLIB3MFResource.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::Resource"
 			QWord($460F3515E2621DBE): begin Obj := TLIB3MFResourceIterator.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::ResourceIterator"
@@ -11453,7 +12068,9 @@ implementation
 			QWord($FC006BC888CAB4D0): begin Obj := TLIB3MFNodeIterator.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::NodeIterator"
 			QWord($9EFB2757CA1A5231): begin Obj := TLIB3MFFunction.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::Function"
 			QWord($6CE54469EEA83BC1): begin Obj := TLIB3MFImplicitFunction.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::ImplicitFunction"
+			QWord($624A6556CD0D2735): begin Obj := TLIB3MFImplicitEvaluator.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::ImplicitEvaluator"
 			QWord($9BD7D3C2026B8CE8): begin Obj := TLIB3MFFunctionFromImage3D.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::FunctionFromImage3D"
+			QWord($ABDCDB2C6189432A): begin Obj := TLIB3MFImage3DSampler.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::Image3DSampler"
 			QWord($68FB2D5FFC4BA12A): begin Obj := TLIB3MFBuildItem.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::BuildItem"
 			QWord($A7D21BD364910860): begin Obj := TLIB3MFBuildItemIterator.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::BuildItemIterator"
 			QWord($2198BCF4D8DF9C40): begin Obj := TLIB3MFSlice.Create(Wrapper, Handle); if Obj.inheritsFrom(_T) then Result := Obj as _T; end; // First 64 bits of SHA1 of a string: "Lib3MF::Slice"
@@ -11480,6 +12097,10 @@ implementation
 	begin
 		Result := TLib3MFPolymorphicFactory<TLIB3MFReader, TLIB3MFReader>.Make(Wrapper, Handle);
 	end;
+	function TLib3MFPolymorphicFactoryMakeStreamingWriter(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFStreamingWriter;
+	begin
+		Result := TLib3MFPolymorphicFactory<TLIB3MFStreamingWriter, TLIB3MFStreamingWriter>.Make(Wrapper, Handle);
+	end;
 	function TLib3MFPolymorphicFactoryMakePackagePart(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFPackagePart;
 	begin
 		Result := TLib3MFPolymorphicFactory<TLIB3MFPackagePart, TLIB3MFPackagePart>.Make(Wrapper, Handle);
@@ -11884,10 +12505,18 @@ implementation
 	begin
 		Result := TLib3MFPolymorphicFactory<TLIB3MFImplicitFunction, TLIB3MFImplicitFunction>.Make(Wrapper, Handle);
 	end;
+	function TLib3MFPolymorphicFactoryMakeImplicitEvaluator(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFImplicitEvaluator;
+	begin
+		Result := TLib3MFPolymorphicFactory<TLIB3MFImplicitEvaluator, TLIB3MFImplicitEvaluator>.Make(Wrapper, Handle);
+	end;
 	function TLib3MFPolymorphicFactoryMakeFunctionFromImage3D(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFFunctionFromImage3D;
 	begin
 		Result := TLib3MFPolymorphicFactory<TLIB3MFFunctionFromImage3D, TLIB3MFFunctionFromImage3D>.Make(Wrapper, Handle);
 	end;
+	function TLib3MFPolymorphicFactoryMakeImage3DSampler(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFImage3DSampler;
+	begin
+		Result := TLib3MFPolymorphicFactory<TLIB3MFImage3DSampler, TLIB3MFImage3DSampler>.Make(Wrapper, Handle);
+	end;
 	function TLib3MFPolymorphicFactoryMakeBuildItem(Wrapper: TLib3MFWrapper; Handle: TLib3MFHandle): TLIB3MFBuildItem;
 	begin
 		Result := TLib3MFPolymorphicFactory<TLIB3MFBuildItem, TLIB3MFBuildItem>.Make(Wrapper, Handle);
@@ -12096,6 +12725,44 @@ implementation
 		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_SetDecimalPrecisionFunc(FHandle, ADecimalPrecision));
 	end;
 
+	procedure TLib3MFWriter.SetShortestRoundtripActive(const AShortestRoundtripActive: Boolean);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_SetShortestRoundtripActiveFunc(FHandle, Ord(AShortestRoundtripActive)));
+	end;
+
+	function TLib3MFWriter.GetShortestRoundtripActive(): Boolean;
+	var
+		ResultShortestRoundtripActive: Byte;
+	begin
+		ResultShortestRoundtripActive := 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_GetShortestRoundtripActiveFunc(FHandle, ResultShortestRoundtripActive));
+		Result := (ResultShortestRoundtripActive <> 0);
+	end;
+
+	procedure TLib3MFWriter.SetWorkerThreadCount(const AThreadCount: Cardinal);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_SetWorkerThreadCountFunc(FHandle, AThreadCount));
+	end;
+
+	function TLib3MFWriter.GetWorkerThreadCount(): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_GetWorkerThreadCountFunc(FHandle, Result));
+	end;
+
+	procedure TLib3MFWriter.SetCompressionLevel(const APartType: TLib3MFPackagePartType; const ALevel: TLib3MFCompressionLevel);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_SetCompressionLevelFunc(FHandle, convertPackagePartTypeToConst(APartType), convertCompressionLevelToConst(ALevel)));
+	end;
+
+	function TLib3MFWriter.GetCompressionLevel(const APartType: TLib3MFPackagePartType): TLib3MFCompressionLevel;
+	var
+		ResultLevel: Integer;
+	begin
+		ResultLevel := 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_GetCompressionLevelFunc(FHandle, convertPackagePartTypeToConst(APartType), ResultLevel));
+		Result := convertConstToCompressionLevel(ResultLevel);
+	end;
+
 	procedure TLib3MFWriter.SetStrictModeActive(const AStrictModeActive: Boolean);
 	begin
 		FWrapper.CheckError(Self, FWrapper.Lib3MFWriter_SetStrictModeActiveFunc(FHandle, Ord(AStrictModeActive)));
@@ -12218,6 +12885,39 @@ implementation
 		Result := (ResultStrictModeActive <> 0);
 	end;
 
+	procedure TLib3MFReader.SetWorkerThreadCount(const AThreadCount: Cardinal);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_SetWorkerThreadCountFunc(FHandle, AThreadCount));
+	end;
+
+	function TLib3MFReader.GetWorkerThreadCount(): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_GetWorkerThreadCountFunc(FHandle, Result));
+	end;
+
+	procedure TLib3MFReader.SetMeshStreamCallbacks(const ATheVertexBlockCallback: PLib3MF_VertexBlockCallback; const ATheTriangleBlockCallback: PLib3MF_TriangleBlockCallback; const ARetainGeometry: Boolean; const AUserData: Pointer);
+	begin
+		if not Assigned(ATheVertexBlockCallback) then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'ATheVertexBlockCallback is a nil value.');
+		if not Assigned(ATheTriangleBlockCallback) then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'ATheTriangleBlockCallback is a nil value.');
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_SetMeshStreamCallbacksFunc(FHandle, ATheVertexBlockCallback, ATheTriangleBlockCallback, Ord(ARetainGeometry), AUserData));
+	end;
+
+	procedure TLib3MFReader.SetLazyMeshLoadingActive(const ALazyMeshLoadingActive: Boolean);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_SetLazyMeshLoadingActiveFunc(FHandle, Ord(ALazyMeshLoadingActive)));
+	end;
+
+	function TLib3MFReader.GetLazyMeshLoadingActive(): Boolean;
+	var
+		ResultLazyMeshLoadingActive: Byte;
+	begin
+		ResultLazyMeshLoadingActive := 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_GetLazyMeshLoadingActiveFunc(FHandle, ResultLazyMeshLoadingActive));
+		Result := (ResultLazyMeshLoadingActive <> 0);
+	end;
+
 	function TLib3MFReader.GetWarning(const AIndex: Cardinal; out AErrorCode: Cardinal): String;
 	var
 		bytesNeededWarning: Cardinal;
@@ -12251,6 +12951,72 @@ implementation
 		FWrapper.CheckError(Self, FWrapper.Lib3MFReader_SetContentEncryptionCallbackFunc(FHandle, ATheCallback, AUserData));
 	end;
 
+(*************************************************************************************************************************
+ Class implementation for StreamingWriter
+**************************************************************************************************************************)
+
+	constructor TLib3MFStreamingWriter.Create(AWrapper: TLib3MFWrapper; AHandle: TLib3MFHandle);
+	begin
+		inherited Create(AWrapper, AHandle);
+	end;
+
+	destructor TLib3MFStreamingWriter.Destroy;
+	begin
+		inherited;
+	end;
+
+	function TLib3MFStreamingWriter.BeginMeshObject(const AName: String): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFStreamingWriter_BeginMeshObjectFunc(FHandle, PAnsiChar(AName), Result));
+	end;
+
+	procedure TLib3MFStreamingWriter.AddVertices(const AVertices: ArrayOfLib3MFPosition);
+	var
+		PtrVertices: PLib3MFPosition;
+		LenVertices: QWord;
+	begin
+		LenVertices := Length(AVertices);
+		if LenVertices > $FFFFFFFF then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'array has too many entries.');
+		if LenVertices > 0 then
+			PtrVertices := @AVertices[0]
+		else
+			PtrVertices := nil;
+		
+		FWrapper.CheckError(Self, FWrapper.Lib3MFStreamingWriter_AddVerticesFunc(FHandle, QWord(LenVertices), PtrVertices));
+	end;
+
+	procedure TLib3MFStreamingWriter.AddTriangles(const AIndices: ArrayOfLib3MFTriangle);
+	var
+		PtrIndices: PLib3MFTriangle;
+		LenIndices: QWord;
+	begin
+		LenIndices := Length(AIndices);
+		if LenIndices > $FFFFFFFF then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'array has too many entries.');
+		if LenIndices > 0 then
+			PtrIndices := @AIndices[0]
+		else
+			PtrIndices := nil;
+		
+		FWrapper.CheckError(Self, FWrapper.Lib3MFStreamingWriter_AddTrianglesFunc(FHandle, QWord(LenIndices), PtrIndices));
+	end;
+
+	procedure TLib3MFStreamingWriter.EndMeshObject();
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFStreamingWriter_EndMeshObjectFunc(FHandle));
+	end;
+
+	procedure TLib3MFStreamingWriter.AddBuildItem(const AObjectID: Cardinal; const ATransform: TLib3MFTransform);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFStreamingWriter_AddBuildItemFunc(FHandle, AObjectID, @ATransform));
+	end;
+
+	procedure TLib3MFStreamingWriter.Finish();
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFStreamingWriter_FinishFunc(FHandle));
+	end;
+
 (*************************************************************************************************************************
  Class implementation for PackagePart
 **************************************************************************************************************************)
@@ -13311,6 +14077,16 @@ implementation
 		FWrapper.CheckError(Self, FWrapper.Lib3MFMeshObject_GetVerticesFunc(FHandle, countNeededVertices, countWrittenVertices, @AVertices[0]));
 	end;
 
+	function TLib3MFMeshObject.GetVertexPageCount(): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFMeshObject_GetVertexPageCountFunc(FHandle, Result));
+	end;
+
+	function TLib3MFMeshObject.GetVertexPage(const APageIndex: Cardinal; out AVertexCount: Cardinal; out AStride: Cardinal): Pointer;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFMeshObject_GetVertexPageFunc(FHandle, APageIndex, AVertexCount, AStride, Result));
+	end;
+
 	function TLib3MFMeshObject.GetTriangle(const AIndex: Cardinal): TLib3MFTriangle;
 	begin
 		FWrapper.CheckError(Self, FWrapper.Lib3MFMeshObject_GetTriangleFunc(FHandle, AIndex, @Result));
@@ -13338,6 +14114,16 @@ implementation
 		FWrapper.CheckError(Self, FWrapper.Lib3MFMeshObject_GetTriangleIndicesFunc(FHandle, countNeededIndices, countWrittenIndices, @AIndices[0]));
 	end;
 
+	function TLib3MFMeshObject.GetTrianglePageCount(): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFMeshObject_GetTrianglePageCountFunc(FHandle, Result));
+	end;
+
+	function TLib3MFMeshObject.GetTrianglePage(const APageIndex: Cardinal; out ATriangleCount: Cardinal; out AStride: Cardinal): Pointer;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFMeshObject_GetTrianglePageFunc(FHandle, APageIndex, ATriangleCount, AStride, Result));
+	end;
+
 	procedure TLib3MFMeshObject.SetObjectLevelProperty(const AUniqueResourceID: Cardinal; const APropertyID: Cardinal);
 	begin
 		FWrapper.CheckError(Self, FWrapper.Lib3MFMeshObject_SetObjectLevelPropertyFunc(FHandle, AUniqueResourceID, APropertyID));
@@ -13421,6 +14207,11 @@ implementation
 		FWrapper.CheckError(Self, FWrapper.Lib3MFMeshObject_SetGeometryFunc(FHandle, QWord(LenVertices), PtrVertices, QWord(LenIndices), PtrIndices));
 	end;
 
+	procedure TLib3MFMeshObject.ReserveGeometry(const AVertexCount: Cardinal; const ATriangleCount: Cardinal; const ABeamCount: Cardinal);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFMeshObject_ReserveGeometryFunc(FHandle, AVertexCount, ATriangleCount, ABeamCount));
+	end;
+
 	function TLib3MFMeshObject.IsManifoldAndOriented(): Boolean;
 	var
 		ResultIsManifoldAndOriented: Byte;
@@ -13430,6 +14221,15 @@ implementation
 		Result := (ResultIsManifoldAndOriented <> 0);
 	end;
 
+	function TLib3MFMeshObject.IsGeometryLoaded(): Boolean;
+	var
+		ResultIsGeometryLoaded: Byte;
+	begin
+		ResultIsGeometryLoaded := 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFMeshObject_IsGeometryLoadedFunc(FHandle, ResultIsGeometryLoaded));
+		Result := (ResultIsGeometryLoaded <> 0);
+	end;
+
 	function TLib3MFMeshObject.BeamLattice(): TLib3MFBeamLattice;
 	var
 		HTheBeamLattice: TLib3MFHandle;
@@ -17565,6 +18365,132 @@ implementation
 		FWrapper.CheckError(Self, FWrapper.Lib3MFImplicitFunction_SortNodesTopologicallyFunc(FHandle));
 	end;
 
+	function TLib3MFImplicitFunction.CreateEvaluator(): TLib3MFImplicitEvaluator;
+	var
+		HEvaluator: TLib3MFHandle;
+	begin
+		Result := nil;
+		HEvaluator := nil;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImplicitFunction_CreateEvaluatorFunc(FHandle, HEvaluator));
+		if Assigned(HEvaluator) then
+			Result := TLib3MFPolymorphicFactory<TLib3MFImplicitEvaluator, TLib3MFImplicitEvaluator>.Make(FWrapper, HEvaluator);
+	end;
+
+(*************************************************************************************************************************
+ Class implementation for ImplicitEvaluator
+**************************************************************************************************************************)
+
+	constructor TLib3MFImplicitEvaluator.Create(AWrapper: TLib3MFWrapper; AHandle: TLib3MFHandle);
+	begin
+		inherited Create(AWrapper, AHandle);
+	end;
+
+	destructor TLib3MFImplicitEvaluator.Destroy;
+	begin
+		inherited;
+	end;
+
+	function TLib3MFImplicitEvaluator.GetInputStride(): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImplicitEvaluator_GetInputStrideFunc(FHandle, Result));
+	end;
+
+	function TLib3MFImplicitEvaluator.GetOutputStride(): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImplicitEvaluator_GetOutputStrideFunc(FHandle, Result));
+	end;
+
+	procedure TLib3MFImplicitEvaluator.SetWorkerThreadCount(const AThreadCount: Cardinal);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImplicitEvaluator_SetWorkerThreadCountFunc(FHandle, AThreadCount));
+	end;
+
+	function TLib3MFImplicitEvaluator.GetWorkerThreadCount(): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImplicitEvaluator_GetWorkerThreadCountFunc(FHandle, Result));
+	end;
+
+	procedure TLib3MFImplicitEvaluator.Evaluate(const AInputs: TDoubleDynArray; out AOutputs: TDoubleDynArray);
+	var
+		PtrInputs: PDouble;
+		LenInputs: QWord;
+		countNeededOutputs: QWord;
+		countWrittenOutputs: QWord;
+	begin
+		LenInputs := Length(AInputs);
+		if LenInputs > $FFFFFFFF then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'array has too many entries.');
+		if LenInputs > 0 then
+			PtrInputs := @AInputs[0]
+		else
+			PtrInputs := nil;
+		
+		countNeededOutputs:= 0;
+		countWrittenOutputs:= 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImplicitEvaluator_EvaluateFunc(FHandle, QWord(LenInputs), PtrInputs, 0, countNeededOutputs, nil));
+		SetLength(AOutputs, countNeededOutputs);
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImplicitEvaluator_EvaluateFunc(FHandle, QWord(LenInputs), PtrInputs, countNeededOutputs, countWrittenOutputs, @AOutputs[0]));
+	end;
+
+	procedure TLib3MFImplicitEvaluator.EvaluateBatch(const AInputs: TDoubleDynArray; out AOutputs: TDoubleDynArray);
+	var
+		PtrInputs: PDouble;
+		LenInputs: QWord;
+		countNeededOutputs: QWord;
+		countWrittenOutputs: QWord;
+	begin
+		LenInputs := Length(AInputs);
+		if LenInputs > $FFFFFFFF then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'array has too many entries.');
+		if LenInputs > 0 then
+			PtrInputs := @AInputs[0]
+		else
+			PtrInputs := nil;
+		
+		countNeededOutputs:= 0;
+		countWrittenOutputs:= 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImplicitEvaluator_EvaluateBatchFunc(FHandle, QWord(LenInputs), PtrInputs, 0, countNeededOutputs, nil));
+		SetLength(AOutputs, countNeededOutputs);
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImplicitEvaluator_EvaluateBatchFunc(FHandle, QWord(LenInputs), PtrInputs, countNeededOutputs, countWrittenOutputs, @AOutputs[0]));
+	end;
+
+	procedure TLib3MFImplicitEvaluator.EvaluateBounds(const AInputMinima: TDoubleDynArray; const AInputMaxima: TDoubleDynArray; out AOutputMinima: TDoubleDynArray; out AOutputMaxima: TDoubleDynArray);
+	var
+		PtrInputMinima: PDouble;
+		LenInputMinima: QWord;
+		PtrInputMaxima: PDouble;
+		LenInputMaxima: QWord;
+		countNeededOutputMinima: QWord;
+		countWrittenOutputMinima: QWord;
+		countNeededOutputMaxima: QWord;
+		countWrittenOutputMaxima: QWord;
+	begin
+		LenInputMinima := Length(AInputMinima);
+		if LenInputMinima > $FFFFFFFF then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'array has too many entries.');
+		if LenInputMinima > 0 then
+			PtrInputMinima := @AInputMinima[0]
+		else
+			PtrInputMinima := nil;
+		
+		LenInputMaxima := Length(AInputMaxima);
+		if LenInputMaxima > $FFFFFFFF then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'array has too many entries.');
+		if LenInputMaxima > 0 then
+			PtrInputMaxima := @AInputMaxima[0]
+		else
+			PtrInputMaxima := nil;
+		
+		countNeededOutputMinima:= 0;
+		countWrittenOutputMinima:= 0;
+		countNeededOutputMaxima:= 0;
+		countWrittenOutputMaxima:= 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImplicitEvaluator_EvaluateBoundsFunc(FHandle, QWord(LenInputMinima), PtrInputMinima, QWord(LenInputMaxima), PtrInputMaxima, 0, countNeededOutputMinima, nil, 0, countNeededOutputMaxima, nil));
+		SetLength(AOutputMaxima, countNeededOutputMaxima);
+		SetLength(AOutputMinima, countNeededOutputMinima);
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImplicitEvaluator_EvaluateBoundsFunc(FHandle, QWord(LenInputMinima), PtrInputMinima, QWord(LenInputMaxima), PtrInputMaxima, countNeededOutputMinima, countWrittenOutputMinima, @AOutputMinima[0], countNeededOutputMaxima, countWrittenOutputMaxima, @AOutputMaxima[0]));
+	end;
+
 (*************************************************************************************************************************
  Class implementation for FunctionFromImage3D
 **************************************************************************************************************************)
@@ -17655,6 +18581,73 @@ implementation
 		FWrapper.CheckError(Self, FWrapper.Lib3MFFunctionFromImage3D_SetScaleFunc(FHandle, AScale));
 	end;
 
+	function TLib3MFFunctionFromImage3D.CreateSampler(): TLib3MFImage3DSampler;
+	var
+		HSampler: TLib3MFHandle;
+	begin
+		Result := nil;
+		HSampler := nil;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFFunctionFromImage3D_CreateSamplerFunc(FHandle, HSampler));
+		if Assigned(HSampler) then
+			Result := TLib3MFPolymorphicFactory<TLib3MFImage3DSampler, TLib3MFImage3DSampler>.Make(FWrapper, HSampler);
+	end;
+
+(*************************************************************************************************************************
+ Class implementation for Image3DSampler
+**************************************************************************************************************************)
+
+	constructor TLib3MFImage3DSampler.Create(AWrapper: TLib3MFWrapper; AHandle: TLib3MFHandle);
+	begin
+		inherited Create(AWrapper, AHandle);
+	end;
+
+	destructor TLib3MFImage3DSampler.Destroy;
+	begin
+		inherited;
+	end;
+
+	procedure TLib3MFImage3DSampler.SetCacheSize(const ACacheSize: QWord);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImage3DSampler_SetCacheSizeFunc(FHandle, ACacheSize));
+	end;
+
+	function TLib3MFImage3DSampler.GetCacheSize(): QWord;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImage3DSampler_GetCacheSizeFunc(FHandle, Result));
+	end;
+
+	procedure TLib3MFImage3DSampler.SetWorkerThreadCount(const AThreadCount: Cardinal);
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImage3DSampler_SetWorkerThreadCountFunc(FHandle, AThreadCount));
+	end;
+
+	function TLib3MFImage3DSampler.GetWorkerThreadCount(): Cardinal;
+	begin
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImage3DSampler_GetWorkerThreadCountFunc(FHandle, Result));
+	end;
+
+	procedure TLib3MFImage3DSampler.Sample(const AUVW: TDoubleDynArray; out ARGBA: TDoubleDynArray);
+	var
+		PtrUVW: PDouble;
+		LenUVW: QWord;
+		countNeededRGBA: QWord;
+		countWrittenRGBA: QWord;
+	begin
+		LenUVW := Length(AUVW);
+		if LenUVW > $FFFFFFFF then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_INVALIDPARAM, 'array has too many entries.');
+		if LenUVW > 0 then
+			PtrUVW := @AUVW[0]
+		else
+			PtrUVW := nil;
+		
+		countNeededRGBA:= 0;
+		countWrittenRGBA:= 0;
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImage3DSampler_SampleFunc(FHandle, QWord(LenUVW), PtrUVW, 0, countNeededRGBA, nil));
+		SetLength(ARGBA, countNeededRGBA);
+		FWrapper.CheckError(Self, FWrapper.Lib3MFImage3DSampler_SampleFunc(FHandle, QWord(LenUVW), PtrUVW, countNeededRGBA, countWrittenRGBA, @ARGBA[0]));
+	end;
+
 (*************************************************************************************************************************
  Class implementation for BuildItem
 **************************************************************************************************************************)
@@ -19388,6 +20381,12 @@ implementation
 		FLib3MFWriter_SetProgressCallbackFunc := LoadFunction('lib3mf_writer_setprogresscallback');
 		FLib3MFWriter_GetDecimalPrecisionFunc := LoadFunction('lib3mf_writer_getdecimalprecision');
 		FLib3MFWriter_SetDecimalPrecisionFunc := LoadFunction('lib3mf_writer_setdecimalprecision');
+		FLib3MFWriter_SetShortestRoundtripActiveFunc := LoadFunction('lib3mf_writer_setshortestroundtripactive');
+		FLib3MFWriter_GetShortestRoundtripActiveFunc := LoadFunction('lib3mf_writer_getshortestroundtripactive');
+		FLib3MFWriter_SetWorkerThreadCountFunc := LoadFunction('lib3mf_writer_setworkerthreadcount');
+		FLib3MFWriter_GetWorkerThreadCountFunc := LoadFunction('lib3mf_writer_getworkerthreadcount');
+		FLib3MFWriter_SetCompressionLevelFunc := LoadFunction('lib3mf_writer_setcompressionlevel');
+		FLib3MFWriter_GetCompressionLevelFunc := LoadFunction('lib3mf_writer_getcompressionlevel');
 		FLib3MFWriter_SetStrictModeActiveFunc := LoadFunction('lib3mf_writer_setstrictmodeactive');
 		FLib3MFWriter_GetStrictModeActiveFunc := LoadFunction('lib3mf_writer_getstrictmodeactive');
 		FLib3MFWriter_GetWarningFunc := LoadFunction('lib3mf_writer_getwarning');
@@ -19402,10 +20401,21 @@ implementation
 		FLib3MFReader_RemoveRelationToReadFunc := LoadFunction('lib3mf_reader_removerelationtoread');
 		FLib3MFReader_SetStrictModeActiveFunc := LoadFunction('lib3mf_reader_setstrictmodeactive');
 		FLib3MFReader_GetStrictModeActiveFunc := LoadFunction('lib3mf_reader_getstrictmodeactive');
+		FLib3MFReader_SetWorkerThreadCountFunc := LoadFunction('lib3mf_reader_setworkerthreadcount');
+		FLib3MFReader_GetWorkerThreadCountFunc := LoadFunction('lib3mf_reader_getworkerthreadcount');
+		FLib3MFReader_SetMeshStreamCallbacksFunc := LoadFunction('lib3mf_reader_setmeshstreamcallbacks');
+		FLib3MFReader_SetLazyMeshLoadingActiveFunc := LoadFunction('lib3mf_reader_setlazymeshloadingactive');
+		FLib3MFReader_GetLazyMeshLoadingActiveFunc := LoadFunction('lib3mf_reader_getlazymeshloadingactive');
 		FLib3MFReader_GetWarningFunc := LoadFunction('lib3mf_reader_getwarning');
 		FLib3MFReader_GetWarningCountFunc := LoadFunction('lib3mf_reader_getwarningcount');
 		FLib3MFReader_AddKeyWrappingCallbackFunc := LoadFunction('lib3mf_reader_addkeywrappingcallback');
 		FLib3MFReader_SetContentEncryptionCallbackFunc := LoadFunction('lib3mf_reader_setcontentencryptioncallback');
+		FLib3MFStreamingWriter_BeginMeshObjectFunc := LoadFunction('lib3mf_streamingwriter_beginmeshobject');
+		FLib3MFStreamingWriter_AddVerticesFunc := LoadFunction('lib3mf_streamingwriter_addvertices');
+		FLib3MFStreamingWriter_AddTrianglesFunc := LoadFunction('lib3mf_streamingwriter_addtriangles');
+		FLib3MFStreamingWriter_EndMeshObjectFunc := LoadFunction('lib3mf_streamingwriter_endmeshobject');
+		FLib3MFStreamingWriter_AddBuildItemFunc := LoadFunction('lib3mf_streamingwriter_addbuilditem');
+		FLib3MFStreamingWriter_FinishFunc := LoadFunction('lib3mf_streamingwriter_finish');
 		FLib3MFPackagePart_GetPathFunc := LoadFunction('lib3mf_packagepart_getpath');
 		FLib3MFPackagePart_SetPathFunc := LoadFunction('lib3mf_packagepart_setpath');
 		FLib3MFResource_GetResourceIDFunc := LoadFunction('lib3mf_resource_getresourceid');
@@ -19490,10 +20500,14 @@ implementation
 		FLib3MFMeshObject_SetVertexFunc := LoadFunction('lib3mf_meshobject_setvertex');
 		FLib3MFMeshObject_AddVertexFunc := LoadFunction('lib3mf_meshobject_addvertex');
 		FLib3MFMeshObject_GetVerticesFunc := LoadFunction('lib3mf_meshobject_getvertices');
+		FLib3MFMeshObject_GetVertexPageCountFunc := LoadFunction('lib3mf_meshobject_getvertexpagecount');
+		FLib3MFMeshObject_GetVertexPageFunc := LoadFunction('lib3mf_meshobject_getvertexpage');
 		FLib3MFMeshObject_GetTriangleFunc := LoadFunction('lib3mf_meshobject_gettriangle');
 		FLib3MFMeshObject_SetTriangleFunc := LoadFunction('lib3mf_meshobject_settriangle');
 		FLib3MFMeshObject_AddTriangleFunc := LoadFunction('lib3mf_meshobject_addtriangle');
 		FLib3MFMeshObject_GetTriangleIndicesFunc := LoadFunction('lib3mf_meshobject_gettriangleindices');
+		FLib3MFMeshObject_GetTrianglePageCountFunc := LoadFunction('lib3mf_meshobject_gettrianglepagecount');
+		FLib3MFMeshObject_GetTrianglePageFunc := LoadFunction('lib3mf_meshobject_gettrianglepage');
 		FLib3MFMeshObject_SetObjectLevelPropertyFunc := LoadFunction('lib3mf_meshobject_setobjectlevelproperty');
 		FLib3MFMeshObject_GetObjectLevelPropertyFunc := LoadFunction('lib3mf_meshobject_getobjectlevelproperty');
 		FLib3MFMeshObject_SetTrianglePropertiesFunc := LoadFunction('lib3mf_meshobject_settriangleproperties');
@@ -19502,7 +20516,9 @@ implementation
 		FLib3MFMeshObject_GetAllTrianglePropertiesFunc := LoadFunction('lib3mf_meshobject_getalltriangleproperties');
 		FLib3MFMeshObject_ClearAllPropertiesFunc := LoadFunction('lib3mf_meshobject_clearallproperties');
 		FLib3MFMeshObject_SetGeometryFunc := LoadFunction('lib3mf_meshobject_setgeometry');
+		FLib3MFMeshObject_ReserveGeometryFunc := LoadFunction('lib3mf_meshobject_reservegeometry');
 		FLib3MFMeshObject_IsManifoldAndOrientedFunc := LoadFunction('lib3mf_meshobject_ismanifoldandoriented');
+		FLib3MFMeshObject_IsGeometryLoadedFunc := LoadFunction('lib3mf_meshobject_isgeometryloaded');
 		FLib3MFMeshObject_BeamLatticeFunc := LoadFunction('lib3mf_meshobject_beamlattice');
 		FLib3MFMeshObject_GetVolumeDataFunc := LoadFunction('lib3mf_meshobject_getvolumedata');
 		FLib3MFMeshObject_SetVolumeDataFunc := LoadFunction('lib3mf_meshobject_setvolumedata');
@@ -19824,6 +20840,14 @@ implementation
 		FLib3MFImplicitFunction_AddLinkByNamesFunc := LoadFunction('lib3mf_implicitfunction_addlinkbynames');
 		FLib3MFImplicitFunction_ClearFunc := LoadFunction('lib3mf_implicitfunction_clear');
 		FLib3MFImplicitFunction_SortNodesTopologicallyFunc := LoadFunction('lib3mf_implicitfunction_sortnodestopologically');
+		FLib3MFImplicitFunction_CreateEvaluatorFunc := LoadFunction('lib3mf_implicitfunction_createevaluator');
+		FLib3MFImplicitEvaluator_GetInputStrideFunc := LoadFunction('lib3mf_implicitevaluator_getinputstride');
+		FLib3MFImplicitEvaluator_GetOutputStrideFunc := LoadFunction('lib3mf_implicitevaluator_getoutputstride');
+		FLib3MFImplicitEvaluator_SetWorkerThreadCountFunc := LoadFunction('lib3mf_implicitevaluator_setworkerthreadcount');
+		FLib3MFImplicitEvaluator_GetWorkerThreadCountFunc := LoadFunction('lib3mf_implicitevaluator_getworkerthreadcount');
+		FLib3MFImplicitEvaluator_EvaluateFunc := LoadFunction('lib3mf_implicitevaluator_evaluate');
+		FLib3MFImplicitEvaluator_EvaluateBatchFunc := LoadFunction('lib3mf_implicitevaluator_evaluatebatch');
+		FLib3MFImplicitEvaluator_EvaluateBoundsFunc := LoadFunction('lib3mf_implicitevaluator_evaluatebounds');
 		FLib3MFFunctionFromImage3D_GetImage3DFunc := LoadFunction('lib3mf_functionfromimage3d_getimage3d');
 		FLib3MFFunctionFromImage3D_SetImage3DFunc := LoadFunction('lib3mf_functionfromimage3d_setimage3d');
 		FLib3MFFunctionFromImage3D_SetFilterFunc := LoadFunction('lib3mf_functionfromimage3d_setfilter');
@@ -19834,6 +20858,12 @@ implementation
 		FLib3MFFunctionFromImage3D_SetOffsetFunc := LoadFunction('lib3mf_functionfromimage3d_setoffset');
 		FLib3MFFunctionFromImage3D_GetScaleFunc := LoadFunction('lib3mf_functionfromimage3d_getscale');
 		FLib3MFFunctionFromImage3D_SetScaleFunc := LoadFunction('lib3mf_functionfromimage3d_setscale');
+		FLib3MFFunctionFromImage3D_CreateSamplerFunc := LoadFunction('lib3mf_functionfromimage3d_createsampler');
+		FLib3MFImage3DSampler_SetCacheSizeFunc := LoadFunction('lib3mf_image3dsampler_setcachesize');
+		FLib3MFImage3DSampler_GetCacheSizeFunc := LoadFunction('lib3mf_image3dsampler_getcachesize');
+		FLib3MFImage3DSampler_SetWorkerThreadCountFunc := LoadFunction('lib3mf_image3dsampler_setworkerthreadcount');
+		FLib3MFImage3DSampler_GetWorkerThreadCountFunc := LoadFunction('lib3mf_image3dsampler_getworkerthreadcount');
+		FLib3MFImage3DSampler_SampleFunc := LoadFunction('lib3mf_image3dsampler_sample');
 		FLib3MFBuildItem_GetObjectResourceFunc := LoadFunction('lib3mf_builditem_getobjectresource');
 		FLib3MFBuildItem_GetUUIDFunc := LoadFunction('lib3mf_builditem_getuuid');
 		FLib3MFBuildItem_SetUUIDFunc := LoadFunction('lib3mf_builditem_setuuid');
@@ -19986,6 +21016,7 @@ implementation
 		FLib3MFGetBuildInformationFunc := LoadFunction('lib3mf_getbuildinformation');
 		FLib3MFGetSpecificationVersionFunc := LoadFunction('lib3mf_getspecificationversion');
 		FLib3MFCreateModelFunc := LoadFunction('lib3mf_createmodel');
+		FLib3MFCreateStreamingWriterFunc := LoadFunction('lib3mf_createstreamingwriter');
 		FLib3MFReleaseFunc := LoadFunction('lib3mf_release');
 		FLib3MFAcquireFunc := LoadFunction('lib3mf_acquire');
 		FLib3MFSetJournalFunc := LoadFunction('lib3mf_setjournal');
@@ -20033,6 +21064,24 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_setdecimalprecision'), @FLib3MFWriter_SetDecimalPrecisionFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_setshortestroundtripactive'), @FLib3MFWriter_SetShortestRoundtripActiveFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_getshortestroundtripactive'), @FLib3MFWriter_GetShortestRoundtripActiveFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_setworkerthreadcount'), @FLib3MFWriter_SetWorkerThreadCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_getworkerthreadcount'), @FLib3MFWriter_GetWorkerThreadCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_setcompressionlevel'), @FLib3MFWriter_SetCompressionLevelFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_getcompressionlevel'), @FLib3MFWriter_GetCompressionLevelFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_writer_setstrictmodeactive'), @FLib3MFWriter_SetStrictModeActiveFunc);
@@ -20075,6 +21124,21 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_getstrictmodeactive'), @FLib3MFReader_GetStrictModeActiveFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_setworkerthreadcount'), @FLib3MFReader_SetWorkerThreadCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_getworkerthreadcount'), @FLib3MFReader_GetWorkerThreadCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_setmeshstreamcallbacks'), @FLib3MFReader_SetMeshStreamCallbacksFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_setlazymeshloadingactive'), @FLib3MFReader_SetLazyMeshLoadingActiveFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_getlazymeshloadingactive'), @FLib3MFReader_GetLazyMeshLoadingActiveFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_getwarning'), @FLib3MFReader_GetWarningFunc);
@@ -20087,6 +21151,24 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_reader_setcontentencryptioncallback'), @FLib3MFReader_SetContentEncryptionCallbackFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_streamingwriter_beginmeshobject'), @FLib3MFStreamingWriter_BeginMeshObjectFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_streamingwriter_addvertices'), @FLib3MFStreamingWriter_AddVerticesFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_streamingwriter_addtriangles'), @FLib3MFStreamingWriter_AddTrianglesFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_streamingwriter_endmeshobject'), @FLib3MFStreamingWriter_EndMeshObjectFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_streamingwriter_addbuilditem'), @FLib3MFStreamingWriter_AddBuildItemFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_streamingwriter_finish'), @FLib3MFStreamingWriter_FinishFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_packagepart_getpath'), @FLib3MFPackagePart_GetPathFunc);
@@ -20339,6 +21421,12 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_meshobject_getvertices'), @FLib3MFMeshObject_GetVerticesFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_meshobject_getvertexpagecount'), @FLib3MFMeshObject_GetVertexPageCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_meshobject_getvertexpage'), @FLib3MFMeshObject_GetVertexPageFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_meshobject_gettriangle'), @FLib3MFMeshObject_GetTriangleFunc);
@@ -20351,6 +21439,12 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_meshobject_gettriangleindices'), @FLib3MFMeshObject_GetTriangleIndicesFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_meshobject_gettrianglepagecount'), @FLib3MFMeshObject_GetTrianglePageCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_meshobject_gettrianglepage'), @FLib3MFMeshObject_GetTrianglePageFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_meshobject_setobjectlevelproperty'), @FLib3MFMeshObject_SetObjectLevelPropertyFunc);
@@ -20375,9 +21469,15 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_meshobject_setgeometry'), @FLib3MFMeshObject_SetGeometryFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_meshobject_reservegeometry'), @FLib3MFMeshObject_ReserveGeometryFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_meshobject_ismanifoldandoriented'), @FLib3MFMeshObject_IsManifoldAndOrientedFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_meshobject_isgeometryloaded'), @FLib3MFMeshObject_IsGeometryLoadedFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_meshobject_beamlattice'), @FLib3MFMeshObject_BeamLatticeFunc);
@@ -21341,6 +22441,30 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_implicitfunction_sortnodestopologically'), @FLib3MFImplicitFunction_SortNodesTopologicallyFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_implicitfunction_createevaluator'), @FLib3MFImplicitFunction_CreateEvaluatorFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_implicitevaluator_getinputstride'), @FLib3MFImplicitEvaluator_GetInputStrideFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_implicitevaluator_getoutputstride'), @FLib3MFImplicitEvaluator_GetOutputStrideFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_implicitevaluator_setworkerthreadcount'), @FLib3MFImplicitEvaluator_SetWorkerThreadCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_implicitevaluator_getworkerthreadcount'), @FLib3MFImplicitEvaluator_GetWorkerThreadCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_implicitevaluator_evaluate'), @FLib3MFImplicitEvaluator_EvaluateFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_implicitevaluator_evaluatebatch'), @FLib3MFImplicitEvaluator_EvaluateBatchFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_implicitevaluator_evaluatebounds'), @FLib3MFImplicitEvaluator_EvaluateBoundsFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_functionfromimage3d_getimage3d'), @FLib3MFFunctionFromImage3D_GetImage3DFunc);
@@ -21371,6 +22495,24 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_functionfromimage3d_setscale'), @FLib3MFFunctionFromImage3D_SetScaleFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_functionfromimage3d_createsampler'), @FLib3MFFunctionFromImage3D_CreateSamplerFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_image3dsampler_setcachesize'), @FLib3MFImage3DSampler_SetCacheSizeFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_image3dsampler_getcachesize'), @FLib3MFImage3DSampler_GetCacheSizeFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_image3dsampler_setworkerthreadcount'), @FLib3MFImage3DSampler_SetWorkerThreadCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_image3dsampler_getworkerthreadcount'), @FLib3MFImage3DSampler_GetWorkerThreadCountFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_image3dsampler_sample'), @FLib3MFImage3DSampler_SampleFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_builditem_getobjectresource'), @FLib3MFBuildItem_GetObjectResourceFunc);
@@ -21827,6 +22969,9 @@ implementation
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_createmodel'), @FLib3MFCreateModelFunc);
+		if AResult <> LIB3MF_SUCCESS then
+			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
+		AResult := ALookupMethod(PAnsiChar('lib3mf_createstreamingwriter'), @FLib3MFCreateStreamingWriterFunc);
 		if AResult <> LIB3MF_SUCCESS then
 			raise ELib3MFException.CreateCustomMessage(LIB3MF_ERROR_COULDNOTLOADLIBRARY, '');
 		AResult := ALookupMethod(PAnsiChar('lib3mf_release'), @FLib3MFReleaseFunc);
@@ -21987,6 +23132,17 @@ implementation
 			Result := TLib3MFPolymorphicFactory<TLib3MFModel, TLib3MFModel>.Make(Self, HModel);
 	end;
 
+	function TLib3MFWrapper.CreateStreamingWriter(const AFilename: String; const AUnit: TLib3MFModelUnit): TLib3MFStreamingWriter;
+	var
+		HStreamingWriter: TLib3MFHandle;
+	begin
+		Result := nil;
+		HStreamingWriter := nil;
+		CheckError(nil, Lib3MFCreateStreamingWriterFunc(PAnsiChar(AFilename), convertModelUnitToConst(AUnit), HStreamingWriter));
+		if Assigned(HStreamingWriter) then
+			Result := TLib3MFPolymorphicFactory<TLib3MFStreamingWriter, TLib3MFStreamingWriter>.Make(Self, HStreamingWriter);
+	end;
+
 	procedure TLib3MFWrapper.Release(const AInstance: TLib3MFBase);
 	var
 		AInstanceHandle: TLib3MFHandle;
@@ -123,6 +123,7 @@ class FunctionTable:
 	lib3mf_getbuildinformation = None
 	lib3mf_getspecificationversion = None
 	lib3mf_createmodel = None
+	lib3mf_createstreamingwriter = None
 	lib3mf_release = None
 	lib3mf_acquire = None
 	lib3mf_setjournal = None
@@ -145,6 +146,12 @@ class FunctionTable:
 	lib3mf_writer_setprogresscallback = None
 	lib3mf_writer_getdecimalprecision = None
 	lib3mf_writer_setdecimalprecision = None
+	lib3mf_writer_setshortestroundtripactive = None
+	lib3mf_writer_getshortestroundtripactive = None
+	lib3mf_writer_setworkerthreadcount = None
+	lib3mf_writer_getworkerthreadcount = None
+	lib3mf_writer_setcompressionlevel = None
+	lib3mf_writer_getcompressionlevel = None
 	lib3mf_writer_setstrictmodeactive = None
 	lib3mf_writer_getstrictmodeactive = None
 	lib3mf_writer_getwarning = None
@@ -159,10 +166,21 @@ class FunctionTable:
 	lib3mf_reader_removerelationtoread = None
 	lib3mf_reader_setstrictmodeactive = None
 	lib3mf_reader_getstrictmodeactive = None
+	lib3mf_reader_setworkerthreadcount = None
+	lib3mf_reader_getworkerthreadcount = None
+	lib3mf_reader_setmeshstreamcallbacks = None
+	lib3mf_reader_setlazymeshloadingactive = None
+	lib3mf_reader_getlazymeshloadingactive = None
 	lib3mf_reader_getwarning = None
 	lib3mf_reader_getwarningcount = None
 	lib3mf_reader_addkeywrappingcallback = None
 	lib3mf_reader_setcontentencryptioncallback = None
+	lib3mf_streamingwriter_beginmeshobject = None
+	lib3mf_streamingwriter_addvertices = None
+	lib3mf_streamingwriter_addtriangles = None
+	lib3mf_streamingwriter_endmeshobject = None
+	lib3mf_streamingwriter_addbuilditem = None
+	lib3mf_streamingwriter_finish = None
 	lib3mf_packagepart_getpath = None
 	lib3mf_packagepart_setpath = None
 	lib3mf_resource_getresourceid = None
@@ -247,10 +265,14 @@ class FunctionTable:
 	lib3mf_meshobject_setvertex = None
 	lib3mf_meshobject_addvertex = None
 	lib3mf_meshobject_getvertices = None
+	lib3mf_meshobject_getvertexpagecount = None
+	lib3mf_meshobject_getvertexpage = None
 	lib3mf_meshobject_gettriangle = None
 	lib3mf_meshobject_settriangle = None
 	lib3mf_meshobject_addtriangle = None
 	lib3mf_meshobject_gettriangleindices = None
+	lib3mf_meshobject_gettrianglepagecount = None
+	lib3mf_meshobject_gettrianglepage = None
 	lib3mf_meshobject_setobjectlevelproperty = None
 	lib3mf_meshobject_getobjectlevelproperty = None
 	lib3mf_meshobject_settriangleproperties = None
@@ -259,7 +281,9 @@ class FunctionTable:
 	lib3mf_meshobject_getalltriangleproperties = None
 	lib3mf_meshobject_clearallproperties = None
 	lib3mf_meshobject_setgeometry = None
+	lib3mf_meshobject_reservegeometry = None
 	lib3mf_meshobject_ismanifoldandoriented = None
+	lib3mf_meshobject_isgeometryloaded = None
 	lib3mf_meshobject_beamlattice = None
 	lib3mf_meshobject_getvolumedata = None
 	lib3mf_meshobject_setvolumedata = None
@@ -581,6 +605,14 @@ class FunctionTable:
 	lib3mf_implicitfunction_addlinkbynames = None
 	lib3mf_implicitfunction_clear = None
 	lib3mf_implicitfunction_sortnodestopologically = None
+	lib3mf_implicitfunction_createevaluator = None
+	lib3mf_implicitevaluator_getinputstride = None
+	lib3mf_implicitevaluator_getoutputstride = None
+	lib3mf_implicitevaluator_setworkerthreadcount = None
+	lib3mf_implicitevaluator_getworkerthreadcount = None
+	lib3mf_implicitevaluator_evaluate = None
+	lib3mf_implicitevaluator_evaluatebatch = None
+	lib3mf_implicitevaluator_evaluatebounds = None
 	lib3mf_functionfromimage3d_getimage3d = None
 	lib3mf_functionfromimage3d_setimage3d = None
 	lib3mf_functionfromimage3d_setfilter = None
@@ -591,6 +623,12 @@ class FunctionTable:
 	lib3mf_functionfromimage3d_setoffset = None
 	lib3mf_functionfromimage3d_getscale = None
 	lib3mf_functionfromimage3d_setscale = None
+	lib3mf_functionfromimage3d_createsampler = None
+	lib3mf_image3dsampler_setcachesize = None
+	lib3mf_image3dsampler_getcachesize = None
+	lib3mf_image3dsampler_setworkerthreadcount = None
+	lib3mf_image3dsampler_getworkerthreadcount = None
+	lib3mf_image3dsampler_sample = None
 	lib3mf_builditem_getobjectresource = None
 	lib3mf_builditem_getuuid = None
 	lib3mf_builditem_setuuid = None
@@ -868,6 +906,19 @@ class CompositionMethod(CTypesEnum):
 class CompositionSpace(CTypesEnum):
 	Raw = 0
 	LinearColor = 1
+'''Definition of PackagePartType
+'''
+class PackagePartType(CTypesEnum):
+	Model = 0
+	Image = 1
+	Attachment = 2
+'''Definition of CompressionLevel
+'''
+class CompressionLevel(CTypesEnum):
+	Stored = 0
+	Fastest = 1
+	Default = 6
+	Maximum = 9
 '''Definition of ImplicitNodeType
 '''
 class ImplicitNodeType(CTypesEnum):
@@ -1097,6 +1148,14 @@ SeekCallback = ctypes.CFUNCTYPE(ctypes.c_void_p, ctypes.c_uint64, ctypes.c_void_
 		Callback to generate random numbers
 '''
 RandomNumberCallback = ctypes.CFUNCTYPE(ctypes.c_void_p, ctypes.c_uint64, ctypes.c_uint64, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint64))
+'''Definition of VertexBlockCallback
+		Callback to receive a block of vertices of a mesh object while it is read
+'''
+VertexBlockCallback = ctypes.CFUNCTYPE(ctypes.c_void_p, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint64, ctypes.POINTER(Position), ctypes.c_void_p)
+'''Definition of TriangleBlockCallback
+		Callback to receive a block of triangles of a mesh object while it is read
+'''
+TriangleBlockCallback = ctypes.CFUNCTYPE(ctypes.c_void_p, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint64, ctypes.POINTER(Triangle), ctypes.c_void_p)
 '''Definition of KeyWrappingCallback
 		A callback used to wrap (encrypt) the content key available in keystore resource group
 '''
@@ -1178,6 +1237,12 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.POINTER(ctypes.c_void_p))
 			self.lib.lib3mf_createmodel = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_createstreamingwriter")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_char_p, ModelUnit, ctypes.POINTER(ctypes.c_void_p))
+			self.lib.lib3mf_createstreamingwriter = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_release")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -1310,6 +1375,42 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32)
 			self.lib.lib3mf_writer_setdecimalprecision = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_setshortestroundtripactive")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_bool)
+			self.lib.lib3mf_writer_setshortestroundtripactive = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_getshortestroundtripactive")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool))
+			self.lib.lib3mf_writer_getshortestroundtripactive = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_setworkerthreadcount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32)
+			self.lib.lib3mf_writer_setworkerthreadcount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_getworkerthreadcount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_writer_getworkerthreadcount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_setcompressionlevel")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, PackagePartType, CompressionLevel)
+			self.lib.lib3mf_writer_setcompressionlevel = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_getcompressionlevel")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, PackagePartType, ctypes.POINTER(ctypes.c_int32))
+			self.lib.lib3mf_writer_getcompressionlevel = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_writer_setstrictmodeactive")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -1394,6 +1495,36 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool))
 			self.lib.lib3mf_reader_getstrictmodeactive = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_setworkerthreadcount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32)
+			self.lib.lib3mf_reader_setworkerthreadcount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_getworkerthreadcount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_reader_getworkerthreadcount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_setmeshstreamcallbacks")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, VertexBlockCallback, TriangleBlockCallback, ctypes.c_bool, ctypes.c_void_p)
+			self.lib.lib3mf_reader_setmeshstreamcallbacks = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_setlazymeshloadingactive")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_bool)
+			self.lib.lib3mf_reader_setlazymeshloadingactive = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_getlazymeshloadingactive")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool))
+			self.lib.lib3mf_reader_getlazymeshloadingactive = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_reader_getwarning")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -1418,6 +1549,42 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ContentEncryptionCallback, ctypes.c_void_p)
 			self.lib.lib3mf_reader_setcontentencryptioncallback = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_streamingwriter_beginmeshobject")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_char_p, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_streamingwriter_beginmeshobject = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_streamingwriter_addvertices")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(Position))
+			self.lib.lib3mf_streamingwriter_addvertices = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_streamingwriter_addtriangles")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(Triangle))
+			self.lib.lib3mf_streamingwriter_addtriangles = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_streamingwriter_endmeshobject")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p)
+			self.lib.lib3mf_streamingwriter_endmeshobject = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_streamingwriter_addbuilditem")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(Transform))
+			self.lib.lib3mf_streamingwriter_addbuilditem = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_streamingwriter_finish")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p)
+			self.lib.lib3mf_streamingwriter_finish = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_packagepart_getpath")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -1922,6 +2089,18 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(Position))
 			self.lib.lib3mf_meshobject_getvertices = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_meshobject_getvertexpagecount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_meshobject_getvertexpagecount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_meshobject_getvertexpage")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_void_p))
+			self.lib.lib3mf_meshobject_getvertexpage = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_meshobject_gettriangle")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -1946,6 +2125,18 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(Triangle))
 			self.lib.lib3mf_meshobject_gettriangleindices = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_meshobject_gettrianglepagecount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_meshobject_gettrianglepagecount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_meshobject_gettrianglepage")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_void_p))
+			self.lib.lib3mf_meshobject_gettrianglepage = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_meshobject_setobjectlevelproperty")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -1994,12 +2185,24 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(Position), ctypes.c_uint64, ctypes.POINTER(Triangle))
 			self.lib.lib3mf_meshobject_setgeometry = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_meshobject_reservegeometry")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint32)
+			self.lib.lib3mf_meshobject_reservegeometry = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_meshobject_ismanifoldandoriented")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool))
 			self.lib.lib3mf_meshobject_ismanifoldandoriented = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_meshobject_isgeometryloaded")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool))
+			self.lib.lib3mf_meshobject_isgeometryloaded = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_meshobject_beamlattice")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -3926,6 +4129,54 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p)
 			self.lib.lib3mf_implicitfunction_sortnodestopologically = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_implicitfunction_createevaluator")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_void_p))
+			self.lib.lib3mf_implicitfunction_createevaluator = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_implicitevaluator_getinputstride")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_implicitevaluator_getinputstride = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_implicitevaluator_getoutputstride")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_implicitevaluator_getoutputstride = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_implicitevaluator_setworkerthreadcount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32)
+			self.lib.lib3mf_implicitevaluator_setworkerthreadcount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_implicitevaluator_getworkerthreadcount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_implicitevaluator_getworkerthreadcount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_implicitevaluator_evaluate")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_double), ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_double))
+			self.lib.lib3mf_implicitevaluator_evaluate = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_implicitevaluator_evaluatebatch")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_double), ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_double))
+			self.lib.lib3mf_implicitevaluator_evaluatebatch = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_implicitevaluator_evaluatebounds")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_double), ctypes.c_uint64, ctypes.POINTER(ctypes.c_double), ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_double), ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_double))
+			self.lib.lib3mf_implicitevaluator_evaluatebounds = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_functionfromimage3d_getimage3d")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -3986,6 +4237,42 @@ class Wrapper:
 			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_double)
 			self.lib.lib3mf_functionfromimage3d_setscale = methodType(int(methodAddress.value))
 			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_functionfromimage3d_createsampler")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_void_p))
+			self.lib.lib3mf_functionfromimage3d_createsampler = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_image3dsampler_setcachesize")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64)
+			self.lib.lib3mf_image3dsampler_setcachesize = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_image3dsampler_getcachesize")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint64))
+			self.lib.lib3mf_image3dsampler_getcachesize = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_image3dsampler_setworkerthreadcount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint32)
+			self.lib.lib3mf_image3dsampler_setworkerthreadcount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_image3dsampler_getworkerthreadcount")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32))
+			self.lib.lib3mf_image3dsampler_getworkerthreadcount = methodType(int(methodAddress.value))
+			
+			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_image3dsampler_sample")), methodAddress)
+			if err != 0:
+				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
+			methodType = ctypes.CFUNCTYPE(ctypes.c_int32, ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_double), ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_double))
+			self.lib.lib3mf_image3dsampler_sample = methodType(int(methodAddress.value))
+			
 			err = symbolLookupMethod(ctypes.c_char_p(str.encode("lib3mf_builditem_getobjectresource")), methodAddress)
 			if err != 0:
 				raise ELib3MFException(ErrorCodes.COULDNOTLOADLIBRARY, str(err))
@@ -4888,6 +5175,9 @@ class Wrapper:
 			self.lib.lib3mf_createmodel.restype = ctypes.c_int32
 			self.lib.lib3mf_createmodel.argtypes = [ctypes.POINTER(ctypes.c_void_p)]
 			
+			self.lib.lib3mf_createstreamingwriter.restype = ctypes.c_int32
+			self.lib.lib3mf_createstreamingwriter.argtypes = [ctypes.c_char_p, ModelUnit, ctypes.POINTER(ctypes.c_void_p)]
+			
 			self.lib.lib3mf_release.restype = ctypes.c_int32
 			self.lib.lib3mf_release.argtypes = [ctypes.c_void_p]
 			
@@ -4954,6 +5244,24 @@ class Wrapper:
 			self.lib.lib3mf_writer_setdecimalprecision.restype = ctypes.c_int32
 			self.lib.lib3mf_writer_setdecimalprecision.argtypes = [ctypes.c_void_p, ctypes.c_uint32]
 			
+			self.lib.lib3mf_writer_setshortestroundtripactive.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_setshortestroundtripactive.argtypes = [ctypes.c_void_p, ctypes.c_bool]
+			
+			self.lib.lib3mf_writer_getshortestroundtripactive.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_getshortestroundtripactive.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool)]
+			
+			self.lib.lib3mf_writer_setworkerthreadcount.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_setworkerthreadcount.argtypes = [ctypes.c_void_p, ctypes.c_uint32]
+			
+			self.lib.lib3mf_writer_getworkerthreadcount.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_getworkerthreadcount.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
+			
+			self.lib.lib3mf_writer_setcompressionlevel.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_setcompressionlevel.argtypes = [ctypes.c_void_p, PackagePartType, CompressionLevel]
+			
+			self.lib.lib3mf_writer_getcompressionlevel.restype = ctypes.c_int32
+			self.lib.lib3mf_writer_getcompressionlevel.argtypes = [ctypes.c_void_p, PackagePartType, ctypes.POINTER(ctypes.c_int32)]
+			
 			self.lib.lib3mf_writer_setstrictmodeactive.restype = ctypes.c_int32
 			self.lib.lib3mf_writer_setstrictmodeactive.argtypes = [ctypes.c_void_p, ctypes.c_bool]
 			
@@ -4996,6 +5304,21 @@ class Wrapper:
 			self.lib.lib3mf_reader_getstrictmodeactive.restype = ctypes.c_int32
 			self.lib.lib3mf_reader_getstrictmodeactive.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool)]
 			
+			self.lib.lib3mf_reader_setworkerthreadcount.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_setworkerthreadcount.argtypes = [ctypes.c_void_p, ctypes.c_uint32]
+			
+			self.lib.lib3mf_reader_getworkerthreadcount.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_getworkerthreadcount.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
+			
+			self.lib.lib3mf_reader_setmeshstreamcallbacks.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_setmeshstreamcallbacks.argtypes = [ctypes.c_void_p, VertexBlockCallback, TriangleBlockCallback, ctypes.c_bool, ctypes.c_void_p]
+			
+			self.lib.lib3mf_reader_setlazymeshloadingactive.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_setlazymeshloadingactive.argtypes = [ctypes.c_void_p, ctypes.c_bool]
+			
+			self.lib.lib3mf_reader_getlazymeshloadingactive.restype = ctypes.c_int32
+			self.lib.lib3mf_reader_getlazymeshloadingactive.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool)]
+			
 			self.lib.lib3mf_reader_getwarning.restype = ctypes.c_int32
 			self.lib.lib3mf_reader_getwarning.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint32), ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.c_char_p]
 			
@@ -5008,6 +5331,24 @@ class Wrapper:
 			self.lib.lib3mf_reader_setcontentencryptioncallback.restype = ctypes.c_int32
 			self.lib.lib3mf_reader_setcontentencryptioncallback.argtypes = [ctypes.c_void_p, ContentEncryptionCallback, ctypes.c_void_p]
 			
+			self.lib.lib3mf_streamingwriter_beginmeshobject.restype = ctypes.c_int32
+			self.lib.lib3mf_streamingwriter_beginmeshobject.argtypes = [ctypes.c_void_p, ctypes.c_char_p, ctypes.POINTER(ctypes.c_uint32)]
+			
+			self.lib.lib3mf_streamingwriter_addvertices.restype = ctypes.c_int32
+			self.lib.lib3mf_streamingwriter_addvertices.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(Position)]
+			
+			self.lib.lib3mf_streamingwriter_addtriangles.restype = ctypes.c_int32
+			self.lib.lib3mf_streamingwriter_addtriangles.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(Triangle)]
+			
+			self.lib.lib3mf_streamingwriter_endmeshobject.restype = ctypes.c_int32
+			self.lib.lib3mf_streamingwriter_endmeshobject.argtypes = [ctypes.c_void_p]
+			
+			self.lib.lib3mf_streamingwriter_addbuilditem.restype = ctypes.c_int32
+			self.lib.lib3mf_streamingwriter_addbuilditem.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(Transform)]
+			
+			self.lib.lib3mf_streamingwriter_finish.restype = ctypes.c_int32
+			self.lib.lib3mf_streamingwriter_finish.argtypes = [ctypes.c_void_p]
+			
 			self.lib.lib3mf_packagepart_getpath.restype = ctypes.c_int32
 			self.lib.lib3mf_packagepart_getpath.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.c_char_p]
 			
@@ -5260,6 +5601,12 @@ class Wrapper:
 			self.lib.lib3mf_meshobject_getvertices.restype = ctypes.c_int32
 			self.lib.lib3mf_meshobject_getvertices.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(Position)]
 			
+			self.lib.lib3mf_meshobject_getvertexpagecount.restype = ctypes.c_int32
+			self.lib.lib3mf_meshobject_getvertexpagecount.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
+			
+			self.lib.lib3mf_meshobject_getvertexpage.restype = ctypes.c_int32
+			self.lib.lib3mf_meshobject_getvertexpage.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_void_p)]
+			
 			self.lib.lib3mf_meshobject_gettriangle.restype = ctypes.c_int32
 			self.lib.lib3mf_meshobject_gettriangle.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(Triangle)]
 			
@@ -5272,6 +5619,12 @@ class Wrapper:
 			self.lib.lib3mf_meshobject_gettriangleindices.restype = ctypes.c_int32
 			self.lib.lib3mf_meshobject_gettriangleindices.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(Triangle)]
 			
+			self.lib.lib3mf_meshobject_gettrianglepagecount.restype = ctypes.c_int32
+			self.lib.lib3mf_meshobject_gettrianglepagecount.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
+			
+			self.lib.lib3mf_meshobject_gettrianglepage.restype = ctypes.c_int32
+			self.lib.lib3mf_meshobject_gettrianglepage.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_void_p)]
+			
 			self.lib.lib3mf_meshobject_setobjectlevelproperty.restype = ctypes.c_int32
 			self.lib.lib3mf_meshobject_setobjectlevelproperty.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.c_uint32]
 			
@@ -5296,9 +5649,15 @@ class Wrapper:
 			self.lib.lib3mf_meshobject_setgeometry.restype = ctypes.c_int32
 			self.lib.lib3mf_meshobject_setgeometry.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(Position), ctypes.c_uint64, ctypes.POINTER(Triangle)]
 			
+			self.lib.lib3mf_meshobject_reservegeometry.restype = ctypes.c_int32
+			self.lib.lib3mf_meshobject_reservegeometry.argtypes = [ctypes.c_void_p, ctypes.c_uint32, ctypes.c_uint32, ctypes.c_uint32]
+			
 			self.lib.lib3mf_meshobject_ismanifoldandoriented.restype = ctypes.c_int32
 			self.lib.lib3mf_meshobject_ismanifoldandoriented.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool)]
 			
+			self.lib.lib3mf_meshobject_isgeometryloaded.restype = ctypes.c_int32
+			self.lib.lib3mf_meshobject_isgeometryloaded.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_bool)]
+			
 			self.lib.lib3mf_meshobject_beamlattice.restype = ctypes.c_int32
 			self.lib.lib3mf_meshobject_beamlattice.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_void_p)]
 			
@@ -6262,6 +6621,30 @@ class Wrapper:
 			self.lib.lib3mf_implicitfunction_sortnodestopologically.restype = ctypes.c_int32
 			self.lib.lib3mf_implicitfunction_sortnodestopologically.argtypes = [ctypes.c_void_p]
 			
+			self.lib.lib3mf_implicitfunction_createevaluator.restype = ctypes.c_int32
+			self.lib.lib3mf_implicitfunction_createevaluator.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_void_p)]
+			
+			self.lib.lib3mf_implicitevaluator_getinputstride.restype = ctypes.c_int32
+			self.lib.lib3mf_implicitevaluator_getinputstride.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
+			
+			self.lib.lib3mf_implicitevaluator_getoutputstride.restype = ctypes.c_int32
+			self.lib.lib3mf_implicitevaluator_getoutputstride.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
+			
+			self.lib.lib3mf_implicitevaluator_setworkerthreadcount.restype = ctypes.c_int32
+			self.lib.lib3mf_implicitevaluator_setworkerthreadcount.argtypes = [ctypes.c_void_p, ctypes.c_uint32]
+			
+			self.lib.lib3mf_implicitevaluator_getworkerthreadcount.restype = ctypes.c_int32
+			self.lib.lib3mf_implicitevaluator_getworkerthreadcount.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
+			
+			self.lib.lib3mf_implicitevaluator_evaluate.restype = ctypes.c_int32
+			self.lib.lib3mf_implicitevaluator_evaluate.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_double), ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_double)]
+			
+			self.lib.lib3mf_implicitevaluator_evaluatebatch.restype = ctypes.c_int32
+			self.lib.lib3mf_implicitevaluator_evaluatebatch.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_double), ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_double)]
+			
+			self.lib.lib3mf_implicitevaluator_evaluatebounds.restype = ctypes.c_int32
+			self.lib.lib3mf_implicitevaluator_evaluatebounds.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_double), ctypes.c_uint64, ctypes.POINTER(ctypes.c_double), ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_double), ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_double)]
+			
 			self.lib.lib3mf_functionfromimage3d_getimage3d.restype = ctypes.c_int32
 			self.lib.lib3mf_functionfromimage3d_getimage3d.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_void_p)]
 			
@@ -6292,6 +6675,24 @@ class Wrapper:
 			self.lib.lib3mf_functionfromimage3d_setscale.restype = ctypes.c_int32
 			self.lib.lib3mf_functionfromimage3d_setscale.argtypes = [ctypes.c_void_p, ctypes.c_double]
 			
+			self.lib.lib3mf_functionfromimage3d_createsampler.restype = ctypes.c_int32
+			self.lib.lib3mf_functionfromimage3d_createsampler.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_void_p)]
+			
+			self.lib.lib3mf_image3dsampler_setcachesize.restype = ctypes.c_int32
+			self.lib.lib3mf_image3dsampler_setcachesize.argtypes = [ctypes.c_void_p, ctypes.c_uint64]
+			
+			self.lib.lib3mf_image3dsampler_getcachesize.restype = ctypes.c_int32
+			self.lib.lib3mf_image3dsampler_getcachesize.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint64)]
+			
+			self.lib.lib3mf_image3dsampler_setworkerthreadcount.restype = ctypes.c_int32
+			self.lib.lib3mf_image3dsampler_setworkerthreadcount.argtypes = [ctypes.c_void_p, ctypes.c_uint32]
+			
+			self.lib.lib3mf_image3dsampler_getworkerthreadcount.restype = ctypes.c_int32
+			self.lib.lib3mf_image3dsampler_getworkerthreadcount.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint32)]
+			
+			self.lib.lib3mf_image3dsampler_sample.restype = ctypes.c_int32
+			self.lib.lib3mf_image3dsampler_sample.argtypes = [ctypes.c_void_p, ctypes.c_uint64, ctypes.POINTER(ctypes.c_double), ctypes.c_uint64, ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_double)]
+			
 			self.lib.lib3mf_builditem_getobjectresource.restype = ctypes.c_int32
 			self.lib.lib3mf_builditem_getobjectresource.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_void_p)]
 			
@@ -6801,6 +7202,17 @@ class Wrapper:
 		
 		return ModelObject
 	
+	def CreateStreamingWriter(self, Filename, Unit):
+		pFilename = ctypes.c_char_p(str.encode(Filename))
+		StreamingWriterHandle = ctypes.c_void_p()
+		self.checkError(None, self.lib.lib3mf_createstreamingwriter(pFilename, Unit, StreamingWriterHandle))
+		if StreamingWriterHandle:
+			StreamingWriterObject = self._polymorphicFactory(StreamingWriterHandle)
+		else:
+			raise ELib3MFException(ErrorCodes.INVALIDCAST, 'Invalid return/output value')
+		
+		return StreamingWriterObject
+	
 	def Release(self, InstanceObject):
 		InstanceHandle = None
 		if InstanceObject:
@@ -6945,6 +7357,8 @@ class Wrapper:
 				return Writer(handle, wrapper)
 			def getObjectById_2D86831DA59FBE72(self, handle, wrapper): # First 64 bits of SHA1 of a string: "Lib3MF::Reader"
 				return Reader(handle, wrapper)
+			def getObjectById_34D1B75E74821821(self, handle, wrapper): # First 64 bits of SHA1 of a string: "Lib3MF::StreamingWriter"
+				return StreamingWriter(handle, wrapper)
 			def getObjectById_0E55A826D377483E(self, handle, wrapper): # First 64 bits of SHA1 of a string: "Lib3MF::PackagePart"
 				return PackagePart(handle, wrapper)
 			def getObjectById_DFE3889D1B269CBB(self, handle, wrapper): # First 64 bits of SHA1 of a string: "Lib3MF::Resource"
@@ -7147,8 +7561,12 @@ class Wrapper:
 				return Function(handle, wrapper)
 			def getObjectById_6CE54469EEA83BC1(self, handle, wrapper): # First 64 bits of SHA1 of a string: "Lib3MF::ImplicitFunction"
 				return ImplicitFunction(handle, wrapper)
+			def getObjectById_624A6556CD0D2735(self, handle, wrapper): # First 64 bits of SHA1 of a string: "Lib3MF::ImplicitEvaluator"
+				return ImplicitEvaluator(handle, wrapper)
 			def getObjectById_9BD7D3C2026B8CE8(self, handle, wrapper): # First 64 bits of SHA1 of a string: "Lib3MF::FunctionFromImage3D"
 				return FunctionFromImage3D(handle, wrapper)
+			def getObjectById_ABDCDB2C6189432A(self, handle, wrapper): # First 64 bits of SHA1 of a string: "Lib3MF::Image3DSampler"
+				return Image3DSampler(handle, wrapper)
 			def getObjectById_68FB2D5FFC4BA12A(self, handle, wrapper): # First 64 bits of SHA1 of a string: "Lib3MF::BuildItem"
 				return BuildItem(handle, wrapper)
 			def getObjectById_A7D21BD364910860(self, handle, wrapper): # First 64 bits of SHA1 of a string: "Lib3MF::BuildItemIterator"
@@ -7248,6 +7666,38 @@ class Writer(Base):
 		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_setdecimalprecision(self._handle, nDecimalPrecision))
 		
 	
+	def SetShortestRoundtripActive(self, ShortestRoundtripActive):
+		bShortestRoundtripActive = ctypes.c_bool(ShortestRoundtripActive)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_setshortestroundtripactive(self._handle, bShortestRoundtripActive))
+		
+	
+	def GetShortestRoundtripActive(self):
+		pShortestRoundtripActive = ctypes.c_bool()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_getshortestroundtripactive(self._handle, pShortestRoundtripActive))
+		
+		return pShortestRoundtripActive.value
+	
+	def SetWorkerThreadCount(self, ThreadCount):
+		nThreadCount = ctypes.c_uint32(ThreadCount)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_setworkerthreadcount(self._handle, nThreadCount))
+		
+	
+	def GetWorkerThreadCount(self):
+		pThreadCount = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_getworkerthreadcount(self._handle, pThreadCount))
+		
+		return pThreadCount.value
+	
+	def SetCompressionLevel(self, PartType, Level):
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_setcompressionlevel(self._handle, PartType, Level))
+		
+	
+	def GetCompressionLevel(self, PartType):
+		pLevel = ctypes.c_int32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_getcompressionlevel(self._handle, PartType, pLevel))
+		
+		return CompressionLevel(pLevel.value)
+	
 	def SetStrictModeActive(self, StrictModeActive):
 		bStrictModeActive = ctypes.c_bool(StrictModeActive)
 		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_writer_setstrictmodeactive(self._handle, bStrictModeActive))
@@ -7339,6 +7789,34 @@ class Reader(Base):
 		
 		return pStrictModeActive.value
 	
+	def SetWorkerThreadCount(self, ThreadCount):
+		nThreadCount = ctypes.c_uint32(ThreadCount)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_setworkerthreadcount(self._handle, nThreadCount))
+		
+	
+	def GetWorkerThreadCount(self):
+		pThreadCount = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_getworkerthreadcount(self._handle, pThreadCount))
+		
+		return pThreadCount.value
+	
+	def SetMeshStreamCallbacks(self, TheVertexBlockCallbackFunc, TheTriangleBlockCallbackFunc, RetainGeometry, UserData):
+		bRetainGeometry = ctypes.c_bool(RetainGeometry)
+		pUserData = ctypes.c_void_p(UserData)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_setmeshstreamcallbacks(self._handle, TheVertexBlockCallbackFunc, TheTriangleBlockCallbackFunc, bRetainGeometry, pUserData))
+		
+	
+	def SetLazyMeshLoadingActive(self, LazyMeshLoadingActive):
+		bLazyMeshLoadingActive = ctypes.c_bool(LazyMeshLoadingActive)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_setlazymeshloadingactive(self._handle, bLazyMeshLoadingActive))
+		
+	
+	def GetLazyMeshLoadingActive(self):
+		pLazyMeshLoadingActive = ctypes.c_bool()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_reader_getlazymeshloadingactive(self._handle, pLazyMeshLoadingActive))
+		
+		return pLazyMeshLoadingActive.value
+	
 	def GetWarning(self, Index):
 		nIndex = ctypes.c_uint32(Index)
 		pErrorCode = ctypes.c_uint32()
@@ -7371,6 +7849,45 @@ class Reader(Base):
 	
 
 
+''' Class Implementation for StreamingWriter
+'''
+class StreamingWriter(Base):
+	def __init__(self, handle, wrapper):
+		Base.__init__(self, handle, wrapper)
+	def BeginMeshObject(self, Name):
+		pName = ctypes.c_char_p(str.encode(Name))
+		pObjectID = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_streamingwriter_beginmeshobject(self._handle, pName, pObjectID))
+		
+		return pObjectID.value
+	
+	def AddVertices(self, Vertices):
+		nVerticesCount = ctypes.c_uint64(len(Vertices))
+		pVerticesBuffer = (Position*len(Vertices))(*Vertices)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_streamingwriter_addvertices(self._handle, nVerticesCount, pVerticesBuffer))
+		
+	
+	def AddTriangles(self, Indices):
+		nIndicesCount = ctypes.c_uint64(len(Indices))
+		pIndicesBuffer = (Triangle*len(Indices))(*Indices)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_streamingwriter_addtriangles(self._handle, nIndicesCount, pIndicesBuffer))
+		
+	
+	def EndMeshObject(self):
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_streamingwriter_endmeshobject(self._handle))
+		
+	
+	def AddBuildItem(self, ObjectID, Transform):
+		nObjectID = ctypes.c_uint32(ObjectID)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_streamingwriter_addbuilditem(self._handle, nObjectID, Transform))
+		
+	
+	def Finish(self):
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_streamingwriter_finish(self._handle))
+		
+	
+
+
 ''' Class Implementation for PackagePart
 '''
 class PackagePart(Base):
@@ -8178,6 +8695,21 @@ class MeshObject(Object):
 		
 		return [pVerticesBuffer[i] for i in range(nVerticesNeededCount.value)]
 	
+	def GetVertexPageCount(self):
+		pPageCount = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_meshobject_getvertexpagecount(self._handle, pPageCount))
+		
+		return pPageCount.value
+	
+	def GetVertexPage(self, PageIndex):
+		nPageIndex = ctypes.c_uint32(PageIndex)
+		pVertexCount = ctypes.c_uint32()
+		pStride = ctypes.c_uint32()
+		pCoordinates = ctypes.c_void_p()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_meshobject_getvertexpage(self._handle, nPageIndex, pVertexCount, pStride, pCoordinates))
+		
+		return pVertexCount.value, pStride.value, pCoordinates.value
+	
 	def GetTriangle(self, Index):
 		nIndex = ctypes.c_uint32(Index)
 		pIndices = Triangle()
@@ -8207,6 +8739,21 @@ class MeshObject(Object):
 		
 		return [pIndicesBuffer[i] for i in range(nIndicesNeededCount.value)]
 	
+	def GetTrianglePageCount(self):
+		pPageCount = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_meshobject_gettrianglepagecount(self._handle, pPageCount))
+		
+		return pPageCount.value
+	
+	def GetTrianglePage(self, PageIndex):
+		nPageIndex = ctypes.c_uint32(PageIndex)
+		pTriangleCount = ctypes.c_uint32()
+		pStride = ctypes.c_uint32()
+		pIndices = ctypes.c_void_p()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_meshobject_gettrianglepage(self._handle, nPageIndex, pTriangleCount, pStride, pIndices))
+		
+		return pTriangleCount.value, pStride.value, pIndices.value
+	
 	def SetObjectLevelProperty(self, UniqueResourceID, PropertyID):
 		nUniqueResourceID = ctypes.c_uint32(UniqueResourceID)
 		nPropertyID = ctypes.c_uint32(PropertyID)
@@ -8262,12 +8809,25 @@ class MeshObject(Object):
 		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_meshobject_setgeometry(self._handle, nVerticesCount, pVerticesBuffer, nIndicesCount, pIndicesBuffer))
 		
 	
+	def ReserveGeometry(self, VertexCount, TriangleCount, BeamCount):
+		nVertexCount = ctypes.c_uint32(VertexCount)
+		nTriangleCount = ctypes.c_uint32(TriangleCount)
+		nBeamCount = ctypes.c_uint32(BeamCount)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_meshobject_reservegeometry(self._handle, nVertexCount, nTriangleCount, nBeamCount))
+		
+	
 	def IsManifoldAndOriented(self):
 		pIsManifoldAndOriented = ctypes.c_bool()
 		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_meshobject_ismanifoldandoriented(self._handle, pIsManifoldAndOriented))
 		
 		return pIsManifoldAndOriented.value
 	
+	def IsGeometryLoaded(self):
+		pIsGeometryLoaded = ctypes.c_bool()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_meshobject_isgeometryloaded(self._handle, pIsGeometryLoaded))
+		
+		return pIsGeometryLoaded.value
+	
 	def BeamLattice(self):
 		TheBeamLatticeHandle = ctypes.c_void_p()
 		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_meshobject_beamlattice(self._handle, TheBeamLatticeHandle))
@@ -11693,6 +12253,92 @@ class ImplicitFunction(Function):
 		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_implicitfunction_sortnodestopologically(self._handle))
 		
 	
+	def CreateEvaluator(self):
+		EvaluatorHandle = ctypes.c_void_p()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_implicitfunction_createevaluator(self._handle, EvaluatorHandle))
+		if EvaluatorHandle:
+			EvaluatorObject = self._wrapper._polymorphicFactory(EvaluatorHandle)
+		else:
+			raise ELib3MFException(ErrorCodes.INVALIDCAST, 'Invalid return/output value')
+		
+		return EvaluatorObject
+	
+
+
+''' Class Implementation for ImplicitEvaluator
+'''
+class ImplicitEvaluator(Base):
+	def __init__(self, handle, wrapper):
+		Base.__init__(self, handle, wrapper)
+	def GetInputStride(self):
+		pStride = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_implicitevaluator_getinputstride(self._handle, pStride))
+		
+		return pStride.value
+	
+	def GetOutputStride(self):
+		pStride = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_implicitevaluator_getoutputstride(self._handle, pStride))
+		
+		return pStride.value
+	
+	def SetWorkerThreadCount(self, ThreadCount):
+		nThreadCount = ctypes.c_uint32(ThreadCount)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_implicitevaluator_setworkerthreadcount(self._handle, nThreadCount))
+		
+	
+	def GetWorkerThreadCount(self):
+		pThreadCount = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_implicitevaluator_getworkerthreadcount(self._handle, pThreadCount))
+		
+		return pThreadCount.value
+	
+	def Evaluate(self, Inputs):
+		nInputsCount = ctypes.c_uint64(len(Inputs))
+		pInputsBuffer = (ctypes.c_double*len(Inputs))(*Inputs)
+		nOutputsCount = ctypes.c_uint64(0)
+		nOutputsNeededCount = ctypes.c_uint64(0)
+		pOutputsBuffer = (ctypes.c_double*0)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_implicitevaluator_evaluate(self._handle, nInputsCount, pInputsBuffer, nOutputsCount, nOutputsNeededCount, pOutputsBuffer))
+		nOutputsCount = ctypes.c_uint64(nOutputsNeededCount.value)
+		pOutputsBuffer = (ctypes.c_double * nOutputsNeededCount.value)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_implicitevaluator_evaluate(self._handle, nInputsCount, pInputsBuffer, nOutputsCount, nOutputsNeededCount, pOutputsBuffer))
+		
+		return [pOutputsBuffer[i] for i in range(nOutputsNeededCount.value)]
+	
+	def EvaluateBatch(self, Inputs):
+		nInputsCount = ctypes.c_uint64(len(Inputs))
+		pInputsBuffer = (ctypes.c_double*len(Inputs))(*Inputs)
+		nOutputsCount = ctypes.c_uint64(0)
+		nOutputsNeededCount = ctypes.c_uint64(0)
+		pOutputsBuffer = (ctypes.c_double*0)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_implicitevaluator_evaluatebatch(self._handle, nInputsCount, pInputsBuffer, nOutputsCount, nOutputsNeededCount, pOutputsBuffer))
+		nOutputsCount = ctypes.c_uint64(nOutputsNeededCount.value)
+		pOutputsBuffer = (ctypes.c_double * nOutputsNeededCount.value)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_implicitevaluator_evaluatebatch(self._handle, nInputsCount, pInputsBuffer, nOutputsCount, nOutputsNeededCount, pOutputsBuffer))
+		
+		return [pOutputsBuffer[i] for i in range(nOutputsNeededCount.value)]
+	
+	def EvaluateBounds(self, InputMinima, InputMaxima):
+		nInputMinimaCount = ctypes.c_uint64(len(InputMinima))
+		pInputMinimaBuffer = (ctypes.c_double*len(InputMinima))(*InputMinima)
+		nInputMaximaCount = ctypes.c_uint64(len(InputMaxima))
+		pInputMaximaBuffer = (ctypes.c_double*len(InputMaxima))(*InputMaxima)
+		nOutputMinimaCount = ctypes.c_uint64(0)
+		nOutputMinimaNeededCount = ctypes.c_uint64(0)
+		pOutputMinimaBuffer = (ctypes.c_double*0)()
+		nOutputMaximaCount = ctypes.c_uint64(0)
+		nOutputMaximaNeededCount = ctypes.c_uint64(0)
+		pOutputMaximaBuffer = (ctypes.c_double*0)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_implicitevaluator_evaluatebounds(self._handle, nInputMinimaCount, pInputMinimaBuffer, nInputMaximaCount, pInputMaximaBuffer, nOutputMinimaCount, nOutputMinimaNeededCount, pOutputMinimaBuffer, nOutputMaximaCount, nOutputMaximaNeededCount, pOutputMaximaBuffer))
+		nOutputMinimaCount = ctypes.c_uint64(nOutputMinimaNeededCount.value)
+		pOutputMinimaBuffer = (ctypes.c_double * nOutputMinimaNeededCount.value)()
+		nOutputMaximaCount = ctypes.c_uint64(nOutputMaximaNeededCount.value)
+		pOutputMaximaBuffer = (ctypes.c_double * nOutputMaximaNeededCount.value)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_implicitevaluator_evaluatebounds(self._handle, nInputMinimaCount, pInputMinimaBuffer, nInputMaximaCount, pInputMaximaBuffer, nOutputMinimaCount, nOutputMinimaNeededCount, pOutputMinimaBuffer, nOutputMaximaCount, nOutputMaximaNeededCount, pOutputMaximaBuffer))
+		
+		return [pOutputMinimaBuffer[i] for i in range(nOutputMinimaNeededCount.value)], [pOutputMaximaBuffer[i] for i in range(nOutputMaximaNeededCount.value)]
+	
 
 
 ''' Class Implementation for FunctionFromImage3D
@@ -11763,6 +12409,58 @@ class FunctionFromImage3D(Function):
 		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_functionfromimage3d_setscale(self._handle, dScale))
 		
 	
+	def CreateSampler(self):
+		SamplerHandle = ctypes.c_void_p()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_functionfromimage3d_createsampler(self._handle, SamplerHandle))
+		if SamplerHandle:
+			SamplerObject = self._wrapper._polymorphicFactory(SamplerHandle)
+		else:
+			raise ELib3MFException(ErrorCodes.INVALIDCAST, 'Invalid return/output value')
+		
+		return SamplerObject
+	
+
+
+''' Class Implementation for Image3DSampler
+'''
+class Image3DSampler(Base):
+	def __init__(self, handle, wrapper):
+		Base.__init__(self, handle, wrapper)
+	def SetCacheSize(self, CacheSize):
+		nCacheSize = ctypes.c_uint64(CacheSize)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_image3dsampler_setcachesize(self._handle, nCacheSize))
+		
+	
+	def GetCacheSize(self):
+		pCacheSize = ctypes.c_uint64()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_image3dsampler_getcachesize(self._handle, pCacheSize))
+		
+		return pCacheSize.value
+	
+	def SetWorkerThreadCount(self, ThreadCount):
+		nThreadCount = ctypes.c_uint32(ThreadCount)
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_image3dsampler_setworkerthreadcount(self._handle, nThreadCount))
+		
+	
+	def GetWorkerThreadCount(self):
+		pThreadCount = ctypes.c_uint32()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_image3dsampler_getworkerthreadcount(self._handle, pThreadCount))
+		
+		return pThreadCount.value
+	
+	def Sample(self, UVW):
+		nUVWCount = ctypes.c_uint64(len(UVW))
+		pUVWBuffer = (ctypes.c_double*len(UVW))(*UVW)
+		nRGBACount = ctypes.c_uint64(0)
+		nRGBANeededCount = ctypes.c_uint64(0)
+		pRGBABuffer = (ctypes.c_double*0)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_image3dsampler_sample(self._handle, nUVWCount, pUVWBuffer, nRGBACount, nRGBANeededCount, pRGBABuffer))
+		nRGBACount = ctypes.c_uint64(nRGBANeededCount.value)
+		pRGBABuffer = (ctypes.c_double * nRGBANeededCount.value)()
+		self._wrapper.checkError(self, self._wrapper.lib.lib3mf_image3dsampler_sample(self._handle, nUVWCount, pUVWBuffer, nRGBACount, nRGBANeededCount, pRGBABuffer))
+		
+		return [pRGBABuffer[i] for i in range(nRGBANeededCount.value)]
+	
 
 
 ''' Class Implementation for BuildItem
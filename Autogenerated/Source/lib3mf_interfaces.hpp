@@ -54,6 +54,7 @@ namespace Impl {
 class IBase;
 class IWriter;
 class IReader;
+class IStreamingWriter;
 class IPackagePart;
 class IResource;
 class IResourceIterator;
@@ -155,7 +156,9 @@ class IFunctionCallNode;
 class INodeIterator;
 class IFunction;
 class IImplicitFunction;
+class IImplicitEvaluator;
 class IFunctionFromImage3D;
+class IImage3DSampler;
 class IBuildItem;
 class IBuildItemIterator;
 class ISlice;
@@ -435,6 +438,44 @@ public:
 	*/
 	virtual void SetDecimalPrecision(const Lib3MF_uint32 nDecimalPrecision) = 0;
 
+	/**
+	* IWriter::SetShortestRoundtripActive - Activates (deactivates) the shortest round-trip output of mesh coordinates and radii. Each value is written with the fewest digits that read back as exactly the same number; the decimal precision is ignored while active.
+	* @param[in] bShortestRoundtripActive - flag whether shortest round-trip output is active or not.
+	*/
+	virtual void SetShortestRoundtripActive(const bool bShortestRoundtripActive) = 0;
+
+	/**
+	* IWriter::GetShortestRoundtripActive - Queries whether the shortest round-trip output of mesh coordinates and radii is active or not.
+	* @return returns flag whether shortest round-trip output is active or not.
+	*/
+	virtual bool GetShortestRoundtripActive() = 0;
+
+	/**
+	* IWriter::SetWorkerThreadCount - Sets the number of threads the writer may use to compress package parts and to render large meshes. 0 selects the number of hardware threads, 1 disables parallel writing.
+	* @param[in] nThreadCount - Number of threads, including the calling thread. 0 means automatic.
+	*/
+	virtual void SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount) = 0;
+
+	/**
+	* IWriter::GetWorkerThreadCount - Returns the number of threads the writer may use to compress package parts and to render large meshes.
+	* @return Number of threads, including the calling thread. 0 means automatic.
+	*/
+	virtual Lib3MF_uint32 GetWorkerThreadCount() = 0;
+
+	/**
+	* IWriter::SetCompressionLevel - Sets the compression of all parts of a kind. Already compressed images are best stored without compression.
+	* @param[in] ePartType - The kind of parts to configure.
+	* @param[in] eLevel - The compression level. Defaults to Fastest for all kinds of parts. Once it is set, encrypted parts are deflated with it before encryption and stored without further compression.
+	*/
+	virtual void SetCompressionLevel(const Lib3MF::ePackagePartType ePartType, const Lib3MF::eCompressionLevel eLevel) = 0;
+
+	/**
+	* IWriter::GetCompressionLevel - Returns the compression of all parts of a kind.
+	* @param[in] ePartType - The kind of parts to query.
+	* @return The compression level.
+	*/
+	virtual Lib3MF::eCompressionLevel GetCompressionLevel(const Lib3MF::ePackagePartType ePartType) = 0;
+
 	/**
 	* IWriter::SetStrictModeActive - Activates (deactivates) the strict mode of the reader.
 	* @param[in] bStrictModeActive - flag whether strict mode is active or not.
@@ -549,6 +590,39 @@ public:
 	*/
 	virtual bool GetStrictModeActive() = 0;
 
+	/**
+	* IReader::SetWorkerThreadCount - Sets the number of threads the reader may use to decode mesh data. 0 selects the number of hardware threads. With 1 (the default), vertex and triangle lists are still decoded by the streaming mesh decoder, but on the calling thread only.
+	* @param[in] nThreadCount - Number of threads, including the calling thread. 0 means automatic.
+	*/
+	virtual void SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount) = 0;
+
+	/**
+	* IReader::GetWorkerThreadCount - Returns the number of threads the reader may use to decode mesh data.
+	* @return Number of threads, including the calling thread. 0 means automatic.
+	*/
+	virtual Lib3MF_uint32 GetWorkerThreadCount() = 0;
+
+	/**
+	* IReader::SetMeshStreamCallbacks - Hands the vertices and triangles of all mesh objects to callbacks in blocks while they are read. Blocks of one mesh object are delivered in document order, and vertices are delivered before the triangles that refer to them. If the geometry is not retained, the meshes of the read model stay empty, while objects, components and build items are still read. Beam lattices and triangle sets require the geometry to be retained.
+	* @param[in] pTheVertexBlockCallback - Callback to call for every block of vertices. May be null.
+	* @param[in] pTheTriangleBlockCallback - Callback to call for every block of triangles. May be null.
+	* @param[in] bRetainGeometry - If true, the geometry is read into the model as well.
+	* @param[in] pUserData - Userdata that is passed to the callback functions
+	*/
+	virtual void SetMeshStreamCallbacks(const Lib3MF::VertexBlockCallback pTheVertexBlockCallback, const Lib3MF::TriangleBlockCallback pTheTriangleBlockCallback, const bool bRetainGeometry, const Lib3MF_pvoid pUserData) = 0;
+
+	/**
+	* IReader::SetLazyMeshLoadingActive - Defers parsing the geometry of mesh objects until it is first accessed. The model part is kept in memory after reading, and each mesh is parsed from it on first access. Ignored if mesh stream callbacks are set.
+	* @param[in] bLazyMeshLoadingActive - Flag whether mesh geometry is parsed on first access
+	*/
+	virtual void SetLazyMeshLoadingActive(const bool bLazyMeshLoadingActive) = 0;
+
+	/**
+	* IReader::GetLazyMeshLoadingActive - Returns whether mesh geometry is parsed on first access.
+	* @return Flag whether mesh geometry is parsed on first access
+	*/
+	virtual bool GetLazyMeshLoadingActive() = 0;
+
 	/**
 	* IReader::GetWarning - Returns Warning and Error Information of the read process
 	* @param[in] nIndex - Index of the Warning. Valid values are 0 to WarningCount - 1
@@ -583,6 +657,64 @@ public:
 typedef IBaseSharedPtr<IReader> PIReader;
 
 
+/*************************************************************************************************************************
+ Class interface for StreamingWriter 
+**************************************************************************************************************************/
+
+class IStreamingWriter : public virtual IBase {
+public:
+	/**
+	* IStreamingWriter::ClassTypeId - Get Class Type Id
+	* @return Class type as a 64 bits integer
+	*/
+	Lib3MF_uint64 ClassTypeId() override
+	{
+		return 0x34D1B75E74821821UL; // First 64 bits of SHA1 of a string: "Lib3MF::StreamingWriter"
+	}
+
+	/**
+	* IStreamingWriter::BeginMeshObject - Starts a new mesh object. All of its vertices must be added before its triangles.
+	* @param[in] sName - Name of the object. May be empty.
+	* @return Resource ID of the new mesh object.
+	*/
+	virtual Lib3MF_uint32 BeginMeshObject(const std::string & sName) = 0;
+
+	/**
+	* IStreamingWriter::AddVertices - Writes a batch of vertices of the current mesh object. Vertex indices continue over all batches of the object.
+	* @param[in] nVerticesBufferSize - Number of elements in buffer
+	* @param[in] pVerticesBuffer - Positions of the vertices
+	*/
+	virtual void AddVertices(const Lib3MF_uint64 nVerticesBufferSize, const Lib3MF::sPosition * pVerticesBuffer) = 0;
+
+	/**
+	* IStreamingWriter::AddTriangles - Writes a batch of triangles of the current mesh object. No further vertices may be added to the object afterwards.
+	* @param[in] nIndicesBufferSize - Number of elements in buffer
+	* @param[in] pIndicesBuffer - Vertex indices of the triangles. They must refer to vertices, which have already been added to the object.
+	*/
+	virtual void AddTriangles(const Lib3MF_uint64 nIndicesBufferSize, const Lib3MF::sTriangle * pIndicesBuffer) = 0;
+
+	/**
+	* IStreamingWriter::EndMeshObject - Finishes the current mesh object.
+	*/
+	virtual void EndMeshObject() = 0;
+
+	/**
+	* IStreamingWriter::AddBuildItem - Adds a build item. It is written when the package is finished.
+	* @param[in] nObjectID - Resource ID of a finished mesh object.
+	* @param[in] Transform - Transformation matrix.
+	*/
+	virtual void AddBuildItem(const Lib3MF_uint32 nObjectID, const Lib3MF::sTransform Transform) = 0;
+
+	/**
+	* IStreamingWriter::Finish - Writes the build items and closes the package. No further calls are allowed afterwards.
+	*/
+	virtual void Finish() = 0;
+
+};
+
+typedef IBaseSharedPtr<IStreamingWriter> PIStreamingWriter;
+
+
 /*************************************************************************************************************************
  Class interface for PackagePart 
 **************************************************************************************************************************/
@@ -1519,6 +1651,21 @@ public:
 	*/
 	virtual void GetVertices(Lib3MF_uint64 nVerticesBufferSize, Lib3MF_uint64* pVerticesNeededCount, Lib3MF::sPosition * pVerticesBuffer) = 0;
 
+	/**
+	* IMeshObject::GetVertexPageCount - Returns the number of pages in which the vertices of the mesh object are stored.
+	* @return the number of vertex pages.
+	*/
+	virtual Lib3MF_uint32 GetVertexPageCount() = 0;
+
+	/**
+	* IMeshObject::GetVertexPage - Returns direct read access to a page of vertices without copying them. The memory is owned by the mesh object, must not be written to and is only valid until the mesh is modified or released.
+	* @param[in] nPageIndex - index of the page (0 to pagecount - 1).
+	* @param[out] nVertexCount - number of vertices stored in the page.
+	* @param[out] nStride - distance in bytes between two consecutive vertices.
+	* @return pointer to the three single precision coordinates of the first vertex in the page.
+	*/
+	virtual Lib3MF_pvoid GetVertexPage(const Lib3MF_uint32 nPageIndex, Lib3MF_uint32 & nVertexCount, Lib3MF_uint32 & nStride) = 0;
+
 	/**
 	* IMeshObject::GetTriangle - Returns indices of a single triangle of a mesh object.
 	* @param[in] nIndex - Index of the triangle (0 to trianglecount - 1)
@@ -1548,6 +1695,21 @@ public:
 	*/
 	virtual void GetTriangleIndices(Lib3MF_uint64 nIndicesBufferSize, Lib3MF_uint64* pIndicesNeededCount, Lib3MF::sTriangle * pIndicesBuffer) = 0;
 
+	/**
+	* IMeshObject::GetTrianglePageCount - Returns the number of pages in which the triangles of the mesh object are stored.
+	* @return the number of triangle pages.
+	*/
+	virtual Lib3MF_uint32 GetTrianglePageCount() = 0;
+
+	/**
+	* IMeshObject::GetTrianglePage - Returns direct read access to a page of triangles without copying them. The memory is owned by the mesh object, must not be written to and is only valid until the mesh is modified or released.
+	* @param[in] nPageIndex - index of the page (0 to pagecount - 1).
+	* @param[out] nTriangleCount - number of triangles stored in the page.
+	* @param[out] nStride - distance in bytes between two consecutive triangles.
+	* @return pointer to the three 32 bit vertex indices of the first triangle in the page.
+	*/
+	virtual Lib3MF_pvoid GetTrianglePage(const Lib3MF_uint32 nPageIndex, Lib3MF_uint32 & nTriangleCount, Lib3MF_uint32 & nStride) = 0;
+
 	/**
 	* IMeshObject::SetObjectLevelProperty - Sets the property at the object-level of the mesh object.
 	* @param[in] nUniqueResourceID - the object-level Property UniqueResourceID.
@@ -1606,12 +1768,26 @@ public:
 	*/
 	virtual void SetGeometry(const Lib3MF_uint64 nVerticesBufferSize, const Lib3MF::sPosition * pVerticesBuffer, const Lib3MF_uint64 nIndicesBufferSize, const Lib3MF::sTriangle * pIndicesBuffer) = 0;
 
+	/**
+	* IMeshObject::ReserveGeometry - Preallocates memory for the given total numbers of vertices, triangles and beams, so that they can be added without further allocations.
+	* @param[in] nVertexCount - number of vertices to reserve memory for.
+	* @param[in] nTriangleCount - number of triangles to reserve memory for.
+	* @param[in] nBeamCount - number of beams to reserve memory for.
+	*/
+	virtual void ReserveGeometry(const Lib3MF_uint32 nVertexCount, const Lib3MF_uint32 nTriangleCount, const Lib3MF_uint32 nBeamCount) = 0;
+
 	/**
 	* IMeshObject::IsManifoldAndOriented - Retrieves, if an object describes a topologically oriented and manifold mesh, according to the core spec.
 	* @return returns, if the object is oriented and manifold.
 	*/
 	virtual bool IsManifoldAndOriented() = 0;
 
+	/**
+	* IMeshObject::IsGeometryLoaded - Retrieves, if the geometry of an object has been loaded. Meshes read with lazy mesh loading are only loaded when their geometry is accessed for the first time.
+	* @return returns, if the geometry of the object has been loaded.
+	*/
+	virtual bool IsGeometryLoaded() = 0;
+
 	/**
 	* IMeshObject::BeamLattice - Retrieves the BeamLattice within this MeshObject.
 	* @return the BeamLattice within this MeshObject
@@ -5426,11 +5602,96 @@ public:
 	*/
 	virtual void SortNodesTopologically() = 0;
 
+	/**
+	* IImplicitFunction::CreateEvaluator - Compiles the function into an evaluator. Later changes of the function do not affect the evaluator.
+	* @return the evaluator
+	*/
+	virtual IImplicitEvaluator * CreateEvaluator() = 0;
+
 };
 
 typedef IBaseSharedPtr<IImplicitFunction> PIImplicitFunction;
 
 
+/*************************************************************************************************************************
+ Class interface for ImplicitEvaluator 
+**************************************************************************************************************************/
+
+class IImplicitEvaluator : public virtual IBase {
+public:
+	/**
+	* IImplicitEvaluator::ClassTypeId - Get Class Type Id
+	* @return Class type as a 64 bits integer
+	*/
+	Lib3MF_uint64 ClassTypeId() override
+	{
+		return 0x624A6556CD0D2735UL; // First 64 bits of SHA1 of a string: "Lib3MF::ImplicitEvaluator"
+	}
+
+	/**
+	* IImplicitEvaluator::GetInputStride - Returns the number of input values per point. Vector inputs take 3 values, matrix inputs 16.
+	* @return number of input values per point
+	*/
+	virtual Lib3MF_uint32 GetInputStride() = 0;
+
+	/**
+	* IImplicitEvaluator::GetOutputStride - Returns the number of output values per point. Vector outputs take 3 values, matrix outputs 16.
+	* @return number of output values per point
+	*/
+	virtual Lib3MF_uint32 GetOutputStride() = 0;
+
+	/**
+	* IImplicitEvaluator::SetWorkerThreadCount - Sets the number of threads used by Evaluate. 0 selects the number of hardware threads, 1 (default) evaluates on the calling thread.
+	* @param[in] nThreadCount - number of threads
+	*/
+	virtual void SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount) = 0;
+
+	/**
+	* IImplicitEvaluator::GetWorkerThreadCount - Returns the number of threads used by Evaluate.
+	* @return number of threads
+	*/
+	virtual Lib3MF_uint32 GetWorkerThreadCount() = 0;
+
+	/**
+	* IImplicitEvaluator::Evaluate - Evaluates the function for a batch of points. The input values of all function inputs of a point are stored consecutively, followed by the next point.
+	* @param[in] nInputsBufferSize - Number of elements in buffer
+	* @param[in] pInputsBuffer - input values of all points
+	* @param[in] nOutputsBufferSize - Number of elements in buffer
+	* @param[out] pOutputsNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pOutputsBuffer - output values of all points
+	*/
+	virtual void Evaluate(const Lib3MF_uint64 nInputsBufferSize, const Lib3MF_double * pInputsBuffer, Lib3MF_uint64 nOutputsBufferSize, Lib3MF_uint64* pOutputsNeededCount, Lib3MF_double * pOutputsBuffer) = 0;
+
+	/**
+	* IImplicitEvaluator::EvaluateBatch - Evaluates the function for a batch of points in structure-of-arrays layout. The values of the first input component of all points are stored consecutively, followed by the values of the next component. The outputs are returned in the same layout.
+	* @param[in] nInputsBufferSize - Number of elements in buffer
+	* @param[in] pInputsBuffer - input values of all points, one array per component
+	* @param[in] nOutputsBufferSize - Number of elements in buffer
+	* @param[out] pOutputsNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pOutputsBuffer - output values of all points, one array per component
+	*/
+	virtual void EvaluateBatch(const Lib3MF_uint64 nInputsBufferSize, const Lib3MF_double * pInputsBuffer, Lib3MF_uint64 nOutputsBufferSize, Lib3MF_uint64* pOutputsNeededCount, Lib3MF_double * pOutputsBuffer) = 0;
+
+	/**
+	* IImplicitEvaluator::EvaluateBounds - Computes bounds of the function outputs for boxes of input values. Every box is given by the minimal and maximal value of each input component, stored like the points of Evaluate. The bounds contain all output values within the box, but are not necessarily tight. Unbounded outputs are reported as infinite.
+	* @param[in] nInputMinimaBufferSize - Number of elements in buffer
+	* @param[in] pInputMinimaBuffer - minimal input values of all boxes
+	* @param[in] nInputMaximaBufferSize - Number of elements in buffer
+	* @param[in] pInputMaximaBuffer - maximal input values of all boxes
+	* @param[in] nOutputMinimaBufferSize - Number of elements in buffer
+	* @param[out] pOutputMinimaNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pOutputMinimaBuffer - lower bounds of the outputs of all boxes
+	* @param[in] nOutputMaximaBufferSize - Number of elements in buffer
+	* @param[out] pOutputMaximaNeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pOutputMaximaBuffer - upper bounds of the outputs of all boxes
+	*/
+	virtual void EvaluateBounds(const Lib3MF_uint64 nInputMinimaBufferSize, const Lib3MF_double * pInputMinimaBuffer, const Lib3MF_uint64 nInputMaximaBufferSize, const Lib3MF_double * pInputMaximaBuffer, Lib3MF_uint64 nOutputMinimaBufferSize, Lib3MF_uint64* pOutputMinimaNeededCount, Lib3MF_double * pOutputMinimaBuffer, Lib3MF_uint64 nOutputMaximaBufferSize, Lib3MF_uint64* pOutputMaximaNeededCount, Lib3MF_double * pOutputMaximaBuffer) = 0;
+
+};
+
+typedef IBaseSharedPtr<IImplicitEvaluator> PIImplicitEvaluator;
+
+
 /*************************************************************************************************************************
  Class interface for FunctionFromImage3D 
 **************************************************************************************************************************/
@@ -5510,11 +5771,71 @@ public:
 	*/
 	virtual void SetScale(const Lib3MF_double dScale) = 0;
 
+	/**
+	* IFunctionFromImage3D::CreateSampler - Creates a sampler, which decodes the sheets of the 3D image on demand. Later changes of the function do not affect the sampler.
+	* @return the sampler
+	*/
+	virtual IImage3DSampler * CreateSampler() = 0;
+
 };
 
 typedef IBaseSharedPtr<IFunctionFromImage3D> PIFunctionFromImage3D;
 
 
+/*************************************************************************************************************************
+ Class interface for Image3DSampler 
+**************************************************************************************************************************/
+
+class IImage3DSampler : public virtual IBase {
+public:
+	/**
+	* IImage3DSampler::ClassTypeId - Get Class Type Id
+	* @return Class type as a 64 bits integer
+	*/
+	Lib3MF_uint64 ClassTypeId() override
+	{
+		return 0xABDCDB2C6189432AUL; // First 64 bits of SHA1 of a string: "Lib3MF::Image3DSampler"
+	}
+
+	/**
+	* IImage3DSampler::SetCacheSize - Sets the maximal memory size of the decoded sheets, which are kept for later samples. The most recently used sheet is always kept.
+	* @param[in] nCacheSize - cache size in bytes
+	*/
+	virtual void SetCacheSize(const Lib3MF_uint64 nCacheSize) = 0;
+
+	/**
+	* IImage3DSampler::GetCacheSize - Returns the maximal memory size of the decoded sheets.
+	* @return cache size in bytes
+	*/
+	virtual Lib3MF_uint64 GetCacheSize() = 0;
+
+	/**
+	* IImage3DSampler::SetWorkerThreadCount - Sets the number of threads used by Sample. 0 selects the number of hardware threads, 1 (default) samples on the calling thread.
+	* @param[in] nThreadCount - number of threads
+	*/
+	virtual void SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount) = 0;
+
+	/**
+	* IImage3DSampler::GetWorkerThreadCount - Returns the number of threads used by Sample.
+	* @return number of threads
+	*/
+	virtual Lib3MF_uint32 GetWorkerThreadCount() = 0;
+
+	/**
+	* IImage3DSampler::Sample - Samples the function from image3D at a batch of points. Every point takes the 3 values u, v and w, every result the 4 values red, green, blue and alpha, including offset and scale.
+	* @param[in] nUVWBufferSize - Number of elements in buffer
+	* @param[in] pUVWBuffer - u, v and w of all points
+	* @param[in] nRGBABufferSize - Number of elements in buffer
+	* @param[out] pRGBANeededCount - will be filled with the count of the written structs, or needed buffer size.
+	* @param[out] pRGBABuffer - red, green, blue and alpha of all points
+	*/
+	virtual void Sample(const Lib3MF_uint64 nUVWBufferSize, const Lib3MF_double * pUVWBuffer, Lib3MF_uint64 nRGBABufferSize, Lib3MF_uint64* pRGBANeededCount, Lib3MF_double * pRGBABuffer) = 0;
+
+};
+
+typedef IBaseSharedPtr<IImage3DSampler> PIImage3DSampler;
+
+
 /*************************************************************************************************************************
  Class interface for BuildItem 
 **************************************************************************************************************************/
@@ -6738,6 +7059,14 @@ public:
 	*/
 	static IModel * CreateModel();
 
+	/**
+	* Ilib3mf::CreateStreamingWriter - creates a writer, which streams mesh objects into a new 3MF file while they are generated.
+	* @param[in] sFilename - Filename to write into
+	* @param[in] eUnit - Unit of the model
+	* @return returns the streaming writer instance
+	*/
+	static IStreamingWriter * CreateStreamingWriter(const std::string & sFilename, const Lib3MF::eModelUnit eUnit);
+
 	/**
 	* Ilib3mf::Release - releases shared ownership of an object instance
 	* @param[in] pInstance - the object instance to release
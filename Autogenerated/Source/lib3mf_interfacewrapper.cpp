@@ -358,6 +358,206 @@ Lib3MFResult lib3mf_writer_setdecimalprecision(Lib3MF_Writer pWriter, Lib3MF_uin
 	}
 }
 
+Lib3MFResult lib3mf_writer_setshortestroundtripactive(Lib3MF_Writer pWriter, bool bShortestRoundtripActive)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "SetShortestRoundtripActive");
+			pJournalEntry->addBooleanParameter("ShortestRoundtripActive", bShortestRoundtripActive);
+		}
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIWriter->SetShortestRoundtripActive(bShortestRoundtripActive);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_getshortestroundtripactive(Lib3MF_Writer pWriter, bool * pShortestRoundtripActive)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "GetShortestRoundtripActive");
+		}
+		if (pShortestRoundtripActive == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pShortestRoundtripActive = pIWriter->GetShortestRoundtripActive();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addBooleanResult("ShortestRoundtripActive", *pShortestRoundtripActive);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_setworkerthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 nThreadCount)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "SetWorkerThreadCount");
+			pJournalEntry->addUInt32Parameter("ThreadCount", nThreadCount);
+		}
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIWriter->SetWorkerThreadCount(nThreadCount);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_getworkerthreadcount(Lib3MF_Writer pWriter, Lib3MF_uint32 * pThreadCount)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "GetWorkerThreadCount");
+		}
+		if (pThreadCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pThreadCount = pIWriter->GetWorkerThreadCount();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("ThreadCount", *pThreadCount);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_setcompressionlevel(Lib3MF_Writer pWriter, eLib3MFPackagePartType ePartType, eLib3MFCompressionLevel eLevel)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "SetCompressionLevel");
+			pJournalEntry->addEnumParameter("PartType", "PackagePartType", (Lib3MF_int32)(ePartType));
+			pJournalEntry->addEnumParameter("Level", "CompressionLevel", (Lib3MF_int32)(eLevel));
+		}
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIWriter->SetCompressionLevel(ePartType, eLevel);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_writer_getcompressionlevel(Lib3MF_Writer pWriter, eLib3MFPackagePartType ePartType, eLib3MFCompressionLevel * pLevel)
+{
+	IBase* pIBaseClass = (IBase *)pWriter;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pWriter, "Writer", "GetCompressionLevel");
+			pJournalEntry->addEnumParameter("PartType", "PackagePartType", (Lib3MF_int32)(ePartType));
+		}
+		if (pLevel == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IWriter* pIWriter = dynamic_cast<IWriter*>(pIBaseClass);
+		if (!pIWriter)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pLevel = pIWriter->GetCompressionLevel(ePartType);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addEnumResult("Level", "CompressionLevel", (Lib3MF_int32)(*pLevel));
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
 Lib3MFResult lib3mf_writer_setstrictmodeactive(Lib3MF_Writer pWriter, bool bStrictModeActive)
 {
 	IBase* pIBaseClass = (IBase *)pWriter;
@@ -859,51 +1059,23 @@ Lib3MFResult lib3mf_reader_getstrictmodeactive(Lib3MF_Reader pReader, bool * pSt
 	}
 }
 
-Lib3MFResult lib3mf_reader_getwarning(Lib3MF_Reader pReader, Lib3MF_uint32 nIndex, Lib3MF_uint32 * pErrorCode, const Lib3MF_uint32 nWarningBufferSize, Lib3MF_uint32* pWarningNeededChars, char * pWarningBuffer)
+Lib3MFResult lib3mf_reader_setworkerthreadcount(Lib3MF_Reader pReader, Lib3MF_uint32 nThreadCount)
 {
 	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "GetWarning");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetWorkerThreadCount");
+			pJournalEntry->addUInt32Parameter("ThreadCount", nThreadCount);
 		}
-		if (!pErrorCode)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if ( (!pWarningBuffer) && !(pWarningNeededChars) )
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sWarning("");
 		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
 		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pWarningBuffer == nullptr);
-		if (isCacheCall) {
-			sWarning = pIReader->GetWarning(nIndex, *pErrorCode);
+		pIReader->SetWorkerThreadCount(nThreadCount);
 
-			pIReader->_setCache (new ParameterCache_2<Lib3MF_uint32, std::string> (*pErrorCode, sWarning));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_2<Lib3MF_uint32, std::string>*> (pIReader->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (*pErrorCode, sWarning);
-			pIReader->_setCache (nullptr);
-		}
-		
-		if (pWarningNeededChars)
-			*pWarningNeededChars = (Lib3MF_uint32) (sWarning.size()+1);
-		if (pWarningBuffer) {
-			if (sWarning.size() >= nWarningBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iWarning = 0; iWarning < sWarning.size(); iWarning++)
-				pWarningBuffer[iWarning] = sWarning[iWarning];
-			pWarningBuffer[sWarning.size()] = 0;
-		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("ErrorCode", *pErrorCode);
-			pJournalEntry->addStringResult("Warning", sWarning.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -919,25 +1091,25 @@ Lib3MFResult lib3mf_reader_getwarning(Lib3MF_Reader pReader, Lib3MF_uint32 nInde
 	}
 }
 
-Lib3MFResult lib3mf_reader_getwarningcount(Lib3MF_Reader pReader, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_reader_getworkerthreadcount(Lib3MF_Reader pReader, Lib3MF_uint32 * pThreadCount)
 {
 	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "GetWarningCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "GetWorkerThreadCount");
 		}
-		if (pCount == nullptr)
+		if (pThreadCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
 		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pIReader->GetWarningCount();
+		*pThreadCount = pIReader->GetWorkerThreadCount();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Count", *pCount);
+			pJournalEntry->addUInt32Result("ThreadCount", *pThreadCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -953,25 +1125,22 @@ Lib3MFResult lib3mf_reader_getwarningcount(Lib3MF_Reader pReader, Lib3MF_uint32
 	}
 }
 
-Lib3MFResult lib3mf_reader_addkeywrappingcallback(Lib3MF_Reader pReader, const char * pConsumerID, Lib3MFKeyWrappingCallback pTheCallback, Lib3MF_pvoid pUserData)
+Lib3MFResult lib3mf_reader_setmeshstreamcallbacks(Lib3MF_Reader pReader, Lib3MFVertexBlockCallback pTheVertexBlockCallback, Lib3MFTriangleBlockCallback pTheTriangleBlockCallback, bool bRetainGeometry, Lib3MF_pvoid pUserData)
 {
 	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "AddKeyWrappingCallback");
-			pJournalEntry->addStringParameter("ConsumerID", pConsumerID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetMeshStreamCallbacks");
+			pJournalEntry->addBooleanParameter("RetainGeometry", bRetainGeometry);
 			pJournalEntry->addPointerParameter("UserData", pUserData);
 		}
-		if (pConsumerID == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sConsumerID(pConsumerID);
 		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
 		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIReader->AddKeyWrappingCallback(sConsumerID, pTheCallback, pUserData);
+		pIReader->SetMeshStreamCallbacks(pTheVertexBlockCallback, pTheTriangleBlockCallback, bRetainGeometry, pUserData);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -989,21 +1158,21 @@ Lib3MFResult lib3mf_reader_addkeywrappingcallback(Lib3MF_Reader pReader, const c
 	}
 }
 
-Lib3MFResult lib3mf_reader_setcontentencryptioncallback(Lib3MF_Reader pReader, Lib3MFContentEncryptionCallback pTheCallback, Lib3MF_pvoid pUserData)
+Lib3MFResult lib3mf_reader_setlazymeshloadingactive(Lib3MF_Reader pReader, bool bLazyMeshLoadingActive)
 {
 	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetContentEncryptionCallback");
-			pJournalEntry->addPointerParameter("UserData", pUserData);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetLazyMeshLoadingActive");
+			pJournalEntry->addBooleanParameter("LazyMeshLoadingActive", bLazyMeshLoadingActive);
 		}
 		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
 		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIReader->SetContentEncryptionCallback(pTheCallback, pUserData);
+		pIReader->SetLazyMeshLoadingActive(bLazyMeshLoadingActive);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -1021,51 +1190,25 @@ Lib3MFResult lib3mf_reader_setcontentencryptioncallback(Lib3MF_Reader pReader, L
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for PackagePart
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_packagepart_getpath(Lib3MF_PackagePart pPackagePart, const Lib3MF_uint32 nPathBufferSize, Lib3MF_uint32* pPathNeededChars, char * pPathBuffer)
+Lib3MFResult lib3mf_reader_getlazymeshloadingactive(Lib3MF_Reader pReader, bool * pLazyMeshLoadingActive)
 {
-	IBase* pIBaseClass = (IBase *)pPackagePart;
+	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pPackagePart, "PackagePart", "GetPath");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "GetLazyMeshLoadingActive");
 		}
-		if ( (!pPathBuffer) && !(pPathNeededChars) )
+		if (pLazyMeshLoadingActive == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sPath("");
-		IPackagePart* pIPackagePart = dynamic_cast<IPackagePart*>(pIBaseClass);
-		if (!pIPackagePart)
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pPathBuffer == nullptr);
-		if (isCacheCall) {
-			sPath = pIPackagePart->GetPath();
+		*pLazyMeshLoadingActive = pIReader->GetLazyMeshLoadingActive();
 
-			pIPackagePart->_setCache (new ParameterCache_1<std::string> (sPath));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIPackagePart->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sPath);
-			pIPackagePart->_setCache (nullptr);
-		}
-		
-		if (pPathNeededChars)
-			*pPathNeededChars = (Lib3MF_uint32) (sPath.size()+1);
-		if (pPathBuffer) {
-			if (sPath.size() >= nPathBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iPath = 0; iPath < sPath.size(); iPath++)
-				pPathBuffer[iPath] = sPath[iPath];
-			pPathBuffer[sPath.size()] = 0;
-		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Path", sPath.c_str());
+			pJournalEntry->addBooleanResult("LazyMeshLoadingActive", *pLazyMeshLoadingActive);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1081,26 +1224,51 @@ Lib3MFResult lib3mf_packagepart_getpath(Lib3MF_PackagePart pPackagePart, const L
 	}
 }
 
-Lib3MFResult lib3mf_packagepart_setpath(Lib3MF_PackagePart pPackagePart, const char * pPath)
+Lib3MFResult lib3mf_reader_getwarning(Lib3MF_Reader pReader, Lib3MF_uint32 nIndex, Lib3MF_uint32 * pErrorCode, const Lib3MF_uint32 nWarningBufferSize, Lib3MF_uint32* pWarningNeededChars, char * pWarningBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pPackagePart;
+	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pPackagePart, "PackagePart", "SetPath");
-			pJournalEntry->addStringParameter("Path", pPath);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "GetWarning");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		if (pPath == nullptr)
+		if (!pErrorCode)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sPath(pPath);
-		IPackagePart* pIPackagePart = dynamic_cast<IPackagePart*>(pIBaseClass);
-		if (!pIPackagePart)
+		if ( (!pWarningBuffer) && !(pWarningNeededChars) )
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sWarning("");
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIPackagePart->SetPath(sPath);
+		bool isCacheCall = (pWarningBuffer == nullptr);
+		if (isCacheCall) {
+			sWarning = pIReader->GetWarning(nIndex, *pErrorCode);
 
+			pIReader->_setCache (new ParameterCache_2<Lib3MF_uint32, std::string> (*pErrorCode, sWarning));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_2<Lib3MF_uint32, std::string>*> (pIReader->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (*pErrorCode, sWarning);
+			pIReader->_setCache (nullptr);
+		}
+		
+		if (pWarningNeededChars)
+			*pWarningNeededChars = (Lib3MF_uint32) (sWarning.size()+1);
+		if (pWarningBuffer) {
+			if (sWarning.size() >= nWarningBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iWarning = 0; iWarning < sWarning.size(); iWarning++)
+				pWarningBuffer[iWarning] = sWarning[iWarning];
+			pWarningBuffer[sWarning.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("ErrorCode", *pErrorCode);
+			pJournalEntry->addStringResult("Warning", sWarning.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1116,29 +1284,25 @@ Lib3MFResult lib3mf_packagepart_setpath(Lib3MF_PackagePart pPackagePart, const c
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for Resource
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_resource_getresourceid(Lib3MF_Resource pResource, Lib3MF_uint32 * pUniqueResourceID)
+Lib3MFResult lib3mf_reader_getwarningcount(Lib3MF_Reader pReader, Lib3MF_uint32 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pResource;
+	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pResource, "Resource", "GetResourceID");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "GetWarningCount");
 		}
-		if (pUniqueResourceID == nullptr)
+		if (pCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IResource* pIResource = dynamic_cast<IResource*>(pIBaseClass);
-		if (!pIResource)
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pUniqueResourceID = pIResource->GetResourceID();
+		*pCount = pIReader->GetWarningCount();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("UniqueResourceID", *pUniqueResourceID);
+			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1154,25 +1318,27 @@ Lib3MFResult lib3mf_resource_getresourceid(Lib3MF_Resource pResource, Lib3MF_uin
 	}
 }
 
-Lib3MFResult lib3mf_resource_getuniqueresourceid(Lib3MF_Resource pResource, Lib3MF_uint32 * pUniqueResourceID)
+Lib3MFResult lib3mf_reader_addkeywrappingcallback(Lib3MF_Reader pReader, const char * pConsumerID, Lib3MFKeyWrappingCallback pTheCallback, Lib3MF_pvoid pUserData)
 {
-	IBase* pIBaseClass = (IBase *)pResource;
+	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pResource, "Resource", "GetUniqueResourceID");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "AddKeyWrappingCallback");
+			pJournalEntry->addStringParameter("ConsumerID", pConsumerID);
+			pJournalEntry->addPointerParameter("UserData", pUserData);
 		}
-		if (pUniqueResourceID == nullptr)
+		if (pConsumerID == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IResource* pIResource = dynamic_cast<IResource*>(pIBaseClass);
-		if (!pIResource)
+		std::string sConsumerID(pConsumerID);
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pUniqueResourceID = pIResource->GetUniqueResourceID();
+		pIReader->AddKeyWrappingCallback(sConsumerID, pTheCallback, pUserData);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("UniqueResourceID", *pUniqueResourceID);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1188,27 +1354,23 @@ Lib3MFResult lib3mf_resource_getuniqueresourceid(Lib3MF_Resource pResource, Lib3
 	}
 }
 
-Lib3MFResult lib3mf_resource_packagepart(Lib3MF_Resource pResource, Lib3MF_PackagePart * pPackagePart)
+Lib3MFResult lib3mf_reader_setcontentencryptioncallback(Lib3MF_Reader pReader, Lib3MFContentEncryptionCallback pTheCallback, Lib3MF_pvoid pUserData)
 {
-	IBase* pIBaseClass = (IBase *)pResource;
+	IBase* pIBaseClass = (IBase *)pReader;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pResource, "Resource", "PackagePart");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pReader, "Reader", "SetContentEncryptionCallback");
+			pJournalEntry->addPointerParameter("UserData", pUserData);
 		}
-		if (pPackagePart == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBasePackagePart(nullptr);
-		IResource* pIResource = dynamic_cast<IResource*>(pIBaseClass);
-		if (!pIResource)
+		IReader* pIReader = dynamic_cast<IReader*>(pIBaseClass);
+		if (!pIReader)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBasePackagePart = pIResource->PackagePart();
+		pIReader->SetContentEncryptionCallback(pTheCallback, pUserData);
 
-		*pPackagePart = (IBase*)(pBasePackagePart);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("PackagePart", *pPackagePart);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1224,28 +1386,33 @@ Lib3MFResult lib3mf_resource_packagepart(Lib3MF_Resource pResource, Lib3MF_Packa
 	}
 }
 
-Lib3MFResult lib3mf_resource_setpackagepart(Lib3MF_Resource pResource, Lib3MF_PackagePart pPackagePart)
+
+/*************************************************************************************************************************
+ Class implementation for StreamingWriter
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_streamingwriter_beginmeshobject(Lib3MF_StreamingWriter pStreamingWriter, const char * pName, Lib3MF_uint32 * pObjectID)
 {
-	IBase* pIBaseClass = (IBase *)pResource;
+	IBase* pIBaseClass = (IBase *)pStreamingWriter;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pResource, "Resource", "SetPackagePart");
-			pJournalEntry->addHandleParameter("PackagePart", pPackagePart);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pStreamingWriter, "StreamingWriter", "BeginMeshObject");
+			pJournalEntry->addStringParameter("Name", pName);
 		}
-		IBase* pIBaseClassPackagePart = (IBase *)pPackagePart;
-		IPackagePart* pIPackagePart = dynamic_cast<IPackagePart*>(pIBaseClassPackagePart);
-		if (!pIPackagePart)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
-		IResource* pIResource = dynamic_cast<IResource*>(pIBaseClass);
-		if (!pIResource)
+		if (pName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sName(pName);
+		if (pObjectID == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IStreamingWriter* pIStreamingWriter = dynamic_cast<IStreamingWriter*>(pIBaseClass);
+		if (!pIStreamingWriter)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIResource->SetPackagePart(pIPackagePart);
+		*pObjectID = pIStreamingWriter->BeginMeshObject(sName);
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("ObjectID", *pObjectID);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1261,25 +1428,24 @@ Lib3MFResult lib3mf_resource_setpackagepart(Lib3MF_Resource pResource, Lib3MF_Pa
 	}
 }
 
-Lib3MFResult lib3mf_resource_getmodelresourceid(Lib3MF_Resource pResource, Lib3MF_uint32 * pModelResourceId)
+Lib3MFResult lib3mf_streamingwriter_addvertices(Lib3MF_StreamingWriter pStreamingWriter, Lib3MF_uint64 nVerticesBufferSize, const sLib3MFPosition * pVerticesBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pResource;
+	IBase* pIBaseClass = (IBase *)pStreamingWriter;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pResource, "Resource", "GetModelResourceID");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pStreamingWriter, "StreamingWriter", "AddVertices");
 		}
-		if (pModelResourceId == nullptr)
+		if ( (!pVerticesBuffer) && (nVerticesBufferSize>0))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IResource* pIResource = dynamic_cast<IResource*>(pIBaseClass);
-		if (!pIResource)
+		IStreamingWriter* pIStreamingWriter = dynamic_cast<IStreamingWriter*>(pIBaseClass);
+		if (!pIStreamingWriter)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pModelResourceId = pIResource->GetModelResourceID();
+		pIStreamingWriter->AddVertices(nVerticesBufferSize, pVerticesBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("ModelResourceId", *pModelResourceId);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1295,29 +1461,24 @@ Lib3MFResult lib3mf_resource_getmodelresourceid(Lib3MF_Resource pResource, Lib3M
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for ResourceIterator
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_resourceiterator_movenext(Lib3MF_ResourceIterator pResourceIterator, bool * pHasNext)
+Lib3MFResult lib3mf_streamingwriter_addtriangles(Lib3MF_StreamingWriter pStreamingWriter, Lib3MF_uint64 nIndicesBufferSize, const sLib3MFTriangle * pIndicesBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pResourceIterator;
+	IBase* pIBaseClass = (IBase *)pStreamingWriter;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pResourceIterator, "ResourceIterator", "MoveNext");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pStreamingWriter, "StreamingWriter", "AddTriangles");
 		}
-		if (pHasNext == nullptr)
+		if ( (!pIndicesBuffer) && (nIndicesBufferSize>0))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IResourceIterator* pIResourceIterator = dynamic_cast<IResourceIterator*>(pIBaseClass);
-		if (!pIResourceIterator)
+		IStreamingWriter* pIStreamingWriter = dynamic_cast<IStreamingWriter*>(pIBaseClass);
+		if (!pIStreamingWriter)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pHasNext = pIResourceIterator->MoveNext();
+		pIStreamingWriter->AddTriangles(nIndicesBufferSize, pIndicesBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("HasNext", *pHasNext);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1333,25 +1494,22 @@ Lib3MFResult lib3mf_resourceiterator_movenext(Lib3MF_ResourceIterator pResourceI
 	}
 }
 
-Lib3MFResult lib3mf_resourceiterator_moveprevious(Lib3MF_ResourceIterator pResourceIterator, bool * pHasPrevious)
+Lib3MFResult lib3mf_streamingwriter_endmeshobject(Lib3MF_StreamingWriter pStreamingWriter)
 {
-	IBase* pIBaseClass = (IBase *)pResourceIterator;
+	IBase* pIBaseClass = (IBase *)pStreamingWriter;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pResourceIterator, "ResourceIterator", "MovePrevious");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pStreamingWriter, "StreamingWriter", "EndMeshObject");
 		}
-		if (pHasPrevious == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IResourceIterator* pIResourceIterator = dynamic_cast<IResourceIterator*>(pIBaseClass);
-		if (!pIResourceIterator)
+		IStreamingWriter* pIStreamingWriter = dynamic_cast<IStreamingWriter*>(pIBaseClass);
+		if (!pIStreamingWriter)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pHasPrevious = pIResourceIterator->MovePrevious();
+		pIStreamingWriter->EndMeshObject();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("HasPrevious", *pHasPrevious);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1367,27 +1525,23 @@ Lib3MFResult lib3mf_resourceiterator_moveprevious(Lib3MF_ResourceIterator pResou
 	}
 }
 
-Lib3MFResult lib3mf_resourceiterator_getcurrent(Lib3MF_ResourceIterator pResourceIterator, Lib3MF_Resource * pResource)
+Lib3MFResult lib3mf_streamingwriter_addbuilditem(Lib3MF_StreamingWriter pStreamingWriter, Lib3MF_uint32 nObjectID, const sLib3MFTransform * pTransform)
 {
-	IBase* pIBaseClass = (IBase *)pResourceIterator;
+	IBase* pIBaseClass = (IBase *)pStreamingWriter;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pResourceIterator, "ResourceIterator", "GetCurrent");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pStreamingWriter, "StreamingWriter", "AddBuildItem");
+			pJournalEntry->addUInt32Parameter("ObjectID", nObjectID);
 		}
-		if (pResource == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseResource(nullptr);
-		IResourceIterator* pIResourceIterator = dynamic_cast<IResourceIterator*>(pIBaseClass);
-		if (!pIResourceIterator)
+		IStreamingWriter* pIStreamingWriter = dynamic_cast<IStreamingWriter*>(pIBaseClass);
+		if (!pIStreamingWriter)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResource = pIResourceIterator->GetCurrent();
+		pIStreamingWriter->AddBuildItem(nObjectID, *pTransform);
 
-		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Resource", *pResource);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1403,27 +1557,22 @@ Lib3MFResult lib3mf_resourceiterator_getcurrent(Lib3MF_ResourceIterator pResourc
 	}
 }
 
-Lib3MFResult lib3mf_resourceiterator_clone(Lib3MF_ResourceIterator pResourceIterator, Lib3MF_ResourceIterator * pOutResourceIterator)
+Lib3MFResult lib3mf_streamingwriter_finish(Lib3MF_StreamingWriter pStreamingWriter)
 {
-	IBase* pIBaseClass = (IBase *)pResourceIterator;
+	IBase* pIBaseClass = (IBase *)pStreamingWriter;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pResourceIterator, "ResourceIterator", "Clone");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pStreamingWriter, "StreamingWriter", "Finish");
 		}
-		if (pOutResourceIterator == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseOutResourceIterator(nullptr);
-		IResourceIterator* pIResourceIterator = dynamic_cast<IResourceIterator*>(pIBaseClass);
-		if (!pIResourceIterator)
+		IStreamingWriter* pIStreamingWriter = dynamic_cast<IStreamingWriter*>(pIBaseClass);
+		if (!pIStreamingWriter)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseOutResourceIterator = pIResourceIterator->Clone();
+		pIStreamingWriter->Finish();
 
-		*pOutResourceIterator = (IBase*)(pBaseOutResourceIterator);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("OutResourceIterator", *pOutResourceIterator);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1439,25 +1588,51 @@ Lib3MFResult lib3mf_resourceiterator_clone(Lib3MF_ResourceIterator pResourceIter
 	}
 }
 
-Lib3MFResult lib3mf_resourceiterator_count(Lib3MF_ResourceIterator pResourceIterator, Lib3MF_uint64 * pCount)
+
+/*************************************************************************************************************************
+ Class implementation for PackagePart
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_packagepart_getpath(Lib3MF_PackagePart pPackagePart, const Lib3MF_uint32 nPathBufferSize, Lib3MF_uint32* pPathNeededChars, char * pPathBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pResourceIterator;
+	IBase* pIBaseClass = (IBase *)pPackagePart;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pResourceIterator, "ResourceIterator", "Count");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pPackagePart, "PackagePart", "GetPath");
 		}
-		if (pCount == nullptr)
+		if ( (!pPathBuffer) && !(pPathNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IResourceIterator* pIResourceIterator = dynamic_cast<IResourceIterator*>(pIBaseClass);
-		if (!pIResourceIterator)
+		std::string sPath("");
+		IPackagePart* pIPackagePart = dynamic_cast<IPackagePart*>(pIBaseClass);
+		if (!pIPackagePart)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pIResourceIterator->Count();
+		bool isCacheCall = (pPathBuffer == nullptr);
+		if (isCacheCall) {
+			sPath = pIPackagePart->GetPath();
 
+			pIPackagePart->_setCache (new ParameterCache_1<std::string> (sPath));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIPackagePart->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sPath);
+			pIPackagePart->_setCache (nullptr);
+		}
+		
+		if (pPathNeededChars)
+			*pPathNeededChars = (Lib3MF_uint32) (sPath.size()+1);
+		if (pPathBuffer) {
+			if (sPath.size() >= nPathBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iPath = 0; iPath < sPath.size(); iPath++)
+				pPathBuffer[iPath] = sPath[iPath];
+			pPathBuffer[sPath.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt64Result("Count", *pCount);
+			pJournalEntry->addStringResult("Path", sPath.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1473,31 +1648,26 @@ Lib3MFResult lib3mf_resourceiterator_count(Lib3MF_ResourceIterator pResourceIter
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for SliceStackIterator
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_slicestackiterator_getcurrentslicestack(Lib3MF_SliceStackIterator pSliceStackIterator, Lib3MF_SliceStack * pResource)
+Lib3MFResult lib3mf_packagepart_setpath(Lib3MF_PackagePart pPackagePart, const char * pPath)
 {
-	IBase* pIBaseClass = (IBase *)pSliceStackIterator;
+	IBase* pIBaseClass = (IBase *)pPackagePart;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pSliceStackIterator, "SliceStackIterator", "GetCurrentSliceStack");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pPackagePart, "PackagePart", "SetPath");
+			pJournalEntry->addStringParameter("Path", pPath);
 		}
-		if (pResource == nullptr)
+		if (pPath == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseResource(nullptr);
-		ISliceStackIterator* pISliceStackIterator = dynamic_cast<ISliceStackIterator*>(pIBaseClass);
-		if (!pISliceStackIterator)
+		std::string sPath(pPath);
+		IPackagePart* pIPackagePart = dynamic_cast<IPackagePart*>(pIBaseClass);
+		if (!pIPackagePart)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResource = pISliceStackIterator->GetCurrentSliceStack();
+		pIPackagePart->SetPath(sPath);
 
-		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Resource", *pResource);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1515,29 +1685,27 @@ Lib3MFResult lib3mf_slicestackiterator_getcurrentslicestack(Lib3MF_SliceStackIte
 
 
 /*************************************************************************************************************************
- Class implementation for ObjectIterator
+ Class implementation for Resource
 **************************************************************************************************************************/
-Lib3MFResult lib3mf_objectiterator_getcurrentobject(Lib3MF_ObjectIterator pObjectIterator, Lib3MF_Object * pResource)
+Lib3MFResult lib3mf_resource_getresourceid(Lib3MF_Resource pResource, Lib3MF_uint32 * pUniqueResourceID)
 {
-	IBase* pIBaseClass = (IBase *)pObjectIterator;
+	IBase* pIBaseClass = (IBase *)pResource;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObjectIterator, "ObjectIterator", "GetCurrentObject");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pResource, "Resource", "GetResourceID");
 		}
-		if (pResource == nullptr)
+		if (pUniqueResourceID == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseResource(nullptr);
-		IObjectIterator* pIObjectIterator = dynamic_cast<IObjectIterator*>(pIBaseClass);
-		if (!pIObjectIterator)
+		IResource* pIResource = dynamic_cast<IResource*>(pIBaseClass);
+		if (!pIResource)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResource = pIObjectIterator->GetCurrentObject();
+		*pUniqueResourceID = pIResource->GetResourceID();
 
-		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Resource", *pResource);
+			pJournalEntry->addUInt32Result("UniqueResourceID", *pUniqueResourceID);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1553,31 +1721,25 @@ Lib3MFResult lib3mf_objectiterator_getcurrentobject(Lib3MF_ObjectIterator pObjec
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for MeshObjectIterator
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_meshobjectiterator_getcurrentmeshobject(Lib3MF_MeshObjectIterator pMeshObjectIterator, Lib3MF_MeshObject * pResource)
+Lib3MFResult lib3mf_resource_getuniqueresourceid(Lib3MF_Resource pResource, Lib3MF_uint32 * pUniqueResourceID)
 {
-	IBase* pIBaseClass = (IBase *)pMeshObjectIterator;
+	IBase* pIBaseClass = (IBase *)pResource;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObjectIterator, "MeshObjectIterator", "GetCurrentMeshObject");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pResource, "Resource", "GetUniqueResourceID");
 		}
-		if (pResource == nullptr)
+		if (pUniqueResourceID == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseResource(nullptr);
-		IMeshObjectIterator* pIMeshObjectIterator = dynamic_cast<IMeshObjectIterator*>(pIBaseClass);
-		if (!pIMeshObjectIterator)
+		IResource* pIResource = dynamic_cast<IResource*>(pIBaseClass);
+		if (!pIResource)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResource = pIMeshObjectIterator->GetCurrentMeshObject();
+		*pUniqueResourceID = pIResource->GetUniqueResourceID();
 
-		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Resource", *pResource);
+			pJournalEntry->addUInt32Result("UniqueResourceID", *pUniqueResourceID);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1593,31 +1755,27 @@ Lib3MFResult lib3mf_meshobjectiterator_getcurrentmeshobject(Lib3MF_MeshObjectIte
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for ComponentsObjectIterator
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_componentsobjectiterator_getcurrentcomponentsobject(Lib3MF_ComponentsObjectIterator pComponentsObjectIterator, Lib3MF_ComponentsObject * pResource)
+Lib3MFResult lib3mf_resource_packagepart(Lib3MF_Resource pResource, Lib3MF_PackagePart * pPackagePart)
 {
-	IBase* pIBaseClass = (IBase *)pComponentsObjectIterator;
+	IBase* pIBaseClass = (IBase *)pResource;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponentsObjectIterator, "ComponentsObjectIterator", "GetCurrentComponentsObject");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pResource, "Resource", "PackagePart");
 		}
-		if (pResource == nullptr)
+		if (pPackagePart == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseResource(nullptr);
-		IComponentsObjectIterator* pIComponentsObjectIterator = dynamic_cast<IComponentsObjectIterator*>(pIBaseClass);
-		if (!pIComponentsObjectIterator)
+		IBase* pBasePackagePart(nullptr);
+		IResource* pIResource = dynamic_cast<IResource*>(pIBaseClass);
+		if (!pIResource)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResource = pIComponentsObjectIterator->GetCurrentComponentsObject();
+		pBasePackagePart = pIResource->PackagePart();
 
-		*pResource = (IBase*)(pBaseResource);
+		*pPackagePart = (IBase*)(pBasePackagePart);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Resource", *pResource);
+			pJournalEntry->addHandleResult("PackagePart", *pPackagePart);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1633,31 +1791,62 @@ Lib3MFResult lib3mf_componentsobjectiterator_getcurrentcomponentsobject(Lib3MF_C
 	}
 }
 
+Lib3MFResult lib3mf_resource_setpackagepart(Lib3MF_Resource pResource, Lib3MF_PackagePart pPackagePart)
+{
+	IBase* pIBaseClass = (IBase *)pResource;
 
-/*************************************************************************************************************************
- Class implementation for Texture2DIterator
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_texture2diterator_getcurrenttexture2d(Lib3MF_Texture2DIterator pTexture2DIterator, Lib3MF_Texture2D * pResource)
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pResource, "Resource", "SetPackagePart");
+			pJournalEntry->addHandleParameter("PackagePart", pPackagePart);
+		}
+		IBase* pIBaseClassPackagePart = (IBase *)pPackagePart;
+		IPackagePart* pIPackagePart = dynamic_cast<IPackagePart*>(pIBaseClassPackagePart);
+		if (!pIPackagePart)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
+		IResource* pIResource = dynamic_cast<IResource*>(pIBaseClass);
+		if (!pIResource)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIResource->SetPackagePart(pIPackagePart);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_resource_getmodelresourceid(Lib3MF_Resource pResource, Lib3MF_uint32 * pModelResourceId)
 {
-	IBase* pIBaseClass = (IBase *)pTexture2DIterator;
+	IBase* pIBaseClass = (IBase *)pResource;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2DIterator, "Texture2DIterator", "GetCurrentTexture2D");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pResource, "Resource", "GetModelResourceID");
 		}
-		if (pResource == nullptr)
+		if (pModelResourceId == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseResource(nullptr);
-		ITexture2DIterator* pITexture2DIterator = dynamic_cast<ITexture2DIterator*>(pIBaseClass);
-		if (!pITexture2DIterator)
+		IResource* pIResource = dynamic_cast<IResource*>(pIBaseClass);
+		if (!pIResource)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResource = pITexture2DIterator->GetCurrentTexture2D();
+		*pModelResourceId = pIResource->GetModelResourceID();
 
-		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Resource", *pResource);
+			pJournalEntry->addUInt32Result("ModelResourceId", *pModelResourceId);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1675,29 +1864,27 @@ Lib3MFResult lib3mf_texture2diterator_getcurrenttexture2d(Lib3MF_Texture2DIterat
 
 
 /*************************************************************************************************************************
- Class implementation for BaseMaterialGroupIterator
+ Class implementation for ResourceIterator
 **************************************************************************************************************************/
-Lib3MFResult lib3mf_basematerialgroupiterator_getcurrentbasematerialgroup(Lib3MF_BaseMaterialGroupIterator pBaseMaterialGroupIterator, Lib3MF_BaseMaterialGroup * pResource)
+Lib3MFResult lib3mf_resourceiterator_movenext(Lib3MF_ResourceIterator pResourceIterator, bool * pHasNext)
 {
-	IBase* pIBaseClass = (IBase *)pBaseMaterialGroupIterator;
+	IBase* pIBaseClass = (IBase *)pResourceIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBaseMaterialGroupIterator, "BaseMaterialGroupIterator", "GetCurrentBaseMaterialGroup");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pResourceIterator, "ResourceIterator", "MoveNext");
 		}
-		if (pResource == nullptr)
+		if (pHasNext == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseResource(nullptr);
-		IBaseMaterialGroupIterator* pIBaseMaterialGroupIterator = dynamic_cast<IBaseMaterialGroupIterator*>(pIBaseClass);
-		if (!pIBaseMaterialGroupIterator)
+		IResourceIterator* pIResourceIterator = dynamic_cast<IResourceIterator*>(pIBaseClass);
+		if (!pIResourceIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResource = pIBaseMaterialGroupIterator->GetCurrentBaseMaterialGroup();
+		*pHasNext = pIResourceIterator->MoveNext();
 
-		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Resource", *pResource);
+			pJournalEntry->addBooleanResult("HasNext", *pHasNext);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1713,31 +1900,25 @@ Lib3MFResult lib3mf_basematerialgroupiterator_getcurrentbasematerialgroup(Lib3MF
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for ColorGroupIterator
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_colorgroupiterator_getcurrentcolorgroup(Lib3MF_ColorGroupIterator pColorGroupIterator, Lib3MF_ColorGroup * pResource)
+Lib3MFResult lib3mf_resourceiterator_moveprevious(Lib3MF_ResourceIterator pResourceIterator, bool * pHasPrevious)
 {
-	IBase* pIBaseClass = (IBase *)pColorGroupIterator;
+	IBase* pIBaseClass = (IBase *)pResourceIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pColorGroupIterator, "ColorGroupIterator", "GetCurrentColorGroup");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pResourceIterator, "ResourceIterator", "MovePrevious");
 		}
-		if (pResource == nullptr)
+		if (pHasPrevious == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseResource(nullptr);
-		IColorGroupIterator* pIColorGroupIterator = dynamic_cast<IColorGroupIterator*>(pIBaseClass);
-		if (!pIColorGroupIterator)
+		IResourceIterator* pIResourceIterator = dynamic_cast<IResourceIterator*>(pIBaseClass);
+		if (!pIResourceIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResource = pIColorGroupIterator->GetCurrentColorGroup();
+		*pHasPrevious = pIResourceIterator->MovePrevious();
 
-		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Resource", *pResource);
+			pJournalEntry->addBooleanResult("HasPrevious", *pHasPrevious);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1753,27 +1934,23 @@ Lib3MFResult lib3mf_colorgroupiterator_getcurrentcolorgroup(Lib3MF_ColorGroupIte
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for Texture2DGroupIterator
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_texture2dgroupiterator_getcurrenttexture2dgroup(Lib3MF_Texture2DGroupIterator pTexture2DGroupIterator, Lib3MF_Texture2DGroup * pResource)
+Lib3MFResult lib3mf_resourceiterator_getcurrent(Lib3MF_ResourceIterator pResourceIterator, Lib3MF_Resource * pResource)
 {
-	IBase* pIBaseClass = (IBase *)pTexture2DGroupIterator;
+	IBase* pIBaseClass = (IBase *)pResourceIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2DGroupIterator, "Texture2DGroupIterator", "GetCurrentTexture2DGroup");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pResourceIterator, "ResourceIterator", "GetCurrent");
 		}
 		if (pResource == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IBase* pBaseResource(nullptr);
-		ITexture2DGroupIterator* pITexture2DGroupIterator = dynamic_cast<ITexture2DGroupIterator*>(pIBaseClass);
-		if (!pITexture2DGroupIterator)
+		IResourceIterator* pIResourceIterator = dynamic_cast<IResourceIterator*>(pIBaseClass);
+		if (!pIResourceIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResource = pITexture2DGroupIterator->GetCurrentTexture2DGroup();
+		pBaseResource = pIResourceIterator->GetCurrent();
 
 		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
@@ -1793,31 +1970,27 @@ Lib3MFResult lib3mf_texture2dgroupiterator_getcurrenttexture2dgroup(Lib3MF_Textu
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for CompositeMaterialsIterator
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_compositematerialsiterator_getcurrentcompositematerials(Lib3MF_CompositeMaterialsIterator pCompositeMaterialsIterator, Lib3MF_CompositeMaterials * pResource)
+Lib3MFResult lib3mf_resourceiterator_clone(Lib3MF_ResourceIterator pResourceIterator, Lib3MF_ResourceIterator * pOutResourceIterator)
 {
-	IBase* pIBaseClass = (IBase *)pCompositeMaterialsIterator;
+	IBase* pIBaseClass = (IBase *)pResourceIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pCompositeMaterialsIterator, "CompositeMaterialsIterator", "GetCurrentCompositeMaterials");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pResourceIterator, "ResourceIterator", "Clone");
 		}
-		if (pResource == nullptr)
+		if (pOutResourceIterator == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseResource(nullptr);
-		ICompositeMaterialsIterator* pICompositeMaterialsIterator = dynamic_cast<ICompositeMaterialsIterator*>(pIBaseClass);
-		if (!pICompositeMaterialsIterator)
+		IBase* pBaseOutResourceIterator(nullptr);
+		IResourceIterator* pIResourceIterator = dynamic_cast<IResourceIterator*>(pIBaseClass);
+		if (!pIResourceIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResource = pICompositeMaterialsIterator->GetCurrentCompositeMaterials();
+		pBaseOutResourceIterator = pIResourceIterator->Clone();
 
-		*pResource = (IBase*)(pBaseResource);
+		*pOutResourceIterator = (IBase*)(pBaseOutResourceIterator);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Resource", *pResource);
+			pJournalEntry->addHandleResult("OutResourceIterator", *pOutResourceIterator);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1833,31 +2006,25 @@ Lib3MFResult lib3mf_compositematerialsiterator_getcurrentcompositematerials(Lib3
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for MultiPropertyGroupIterator
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_multipropertygroupiterator_getcurrentmultipropertygroup(Lib3MF_MultiPropertyGroupIterator pMultiPropertyGroupIterator, Lib3MF_MultiPropertyGroup * pResource)
+Lib3MFResult lib3mf_resourceiterator_count(Lib3MF_ResourceIterator pResourceIterator, Lib3MF_uint64 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pMultiPropertyGroupIterator;
+	IBase* pIBaseClass = (IBase *)pResourceIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroupIterator, "MultiPropertyGroupIterator", "GetCurrentMultiPropertyGroup");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pResourceIterator, "ResourceIterator", "Count");
 		}
-		if (pResource == nullptr)
+		if (pCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseResource(nullptr);
-		IMultiPropertyGroupIterator* pIMultiPropertyGroupIterator = dynamic_cast<IMultiPropertyGroupIterator*>(pIBaseClass);
-		if (!pIMultiPropertyGroupIterator)
+		IResourceIterator* pIResourceIterator = dynamic_cast<IResourceIterator*>(pIBaseClass);
+		if (!pIResourceIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResource = pIMultiPropertyGroupIterator->GetCurrentMultiPropertyGroup();
+		*pCount = pIResourceIterator->Count();
 
-		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Resource", *pResource);
+			pJournalEntry->addUInt64Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -1875,25 +2042,25 @@ Lib3MFResult lib3mf_multipropertygroupiterator_getcurrentmultipropertygroup(Lib3
 
 
 /*************************************************************************************************************************
- Class implementation for Image3DIterator
+ Class implementation for SliceStackIterator
 **************************************************************************************************************************/
-Lib3MFResult lib3mf_image3diterator_getcurrentimage3d(Lib3MF_Image3DIterator pImage3DIterator, Lib3MF_Image3D * pResource)
+Lib3MFResult lib3mf_slicestackiterator_getcurrentslicestack(Lib3MF_SliceStackIterator pSliceStackIterator, Lib3MF_SliceStack * pResource)
 {
-	IBase* pIBaseClass = (IBase *)pImage3DIterator;
+	IBase* pIBaseClass = (IBase *)pSliceStackIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImage3DIterator, "Image3DIterator", "GetCurrentImage3D");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pSliceStackIterator, "SliceStackIterator", "GetCurrentSliceStack");
 		}
 		if (pResource == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IBase* pBaseResource(nullptr);
-		IImage3DIterator* pIImage3DIterator = dynamic_cast<IImage3DIterator*>(pIBaseClass);
-		if (!pIImage3DIterator)
+		ISliceStackIterator* pISliceStackIterator = dynamic_cast<ISliceStackIterator*>(pIBaseClass);
+		if (!pISliceStackIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResource = pIImage3DIterator->GetCurrentImage3D();
+		pBaseResource = pISliceStackIterator->GetCurrentSliceStack();
 
 		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
@@ -1915,25 +2082,25 @@ Lib3MFResult lib3mf_image3diterator_getcurrentimage3d(Lib3MF_Image3DIterator pIm
 
 
 /*************************************************************************************************************************
- Class implementation for FunctionIterator
+ Class implementation for ObjectIterator
 **************************************************************************************************************************/
-Lib3MFResult lib3mf_functioniterator_getcurrentfunction(Lib3MF_FunctionIterator pFunctionIterator, Lib3MF_Function * pResource)
+Lib3MFResult lib3mf_objectiterator_getcurrentobject(Lib3MF_ObjectIterator pObjectIterator, Lib3MF_Object * pResource)
 {
-	IBase* pIBaseClass = (IBase *)pFunctionIterator;
+	IBase* pIBaseClass = (IBase *)pObjectIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionIterator, "FunctionIterator", "GetCurrentFunction");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObjectIterator, "ObjectIterator", "GetCurrentObject");
 		}
 		if (pResource == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IBase* pBaseResource(nullptr);
-		IFunctionIterator* pIFunctionIterator = dynamic_cast<IFunctionIterator*>(pIBaseClass);
-		if (!pIFunctionIterator)
+		IObjectIterator* pIObjectIterator = dynamic_cast<IObjectIterator*>(pIBaseClass);
+		if (!pIObjectIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResource = pIFunctionIterator->GetCurrentFunction();
+		pBaseResource = pIObjectIterator->GetCurrentObject();
 
 		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
@@ -1955,25 +2122,25 @@ Lib3MFResult lib3mf_functioniterator_getcurrentfunction(Lib3MF_FunctionIterator
 
 
 /*************************************************************************************************************************
- Class implementation for LevelSetIterator
+ Class implementation for MeshObjectIterator
 **************************************************************************************************************************/
-Lib3MFResult lib3mf_levelsetiterator_getcurrentlevelset(Lib3MF_LevelSetIterator pLevelSetIterator, Lib3MF_LevelSet * pResource)
+Lib3MFResult lib3mf_meshobjectiterator_getcurrentmeshobject(Lib3MF_MeshObjectIterator pMeshObjectIterator, Lib3MF_MeshObject * pResource)
 {
-	IBase* pIBaseClass = (IBase *)pLevelSetIterator;
+	IBase* pIBaseClass = (IBase *)pMeshObjectIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSetIterator, "LevelSetIterator", "GetCurrentLevelSet");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObjectIterator, "MeshObjectIterator", "GetCurrentMeshObject");
 		}
 		if (pResource == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IBase* pBaseResource(nullptr);
-		ILevelSetIterator* pILevelSetIterator = dynamic_cast<ILevelSetIterator*>(pIBaseClass);
-		if (!pILevelSetIterator)
+		IMeshObjectIterator* pIMeshObjectIterator = dynamic_cast<IMeshObjectIterator*>(pIBaseClass);
+		if (!pIMeshObjectIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResource = pILevelSetIterator->GetCurrentLevelSet();
+		pBaseResource = pIMeshObjectIterator->GetCurrentMeshObject();
 
 		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
@@ -1995,49 +2162,29 @@ Lib3MFResult lib3mf_levelsetiterator_getcurrentlevelset(Lib3MF_LevelSetIterator
 
 
 /*************************************************************************************************************************
- Class implementation for MetaData
+ Class implementation for ComponentsObjectIterator
 **************************************************************************************************************************/
-Lib3MFResult lib3mf_metadata_getnamespace(Lib3MF_MetaData pMetaData, const Lib3MF_uint32 nNameSpaceBufferSize, Lib3MF_uint32* pNameSpaceNeededChars, char * pNameSpaceBuffer)
+Lib3MFResult lib3mf_componentsobjectiterator_getcurrentcomponentsobject(Lib3MF_ComponentsObjectIterator pComponentsObjectIterator, Lib3MF_ComponentsObject * pResource)
 {
-	IBase* pIBaseClass = (IBase *)pMetaData;
+	IBase* pIBaseClass = (IBase *)pComponentsObjectIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "GetNameSpace");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponentsObjectIterator, "ComponentsObjectIterator", "GetCurrentComponentsObject");
 		}
-		if ( (!pNameSpaceBuffer) && !(pNameSpaceNeededChars) )
+		if (pResource == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sNameSpace("");
-		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
-		if (!pIMetaData)
+		IBase* pBaseResource(nullptr);
+		IComponentsObjectIterator* pIComponentsObjectIterator = dynamic_cast<IComponentsObjectIterator*>(pIBaseClass);
+		if (!pIComponentsObjectIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pNameSpaceBuffer == nullptr);
-		if (isCacheCall) {
-			sNameSpace = pIMetaData->GetNameSpace();
+		pBaseResource = pIComponentsObjectIterator->GetCurrentComponentsObject();
 
-			pIMetaData->_setCache (new ParameterCache_1<std::string> (sNameSpace));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIMetaData->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sNameSpace);
-			pIMetaData->_setCache (nullptr);
-		}
-		
-		if (pNameSpaceNeededChars)
-			*pNameSpaceNeededChars = (Lib3MF_uint32) (sNameSpace.size()+1);
-		if (pNameSpaceBuffer) {
-			if (sNameSpace.size() >= nNameSpaceBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iNameSpace = 0; iNameSpace < sNameSpace.size(); iNameSpace++)
-				pNameSpaceBuffer[iNameSpace] = sNameSpace[iNameSpace];
-			pNameSpaceBuffer[sNameSpace.size()] = 0;
-		}
+		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("NameSpace", sNameSpace.c_str());
+			pJournalEntry->addHandleResult("Resource", *pResource);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2053,26 +2200,31 @@ Lib3MFResult lib3mf_metadata_getnamespace(Lib3MF_MetaData pMetaData, const Lib3M
 	}
 }
 
-Lib3MFResult lib3mf_metadata_setnamespace(Lib3MF_MetaData pMetaData, const char * pNameSpace)
+
+/*************************************************************************************************************************
+ Class implementation for Texture2DIterator
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_texture2diterator_getcurrenttexture2d(Lib3MF_Texture2DIterator pTexture2DIterator, Lib3MF_Texture2D * pResource)
 {
-	IBase* pIBaseClass = (IBase *)pMetaData;
+	IBase* pIBaseClass = (IBase *)pTexture2DIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "SetNameSpace");
-			pJournalEntry->addStringParameter("NameSpace", pNameSpace);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2DIterator, "Texture2DIterator", "GetCurrentTexture2D");
 		}
-		if (pNameSpace == nullptr)
+		if (pResource == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sNameSpace(pNameSpace);
-		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
-		if (!pIMetaData)
+		IBase* pBaseResource(nullptr);
+		ITexture2DIterator* pITexture2DIterator = dynamic_cast<ITexture2DIterator*>(pIBaseClass);
+		if (!pITexture2DIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMetaData->SetNameSpace(sNameSpace);
+		pBaseResource = pITexture2DIterator->GetCurrentTexture2D();
 
+		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Resource", *pResource);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2088,47 +2240,31 @@ Lib3MFResult lib3mf_metadata_setnamespace(Lib3MF_MetaData pMetaData, const char
 	}
 }
 
-Lib3MFResult lib3mf_metadata_getname(Lib3MF_MetaData pMetaData, const Lib3MF_uint32 nNameBufferSize, Lib3MF_uint32* pNameNeededChars, char * pNameBuffer)
+
+/*************************************************************************************************************************
+ Class implementation for BaseMaterialGroupIterator
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_basematerialgroupiterator_getcurrentbasematerialgroup(Lib3MF_BaseMaterialGroupIterator pBaseMaterialGroupIterator, Lib3MF_BaseMaterialGroup * pResource)
 {
-	IBase* pIBaseClass = (IBase *)pMetaData;
+	IBase* pIBaseClass = (IBase *)pBaseMaterialGroupIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "GetName");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBaseMaterialGroupIterator, "BaseMaterialGroupIterator", "GetCurrentBaseMaterialGroup");
 		}
-		if ( (!pNameBuffer) && !(pNameNeededChars) )
+		if (pResource == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sName("");
-		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
-		if (!pIMetaData)
+		IBase* pBaseResource(nullptr);
+		IBaseMaterialGroupIterator* pIBaseMaterialGroupIterator = dynamic_cast<IBaseMaterialGroupIterator*>(pIBaseClass);
+		if (!pIBaseMaterialGroupIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pNameBuffer == nullptr);
-		if (isCacheCall) {
-			sName = pIMetaData->GetName();
+		pBaseResource = pIBaseMaterialGroupIterator->GetCurrentBaseMaterialGroup();
 
-			pIMetaData->_setCache (new ParameterCache_1<std::string> (sName));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIMetaData->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sName);
-			pIMetaData->_setCache (nullptr);
-		}
-		
-		if (pNameNeededChars)
-			*pNameNeededChars = (Lib3MF_uint32) (sName.size()+1);
-		if (pNameBuffer) {
-			if (sName.size() >= nNameBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iName = 0; iName < sName.size(); iName++)
-				pNameBuffer[iName] = sName[iName];
-			pNameBuffer[sName.size()] = 0;
-		}
+		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Name", sName.c_str());
+			pJournalEntry->addHandleResult("Resource", *pResource);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2144,26 +2280,31 @@ Lib3MFResult lib3mf_metadata_getname(Lib3MF_MetaData pMetaData, const Lib3MF_uin
 	}
 }
 
-Lib3MFResult lib3mf_metadata_setname(Lib3MF_MetaData pMetaData, const char * pName)
+
+/*************************************************************************************************************************
+ Class implementation for ColorGroupIterator
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_colorgroupiterator_getcurrentcolorgroup(Lib3MF_ColorGroupIterator pColorGroupIterator, Lib3MF_ColorGroup * pResource)
 {
-	IBase* pIBaseClass = (IBase *)pMetaData;
+	IBase* pIBaseClass = (IBase *)pColorGroupIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "SetName");
-			pJournalEntry->addStringParameter("Name", pName);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pColorGroupIterator, "ColorGroupIterator", "GetCurrentColorGroup");
 		}
-		if (pName == nullptr)
+		if (pResource == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sName(pName);
-		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
-		if (!pIMetaData)
+		IBase* pBaseResource(nullptr);
+		IColorGroupIterator* pIColorGroupIterator = dynamic_cast<IColorGroupIterator*>(pIBaseClass);
+		if (!pIColorGroupIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMetaData->SetName(sName);
+		pBaseResource = pIColorGroupIterator->GetCurrentColorGroup();
 
+		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Resource", *pResource);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2179,47 +2320,31 @@ Lib3MFResult lib3mf_metadata_setname(Lib3MF_MetaData pMetaData, const char * pNa
 	}
 }
 
-Lib3MFResult lib3mf_metadata_getkey(Lib3MF_MetaData pMetaData, const Lib3MF_uint32 nKeyBufferSize, Lib3MF_uint32* pKeyNeededChars, char * pKeyBuffer)
+
+/*************************************************************************************************************************
+ Class implementation for Texture2DGroupIterator
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_texture2dgroupiterator_getcurrenttexture2dgroup(Lib3MF_Texture2DGroupIterator pTexture2DGroupIterator, Lib3MF_Texture2DGroup * pResource)
 {
-	IBase* pIBaseClass = (IBase *)pMetaData;
+	IBase* pIBaseClass = (IBase *)pTexture2DGroupIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "GetKey");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2DGroupIterator, "Texture2DGroupIterator", "GetCurrentTexture2DGroup");
 		}
-		if ( (!pKeyBuffer) && !(pKeyNeededChars) )
+		if (pResource == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sKey("");
-		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
-		if (!pIMetaData)
+		IBase* pBaseResource(nullptr);
+		ITexture2DGroupIterator* pITexture2DGroupIterator = dynamic_cast<ITexture2DGroupIterator*>(pIBaseClass);
+		if (!pITexture2DGroupIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pKeyBuffer == nullptr);
-		if (isCacheCall) {
-			sKey = pIMetaData->GetKey();
+		pBaseResource = pITexture2DGroupIterator->GetCurrentTexture2DGroup();
 
-			pIMetaData->_setCache (new ParameterCache_1<std::string> (sKey));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIMetaData->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sKey);
-			pIMetaData->_setCache (nullptr);
-		}
-		
-		if (pKeyNeededChars)
-			*pKeyNeededChars = (Lib3MF_uint32) (sKey.size()+1);
-		if (pKeyBuffer) {
-			if (sKey.size() >= nKeyBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iKey = 0; iKey < sKey.size(); iKey++)
-				pKeyBuffer[iKey] = sKey[iKey];
-			pKeyBuffer[sKey.size()] = 0;
-		}
+		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Key", sKey.c_str());
+			pJournalEntry->addHandleResult("Resource", *pResource);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2235,25 +2360,31 @@ Lib3MFResult lib3mf_metadata_getkey(Lib3MF_MetaData pMetaData, const Lib3MF_uint
 	}
 }
 
-Lib3MFResult lib3mf_metadata_getmustpreserve(Lib3MF_MetaData pMetaData, bool * pMustPreserve)
+
+/*************************************************************************************************************************
+ Class implementation for CompositeMaterialsIterator
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_compositematerialsiterator_getcurrentcompositematerials(Lib3MF_CompositeMaterialsIterator pCompositeMaterialsIterator, Lib3MF_CompositeMaterials * pResource)
 {
-	IBase* pIBaseClass = (IBase *)pMetaData;
+	IBase* pIBaseClass = (IBase *)pCompositeMaterialsIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "GetMustPreserve");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pCompositeMaterialsIterator, "CompositeMaterialsIterator", "GetCurrentCompositeMaterials");
 		}
-		if (pMustPreserve == nullptr)
+		if (pResource == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
-		if (!pIMetaData)
+		IBase* pBaseResource(nullptr);
+		ICompositeMaterialsIterator* pICompositeMaterialsIterator = dynamic_cast<ICompositeMaterialsIterator*>(pIBaseClass);
+		if (!pICompositeMaterialsIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pMustPreserve = pIMetaData->GetMustPreserve();
+		pBaseResource = pICompositeMaterialsIterator->GetCurrentCompositeMaterials();
 
+		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("MustPreserve", *pMustPreserve);
+			pJournalEntry->addHandleResult("Resource", *pResource);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2269,23 +2400,31 @@ Lib3MFResult lib3mf_metadata_getmustpreserve(Lib3MF_MetaData pMetaData, bool * p
 	}
 }
 
-Lib3MFResult lib3mf_metadata_setmustpreserve(Lib3MF_MetaData pMetaData, bool bMustPreserve)
+
+/*************************************************************************************************************************
+ Class implementation for MultiPropertyGroupIterator
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_multipropertygroupiterator_getcurrentmultipropertygroup(Lib3MF_MultiPropertyGroupIterator pMultiPropertyGroupIterator, Lib3MF_MultiPropertyGroup * pResource)
 {
-	IBase* pIBaseClass = (IBase *)pMetaData;
+	IBase* pIBaseClass = (IBase *)pMultiPropertyGroupIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "SetMustPreserve");
-			pJournalEntry->addBooleanParameter("MustPreserve", bMustPreserve);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroupIterator, "MultiPropertyGroupIterator", "GetCurrentMultiPropertyGroup");
 		}
-		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
-		if (!pIMetaData)
+		if (pResource == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseResource(nullptr);
+		IMultiPropertyGroupIterator* pIMultiPropertyGroupIterator = dynamic_cast<IMultiPropertyGroupIterator*>(pIBaseClass);
+		if (!pIMultiPropertyGroupIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMetaData->SetMustPreserve(bMustPreserve);
+		pBaseResource = pIMultiPropertyGroupIterator->GetCurrentMultiPropertyGroup();
 
+		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Resource", *pResource);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2301,47 +2440,31 @@ Lib3MFResult lib3mf_metadata_setmustpreserve(Lib3MF_MetaData pMetaData, bool bMu
 	}
 }
 
-Lib3MFResult lib3mf_metadata_gettype(Lib3MF_MetaData pMetaData, const Lib3MF_uint32 nTypeBufferSize, Lib3MF_uint32* pTypeNeededChars, char * pTypeBuffer)
+
+/*************************************************************************************************************************
+ Class implementation for Image3DIterator
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_image3diterator_getcurrentimage3d(Lib3MF_Image3DIterator pImage3DIterator, Lib3MF_Image3D * pResource)
 {
-	IBase* pIBaseClass = (IBase *)pMetaData;
+	IBase* pIBaseClass = (IBase *)pImage3DIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "GetType");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImage3DIterator, "Image3DIterator", "GetCurrentImage3D");
 		}
-		if ( (!pTypeBuffer) && !(pTypeNeededChars) )
+		if (pResource == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sType("");
-		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
-		if (!pIMetaData)
+		IBase* pBaseResource(nullptr);
+		IImage3DIterator* pIImage3DIterator = dynamic_cast<IImage3DIterator*>(pIBaseClass);
+		if (!pIImage3DIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pTypeBuffer == nullptr);
-		if (isCacheCall) {
-			sType = pIMetaData->GetType();
+		pBaseResource = pIImage3DIterator->GetCurrentImage3D();
 
-			pIMetaData->_setCache (new ParameterCache_1<std::string> (sType));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIMetaData->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sType);
-			pIMetaData->_setCache (nullptr);
-		}
-		
-		if (pTypeNeededChars)
-			*pTypeNeededChars = (Lib3MF_uint32) (sType.size()+1);
-		if (pTypeBuffer) {
-			if (sType.size() >= nTypeBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iType = 0; iType < sType.size(); iType++)
-				pTypeBuffer[iType] = sType[iType];
-			pTypeBuffer[sType.size()] = 0;
-		}
+		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Type", sType.c_str());
+			pJournalEntry->addHandleResult("Resource", *pResource);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2357,26 +2480,31 @@ Lib3MFResult lib3mf_metadata_gettype(Lib3MF_MetaData pMetaData, const Lib3MF_uin
 	}
 }
 
-Lib3MFResult lib3mf_metadata_settype(Lib3MF_MetaData pMetaData, const char * pType)
+
+/*************************************************************************************************************************
+ Class implementation for FunctionIterator
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_functioniterator_getcurrentfunction(Lib3MF_FunctionIterator pFunctionIterator, Lib3MF_Function * pResource)
 {
-	IBase* pIBaseClass = (IBase *)pMetaData;
+	IBase* pIBaseClass = (IBase *)pFunctionIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "SetType");
-			pJournalEntry->addStringParameter("Type", pType);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionIterator, "FunctionIterator", "GetCurrentFunction");
 		}
-		if (pType == nullptr)
+		if (pResource == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sType(pType);
-		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
-		if (!pIMetaData)
+		IBase* pBaseResource(nullptr);
+		IFunctionIterator* pIFunctionIterator = dynamic_cast<IFunctionIterator*>(pIBaseClass);
+		if (!pIFunctionIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMetaData->SetType(sType);
+		pBaseResource = pIFunctionIterator->GetCurrentFunction();
 
+		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Resource", *pResource);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2392,47 +2520,31 @@ Lib3MFResult lib3mf_metadata_settype(Lib3MF_MetaData pMetaData, const char * pTy
 	}
 }
 
-Lib3MFResult lib3mf_metadata_getvalue(Lib3MF_MetaData pMetaData, const Lib3MF_uint32 nValueBufferSize, Lib3MF_uint32* pValueNeededChars, char * pValueBuffer)
+
+/*************************************************************************************************************************
+ Class implementation for LevelSetIterator
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_levelsetiterator_getcurrentlevelset(Lib3MF_LevelSetIterator pLevelSetIterator, Lib3MF_LevelSet * pResource)
 {
-	IBase* pIBaseClass = (IBase *)pMetaData;
+	IBase* pIBaseClass = (IBase *)pLevelSetIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "GetValue");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSetIterator, "LevelSetIterator", "GetCurrentLevelSet");
 		}
-		if ( (!pValueBuffer) && !(pValueNeededChars) )
+		if (pResource == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sValue("");
-		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
-		if (!pIMetaData)
+		IBase* pBaseResource(nullptr);
+		ILevelSetIterator* pILevelSetIterator = dynamic_cast<ILevelSetIterator*>(pIBaseClass);
+		if (!pILevelSetIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pValueBuffer == nullptr);
-		if (isCacheCall) {
-			sValue = pIMetaData->GetValue();
+		pBaseResource = pILevelSetIterator->GetCurrentLevelSet();
 
-			pIMetaData->_setCache (new ParameterCache_1<std::string> (sValue));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIMetaData->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sValue);
-			pIMetaData->_setCache (nullptr);
-		}
-		
-		if (pValueNeededChars)
-			*pValueNeededChars = (Lib3MF_uint32) (sValue.size()+1);
-		if (pValueBuffer) {
-			if (sValue.size() >= nValueBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iValue = 0; iValue < sValue.size(); iValue++)
-				pValueBuffer[iValue] = sValue[iValue];
-			pValueBuffer[sValue.size()] = 0;
-		}
+		*pResource = (IBase*)(pBaseResource);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Value", sValue.c_str());
+			pJournalEntry->addHandleResult("Resource", *pResource);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2448,26 +2560,51 @@ Lib3MFResult lib3mf_metadata_getvalue(Lib3MF_MetaData pMetaData, const Lib3MF_ui
 	}
 }
 
-Lib3MFResult lib3mf_metadata_setvalue(Lib3MF_MetaData pMetaData, const char * pValue)
+
+/*************************************************************************************************************************
+ Class implementation for MetaData
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_metadata_getnamespace(Lib3MF_MetaData pMetaData, const Lib3MF_uint32 nNameSpaceBufferSize, Lib3MF_uint32* pNameSpaceNeededChars, char * pNameSpaceBuffer)
 {
 	IBase* pIBaseClass = (IBase *)pMetaData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "SetValue");
-			pJournalEntry->addStringParameter("Value", pValue);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "GetNameSpace");
 		}
-		if (pValue == nullptr)
+		if ( (!pNameSpaceBuffer) && !(pNameSpaceNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sValue(pValue);
+		std::string sNameSpace("");
 		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
 		if (!pIMetaData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMetaData->SetValue(sValue);
+		bool isCacheCall = (pNameSpaceBuffer == nullptr);
+		if (isCacheCall) {
+			sNameSpace = pIMetaData->GetNameSpace();
 
+			pIMetaData->_setCache (new ParameterCache_1<std::string> (sNameSpace));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIMetaData->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sNameSpace);
+			pIMetaData->_setCache (nullptr);
+		}
+		
+		if (pNameSpaceNeededChars)
+			*pNameSpaceNeededChars = (Lib3MF_uint32) (sNameSpace.size()+1);
+		if (pNameSpaceBuffer) {
+			if (sNameSpace.size() >= nNameSpaceBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iNameSpace = 0; iNameSpace < sNameSpace.size(); iNameSpace++)
+				pNameSpaceBuffer[iNameSpace] = sNameSpace[iNameSpace];
+			pNameSpaceBuffer[sNameSpace.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addStringResult("NameSpace", sNameSpace.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2483,29 +2620,26 @@ Lib3MFResult lib3mf_metadata_setvalue(Lib3MF_MetaData pMetaData, const char * pV
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for MetaDataGroup
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_metadatagroup_getmetadatacount(Lib3MF_MetaDataGroup pMetaDataGroup, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_metadata_setnamespace(Lib3MF_MetaData pMetaData, const char * pNameSpace)
 {
-	IBase* pIBaseClass = (IBase *)pMetaDataGroup;
+	IBase* pIBaseClass = (IBase *)pMetaData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaDataGroup, "MetaDataGroup", "GetMetaDataCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "SetNameSpace");
+			pJournalEntry->addStringParameter("NameSpace", pNameSpace);
 		}
-		if (pCount == nullptr)
+		if (pNameSpace == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IMetaDataGroup* pIMetaDataGroup = dynamic_cast<IMetaDataGroup*>(pIBaseClass);
-		if (!pIMetaDataGroup)
+		std::string sNameSpace(pNameSpace);
+		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
+		if (!pIMetaData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pIMetaDataGroup->GetMetaDataCount();
+		pIMetaData->SetNameSpace(sNameSpace);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2521,28 +2655,47 @@ Lib3MFResult lib3mf_metadatagroup_getmetadatacount(Lib3MF_MetaDataGroup pMetaDat
 	}
 }
 
-Lib3MFResult lib3mf_metadatagroup_getmetadata(Lib3MF_MetaDataGroup pMetaDataGroup, Lib3MF_uint32 nIndex, Lib3MF_MetaData * pMetaData)
+Lib3MFResult lib3mf_metadata_getname(Lib3MF_MetaData pMetaData, const Lib3MF_uint32 nNameBufferSize, Lib3MF_uint32* pNameNeededChars, char * pNameBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pMetaDataGroup;
+	IBase* pIBaseClass = (IBase *)pMetaData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaDataGroup, "MetaDataGroup", "GetMetaData");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "GetName");
 		}
-		if (pMetaData == nullptr)
+		if ( (!pNameBuffer) && !(pNameNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseMetaData(nullptr);
-		IMetaDataGroup* pIMetaDataGroup = dynamic_cast<IMetaDataGroup*>(pIBaseClass);
-		if (!pIMetaDataGroup)
+		std::string sName("");
+		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
+		if (!pIMetaData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseMetaData = pIMetaDataGroup->GetMetaData(nIndex);
+		bool isCacheCall = (pNameBuffer == nullptr);
+		if (isCacheCall) {
+			sName = pIMetaData->GetName();
 
-		*pMetaData = (IBase*)(pBaseMetaData);
+			pIMetaData->_setCache (new ParameterCache_1<std::string> (sName));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIMetaData->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sName);
+			pIMetaData->_setCache (nullptr);
+		}
+		
+		if (pNameNeededChars)
+			*pNameNeededChars = (Lib3MF_uint32) (sName.size()+1);
+		if (pNameBuffer) {
+			if (sName.size() >= nNameBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iName = 0; iName < sName.size(); iName++)
+				pNameBuffer[iName] = sName[iName];
+			pNameBuffer[sName.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("MetaData", *pMetaData);
+			pJournalEntry->addStringResult("Name", sName.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2558,35 +2711,26 @@ Lib3MFResult lib3mf_metadatagroup_getmetadata(Lib3MF_MetaDataGroup pMetaDataGrou
 	}
 }
 
-Lib3MFResult lib3mf_metadatagroup_getmetadatabykey(Lib3MF_MetaDataGroup pMetaDataGroup, const char * pNameSpace, const char * pName, Lib3MF_MetaData * pMetaData)
+Lib3MFResult lib3mf_metadata_setname(Lib3MF_MetaData pMetaData, const char * pName)
 {
-	IBase* pIBaseClass = (IBase *)pMetaDataGroup;
+	IBase* pIBaseClass = (IBase *)pMetaData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaDataGroup, "MetaDataGroup", "GetMetaDataByKey");
-			pJournalEntry->addStringParameter("NameSpace", pNameSpace);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "SetName");
 			pJournalEntry->addStringParameter("Name", pName);
 		}
-		if (pNameSpace == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		if (pName == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pMetaData == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sNameSpace(pNameSpace);
 		std::string sName(pName);
-		IBase* pBaseMetaData(nullptr);
-		IMetaDataGroup* pIMetaDataGroup = dynamic_cast<IMetaDataGroup*>(pIBaseClass);
-		if (!pIMetaDataGroup)
+		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
+		if (!pIMetaData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseMetaData = pIMetaDataGroup->GetMetaDataByKey(sNameSpace, sName);
+		pIMetaData->SetName(sName);
 
-		*pMetaData = (IBase*)(pBaseMetaData);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("MetaData", *pMetaData);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2602,23 +2746,47 @@ Lib3MFResult lib3mf_metadatagroup_getmetadatabykey(Lib3MF_MetaDataGroup pMetaDat
 	}
 }
 
-Lib3MFResult lib3mf_metadatagroup_removemetadatabyindex(Lib3MF_MetaDataGroup pMetaDataGroup, Lib3MF_uint32 nIndex)
+Lib3MFResult lib3mf_metadata_getkey(Lib3MF_MetaData pMetaData, const Lib3MF_uint32 nKeyBufferSize, Lib3MF_uint32* pKeyNeededChars, char * pKeyBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pMetaDataGroup;
+	IBase* pIBaseClass = (IBase *)pMetaData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaDataGroup, "MetaDataGroup", "RemoveMetaDataByIndex");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "GetKey");
 		}
-		IMetaDataGroup* pIMetaDataGroup = dynamic_cast<IMetaDataGroup*>(pIBaseClass);
-		if (!pIMetaDataGroup)
+		if ( (!pKeyBuffer) && !(pKeyNeededChars) )
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sKey("");
+		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
+		if (!pIMetaData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMetaDataGroup->RemoveMetaDataByIndex(nIndex);
+		bool isCacheCall = (pKeyBuffer == nullptr);
+		if (isCacheCall) {
+			sKey = pIMetaData->GetKey();
 
+			pIMetaData->_setCache (new ParameterCache_1<std::string> (sKey));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIMetaData->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sKey);
+			pIMetaData->_setCache (nullptr);
+		}
+		
+		if (pKeyNeededChars)
+			*pKeyNeededChars = (Lib3MF_uint32) (sKey.size()+1);
+		if (pKeyBuffer) {
+			if (sKey.size() >= nKeyBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iKey = 0; iKey < sKey.size(); iKey++)
+				pKeyBuffer[iKey] = sKey[iKey];
+			pKeyBuffer[sKey.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addStringResult("Key", sKey.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2634,28 +2802,25 @@ Lib3MFResult lib3mf_metadatagroup_removemetadatabyindex(Lib3MF_MetaDataGroup pMe
 	}
 }
 
-Lib3MFResult lib3mf_metadatagroup_removemetadata(Lib3MF_MetaDataGroup pMetaDataGroup, Lib3MF_MetaData pTheMetaData)
+Lib3MFResult lib3mf_metadata_getmustpreserve(Lib3MF_MetaData pMetaData, bool * pMustPreserve)
 {
-	IBase* pIBaseClass = (IBase *)pMetaDataGroup;
+	IBase* pIBaseClass = (IBase *)pMetaData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaDataGroup, "MetaDataGroup", "RemoveMetaData");
-			pJournalEntry->addHandleParameter("TheMetaData", pTheMetaData);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "GetMustPreserve");
 		}
-		IBase* pIBaseClassTheMetaData = (IBase *)pTheMetaData;
-		IMetaData* pITheMetaData = dynamic_cast<IMetaData*>(pIBaseClassTheMetaData);
-		if (!pITheMetaData)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
-		IMetaDataGroup* pIMetaDataGroup = dynamic_cast<IMetaDataGroup*>(pIBaseClass);
-		if (!pIMetaDataGroup)
+		if (pMustPreserve == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
+		if (!pIMetaData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMetaDataGroup->RemoveMetaData(pITheMetaData);
+		*pMustPreserve = pIMetaData->GetMustPreserve();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addBooleanResult("MustPreserve", *pMustPreserve);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2671,81 +2836,21 @@ Lib3MFResult lib3mf_metadatagroup_removemetadata(Lib3MF_MetaDataGroup pMetaDataG
 	}
 }
 
-Lib3MFResult lib3mf_metadatagroup_addmetadata(Lib3MF_MetaDataGroup pMetaDataGroup, const char * pNameSpace, const char * pName, const char * pValue, const char * pType, bool bMustPreserve, Lib3MF_MetaData * pMetaData)
+Lib3MFResult lib3mf_metadata_setmustpreserve(Lib3MF_MetaData pMetaData, bool bMustPreserve)
 {
-	IBase* pIBaseClass = (IBase *)pMetaDataGroup;
+	IBase* pIBaseClass = (IBase *)pMetaData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaDataGroup, "MetaDataGroup", "AddMetaData");
-			pJournalEntry->addStringParameter("NameSpace", pNameSpace);
-			pJournalEntry->addStringParameter("Name", pName);
-			pJournalEntry->addStringParameter("Value", pValue);
-			pJournalEntry->addStringParameter("Type", pType);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "SetMustPreserve");
 			pJournalEntry->addBooleanParameter("MustPreserve", bMustPreserve);
 		}
-		if (pNameSpace == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pValue == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pType == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pMetaData == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sNameSpace(pNameSpace);
-		std::string sName(pName);
-		std::string sValue(pValue);
-		std::string sType(pType);
-		IBase* pBaseMetaData(nullptr);
-		IMetaDataGroup* pIMetaDataGroup = dynamic_cast<IMetaDataGroup*>(pIBaseClass);
-		if (!pIMetaDataGroup)
-			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-		
-		pBaseMetaData = pIMetaDataGroup->AddMetaData(sNameSpace, sName, sValue, sType, bMustPreserve);
-
-		*pMetaData = (IBase*)(pBaseMetaData);
-		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("MetaData", *pMetaData);
-			pJournalEntry->writeSuccess();
-		}
-		return LIB3MF_SUCCESS;
-	}
-	catch (ELib3MFInterfaceException & Exception) {
-		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
-	}
-	catch (std::exception & StdException) {
-		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
-	}
-	catch (...) {
-		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
-	}
-}
-
-
-/*************************************************************************************************************************
- Class implementation for TriangleSet
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_triangleset_setname(Lib3MF_TriangleSet pTriangleSet, const char * pName)
-{
-	IBase* pIBaseClass = (IBase *)pTriangleSet;
-
-	PLib3MFInterfaceJournalEntry pJournalEntry;
-	try {
-		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "SetName");
-			pJournalEntry->addStringParameter("Name", pName);
-		}
-		if (pName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sName(pName);
-		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
-		if (!pITriangleSet)
+		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
+		if (!pIMetaData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pITriangleSet->SetName(sName);
+		pIMetaData->SetMustPreserve(bMustPreserve);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -2763,47 +2868,47 @@ Lib3MFResult lib3mf_triangleset_setname(Lib3MF_TriangleSet pTriangleSet, const c
 	}
 }
 
-Lib3MFResult lib3mf_triangleset_getname(Lib3MF_TriangleSet pTriangleSet, const Lib3MF_uint32 nNameBufferSize, Lib3MF_uint32* pNameNeededChars, char * pNameBuffer)
+Lib3MFResult lib3mf_metadata_gettype(Lib3MF_MetaData pMetaData, const Lib3MF_uint32 nTypeBufferSize, Lib3MF_uint32* pTypeNeededChars, char * pTypeBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pTriangleSet;
+	IBase* pIBaseClass = (IBase *)pMetaData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "GetName");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "GetType");
 		}
-		if ( (!pNameBuffer) && !(pNameNeededChars) )
+		if ( (!pTypeBuffer) && !(pTypeNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sName("");
-		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
-		if (!pITriangleSet)
+		std::string sType("");
+		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
+		if (!pIMetaData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pNameBuffer == nullptr);
+		bool isCacheCall = (pTypeBuffer == nullptr);
 		if (isCacheCall) {
-			sName = pITriangleSet->GetName();
+			sType = pIMetaData->GetType();
 
-			pITriangleSet->_setCache (new ParameterCache_1<std::string> (sName));
+			pIMetaData->_setCache (new ParameterCache_1<std::string> (sType));
 		}
 		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pITriangleSet->_getCache ());
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIMetaData->_getCache ());
 			if (cache == nullptr)
 				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sName);
-			pITriangleSet->_setCache (nullptr);
+			cache->retrieveData (sType);
+			pIMetaData->_setCache (nullptr);
 		}
 		
-		if (pNameNeededChars)
-			*pNameNeededChars = (Lib3MF_uint32) (sName.size()+1);
-		if (pNameBuffer) {
-			if (sName.size() >= nNameBufferSize)
+		if (pTypeNeededChars)
+			*pTypeNeededChars = (Lib3MF_uint32) (sType.size()+1);
+		if (pTypeBuffer) {
+			if (sType.size() >= nTypeBufferSize)
 				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iName = 0; iName < sName.size(); iName++)
-				pNameBuffer[iName] = sName[iName];
-			pNameBuffer[sName.size()] = 0;
+			for (size_t iType = 0; iType < sType.size(); iType++)
+				pTypeBuffer[iType] = sType[iType];
+			pTypeBuffer[sType.size()] = 0;
 		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Name", sName.c_str());
+			pJournalEntry->addStringResult("Type", sType.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2819,24 +2924,24 @@ Lib3MFResult lib3mf_triangleset_getname(Lib3MF_TriangleSet pTriangleSet, const L
 	}
 }
 
-Lib3MFResult lib3mf_triangleset_setidentifier(Lib3MF_TriangleSet pTriangleSet, const char * pIdentifier)
+Lib3MFResult lib3mf_metadata_settype(Lib3MF_MetaData pMetaData, const char * pType)
 {
-	IBase* pIBaseClass = (IBase *)pTriangleSet;
+	IBase* pIBaseClass = (IBase *)pMetaData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "SetIdentifier");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "SetType");
+			pJournalEntry->addStringParameter("Type", pType);
 		}
-		if (pIdentifier == nullptr)
+		if (pType == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
-		if (!pITriangleSet)
+		std::string sType(pType);
+		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
+		if (!pIMetaData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pITriangleSet->SetIdentifier(sIdentifier);
+		pIMetaData->SetType(sType);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -2854,47 +2959,47 @@ Lib3MFResult lib3mf_triangleset_setidentifier(Lib3MF_TriangleSet pTriangleSet, c
 	}
 }
 
-Lib3MFResult lib3mf_triangleset_getidentifier(Lib3MF_TriangleSet pTriangleSet, const Lib3MF_uint32 nIdentifierBufferSize, Lib3MF_uint32* pIdentifierNeededChars, char * pIdentifierBuffer)
+Lib3MFResult lib3mf_metadata_getvalue(Lib3MF_MetaData pMetaData, const Lib3MF_uint32 nValueBufferSize, Lib3MF_uint32* pValueNeededChars, char * pValueBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pTriangleSet;
+	IBase* pIBaseClass = (IBase *)pMetaData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "GetIdentifier");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "GetValue");
 		}
-		if ( (!pIdentifierBuffer) && !(pIdentifierNeededChars) )
+		if ( (!pValueBuffer) && !(pValueNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier("");
-		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
-		if (!pITriangleSet)
+		std::string sValue("");
+		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
+		if (!pIMetaData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pIdentifierBuffer == nullptr);
+		bool isCacheCall = (pValueBuffer == nullptr);
 		if (isCacheCall) {
-			sIdentifier = pITriangleSet->GetIdentifier();
+			sValue = pIMetaData->GetValue();
 
-			pITriangleSet->_setCache (new ParameterCache_1<std::string> (sIdentifier));
+			pIMetaData->_setCache (new ParameterCache_1<std::string> (sValue));
 		}
 		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pITriangleSet->_getCache ());
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIMetaData->_getCache ());
 			if (cache == nullptr)
 				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sIdentifier);
-			pITriangleSet->_setCache (nullptr);
+			cache->retrieveData (sValue);
+			pIMetaData->_setCache (nullptr);
 		}
 		
-		if (pIdentifierNeededChars)
-			*pIdentifierNeededChars = (Lib3MF_uint32) (sIdentifier.size()+1);
-		if (pIdentifierBuffer) {
-			if (sIdentifier.size() >= nIdentifierBufferSize)
+		if (pValueNeededChars)
+			*pValueNeededChars = (Lib3MF_uint32) (sValue.size()+1);
+		if (pValueBuffer) {
+			if (sValue.size() >= nValueBufferSize)
 				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iIdentifier = 0; iIdentifier < sIdentifier.size(); iIdentifier++)
-				pIdentifierBuffer[iIdentifier] = sIdentifier[iIdentifier];
-			pIdentifierBuffer[sIdentifier.size()] = 0;
+			for (size_t iValue = 0; iValue < sValue.size(); iValue++)
+				pValueBuffer[iValue] = sValue[iValue];
+			pValueBuffer[sValue.size()] = 0;
 		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Identifier", sIdentifier.c_str());
+			pJournalEntry->addStringResult("Value", sValue.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2910,21 +3015,24 @@ Lib3MFResult lib3mf_triangleset_getidentifier(Lib3MF_TriangleSet pTriangleSet, c
 	}
 }
 
-Lib3MFResult lib3mf_triangleset_addtriangle(Lib3MF_TriangleSet pTriangleSet, Lib3MF_uint32 nTriangleIndex)
+Lib3MFResult lib3mf_metadata_setvalue(Lib3MF_MetaData pMetaData, const char * pValue)
 {
-	IBase* pIBaseClass = (IBase *)pTriangleSet;
+	IBase* pIBaseClass = (IBase *)pMetaData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "AddTriangle");
-			pJournalEntry->addUInt32Parameter("TriangleIndex", nTriangleIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaData, "MetaData", "SetValue");
+			pJournalEntry->addStringParameter("Value", pValue);
 		}
-		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
-		if (!pITriangleSet)
+		if (pValue == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sValue(pValue);
+		IMetaData* pIMetaData = dynamic_cast<IMetaData*>(pIBaseClass);
+		if (!pIMetaData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pITriangleSet->AddTriangle(nTriangleIndex);
+		pIMetaData->SetValue(sValue);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -2942,23 +3050,29 @@ Lib3MFResult lib3mf_triangleset_addtriangle(Lib3MF_TriangleSet pTriangleSet, Lib
 	}
 }
 
-Lib3MFResult lib3mf_triangleset_removetriangle(Lib3MF_TriangleSet pTriangleSet, Lib3MF_uint32 nTriangleIndex)
+
+/*************************************************************************************************************************
+ Class implementation for MetaDataGroup
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_metadatagroup_getmetadatacount(Lib3MF_MetaDataGroup pMetaDataGroup, Lib3MF_uint32 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pTriangleSet;
+	IBase* pIBaseClass = (IBase *)pMetaDataGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "RemoveTriangle");
-			pJournalEntry->addUInt32Parameter("TriangleIndex", nTriangleIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaDataGroup, "MetaDataGroup", "GetMetaDataCount");
 		}
-		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
-		if (!pITriangleSet)
+		if (pCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IMetaDataGroup* pIMetaDataGroup = dynamic_cast<IMetaDataGroup*>(pIBaseClass);
+		if (!pIMetaDataGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pITriangleSet->RemoveTriangle(nTriangleIndex);
+		*pCount = pIMetaDataGroup->GetMetaDataCount();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -2974,22 +3088,28 @@ Lib3MFResult lib3mf_triangleset_removetriangle(Lib3MF_TriangleSet pTriangleSet,
 	}
 }
 
-Lib3MFResult lib3mf_triangleset_clear(Lib3MF_TriangleSet pTriangleSet)
+Lib3MFResult lib3mf_metadatagroup_getmetadata(Lib3MF_MetaDataGroup pMetaDataGroup, Lib3MF_uint32 nIndex, Lib3MF_MetaData * pMetaData)
 {
-	IBase* pIBaseClass = (IBase *)pTriangleSet;
+	IBase* pIBaseClass = (IBase *)pMetaDataGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "Clear");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaDataGroup, "MetaDataGroup", "GetMetaData");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
-		if (!pITriangleSet)
+		if (pMetaData == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseMetaData(nullptr);
+		IMetaDataGroup* pIMetaDataGroup = dynamic_cast<IMetaDataGroup*>(pIBaseClass);
+		if (!pIMetaDataGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pITriangleSet->Clear();
+		pBaseMetaData = pIMetaDataGroup->GetMetaData(nIndex);
 
+		*pMetaData = (IBase*)(pBaseMetaData);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("MetaData", *pMetaData);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3005,24 +3125,35 @@ Lib3MFResult lib3mf_triangleset_clear(Lib3MF_TriangleSet pTriangleSet)
 	}
 }
 
-Lib3MFResult lib3mf_triangleset_settrianglelist(Lib3MF_TriangleSet pTriangleSet, Lib3MF_uint64 nTriangleIndicesBufferSize, const Lib3MF_uint32 * pTriangleIndicesBuffer)
+Lib3MFResult lib3mf_metadatagroup_getmetadatabykey(Lib3MF_MetaDataGroup pMetaDataGroup, const char * pNameSpace, const char * pName, Lib3MF_MetaData * pMetaData)
 {
-	IBase* pIBaseClass = (IBase *)pTriangleSet;
+	IBase* pIBaseClass = (IBase *)pMetaDataGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "SetTriangleList");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaDataGroup, "MetaDataGroup", "GetMetaDataByKey");
+			pJournalEntry->addStringParameter("NameSpace", pNameSpace);
+			pJournalEntry->addStringParameter("Name", pName);
 		}
-		if ( (!pTriangleIndicesBuffer) && (nTriangleIndicesBufferSize>0))
+		if (pNameSpace == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
-		if (!pITriangleSet)
+		if (pName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pMetaData == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sNameSpace(pNameSpace);
+		std::string sName(pName);
+		IBase* pBaseMetaData(nullptr);
+		IMetaDataGroup* pIMetaDataGroup = dynamic_cast<IMetaDataGroup*>(pIBaseClass);
+		if (!pIMetaDataGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pITriangleSet->SetTriangleList(nTriangleIndicesBufferSize, pTriangleIndicesBuffer);
+		pBaseMetaData = pIMetaDataGroup->GetMetaDataByKey(sNameSpace, sName);
 
+		*pMetaData = (IBase*)(pBaseMetaData);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("MetaData", *pMetaData);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3038,22 +3169,21 @@ Lib3MFResult lib3mf_triangleset_settrianglelist(Lib3MF_TriangleSet pTriangleSet,
 	}
 }
 
-Lib3MFResult lib3mf_triangleset_gettrianglelist(Lib3MF_TriangleSet pTriangleSet, const Lib3MF_uint64 nTriangleIndicesBufferSize, Lib3MF_uint64* pTriangleIndicesNeededCount, Lib3MF_uint32 * pTriangleIndicesBuffer)
+Lib3MFResult lib3mf_metadatagroup_removemetadatabyindex(Lib3MF_MetaDataGroup pMetaDataGroup, Lib3MF_uint32 nIndex)
 {
-	IBase* pIBaseClass = (IBase *)pTriangleSet;
+	IBase* pIBaseClass = (IBase *)pMetaDataGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "GetTriangleList");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaDataGroup, "MetaDataGroup", "RemoveMetaDataByIndex");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		if ((!pTriangleIndicesBuffer) && !(pTriangleIndicesNeededCount))
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
-		if (!pITriangleSet)
+		IMetaDataGroup* pIMetaDataGroup = dynamic_cast<IMetaDataGroup*>(pIBaseClass);
+		if (!pIMetaDataGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pITriangleSet->GetTriangleList(nTriangleIndicesBufferSize, pTriangleIndicesNeededCount, pTriangleIndicesBuffer);
+		pIMetaDataGroup->RemoveMetaDataByIndex(nIndex);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -3071,24 +3201,81 @@ Lib3MFResult lib3mf_triangleset_gettrianglelist(Lib3MF_TriangleSet pTriangleSet,
 	}
 }
 
-Lib3MFResult lib3mf_triangleset_addtrianglelist(Lib3MF_TriangleSet pTriangleSet, Lib3MF_uint64 nTriangleIndicesBufferSize, const Lib3MF_uint32 * pTriangleIndicesBuffer)
+Lib3MFResult lib3mf_metadatagroup_removemetadata(Lib3MF_MetaDataGroup pMetaDataGroup, Lib3MF_MetaData pTheMetaData)
 {
-	IBase* pIBaseClass = (IBase *)pTriangleSet;
+	IBase* pIBaseClass = (IBase *)pMetaDataGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "AddTriangleList");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaDataGroup, "MetaDataGroup", "RemoveMetaData");
+			pJournalEntry->addHandleParameter("TheMetaData", pTheMetaData);
 		}
-		if ( (!pTriangleIndicesBuffer) && (nTriangleIndicesBufferSize>0))
+		IBase* pIBaseClassTheMetaData = (IBase *)pTheMetaData;
+		IMetaData* pITheMetaData = dynamic_cast<IMetaData*>(pIBaseClassTheMetaData);
+		if (!pITheMetaData)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
+		IMetaDataGroup* pIMetaDataGroup = dynamic_cast<IMetaDataGroup*>(pIBaseClass);
+		if (!pIMetaDataGroup)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIMetaDataGroup->RemoveMetaData(pITheMetaData);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_metadatagroup_addmetadata(Lib3MF_MetaDataGroup pMetaDataGroup, const char * pNameSpace, const char * pName, const char * pValue, const char * pType, bool bMustPreserve, Lib3MF_MetaData * pMetaData)
+{
+	IBase* pIBaseClass = (IBase *)pMetaDataGroup;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMetaDataGroup, "MetaDataGroup", "AddMetaData");
+			pJournalEntry->addStringParameter("NameSpace", pNameSpace);
+			pJournalEntry->addStringParameter("Name", pName);
+			pJournalEntry->addStringParameter("Value", pValue);
+			pJournalEntry->addStringParameter("Type", pType);
+			pJournalEntry->addBooleanParameter("MustPreserve", bMustPreserve);
+		}
+		if (pNameSpace == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
-		if (!pITriangleSet)
+		if (pName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pValue == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pType == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pMetaData == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sNameSpace(pNameSpace);
+		std::string sName(pName);
+		std::string sValue(pValue);
+		std::string sType(pType);
+		IBase* pBaseMetaData(nullptr);
+		IMetaDataGroup* pIMetaDataGroup = dynamic_cast<IMetaDataGroup*>(pIBaseClass);
+		if (!pIMetaDataGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pITriangleSet->AddTriangleList(nTriangleIndicesBufferSize, pTriangleIndicesBuffer);
+		pBaseMetaData = pIMetaDataGroup->AddMetaData(sNameSpace, sName, sValue, sType, bMustPreserve);
 
+		*pMetaData = (IBase*)(pBaseMetaData);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("MetaData", *pMetaData);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3104,27 +3291,28 @@ Lib3MFResult lib3mf_triangleset_addtrianglelist(Lib3MF_TriangleSet pTriangleSet,
 	}
 }
 
-Lib3MFResult lib3mf_triangleset_merge(Lib3MF_TriangleSet pTriangleSet, Lib3MF_TriangleSet pOtherTriangleSet, bool bDeleteOther)
+
+/*************************************************************************************************************************
+ Class implementation for TriangleSet
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_triangleset_setname(Lib3MF_TriangleSet pTriangleSet, const char * pName)
 {
 	IBase* pIBaseClass = (IBase *)pTriangleSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "Merge");
-			pJournalEntry->addHandleParameter("OtherTriangleSet", pOtherTriangleSet);
-			pJournalEntry->addBooleanParameter("DeleteOther", bDeleteOther);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "SetName");
+			pJournalEntry->addStringParameter("Name", pName);
 		}
-		IBase* pIBaseClassOtherTriangleSet = (IBase *)pOtherTriangleSet;
-		ITriangleSet* pIOtherTriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClassOtherTriangleSet);
-		if (!pIOtherTriangleSet)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
+		if (pName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sName(pName);
 		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
 		if (!pITriangleSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pITriangleSet->Merge(pIOtherTriangleSet, bDeleteOther);
+		pITriangleSet->SetName(sName);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -3142,22 +3330,47 @@ Lib3MFResult lib3mf_triangleset_merge(Lib3MF_TriangleSet pTriangleSet, Lib3MF_Tr
 	}
 }
 
-Lib3MFResult lib3mf_triangleset_deleteset(Lib3MF_TriangleSet pTriangleSet)
+Lib3MFResult lib3mf_triangleset_getname(Lib3MF_TriangleSet pTriangleSet, const Lib3MF_uint32 nNameBufferSize, Lib3MF_uint32* pNameNeededChars, char * pNameBuffer)
 {
 	IBase* pIBaseClass = (IBase *)pTriangleSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "DeleteSet");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "GetName");
 		}
+		if ( (!pNameBuffer) && !(pNameNeededChars) )
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sName("");
 		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
 		if (!pITriangleSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pITriangleSet->DeleteSet();
+		bool isCacheCall = (pNameBuffer == nullptr);
+		if (isCacheCall) {
+			sName = pITriangleSet->GetName();
 
+			pITriangleSet->_setCache (new ParameterCache_1<std::string> (sName));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pITriangleSet->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sName);
+			pITriangleSet->_setCache (nullptr);
+		}
+		
+		if (pNameNeededChars)
+			*pNameNeededChars = (Lib3MF_uint32) (sName.size()+1);
+		if (pNameBuffer) {
+			if (sName.size() >= nNameBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iName = 0; iName < sName.size(); iName++)
+				pNameBuffer[iName] = sName[iName];
+			pNameBuffer[sName.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addStringResult("Name", sName.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3173,31 +3386,26 @@ Lib3MFResult lib3mf_triangleset_deleteset(Lib3MF_TriangleSet pTriangleSet)
 	}
 }
 
-Lib3MFResult lib3mf_triangleset_duplicate(Lib3MF_TriangleSet pTriangleSet, const char * pIdentifier, Lib3MF_TriangleSet * pNewSet)
+Lib3MFResult lib3mf_triangleset_setidentifier(Lib3MF_TriangleSet pTriangleSet, const char * pIdentifier)
 {
 	IBase* pIBaseClass = (IBase *)pTriangleSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "Duplicate");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "SetIdentifier");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 		}
 		if (pIdentifier == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pNewSet == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		std::string sIdentifier(pIdentifier);
-		IBase* pBaseNewSet(nullptr);
 		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
 		if (!pITriangleSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNewSet = pITriangleSet->Duplicate(sIdentifier);
+		pITriangleSet->SetIdentifier(sIdentifier);
 
-		*pNewSet = (IBase*)(pBaseNewSet);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("NewSet", *pNewSet);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3213,29 +3421,47 @@ Lib3MFResult lib3mf_triangleset_duplicate(Lib3MF_TriangleSet pTriangleSet, const
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for Object
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_object_gettype(Lib3MF_Object pObject, eLib3MFObjectType * pObjectType)
+Lib3MFResult lib3mf_triangleset_getidentifier(Lib3MF_TriangleSet pTriangleSet, const Lib3MF_uint32 nIdentifierBufferSize, Lib3MF_uint32* pIdentifierNeededChars, char * pIdentifierBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pObject;
+	IBase* pIBaseClass = (IBase *)pTriangleSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "GetType");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "GetIdentifier");
 		}
-		if (pObjectType == nullptr)
+		if ( (!pIdentifierBuffer) && !(pIdentifierNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
-		if (!pIObject)
+		std::string sIdentifier("");
+		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
+		if (!pITriangleSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pObjectType = pIObject->GetType();
+		bool isCacheCall = (pIdentifierBuffer == nullptr);
+		if (isCacheCall) {
+			sIdentifier = pITriangleSet->GetIdentifier();
 
+			pITriangleSet->_setCache (new ParameterCache_1<std::string> (sIdentifier));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pITriangleSet->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sIdentifier);
+			pITriangleSet->_setCache (nullptr);
+		}
+		
+		if (pIdentifierNeededChars)
+			*pIdentifierNeededChars = (Lib3MF_uint32) (sIdentifier.size()+1);
+		if (pIdentifierBuffer) {
+			if (sIdentifier.size() >= nIdentifierBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iIdentifier = 0; iIdentifier < sIdentifier.size(); iIdentifier++)
+				pIdentifierBuffer[iIdentifier] = sIdentifier[iIdentifier];
+			pIdentifierBuffer[sIdentifier.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addEnumResult("ObjectType", "ObjectType", (Lib3MF_int32)(*pObjectType));
+			pJournalEntry->addStringResult("Identifier", sIdentifier.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3251,21 +3477,21 @@ Lib3MFResult lib3mf_object_gettype(Lib3MF_Object pObject, eLib3MFObjectType * pO
 	}
 }
 
-Lib3MFResult lib3mf_object_settype(Lib3MF_Object pObject, eLib3MFObjectType eObjectType)
+Lib3MFResult lib3mf_triangleset_addtriangle(Lib3MF_TriangleSet pTriangleSet, Lib3MF_uint32 nTriangleIndex)
 {
-	IBase* pIBaseClass = (IBase *)pObject;
+	IBase* pIBaseClass = (IBase *)pTriangleSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "SetType");
-			pJournalEntry->addEnumParameter("ObjectType", "ObjectType", (Lib3MF_int32)(eObjectType));
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "AddTriangle");
+			pJournalEntry->addUInt32Parameter("TriangleIndex", nTriangleIndex);
 		}
-		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
-		if (!pIObject)
+		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
+		if (!pITriangleSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIObject->SetType(eObjectType);
+		pITriangleSet->AddTriangle(nTriangleIndex);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -3283,47 +3509,23 @@ Lib3MFResult lib3mf_object_settype(Lib3MF_Object pObject, eLib3MFObjectType eObj
 	}
 }
 
-Lib3MFResult lib3mf_object_getname(Lib3MF_Object pObject, const Lib3MF_uint32 nNameBufferSize, Lib3MF_uint32* pNameNeededChars, char * pNameBuffer)
+Lib3MFResult lib3mf_triangleset_removetriangle(Lib3MF_TriangleSet pTriangleSet, Lib3MF_uint32 nTriangleIndex)
 {
-	IBase* pIBaseClass = (IBase *)pObject;
+	IBase* pIBaseClass = (IBase *)pTriangleSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "GetName");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "RemoveTriangle");
+			pJournalEntry->addUInt32Parameter("TriangleIndex", nTriangleIndex);
 		}
-		if ( (!pNameBuffer) && !(pNameNeededChars) )
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sName("");
-		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
-		if (!pIObject)
+		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
+		if (!pITriangleSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pNameBuffer == nullptr);
-		if (isCacheCall) {
-			sName = pIObject->GetName();
+		pITriangleSet->RemoveTriangle(nTriangleIndex);
 
-			pIObject->_setCache (new ParameterCache_1<std::string> (sName));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIObject->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sName);
-			pIObject->_setCache (nullptr);
-		}
-		
-		if (pNameNeededChars)
-			*pNameNeededChars = (Lib3MF_uint32) (sName.size()+1);
-		if (pNameBuffer) {
-			if (sName.size() >= nNameBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iName = 0; iName < sName.size(); iName++)
-				pNameBuffer[iName] = sName[iName];
-			pNameBuffer[sName.size()] = 0;
-		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Name", sName.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3339,24 +3541,20 @@ Lib3MFResult lib3mf_object_getname(Lib3MF_Object pObject, const Lib3MF_uint32 nN
 	}
 }
 
-Lib3MFResult lib3mf_object_setname(Lib3MF_Object pObject, const char * pName)
+Lib3MFResult lib3mf_triangleset_clear(Lib3MF_TriangleSet pTriangleSet)
 {
-	IBase* pIBaseClass = (IBase *)pObject;
+	IBase* pIBaseClass = (IBase *)pTriangleSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "SetName");
-			pJournalEntry->addStringParameter("Name", pName);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "Clear");
 		}
-		if (pName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sName(pName);
-		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
-		if (!pIObject)
+		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
+		if (!pITriangleSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIObject->SetName(sName);
+		pITriangleSet->Clear();
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -3374,47 +3572,24 @@ Lib3MFResult lib3mf_object_setname(Lib3MF_Object pObject, const char * pName)
 	}
 }
 
-Lib3MFResult lib3mf_object_getpartnumber(Lib3MF_Object pObject, const Lib3MF_uint32 nPartNumberBufferSize, Lib3MF_uint32* pPartNumberNeededChars, char * pPartNumberBuffer)
+Lib3MFResult lib3mf_triangleset_settrianglelist(Lib3MF_TriangleSet pTriangleSet, Lib3MF_uint64 nTriangleIndicesBufferSize, const Lib3MF_uint32 * pTriangleIndicesBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pObject;
+	IBase* pIBaseClass = (IBase *)pTriangleSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "GetPartNumber");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "SetTriangleList");
 		}
-		if ( (!pPartNumberBuffer) && !(pPartNumberNeededChars) )
+		if ( (!pTriangleIndicesBuffer) && (nTriangleIndicesBufferSize>0))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sPartNumber("");
-		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
-		if (!pIObject)
+		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
+		if (!pITriangleSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pPartNumberBuffer == nullptr);
-		if (isCacheCall) {
-			sPartNumber = pIObject->GetPartNumber();
+		pITriangleSet->SetTriangleList(nTriangleIndicesBufferSize, pTriangleIndicesBuffer);
 
-			pIObject->_setCache (new ParameterCache_1<std::string> (sPartNumber));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIObject->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sPartNumber);
-			pIObject->_setCache (nullptr);
-		}
-		
-		if (pPartNumberNeededChars)
-			*pPartNumberNeededChars = (Lib3MF_uint32) (sPartNumber.size()+1);
-		if (pPartNumberBuffer) {
-			if (sPartNumber.size() >= nPartNumberBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iPartNumber = 0; iPartNumber < sPartNumber.size(); iPartNumber++)
-				pPartNumberBuffer[iPartNumber] = sPartNumber[iPartNumber];
-			pPartNumberBuffer[sPartNumber.size()] = 0;
-		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("PartNumber", sPartNumber.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3430,24 +3605,22 @@ Lib3MFResult lib3mf_object_getpartnumber(Lib3MF_Object pObject, const Lib3MF_uin
 	}
 }
 
-Lib3MFResult lib3mf_object_setpartnumber(Lib3MF_Object pObject, const char * pPartNumber)
+Lib3MFResult lib3mf_triangleset_gettrianglelist(Lib3MF_TriangleSet pTriangleSet, const Lib3MF_uint64 nTriangleIndicesBufferSize, Lib3MF_uint64* pTriangleIndicesNeededCount, Lib3MF_uint32 * pTriangleIndicesBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pObject;
+	IBase* pIBaseClass = (IBase *)pTriangleSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "SetPartNumber");
-			pJournalEntry->addStringParameter("PartNumber", pPartNumber);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "GetTriangleList");
 		}
-		if (pPartNumber == nullptr)
+		if ((!pTriangleIndicesBuffer) && !(pTriangleIndicesNeededCount))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sPartNumber(pPartNumber);
-		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
-		if (!pIObject)
+		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
+		if (!pITriangleSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIObject->SetPartNumber(sPartNumber);
+		pITriangleSet->GetTriangleList(nTriangleIndicesBufferSize, pTriangleIndicesNeededCount, pTriangleIndicesBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -3465,25 +3638,24 @@ Lib3MFResult lib3mf_object_setpartnumber(Lib3MF_Object pObject, const char * pPa
 	}
 }
 
-Lib3MFResult lib3mf_object_ismeshobject(Lib3MF_Object pObject, bool * pIsMeshObject)
+Lib3MFResult lib3mf_triangleset_addtrianglelist(Lib3MF_TriangleSet pTriangleSet, Lib3MF_uint64 nTriangleIndicesBufferSize, const Lib3MF_uint32 * pTriangleIndicesBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pObject;
+	IBase* pIBaseClass = (IBase *)pTriangleSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "IsMeshObject");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "AddTriangleList");
 		}
-		if (pIsMeshObject == nullptr)
+		if ( (!pTriangleIndicesBuffer) && (nTriangleIndicesBufferSize>0))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
-		if (!pIObject)
+		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
+		if (!pITriangleSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pIsMeshObject = pIObject->IsMeshObject();
+		pITriangleSet->AddTriangleList(nTriangleIndicesBufferSize, pTriangleIndicesBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("IsMeshObject", *pIsMeshObject);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3499,25 +3671,29 @@ Lib3MFResult lib3mf_object_ismeshobject(Lib3MF_Object pObject, bool * pIsMeshObj
 	}
 }
 
-Lib3MFResult lib3mf_object_iscomponentsobject(Lib3MF_Object pObject, bool * pIsComponentsObject)
+Lib3MFResult lib3mf_triangleset_merge(Lib3MF_TriangleSet pTriangleSet, Lib3MF_TriangleSet pOtherTriangleSet, bool bDeleteOther)
 {
-	IBase* pIBaseClass = (IBase *)pObject;
+	IBase* pIBaseClass = (IBase *)pTriangleSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "IsComponentsObject");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "Merge");
+			pJournalEntry->addHandleParameter("OtherTriangleSet", pOtherTriangleSet);
+			pJournalEntry->addBooleanParameter("DeleteOther", bDeleteOther);
 		}
-		if (pIsComponentsObject == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
-		if (!pIObject)
+		IBase* pIBaseClassOtherTriangleSet = (IBase *)pOtherTriangleSet;
+		ITriangleSet* pIOtherTriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClassOtherTriangleSet);
+		if (!pIOtherTriangleSet)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
+		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
+		if (!pITriangleSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pIsComponentsObject = pIObject->IsComponentsObject();
+		pITriangleSet->Merge(pIOtherTriangleSet, bDeleteOther);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("IsComponentsObject", *pIsComponentsObject);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3533,25 +3709,22 @@ Lib3MFResult lib3mf_object_iscomponentsobject(Lib3MF_Object pObject, bool * pIsC
 	}
 }
 
-Lib3MFResult lib3mf_object_islevelsetobject(Lib3MF_Object pObject, bool * pIsLevelSetObject)
+Lib3MFResult lib3mf_triangleset_deleteset(Lib3MF_TriangleSet pTriangleSet)
 {
-	IBase* pIBaseClass = (IBase *)pObject;
+	IBase* pIBaseClass = (IBase *)pTriangleSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "IsLevelSetObject");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "DeleteSet");
 		}
-		if (pIsLevelSetObject == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
-		if (!pIObject)
+		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
+		if (!pITriangleSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pIsLevelSetObject = pIObject->IsLevelSetObject();
+		pITriangleSet->DeleteSet();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("IsLevelSetObject", *pIsLevelSetObject);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3567,25 +3740,31 @@ Lib3MFResult lib3mf_object_islevelsetobject(Lib3MF_Object pObject, bool * pIsLev
 	}
 }
 
-Lib3MFResult lib3mf_object_isvalid(Lib3MF_Object pObject, bool * pIsValid)
+Lib3MFResult lib3mf_triangleset_duplicate(Lib3MF_TriangleSet pTriangleSet, const char * pIdentifier, Lib3MF_TriangleSet * pNewSet)
 {
-	IBase* pIBaseClass = (IBase *)pObject;
+	IBase* pIBaseClass = (IBase *)pTriangleSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "IsValid");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTriangleSet, "TriangleSet", "Duplicate");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 		}
-		if (pIsValid == nullptr)
+		if (pIdentifier == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
-		if (!pIObject)
+		if (pNewSet == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		IBase* pBaseNewSet(nullptr);
+		ITriangleSet* pITriangleSet = dynamic_cast<ITriangleSet*>(pIBaseClass);
+		if (!pITriangleSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pIsValid = pIObject->IsValid();
+		pBaseNewSet = pITriangleSet->Duplicate(sIdentifier);
 
+		*pNewSet = (IBase*)(pBaseNewSet);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("IsValid", *pIsValid);
+			pJournalEntry->addHandleResult("NewSet", *pNewSet);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3601,28 +3780,29 @@ Lib3MFResult lib3mf_object_isvalid(Lib3MF_Object pObject, bool * pIsValid)
 	}
 }
 
-Lib3MFResult lib3mf_object_setattachmentasthumbnail(Lib3MF_Object pObject, Lib3MF_Attachment pAttachment)
+
+/*************************************************************************************************************************
+ Class implementation for Object
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_object_gettype(Lib3MF_Object pObject, eLib3MFObjectType * pObjectType)
 {
 	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "SetAttachmentAsThumbnail");
-			pJournalEntry->addHandleParameter("Attachment", pAttachment);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "GetType");
 		}
-		IBase* pIBaseClassAttachment = (IBase *)pAttachment;
-		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClassAttachment);
-		if (!pIAttachment)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
+		if (pObjectType == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
 		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIObject->SetAttachmentAsThumbnail(pIAttachment);
+		*pObjectType = pIObject->GetType();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addEnumResult("ObjectType", "ObjectType", (Lib3MF_int32)(*pObjectType));
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3638,27 +3818,23 @@ Lib3MFResult lib3mf_object_setattachmentasthumbnail(Lib3MF_Object pObject, Lib3M
 	}
 }
 
-Lib3MFResult lib3mf_object_getthumbnailattachment(Lib3MF_Object pObject, Lib3MF_Attachment * pAttachment)
+Lib3MFResult lib3mf_object_settype(Lib3MF_Object pObject, eLib3MFObjectType eObjectType)
 {
 	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "GetThumbnailAttachment");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "SetType");
+			pJournalEntry->addEnumParameter("ObjectType", "ObjectType", (Lib3MF_int32)(eObjectType));
 		}
-		if (pAttachment == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseAttachment(nullptr);
 		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
 		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseAttachment = pIObject->GetThumbnailAttachment();
+		pIObject->SetType(eObjectType);
 
-		*pAttachment = (IBase*)(pBaseAttachment);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Attachment", *pAttachment);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3674,22 +3850,47 @@ Lib3MFResult lib3mf_object_getthumbnailattachment(Lib3MF_Object pObject, Lib3MF_
 	}
 }
 
-Lib3MFResult lib3mf_object_clearthumbnailattachment(Lib3MF_Object pObject)
+Lib3MFResult lib3mf_object_getname(Lib3MF_Object pObject, const Lib3MF_uint32 nNameBufferSize, Lib3MF_uint32* pNameNeededChars, char * pNameBuffer)
 {
 	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "ClearThumbnailAttachment");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "GetName");
 		}
+		if ( (!pNameBuffer) && !(pNameNeededChars) )
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sName("");
 		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
 		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIObject->ClearThumbnailAttachment();
+		bool isCacheCall = (pNameBuffer == nullptr);
+		if (isCacheCall) {
+			sName = pIObject->GetName();
 
+			pIObject->_setCache (new ParameterCache_1<std::string> (sName));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIObject->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sName);
+			pIObject->_setCache (nullptr);
+		}
+		
+		if (pNameNeededChars)
+			*pNameNeededChars = (Lib3MF_uint32) (sName.size()+1);
+		if (pNameBuffer) {
+			if (sName.size() >= nNameBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iName = 0; iName < sName.size(); iName++)
+				pNameBuffer[iName] = sName[iName];
+			pNameBuffer[sName.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addStringResult("Name", sName.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3705,22 +3906,24 @@ Lib3MFResult lib3mf_object_clearthumbnailattachment(Lib3MF_Object pObject)
 	}
 }
 
-Lib3MFResult lib3mf_object_getoutbox(Lib3MF_Object pObject, sLib3MFBox * pOutbox)
+Lib3MFResult lib3mf_object_setname(Lib3MF_Object pObject, const char * pName)
 {
 	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "GetOutbox");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "SetName");
+			pJournalEntry->addStringParameter("Name", pName);
 		}
-		if (pOutbox == nullptr)
-		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sName(pName);
 		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
 		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pOutbox = pIObject->GetOutbox();
+		pIObject->SetName(sName);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -3738,50 +3941,47 @@ Lib3MFResult lib3mf_object_getoutbox(Lib3MF_Object pObject, sLib3MFBox * pOutbox
 	}
 }
 
-Lib3MFResult lib3mf_object_getuuid(Lib3MF_Object pObject, bool * pHasUUID, const Lib3MF_uint32 nUUIDBufferSize, Lib3MF_uint32* pUUIDNeededChars, char * pUUIDBuffer)
+Lib3MFResult lib3mf_object_getpartnumber(Lib3MF_Object pObject, const Lib3MF_uint32 nPartNumberBufferSize, Lib3MF_uint32* pPartNumberNeededChars, char * pPartNumberBuffer)
 {
 	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "GetUUID");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "GetPartNumber");
 		}
-		if (!pHasUUID)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if ( (!pUUIDBuffer) && !(pUUIDNeededChars) )
+		if ( (!pPartNumberBuffer) && !(pPartNumberNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sUUID("");
+		std::string sPartNumber("");
 		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
 		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pUUIDBuffer == nullptr);
+		bool isCacheCall = (pPartNumberBuffer == nullptr);
 		if (isCacheCall) {
-			sUUID = pIObject->GetUUID(*pHasUUID);
+			sPartNumber = pIObject->GetPartNumber();
 
-			pIObject->_setCache (new ParameterCache_2<bool, std::string> (*pHasUUID, sUUID));
+			pIObject->_setCache (new ParameterCache_1<std::string> (sPartNumber));
 		}
 		else {
-			auto cache = dynamic_cast<ParameterCache_2<bool, std::string>*> (pIObject->_getCache ());
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIObject->_getCache ());
 			if (cache == nullptr)
 				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (*pHasUUID, sUUID);
+			cache->retrieveData (sPartNumber);
 			pIObject->_setCache (nullptr);
 		}
 		
-		if (pUUIDNeededChars)
-			*pUUIDNeededChars = (Lib3MF_uint32) (sUUID.size()+1);
-		if (pUUIDBuffer) {
-			if (sUUID.size() >= nUUIDBufferSize)
+		if (pPartNumberNeededChars)
+			*pPartNumberNeededChars = (Lib3MF_uint32) (sPartNumber.size()+1);
+		if (pPartNumberBuffer) {
+			if (sPartNumber.size() >= nPartNumberBufferSize)
 				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iUUID = 0; iUUID < sUUID.size(); iUUID++)
-				pUUIDBuffer[iUUID] = sUUID[iUUID];
-			pUUIDBuffer[sUUID.size()] = 0;
+			for (size_t iPartNumber = 0; iPartNumber < sPartNumber.size(); iPartNumber++)
+				pPartNumberBuffer[iPartNumber] = sPartNumber[iPartNumber];
+			pPartNumberBuffer[sPartNumber.size()] = 0;
 		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("HasUUID", *pHasUUID);
-			pJournalEntry->addStringResult("UUID", sUUID.c_str());
+			pJournalEntry->addStringResult("PartNumber", sPartNumber.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3797,24 +3997,24 @@ Lib3MFResult lib3mf_object_getuuid(Lib3MF_Object pObject, bool * pHasUUID, const
 	}
 }
 
-Lib3MFResult lib3mf_object_setuuid(Lib3MF_Object pObject, const char * pUUID)
+Lib3MFResult lib3mf_object_setpartnumber(Lib3MF_Object pObject, const char * pPartNumber)
 {
 	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "SetUUID");
-			pJournalEntry->addStringParameter("UUID", pUUID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "SetPartNumber");
+			pJournalEntry->addStringParameter("PartNumber", pPartNumber);
 		}
-		if (pUUID == nullptr)
+		if (pPartNumber == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sUUID(pUUID);
+		std::string sPartNumber(pPartNumber);
 		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
 		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIObject->SetUUID(sUUID);
+		pIObject->SetPartNumber(sPartNumber);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -3832,27 +4032,25 @@ Lib3MFResult lib3mf_object_setuuid(Lib3MF_Object pObject, const char * pUUID)
 	}
 }
 
-Lib3MFResult lib3mf_object_getmetadatagroup(Lib3MF_Object pObject, Lib3MF_MetaDataGroup * pMetaDataGroup)
+Lib3MFResult lib3mf_object_ismeshobject(Lib3MF_Object pObject, bool * pIsMeshObject)
 {
 	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "GetMetaDataGroup");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "IsMeshObject");
 		}
-		if (pMetaDataGroup == nullptr)
+		if (pIsMeshObject == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseMetaDataGroup(nullptr);
 		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
 		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseMetaDataGroup = pIObject->GetMetaDataGroup();
+		*pIsMeshObject = pIObject->IsMeshObject();
 
-		*pMetaDataGroup = (IBase*)(pBaseMetaDataGroup);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("MetaDataGroup", *pMetaDataGroup);
+			pJournalEntry->addBooleanResult("IsMeshObject", *pIsMeshObject);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3868,23 +4066,25 @@ Lib3MFResult lib3mf_object_getmetadatagroup(Lib3MF_Object pObject, Lib3MF_MetaDa
 	}
 }
 
-Lib3MFResult lib3mf_object_setslicesmeshresolution(Lib3MF_Object pObject, eLib3MFSlicesMeshResolution eMeshResolution)
+Lib3MFResult lib3mf_object_iscomponentsobject(Lib3MF_Object pObject, bool * pIsComponentsObject)
 {
 	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "SetSlicesMeshResolution");
-			pJournalEntry->addEnumParameter("MeshResolution", "SlicesMeshResolution", (Lib3MF_int32)(eMeshResolution));
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "IsComponentsObject");
 		}
+		if (pIsComponentsObject == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
 		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIObject->SetSlicesMeshResolution(eMeshResolution);
+		*pIsComponentsObject = pIObject->IsComponentsObject();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addBooleanResult("IsComponentsObject", *pIsComponentsObject);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3900,25 +4100,25 @@ Lib3MFResult lib3mf_object_setslicesmeshresolution(Lib3MF_Object pObject, eLib3M
 	}
 }
 
-Lib3MFResult lib3mf_object_getslicesmeshresolution(Lib3MF_Object pObject, eLib3MFSlicesMeshResolution * pMeshResolution)
+Lib3MFResult lib3mf_object_islevelsetobject(Lib3MF_Object pObject, bool * pIsLevelSetObject)
 {
 	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "GetSlicesMeshResolution");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "IsLevelSetObject");
 		}
-		if (pMeshResolution == nullptr)
+		if (pIsLevelSetObject == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
 		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pMeshResolution = pIObject->GetSlicesMeshResolution();
+		*pIsLevelSetObject = pIObject->IsLevelSetObject();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addEnumResult("MeshResolution", "SlicesMeshResolution", (Lib3MF_int32)(*pMeshResolution));
+			pJournalEntry->addBooleanResult("IsLevelSetObject", *pIsLevelSetObject);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3934,26 +4134,25 @@ Lib3MFResult lib3mf_object_getslicesmeshresolution(Lib3MF_Object pObject, eLib3M
 	}
 }
 
-Lib3MFResult lib3mf_object_hasslices(Lib3MF_Object pObject, bool bRecursive, bool * pHasSlices)
+Lib3MFResult lib3mf_object_isvalid(Lib3MF_Object pObject, bool * pIsValid)
 {
 	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "HasSlices");
-			pJournalEntry->addBooleanParameter("Recursive", bRecursive);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "IsValid");
 		}
-		if (pHasSlices == nullptr)
+		if (pIsValid == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
 		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pHasSlices = pIObject->HasSlices(bRecursive);
+		*pIsValid = pIObject->IsValid();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("HasSlices", *pHasSlices);
+			pJournalEntry->addBooleanResult("IsValid", *pIsValid);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -3969,20 +4168,26 @@ Lib3MFResult lib3mf_object_hasslices(Lib3MF_Object pObject, bool bRecursive, boo
 	}
 }
 
-Lib3MFResult lib3mf_object_clearslicestack(Lib3MF_Object pObject)
+Lib3MFResult lib3mf_object_setattachmentasthumbnail(Lib3MF_Object pObject, Lib3MF_Attachment pAttachment)
 {
 	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "ClearSliceStack");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "SetAttachmentAsThumbnail");
+			pJournalEntry->addHandleParameter("Attachment", pAttachment);
 		}
+		IBase* pIBaseClassAttachment = (IBase *)pAttachment;
+		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClassAttachment);
+		if (!pIAttachment)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
 		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
 		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIObject->ClearSliceStack();
+		pIObject->SetAttachmentAsThumbnail(pIAttachment);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -4000,27 +4205,27 @@ Lib3MFResult lib3mf_object_clearslicestack(Lib3MF_Object pObject)
 	}
 }
 
-Lib3MFResult lib3mf_object_getslicestack(Lib3MF_Object pObject, Lib3MF_SliceStack * pSliceStackInstance)
+Lib3MFResult lib3mf_object_getthumbnailattachment(Lib3MF_Object pObject, Lib3MF_Attachment * pAttachment)
 {
 	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "GetSliceStack");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "GetThumbnailAttachment");
 		}
-		if (pSliceStackInstance == nullptr)
+		if (pAttachment == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseSliceStackInstance(nullptr);
+		IBase* pBaseAttachment(nullptr);
 		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
 		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseSliceStackInstance = pIObject->GetSliceStack();
+		pBaseAttachment = pIObject->GetThumbnailAttachment();
 
-		*pSliceStackInstance = (IBase*)(pBaseSliceStackInstance);
+		*pAttachment = (IBase*)(pBaseAttachment);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("SliceStackInstance", *pSliceStackInstance);
+			pJournalEntry->addHandleResult("Attachment", *pAttachment);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4036,26 +4241,20 @@ Lib3MFResult lib3mf_object_getslicestack(Lib3MF_Object pObject, Lib3MF_SliceStac
 	}
 }
 
-Lib3MFResult lib3mf_object_assignslicestack(Lib3MF_Object pObject, Lib3MF_SliceStack pSliceStackInstance)
+Lib3MFResult lib3mf_object_clearthumbnailattachment(Lib3MF_Object pObject)
 {
 	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "AssignSliceStack");
-			pJournalEntry->addHandleParameter("SliceStackInstance", pSliceStackInstance);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "ClearThumbnailAttachment");
 		}
-		IBase* pIBaseClassSliceStackInstance = (IBase *)pSliceStackInstance;
-		ISliceStack* pISliceStackInstance = dynamic_cast<ISliceStack*>(pIBaseClassSliceStackInstance);
-		if (!pISliceStackInstance)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
 		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
 		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIObject->AssignSliceStack(pISliceStackInstance);
+		pIObject->ClearThumbnailAttachment();
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -4073,29 +4272,24 @@ Lib3MFResult lib3mf_object_assignslicestack(Lib3MF_Object pObject, Lib3MF_SliceS
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for MeshObject
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_meshobject_getvertexcount(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 * pVertexCount)
+Lib3MFResult lib3mf_object_getoutbox(Lib3MF_Object pObject, sLib3MFBox * pOutbox)
 {
-	IBase* pIBaseClass = (IBase *)pMeshObject;
+	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetVertexCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "GetOutbox");
 		}
-		if (pVertexCount == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
-		if (!pIMeshObject)
+		if (pOutbox == nullptr)
+		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
+		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pVertexCount = pIMeshObject->GetVertexCount();
+		*pOutbox = pIObject->GetOutbox();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("VertexCount", *pVertexCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4111,25 +4305,50 @@ Lib3MFResult lib3mf_meshobject_getvertexcount(Lib3MF_MeshObject pMeshObject, Lib
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_gettrianglecount(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 * pVertexCount)
+Lib3MFResult lib3mf_object_getuuid(Lib3MF_Object pObject, bool * pHasUUID, const Lib3MF_uint32 nUUIDBufferSize, Lib3MF_uint32* pUUIDNeededChars, char * pUUIDBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pMeshObject;
+	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetTriangleCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "GetUUID");
 		}
-		if (pVertexCount == nullptr)
+		if (!pHasUUID)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
-		if (!pIMeshObject)
+		if ( (!pUUIDBuffer) && !(pUUIDNeededChars) )
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sUUID("");
+		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
+		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pVertexCount = pIMeshObject->GetTriangleCount();
+		bool isCacheCall = (pUUIDBuffer == nullptr);
+		if (isCacheCall) {
+			sUUID = pIObject->GetUUID(*pHasUUID);
 
+			pIObject->_setCache (new ParameterCache_2<bool, std::string> (*pHasUUID, sUUID));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_2<bool, std::string>*> (pIObject->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (*pHasUUID, sUUID);
+			pIObject->_setCache (nullptr);
+		}
+		
+		if (pUUIDNeededChars)
+			*pUUIDNeededChars = (Lib3MF_uint32) (sUUID.size()+1);
+		if (pUUIDBuffer) {
+			if (sUUID.size() >= nUUIDBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iUUID = 0; iUUID < sUUID.size(); iUUID++)
+				pUUIDBuffer[iUUID] = sUUID[iUUID];
+			pUUIDBuffer[sUUID.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("VertexCount", *pVertexCount);
+			pJournalEntry->addBooleanResult("HasUUID", *pHasUUID);
+			pJournalEntry->addStringResult("UUID", sUUID.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4145,23 +4364,24 @@ Lib3MFResult lib3mf_meshobject_gettrianglecount(Lib3MF_MeshObject pMeshObject, L
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_getvertex(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nIndex, sLib3MFPosition * pCoordinates)
+Lib3MFResult lib3mf_object_setuuid(Lib3MF_Object pObject, const char * pUUID)
 {
-	IBase* pIBaseClass = (IBase *)pMeshObject;
+	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetVertex");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "SetUUID");
+			pJournalEntry->addStringParameter("UUID", pUUID);
 		}
-		if (pCoordinates == nullptr)
-		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
-		if (!pIMeshObject)
+		if (pUUID == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sUUID(pUUID);
+		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
+		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCoordinates = pIMeshObject->GetVertex(nIndex);
+		pIObject->SetUUID(sUUID);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -4179,23 +4399,27 @@ Lib3MFResult lib3mf_meshobject_getvertex(Lib3MF_MeshObject pMeshObject, Lib3MF_u
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_setvertex(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nIndex, const sLib3MFPosition * pCoordinates)
+Lib3MFResult lib3mf_object_getmetadatagroup(Lib3MF_Object pObject, Lib3MF_MetaDataGroup * pMetaDataGroup)
 {
-	IBase* pIBaseClass = (IBase *)pMeshObject;
+	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "SetVertex");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "GetMetaDataGroup");
 		}
-		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
-		if (!pIMeshObject)
+		if (pMetaDataGroup == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseMetaDataGroup(nullptr);
+		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
+		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMeshObject->SetVertex(nIndex, *pCoordinates);
+		pBaseMetaDataGroup = pIObject->GetMetaDataGroup();
 
+		*pMetaDataGroup = (IBase*)(pBaseMetaDataGroup);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("MetaDataGroup", *pMetaDataGroup);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4211,25 +4435,23 @@ Lib3MFResult lib3mf_meshobject_setvertex(Lib3MF_MeshObject pMeshObject, Lib3MF_u
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_addvertex(Lib3MF_MeshObject pMeshObject, const sLib3MFPosition * pCoordinates, Lib3MF_uint32 * pNewIndex)
+Lib3MFResult lib3mf_object_setslicesmeshresolution(Lib3MF_Object pObject, eLib3MFSlicesMeshResolution eMeshResolution)
 {
-	IBase* pIBaseClass = (IBase *)pMeshObject;
+	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "AddVertex");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "SetSlicesMeshResolution");
+			pJournalEntry->addEnumParameter("MeshResolution", "SlicesMeshResolution", (Lib3MF_int32)(eMeshResolution));
 		}
-		if (pNewIndex == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
-		if (!pIMeshObject)
+		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
+		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pNewIndex = pIMeshObject->AddVertex(*pCoordinates);
+		pIObject->SetSlicesMeshResolution(eMeshResolution);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("NewIndex", *pNewIndex);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4245,24 +4467,25 @@ Lib3MFResult lib3mf_meshobject_addvertex(Lib3MF_MeshObject pMeshObject, const sL
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_getvertices(Lib3MF_MeshObject pMeshObject, const Lib3MF_uint64 nVerticesBufferSize, Lib3MF_uint64* pVerticesNeededCount, sLib3MFPosition * pVerticesBuffer)
+Lib3MFResult lib3mf_object_getslicesmeshresolution(Lib3MF_Object pObject, eLib3MFSlicesMeshResolution * pMeshResolution)
 {
-	IBase* pIBaseClass = (IBase *)pMeshObject;
+	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetVertices");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "GetSlicesMeshResolution");
 		}
-		if ((!pVerticesBuffer) && !(pVerticesNeededCount))
+		if (pMeshResolution == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
-		if (!pIMeshObject)
+		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
+		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMeshObject->GetVertices(nVerticesBufferSize, pVerticesNeededCount, pVerticesBuffer);
+		*pMeshResolution = pIObject->GetSlicesMeshResolution();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addEnumResult("MeshResolution", "SlicesMeshResolution", (Lib3MF_int32)(*pMeshResolution));
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4278,25 +4501,26 @@ Lib3MFResult lib3mf_meshobject_getvertices(Lib3MF_MeshObject pMeshObject, const
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_gettriangle(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nIndex, sLib3MFTriangle * pIndices)
+Lib3MFResult lib3mf_object_hasslices(Lib3MF_Object pObject, bool bRecursive, bool * pHasSlices)
 {
-	IBase* pIBaseClass = (IBase *)pMeshObject;
+	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetTriangle");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "HasSlices");
+			pJournalEntry->addBooleanParameter("Recursive", bRecursive);
 		}
-		if (pIndices == nullptr)
-		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
-		if (!pIMeshObject)
+		if (pHasSlices == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
+		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pIndices = pIMeshObject->GetTriangle(nIndex);
+		*pHasSlices = pIObject->HasSlices(bRecursive);
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addBooleanResult("HasSlices", *pHasSlices);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4312,21 +4536,20 @@ Lib3MFResult lib3mf_meshobject_gettriangle(Lib3MF_MeshObject pMeshObject, Lib3MF
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_settriangle(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nIndex, const sLib3MFTriangle * pIndices)
+Lib3MFResult lib3mf_object_clearslicestack(Lib3MF_Object pObject)
 {
-	IBase* pIBaseClass = (IBase *)pMeshObject;
+	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "SetTriangle");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "ClearSliceStack");
 		}
-		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
-		if (!pIMeshObject)
+		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
+		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMeshObject->SetTriangle(nIndex, *pIndices);
+		pIObject->ClearSliceStack();
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -4344,25 +4567,27 @@ Lib3MFResult lib3mf_meshobject_settriangle(Lib3MF_MeshObject pMeshObject, Lib3MF
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_addtriangle(Lib3MF_MeshObject pMeshObject, const sLib3MFTriangle * pIndices, Lib3MF_uint32 * pNewIndex)
+Lib3MFResult lib3mf_object_getslicestack(Lib3MF_Object pObject, Lib3MF_SliceStack * pSliceStackInstance)
 {
-	IBase* pIBaseClass = (IBase *)pMeshObject;
+	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "AddTriangle");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "GetSliceStack");
 		}
-		if (pNewIndex == nullptr)
+		if (pSliceStackInstance == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
-		if (!pIMeshObject)
+		IBase* pBaseSliceStackInstance(nullptr);
+		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
+		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pNewIndex = pIMeshObject->AddTriangle(*pIndices);
+		pBaseSliceStackInstance = pIObject->GetSliceStack();
 
+		*pSliceStackInstance = (IBase*)(pBaseSliceStackInstance);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("NewIndex", *pNewIndex);
+			pJournalEntry->addHandleResult("SliceStackInstance", *pSliceStackInstance);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4378,22 +4603,26 @@ Lib3MFResult lib3mf_meshobject_addtriangle(Lib3MF_MeshObject pMeshObject, const
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_gettriangleindices(Lib3MF_MeshObject pMeshObject, const Lib3MF_uint64 nIndicesBufferSize, Lib3MF_uint64* pIndicesNeededCount, sLib3MFTriangle * pIndicesBuffer)
+Lib3MFResult lib3mf_object_assignslicestack(Lib3MF_Object pObject, Lib3MF_SliceStack pSliceStackInstance)
 {
-	IBase* pIBaseClass = (IBase *)pMeshObject;
+	IBase* pIBaseClass = (IBase *)pObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetTriangleIndices");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pObject, "Object", "AssignSliceStack");
+			pJournalEntry->addHandleParameter("SliceStackInstance", pSliceStackInstance);
 		}
-		if ((!pIndicesBuffer) && !(pIndicesNeededCount))
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
-		if (!pIMeshObject)
+		IBase* pIBaseClassSliceStackInstance = (IBase *)pSliceStackInstance;
+		ISliceStack* pISliceStackInstance = dynamic_cast<ISliceStack*>(pIBaseClassSliceStackInstance);
+		if (!pISliceStackInstance)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
+		IObject* pIObject = dynamic_cast<IObject*>(pIBaseClass);
+		if (!pIObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMeshObject->GetTriangleIndices(nIndicesBufferSize, pIndicesNeededCount, pIndicesBuffer);
+		pIObject->AssignSliceStack(pISliceStackInstance);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -4411,24 +4640,29 @@ Lib3MFResult lib3mf_meshobject_gettriangleindices(Lib3MF_MeshObject pMeshObject,
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_setobjectlevelproperty(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nUniqueResourceID, Lib3MF_uint32 nPropertyID)
+
+/*************************************************************************************************************************
+ Class implementation for MeshObject
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_meshobject_getvertexcount(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 * pVertexCount)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "SetObjectLevelProperty");
-			pJournalEntry->addUInt32Parameter("UniqueResourceID", nUniqueResourceID);
-			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetVertexCount");
 		}
+		if (pVertexCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMeshObject->SetObjectLevelProperty(nUniqueResourceID, nPropertyID);
+		*pVertexCount = pIMeshObject->GetVertexCount();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("VertexCount", *pVertexCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4444,31 +4678,25 @@ Lib3MFResult lib3mf_meshobject_setobjectlevelproperty(Lib3MF_MeshObject pMeshObj
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_getobjectlevelproperty(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 * pUniqueResourceID, Lib3MF_uint32 * pPropertyID, bool * pHasObjectLevelProperty)
+Lib3MFResult lib3mf_meshobject_gettrianglecount(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 * pVertexCount)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetObjectLevelProperty");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetTriangleCount");
 		}
-		if (!pUniqueResourceID)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (!pPropertyID)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pHasObjectLevelProperty == nullptr)
+		if (pVertexCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pHasObjectLevelProperty = pIMeshObject->GetObjectLevelProperty(*pUniqueResourceID, *pPropertyID);
+		*pVertexCount = pIMeshObject->GetTriangleCount();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("UniqueResourceID", *pUniqueResourceID);
-			pJournalEntry->addUInt32Result("PropertyID", *pPropertyID);
-			pJournalEntry->addBooleanResult("HasObjectLevelProperty", *pHasObjectLevelProperty);
+			pJournalEntry->addUInt32Result("VertexCount", *pVertexCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4484,21 +4712,23 @@ Lib3MFResult lib3mf_meshobject_getobjectlevelproperty(Lib3MF_MeshObject pMeshObj
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_settriangleproperties(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nIndex, const sLib3MFTriangleProperties * pProperties)
+Lib3MFResult lib3mf_meshobject_getvertex(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nIndex, sLib3MFPosition * pCoordinates)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "SetTriangleProperties");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetVertex");
 			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
+		if (pCoordinates == nullptr)
+		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMeshObject->SetTriangleProperties(nIndex, *pProperties);
+		*pCoordinates = pIMeshObject->GetVertex(nIndex);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -4516,23 +4746,21 @@ Lib3MFResult lib3mf_meshobject_settriangleproperties(Lib3MF_MeshObject pMeshObje
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_gettriangleproperties(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nIndex, sLib3MFTriangleProperties * pProperty)
+Lib3MFResult lib3mf_meshobject_setvertex(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nIndex, const sLib3MFPosition * pCoordinates)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetTriangleProperties");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "SetVertex");
 			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		if (!pProperty)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMeshObject->GetTriangleProperties(nIndex, *pProperty);
+		pIMeshObject->SetVertex(nIndex, *pCoordinates);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -4550,24 +4778,25 @@ Lib3MFResult lib3mf_meshobject_gettriangleproperties(Lib3MF_MeshObject pMeshObje
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_setalltriangleproperties(Lib3MF_MeshObject pMeshObject, Lib3MF_uint64 nPropertiesArrayBufferSize, const sLib3MFTriangleProperties * pPropertiesArrayBuffer)
+Lib3MFResult lib3mf_meshobject_addvertex(Lib3MF_MeshObject pMeshObject, const sLib3MFPosition * pCoordinates, Lib3MF_uint32 * pNewIndex)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "SetAllTriangleProperties");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "AddVertex");
 		}
-		if ( (!pPropertiesArrayBuffer) && (nPropertiesArrayBufferSize>0))
+		if (pNewIndex == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMeshObject->SetAllTriangleProperties(nPropertiesArrayBufferSize, pPropertiesArrayBuffer);
+		*pNewIndex = pIMeshObject->AddVertex(*pCoordinates);
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("NewIndex", *pNewIndex);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4583,22 +4812,22 @@ Lib3MFResult lib3mf_meshobject_setalltriangleproperties(Lib3MF_MeshObject pMeshO
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_getalltriangleproperties(Lib3MF_MeshObject pMeshObject, const Lib3MF_uint64 nPropertiesArrayBufferSize, Lib3MF_uint64* pPropertiesArrayNeededCount, sLib3MFTriangleProperties * pPropertiesArrayBuffer)
+Lib3MFResult lib3mf_meshobject_getvertices(Lib3MF_MeshObject pMeshObject, const Lib3MF_uint64 nVerticesBufferSize, Lib3MF_uint64* pVerticesNeededCount, sLib3MFPosition * pVerticesBuffer)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetAllTriangleProperties");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetVertices");
 		}
-		if ((!pPropertiesArrayBuffer) && !(pPropertiesArrayNeededCount))
+		if ((!pVerticesBuffer) && !(pVerticesNeededCount))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMeshObject->GetAllTriangleProperties(nPropertiesArrayBufferSize, pPropertiesArrayNeededCount, pPropertiesArrayBuffer);
+		pIMeshObject->GetVertices(nVerticesBufferSize, pVerticesNeededCount, pVerticesBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -4616,22 +4845,25 @@ Lib3MFResult lib3mf_meshobject_getalltriangleproperties(Lib3MF_MeshObject pMeshO
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_clearallproperties(Lib3MF_MeshObject pMeshObject)
+Lib3MFResult lib3mf_meshobject_getvertexpagecount(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 * pPageCount)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "ClearAllProperties");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetVertexPageCount");
 		}
+		if (pPageCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMeshObject->ClearAllProperties();
+		*pPageCount = pIMeshObject->GetVertexPageCount();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("PageCount", *pPageCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4647,26 +4879,32 @@ Lib3MFResult lib3mf_meshobject_clearallproperties(Lib3MF_MeshObject pMeshObject)
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_setgeometry(Lib3MF_MeshObject pMeshObject, Lib3MF_uint64 nVerticesBufferSize, const sLib3MFPosition * pVerticesBuffer, Lib3MF_uint64 nIndicesBufferSize, const sLib3MFTriangle * pIndicesBuffer)
+Lib3MFResult lib3mf_meshobject_getvertexpage(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nPageIndex, Lib3MF_uint32 * pVertexCount, Lib3MF_uint32 * pStride, Lib3MF_pvoid * pCoordinates)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "SetGeometry");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetVertexPage");
+			pJournalEntry->addUInt32Parameter("PageIndex", nPageIndex);
 		}
-		if ( (!pVerticesBuffer) && (nVerticesBufferSize>0))
+		if (!pVertexCount)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if ( (!pIndicesBuffer) && (nIndicesBufferSize>0))
+		if (!pStride)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pCoordinates == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMeshObject->SetGeometry(nVerticesBufferSize, pVerticesBuffer, nIndicesBufferSize, pIndicesBuffer);
+		*pCoordinates = pIMeshObject->GetVertexPage(nPageIndex, *pVertexCount, *pStride);
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("VertexCount", *pVertexCount);
+			pJournalEntry->addUInt32Result("Stride", *pStride);
+			pJournalEntry->addPointerResult("Coordinates", *pCoordinates);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4682,25 +4920,25 @@ Lib3MFResult lib3mf_meshobject_setgeometry(Lib3MF_MeshObject pMeshObject, Lib3MF
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_ismanifoldandoriented(Lib3MF_MeshObject pMeshObject, bool * pIsManifoldAndOriented)
+Lib3MFResult lib3mf_meshobject_gettriangle(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nIndex, sLib3MFTriangle * pIndices)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "IsManifoldAndOriented");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetTriangle");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		if (pIsManifoldAndOriented == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pIndices == nullptr)
+		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pIsManifoldAndOriented = pIMeshObject->IsManifoldAndOriented();
+		*pIndices = pIMeshObject->GetTriangle(nIndex);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("IsManifoldAndOriented", *pIsManifoldAndOriented);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4716,27 +4954,23 @@ Lib3MFResult lib3mf_meshobject_ismanifoldandoriented(Lib3MF_MeshObject pMeshObje
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_beamlattice(Lib3MF_MeshObject pMeshObject, Lib3MF_BeamLattice * pTheBeamLattice)
+Lib3MFResult lib3mf_meshobject_settriangle(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nIndex, const sLib3MFTriangle * pIndices)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "BeamLattice");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "SetTriangle");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		if (pTheBeamLattice == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseTheBeamLattice(nullptr);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseTheBeamLattice = pIMeshObject->BeamLattice();
+		pIMeshObject->SetTriangle(nIndex, *pIndices);
 
-		*pTheBeamLattice = (IBase*)(pBaseTheBeamLattice);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("TheBeamLattice", *pTheBeamLattice);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4752,27 +4986,25 @@ Lib3MFResult lib3mf_meshobject_beamlattice(Lib3MF_MeshObject pMeshObject, Lib3MF
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_getvolumedata(Lib3MF_MeshObject pMeshObject, Lib3MF_VolumeData * pTheVolumeData)
+Lib3MFResult lib3mf_meshobject_addtriangle(Lib3MF_MeshObject pMeshObject, const sLib3MFTriangle * pIndices, Lib3MF_uint32 * pNewIndex)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetVolumeData");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "AddTriangle");
 		}
-		if (pTheVolumeData == nullptr)
+		if (pNewIndex == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseTheVolumeData(nullptr);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseTheVolumeData = pIMeshObject->GetVolumeData();
+		*pNewIndex = pIMeshObject->AddTriangle(*pIndices);
 
-		*pTheVolumeData = (IBase*)(pBaseTheVolumeData);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("TheVolumeData", *pTheVolumeData);
+			pJournalEntry->addUInt32Result("NewIndex", *pNewIndex);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4788,26 +5020,22 @@ Lib3MFResult lib3mf_meshobject_getvolumedata(Lib3MF_MeshObject pMeshObject, Lib3
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_setvolumedata(Lib3MF_MeshObject pMeshObject, Lib3MF_VolumeData pTheVolumeData)
+Lib3MFResult lib3mf_meshobject_gettriangleindices(Lib3MF_MeshObject pMeshObject, const Lib3MF_uint64 nIndicesBufferSize, Lib3MF_uint64* pIndicesNeededCount, sLib3MFTriangle * pIndicesBuffer)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "SetVolumeData");
-			pJournalEntry->addHandleParameter("TheVolumeData", pTheVolumeData);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetTriangleIndices");
 		}
-		IBase* pIBaseClassTheVolumeData = (IBase *)pTheVolumeData;
-		IVolumeData* pITheVolumeData = dynamic_cast<IVolumeData*>(pIBaseClassTheVolumeData);
-		if (!pITheVolumeData)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
+		if ((!pIndicesBuffer) && !(pIndicesNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMeshObject->SetVolumeData(pITheVolumeData);
+		pIMeshObject->GetTriangleIndices(nIndicesBufferSize, pIndicesNeededCount, pIndicesBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -4825,35 +5053,25 @@ Lib3MFResult lib3mf_meshobject_setvolumedata(Lib3MF_MeshObject pMeshObject, Lib3
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_addtriangleset(Lib3MF_MeshObject pMeshObject, const char * pIdentifier, const char * pName, Lib3MF_TriangleSet * pTheTriangleSet)
+Lib3MFResult lib3mf_meshobject_gettrianglepagecount(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 * pPageCount)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "AddTriangleSet");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addStringParameter("Name", pName);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetTrianglePageCount");
 		}
-		if (pIdentifier == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pTheTriangleSet == nullptr)
+		if (pPageCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		std::string sName(pName);
-		IBase* pBaseTheTriangleSet(nullptr);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseTheTriangleSet = pIMeshObject->AddTriangleSet(sIdentifier, sName);
+		*pPageCount = pIMeshObject->GetTrianglePageCount();
 
-		*pTheTriangleSet = (IBase*)(pBaseTheTriangleSet);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("TheTriangleSet", *pTheTriangleSet);
+			pJournalEntry->addUInt32Result("PageCount", *pPageCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4869,29 +5087,32 @@ Lib3MFResult lib3mf_meshobject_addtriangleset(Lib3MF_MeshObject pMeshObject, con
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_hastriangleset(Lib3MF_MeshObject pMeshObject, const char * pIdentifier, bool * pTriangleSetExists)
+Lib3MFResult lib3mf_meshobject_gettrianglepage(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nPageIndex, Lib3MF_uint32 * pTriangleCount, Lib3MF_uint32 * pStride, Lib3MF_pvoid * pIndices)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "HasTriangleSet");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetTrianglePage");
+			pJournalEntry->addUInt32Parameter("PageIndex", nPageIndex);
 		}
-		if (pIdentifier == nullptr)
+		if (!pTriangleCount)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pTriangleSetExists == nullptr)
+		if (!pStride)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pIndices == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pTriangleSetExists = pIMeshObject->HasTriangleSet(sIdentifier);
+		*pIndices = pIMeshObject->GetTrianglePage(nPageIndex, *pTriangleCount, *pStride);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("TriangleSetExists", *pTriangleSetExists);
+			pJournalEntry->addUInt32Result("TriangleCount", *pTriangleCount);
+			pJournalEntry->addUInt32Result("Stride", *pStride);
+			pJournalEntry->addPointerResult("Indices", *pIndices);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4907,31 +5128,24 @@ Lib3MFResult lib3mf_meshobject_hastriangleset(Lib3MF_MeshObject pMeshObject, con
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_findtriangleset(Lib3MF_MeshObject pMeshObject, const char * pIdentifier, Lib3MF_TriangleSet * pTheTriangleSet)
+Lib3MFResult lib3mf_meshobject_setobjectlevelproperty(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nUniqueResourceID, Lib3MF_uint32 nPropertyID)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "FindTriangleSet");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "SetObjectLevelProperty");
+			pJournalEntry->addUInt32Parameter("UniqueResourceID", nUniqueResourceID);
+			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
 		}
-		if (pIdentifier == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pTheTriangleSet == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		IBase* pBaseTheTriangleSet(nullptr);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseTheTriangleSet = pIMeshObject->FindTriangleSet(sIdentifier);
+		pIMeshObject->SetObjectLevelProperty(nUniqueResourceID, nPropertyID);
 
-		*pTheTriangleSet = (IBase*)(pBaseTheTriangleSet);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("TheTriangleSet", *pTheTriangleSet);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4947,25 +5161,31 @@ Lib3MFResult lib3mf_meshobject_findtriangleset(Lib3MF_MeshObject pMeshObject, co
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_gettrianglesetcount(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_meshobject_getobjectlevelproperty(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 * pUniqueResourceID, Lib3MF_uint32 * pPropertyID, bool * pHasObjectLevelProperty)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetTriangleSetCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetObjectLevelProperty");
 		}
-		if (pCount == nullptr)
+		if (!pUniqueResourceID)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (!pPropertyID)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pHasObjectLevelProperty == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pIMeshObject->GetTriangleSetCount();
+		*pHasObjectLevelProperty = pIMeshObject->GetObjectLevelProperty(*pUniqueResourceID, *pPropertyID);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Count", *pCount);
+			pJournalEntry->addUInt32Result("UniqueResourceID", *pUniqueResourceID);
+			pJournalEntry->addUInt32Result("PropertyID", *pPropertyID);
+			pJournalEntry->addBooleanResult("HasObjectLevelProperty", *pHasObjectLevelProperty);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -4981,28 +5201,23 @@ Lib3MFResult lib3mf_meshobject_gettrianglesetcount(Lib3MF_MeshObject pMeshObject
 	}
 }
 
-Lib3MFResult lib3mf_meshobject_gettriangleset(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nIndex, Lib3MF_TriangleSet * pTheTriangleSet)
+Lib3MFResult lib3mf_meshobject_settriangleproperties(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nIndex, const sLib3MFTriangleProperties * pProperties)
 {
 	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetTriangleSet");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "SetTriangleProperties");
 			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		if (pTheTriangleSet == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseTheTriangleSet(nullptr);
 		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
 		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseTheTriangleSet = pIMeshObject->GetTriangleSet(nIndex);
+		pIMeshObject->SetTriangleProperties(nIndex, *pProperties);
 
-		*pTheTriangleSet = (IBase*)(pBaseTheTriangleSet);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("TheTriangleSet", *pTheTriangleSet);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5018,31 +5233,25 @@ Lib3MFResult lib3mf_meshobject_gettriangleset(Lib3MF_MeshObject pMeshObject, Lib
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for LevelSet
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_levelset_getfunction(Lib3MF_LevelSet pLevelSet, Lib3MF_Function * pTheFunction)
+Lib3MFResult lib3mf_meshobject_gettriangleproperties(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nIndex, sLib3MFTriangleProperties * pProperty)
 {
-	IBase* pIBaseClass = (IBase *)pLevelSet;
+	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "GetFunction");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetTriangleProperties");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		if (pTheFunction == nullptr)
+		if (!pProperty)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseTheFunction(nullptr);
-		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
-		if (!pILevelSet)
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseTheFunction = pILevelSet->GetFunction();
+		pIMeshObject->GetTriangleProperties(nIndex, *pProperty);
 
-		*pTheFunction = (IBase*)(pBaseTheFunction);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("TheFunction", *pTheFunction);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5058,26 +5267,22 @@ Lib3MFResult lib3mf_levelset_getfunction(Lib3MF_LevelSet pLevelSet, Lib3MF_Funct
 	}
 }
 
-Lib3MFResult lib3mf_levelset_setfunction(Lib3MF_LevelSet pLevelSet, Lib3MF_Function pTheFunction)
+Lib3MFResult lib3mf_meshobject_setalltriangleproperties(Lib3MF_MeshObject pMeshObject, Lib3MF_uint64 nPropertiesArrayBufferSize, const sLib3MFTriangleProperties * pPropertiesArrayBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pLevelSet;
+	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "SetFunction");
-			pJournalEntry->addHandleParameter("TheFunction", pTheFunction);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "SetAllTriangleProperties");
 		}
-		IBase* pIBaseClassTheFunction = (IBase *)pTheFunction;
-		IFunction* pITheFunction = dynamic_cast<IFunction*>(pIBaseClassTheFunction);
-		if (!pITheFunction)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
-		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
-		if (!pILevelSet)
+		if ( (!pPropertiesArrayBuffer) && (nPropertiesArrayBufferSize>0))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pILevelSet->SetFunction(pITheFunction);
+		pIMeshObject->SetAllTriangleProperties(nPropertiesArrayBufferSize, pPropertiesArrayBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -5095,22 +5300,22 @@ Lib3MFResult lib3mf_levelset_setfunction(Lib3MF_LevelSet pLevelSet, Lib3MF_Funct
 	}
 }
 
-Lib3MFResult lib3mf_levelset_gettransform(Lib3MF_LevelSet pLevelSet, sLib3MFTransform * pTransform)
+Lib3MFResult lib3mf_meshobject_getalltriangleproperties(Lib3MF_MeshObject pMeshObject, const Lib3MF_uint64 nPropertiesArrayBufferSize, Lib3MF_uint64* pPropertiesArrayNeededCount, sLib3MFTriangleProperties * pPropertiesArrayBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pLevelSet;
+	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "GetTransform");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetAllTriangleProperties");
 		}
-		if (pTransform == nullptr)
-		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
-		if (!pILevelSet)
+		if ((!pPropertiesArrayBuffer) && !(pPropertiesArrayNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pTransform = pILevelSet->GetTransform();
+		pIMeshObject->GetAllTriangleProperties(nPropertiesArrayBufferSize, pPropertiesArrayNeededCount, pPropertiesArrayBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -5128,20 +5333,20 @@ Lib3MFResult lib3mf_levelset_gettransform(Lib3MF_LevelSet pLevelSet, sLib3MFTran
 	}
 }
 
-Lib3MFResult lib3mf_levelset_settransform(Lib3MF_LevelSet pLevelSet, const sLib3MFTransform * pTransform)
+Lib3MFResult lib3mf_meshobject_clearallproperties(Lib3MF_MeshObject pMeshObject)
 {
-	IBase* pIBaseClass = (IBase *)pLevelSet;
+	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "SetTransform");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "ClearAllProperties");
 		}
-		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
-		if (!pILevelSet)
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pILevelSet->SetTransform(*pTransform);
+		pIMeshObject->ClearAllProperties();
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -5159,47 +5364,26 @@ Lib3MFResult lib3mf_levelset_settransform(Lib3MF_LevelSet pLevelSet, const sLib3
 	}
 }
 
-Lib3MFResult lib3mf_levelset_getchannelname(Lib3MF_LevelSet pLevelSet, const Lib3MF_uint32 nChannelNameBufferSize, Lib3MF_uint32* pChannelNameNeededChars, char * pChannelNameBuffer)
+Lib3MFResult lib3mf_meshobject_setgeometry(Lib3MF_MeshObject pMeshObject, Lib3MF_uint64 nVerticesBufferSize, const sLib3MFPosition * pVerticesBuffer, Lib3MF_uint64 nIndicesBufferSize, const sLib3MFTriangle * pIndicesBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pLevelSet;
+	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "GetChannelName");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "SetGeometry");
 		}
-		if ( (!pChannelNameBuffer) && !(pChannelNameNeededChars) )
+		if ( (!pVerticesBuffer) && (nVerticesBufferSize>0))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sChannelName("");
-		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
-		if (!pILevelSet)
+		if ( (!pIndicesBuffer) && (nIndicesBufferSize>0))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pChannelNameBuffer == nullptr);
-		if (isCacheCall) {
-			sChannelName = pILevelSet->GetChannelName();
+		pIMeshObject->SetGeometry(nVerticesBufferSize, pVerticesBuffer, nIndicesBufferSize, pIndicesBuffer);
 
-			pILevelSet->_setCache (new ParameterCache_1<std::string> (sChannelName));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pILevelSet->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sChannelName);
-			pILevelSet->_setCache (nullptr);
-		}
-		
-		if (pChannelNameNeededChars)
-			*pChannelNameNeededChars = (Lib3MF_uint32) (sChannelName.size()+1);
-		if (pChannelNameBuffer) {
-			if (sChannelName.size() >= nChannelNameBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iChannelName = 0; iChannelName < sChannelName.size(); iChannelName++)
-				pChannelNameBuffer[iChannelName] = sChannelName[iChannelName];
-			pChannelNameBuffer[sChannelName.size()] = 0;
-		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("ChannelName", sChannelName.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5215,24 +5399,23 @@ Lib3MFResult lib3mf_levelset_getchannelname(Lib3MF_LevelSet pLevelSet, const Lib
 	}
 }
 
-Lib3MFResult lib3mf_levelset_setchannelname(Lib3MF_LevelSet pLevelSet, const char * pChannelName)
+Lib3MFResult lib3mf_meshobject_reservegeometry(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nVertexCount, Lib3MF_uint32 nTriangleCount, Lib3MF_uint32 nBeamCount)
 {
-	IBase* pIBaseClass = (IBase *)pLevelSet;
+	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "SetChannelName");
-			pJournalEntry->addStringParameter("ChannelName", pChannelName);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "ReserveGeometry");
+			pJournalEntry->addUInt32Parameter("VertexCount", nVertexCount);
+			pJournalEntry->addUInt32Parameter("TriangleCount", nTriangleCount);
+			pJournalEntry->addUInt32Parameter("BeamCount", nBeamCount);
 		}
-		if (pChannelName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sChannelName(pChannelName);
-		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
-		if (!pILevelSet)
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pILevelSet->SetChannelName(sChannelName);
+		pIMeshObject->ReserveGeometry(nVertexCount, nTriangleCount, nBeamCount);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -5250,23 +5433,25 @@ Lib3MFResult lib3mf_levelset_setchannelname(Lib3MF_LevelSet pLevelSet, const cha
 	}
 }
 
-Lib3MFResult lib3mf_levelset_setminfeaturesize(Lib3MF_LevelSet pLevelSet, Lib3MF_double dMinFeatureSize)
+Lib3MFResult lib3mf_meshobject_ismanifoldandoriented(Lib3MF_MeshObject pMeshObject, bool * pIsManifoldAndOriented)
 {
-	IBase* pIBaseClass = (IBase *)pLevelSet;
+	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "SetMinFeatureSize");
-			pJournalEntry->addDoubleParameter("MinFeatureSize", dMinFeatureSize);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "IsManifoldAndOriented");
 		}
-		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
-		if (!pILevelSet)
+		if (pIsManifoldAndOriented == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pILevelSet->SetMinFeatureSize(dMinFeatureSize);
+		*pIsManifoldAndOriented = pIMeshObject->IsManifoldAndOriented();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addBooleanResult("IsManifoldAndOriented", *pIsManifoldAndOriented);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5282,25 +5467,25 @@ Lib3MFResult lib3mf_levelset_setminfeaturesize(Lib3MF_LevelSet pLevelSet, Lib3MF
 	}
 }
 
-Lib3MFResult lib3mf_levelset_getminfeaturesize(Lib3MF_LevelSet pLevelSet, Lib3MF_double * pMinFeatureSize)
+Lib3MFResult lib3mf_meshobject_isgeometryloaded(Lib3MF_MeshObject pMeshObject, bool * pIsGeometryLoaded)
 {
-	IBase* pIBaseClass = (IBase *)pLevelSet;
+	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "GetMinFeatureSize");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "IsGeometryLoaded");
 		}
-		if (pMinFeatureSize == nullptr)
+		if (pIsGeometryLoaded == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
-		if (!pILevelSet)
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pMinFeatureSize = pILevelSet->GetMinFeatureSize();
+		*pIsGeometryLoaded = pIMeshObject->IsGeometryLoaded();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addDoubleResult("MinFeatureSize", *pMinFeatureSize);
+			pJournalEntry->addBooleanResult("IsGeometryLoaded", *pIsGeometryLoaded);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5316,23 +5501,27 @@ Lib3MFResult lib3mf_levelset_getminfeaturesize(Lib3MF_LevelSet pLevelSet, Lib3MF
 	}
 }
 
-Lib3MFResult lib3mf_levelset_setfallbackvalue(Lib3MF_LevelSet pLevelSet, Lib3MF_double dFallBackValue)
+Lib3MFResult lib3mf_meshobject_beamlattice(Lib3MF_MeshObject pMeshObject, Lib3MF_BeamLattice * pTheBeamLattice)
 {
-	IBase* pIBaseClass = (IBase *)pLevelSet;
+	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "SetFallBackValue");
-			pJournalEntry->addDoubleParameter("FallBackValue", dFallBackValue);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "BeamLattice");
 		}
-		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
-		if (!pILevelSet)
+		if (pTheBeamLattice == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseTheBeamLattice(nullptr);
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pILevelSet->SetFallBackValue(dFallBackValue);
+		pBaseTheBeamLattice = pIMeshObject->BeamLattice();
 
+		*pTheBeamLattice = (IBase*)(pBaseTheBeamLattice);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("TheBeamLattice", *pTheBeamLattice);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5348,25 +5537,27 @@ Lib3MFResult lib3mf_levelset_setfallbackvalue(Lib3MF_LevelSet pLevelSet, Lib3MF_
 	}
 }
 
-Lib3MFResult lib3mf_levelset_getfallbackvalue(Lib3MF_LevelSet pLevelSet, Lib3MF_double * pFallBackValue)
+Lib3MFResult lib3mf_meshobject_getvolumedata(Lib3MF_MeshObject pMeshObject, Lib3MF_VolumeData * pTheVolumeData)
 {
-	IBase* pIBaseClass = (IBase *)pLevelSet;
+	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "GetFallBackValue");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetVolumeData");
 		}
-		if (pFallBackValue == nullptr)
+		if (pTheVolumeData == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
-		if (!pILevelSet)
+		IBase* pBaseTheVolumeData(nullptr);
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pFallBackValue = pILevelSet->GetFallBackValue();
+		pBaseTheVolumeData = pIMeshObject->GetVolumeData();
 
+		*pTheVolumeData = (IBase*)(pBaseTheVolumeData);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addDoubleResult("FallBackValue", *pFallBackValue);
+			pJournalEntry->addHandleResult("TheVolumeData", *pTheVolumeData);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5382,21 +5573,26 @@ Lib3MFResult lib3mf_levelset_getfallbackvalue(Lib3MF_LevelSet pLevelSet, Lib3MF_
 	}
 }
 
-Lib3MFResult lib3mf_levelset_setmeshbboxonly(Lib3MF_LevelSet pLevelSet, bool bMeshBBoxOnly)
+Lib3MFResult lib3mf_meshobject_setvolumedata(Lib3MF_MeshObject pMeshObject, Lib3MF_VolumeData pTheVolumeData)
 {
-	IBase* pIBaseClass = (IBase *)pLevelSet;
+	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "SetMeshBBoxOnly");
-			pJournalEntry->addBooleanParameter("MeshBBoxOnly", bMeshBBoxOnly);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "SetVolumeData");
+			pJournalEntry->addHandleParameter("TheVolumeData", pTheVolumeData);
 		}
-		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
-		if (!pILevelSet)
+		IBase* pIBaseClassTheVolumeData = (IBase *)pTheVolumeData;
+		IVolumeData* pITheVolumeData = dynamic_cast<IVolumeData*>(pIBaseClassTheVolumeData);
+		if (!pITheVolumeData)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pILevelSet->SetMeshBBoxOnly(bMeshBBoxOnly);
+		pIMeshObject->SetVolumeData(pITheVolumeData);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -5414,25 +5610,35 @@ Lib3MFResult lib3mf_levelset_setmeshbboxonly(Lib3MF_LevelSet pLevelSet, bool bMe
 	}
 }
 
-Lib3MFResult lib3mf_levelset_getmeshbboxonly(Lib3MF_LevelSet pLevelSet, bool * pMeshBBoxOnly)
+Lib3MFResult lib3mf_meshobject_addtriangleset(Lib3MF_MeshObject pMeshObject, const char * pIdentifier, const char * pName, Lib3MF_TriangleSet * pTheTriangleSet)
 {
-	IBase* pIBaseClass = (IBase *)pLevelSet;
+	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "GetMeshBBoxOnly");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "AddTriangleSet");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry->addStringParameter("Name", pName);
 		}
-		if (pMeshBBoxOnly == nullptr)
+		if (pIdentifier == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
-		if (!pILevelSet)
+		if (pName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pTheTriangleSet == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		std::string sName(pName);
+		IBase* pBaseTheTriangleSet(nullptr);
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pMeshBBoxOnly = pILevelSet->GetMeshBBoxOnly();
+		pBaseTheTriangleSet = pIMeshObject->AddTriangleSet(sIdentifier, sName);
 
+		*pTheTriangleSet = (IBase*)(pBaseTheTriangleSet);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("MeshBBoxOnly", *pMeshBBoxOnly);
+			pJournalEntry->addHandleResult("TheTriangleSet", *pTheTriangleSet);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5448,28 +5654,29 @@ Lib3MFResult lib3mf_levelset_getmeshbboxonly(Lib3MF_LevelSet pLevelSet, bool * p
 	}
 }
 
-Lib3MFResult lib3mf_levelset_setmesh(Lib3MF_LevelSet pLevelSet, Lib3MF_MeshObject pTheMesh)
+Lib3MFResult lib3mf_meshobject_hastriangleset(Lib3MF_MeshObject pMeshObject, const char * pIdentifier, bool * pTriangleSetExists)
 {
-	IBase* pIBaseClass = (IBase *)pLevelSet;
+	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "SetMesh");
-			pJournalEntry->addHandleParameter("TheMesh", pTheMesh);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "HasTriangleSet");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 		}
-		IBase* pIBaseClassTheMesh = (IBase *)pTheMesh;
-		IMeshObject* pITheMesh = dynamic_cast<IMeshObject*>(pIBaseClassTheMesh);
-		if (!pITheMesh)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
-		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
-		if (!pILevelSet)
+		if (pIdentifier == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pTriangleSetExists == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pILevelSet->SetMesh(pITheMesh);
+		*pTriangleSetExists = pIMeshObject->HasTriangleSet(sIdentifier);
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addBooleanResult("TriangleSetExists", *pTriangleSetExists);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5485,27 +5692,31 @@ Lib3MFResult lib3mf_levelset_setmesh(Lib3MF_LevelSet pLevelSet, Lib3MF_MeshObjec
 	}
 }
 
-Lib3MFResult lib3mf_levelset_getmesh(Lib3MF_LevelSet pLevelSet, Lib3MF_MeshObject * pTheMesh)
+Lib3MFResult lib3mf_meshobject_findtriangleset(Lib3MF_MeshObject pMeshObject, const char * pIdentifier, Lib3MF_TriangleSet * pTheTriangleSet)
 {
-	IBase* pIBaseClass = (IBase *)pLevelSet;
+	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "GetMesh");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "FindTriangleSet");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 		}
-		if (pTheMesh == nullptr)
+		if (pIdentifier == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseTheMesh(nullptr);
-		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
-		if (!pILevelSet)
+		if (pTheTriangleSet == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		IBase* pBaseTheTriangleSet(nullptr);
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseTheMesh = pILevelSet->GetMesh();
+		pBaseTheTriangleSet = pIMeshObject->FindTriangleSet(sIdentifier);
 
-		*pTheMesh = (IBase*)(pBaseTheMesh);
+		*pTheTriangleSet = (IBase*)(pBaseTheTriangleSet);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("TheMesh", *pTheMesh);
+			pJournalEntry->addHandleResult("TheTriangleSet", *pTheTriangleSet);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5521,27 +5732,25 @@ Lib3MFResult lib3mf_levelset_getmesh(Lib3MF_LevelSet pLevelSet, Lib3MF_MeshObjec
 	}
 }
 
-Lib3MFResult lib3mf_levelset_getvolumedata(Lib3MF_LevelSet pLevelSet, Lib3MF_VolumeData * pTheVolumeData)
+Lib3MFResult lib3mf_meshobject_gettrianglesetcount(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pLevelSet;
+	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "GetVolumeData");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetTriangleSetCount");
 		}
-		if (pTheVolumeData == nullptr)
+		if (pCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseTheVolumeData(nullptr);
-		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
-		if (!pILevelSet)
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseTheVolumeData = pILevelSet->GetVolumeData();
+		*pCount = pIMeshObject->GetTriangleSetCount();
 
-		*pTheVolumeData = (IBase*)(pBaseTheVolumeData);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("TheVolumeData", *pTheVolumeData);
+			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5557,28 +5766,28 @@ Lib3MFResult lib3mf_levelset_getvolumedata(Lib3MF_LevelSet pLevelSet, Lib3MF_Vol
 	}
 }
 
-Lib3MFResult lib3mf_levelset_setvolumedata(Lib3MF_LevelSet pLevelSet, Lib3MF_VolumeData pTheVolumeData)
+Lib3MFResult lib3mf_meshobject_gettriangleset(Lib3MF_MeshObject pMeshObject, Lib3MF_uint32 nIndex, Lib3MF_TriangleSet * pTheTriangleSet)
 {
-	IBase* pIBaseClass = (IBase *)pLevelSet;
+	IBase* pIBaseClass = (IBase *)pMeshObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "SetVolumeData");
-			pJournalEntry->addHandleParameter("TheVolumeData", pTheVolumeData);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshObject, "MeshObject", "GetTriangleSet");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		IBase* pIBaseClassTheVolumeData = (IBase *)pTheVolumeData;
-		IVolumeData* pITheVolumeData = dynamic_cast<IVolumeData*>(pIBaseClassTheVolumeData);
-		if (!pITheVolumeData)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
-		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
-		if (!pILevelSet)
+		if (pTheTriangleSet == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseTheTriangleSet(nullptr);
+		IMeshObject* pIMeshObject = dynamic_cast<IMeshObject*>(pIBaseClass);
+		if (!pIMeshObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pILevelSet->SetVolumeData(pITheVolumeData);
+		pBaseTheTriangleSet = pIMeshObject->GetTriangleSet(nIndex);
 
+		*pTheTriangleSet = (IBase*)(pBaseTheTriangleSet);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("TheTriangleSet", *pTheTriangleSet);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5596,27 +5805,29 @@ Lib3MFResult lib3mf_levelset_setvolumedata(Lib3MF_LevelSet pLevelSet, Lib3MF_Vol
 
 
 /*************************************************************************************************************************
- Class implementation for BeamLattice
+ Class implementation for LevelSet
 **************************************************************************************************************************/
-Lib3MFResult lib3mf_beamlattice_getminlength(Lib3MF_BeamLattice pBeamLattice, Lib3MF_double * pMinLength)
+Lib3MFResult lib3mf_levelset_getfunction(Lib3MF_LevelSet pLevelSet, Lib3MF_Function * pTheFunction)
 {
-	IBase* pIBaseClass = (IBase *)pBeamLattice;
+	IBase* pIBaseClass = (IBase *)pLevelSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetMinLength");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "GetFunction");
 		}
-		if (pMinLength == nullptr)
+		if (pTheFunction == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
-		if (!pIBeamLattice)
+		IBase* pBaseTheFunction(nullptr);
+		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
+		if (!pILevelSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pMinLength = pIBeamLattice->GetMinLength();
+		pBaseTheFunction = pILevelSet->GetFunction();
 
+		*pTheFunction = (IBase*)(pBaseTheFunction);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addDoubleResult("MinLength", *pMinLength);
+			pJournalEntry->addHandleResult("TheFunction", *pTheFunction);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5632,21 +5843,26 @@ Lib3MFResult lib3mf_beamlattice_getminlength(Lib3MF_BeamLattice pBeamLattice, Li
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_setminlength(Lib3MF_BeamLattice pBeamLattice, Lib3MF_double dMinLength)
+Lib3MFResult lib3mf_levelset_setfunction(Lib3MF_LevelSet pLevelSet, Lib3MF_Function pTheFunction)
 {
-	IBase* pIBaseClass = (IBase *)pBeamLattice;
+	IBase* pIBaseClass = (IBase *)pLevelSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "SetMinLength");
-			pJournalEntry->addDoubleParameter("MinLength", dMinLength);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "SetFunction");
+			pJournalEntry->addHandleParameter("TheFunction", pTheFunction);
 		}
-		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
-		if (!pIBeamLattice)
+		IBase* pIBaseClassTheFunction = (IBase *)pTheFunction;
+		IFunction* pITheFunction = dynamic_cast<IFunction*>(pIBaseClassTheFunction);
+		if (!pITheFunction)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
+		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
+		if (!pILevelSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBeamLattice->SetMinLength(dMinLength);
+		pILevelSet->SetFunction(pITheFunction);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -5664,28 +5880,24 @@ Lib3MFResult lib3mf_beamlattice_setminlength(Lib3MF_BeamLattice pBeamLattice, Li
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_getclipping(Lib3MF_BeamLattice pBeamLattice, eLib3MFBeamLatticeClipMode * pClipMode, Lib3MF_uint32 * pUniqueResourceID)
+Lib3MFResult lib3mf_levelset_gettransform(Lib3MF_LevelSet pLevelSet, sLib3MFTransform * pTransform)
 {
-	IBase* pIBaseClass = (IBase *)pBeamLattice;
+	IBase* pIBaseClass = (IBase *)pLevelSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetClipping");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "GetTransform");
 		}
-		if (!pClipMode)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (!pUniqueResourceID)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
-		if (!pIBeamLattice)
+		if (pTransform == nullptr)
+		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
+		if (!pILevelSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBeamLattice->GetClipping(*pClipMode, *pUniqueResourceID);
+		*pTransform = pILevelSet->GetTransform();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addEnumResult("ClipMode", "BeamLatticeClipMode", (Lib3MF_int32)(*pClipMode));
-			pJournalEntry->addUInt32Result("UniqueResourceID", *pUniqueResourceID);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5701,22 +5913,20 @@ Lib3MFResult lib3mf_beamlattice_getclipping(Lib3MF_BeamLattice pBeamLattice, eLi
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_setclipping(Lib3MF_BeamLattice pBeamLattice, eLib3MFBeamLatticeClipMode eClipMode, Lib3MF_uint32 nUniqueResourceID)
+Lib3MFResult lib3mf_levelset_settransform(Lib3MF_LevelSet pLevelSet, const sLib3MFTransform * pTransform)
 {
-	IBase* pIBaseClass = (IBase *)pBeamLattice;
+	IBase* pIBaseClass = (IBase *)pLevelSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "SetClipping");
-			pJournalEntry->addEnumParameter("ClipMode", "BeamLatticeClipMode", (Lib3MF_int32)(eClipMode));
-			pJournalEntry->addUInt32Parameter("UniqueResourceID", nUniqueResourceID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "SetTransform");
 		}
-		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
-		if (!pIBeamLattice)
+		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
+		if (!pILevelSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBeamLattice->SetClipping(eClipMode, nUniqueResourceID);
+		pILevelSet->SetTransform(*pTransform);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -5734,28 +5944,47 @@ Lib3MFResult lib3mf_beamlattice_setclipping(Lib3MF_BeamLattice pBeamLattice, eLi
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_getrepresentation(Lib3MF_BeamLattice pBeamLattice, bool * pHasRepresentation, Lib3MF_uint32 * pUniqueResourceID)
+Lib3MFResult lib3mf_levelset_getchannelname(Lib3MF_LevelSet pLevelSet, const Lib3MF_uint32 nChannelNameBufferSize, Lib3MF_uint32* pChannelNameNeededChars, char * pChannelNameBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pBeamLattice;
+	IBase* pIBaseClass = (IBase *)pLevelSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetRepresentation");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "GetChannelName");
 		}
-		if (pHasRepresentation == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (!pUniqueResourceID)
+		if ( (!pChannelNameBuffer) && !(pChannelNameNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
-		if (!pIBeamLattice)
+		std::string sChannelName("");
+		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
+		if (!pILevelSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pHasRepresentation = pIBeamLattice->GetRepresentation(*pUniqueResourceID);
+		bool isCacheCall = (pChannelNameBuffer == nullptr);
+		if (isCacheCall) {
+			sChannelName = pILevelSet->GetChannelName();
 
+			pILevelSet->_setCache (new ParameterCache_1<std::string> (sChannelName));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pILevelSet->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sChannelName);
+			pILevelSet->_setCache (nullptr);
+		}
+		
+		if (pChannelNameNeededChars)
+			*pChannelNameNeededChars = (Lib3MF_uint32) (sChannelName.size()+1);
+		if (pChannelNameBuffer) {
+			if (sChannelName.size() >= nChannelNameBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iChannelName = 0; iChannelName < sChannelName.size(); iChannelName++)
+				pChannelNameBuffer[iChannelName] = sChannelName[iChannelName];
+			pChannelNameBuffer[sChannelName.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("HasRepresentation", *pHasRepresentation);
-			pJournalEntry->addUInt32Result("UniqueResourceID", *pUniqueResourceID);
+			pJournalEntry->addStringResult("ChannelName", sChannelName.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5771,21 +6000,24 @@ Lib3MFResult lib3mf_beamlattice_getrepresentation(Lib3MF_BeamLattice pBeamLattic
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_setrepresentation(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint32 nUniqueResourceID)
+Lib3MFResult lib3mf_levelset_setchannelname(Lib3MF_LevelSet pLevelSet, const char * pChannelName)
 {
-	IBase* pIBaseClass = (IBase *)pBeamLattice;
+	IBase* pIBaseClass = (IBase *)pLevelSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "SetRepresentation");
-			pJournalEntry->addUInt32Parameter("UniqueResourceID", nUniqueResourceID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "SetChannelName");
+			pJournalEntry->addStringParameter("ChannelName", pChannelName);
 		}
-		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
-		if (!pIBeamLattice)
+		if (pChannelName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sChannelName(pChannelName);
+		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
+		if (!pILevelSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBeamLattice->SetRepresentation(nUniqueResourceID);
+		pILevelSet->SetChannelName(sChannelName);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -5803,28 +6035,23 @@ Lib3MFResult lib3mf_beamlattice_setrepresentation(Lib3MF_BeamLattice pBeamLattic
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_getballoptions(Lib3MF_BeamLattice pBeamLattice, eLib3MFBeamLatticeBallMode * pBallMode, Lib3MF_double * pBallRadius)
+Lib3MFResult lib3mf_levelset_setminfeaturesize(Lib3MF_LevelSet pLevelSet, Lib3MF_double dMinFeatureSize)
 {
-	IBase* pIBaseClass = (IBase *)pBeamLattice;
+	IBase* pIBaseClass = (IBase *)pLevelSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetBallOptions");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "SetMinFeatureSize");
+			pJournalEntry->addDoubleParameter("MinFeatureSize", dMinFeatureSize);
 		}
-		if (!pBallMode)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (!pBallRadius)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
-		if (!pIBeamLattice)
+		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
+		if (!pILevelSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBeamLattice->GetBallOptions(*pBallMode, *pBallRadius);
+		pILevelSet->SetMinFeatureSize(dMinFeatureSize);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addEnumResult("BallMode", "BeamLatticeBallMode", (Lib3MF_int32)(*pBallMode));
-			pJournalEntry->addDoubleResult("BallRadius", *pBallRadius);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5840,24 +6067,25 @@ Lib3MFResult lib3mf_beamlattice_getballoptions(Lib3MF_BeamLattice pBeamLattice,
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_setballoptions(Lib3MF_BeamLattice pBeamLattice, eLib3MFBeamLatticeBallMode eBallMode, Lib3MF_double dBallRadius)
+Lib3MFResult lib3mf_levelset_getminfeaturesize(Lib3MF_LevelSet pLevelSet, Lib3MF_double * pMinFeatureSize)
 {
-	IBase* pIBaseClass = (IBase *)pBeamLattice;
+	IBase* pIBaseClass = (IBase *)pLevelSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "SetBallOptions");
-			pJournalEntry->addEnumParameter("BallMode", "BeamLatticeBallMode", (Lib3MF_int32)(eBallMode));
-			pJournalEntry->addDoubleParameter("BallRadius", dBallRadius);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "GetMinFeatureSize");
 		}
-		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
-		if (!pIBeamLattice)
+		if (pMinFeatureSize == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
+		if (!pILevelSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBeamLattice->SetBallOptions(eBallMode, dBallRadius);
+		*pMinFeatureSize = pILevelSet->GetMinFeatureSize();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addDoubleResult("MinFeatureSize", *pMinFeatureSize);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5873,25 +6101,23 @@ Lib3MFResult lib3mf_beamlattice_setballoptions(Lib3MF_BeamLattice pBeamLattice,
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_getbeamcount(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_levelset_setfallbackvalue(Lib3MF_LevelSet pLevelSet, Lib3MF_double dFallBackValue)
 {
-	IBase* pIBaseClass = (IBase *)pBeamLattice;
+	IBase* pIBaseClass = (IBase *)pLevelSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetBeamCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "SetFallBackValue");
+			pJournalEntry->addDoubleParameter("FallBackValue", dFallBackValue);
 		}
-		if (pCount == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
-		if (!pIBeamLattice)
+		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
+		if (!pILevelSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pIBeamLattice->GetBeamCount();
+		pILevelSet->SetFallBackValue(dFallBackValue);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5907,25 +6133,25 @@ Lib3MFResult lib3mf_beamlattice_getbeamcount(Lib3MF_BeamLattice pBeamLattice, Li
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_getbeam(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint32 nIndex, sLib3MFBeam * pBeamInfo)
+Lib3MFResult lib3mf_levelset_getfallbackvalue(Lib3MF_LevelSet pLevelSet, Lib3MF_double * pFallBackValue)
 {
-	IBase* pIBaseClass = (IBase *)pBeamLattice;
+	IBase* pIBaseClass = (IBase *)pLevelSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetBeam");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "GetFallBackValue");
 		}
-		if (pBeamInfo == nullptr)
-		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
-		if (!pIBeamLattice)
+		if (pFallBackValue == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
+		if (!pILevelSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pBeamInfo = pIBeamLattice->GetBeam(nIndex);
+		*pFallBackValue = pILevelSet->GetFallBackValue();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addDoubleResult("FallBackValue", *pFallBackValue);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5941,25 +6167,23 @@ Lib3MFResult lib3mf_beamlattice_getbeam(Lib3MF_BeamLattice pBeamLattice, Lib3MF_
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_addbeam(Lib3MF_BeamLattice pBeamLattice, const sLib3MFBeam * pBeamInfo, Lib3MF_uint32 * pIndex)
+Lib3MFResult lib3mf_levelset_setmeshbboxonly(Lib3MF_LevelSet pLevelSet, bool bMeshBBoxOnly)
 {
-	IBase* pIBaseClass = (IBase *)pBeamLattice;
+	IBase* pIBaseClass = (IBase *)pLevelSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "AddBeam");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "SetMeshBBoxOnly");
+			pJournalEntry->addBooleanParameter("MeshBBoxOnly", bMeshBBoxOnly);
 		}
-		if (pIndex == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
-		if (!pIBeamLattice)
+		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
+		if (!pILevelSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pIndex = pIBeamLattice->AddBeam(*pBeamInfo);
+		pILevelSet->SetMeshBBoxOnly(bMeshBBoxOnly);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Index", *pIndex);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -5975,23 +6199,25 @@ Lib3MFResult lib3mf_beamlattice_addbeam(Lib3MF_BeamLattice pBeamLattice, const s
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_setbeam(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint32 nIndex, const sLib3MFBeam * pBeamInfo)
+Lib3MFResult lib3mf_levelset_getmeshbboxonly(Lib3MF_LevelSet pLevelSet, bool * pMeshBBoxOnly)
 {
-	IBase* pIBaseClass = (IBase *)pBeamLattice;
+	IBase* pIBaseClass = (IBase *)pLevelSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "SetBeam");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "GetMeshBBoxOnly");
 		}
-		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
-		if (!pIBeamLattice)
+		if (pMeshBBoxOnly == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
+		if (!pILevelSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBeamLattice->SetBeam(nIndex, *pBeamInfo);
+		*pMeshBBoxOnly = pILevelSet->GetMeshBBoxOnly();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addBooleanResult("MeshBBoxOnly", *pMeshBBoxOnly);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -6007,22 +6233,26 @@ Lib3MFResult lib3mf_beamlattice_setbeam(Lib3MF_BeamLattice pBeamLattice, Lib3MF_
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_setbeams(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint64 nBeamInfoBufferSize, const sLib3MFBeam * pBeamInfoBuffer)
+Lib3MFResult lib3mf_levelset_setmesh(Lib3MF_LevelSet pLevelSet, Lib3MF_MeshObject pTheMesh)
 {
-	IBase* pIBaseClass = (IBase *)pBeamLattice;
+	IBase* pIBaseClass = (IBase *)pLevelSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "SetBeams");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "SetMesh");
+			pJournalEntry->addHandleParameter("TheMesh", pTheMesh);
 		}
-		if ( (!pBeamInfoBuffer) && (nBeamInfoBufferSize>0))
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
-		if (!pIBeamLattice)
+		IBase* pIBaseClassTheMesh = (IBase *)pTheMesh;
+		IMeshObject* pITheMesh = dynamic_cast<IMeshObject*>(pIBaseClassTheMesh);
+		if (!pITheMesh)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
+		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
+		if (!pILevelSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBeamLattice->SetBeams(nBeamInfoBufferSize, pBeamInfoBuffer);
+		pILevelSet->SetMesh(pITheMesh);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -6040,24 +6270,27 @@ Lib3MFResult lib3mf_beamlattice_setbeams(Lib3MF_BeamLattice pBeamLattice, Lib3MF
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_getbeams(Lib3MF_BeamLattice pBeamLattice, const Lib3MF_uint64 nBeamInfoBufferSize, Lib3MF_uint64* pBeamInfoNeededCount, sLib3MFBeam * pBeamInfoBuffer)
+Lib3MFResult lib3mf_levelset_getmesh(Lib3MF_LevelSet pLevelSet, Lib3MF_MeshObject * pTheMesh)
 {
-	IBase* pIBaseClass = (IBase *)pBeamLattice;
+	IBase* pIBaseClass = (IBase *)pLevelSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetBeams");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "GetMesh");
 		}
-		if ((!pBeamInfoBuffer) && !(pBeamInfoNeededCount))
+		if (pTheMesh == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
-		if (!pIBeamLattice)
+		IBase* pBaseTheMesh(nullptr);
+		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
+		if (!pILevelSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBeamLattice->GetBeams(nBeamInfoBufferSize, pBeamInfoNeededCount, pBeamInfoBuffer);
+		pBaseTheMesh = pILevelSet->GetMesh();
 
+		*pTheMesh = (IBase*)(pBaseTheMesh);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("TheMesh", *pTheMesh);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -6073,25 +6306,27 @@ Lib3MFResult lib3mf_beamlattice_getbeams(Lib3MF_BeamLattice pBeamLattice, const
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_getballcount(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_levelset_getvolumedata(Lib3MF_LevelSet pLevelSet, Lib3MF_VolumeData * pTheVolumeData)
 {
-	IBase* pIBaseClass = (IBase *)pBeamLattice;
+	IBase* pIBaseClass = (IBase *)pLevelSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetBallCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "GetVolumeData");
 		}
-		if (pCount == nullptr)
+		if (pTheVolumeData == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
-		if (!pIBeamLattice)
+		IBase* pBaseTheVolumeData(nullptr);
+		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
+		if (!pILevelSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pIBeamLattice->GetBallCount();
+		pBaseTheVolumeData = pILevelSet->GetVolumeData();
 
+		*pTheVolumeData = (IBase*)(pBaseTheVolumeData);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Count", *pCount);
+			pJournalEntry->addHandleResult("TheVolumeData", *pTheVolumeData);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -6107,23 +6342,26 @@ Lib3MFResult lib3mf_beamlattice_getballcount(Lib3MF_BeamLattice pBeamLattice, Li
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_getball(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint32 nIndex, sLib3MFBall * pBallInfo)
+Lib3MFResult lib3mf_levelset_setvolumedata(Lib3MF_LevelSet pLevelSet, Lib3MF_VolumeData pTheVolumeData)
 {
-	IBase* pIBaseClass = (IBase *)pBeamLattice;
+	IBase* pIBaseClass = (IBase *)pLevelSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetBall");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pLevelSet, "LevelSet", "SetVolumeData");
+			pJournalEntry->addHandleParameter("TheVolumeData", pTheVolumeData);
 		}
-		if (pBallInfo == nullptr)
-		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
-		if (!pIBeamLattice)
+		IBase* pIBaseClassTheVolumeData = (IBase *)pTheVolumeData;
+		IVolumeData* pITheVolumeData = dynamic_cast<IVolumeData*>(pIBaseClassTheVolumeData);
+		if (!pITheVolumeData)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
+		ILevelSet* pILevelSet = dynamic_cast<ILevelSet*>(pIBaseClass);
+		if (!pILevelSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pBallInfo = pIBeamLattice->GetBall(nIndex);
+		pILevelSet->SetVolumeData(pITheVolumeData);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -6141,25 +6379,29 @@ Lib3MFResult lib3mf_beamlattice_getball(Lib3MF_BeamLattice pBeamLattice, Lib3MF_
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_addball(Lib3MF_BeamLattice pBeamLattice, const sLib3MFBall * pBallInfo, Lib3MF_uint32 * pIndex)
+
+/*************************************************************************************************************************
+ Class implementation for BeamLattice
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_beamlattice_getminlength(Lib3MF_BeamLattice pBeamLattice, Lib3MF_double * pMinLength)
 {
 	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "AddBall");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetMinLength");
 		}
-		if (pIndex == nullptr)
+		if (pMinLength == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
 		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pIndex = pIBeamLattice->AddBall(*pBallInfo);
+		*pMinLength = pIBeamLattice->GetMinLength();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Index", *pIndex);
+			pJournalEntry->addDoubleResult("MinLength", *pMinLength);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -6175,21 +6417,21 @@ Lib3MFResult lib3mf_beamlattice_addball(Lib3MF_BeamLattice pBeamLattice, const s
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_setball(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint32 nIndex, const sLib3MFBall * pBallInfo)
+Lib3MFResult lib3mf_beamlattice_setminlength(Lib3MF_BeamLattice pBeamLattice, Lib3MF_double dMinLength)
 {
 	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "SetBall");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "SetMinLength");
+			pJournalEntry->addDoubleParameter("MinLength", dMinLength);
 		}
 		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
 		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBeamLattice->SetBall(nIndex, *pBallInfo);
+		pIBeamLattice->SetMinLength(dMinLength);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -6207,24 +6449,28 @@ Lib3MFResult lib3mf_beamlattice_setball(Lib3MF_BeamLattice pBeamLattice, Lib3MF_
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_setballs(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint64 nBallInfoBufferSize, const sLib3MFBall * pBallInfoBuffer)
+Lib3MFResult lib3mf_beamlattice_getclipping(Lib3MF_BeamLattice pBeamLattice, eLib3MFBeamLatticeClipMode * pClipMode, Lib3MF_uint32 * pUniqueResourceID)
 {
 	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "SetBalls");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetClipping");
 		}
-		if ( (!pBallInfoBuffer) && (nBallInfoBufferSize>0))
+		if (!pClipMode)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (!pUniqueResourceID)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
 		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBeamLattice->SetBalls(nBallInfoBufferSize, pBallInfoBuffer);
+		pIBeamLattice->GetClipping(*pClipMode, *pUniqueResourceID);
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addEnumResult("ClipMode", "BeamLatticeClipMode", (Lib3MF_int32)(*pClipMode));
+			pJournalEntry->addUInt32Result("UniqueResourceID", *pUniqueResourceID);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -6240,22 +6486,22 @@ Lib3MFResult lib3mf_beamlattice_setballs(Lib3MF_BeamLattice pBeamLattice, Lib3MF
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_getballs(Lib3MF_BeamLattice pBeamLattice, const Lib3MF_uint64 nBallInfoBufferSize, Lib3MF_uint64* pBallInfoNeededCount, sLib3MFBall * pBallInfoBuffer)
+Lib3MFResult lib3mf_beamlattice_setclipping(Lib3MF_BeamLattice pBeamLattice, eLib3MFBeamLatticeClipMode eClipMode, Lib3MF_uint32 nUniqueResourceID)
 {
 	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetBalls");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "SetClipping");
+			pJournalEntry->addEnumParameter("ClipMode", "BeamLatticeClipMode", (Lib3MF_int32)(eClipMode));
+			pJournalEntry->addUInt32Parameter("UniqueResourceID", nUniqueResourceID);
 		}
-		if ((!pBallInfoBuffer) && !(pBallInfoNeededCount))
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
 		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBeamLattice->GetBalls(nBallInfoBufferSize, pBallInfoNeededCount, pBallInfoBuffer);
+		pIBeamLattice->SetClipping(eClipMode, nUniqueResourceID);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -6273,25 +6519,28 @@ Lib3MFResult lib3mf_beamlattice_getballs(Lib3MF_BeamLattice pBeamLattice, const
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_getbeamsetcount(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_beamlattice_getrepresentation(Lib3MF_BeamLattice pBeamLattice, bool * pHasRepresentation, Lib3MF_uint32 * pUniqueResourceID)
 {
 	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetBeamSetCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetRepresentation");
 		}
-		if (pCount == nullptr)
+		if (pHasRepresentation == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (!pUniqueResourceID)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
 		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pIBeamLattice->GetBeamSetCount();
+		*pHasRepresentation = pIBeamLattice->GetRepresentation(*pUniqueResourceID);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Count", *pCount);
+			pJournalEntry->addBooleanResult("HasRepresentation", *pHasRepresentation);
+			pJournalEntry->addUInt32Result("UniqueResourceID", *pUniqueResourceID);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -6307,27 +6556,23 @@ Lib3MFResult lib3mf_beamlattice_getbeamsetcount(Lib3MF_BeamLattice pBeamLattice,
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_addbeamset(Lib3MF_BeamLattice pBeamLattice, Lib3MF_BeamSet * pBeamSet)
+Lib3MFResult lib3mf_beamlattice_setrepresentation(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint32 nUniqueResourceID)
 {
 	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "AddBeamSet");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "SetRepresentation");
+			pJournalEntry->addUInt32Parameter("UniqueResourceID", nUniqueResourceID);
 		}
-		if (pBeamSet == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseBeamSet(nullptr);
 		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
 		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseBeamSet = pIBeamLattice->AddBeamSet();
+		pIBeamLattice->SetRepresentation(nUniqueResourceID);
 
-		*pBeamSet = (IBase*)(pBaseBeamSet);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("BeamSet", *pBeamSet);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -6343,28 +6588,28 @@ Lib3MFResult lib3mf_beamlattice_addbeamset(Lib3MF_BeamLattice pBeamLattice, Lib3
 	}
 }
 
-Lib3MFResult lib3mf_beamlattice_getbeamset(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint32 nIndex, Lib3MF_BeamSet * pBeamSet)
+Lib3MFResult lib3mf_beamlattice_getballoptions(Lib3MF_BeamLattice pBeamLattice, eLib3MFBeamLatticeBallMode * pBallMode, Lib3MF_double * pBallRadius)
 {
 	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetBeamSet");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetBallOptions");
 		}
-		if (pBeamSet == nullptr)
+		if (!pBallMode)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (!pBallRadius)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseBeamSet(nullptr);
 		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
 		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseBeamSet = pIBeamLattice->GetBeamSet(nIndex);
+		pIBeamLattice->GetBallOptions(*pBallMode, *pBallRadius);
 
-		*pBeamSet = (IBase*)(pBaseBeamSet);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("BeamSet", *pBeamSet);
+			pJournalEntry->addEnumResult("BallMode", "BeamLatticeBallMode", (Lib3MF_int32)(*pBallMode));
+			pJournalEntry->addDoubleResult("BallRadius", *pBallRadius);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -6380,29 +6625,24 @@ Lib3MFResult lib3mf_beamlattice_getbeamset(Lib3MF_BeamLattice pBeamLattice, Lib3
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for FunctionReference
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_functionreference_getfunctionresourceid(Lib3MF_FunctionReference pFunctionReference, Lib3MF_uint32 * pUniqueResourceID)
+Lib3MFResult lib3mf_beamlattice_setballoptions(Lib3MF_BeamLattice pBeamLattice, eLib3MFBeamLatticeBallMode eBallMode, Lib3MF_double dBallRadius)
 {
-	IBase* pIBaseClass = (IBase *)pFunctionReference;
+	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "GetFunctionResourceID");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "SetBallOptions");
+			pJournalEntry->addEnumParameter("BallMode", "BeamLatticeBallMode", (Lib3MF_int32)(eBallMode));
+			pJournalEntry->addDoubleParameter("BallRadius", dBallRadius);
 		}
-		if (pUniqueResourceID == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
-		if (!pIFunctionReference)
+		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
+		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pUniqueResourceID = pIFunctionReference->GetFunctionResourceID();
+		pIBeamLattice->SetBallOptions(eBallMode, dBallRadius);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("UniqueResourceID", *pUniqueResourceID);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -6418,23 +6658,25 @@ Lib3MFResult lib3mf_functionreference_getfunctionresourceid(Lib3MF_FunctionRefer
 	}
 }
 
-Lib3MFResult lib3mf_functionreference_setfunctionresourceid(Lib3MF_FunctionReference pFunctionReference, Lib3MF_uint32 nUniqueResourceID)
+Lib3MFResult lib3mf_beamlattice_getbeamcount(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint32 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pFunctionReference;
+	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "SetFunctionResourceID");
-			pJournalEntry->addUInt32Parameter("UniqueResourceID", nUniqueResourceID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetBeamCount");
 		}
-		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
-		if (!pIFunctionReference)
+		if (pCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
+		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIFunctionReference->SetFunctionResourceID(nUniqueResourceID);
+		*pCount = pIBeamLattice->GetBeamCount();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -6450,22 +6692,23 @@ Lib3MFResult lib3mf_functionreference_setfunctionresourceid(Lib3MF_FunctionRefer
 	}
 }
 
-Lib3MFResult lib3mf_functionreference_gettransform(Lib3MF_FunctionReference pFunctionReference, sLib3MFTransform * pTransform)
+Lib3MFResult lib3mf_beamlattice_getbeam(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint32 nIndex, sLib3MFBeam * pBeamInfo)
 {
-	IBase* pIBaseClass = (IBase *)pFunctionReference;
+	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "GetTransform");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetBeam");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		if (pTransform == nullptr)
+		if (pBeamInfo == nullptr)
 		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
-		if (!pIFunctionReference)
+		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
+		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pTransform = pIFunctionReference->GetTransform();
+		*pBeamInfo = pIBeamLattice->GetBeam(nIndex);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -6483,22 +6726,25 @@ Lib3MFResult lib3mf_functionreference_gettransform(Lib3MF_FunctionReference pFun
 	}
 }
 
-Lib3MFResult lib3mf_functionreference_settransform(Lib3MF_FunctionReference pFunctionReference, const sLib3MFTransform * pTransform)
+Lib3MFResult lib3mf_beamlattice_addbeam(Lib3MF_BeamLattice pBeamLattice, const sLib3MFBeam * pBeamInfo, Lib3MF_uint32 * pIndex)
 {
-	IBase* pIBaseClass = (IBase *)pFunctionReference;
+	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "SetTransform");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "AddBeam");
 		}
-		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
-		if (!pIFunctionReference)
+		if (pIndex == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
+		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIFunctionReference->SetTransform(*pTransform);
+		*pIndex = pIBeamLattice->AddBeam(*pBeamInfo);
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("Index", *pIndex);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -6514,48 +6760,24 @@ Lib3MFResult lib3mf_functionreference_settransform(Lib3MF_FunctionReference pFun
 	}
 }
 
-Lib3MFResult lib3mf_functionreference_getchannelname(Lib3MF_FunctionReference pFunctionReference, const Lib3MF_uint32 nChannelNameBufferSize, Lib3MF_uint32* pChannelNameNeededChars, char * pChannelNameBuffer)
+Lib3MFResult lib3mf_beamlattice_setbeam(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint32 nIndex, const sLib3MFBeam * pBeamInfo)
 {
-	IBase* pIBaseClass = (IBase *)pFunctionReference;
+	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "GetChannelName");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "SetBeam");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		if ( (!pChannelNameBuffer) && !(pChannelNameNeededChars) )
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sChannelName("");
-		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
-		if (!pIFunctionReference)
+		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
+		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pChannelNameBuffer == nullptr);
-		if (isCacheCall) {
-			sChannelName = pIFunctionReference->GetChannelName();
+		pIBeamLattice->SetBeam(nIndex, *pBeamInfo);
 
-			pIFunctionReference->_setCache (new ParameterCache_1<std::string> (sChannelName));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIFunctionReference->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sChannelName);
-			pIFunctionReference->_setCache (nullptr);
-		}
-		
-		if (pChannelNameNeededChars)
-			*pChannelNameNeededChars = (Lib3MF_uint32) (sChannelName.size()+1);
-		if (pChannelNameBuffer) {
-			if (sChannelName.size() >= nChannelNameBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iChannelName = 0; iChannelName < sChannelName.size(); iChannelName++)
-				pChannelNameBuffer[iChannelName] = sChannelName[iChannelName];
-			pChannelNameBuffer[sChannelName.size()] = 0;
-		}
-		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("ChannelName", sChannelName.c_str());
-			pJournalEntry->writeSuccess();
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
 	}
@@ -6570,24 +6792,22 @@ Lib3MFResult lib3mf_functionreference_getchannelname(Lib3MF_FunctionReference pF
 	}
 }
 
-Lib3MFResult lib3mf_functionreference_setchannelname(Lib3MF_FunctionReference pFunctionReference, const char * pChannelName)
+Lib3MFResult lib3mf_beamlattice_setbeams(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint64 nBeamInfoBufferSize, const sLib3MFBeam * pBeamInfoBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pFunctionReference;
+	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "SetChannelName");
-			pJournalEntry->addStringParameter("ChannelName", pChannelName);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "SetBeams");
 		}
-		if (pChannelName == nullptr)
+		if ( (!pBeamInfoBuffer) && (nBeamInfoBufferSize>0))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sChannelName(pChannelName);
-		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
-		if (!pIFunctionReference)
+		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
+		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIFunctionReference->SetChannelName(sChannelName);
+		pIBeamLattice->SetBeams(nBeamInfoBufferSize, pBeamInfoBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -6605,21 +6825,22 @@ Lib3MFResult lib3mf_functionreference_setchannelname(Lib3MF_FunctionReference pF
 	}
 }
 
-Lib3MFResult lib3mf_functionreference_setminfeaturesize(Lib3MF_FunctionReference pFunctionReference, Lib3MF_double dMinFeatureSize)
+Lib3MFResult lib3mf_beamlattice_getbeams(Lib3MF_BeamLattice pBeamLattice, const Lib3MF_uint64 nBeamInfoBufferSize, Lib3MF_uint64* pBeamInfoNeededCount, sLib3MFBeam * pBeamInfoBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pFunctionReference;
+	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "SetMinFeatureSize");
-			pJournalEntry->addDoubleParameter("MinFeatureSize", dMinFeatureSize);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetBeams");
 		}
-		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
-		if (!pIFunctionReference)
+		if ((!pBeamInfoBuffer) && !(pBeamInfoNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
+		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIFunctionReference->SetMinFeatureSize(dMinFeatureSize);
+		pIBeamLattice->GetBeams(nBeamInfoBufferSize, pBeamInfoNeededCount, pBeamInfoBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -6637,25 +6858,25 @@ Lib3MFResult lib3mf_functionreference_setminfeaturesize(Lib3MF_FunctionReference
 	}
 }
 
-Lib3MFResult lib3mf_functionreference_getminfeaturesize(Lib3MF_FunctionReference pFunctionReference, Lib3MF_double * pMinFeatureSize)
+Lib3MFResult lib3mf_beamlattice_getballcount(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint32 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pFunctionReference;
+	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "GetMinFeatureSize");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetBallCount");
 		}
-		if (pMinFeatureSize == nullptr)
+		if (pCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
-		if (!pIFunctionReference)
+		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
+		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pMinFeatureSize = pIFunctionReference->GetMinFeatureSize();
+		*pCount = pIBeamLattice->GetBallCount();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addDoubleResult("MinFeatureSize", *pMinFeatureSize);
+			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -6671,21 +6892,23 @@ Lib3MFResult lib3mf_functionreference_getminfeaturesize(Lib3MF_FunctionReference
 	}
 }
 
-Lib3MFResult lib3mf_functionreference_setfallbackvalue(Lib3MF_FunctionReference pFunctionReference, Lib3MF_double dFallBackValue)
+Lib3MFResult lib3mf_beamlattice_getball(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint32 nIndex, sLib3MFBall * pBallInfo)
 {
-	IBase* pIBaseClass = (IBase *)pFunctionReference;
+	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "SetFallBackValue");
-			pJournalEntry->addDoubleParameter("FallBackValue", dFallBackValue);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetBall");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
-		if (!pIFunctionReference)
+		if (pBallInfo == nullptr)
+		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
+		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIFunctionReference->SetFallBackValue(dFallBackValue);
+		*pBallInfo = pIBeamLattice->GetBall(nIndex);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -6703,25 +6926,25 @@ Lib3MFResult lib3mf_functionreference_setfallbackvalue(Lib3MF_FunctionReference
 	}
 }
 
-Lib3MFResult lib3mf_functionreference_getfallbackvalue(Lib3MF_FunctionReference pFunctionReference, Lib3MF_double * pFallBackValue)
+Lib3MFResult lib3mf_beamlattice_addball(Lib3MF_BeamLattice pBeamLattice, const sLib3MFBall * pBallInfo, Lib3MF_uint32 * pIndex)
 {
-	IBase* pIBaseClass = (IBase *)pFunctionReference;
+	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "GetFallBackValue");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "AddBall");
 		}
-		if (pFallBackValue == nullptr)
+		if (pIndex == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
-		if (!pIFunctionReference)
+		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
+		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pFallBackValue = pIFunctionReference->GetFallBackValue();
+		*pIndex = pIBeamLattice->AddBall(*pBallInfo);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addDoubleResult("FallBackValue", *pFallBackValue);
+			pJournalEntry->addUInt32Result("Index", *pIndex);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -6737,39 +6960,23 @@ Lib3MFResult lib3mf_functionreference_getfallbackvalue(Lib3MF_FunctionReference
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for VolumeDataColor
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for MaterialMapping
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for VolumeDataComposite
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_volumedatacomposite_getbasematerialgroup(Lib3MF_VolumeDataComposite pVolumeDataComposite, Lib3MF_BaseMaterialGroup * pBaseMaterialGroupInstance)
+Lib3MFResult lib3mf_beamlattice_setball(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint32 nIndex, const sLib3MFBall * pBallInfo)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeDataComposite;
+	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeDataComposite, "VolumeDataComposite", "GetBaseMaterialGroup");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "SetBall");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		if (pBaseMaterialGroupInstance == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseBaseMaterialGroupInstance(nullptr);
-		IVolumeDataComposite* pIVolumeDataComposite = dynamic_cast<IVolumeDataComposite*>(pIBaseClass);
-		if (!pIVolumeDataComposite)
+		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
+		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseBaseMaterialGroupInstance = pIVolumeDataComposite->GetBaseMaterialGroup();
+		pIBeamLattice->SetBall(nIndex, *pBallInfo);
 
-		*pBaseMaterialGroupInstance = (IBase*)(pBaseBaseMaterialGroupInstance);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("BaseMaterialGroupInstance", *pBaseMaterialGroupInstance);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -6785,26 +6992,22 @@ Lib3MFResult lib3mf_volumedatacomposite_getbasematerialgroup(Lib3MF_VolumeDataCo
 	}
 }
 
-Lib3MFResult lib3mf_volumedatacomposite_setbasematerialgroup(Lib3MF_VolumeDataComposite pVolumeDataComposite, Lib3MF_BaseMaterialGroup pBaseMaterialGroupInstance)
+Lib3MFResult lib3mf_beamlattice_setballs(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint64 nBallInfoBufferSize, const sLib3MFBall * pBallInfoBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeDataComposite;
+	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeDataComposite, "VolumeDataComposite", "SetBaseMaterialGroup");
-			pJournalEntry->addHandleParameter("BaseMaterialGroupInstance", pBaseMaterialGroupInstance);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "SetBalls");
 		}
-		IBase* pIBaseClassBaseMaterialGroupInstance = (IBase *)pBaseMaterialGroupInstance;
-		IBaseMaterialGroup* pIBaseMaterialGroupInstance = dynamic_cast<IBaseMaterialGroup*>(pIBaseClassBaseMaterialGroupInstance);
-		if (!pIBaseMaterialGroupInstance)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
-		IVolumeDataComposite* pIVolumeDataComposite = dynamic_cast<IVolumeDataComposite*>(pIBaseClass);
-		if (!pIVolumeDataComposite)
+		if ( (!pBallInfoBuffer) && (nBallInfoBufferSize>0))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
+		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIVolumeDataComposite->SetBaseMaterialGroup(pIBaseMaterialGroupInstance);
+		pIBeamLattice->SetBalls(nBallInfoBufferSize, pBallInfoBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -6822,25 +7025,24 @@ Lib3MFResult lib3mf_volumedatacomposite_setbasematerialgroup(Lib3MF_VolumeDataCo
 	}
 }
 
-Lib3MFResult lib3mf_volumedatacomposite_getmaterialmappingcount(Lib3MF_VolumeDataComposite pVolumeDataComposite, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_beamlattice_getballs(Lib3MF_BeamLattice pBeamLattice, const Lib3MF_uint64 nBallInfoBufferSize, Lib3MF_uint64* pBallInfoNeededCount, sLib3MFBall * pBallInfoBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeDataComposite;
+	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeDataComposite, "VolumeDataComposite", "GetMaterialMappingCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetBalls");
 		}
-		if (pCount == nullptr)
+		if ((!pBallInfoBuffer) && !(pBallInfoNeededCount))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IVolumeDataComposite* pIVolumeDataComposite = dynamic_cast<IVolumeDataComposite*>(pIBaseClass);
-		if (!pIVolumeDataComposite)
+		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
+		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pIVolumeDataComposite->GetMaterialMappingCount();
+		pIBeamLattice->GetBalls(nBallInfoBufferSize, pBallInfoNeededCount, pBallInfoBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -6856,28 +7058,25 @@ Lib3MFResult lib3mf_volumedatacomposite_getmaterialmappingcount(Lib3MF_VolumeDat
 	}
 }
 
-Lib3MFResult lib3mf_volumedatacomposite_getmaterialmapping(Lib3MF_VolumeDataComposite pVolumeDataComposite, Lib3MF_uint32 nIndex, Lib3MF_MaterialMapping * pTheMaterialMapping)
+Lib3MFResult lib3mf_beamlattice_getbeamsetcount(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint32 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeDataComposite;
+	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeDataComposite, "VolumeDataComposite", "GetMaterialMapping");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetBeamSetCount");
 		}
-		if (pTheMaterialMapping == nullptr)
+		if (pCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseTheMaterialMapping(nullptr);
-		IVolumeDataComposite* pIVolumeDataComposite = dynamic_cast<IVolumeDataComposite*>(pIBaseClass);
-		if (!pIVolumeDataComposite)
+		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
+		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseTheMaterialMapping = pIVolumeDataComposite->GetMaterialMapping(nIndex);
+		*pCount = pIBeamLattice->GetBeamSetCount();
 
-		*pTheMaterialMapping = (IBase*)(pBaseTheMaterialMapping);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("TheMaterialMapping", *pTheMaterialMapping);
+			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -6893,27 +7092,27 @@ Lib3MFResult lib3mf_volumedatacomposite_getmaterialmapping(Lib3MF_VolumeDataComp
 	}
 }
 
-Lib3MFResult lib3mf_volumedatacomposite_addmaterialmapping(Lib3MF_VolumeDataComposite pVolumeDataComposite, const sLib3MFTransform * pTransform, Lib3MF_MaterialMapping * pTheMaterialMapping)
+Lib3MFResult lib3mf_beamlattice_addbeamset(Lib3MF_BeamLattice pBeamLattice, Lib3MF_BeamSet * pBeamSet)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeDataComposite;
+	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeDataComposite, "VolumeDataComposite", "AddMaterialMapping");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "AddBeamSet");
 		}
-		if (pTheMaterialMapping == nullptr)
+		if (pBeamSet == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseTheMaterialMapping(nullptr);
-		IVolumeDataComposite* pIVolumeDataComposite = dynamic_cast<IVolumeDataComposite*>(pIBaseClass);
-		if (!pIVolumeDataComposite)
+		IBase* pBaseBeamSet(nullptr);
+		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
+		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseTheMaterialMapping = pIVolumeDataComposite->AddMaterialMapping(*pTransform);
+		pBaseBeamSet = pIBeamLattice->AddBeamSet();
 
-		*pTheMaterialMapping = (IBase*)(pBaseTheMaterialMapping);
+		*pBeamSet = (IBase*)(pBaseBeamSet);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("TheMaterialMapping", *pTheMaterialMapping);
+			pJournalEntry->addHandleResult("BeamSet", *pBeamSet);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -6929,23 +7128,28 @@ Lib3MFResult lib3mf_volumedatacomposite_addmaterialmapping(Lib3MF_VolumeDataComp
 	}
 }
 
-Lib3MFResult lib3mf_volumedatacomposite_removematerialmapping(Lib3MF_VolumeDataComposite pVolumeDataComposite, Lib3MF_uint32 nIndex)
+Lib3MFResult lib3mf_beamlattice_getbeamset(Lib3MF_BeamLattice pBeamLattice, Lib3MF_uint32 nIndex, Lib3MF_BeamSet * pBeamSet)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeDataComposite;
+	IBase* pIBaseClass = (IBase *)pBeamLattice;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeDataComposite, "VolumeDataComposite", "RemoveMaterialMapping");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamLattice, "BeamLattice", "GetBeamSet");
 			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		IVolumeDataComposite* pIVolumeDataComposite = dynamic_cast<IVolumeDataComposite*>(pIBaseClass);
-		if (!pIVolumeDataComposite)
+		if (pBeamSet == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseBeamSet(nullptr);
+		IBeamLattice* pIBeamLattice = dynamic_cast<IBeamLattice*>(pIBaseClass);
+		if (!pIBeamLattice)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIVolumeDataComposite->RemoveMaterialMapping(nIndex);
+		pBaseBeamSet = pIBeamLattice->GetBeamSet(nIndex);
 
+		*pBeamSet = (IBase*)(pBaseBeamSet);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("BeamSet", *pBeamSet);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -6963,49 +7167,27 @@ Lib3MFResult lib3mf_volumedatacomposite_removematerialmapping(Lib3MF_VolumeDataC
 
 
 /*************************************************************************************************************************
- Class implementation for VolumeDataProperty
+ Class implementation for FunctionReference
 **************************************************************************************************************************/
-Lib3MFResult lib3mf_volumedataproperty_getname(Lib3MF_VolumeDataProperty pVolumeDataProperty, const Lib3MF_uint32 nPropertyNameBufferSize, Lib3MF_uint32* pPropertyNameNeededChars, char * pPropertyNameBuffer)
+Lib3MFResult lib3mf_functionreference_getfunctionresourceid(Lib3MF_FunctionReference pFunctionReference, Lib3MF_uint32 * pUniqueResourceID)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeDataProperty;
+	IBase* pIBaseClass = (IBase *)pFunctionReference;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeDataProperty, "VolumeDataProperty", "GetName");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "GetFunctionResourceID");
 		}
-		if ( (!pPropertyNameBuffer) && !(pPropertyNameNeededChars) )
+		if (pUniqueResourceID == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sPropertyName("");
-		IVolumeDataProperty* pIVolumeDataProperty = dynamic_cast<IVolumeDataProperty*>(pIBaseClass);
-		if (!pIVolumeDataProperty)
+		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
+		if (!pIFunctionReference)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pPropertyNameBuffer == nullptr);
-		if (isCacheCall) {
-			sPropertyName = pIVolumeDataProperty->GetName();
+		*pUniqueResourceID = pIFunctionReference->GetFunctionResourceID();
 
-			pIVolumeDataProperty->_setCache (new ParameterCache_1<std::string> (sPropertyName));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIVolumeDataProperty->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sPropertyName);
-			pIVolumeDataProperty->_setCache (nullptr);
-		}
-		
-		if (pPropertyNameNeededChars)
-			*pPropertyNameNeededChars = (Lib3MF_uint32) (sPropertyName.size()+1);
-		if (pPropertyNameBuffer) {
-			if (sPropertyName.size() >= nPropertyNameBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iPropertyName = 0; iPropertyName < sPropertyName.size(); iPropertyName++)
-				pPropertyNameBuffer[iPropertyName] = sPropertyName[iPropertyName];
-			pPropertyNameBuffer[sPropertyName.size()] = 0;
-		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("PropertyName", sPropertyName.c_str());
+			pJournalEntry->addUInt32Result("UniqueResourceID", *pUniqueResourceID);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7021,21 +7203,21 @@ Lib3MFResult lib3mf_volumedataproperty_getname(Lib3MF_VolumeDataProperty pVolume
 	}
 }
 
-Lib3MFResult lib3mf_volumedataproperty_setisrequired(Lib3MF_VolumeDataProperty pVolumeDataProperty, bool bIsRequired)
+Lib3MFResult lib3mf_functionreference_setfunctionresourceid(Lib3MF_FunctionReference pFunctionReference, Lib3MF_uint32 nUniqueResourceID)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeDataProperty;
+	IBase* pIBaseClass = (IBase *)pFunctionReference;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeDataProperty, "VolumeDataProperty", "SetIsRequired");
-			pJournalEntry->addBooleanParameter("IsRequired", bIsRequired);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "SetFunctionResourceID");
+			pJournalEntry->addUInt32Parameter("UniqueResourceID", nUniqueResourceID);
 		}
-		IVolumeDataProperty* pIVolumeDataProperty = dynamic_cast<IVolumeDataProperty*>(pIBaseClass);
-		if (!pIVolumeDataProperty)
+		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
+		if (!pIFunctionReference)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIVolumeDataProperty->SetIsRequired(bIsRequired);
+		pIFunctionReference->SetFunctionResourceID(nUniqueResourceID);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -7053,25 +7235,24 @@ Lib3MFResult lib3mf_volumedataproperty_setisrequired(Lib3MF_VolumeDataProperty p
 	}
 }
 
-Lib3MFResult lib3mf_volumedataproperty_isrequired(Lib3MF_VolumeDataProperty pVolumeDataProperty, bool * pIsRequired)
+Lib3MFResult lib3mf_functionreference_gettransform(Lib3MF_FunctionReference pFunctionReference, sLib3MFTransform * pTransform)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeDataProperty;
+	IBase* pIBaseClass = (IBase *)pFunctionReference;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeDataProperty, "VolumeDataProperty", "IsRequired");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "GetTransform");
 		}
-		if (pIsRequired == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IVolumeDataProperty* pIVolumeDataProperty = dynamic_cast<IVolumeDataProperty*>(pIBaseClass);
-		if (!pIVolumeDataProperty)
+		if (pTransform == nullptr)
+		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
+		if (!pIFunctionReference)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pIsRequired = pIVolumeDataProperty->IsRequired();
+		*pTransform = pIFunctionReference->GetTransform();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("IsRequired", *pIsRequired);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7087,31 +7268,22 @@ Lib3MFResult lib3mf_volumedataproperty_isrequired(Lib3MF_VolumeDataProperty pVol
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for VolumeData
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_volumedata_getcomposite(Lib3MF_VolumeData pVolumeData, Lib3MF_VolumeDataComposite * pTheCompositeData)
+Lib3MFResult lib3mf_functionreference_settransform(Lib3MF_FunctionReference pFunctionReference, const sLib3MFTransform * pTransform)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeData;
+	IBase* pIBaseClass = (IBase *)pFunctionReference;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "GetComposite");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "SetTransform");
 		}
-		if (pTheCompositeData == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseTheCompositeData(nullptr);
-		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
-		if (!pIVolumeData)
+		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
+		if (!pIFunctionReference)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseTheCompositeData = pIVolumeData->GetComposite();
+		pIFunctionReference->SetTransform(*pTransform);
 
-		*pTheCompositeData = (IBase*)(pBaseTheCompositeData);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("TheCompositeData", *pTheCompositeData);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7127,27 +7299,47 @@ Lib3MFResult lib3mf_volumedata_getcomposite(Lib3MF_VolumeData pVolumeData, Lib3M
 	}
 }
 
-Lib3MFResult lib3mf_volumedata_createnewcomposite(Lib3MF_VolumeData pVolumeData, Lib3MF_VolumeDataComposite * pTheCompositeData)
+Lib3MFResult lib3mf_functionreference_getchannelname(Lib3MF_FunctionReference pFunctionReference, const Lib3MF_uint32 nChannelNameBufferSize, Lib3MF_uint32* pChannelNameNeededChars, char * pChannelNameBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeData;
+	IBase* pIBaseClass = (IBase *)pFunctionReference;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "CreateNewComposite");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "GetChannelName");
 		}
-		if (pTheCompositeData == nullptr)
+		if ( (!pChannelNameBuffer) && !(pChannelNameNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseTheCompositeData(nullptr);
-		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
-		if (!pIVolumeData)
+		std::string sChannelName("");
+		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
+		if (!pIFunctionReference)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseTheCompositeData = pIVolumeData->CreateNewComposite();
+		bool isCacheCall = (pChannelNameBuffer == nullptr);
+		if (isCacheCall) {
+			sChannelName = pIFunctionReference->GetChannelName();
 
-		*pTheCompositeData = (IBase*)(pBaseTheCompositeData);
+			pIFunctionReference->_setCache (new ParameterCache_1<std::string> (sChannelName));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIFunctionReference->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sChannelName);
+			pIFunctionReference->_setCache (nullptr);
+		}
+		
+		if (pChannelNameNeededChars)
+			*pChannelNameNeededChars = (Lib3MF_uint32) (sChannelName.size()+1);
+		if (pChannelNameBuffer) {
+			if (sChannelName.size() >= nChannelNameBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iChannelName = 0; iChannelName < sChannelName.size(); iChannelName++)
+				pChannelNameBuffer[iChannelName] = sChannelName[iChannelName];
+			pChannelNameBuffer[sChannelName.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("TheCompositeData", *pTheCompositeData);
+			pJournalEntry->addStringResult("ChannelName", sChannelName.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7163,20 +7355,24 @@ Lib3MFResult lib3mf_volumedata_createnewcomposite(Lib3MF_VolumeData pVolumeData,
 	}
 }
 
-Lib3MFResult lib3mf_volumedata_removecomposite(Lib3MF_VolumeData pVolumeData)
+Lib3MFResult lib3mf_functionreference_setchannelname(Lib3MF_FunctionReference pFunctionReference, const char * pChannelName)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeData;
+	IBase* pIBaseClass = (IBase *)pFunctionReference;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "RemoveComposite");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "SetChannelName");
+			pJournalEntry->addStringParameter("ChannelName", pChannelName);
 		}
-		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
-		if (!pIVolumeData)
+		if (pChannelName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sChannelName(pChannelName);
+		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
+		if (!pIFunctionReference)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIVolumeData->RemoveComposite();
+		pIFunctionReference->SetChannelName(sChannelName);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -7194,27 +7390,23 @@ Lib3MFResult lib3mf_volumedata_removecomposite(Lib3MF_VolumeData pVolumeData)
 	}
 }
 
-Lib3MFResult lib3mf_volumedata_getcolor(Lib3MF_VolumeData pVolumeData, Lib3MF_VolumeDataColor * pTheColorData)
+Lib3MFResult lib3mf_functionreference_setminfeaturesize(Lib3MF_FunctionReference pFunctionReference, Lib3MF_double dMinFeatureSize)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeData;
+	IBase* pIBaseClass = (IBase *)pFunctionReference;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "GetColor");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "SetMinFeatureSize");
+			pJournalEntry->addDoubleParameter("MinFeatureSize", dMinFeatureSize);
 		}
-		if (pTheColorData == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseTheColorData(nullptr);
-		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
-		if (!pIVolumeData)
+		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
+		if (!pIFunctionReference)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseTheColorData = pIVolumeData->GetColor();
+		pIFunctionReference->SetMinFeatureSize(dMinFeatureSize);
 
-		*pTheColorData = (IBase*)(pBaseTheColorData);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("TheColorData", *pTheColorData);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7230,33 +7422,25 @@ Lib3MFResult lib3mf_volumedata_getcolor(Lib3MF_VolumeData pVolumeData, Lib3MF_Vo
 	}
 }
 
-Lib3MFResult lib3mf_volumedata_createnewcolor(Lib3MF_VolumeData pVolumeData, Lib3MF_Function pTheFunction, Lib3MF_VolumeDataColor * pTheColorData)
+Lib3MFResult lib3mf_functionreference_getminfeaturesize(Lib3MF_FunctionReference pFunctionReference, Lib3MF_double * pMinFeatureSize)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeData;
+	IBase* pIBaseClass = (IBase *)pFunctionReference;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "CreateNewColor");
-			pJournalEntry->addHandleParameter("TheFunction", pTheFunction);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "GetMinFeatureSize");
 		}
-		if (pTheColorData == nullptr)
+		if (pMinFeatureSize == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pIBaseClassTheFunction = (IBase *)pTheFunction;
-		IFunction* pITheFunction = dynamic_cast<IFunction*>(pIBaseClassTheFunction);
-		if (!pITheFunction)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
-		IBase* pBaseTheColorData(nullptr);
-		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
-		if (!pIVolumeData)
+		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
+		if (!pIFunctionReference)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseTheColorData = pIVolumeData->CreateNewColor(pITheFunction);
+		*pMinFeatureSize = pIFunctionReference->GetMinFeatureSize();
 
-		*pTheColorData = (IBase*)(pBaseTheColorData);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("TheColorData", *pTheColorData);
+			pJournalEntry->addDoubleResult("MinFeatureSize", *pMinFeatureSize);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7272,20 +7456,21 @@ Lib3MFResult lib3mf_volumedata_createnewcolor(Lib3MF_VolumeData pVolumeData, Lib
 	}
 }
 
-Lib3MFResult lib3mf_volumedata_removecolor(Lib3MF_VolumeData pVolumeData)
+Lib3MFResult lib3mf_functionreference_setfallbackvalue(Lib3MF_FunctionReference pFunctionReference, Lib3MF_double dFallBackValue)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeData;
+	IBase* pIBaseClass = (IBase *)pFunctionReference;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "RemoveColor");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "SetFallBackValue");
+			pJournalEntry->addDoubleParameter("FallBackValue", dFallBackValue);
 		}
-		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
-		if (!pIVolumeData)
+		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
+		if (!pIFunctionReference)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIVolumeData->RemoveColor();
+		pIFunctionReference->SetFallBackValue(dFallBackValue);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -7303,25 +7488,25 @@ Lib3MFResult lib3mf_volumedata_removecolor(Lib3MF_VolumeData pVolumeData)
 	}
 }
 
-Lib3MFResult lib3mf_volumedata_getpropertycount(Lib3MF_VolumeData pVolumeData, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_functionreference_getfallbackvalue(Lib3MF_FunctionReference pFunctionReference, Lib3MF_double * pFallBackValue)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeData;
+	IBase* pIBaseClass = (IBase *)pFunctionReference;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "GetPropertyCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionReference, "FunctionReference", "GetFallBackValue");
 		}
-		if (pCount == nullptr)
+		if (pFallBackValue == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
-		if (!pIVolumeData)
+		IFunctionReference* pIFunctionReference = dynamic_cast<IFunctionReference*>(pIBaseClass);
+		if (!pIFunctionReference)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pIVolumeData->GetPropertyCount();
+		*pFallBackValue = pIFunctionReference->GetFallBackValue();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Count", *pCount);
+			pJournalEntry->addDoubleResult("FallBackValue", *pFallBackValue);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7337,28 +7522,39 @@ Lib3MFResult lib3mf_volumedata_getpropertycount(Lib3MF_VolumeData pVolumeData, L
 	}
 }
 
-Lib3MFResult lib3mf_volumedata_getproperty(Lib3MF_VolumeData pVolumeData, Lib3MF_uint32 nIndex, Lib3MF_VolumeDataProperty * pTheVolumeDataProperty)
+
+/*************************************************************************************************************************
+ Class implementation for VolumeDataColor
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for MaterialMapping
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for VolumeDataComposite
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_volumedatacomposite_getbasematerialgroup(Lib3MF_VolumeDataComposite pVolumeDataComposite, Lib3MF_BaseMaterialGroup * pBaseMaterialGroupInstance)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeData;
+	IBase* pIBaseClass = (IBase *)pVolumeDataComposite;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "GetProperty");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeDataComposite, "VolumeDataComposite", "GetBaseMaterialGroup");
 		}
-		if (pTheVolumeDataProperty == nullptr)
+		if (pBaseMaterialGroupInstance == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseTheVolumeDataProperty(nullptr);
-		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
-		if (!pIVolumeData)
+		IBase* pBaseBaseMaterialGroupInstance(nullptr);
+		IVolumeDataComposite* pIVolumeDataComposite = dynamic_cast<IVolumeDataComposite*>(pIBaseClass);
+		if (!pIVolumeDataComposite)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseTheVolumeDataProperty = pIVolumeData->GetProperty(nIndex);
+		pBaseBaseMaterialGroupInstance = pIVolumeDataComposite->GetBaseMaterialGroup();
 
-		*pTheVolumeDataProperty = (IBase*)(pBaseTheVolumeDataProperty);
+		*pBaseMaterialGroupInstance = (IBase*)(pBaseBaseMaterialGroupInstance);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("TheVolumeDataProperty", *pTheVolumeDataProperty);
+			pJournalEntry->addHandleResult("BaseMaterialGroupInstance", *pBaseMaterialGroupInstance);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7374,37 +7570,28 @@ Lib3MFResult lib3mf_volumedata_getproperty(Lib3MF_VolumeData pVolumeData, Lib3MF
 	}
 }
 
-Lib3MFResult lib3mf_volumedata_addpropertyfromfunction(Lib3MF_VolumeData pVolumeData, const char * pName, Lib3MF_Function pTheFunction, Lib3MF_VolumeDataProperty * pTheVolumeDataProperty)
+Lib3MFResult lib3mf_volumedatacomposite_setbasematerialgroup(Lib3MF_VolumeDataComposite pVolumeDataComposite, Lib3MF_BaseMaterialGroup pBaseMaterialGroupInstance)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeData;
+	IBase* pIBaseClass = (IBase *)pVolumeDataComposite;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "AddPropertyFromFunction");
-			pJournalEntry->addStringParameter("Name", pName);
-			pJournalEntry->addHandleParameter("TheFunction", pTheFunction);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeDataComposite, "VolumeDataComposite", "SetBaseMaterialGroup");
+			pJournalEntry->addHandleParameter("BaseMaterialGroupInstance", pBaseMaterialGroupInstance);
 		}
-		if (pName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pTheVolumeDataProperty == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sName(pName);
-		IBase* pIBaseClassTheFunction = (IBase *)pTheFunction;
-		IFunction* pITheFunction = dynamic_cast<IFunction*>(pIBaseClassTheFunction);
-		if (!pITheFunction)
+		IBase* pIBaseClassBaseMaterialGroupInstance = (IBase *)pBaseMaterialGroupInstance;
+		IBaseMaterialGroup* pIBaseMaterialGroupInstance = dynamic_cast<IBaseMaterialGroup*>(pIBaseClassBaseMaterialGroupInstance);
+		if (!pIBaseMaterialGroupInstance)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
 		
-		IBase* pBaseTheVolumeDataProperty(nullptr);
-		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
-		if (!pIVolumeData)
+		IVolumeDataComposite* pIVolumeDataComposite = dynamic_cast<IVolumeDataComposite*>(pIBaseClass);
+		if (!pIVolumeDataComposite)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseTheVolumeDataProperty = pIVolumeData->AddPropertyFromFunction(sName, pITheFunction);
+		pIVolumeDataComposite->SetBaseMaterialGroup(pIBaseMaterialGroupInstance);
 
-		*pTheVolumeDataProperty = (IBase*)(pBaseTheVolumeDataProperty);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("TheVolumeDataProperty", *pTheVolumeDataProperty);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7420,23 +7607,25 @@ Lib3MFResult lib3mf_volumedata_addpropertyfromfunction(Lib3MF_VolumeData pVolume
 	}
 }
 
-Lib3MFResult lib3mf_volumedata_removeproperty(Lib3MF_VolumeData pVolumeData, Lib3MF_uint32 nIndex)
+Lib3MFResult lib3mf_volumedatacomposite_getmaterialmappingcount(Lib3MF_VolumeDataComposite pVolumeDataComposite, Lib3MF_uint32 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pVolumeData;
+	IBase* pIBaseClass = (IBase *)pVolumeDataComposite;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "RemoveProperty");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeDataComposite, "VolumeDataComposite", "GetMaterialMappingCount");
 		}
-		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
-		if (!pIVolumeData)
+		if (pCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IVolumeDataComposite* pIVolumeDataComposite = dynamic_cast<IVolumeDataComposite*>(pIBaseClass);
+		if (!pIVolumeDataComposite)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIVolumeData->RemoveProperty(nIndex);
+		*pCount = pIVolumeDataComposite->GetMaterialMappingCount();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7452,31 +7641,28 @@ Lib3MFResult lib3mf_volumedata_removeproperty(Lib3MF_VolumeData pVolumeData, Lib
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for Component
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_component_getobjectresource(Lib3MF_Component pComponent, Lib3MF_Object * pObjectResource)
+Lib3MFResult lib3mf_volumedatacomposite_getmaterialmapping(Lib3MF_VolumeDataComposite pVolumeDataComposite, Lib3MF_uint32 nIndex, Lib3MF_MaterialMapping * pTheMaterialMapping)
 {
-	IBase* pIBaseClass = (IBase *)pComponent;
+	IBase* pIBaseClass = (IBase *)pVolumeDataComposite;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponent, "Component", "GetObjectResource");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeDataComposite, "VolumeDataComposite", "GetMaterialMapping");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		if (pObjectResource == nullptr)
+		if (pTheMaterialMapping == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseObjectResource(nullptr);
-		IComponent* pIComponent = dynamic_cast<IComponent*>(pIBaseClass);
-		if (!pIComponent)
+		IBase* pBaseTheMaterialMapping(nullptr);
+		IVolumeDataComposite* pIVolumeDataComposite = dynamic_cast<IVolumeDataComposite*>(pIBaseClass);
+		if (!pIVolumeDataComposite)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseObjectResource = pIComponent->GetObjectResource();
+		pBaseTheMaterialMapping = pIVolumeDataComposite->GetMaterialMapping(nIndex);
 
-		*pObjectResource = (IBase*)(pBaseObjectResource);
+		*pTheMaterialMapping = (IBase*)(pBaseTheMaterialMapping);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("ObjectResource", *pObjectResource);
+			pJournalEntry->addHandleResult("TheMaterialMapping", *pTheMaterialMapping);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7492,25 +7678,27 @@ Lib3MFResult lib3mf_component_getobjectresource(Lib3MF_Component pComponent, Lib
 	}
 }
 
-Lib3MFResult lib3mf_component_getobjectresourceid(Lib3MF_Component pComponent, Lib3MF_uint32 * pUniqueResourceID)
+Lib3MFResult lib3mf_volumedatacomposite_addmaterialmapping(Lib3MF_VolumeDataComposite pVolumeDataComposite, const sLib3MFTransform * pTransform, Lib3MF_MaterialMapping * pTheMaterialMapping)
 {
-	IBase* pIBaseClass = (IBase *)pComponent;
+	IBase* pIBaseClass = (IBase *)pVolumeDataComposite;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponent, "Component", "GetObjectResourceID");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeDataComposite, "VolumeDataComposite", "AddMaterialMapping");
 		}
-		if (pUniqueResourceID == nullptr)
+		if (pTheMaterialMapping == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IComponent* pIComponent = dynamic_cast<IComponent*>(pIBaseClass);
-		if (!pIComponent)
+		IBase* pBaseTheMaterialMapping(nullptr);
+		IVolumeDataComposite* pIVolumeDataComposite = dynamic_cast<IVolumeDataComposite*>(pIBaseClass);
+		if (!pIVolumeDataComposite)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pUniqueResourceID = pIComponent->GetObjectResourceID();
+		pBaseTheMaterialMapping = pIVolumeDataComposite->AddMaterialMapping(*pTransform);
 
+		*pTheMaterialMapping = (IBase*)(pBaseTheMaterialMapping);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("UniqueResourceID", *pUniqueResourceID);
+			pJournalEntry->addHandleResult("TheMaterialMapping", *pTheMaterialMapping);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7526,50 +7714,23 @@ Lib3MFResult lib3mf_component_getobjectresourceid(Lib3MF_Component pComponent, L
 	}
 }
 
-Lib3MFResult lib3mf_component_getuuid(Lib3MF_Component pComponent, bool * pHasUUID, const Lib3MF_uint32 nUUIDBufferSize, Lib3MF_uint32* pUUIDNeededChars, char * pUUIDBuffer)
+Lib3MFResult lib3mf_volumedatacomposite_removematerialmapping(Lib3MF_VolumeDataComposite pVolumeDataComposite, Lib3MF_uint32 nIndex)
 {
-	IBase* pIBaseClass = (IBase *)pComponent;
+	IBase* pIBaseClass = (IBase *)pVolumeDataComposite;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponent, "Component", "GetUUID");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeDataComposite, "VolumeDataComposite", "RemoveMaterialMapping");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		if (!pHasUUID)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if ( (!pUUIDBuffer) && !(pUUIDNeededChars) )
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sUUID("");
-		IComponent* pIComponent = dynamic_cast<IComponent*>(pIBaseClass);
-		if (!pIComponent)
+		IVolumeDataComposite* pIVolumeDataComposite = dynamic_cast<IVolumeDataComposite*>(pIBaseClass);
+		if (!pIVolumeDataComposite)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pUUIDBuffer == nullptr);
-		if (isCacheCall) {
-			sUUID = pIComponent->GetUUID(*pHasUUID);
+		pIVolumeDataComposite->RemoveMaterialMapping(nIndex);
 
-			pIComponent->_setCache (new ParameterCache_2<bool, std::string> (*pHasUUID, sUUID));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_2<bool, std::string>*> (pIComponent->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (*pHasUUID, sUUID);
-			pIComponent->_setCache (nullptr);
-		}
-		
-		if (pUUIDNeededChars)
-			*pUUIDNeededChars = (Lib3MF_uint32) (sUUID.size()+1);
-		if (pUUIDBuffer) {
-			if (sUUID.size() >= nUUIDBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iUUID = 0; iUUID < sUUID.size(); iUUID++)
-				pUUIDBuffer[iUUID] = sUUID[iUUID];
-			pUUIDBuffer[sUUID.size()] = 0;
-		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("HasUUID", *pHasUUID);
-			pJournalEntry->addStringResult("UUID", sUUID.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7585,26 +7746,51 @@ Lib3MFResult lib3mf_component_getuuid(Lib3MF_Component pComponent, bool * pHasUU
 	}
 }
 
-Lib3MFResult lib3mf_component_setuuid(Lib3MF_Component pComponent, const char * pUUID)
+
+/*************************************************************************************************************************
+ Class implementation for VolumeDataProperty
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_volumedataproperty_getname(Lib3MF_VolumeDataProperty pVolumeDataProperty, const Lib3MF_uint32 nPropertyNameBufferSize, Lib3MF_uint32* pPropertyNameNeededChars, char * pPropertyNameBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pComponent;
+	IBase* pIBaseClass = (IBase *)pVolumeDataProperty;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponent, "Component", "SetUUID");
-			pJournalEntry->addStringParameter("UUID", pUUID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeDataProperty, "VolumeDataProperty", "GetName");
 		}
-		if (pUUID == nullptr)
+		if ( (!pPropertyNameBuffer) && !(pPropertyNameNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sUUID(pUUID);
-		IComponent* pIComponent = dynamic_cast<IComponent*>(pIBaseClass);
-		if (!pIComponent)
+		std::string sPropertyName("");
+		IVolumeDataProperty* pIVolumeDataProperty = dynamic_cast<IVolumeDataProperty*>(pIBaseClass);
+		if (!pIVolumeDataProperty)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIComponent->SetUUID(sUUID);
+		bool isCacheCall = (pPropertyNameBuffer == nullptr);
+		if (isCacheCall) {
+			sPropertyName = pIVolumeDataProperty->GetName();
 
+			pIVolumeDataProperty->_setCache (new ParameterCache_1<std::string> (sPropertyName));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIVolumeDataProperty->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sPropertyName);
+			pIVolumeDataProperty->_setCache (nullptr);
+		}
+		
+		if (pPropertyNameNeededChars)
+			*pPropertyNameNeededChars = (Lib3MF_uint32) (sPropertyName.size()+1);
+		if (pPropertyNameBuffer) {
+			if (sPropertyName.size() >= nPropertyNameBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iPropertyName = 0; iPropertyName < sPropertyName.size(); iPropertyName++)
+				pPropertyNameBuffer[iPropertyName] = sPropertyName[iPropertyName];
+			pPropertyNameBuffer[sPropertyName.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addStringResult("PropertyName", sPropertyName.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7620,25 +7806,23 @@ Lib3MFResult lib3mf_component_setuuid(Lib3MF_Component pComponent, const char *
 	}
 }
 
-Lib3MFResult lib3mf_component_hastransform(Lib3MF_Component pComponent, bool * pHasTransform)
+Lib3MFResult lib3mf_volumedataproperty_setisrequired(Lib3MF_VolumeDataProperty pVolumeDataProperty, bool bIsRequired)
 {
-	IBase* pIBaseClass = (IBase *)pComponent;
+	IBase* pIBaseClass = (IBase *)pVolumeDataProperty;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponent, "Component", "HasTransform");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeDataProperty, "VolumeDataProperty", "SetIsRequired");
+			pJournalEntry->addBooleanParameter("IsRequired", bIsRequired);
 		}
-		if (pHasTransform == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IComponent* pIComponent = dynamic_cast<IComponent*>(pIBaseClass);
-		if (!pIComponent)
+		IVolumeDataProperty* pIVolumeDataProperty = dynamic_cast<IVolumeDataProperty*>(pIBaseClass);
+		if (!pIVolumeDataProperty)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pHasTransform = pIComponent->HasTransform();
+		pIVolumeDataProperty->SetIsRequired(bIsRequired);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("HasTransform", *pHasTransform);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7654,24 +7838,25 @@ Lib3MFResult lib3mf_component_hastransform(Lib3MF_Component pComponent, bool * p
 	}
 }
 
-Lib3MFResult lib3mf_component_gettransform(Lib3MF_Component pComponent, sLib3MFTransform * pTransform)
+Lib3MFResult lib3mf_volumedataproperty_isrequired(Lib3MF_VolumeDataProperty pVolumeDataProperty, bool * pIsRequired)
 {
-	IBase* pIBaseClass = (IBase *)pComponent;
+	IBase* pIBaseClass = (IBase *)pVolumeDataProperty;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponent, "Component", "GetTransform");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeDataProperty, "VolumeDataProperty", "IsRequired");
 		}
-		if (pTransform == nullptr)
-		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IComponent* pIComponent = dynamic_cast<IComponent*>(pIBaseClass);
-		if (!pIComponent)
+		if (pIsRequired == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IVolumeDataProperty* pIVolumeDataProperty = dynamic_cast<IVolumeDataProperty*>(pIBaseClass);
+		if (!pIVolumeDataProperty)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pTransform = pIComponent->GetTransform();
+		*pIsRequired = pIVolumeDataProperty->IsRequired();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addBooleanResult("IsRequired", *pIsRequired);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7687,22 +7872,31 @@ Lib3MFResult lib3mf_component_gettransform(Lib3MF_Component pComponent, sLib3MFT
 	}
 }
 
-Lib3MFResult lib3mf_component_settransform(Lib3MF_Component pComponent, const sLib3MFTransform * pTransform)
+
+/*************************************************************************************************************************
+ Class implementation for VolumeData
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_volumedata_getcomposite(Lib3MF_VolumeData pVolumeData, Lib3MF_VolumeDataComposite * pTheCompositeData)
 {
-	IBase* pIBaseClass = (IBase *)pComponent;
+	IBase* pIBaseClass = (IBase *)pVolumeData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponent, "Component", "SetTransform");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "GetComposite");
 		}
-		IComponent* pIComponent = dynamic_cast<IComponent*>(pIBaseClass);
-		if (!pIComponent)
+		if (pTheCompositeData == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseTheCompositeData(nullptr);
+		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
+		if (!pIVolumeData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIComponent->SetTransform(*pTransform);
+		pBaseTheCompositeData = pIVolumeData->GetComposite();
 
+		*pTheCompositeData = (IBase*)(pBaseTheCompositeData);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("TheCompositeData", *pTheCompositeData);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7718,37 +7912,27 @@ Lib3MFResult lib3mf_component_settransform(Lib3MF_Component pComponent, const sL
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for ComponentsObject
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_componentsobject_addcomponent(Lib3MF_ComponentsObject pComponentsObject, Lib3MF_Object pObjectResource, const sLib3MFTransform * pTransform, Lib3MF_Component * pComponentInstance)
+Lib3MFResult lib3mf_volumedata_createnewcomposite(Lib3MF_VolumeData pVolumeData, Lib3MF_VolumeDataComposite * pTheCompositeData)
 {
-	IBase* pIBaseClass = (IBase *)pComponentsObject;
+	IBase* pIBaseClass = (IBase *)pVolumeData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponentsObject, "ComponentsObject", "AddComponent");
-			pJournalEntry->addHandleParameter("ObjectResource", pObjectResource);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "CreateNewComposite");
 		}
-		if (pComponentInstance == nullptr)
+		if (pTheCompositeData == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pIBaseClassObjectResource = (IBase *)pObjectResource;
-		IObject* pIObjectResource = dynamic_cast<IObject*>(pIBaseClassObjectResource);
-		if (!pIObjectResource)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
-		IBase* pBaseComponentInstance(nullptr);
-		IComponentsObject* pIComponentsObject = dynamic_cast<IComponentsObject*>(pIBaseClass);
-		if (!pIComponentsObject)
+		IBase* pBaseTheCompositeData(nullptr);
+		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
+		if (!pIVolumeData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseComponentInstance = pIComponentsObject->AddComponent(pIObjectResource, *pTransform);
+		pBaseTheCompositeData = pIVolumeData->CreateNewComposite();
 
-		*pComponentInstance = (IBase*)(pBaseComponentInstance);
+		*pTheCompositeData = (IBase*)(pBaseTheCompositeData);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("ComponentInstance", *pComponentInstance);
+			pJournalEntry->addHandleResult("TheCompositeData", *pTheCompositeData);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7764,28 +7948,22 @@ Lib3MFResult lib3mf_componentsobject_addcomponent(Lib3MF_ComponentsObject pCompo
 	}
 }
 
-Lib3MFResult lib3mf_componentsobject_getcomponent(Lib3MF_ComponentsObject pComponentsObject, Lib3MF_uint32 nIndex, Lib3MF_Component * pComponentInstance)
+Lib3MFResult lib3mf_volumedata_removecomposite(Lib3MF_VolumeData pVolumeData)
 {
-	IBase* pIBaseClass = (IBase *)pComponentsObject;
+	IBase* pIBaseClass = (IBase *)pVolumeData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponentsObject, "ComponentsObject", "GetComponent");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "RemoveComposite");
 		}
-		if (pComponentInstance == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseComponentInstance(nullptr);
-		IComponentsObject* pIComponentsObject = dynamic_cast<IComponentsObject*>(pIBaseClass);
-		if (!pIComponentsObject)
+		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
+		if (!pIVolumeData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseComponentInstance = pIComponentsObject->GetComponent(nIndex);
+		pIVolumeData->RemoveComposite();
 
-		*pComponentInstance = (IBase*)(pBaseComponentInstance);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("ComponentInstance", *pComponentInstance);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7801,25 +7979,27 @@ Lib3MFResult lib3mf_componentsobject_getcomponent(Lib3MF_ComponentsObject pCompo
 	}
 }
 
-Lib3MFResult lib3mf_componentsobject_getcomponentcount(Lib3MF_ComponentsObject pComponentsObject, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_volumedata_getcolor(Lib3MF_VolumeData pVolumeData, Lib3MF_VolumeDataColor * pTheColorData)
 {
-	IBase* pIBaseClass = (IBase *)pComponentsObject;
+	IBase* pIBaseClass = (IBase *)pVolumeData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponentsObject, "ComponentsObject", "GetComponentCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "GetColor");
 		}
-		if (pCount == nullptr)
+		if (pTheColorData == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IComponentsObject* pIComponentsObject = dynamic_cast<IComponentsObject*>(pIBaseClass);
-		if (!pIComponentsObject)
+		IBase* pBaseTheColorData(nullptr);
+		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
+		if (!pIVolumeData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pIComponentsObject->GetComponentCount();
+		pBaseTheColorData = pIVolumeData->GetColor();
 
+		*pTheColorData = (IBase*)(pBaseTheColorData);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Count", *pCount);
+			pJournalEntry->addHandleResult("TheColorData", *pTheColorData);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7835,30 +8015,33 @@ Lib3MFResult lib3mf_componentsobject_getcomponentcount(Lib3MF_ComponentsObject p
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for BeamSet
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_beamset_setname(Lib3MF_BeamSet pBeamSet, const char * pName)
+Lib3MFResult lib3mf_volumedata_createnewcolor(Lib3MF_VolumeData pVolumeData, Lib3MF_Function pTheFunction, Lib3MF_VolumeDataColor * pTheColorData)
 {
-	IBase* pIBaseClass = (IBase *)pBeamSet;
+	IBase* pIBaseClass = (IBase *)pVolumeData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "SetName");
-			pJournalEntry->addStringParameter("Name", pName);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "CreateNewColor");
+			pJournalEntry->addHandleParameter("TheFunction", pTheFunction);
 		}
-		if (pName == nullptr)
+		if (pTheColorData == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sName(pName);
-		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
-		if (!pIBeamSet)
+		IBase* pIBaseClassTheFunction = (IBase *)pTheFunction;
+		IFunction* pITheFunction = dynamic_cast<IFunction*>(pIBaseClassTheFunction);
+		if (!pITheFunction)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
+		IBase* pBaseTheColorData(nullptr);
+		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
+		if (!pIVolumeData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBeamSet->SetName(sName);
+		pBaseTheColorData = pIVolumeData->CreateNewColor(pITheFunction);
 
+		*pTheColorData = (IBase*)(pBaseTheColorData);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("TheColorData", *pTheColorData);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7874,47 +8057,22 @@ Lib3MFResult lib3mf_beamset_setname(Lib3MF_BeamSet pBeamSet, const char * pName)
 	}
 }
 
-Lib3MFResult lib3mf_beamset_getname(Lib3MF_BeamSet pBeamSet, const Lib3MF_uint32 nNameBufferSize, Lib3MF_uint32* pNameNeededChars, char * pNameBuffer)
+Lib3MFResult lib3mf_volumedata_removecolor(Lib3MF_VolumeData pVolumeData)
 {
-	IBase* pIBaseClass = (IBase *)pBeamSet;
+	IBase* pIBaseClass = (IBase *)pVolumeData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "GetName");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "RemoveColor");
 		}
-		if ( (!pNameBuffer) && !(pNameNeededChars) )
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sName("");
-		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
-		if (!pIBeamSet)
+		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
+		if (!pIVolumeData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pNameBuffer == nullptr);
-		if (isCacheCall) {
-			sName = pIBeamSet->GetName();
+		pIVolumeData->RemoveColor();
 
-			pIBeamSet->_setCache (new ParameterCache_1<std::string> (sName));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIBeamSet->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sName);
-			pIBeamSet->_setCache (nullptr);
-		}
-		
-		if (pNameNeededChars)
-			*pNameNeededChars = (Lib3MF_uint32) (sName.size()+1);
-		if (pNameBuffer) {
-			if (sName.size() >= nNameBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iName = 0; iName < sName.size(); iName++)
-				pNameBuffer[iName] = sName[iName];
-			pNameBuffer[sName.size()] = 0;
-		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Name", sName.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7930,26 +8088,25 @@ Lib3MFResult lib3mf_beamset_getname(Lib3MF_BeamSet pBeamSet, const Lib3MF_uint32
 	}
 }
 
-Lib3MFResult lib3mf_beamset_setidentifier(Lib3MF_BeamSet pBeamSet, const char * pIdentifier)
+Lib3MFResult lib3mf_volumedata_getpropertycount(Lib3MF_VolumeData pVolumeData, Lib3MF_uint32 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pBeamSet;
+	IBase* pIBaseClass = (IBase *)pVolumeData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "SetIdentifier");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "GetPropertyCount");
 		}
-		if (pIdentifier == nullptr)
+		if (pCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
-		if (!pIBeamSet)
+		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
+		if (!pIVolumeData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBeamSet->SetIdentifier(sIdentifier);
+		*pCount = pIVolumeData->GetPropertyCount();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -7965,47 +8122,28 @@ Lib3MFResult lib3mf_beamset_setidentifier(Lib3MF_BeamSet pBeamSet, const char *
 	}
 }
 
-Lib3MFResult lib3mf_beamset_getidentifier(Lib3MF_BeamSet pBeamSet, const Lib3MF_uint32 nIdentifierBufferSize, Lib3MF_uint32* pIdentifierNeededChars, char * pIdentifierBuffer)
+Lib3MFResult lib3mf_volumedata_getproperty(Lib3MF_VolumeData pVolumeData, Lib3MF_uint32 nIndex, Lib3MF_VolumeDataProperty * pTheVolumeDataProperty)
 {
-	IBase* pIBaseClass = (IBase *)pBeamSet;
+	IBase* pIBaseClass = (IBase *)pVolumeData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "GetIdentifier");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "GetProperty");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		if ( (!pIdentifierBuffer) && !(pIdentifierNeededChars) )
+		if (pTheVolumeDataProperty == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier("");
-		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
-		if (!pIBeamSet)
+		IBase* pBaseTheVolumeDataProperty(nullptr);
+		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
+		if (!pIVolumeData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pIdentifierBuffer == nullptr);
-		if (isCacheCall) {
-			sIdentifier = pIBeamSet->GetIdentifier();
+		pBaseTheVolumeDataProperty = pIVolumeData->GetProperty(nIndex);
 
-			pIBeamSet->_setCache (new ParameterCache_1<std::string> (sIdentifier));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIBeamSet->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sIdentifier);
-			pIBeamSet->_setCache (nullptr);
-		}
-		
-		if (pIdentifierNeededChars)
-			*pIdentifierNeededChars = (Lib3MF_uint32) (sIdentifier.size()+1);
-		if (pIdentifierBuffer) {
-			if (sIdentifier.size() >= nIdentifierBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iIdentifier = 0; iIdentifier < sIdentifier.size(); iIdentifier++)
-				pIdentifierBuffer[iIdentifier] = sIdentifier[iIdentifier];
-			pIdentifierBuffer[sIdentifier.size()] = 0;
-		}
+		*pTheVolumeDataProperty = (IBase*)(pBaseTheVolumeDataProperty);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Identifier", sIdentifier.c_str());
+			pJournalEntry->addHandleResult("TheVolumeDataProperty", *pTheVolumeDataProperty);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8021,25 +8159,37 @@ Lib3MFResult lib3mf_beamset_getidentifier(Lib3MF_BeamSet pBeamSet, const Lib3MF_
 	}
 }
 
-Lib3MFResult lib3mf_beamset_getreferencecount(Lib3MF_BeamSet pBeamSet, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_volumedata_addpropertyfromfunction(Lib3MF_VolumeData pVolumeData, const char * pName, Lib3MF_Function pTheFunction, Lib3MF_VolumeDataProperty * pTheVolumeDataProperty)
 {
-	IBase* pIBaseClass = (IBase *)pBeamSet;
+	IBase* pIBaseClass = (IBase *)pVolumeData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "GetReferenceCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "AddPropertyFromFunction");
+			pJournalEntry->addStringParameter("Name", pName);
+			pJournalEntry->addHandleParameter("TheFunction", pTheFunction);
 		}
-		if (pCount == nullptr)
+		if (pName == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
-		if (!pIBeamSet)
+		if (pTheVolumeDataProperty == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sName(pName);
+		IBase* pIBaseClassTheFunction = (IBase *)pTheFunction;
+		IFunction* pITheFunction = dynamic_cast<IFunction*>(pIBaseClassTheFunction);
+		if (!pITheFunction)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
+		IBase* pBaseTheVolumeDataProperty(nullptr);
+		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
+		if (!pIVolumeData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pIBeamSet->GetReferenceCount();
+		pBaseTheVolumeDataProperty = pIVolumeData->AddPropertyFromFunction(sName, pITheFunction);
 
+		*pTheVolumeDataProperty = (IBase*)(pBaseTheVolumeDataProperty);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Count", *pCount);
+			pJournalEntry->addHandleResult("TheVolumeDataProperty", *pTheVolumeDataProperty);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8055,22 +8205,21 @@ Lib3MFResult lib3mf_beamset_getreferencecount(Lib3MF_BeamSet pBeamSet, Lib3MF_ui
 	}
 }
 
-Lib3MFResult lib3mf_beamset_setreferences(Lib3MF_BeamSet pBeamSet, Lib3MF_uint64 nReferencesBufferSize, const Lib3MF_uint32 * pReferencesBuffer)
+Lib3MFResult lib3mf_volumedata_removeproperty(Lib3MF_VolumeData pVolumeData, Lib3MF_uint32 nIndex)
 {
-	IBase* pIBaseClass = (IBase *)pBeamSet;
+	IBase* pIBaseClass = (IBase *)pVolumeData;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "SetReferences");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pVolumeData, "VolumeData", "RemoveProperty");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		if ( (!pReferencesBuffer) && (nReferencesBufferSize>0))
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
-		if (!pIBeamSet)
+		IVolumeData* pIVolumeData = dynamic_cast<IVolumeData*>(pIBaseClass);
+		if (!pIVolumeData)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBeamSet->SetReferences(nReferencesBufferSize, pReferencesBuffer);
+		pIVolumeData->RemoveProperty(nIndex);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -8088,24 +8237,31 @@ Lib3MFResult lib3mf_beamset_setreferences(Lib3MF_BeamSet pBeamSet, Lib3MF_uint64
 	}
 }
 
-Lib3MFResult lib3mf_beamset_getreferences(Lib3MF_BeamSet pBeamSet, const Lib3MF_uint64 nReferencesBufferSize, Lib3MF_uint64* pReferencesNeededCount, Lib3MF_uint32 * pReferencesBuffer)
+
+/*************************************************************************************************************************
+ Class implementation for Component
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_component_getobjectresource(Lib3MF_Component pComponent, Lib3MF_Object * pObjectResource)
 {
-	IBase* pIBaseClass = (IBase *)pBeamSet;
+	IBase* pIBaseClass = (IBase *)pComponent;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "GetReferences");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponent, "Component", "GetObjectResource");
 		}
-		if ((!pReferencesBuffer) && !(pReferencesNeededCount))
+		if (pObjectResource == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
-		if (!pIBeamSet)
+		IBase* pBaseObjectResource(nullptr);
+		IComponent* pIComponent = dynamic_cast<IComponent*>(pIBaseClass);
+		if (!pIComponent)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBeamSet->GetReferences(nReferencesBufferSize, pReferencesNeededCount, pReferencesBuffer);
+		pBaseObjectResource = pIComponent->GetObjectResource();
 
+		*pObjectResource = (IBase*)(pBaseObjectResource);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("ObjectResource", *pObjectResource);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8121,25 +8277,25 @@ Lib3MFResult lib3mf_beamset_getreferences(Lib3MF_BeamSet pBeamSet, const Lib3MF_
 	}
 }
 
-Lib3MFResult lib3mf_beamset_getballreferencecount(Lib3MF_BeamSet pBeamSet, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_component_getobjectresourceid(Lib3MF_Component pComponent, Lib3MF_uint32 * pUniqueResourceID)
 {
-	IBase* pIBaseClass = (IBase *)pBeamSet;
+	IBase* pIBaseClass = (IBase *)pComponent;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "GetBallReferenceCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponent, "Component", "GetObjectResourceID");
 		}
-		if (pCount == nullptr)
+		if (pUniqueResourceID == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
-		if (!pIBeamSet)
+		IComponent* pIComponent = dynamic_cast<IComponent*>(pIBaseClass);
+		if (!pIComponent)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pIBeamSet->GetBallReferenceCount();
+		*pUniqueResourceID = pIComponent->GetObjectResourceID();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Count", *pCount);
+			pJournalEntry->addUInt32Result("UniqueResourceID", *pUniqueResourceID);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8155,24 +8311,50 @@ Lib3MFResult lib3mf_beamset_getballreferencecount(Lib3MF_BeamSet pBeamSet, Lib3M
 	}
 }
 
-Lib3MFResult lib3mf_beamset_setballreferences(Lib3MF_BeamSet pBeamSet, Lib3MF_uint64 nBallReferencesBufferSize, const Lib3MF_uint32 * pBallReferencesBuffer)
+Lib3MFResult lib3mf_component_getuuid(Lib3MF_Component pComponent, bool * pHasUUID, const Lib3MF_uint32 nUUIDBufferSize, Lib3MF_uint32* pUUIDNeededChars, char * pUUIDBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pBeamSet;
+	IBase* pIBaseClass = (IBase *)pComponent;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "SetBallReferences");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponent, "Component", "GetUUID");
 		}
-		if ( (!pBallReferencesBuffer) && (nBallReferencesBufferSize>0))
+		if (!pHasUUID)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
-		if (!pIBeamSet)
+		if ( (!pUUIDBuffer) && !(pUUIDNeededChars) )
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sUUID("");
+		IComponent* pIComponent = dynamic_cast<IComponent*>(pIBaseClass);
+		if (!pIComponent)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBeamSet->SetBallReferences(nBallReferencesBufferSize, pBallReferencesBuffer);
+		bool isCacheCall = (pUUIDBuffer == nullptr);
+		if (isCacheCall) {
+			sUUID = pIComponent->GetUUID(*pHasUUID);
 
+			pIComponent->_setCache (new ParameterCache_2<bool, std::string> (*pHasUUID, sUUID));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_2<bool, std::string>*> (pIComponent->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (*pHasUUID, sUUID);
+			pIComponent->_setCache (nullptr);
+		}
+		
+		if (pUUIDNeededChars)
+			*pUUIDNeededChars = (Lib3MF_uint32) (sUUID.size()+1);
+		if (pUUIDBuffer) {
+			if (sUUID.size() >= nUUIDBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iUUID = 0; iUUID < sUUID.size(); iUUID++)
+				pUUIDBuffer[iUUID] = sUUID[iUUID];
+			pUUIDBuffer[sUUID.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addBooleanResult("HasUUID", *pHasUUID);
+			pJournalEntry->addStringResult("UUID", sUUID.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8188,22 +8370,24 @@ Lib3MFResult lib3mf_beamset_setballreferences(Lib3MF_BeamSet pBeamSet, Lib3MF_ui
 	}
 }
 
-Lib3MFResult lib3mf_beamset_getballreferences(Lib3MF_BeamSet pBeamSet, const Lib3MF_uint64 nBallReferencesBufferSize, Lib3MF_uint64* pBallReferencesNeededCount, Lib3MF_uint32 * pBallReferencesBuffer)
+Lib3MFResult lib3mf_component_setuuid(Lib3MF_Component pComponent, const char * pUUID)
 {
-	IBase* pIBaseClass = (IBase *)pBeamSet;
+	IBase* pIBaseClass = (IBase *)pComponent;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "GetBallReferences");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponent, "Component", "SetUUID");
+			pJournalEntry->addStringParameter("UUID", pUUID);
 		}
-		if ((!pBallReferencesBuffer) && !(pBallReferencesNeededCount))
+		if (pUUID == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
-		if (!pIBeamSet)
+		std::string sUUID(pUUID);
+		IComponent* pIComponent = dynamic_cast<IComponent*>(pIBaseClass);
+		if (!pIComponent)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBeamSet->GetBallReferences(nBallReferencesBufferSize, pBallReferencesNeededCount, pBallReferencesBuffer);
+		pIComponent->SetUUID(sUUID);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -8221,29 +8405,25 @@ Lib3MFResult lib3mf_beamset_getballreferences(Lib3MF_BeamSet pBeamSet, const Lib
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for BaseMaterialGroup
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_basematerialgroup_getcount(Lib3MF_BaseMaterialGroup pBaseMaterialGroup, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_component_hastransform(Lib3MF_Component pComponent, bool * pHasTransform)
 {
-	IBase* pIBaseClass = (IBase *)pBaseMaterialGroup;
+	IBase* pIBaseClass = (IBase *)pComponent;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBaseMaterialGroup, "BaseMaterialGroup", "GetCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponent, "Component", "HasTransform");
 		}
-		if (pCount == nullptr)
+		if (pHasTransform == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBaseMaterialGroup* pIBaseMaterialGroup = dynamic_cast<IBaseMaterialGroup*>(pIBaseClass);
-		if (!pIBaseMaterialGroup)
+		IComponent* pIComponent = dynamic_cast<IComponent*>(pIBaseClass);
+		if (!pIComponent)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pIBaseMaterialGroup->GetCount();
+		*pHasTransform = pIComponent->HasTransform();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Count", *pCount);
+			pJournalEntry->addBooleanResult("HasTransform", *pHasTransform);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8259,22 +8439,22 @@ Lib3MFResult lib3mf_basematerialgroup_getcount(Lib3MF_BaseMaterialGroup pBaseMat
 	}
 }
 
-Lib3MFResult lib3mf_basematerialgroup_getallpropertyids(Lib3MF_BaseMaterialGroup pBaseMaterialGroup, const Lib3MF_uint64 nPropertyIDsBufferSize, Lib3MF_uint64* pPropertyIDsNeededCount, Lib3MF_uint32 * pPropertyIDsBuffer)
+Lib3MFResult lib3mf_component_gettransform(Lib3MF_Component pComponent, sLib3MFTransform * pTransform)
 {
-	IBase* pIBaseClass = (IBase *)pBaseMaterialGroup;
+	IBase* pIBaseClass = (IBase *)pComponent;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBaseMaterialGroup, "BaseMaterialGroup", "GetAllPropertyIDs");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponent, "Component", "GetTransform");
 		}
-		if ((!pPropertyIDsBuffer) && !(pPropertyIDsNeededCount))
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBaseMaterialGroup* pIBaseMaterialGroup = dynamic_cast<IBaseMaterialGroup*>(pIBaseClass);
-		if (!pIBaseMaterialGroup)
+		if (pTransform == nullptr)
+		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IComponent* pIComponent = dynamic_cast<IComponent*>(pIBaseClass);
+		if (!pIComponent)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBaseMaterialGroup->GetAllPropertyIDs(nPropertyIDsBufferSize, pPropertyIDsNeededCount, pPropertyIDsBuffer);
+		*pTransform = pIComponent->GetTransform();
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -8292,29 +8472,22 @@ Lib3MFResult lib3mf_basematerialgroup_getallpropertyids(Lib3MF_BaseMaterialGroup
 	}
 }
 
-Lib3MFResult lib3mf_basematerialgroup_addmaterial(Lib3MF_BaseMaterialGroup pBaseMaterialGroup, const char * pName, const sLib3MFColor * pDisplayColor, Lib3MF_uint32 * pPropertyID)
+Lib3MFResult lib3mf_component_settransform(Lib3MF_Component pComponent, const sLib3MFTransform * pTransform)
 {
-	IBase* pIBaseClass = (IBase *)pBaseMaterialGroup;
+	IBase* pIBaseClass = (IBase *)pComponent;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBaseMaterialGroup, "BaseMaterialGroup", "AddMaterial");
-			pJournalEntry->addStringParameter("Name", pName);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponent, "Component", "SetTransform");
 		}
-		if (pName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pPropertyID == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sName(pName);
-		IBaseMaterialGroup* pIBaseMaterialGroup = dynamic_cast<IBaseMaterialGroup*>(pIBaseClass);
-		if (!pIBaseMaterialGroup)
+		IComponent* pIComponent = dynamic_cast<IComponent*>(pIBaseClass);
+		if (!pIComponent)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pPropertyID = pIBaseMaterialGroup->AddMaterial(sName, *pDisplayColor);
+		pIComponent->SetTransform(*pTransform);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("PropertyID", *pPropertyID);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8330,23 +8503,37 @@ Lib3MFResult lib3mf_basematerialgroup_addmaterial(Lib3MF_BaseMaterialGroup pBase
 	}
 }
 
-Lib3MFResult lib3mf_basematerialgroup_removematerial(Lib3MF_BaseMaterialGroup pBaseMaterialGroup, Lib3MF_uint32 nPropertyID)
+
+/*************************************************************************************************************************
+ Class implementation for ComponentsObject
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_componentsobject_addcomponent(Lib3MF_ComponentsObject pComponentsObject, Lib3MF_Object pObjectResource, const sLib3MFTransform * pTransform, Lib3MF_Component * pComponentInstance)
 {
-	IBase* pIBaseClass = (IBase *)pBaseMaterialGroup;
+	IBase* pIBaseClass = (IBase *)pComponentsObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBaseMaterialGroup, "BaseMaterialGroup", "RemoveMaterial");
-			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponentsObject, "ComponentsObject", "AddComponent");
+			pJournalEntry->addHandleParameter("ObjectResource", pObjectResource);
 		}
-		IBaseMaterialGroup* pIBaseMaterialGroup = dynamic_cast<IBaseMaterialGroup*>(pIBaseClass);
-		if (!pIBaseMaterialGroup)
+		if (pComponentInstance == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pIBaseClassObjectResource = (IBase *)pObjectResource;
+		IObject* pIObjectResource = dynamic_cast<IObject*>(pIBaseClassObjectResource);
+		if (!pIObjectResource)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
+		IBase* pBaseComponentInstance(nullptr);
+		IComponentsObject* pIComponentsObject = dynamic_cast<IComponentsObject*>(pIBaseClass);
+		if (!pIComponentsObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBaseMaterialGroup->RemoveMaterial(nPropertyID);
+		pBaseComponentInstance = pIComponentsObject->AddComponent(pIObjectResource, *pTransform);
 
+		*pComponentInstance = (IBase*)(pBaseComponentInstance);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("ComponentInstance", *pComponentInstance);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8362,48 +8549,28 @@ Lib3MFResult lib3mf_basematerialgroup_removematerial(Lib3MF_BaseMaterialGroup pB
 	}
 }
 
-Lib3MFResult lib3mf_basematerialgroup_getname(Lib3MF_BaseMaterialGroup pBaseMaterialGroup, Lib3MF_uint32 nPropertyID, const Lib3MF_uint32 nNameBufferSize, Lib3MF_uint32* pNameNeededChars, char * pNameBuffer)
+Lib3MFResult lib3mf_componentsobject_getcomponent(Lib3MF_ComponentsObject pComponentsObject, Lib3MF_uint32 nIndex, Lib3MF_Component * pComponentInstance)
 {
-	IBase* pIBaseClass = (IBase *)pBaseMaterialGroup;
+	IBase* pIBaseClass = (IBase *)pComponentsObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBaseMaterialGroup, "BaseMaterialGroup", "GetName");
-			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponentsObject, "ComponentsObject", "GetComponent");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		if ( (!pNameBuffer) && !(pNameNeededChars) )
+		if (pComponentInstance == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sName("");
-		IBaseMaterialGroup* pIBaseMaterialGroup = dynamic_cast<IBaseMaterialGroup*>(pIBaseClass);
-		if (!pIBaseMaterialGroup)
+		IBase* pBaseComponentInstance(nullptr);
+		IComponentsObject* pIComponentsObject = dynamic_cast<IComponentsObject*>(pIBaseClass);
+		if (!pIComponentsObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pNameBuffer == nullptr);
-		if (isCacheCall) {
-			sName = pIBaseMaterialGroup->GetName(nPropertyID);
+		pBaseComponentInstance = pIComponentsObject->GetComponent(nIndex);
 
-			pIBaseMaterialGroup->_setCache (new ParameterCache_1<std::string> (sName));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIBaseMaterialGroup->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sName);
-			pIBaseMaterialGroup->_setCache (nullptr);
-		}
-		
-		if (pNameNeededChars)
-			*pNameNeededChars = (Lib3MF_uint32) (sName.size()+1);
-		if (pNameBuffer) {
-			if (sName.size() >= nNameBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iName = 0; iName < sName.size(); iName++)
-				pNameBuffer[iName] = sName[iName];
-			pNameBuffer[sName.size()] = 0;
-		}
+		*pComponentInstance = (IBase*)(pBaseComponentInstance);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Name", sName.c_str());
+			pJournalEntry->addHandleResult("ComponentInstance", *pComponentInstance);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8419,27 +8586,25 @@ Lib3MFResult lib3mf_basematerialgroup_getname(Lib3MF_BaseMaterialGroup pBaseMate
 	}
 }
 
-Lib3MFResult lib3mf_basematerialgroup_setname(Lib3MF_BaseMaterialGroup pBaseMaterialGroup, Lib3MF_uint32 nPropertyID, const char * pName)
+Lib3MFResult lib3mf_componentsobject_getcomponentcount(Lib3MF_ComponentsObject pComponentsObject, Lib3MF_uint32 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pBaseMaterialGroup;
+	IBase* pIBaseClass = (IBase *)pComponentsObject;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBaseMaterialGroup, "BaseMaterialGroup", "SetName");
-			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
-			pJournalEntry->addStringParameter("Name", pName);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComponentsObject, "ComponentsObject", "GetComponentCount");
 		}
-		if (pName == nullptr)
+		if (pCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sName(pName);
-		IBaseMaterialGroup* pIBaseMaterialGroup = dynamic_cast<IBaseMaterialGroup*>(pIBaseClass);
-		if (!pIBaseMaterialGroup)
+		IComponentsObject* pIComponentsObject = dynamic_cast<IComponentsObject*>(pIBaseClass);
+		if (!pIComponentsObject)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBaseMaterialGroup->SetName(nPropertyID, sName);
+		*pCount = pIComponentsObject->GetComponentCount();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8455,21 +8620,28 @@ Lib3MFResult lib3mf_basematerialgroup_setname(Lib3MF_BaseMaterialGroup pBaseMate
 	}
 }
 
-Lib3MFResult lib3mf_basematerialgroup_setdisplaycolor(Lib3MF_BaseMaterialGroup pBaseMaterialGroup, Lib3MF_uint32 nPropertyID, const sLib3MFColor * pTheColor)
+
+/*************************************************************************************************************************
+ Class implementation for BeamSet
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_beamset_setname(Lib3MF_BeamSet pBeamSet, const char * pName)
 {
-	IBase* pIBaseClass = (IBase *)pBaseMaterialGroup;
+	IBase* pIBaseClass = (IBase *)pBeamSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBaseMaterialGroup, "BaseMaterialGroup", "SetDisplayColor");
-			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "SetName");
+			pJournalEntry->addStringParameter("Name", pName);
 		}
-		IBaseMaterialGroup* pIBaseMaterialGroup = dynamic_cast<IBaseMaterialGroup*>(pIBaseClass);
-		if (!pIBaseMaterialGroup)
+		if (pName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sName(pName);
+		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
+		if (!pIBeamSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIBaseMaterialGroup->SetDisplayColor(nPropertyID, *pTheColor);
+		pIBeamSet->SetName(sName);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -8487,25 +8659,47 @@ Lib3MFResult lib3mf_basematerialgroup_setdisplaycolor(Lib3MF_BaseMaterialGroup p
 	}
 }
 
-Lib3MFResult lib3mf_basematerialgroup_getdisplaycolor(Lib3MF_BaseMaterialGroup pBaseMaterialGroup, Lib3MF_uint32 nPropertyID, sLib3MFColor * pTheColor)
+Lib3MFResult lib3mf_beamset_getname(Lib3MF_BeamSet pBeamSet, const Lib3MF_uint32 nNameBufferSize, Lib3MF_uint32* pNameNeededChars, char * pNameBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pBaseMaterialGroup;
+	IBase* pIBaseClass = (IBase *)pBeamSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pBaseMaterialGroup, "BaseMaterialGroup", "GetDisplayColor");
-			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "GetName");
 		}
-		if (pTheColor == nullptr)
-		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBaseMaterialGroup* pIBaseMaterialGroup = dynamic_cast<IBaseMaterialGroup*>(pIBaseClass);
-		if (!pIBaseMaterialGroup)
+		if ( (!pNameBuffer) && !(pNameNeededChars) )
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sName("");
+		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
+		if (!pIBeamSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pTheColor = pIBaseMaterialGroup->GetDisplayColor(nPropertyID);
+		bool isCacheCall = (pNameBuffer == nullptr);
+		if (isCacheCall) {
+			sName = pIBeamSet->GetName();
 
+			pIBeamSet->_setCache (new ParameterCache_1<std::string> (sName));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIBeamSet->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sName);
+			pIBeamSet->_setCache (nullptr);
+		}
+		
+		if (pNameNeededChars)
+			*pNameNeededChars = (Lib3MF_uint32) (sName.size()+1);
+		if (pNameBuffer) {
+			if (sName.size() >= nNameBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iName = 0; iName < sName.size(); iName++)
+				pNameBuffer[iName] = sName[iName];
+			pNameBuffer[sName.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addStringResult("Name", sName.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8521,29 +8715,26 @@ Lib3MFResult lib3mf_basematerialgroup_getdisplaycolor(Lib3MF_BaseMaterialGroup p
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for ColorGroup
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_colorgroup_getcount(Lib3MF_ColorGroup pColorGroup, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_beamset_setidentifier(Lib3MF_BeamSet pBeamSet, const char * pIdentifier)
 {
-	IBase* pIBaseClass = (IBase *)pColorGroup;
+	IBase* pIBaseClass = (IBase *)pBeamSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pColorGroup, "ColorGroup", "GetCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "SetIdentifier");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 		}
-		if (pCount == nullptr)
+		if (pIdentifier == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IColorGroup* pIColorGroup = dynamic_cast<IColorGroup*>(pIBaseClass);
-		if (!pIColorGroup)
+		std::string sIdentifier(pIdentifier);
+		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
+		if (!pIBeamSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pIColorGroup->GetCount();
+		pIBeamSet->SetIdentifier(sIdentifier);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8559,24 +8750,47 @@ Lib3MFResult lib3mf_colorgroup_getcount(Lib3MF_ColorGroup pColorGroup, Lib3MF_ui
 	}
 }
 
-Lib3MFResult lib3mf_colorgroup_getallpropertyids(Lib3MF_ColorGroup pColorGroup, const Lib3MF_uint64 nPropertyIDsBufferSize, Lib3MF_uint64* pPropertyIDsNeededCount, Lib3MF_uint32 * pPropertyIDsBuffer)
+Lib3MFResult lib3mf_beamset_getidentifier(Lib3MF_BeamSet pBeamSet, const Lib3MF_uint32 nIdentifierBufferSize, Lib3MF_uint32* pIdentifierNeededChars, char * pIdentifierBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pColorGroup;
+	IBase* pIBaseClass = (IBase *)pBeamSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pColorGroup, "ColorGroup", "GetAllPropertyIDs");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "GetIdentifier");
 		}
-		if ((!pPropertyIDsBuffer) && !(pPropertyIDsNeededCount))
+		if ( (!pIdentifierBuffer) && !(pIdentifierNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IColorGroup* pIColorGroup = dynamic_cast<IColorGroup*>(pIBaseClass);
-		if (!pIColorGroup)
+		std::string sIdentifier("");
+		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
+		if (!pIBeamSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIColorGroup->GetAllPropertyIDs(nPropertyIDsBufferSize, pPropertyIDsNeededCount, pPropertyIDsBuffer);
+		bool isCacheCall = (pIdentifierBuffer == nullptr);
+		if (isCacheCall) {
+			sIdentifier = pIBeamSet->GetIdentifier();
 
+			pIBeamSet->_setCache (new ParameterCache_1<std::string> (sIdentifier));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIBeamSet->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sIdentifier);
+			pIBeamSet->_setCache (nullptr);
+		}
+		
+		if (pIdentifierNeededChars)
+			*pIdentifierNeededChars = (Lib3MF_uint32) (sIdentifier.size()+1);
+		if (pIdentifierBuffer) {
+			if (sIdentifier.size() >= nIdentifierBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iIdentifier = 0; iIdentifier < sIdentifier.size(); iIdentifier++)
+				pIdentifierBuffer[iIdentifier] = sIdentifier[iIdentifier];
+			pIdentifierBuffer[sIdentifier.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addStringResult("Identifier", sIdentifier.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8592,25 +8806,25 @@ Lib3MFResult lib3mf_colorgroup_getallpropertyids(Lib3MF_ColorGroup pColorGroup,
 	}
 }
 
-Lib3MFResult lib3mf_colorgroup_addcolor(Lib3MF_ColorGroup pColorGroup, const sLib3MFColor * pTheColor, Lib3MF_uint32 * pPropertyID)
+Lib3MFResult lib3mf_beamset_getreferencecount(Lib3MF_BeamSet pBeamSet, Lib3MF_uint32 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pColorGroup;
+	IBase* pIBaseClass = (IBase *)pBeamSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pColorGroup, "ColorGroup", "AddColor");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "GetReferenceCount");
 		}
-		if (pPropertyID == nullptr)
+		if (pCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IColorGroup* pIColorGroup = dynamic_cast<IColorGroup*>(pIBaseClass);
-		if (!pIColorGroup)
+		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
+		if (!pIBeamSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pPropertyID = pIColorGroup->AddColor(*pTheColor);
+		*pCount = pIBeamSet->GetReferenceCount();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("PropertyID", *pPropertyID);
+			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8626,21 +8840,22 @@ Lib3MFResult lib3mf_colorgroup_addcolor(Lib3MF_ColorGroup pColorGroup, const sLi
 	}
 }
 
-Lib3MFResult lib3mf_colorgroup_removecolor(Lib3MF_ColorGroup pColorGroup, Lib3MF_uint32 nPropertyID)
+Lib3MFResult lib3mf_beamset_setreferences(Lib3MF_BeamSet pBeamSet, Lib3MF_uint64 nReferencesBufferSize, const Lib3MF_uint32 * pReferencesBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pColorGroup;
+	IBase* pIBaseClass = (IBase *)pBeamSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pColorGroup, "ColorGroup", "RemoveColor");
-			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "SetReferences");
 		}
-		IColorGroup* pIColorGroup = dynamic_cast<IColorGroup*>(pIBaseClass);
-		if (!pIColorGroup)
+		if ( (!pReferencesBuffer) && (nReferencesBufferSize>0))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
+		if (!pIBeamSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIColorGroup->RemoveColor(nPropertyID);
+		pIBeamSet->SetReferences(nReferencesBufferSize, pReferencesBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -8658,21 +8873,22 @@ Lib3MFResult lib3mf_colorgroup_removecolor(Lib3MF_ColorGroup pColorGroup, Lib3MF
 	}
 }
 
-Lib3MFResult lib3mf_colorgroup_setcolor(Lib3MF_ColorGroup pColorGroup, Lib3MF_uint32 nPropertyID, const sLib3MFColor * pTheColor)
+Lib3MFResult lib3mf_beamset_getreferences(Lib3MF_BeamSet pBeamSet, const Lib3MF_uint64 nReferencesBufferSize, Lib3MF_uint64* pReferencesNeededCount, Lib3MF_uint32 * pReferencesBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pColorGroup;
+	IBase* pIBaseClass = (IBase *)pBeamSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pColorGroup, "ColorGroup", "SetColor");
-			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "GetReferences");
 		}
-		IColorGroup* pIColorGroup = dynamic_cast<IColorGroup*>(pIBaseClass);
-		if (!pIColorGroup)
+		if ((!pReferencesBuffer) && !(pReferencesNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
+		if (!pIBeamSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIColorGroup->SetColor(nPropertyID, *pTheColor);
+		pIBeamSet->GetReferences(nReferencesBufferSize, pReferencesNeededCount, pReferencesBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -8690,25 +8906,25 @@ Lib3MFResult lib3mf_colorgroup_setcolor(Lib3MF_ColorGroup pColorGroup, Lib3MF_ui
 	}
 }
 
-Lib3MFResult lib3mf_colorgroup_getcolor(Lib3MF_ColorGroup pColorGroup, Lib3MF_uint32 nPropertyID, sLib3MFColor * pTheColor)
+Lib3MFResult lib3mf_beamset_getballreferencecount(Lib3MF_BeamSet pBeamSet, Lib3MF_uint32 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pColorGroup;
+	IBase* pIBaseClass = (IBase *)pBeamSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pColorGroup, "ColorGroup", "GetColor");
-			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "GetBallReferenceCount");
 		}
-		if (pTheColor == nullptr)
-		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IColorGroup* pIColorGroup = dynamic_cast<IColorGroup*>(pIBaseClass);
-		if (!pIColorGroup)
+		if (pCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
+		if (!pIBeamSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pTheColor = pIColorGroup->GetColor(nPropertyID);
+		*pCount = pIBeamSet->GetBallReferenceCount();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8724,29 +8940,24 @@ Lib3MFResult lib3mf_colorgroup_getcolor(Lib3MF_ColorGroup pColorGroup, Lib3MF_ui
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for Texture2DGroup
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_texture2dgroup_getcount(Lib3MF_Texture2DGroup pTexture2DGroup, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_beamset_setballreferences(Lib3MF_BeamSet pBeamSet, Lib3MF_uint64 nBallReferencesBufferSize, const Lib3MF_uint32 * pBallReferencesBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pTexture2DGroup;
+	IBase* pIBaseClass = (IBase *)pBeamSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2DGroup, "Texture2DGroup", "GetCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "SetBallReferences");
 		}
-		if (pCount == nullptr)
+		if ( (!pBallReferencesBuffer) && (nBallReferencesBufferSize>0))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		ITexture2DGroup* pITexture2DGroup = dynamic_cast<ITexture2DGroup*>(pIBaseClass);
-		if (!pITexture2DGroup)
+		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
+		if (!pIBeamSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pITexture2DGroup->GetCount();
+		pIBeamSet->SetBallReferences(nBallReferencesBufferSize, pBallReferencesBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8762,22 +8973,22 @@ Lib3MFResult lib3mf_texture2dgroup_getcount(Lib3MF_Texture2DGroup pTexture2DGrou
 	}
 }
 
-Lib3MFResult lib3mf_texture2dgroup_getallpropertyids(Lib3MF_Texture2DGroup pTexture2DGroup, const Lib3MF_uint64 nPropertyIDsBufferSize, Lib3MF_uint64* pPropertyIDsNeededCount, Lib3MF_uint32 * pPropertyIDsBuffer)
+Lib3MFResult lib3mf_beamset_getballreferences(Lib3MF_BeamSet pBeamSet, const Lib3MF_uint64 nBallReferencesBufferSize, Lib3MF_uint64* pBallReferencesNeededCount, Lib3MF_uint32 * pBallReferencesBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pTexture2DGroup;
+	IBase* pIBaseClass = (IBase *)pBeamSet;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2DGroup, "Texture2DGroup", "GetAllPropertyIDs");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBeamSet, "BeamSet", "GetBallReferences");
 		}
-		if ((!pPropertyIDsBuffer) && !(pPropertyIDsNeededCount))
+		if ((!pBallReferencesBuffer) && !(pBallReferencesNeededCount))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		ITexture2DGroup* pITexture2DGroup = dynamic_cast<ITexture2DGroup*>(pIBaseClass);
-		if (!pITexture2DGroup)
+		IBeamSet* pIBeamSet = dynamic_cast<IBeamSet*>(pIBaseClass);
+		if (!pIBeamSet)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pITexture2DGroup->GetAllPropertyIDs(nPropertyIDsBufferSize, pPropertyIDsNeededCount, pPropertyIDsBuffer);
+		pIBeamSet->GetBallReferences(nBallReferencesBufferSize, pBallReferencesNeededCount, pBallReferencesBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -8795,25 +9006,29 @@ Lib3MFResult lib3mf_texture2dgroup_getallpropertyids(Lib3MF_Texture2DGroup pText
 	}
 }
 
-Lib3MFResult lib3mf_texture2dgroup_addtex2coord(Lib3MF_Texture2DGroup pTexture2DGroup, const sLib3MFTex2Coord * pUVCoordinate, Lib3MF_uint32 * pPropertyID)
+
+/*************************************************************************************************************************
+ Class implementation for BaseMaterialGroup
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_basematerialgroup_getcount(Lib3MF_BaseMaterialGroup pBaseMaterialGroup, Lib3MF_uint32 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pTexture2DGroup;
+	IBase* pIBaseClass = (IBase *)pBaseMaterialGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2DGroup, "Texture2DGroup", "AddTex2Coord");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBaseMaterialGroup, "BaseMaterialGroup", "GetCount");
 		}
-		if (pPropertyID == nullptr)
+		if (pCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		ITexture2DGroup* pITexture2DGroup = dynamic_cast<ITexture2DGroup*>(pIBaseClass);
-		if (!pITexture2DGroup)
+		IBaseMaterialGroup* pIBaseMaterialGroup = dynamic_cast<IBaseMaterialGroup*>(pIBaseClass);
+		if (!pIBaseMaterialGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pPropertyID = pITexture2DGroup->AddTex2Coord(*pUVCoordinate);
+		*pCount = pIBaseMaterialGroup->GetCount();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("PropertyID", *pPropertyID);
+			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8829,23 +9044,22 @@ Lib3MFResult lib3mf_texture2dgroup_addtex2coord(Lib3MF_Texture2DGroup pTexture2D
 	}
 }
 
-Lib3MFResult lib3mf_texture2dgroup_gettex2coord(Lib3MF_Texture2DGroup pTexture2DGroup, Lib3MF_uint32 nPropertyID, sLib3MFTex2Coord * pUVCoordinate)
+Lib3MFResult lib3mf_basematerialgroup_getallpropertyids(Lib3MF_BaseMaterialGroup pBaseMaterialGroup, const Lib3MF_uint64 nPropertyIDsBufferSize, Lib3MF_uint64* pPropertyIDsNeededCount, Lib3MF_uint32 * pPropertyIDsBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pTexture2DGroup;
+	IBase* pIBaseClass = (IBase *)pBaseMaterialGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2DGroup, "Texture2DGroup", "GetTex2Coord");
-			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBaseMaterialGroup, "BaseMaterialGroup", "GetAllPropertyIDs");
 		}
-		if (pUVCoordinate == nullptr)
-		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		ITexture2DGroup* pITexture2DGroup = dynamic_cast<ITexture2DGroup*>(pIBaseClass);
-		if (!pITexture2DGroup)
+		if ((!pPropertyIDsBuffer) && !(pPropertyIDsNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBaseMaterialGroup* pIBaseMaterialGroup = dynamic_cast<IBaseMaterialGroup*>(pIBaseClass);
+		if (!pIBaseMaterialGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pUVCoordinate = pITexture2DGroup->GetTex2Coord(nPropertyID);
+		pIBaseMaterialGroup->GetAllPropertyIDs(nPropertyIDsBufferSize, pPropertyIDsNeededCount, pPropertyIDsBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -8863,23 +9077,29 @@ Lib3MFResult lib3mf_texture2dgroup_gettex2coord(Lib3MF_Texture2DGroup pTexture2D
 	}
 }
 
-Lib3MFResult lib3mf_texture2dgroup_removetex2coord(Lib3MF_Texture2DGroup pTexture2DGroup, Lib3MF_uint32 nPropertyID)
+Lib3MFResult lib3mf_basematerialgroup_addmaterial(Lib3MF_BaseMaterialGroup pBaseMaterialGroup, const char * pName, const sLib3MFColor * pDisplayColor, Lib3MF_uint32 * pPropertyID)
 {
-	IBase* pIBaseClass = (IBase *)pTexture2DGroup;
+	IBase* pIBaseClass = (IBase *)pBaseMaterialGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2DGroup, "Texture2DGroup", "RemoveTex2Coord");
-			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBaseMaterialGroup, "BaseMaterialGroup", "AddMaterial");
+			pJournalEntry->addStringParameter("Name", pName);
 		}
-		ITexture2DGroup* pITexture2DGroup = dynamic_cast<ITexture2DGroup*>(pIBaseClass);
-		if (!pITexture2DGroup)
+		if (pName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pPropertyID == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sName(pName);
+		IBaseMaterialGroup* pIBaseMaterialGroup = dynamic_cast<IBaseMaterialGroup*>(pIBaseClass);
+		if (!pIBaseMaterialGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pITexture2DGroup->RemoveTex2Coord(nPropertyID);
+		*pPropertyID = pIBaseMaterialGroup->AddMaterial(sName, *pDisplayColor);
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("PropertyID", *pPropertyID);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8895,27 +9115,23 @@ Lib3MFResult lib3mf_texture2dgroup_removetex2coord(Lib3MF_Texture2DGroup pTextur
 	}
 }
 
-Lib3MFResult lib3mf_texture2dgroup_gettexture2d(Lib3MF_Texture2DGroup pTexture2DGroup, Lib3MF_Texture2D * pTexture2DInstance)
+Lib3MFResult lib3mf_basematerialgroup_removematerial(Lib3MF_BaseMaterialGroup pBaseMaterialGroup, Lib3MF_uint32 nPropertyID)
 {
-	IBase* pIBaseClass = (IBase *)pTexture2DGroup;
+	IBase* pIBaseClass = (IBase *)pBaseMaterialGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2DGroup, "Texture2DGroup", "GetTexture2D");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBaseMaterialGroup, "BaseMaterialGroup", "RemoveMaterial");
+			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
 		}
-		if (pTexture2DInstance == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseTexture2DInstance(nullptr);
-		ITexture2DGroup* pITexture2DGroup = dynamic_cast<ITexture2DGroup*>(pIBaseClass);
-		if (!pITexture2DGroup)
+		IBaseMaterialGroup* pIBaseMaterialGroup = dynamic_cast<IBaseMaterialGroup*>(pIBaseClass);
+		if (!pIBaseMaterialGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseTexture2DInstance = pITexture2DGroup->GetTexture2D();
+		pIBaseMaterialGroup->RemoveMaterial(nPropertyID);
 
-		*pTexture2DInstance = (IBase*)(pBaseTexture2DInstance);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Texture2DInstance", *pTexture2DInstance);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8931,29 +9147,48 @@ Lib3MFResult lib3mf_texture2dgroup_gettexture2d(Lib3MF_Texture2DGroup pTexture2D
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for CompositeMaterials
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_compositematerials_getcount(Lib3MF_CompositeMaterials pCompositeMaterials, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_basematerialgroup_getname(Lib3MF_BaseMaterialGroup pBaseMaterialGroup, Lib3MF_uint32 nPropertyID, const Lib3MF_uint32 nNameBufferSize, Lib3MF_uint32* pNameNeededChars, char * pNameBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pCompositeMaterials;
+	IBase* pIBaseClass = (IBase *)pBaseMaterialGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pCompositeMaterials, "CompositeMaterials", "GetCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBaseMaterialGroup, "BaseMaterialGroup", "GetName");
+			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
 		}
-		if (pCount == nullptr)
+		if ( (!pNameBuffer) && !(pNameNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		ICompositeMaterials* pICompositeMaterials = dynamic_cast<ICompositeMaterials*>(pIBaseClass);
-		if (!pICompositeMaterials)
+		std::string sName("");
+		IBaseMaterialGroup* pIBaseMaterialGroup = dynamic_cast<IBaseMaterialGroup*>(pIBaseClass);
+		if (!pIBaseMaterialGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pICompositeMaterials->GetCount();
+		bool isCacheCall = (pNameBuffer == nullptr);
+		if (isCacheCall) {
+			sName = pIBaseMaterialGroup->GetName(nPropertyID);
 
+			pIBaseMaterialGroup->_setCache (new ParameterCache_1<std::string> (sName));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIBaseMaterialGroup->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sName);
+			pIBaseMaterialGroup->_setCache (nullptr);
+		}
+		
+		if (pNameNeededChars)
+			*pNameNeededChars = (Lib3MF_uint32) (sName.size()+1);
+		if (pNameBuffer) {
+			if (sName.size() >= nNameBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iName = 0; iName < sName.size(); iName++)
+				pNameBuffer[iName] = sName[iName];
+			pNameBuffer[sName.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Count", *pCount);
+			pJournalEntry->addStringResult("Name", sName.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -8969,22 +9204,25 @@ Lib3MFResult lib3mf_compositematerials_getcount(Lib3MF_CompositeMaterials pCompo
 	}
 }
 
-Lib3MFResult lib3mf_compositematerials_getallpropertyids(Lib3MF_CompositeMaterials pCompositeMaterials, const Lib3MF_uint64 nPropertyIDsBufferSize, Lib3MF_uint64* pPropertyIDsNeededCount, Lib3MF_uint32 * pPropertyIDsBuffer)
+Lib3MFResult lib3mf_basematerialgroup_setname(Lib3MF_BaseMaterialGroup pBaseMaterialGroup, Lib3MF_uint32 nPropertyID, const char * pName)
 {
-	IBase* pIBaseClass = (IBase *)pCompositeMaterials;
+	IBase* pIBaseClass = (IBase *)pBaseMaterialGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pCompositeMaterials, "CompositeMaterials", "GetAllPropertyIDs");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBaseMaterialGroup, "BaseMaterialGroup", "SetName");
+			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
+			pJournalEntry->addStringParameter("Name", pName);
 		}
-		if ((!pPropertyIDsBuffer) && !(pPropertyIDsNeededCount))
+		if (pName == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		ICompositeMaterials* pICompositeMaterials = dynamic_cast<ICompositeMaterials*>(pIBaseClass);
-		if (!pICompositeMaterials)
+		std::string sName(pName);
+		IBaseMaterialGroup* pIBaseMaterialGroup = dynamic_cast<IBaseMaterialGroup*>(pIBaseClass);
+		if (!pIBaseMaterialGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pICompositeMaterials->GetAllPropertyIDs(nPropertyIDsBufferSize, pPropertyIDsNeededCount, pPropertyIDsBuffer);
+		pIBaseMaterialGroup->SetName(nPropertyID, sName);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -9002,27 +9240,23 @@ Lib3MFResult lib3mf_compositematerials_getallpropertyids(Lib3MF_CompositeMateria
 	}
 }
 
-Lib3MFResult lib3mf_compositematerials_getbasematerialgroup(Lib3MF_CompositeMaterials pCompositeMaterials, Lib3MF_BaseMaterialGroup * pBaseMaterialGroupInstance)
+Lib3MFResult lib3mf_basematerialgroup_setdisplaycolor(Lib3MF_BaseMaterialGroup pBaseMaterialGroup, Lib3MF_uint32 nPropertyID, const sLib3MFColor * pTheColor)
 {
-	IBase* pIBaseClass = (IBase *)pCompositeMaterials;
+	IBase* pIBaseClass = (IBase *)pBaseMaterialGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pCompositeMaterials, "CompositeMaterials", "GetBaseMaterialGroup");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBaseMaterialGroup, "BaseMaterialGroup", "SetDisplayColor");
+			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
 		}
-		if (pBaseMaterialGroupInstance == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseBaseMaterialGroupInstance(nullptr);
-		ICompositeMaterials* pICompositeMaterials = dynamic_cast<ICompositeMaterials*>(pIBaseClass);
-		if (!pICompositeMaterials)
+		IBaseMaterialGroup* pIBaseMaterialGroup = dynamic_cast<IBaseMaterialGroup*>(pIBaseClass);
+		if (!pIBaseMaterialGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseBaseMaterialGroupInstance = pICompositeMaterials->GetBaseMaterialGroup();
+		pIBaseMaterialGroup->SetDisplayColor(nPropertyID, *pTheColor);
 
-		*pBaseMaterialGroupInstance = (IBase*)(pBaseBaseMaterialGroupInstance);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("BaseMaterialGroupInstance", *pBaseMaterialGroupInstance);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9038,27 +9272,25 @@ Lib3MFResult lib3mf_compositematerials_getbasematerialgroup(Lib3MF_CompositeMate
 	}
 }
 
-Lib3MFResult lib3mf_compositematerials_addcomposite(Lib3MF_CompositeMaterials pCompositeMaterials, Lib3MF_uint64 nCompositeBufferSize, const sLib3MFCompositeConstituent * pCompositeBuffer, Lib3MF_uint32 * pPropertyID)
+Lib3MFResult lib3mf_basematerialgroup_getdisplaycolor(Lib3MF_BaseMaterialGroup pBaseMaterialGroup, Lib3MF_uint32 nPropertyID, sLib3MFColor * pTheColor)
 {
-	IBase* pIBaseClass = (IBase *)pCompositeMaterials;
+	IBase* pIBaseClass = (IBase *)pBaseMaterialGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pCompositeMaterials, "CompositeMaterials", "AddComposite");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pBaseMaterialGroup, "BaseMaterialGroup", "GetDisplayColor");
+			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
 		}
-		if ( (!pCompositeBuffer) && (nCompositeBufferSize>0))
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pPropertyID == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		ICompositeMaterials* pICompositeMaterials = dynamic_cast<ICompositeMaterials*>(pIBaseClass);
-		if (!pICompositeMaterials)
+		if (pTheColor == nullptr)
+		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBaseMaterialGroup* pIBaseMaterialGroup = dynamic_cast<IBaseMaterialGroup*>(pIBaseClass);
+		if (!pIBaseMaterialGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pPropertyID = pICompositeMaterials->AddComposite(nCompositeBufferSize, pCompositeBuffer);
+		*pTheColor = pIBaseMaterialGroup->GetDisplayColor(nPropertyID);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("PropertyID", *pPropertyID);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9074,23 +9306,29 @@ Lib3MFResult lib3mf_compositematerials_addcomposite(Lib3MF_CompositeMaterials pC
 	}
 }
 
-Lib3MFResult lib3mf_compositematerials_removecomposite(Lib3MF_CompositeMaterials pCompositeMaterials, Lib3MF_uint32 nPropertyID)
+
+/*************************************************************************************************************************
+ Class implementation for ColorGroup
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_colorgroup_getcount(Lib3MF_ColorGroup pColorGroup, Lib3MF_uint32 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pCompositeMaterials;
+	IBase* pIBaseClass = (IBase *)pColorGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pCompositeMaterials, "CompositeMaterials", "RemoveComposite");
-			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pColorGroup, "ColorGroup", "GetCount");
 		}
-		ICompositeMaterials* pICompositeMaterials = dynamic_cast<ICompositeMaterials*>(pIBaseClass);
-		if (!pICompositeMaterials)
+		if (pCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IColorGroup* pIColorGroup = dynamic_cast<IColorGroup*>(pIBaseClass);
+		if (!pIColorGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pICompositeMaterials->RemoveComposite(nPropertyID);
+		*pCount = pIColorGroup->GetCount();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9106,23 +9344,22 @@ Lib3MFResult lib3mf_compositematerials_removecomposite(Lib3MF_CompositeMaterials
 	}
 }
 
-Lib3MFResult lib3mf_compositematerials_getcomposite(Lib3MF_CompositeMaterials pCompositeMaterials, Lib3MF_uint32 nPropertyID, const Lib3MF_uint64 nCompositeBufferSize, Lib3MF_uint64* pCompositeNeededCount, sLib3MFCompositeConstituent * pCompositeBuffer)
+Lib3MFResult lib3mf_colorgroup_getallpropertyids(Lib3MF_ColorGroup pColorGroup, const Lib3MF_uint64 nPropertyIDsBufferSize, Lib3MF_uint64* pPropertyIDsNeededCount, Lib3MF_uint32 * pPropertyIDsBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pCompositeMaterials;
+	IBase* pIBaseClass = (IBase *)pColorGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pCompositeMaterials, "CompositeMaterials", "GetComposite");
-			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pColorGroup, "ColorGroup", "GetAllPropertyIDs");
 		}
-		if ((!pCompositeBuffer) && !(pCompositeNeededCount))
+		if ((!pPropertyIDsBuffer) && !(pPropertyIDsNeededCount))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		ICompositeMaterials* pICompositeMaterials = dynamic_cast<ICompositeMaterials*>(pIBaseClass);
-		if (!pICompositeMaterials)
+		IColorGroup* pIColorGroup = dynamic_cast<IColorGroup*>(pIBaseClass);
+		if (!pIColorGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pICompositeMaterials->GetComposite(nPropertyID, nCompositeBufferSize, pCompositeNeededCount, pCompositeBuffer);
+		pIColorGroup->GetAllPropertyIDs(nPropertyIDsBufferSize, pPropertyIDsNeededCount, pPropertyIDsBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -9140,29 +9377,25 @@ Lib3MFResult lib3mf_compositematerials_getcomposite(Lib3MF_CompositeMaterials pC
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for MultiPropertyGroup
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_multipropertygroup_getcount(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_colorgroup_addcolor(Lib3MF_ColorGroup pColorGroup, const sLib3MFColor * pTheColor, Lib3MF_uint32 * pPropertyID)
 {
-	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
+	IBase* pIBaseClass = (IBase *)pColorGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "GetCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pColorGroup, "ColorGroup", "AddColor");
 		}
-		if (pCount == nullptr)
+		if (pPropertyID == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
-		if (!pIMultiPropertyGroup)
+		IColorGroup* pIColorGroup = dynamic_cast<IColorGroup*>(pIBaseClass);
+		if (!pIColorGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pIMultiPropertyGroup->GetCount();
+		*pPropertyID = pIColorGroup->AddColor(*pTheColor);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Count", *pCount);
+			pJournalEntry->addUInt32Result("PropertyID", *pPropertyID);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9178,22 +9411,21 @@ Lib3MFResult lib3mf_multipropertygroup_getcount(Lib3MF_MultiPropertyGroup pMulti
 	}
 }
 
-Lib3MFResult lib3mf_multipropertygroup_getallpropertyids(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, const Lib3MF_uint64 nPropertyIDsBufferSize, Lib3MF_uint64* pPropertyIDsNeededCount, Lib3MF_uint32 * pPropertyIDsBuffer)
+Lib3MFResult lib3mf_colorgroup_removecolor(Lib3MF_ColorGroup pColorGroup, Lib3MF_uint32 nPropertyID)
 {
-	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
+	IBase* pIBaseClass = (IBase *)pColorGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "GetAllPropertyIDs");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pColorGroup, "ColorGroup", "RemoveColor");
+			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
 		}
-		if ((!pPropertyIDsBuffer) && !(pPropertyIDsNeededCount))
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
-		if (!pIMultiPropertyGroup)
+		IColorGroup* pIColorGroup = dynamic_cast<IColorGroup*>(pIBaseClass);
+		if (!pIColorGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMultiPropertyGroup->GetAllPropertyIDs(nPropertyIDsBufferSize, pPropertyIDsNeededCount, pPropertyIDsBuffer);
+		pIColorGroup->RemoveColor(nPropertyID);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -9211,27 +9443,23 @@ Lib3MFResult lib3mf_multipropertygroup_getallpropertyids(Lib3MF_MultiPropertyGro
 	}
 }
 
-Lib3MFResult lib3mf_multipropertygroup_addmultiproperty(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, Lib3MF_uint64 nPropertyIDsBufferSize, const Lib3MF_uint32 * pPropertyIDsBuffer, Lib3MF_uint32 * pPropertyID)
+Lib3MFResult lib3mf_colorgroup_setcolor(Lib3MF_ColorGroup pColorGroup, Lib3MF_uint32 nPropertyID, const sLib3MFColor * pTheColor)
 {
-	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
+	IBase* pIBaseClass = (IBase *)pColorGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "AddMultiProperty");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pColorGroup, "ColorGroup", "SetColor");
+			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
 		}
-		if ( (!pPropertyIDsBuffer) && (nPropertyIDsBufferSize>0))
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pPropertyID == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
-		if (!pIMultiPropertyGroup)
+		IColorGroup* pIColorGroup = dynamic_cast<IColorGroup*>(pIBaseClass);
+		if (!pIColorGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pPropertyID = pIMultiPropertyGroup->AddMultiProperty(nPropertyIDsBufferSize, pPropertyIDsBuffer);
+		pIColorGroup->SetColor(nPropertyID, *pTheColor);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("PropertyID", *pPropertyID);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9247,23 +9475,23 @@ Lib3MFResult lib3mf_multipropertygroup_addmultiproperty(Lib3MF_MultiPropertyGrou
 	}
 }
 
-Lib3MFResult lib3mf_multipropertygroup_setmultiproperty(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, Lib3MF_uint32 nPropertyID, Lib3MF_uint64 nPropertyIDsBufferSize, const Lib3MF_uint32 * pPropertyIDsBuffer)
+Lib3MFResult lib3mf_colorgroup_getcolor(Lib3MF_ColorGroup pColorGroup, Lib3MF_uint32 nPropertyID, sLib3MFColor * pTheColor)
 {
-	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
+	IBase* pIBaseClass = (IBase *)pColorGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "SetMultiProperty");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pColorGroup, "ColorGroup", "GetColor");
 			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
 		}
-		if ( (!pPropertyIDsBuffer) && (nPropertyIDsBufferSize>0))
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
-		if (!pIMultiPropertyGroup)
+		if (pTheColor == nullptr)
+		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IColorGroup* pIColorGroup = dynamic_cast<IColorGroup*>(pIBaseClass);
+		if (!pIColorGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMultiPropertyGroup->SetMultiProperty(nPropertyID, nPropertyIDsBufferSize, pPropertyIDsBuffer);
+		*pTheColor = pIColorGroup->GetColor(nPropertyID);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -9281,25 +9509,29 @@ Lib3MFResult lib3mf_multipropertygroup_setmultiproperty(Lib3MF_MultiPropertyGrou
 	}
 }
 
-Lib3MFResult lib3mf_multipropertygroup_getmultiproperty(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, Lib3MF_uint32 nPropertyID, const Lib3MF_uint64 nPropertyIDsBufferSize, Lib3MF_uint64* pPropertyIDsNeededCount, Lib3MF_uint32 * pPropertyIDsBuffer)
+
+/*************************************************************************************************************************
+ Class implementation for Texture2DGroup
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_texture2dgroup_getcount(Lib3MF_Texture2DGroup pTexture2DGroup, Lib3MF_uint32 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
+	IBase* pIBaseClass = (IBase *)pTexture2DGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "GetMultiProperty");
-			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2DGroup, "Texture2DGroup", "GetCount");
 		}
-		if ((!pPropertyIDsBuffer) && !(pPropertyIDsNeededCount))
+		if (pCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
-		if (!pIMultiPropertyGroup)
+		ITexture2DGroup* pITexture2DGroup = dynamic_cast<ITexture2DGroup*>(pIBaseClass);
+		if (!pITexture2DGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMultiPropertyGroup->GetMultiProperty(nPropertyID, nPropertyIDsBufferSize, pPropertyIDsNeededCount, pPropertyIDsBuffer);
+		*pCount = pITexture2DGroup->GetCount();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9315,21 +9547,22 @@ Lib3MFResult lib3mf_multipropertygroup_getmultiproperty(Lib3MF_MultiPropertyGrou
 	}
 }
 
-Lib3MFResult lib3mf_multipropertygroup_removemultiproperty(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, Lib3MF_uint32 nPropertyID)
+Lib3MFResult lib3mf_texture2dgroup_getallpropertyids(Lib3MF_Texture2DGroup pTexture2DGroup, const Lib3MF_uint64 nPropertyIDsBufferSize, Lib3MF_uint64* pPropertyIDsNeededCount, Lib3MF_uint32 * pPropertyIDsBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
+	IBase* pIBaseClass = (IBase *)pTexture2DGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "RemoveMultiProperty");
-			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2DGroup, "Texture2DGroup", "GetAllPropertyIDs");
 		}
-		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
-		if (!pIMultiPropertyGroup)
+		if ((!pPropertyIDsBuffer) && !(pPropertyIDsNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		ITexture2DGroup* pITexture2DGroup = dynamic_cast<ITexture2DGroup*>(pIBaseClass);
+		if (!pITexture2DGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMultiPropertyGroup->RemoveMultiProperty(nPropertyID);
+		pITexture2DGroup->GetAllPropertyIDs(nPropertyIDsBufferSize, pPropertyIDsNeededCount, pPropertyIDsBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -9347,25 +9580,25 @@ Lib3MFResult lib3mf_multipropertygroup_removemultiproperty(Lib3MF_MultiPropertyG
 	}
 }
 
-Lib3MFResult lib3mf_multipropertygroup_getlayercount(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, Lib3MF_uint32 * pCount)
+Lib3MFResult lib3mf_texture2dgroup_addtex2coord(Lib3MF_Texture2DGroup pTexture2DGroup, const sLib3MFTex2Coord * pUVCoordinate, Lib3MF_uint32 * pPropertyID)
 {
-	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
+	IBase* pIBaseClass = (IBase *)pTexture2DGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "GetLayerCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2DGroup, "Texture2DGroup", "AddTex2Coord");
 		}
-		if (pCount == nullptr)
+		if (pPropertyID == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
-		if (!pIMultiPropertyGroup)
+		ITexture2DGroup* pITexture2DGroup = dynamic_cast<ITexture2DGroup*>(pIBaseClass);
+		if (!pITexture2DGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pIMultiPropertyGroup->GetLayerCount();
+		*pPropertyID = pITexture2DGroup->AddTex2Coord(*pUVCoordinate);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("Count", *pCount);
+			pJournalEntry->addUInt32Result("PropertyID", *pPropertyID);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9381,25 +9614,25 @@ Lib3MFResult lib3mf_multipropertygroup_getlayercount(Lib3MF_MultiPropertyGroup p
 	}
 }
 
-Lib3MFResult lib3mf_multipropertygroup_addlayer(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, const sLib3MFMultiPropertyLayer * pTheLayer, Lib3MF_uint32 * pLayerIndex)
+Lib3MFResult lib3mf_texture2dgroup_gettex2coord(Lib3MF_Texture2DGroup pTexture2DGroup, Lib3MF_uint32 nPropertyID, sLib3MFTex2Coord * pUVCoordinate)
 {
-	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
+	IBase* pIBaseClass = (IBase *)pTexture2DGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "AddLayer");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2DGroup, "Texture2DGroup", "GetTex2Coord");
+			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
 		}
-		if (pLayerIndex == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
-		if (!pIMultiPropertyGroup)
+		if (pUVCoordinate == nullptr)
+		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		ITexture2DGroup* pITexture2DGroup = dynamic_cast<ITexture2DGroup*>(pIBaseClass);
+		if (!pITexture2DGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pLayerIndex = pIMultiPropertyGroup->AddLayer(*pTheLayer);
+		*pUVCoordinate = pITexture2DGroup->GetTex2Coord(nPropertyID);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("LayerIndex", *pLayerIndex);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9415,23 +9648,21 @@ Lib3MFResult lib3mf_multipropertygroup_addlayer(Lib3MF_MultiPropertyGroup pMulti
 	}
 }
 
-Lib3MFResult lib3mf_multipropertygroup_getlayer(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, Lib3MF_uint32 nLayerIndex, sLib3MFMultiPropertyLayer * pTheLayer)
+Lib3MFResult lib3mf_texture2dgroup_removetex2coord(Lib3MF_Texture2DGroup pTexture2DGroup, Lib3MF_uint32 nPropertyID)
 {
-	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
+	IBase* pIBaseClass = (IBase *)pTexture2DGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "GetLayer");
-			pJournalEntry->addUInt32Parameter("LayerIndex", nLayerIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2DGroup, "Texture2DGroup", "RemoveTex2Coord");
+			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
 		}
-		if (pTheLayer == nullptr)
-		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
-		if (!pIMultiPropertyGroup)
+		ITexture2DGroup* pITexture2DGroup = dynamic_cast<ITexture2DGroup*>(pIBaseClass);
+		if (!pITexture2DGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pTheLayer = pIMultiPropertyGroup->GetLayer(nLayerIndex);
+		pITexture2DGroup->RemoveTex2Coord(nPropertyID);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -9449,23 +9680,27 @@ Lib3MFResult lib3mf_multipropertygroup_getlayer(Lib3MF_MultiPropertyGroup pMulti
 	}
 }
 
-Lib3MFResult lib3mf_multipropertygroup_removelayer(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, Lib3MF_uint32 nLayerIndex)
+Lib3MFResult lib3mf_texture2dgroup_gettexture2d(Lib3MF_Texture2DGroup pTexture2DGroup, Lib3MF_Texture2D * pTexture2DInstance)
 {
-	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
+	IBase* pIBaseClass = (IBase *)pTexture2DGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "RemoveLayer");
-			pJournalEntry->addUInt32Parameter("LayerIndex", nLayerIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2DGroup, "Texture2DGroup", "GetTexture2D");
 		}
-		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
-		if (!pIMultiPropertyGroup)
+		if (pTexture2DInstance == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseTexture2DInstance(nullptr);
+		ITexture2DGroup* pITexture2DGroup = dynamic_cast<ITexture2DGroup*>(pIBaseClass);
+		if (!pITexture2DGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIMultiPropertyGroup->RemoveLayer(nLayerIndex);
+		pBaseTexture2DInstance = pITexture2DGroup->GetTexture2D();
 
+		*pTexture2DInstance = (IBase*)(pBaseTexture2DInstance);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Texture2DInstance", *pTexture2DInstance);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9483,49 +9718,27 @@ Lib3MFResult lib3mf_multipropertygroup_removelayer(Lib3MF_MultiPropertyGroup pMu
 
 
 /*************************************************************************************************************************
- Class implementation for Image3D
+ Class implementation for CompositeMaterials
 **************************************************************************************************************************/
-Lib3MFResult lib3mf_image3d_getname(Lib3MF_Image3D pImage3D, const Lib3MF_uint32 nNameBufferSize, Lib3MF_uint32* pNameNeededChars, char * pNameBuffer)
+Lib3MFResult lib3mf_compositematerials_getcount(Lib3MF_CompositeMaterials pCompositeMaterials, Lib3MF_uint32 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pImage3D;
+	IBase* pIBaseClass = (IBase *)pCompositeMaterials;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImage3D, "Image3D", "GetName");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pCompositeMaterials, "CompositeMaterials", "GetCount");
 		}
-		if ( (!pNameBuffer) && !(pNameNeededChars) )
+		if (pCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sName("");
-		IImage3D* pIImage3D = dynamic_cast<IImage3D*>(pIBaseClass);
-		if (!pIImage3D)
+		ICompositeMaterials* pICompositeMaterials = dynamic_cast<ICompositeMaterials*>(pIBaseClass);
+		if (!pICompositeMaterials)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pNameBuffer == nullptr);
-		if (isCacheCall) {
-			sName = pIImage3D->GetName();
+		*pCount = pICompositeMaterials->GetCount();
 
-			pIImage3D->_setCache (new ParameterCache_1<std::string> (sName));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIImage3D->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sName);
-			pIImage3D->_setCache (nullptr);
-		}
-		
-		if (pNameNeededChars)
-			*pNameNeededChars = (Lib3MF_uint32) (sName.size()+1);
-		if (pNameBuffer) {
-			if (sName.size() >= nNameBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iName = 0; iName < sName.size(); iName++)
-				pNameBuffer[iName] = sName[iName];
-			pNameBuffer[sName.size()] = 0;
-		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Name", sName.c_str());
+			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9541,24 +9754,22 @@ Lib3MFResult lib3mf_image3d_getname(Lib3MF_Image3D pImage3D, const Lib3MF_uint32
 	}
 }
 
-Lib3MFResult lib3mf_image3d_setname(Lib3MF_Image3D pImage3D, const char * pName)
+Lib3MFResult lib3mf_compositematerials_getallpropertyids(Lib3MF_CompositeMaterials pCompositeMaterials, const Lib3MF_uint64 nPropertyIDsBufferSize, Lib3MF_uint64* pPropertyIDsNeededCount, Lib3MF_uint32 * pPropertyIDsBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pImage3D;
+	IBase* pIBaseClass = (IBase *)pCompositeMaterials;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImage3D, "Image3D", "SetName");
-			pJournalEntry->addStringParameter("Name", pName);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pCompositeMaterials, "CompositeMaterials", "GetAllPropertyIDs");
 		}
-		if (pName == nullptr)
+		if ((!pPropertyIDsBuffer) && !(pPropertyIDsNeededCount))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sName(pName);
-		IImage3D* pIImage3D = dynamic_cast<IImage3D*>(pIBaseClass);
-		if (!pIImage3D)
+		ICompositeMaterials* pICompositeMaterials = dynamic_cast<ICompositeMaterials*>(pIBaseClass);
+		if (!pICompositeMaterials)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIImage3D->SetName(sName);
+		pICompositeMaterials->GetAllPropertyIDs(nPropertyIDsBufferSize, pPropertyIDsNeededCount, pPropertyIDsBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -9576,25 +9787,27 @@ Lib3MFResult lib3mf_image3d_setname(Lib3MF_Image3D pImage3D, const char * pName)
 	}
 }
 
-Lib3MFResult lib3mf_image3d_isimagestack(Lib3MF_Image3D pImage3D, bool * pIsImageStack)
+Lib3MFResult lib3mf_compositematerials_getbasematerialgroup(Lib3MF_CompositeMaterials pCompositeMaterials, Lib3MF_BaseMaterialGroup * pBaseMaterialGroupInstance)
 {
-	IBase* pIBaseClass = (IBase *)pImage3D;
+	IBase* pIBaseClass = (IBase *)pCompositeMaterials;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImage3D, "Image3D", "IsImageStack");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pCompositeMaterials, "CompositeMaterials", "GetBaseMaterialGroup");
 		}
-		if (pIsImageStack == nullptr)
+		if (pBaseMaterialGroupInstance == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IImage3D* pIImage3D = dynamic_cast<IImage3D*>(pIBaseClass);
-		if (!pIImage3D)
+		IBase* pBaseBaseMaterialGroupInstance(nullptr);
+		ICompositeMaterials* pICompositeMaterials = dynamic_cast<ICompositeMaterials*>(pIBaseClass);
+		if (!pICompositeMaterials)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pIsImageStack = pIImage3D->IsImageStack();
+		pBaseBaseMaterialGroupInstance = pICompositeMaterials->GetBaseMaterialGroup();
 
+		*pBaseMaterialGroupInstance = (IBase*)(pBaseBaseMaterialGroupInstance);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("IsImageStack", *pIsImageStack);
+			pJournalEntry->addHandleResult("BaseMaterialGroupInstance", *pBaseMaterialGroupInstance);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9610,29 +9823,27 @@ Lib3MFResult lib3mf_image3d_isimagestack(Lib3MF_Image3D pImage3D, bool * pIsImag
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for ImageStack
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_imagestack_getrowcount(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 * pRowCount)
+Lib3MFResult lib3mf_compositematerials_addcomposite(Lib3MF_CompositeMaterials pCompositeMaterials, Lib3MF_uint64 nCompositeBufferSize, const sLib3MFCompositeConstituent * pCompositeBuffer, Lib3MF_uint32 * pPropertyID)
 {
-	IBase* pIBaseClass = (IBase *)pImageStack;
+	IBase* pIBaseClass = (IBase *)pCompositeMaterials;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "GetRowCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pCompositeMaterials, "CompositeMaterials", "AddComposite");
 		}
-		if (pRowCount == nullptr)
+		if ( (!pCompositeBuffer) && (nCompositeBufferSize>0))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
-		if (!pIImageStack)
+		if (pPropertyID == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		ICompositeMaterials* pICompositeMaterials = dynamic_cast<ICompositeMaterials*>(pIBaseClass);
+		if (!pICompositeMaterials)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pRowCount = pIImageStack->GetRowCount();
+		*pPropertyID = pICompositeMaterials->AddComposite(nCompositeBufferSize, pCompositeBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("RowCount", *pRowCount);
+			pJournalEntry->addUInt32Result("PropertyID", *pPropertyID);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9648,21 +9859,21 @@ Lib3MFResult lib3mf_imagestack_getrowcount(Lib3MF_ImageStack pImageStack, Lib3MF
 	}
 }
 
-Lib3MFResult lib3mf_imagestack_setrowcount(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 nRowCount)
+Lib3MFResult lib3mf_compositematerials_removecomposite(Lib3MF_CompositeMaterials pCompositeMaterials, Lib3MF_uint32 nPropertyID)
 {
-	IBase* pIBaseClass = (IBase *)pImageStack;
+	IBase* pIBaseClass = (IBase *)pCompositeMaterials;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "SetRowCount");
-			pJournalEntry->addUInt32Parameter("RowCount", nRowCount);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pCompositeMaterials, "CompositeMaterials", "RemoveComposite");
+			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
 		}
-		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
-		if (!pIImageStack)
+		ICompositeMaterials* pICompositeMaterials = dynamic_cast<ICompositeMaterials*>(pIBaseClass);
+		if (!pICompositeMaterials)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIImageStack->SetRowCount(nRowCount);
+		pICompositeMaterials->RemoveComposite(nPropertyID);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -9680,25 +9891,25 @@ Lib3MFResult lib3mf_imagestack_setrowcount(Lib3MF_ImageStack pImageStack, Lib3MF
 	}
 }
 
-Lib3MFResult lib3mf_imagestack_getcolumncount(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 * pColumnCount)
+Lib3MFResult lib3mf_compositematerials_getcomposite(Lib3MF_CompositeMaterials pCompositeMaterials, Lib3MF_uint32 nPropertyID, const Lib3MF_uint64 nCompositeBufferSize, Lib3MF_uint64* pCompositeNeededCount, sLib3MFCompositeConstituent * pCompositeBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pImageStack;
+	IBase* pIBaseClass = (IBase *)pCompositeMaterials;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "GetColumnCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pCompositeMaterials, "CompositeMaterials", "GetComposite");
+			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
 		}
-		if (pColumnCount == nullptr)
+		if ((!pCompositeBuffer) && !(pCompositeNeededCount))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
-		if (!pIImageStack)
+		ICompositeMaterials* pICompositeMaterials = dynamic_cast<ICompositeMaterials*>(pIBaseClass);
+		if (!pICompositeMaterials)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pColumnCount = pIImageStack->GetColumnCount();
+		pICompositeMaterials->GetComposite(nPropertyID, nCompositeBufferSize, pCompositeNeededCount, pCompositeBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("ColumnCount", *pColumnCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9714,23 +9925,29 @@ Lib3MFResult lib3mf_imagestack_getcolumncount(Lib3MF_ImageStack pImageStack, Lib
 	}
 }
 
-Lib3MFResult lib3mf_imagestack_setcolumncount(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 nColumnCount)
+
+/*************************************************************************************************************************
+ Class implementation for MultiPropertyGroup
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_multipropertygroup_getcount(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, Lib3MF_uint32 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pImageStack;
+	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "SetColumnCount");
-			pJournalEntry->addUInt32Parameter("ColumnCount", nColumnCount);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "GetCount");
 		}
-		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
-		if (!pIImageStack)
+		if (pCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
+		if (!pIMultiPropertyGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIImageStack->SetColumnCount(nColumnCount);
+		*pCount = pIMultiPropertyGroup->GetCount();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9746,25 +9963,24 @@ Lib3MFResult lib3mf_imagestack_setcolumncount(Lib3MF_ImageStack pImageStack, Lib
 	}
 }
 
-Lib3MFResult lib3mf_imagestack_getsheetcount(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 * pSheetCount)
+Lib3MFResult lib3mf_multipropertygroup_getallpropertyids(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, const Lib3MF_uint64 nPropertyIDsBufferSize, Lib3MF_uint64* pPropertyIDsNeededCount, Lib3MF_uint32 * pPropertyIDsBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pImageStack;
+	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "GetSheetCount");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "GetAllPropertyIDs");
 		}
-		if (pSheetCount == nullptr)
+		if ((!pPropertyIDsBuffer) && !(pPropertyIDsNeededCount))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
-		if (!pIImageStack)
+		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
+		if (!pIMultiPropertyGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pSheetCount = pIImageStack->GetSheetCount();
+		pIMultiPropertyGroup->GetAllPropertyIDs(nPropertyIDsBufferSize, pPropertyIDsNeededCount, pPropertyIDsBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt32Result("SheetCount", *pSheetCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9780,28 +9996,27 @@ Lib3MFResult lib3mf_imagestack_getsheetcount(Lib3MF_ImageStack pImageStack, Lib3
 	}
 }
 
-Lib3MFResult lib3mf_imagestack_getsheet(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 nIndex, Lib3MF_Attachment * pSheet)
+Lib3MFResult lib3mf_multipropertygroup_addmultiproperty(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, Lib3MF_uint64 nPropertyIDsBufferSize, const Lib3MF_uint32 * pPropertyIDsBuffer, Lib3MF_uint32 * pPropertyID)
 {
-	IBase* pIBaseClass = (IBase *)pImageStack;
+	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "GetSheet");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "AddMultiProperty");
 		}
-		if (pSheet == nullptr)
+		if ( (!pPropertyIDsBuffer) && (nPropertyIDsBufferSize>0))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseSheet(nullptr);
-		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
-		if (!pIImageStack)
+		if (pPropertyID == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
+		if (!pIMultiPropertyGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseSheet = pIImageStack->GetSheet(nIndex);
+		*pPropertyID = pIMultiPropertyGroup->AddMultiProperty(nPropertyIDsBufferSize, pPropertyIDsBuffer);
 
-		*pSheet = (IBase*)(pBaseSheet);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Sheet", *pSheet);
+			pJournalEntry->addUInt32Result("PropertyID", *pPropertyID);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9817,27 +10032,23 @@ Lib3MFResult lib3mf_imagestack_getsheet(Lib3MF_ImageStack pImageStack, Lib3MF_ui
 	}
 }
 
-Lib3MFResult lib3mf_imagestack_setsheet(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 nIndex, Lib3MF_Attachment pSheet)
+Lib3MFResult lib3mf_multipropertygroup_setmultiproperty(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, Lib3MF_uint32 nPropertyID, Lib3MF_uint64 nPropertyIDsBufferSize, const Lib3MF_uint32 * pPropertyIDsBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pImageStack;
+	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "SetSheet");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
-			pJournalEntry->addHandleParameter("Sheet", pSheet);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "SetMultiProperty");
+			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
 		}
-		IBase* pIBaseClassSheet = (IBase *)pSheet;
-		IAttachment* pISheet = dynamic_cast<IAttachment*>(pIBaseClassSheet);
-		if (!pISheet)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
-		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
-		if (!pIImageStack)
+		if ( (!pPropertyIDsBuffer) && (nPropertyIDsBufferSize>0))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
+		if (!pIMultiPropertyGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIImageStack->SetSheet(nIndex, pISheet);
+		pIMultiPropertyGroup->SetMultiProperty(nPropertyID, nPropertyIDsBufferSize, pPropertyIDsBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -9855,32 +10066,25 @@ Lib3MFResult lib3mf_imagestack_setsheet(Lib3MF_ImageStack pImageStack, Lib3MF_ui
 	}
 }
 
-Lib3MFResult lib3mf_imagestack_createemptysheet(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 nIndex, const char * pPath, Lib3MF_Attachment * pSheet)
+Lib3MFResult lib3mf_multipropertygroup_getmultiproperty(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, Lib3MF_uint32 nPropertyID, const Lib3MF_uint64 nPropertyIDsBufferSize, Lib3MF_uint64* pPropertyIDsNeededCount, Lib3MF_uint32 * pPropertyIDsBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pImageStack;
+	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "CreateEmptySheet");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
-			pJournalEntry->addStringParameter("Path", pPath);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "GetMultiProperty");
+			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
 		}
-		if (pPath == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pSheet == nullptr)
+		if ((!pPropertyIDsBuffer) && !(pPropertyIDsNeededCount))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sPath(pPath);
-		IBase* pBaseSheet(nullptr);
-		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
-		if (!pIImageStack)
+		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
+		if (!pIMultiPropertyGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseSheet = pIImageStack->CreateEmptySheet(nIndex, sPath);
+		pIMultiPropertyGroup->GetMultiProperty(nPropertyID, nPropertyIDsBufferSize, pPropertyIDsNeededCount, pPropertyIDsBuffer);
 
-		*pSheet = (IBase*)(pBaseSheet);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Sheet", *pSheet);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9896,34 +10100,23 @@ Lib3MFResult lib3mf_imagestack_createemptysheet(Lib3MF_ImageStack pImageStack, L
 	}
 }
 
-Lib3MFResult lib3mf_imagestack_createsheetfrombuffer(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 nIndex, const char * pPath, Lib3MF_uint64 nDataBufferSize, const Lib3MF_uint8 * pDataBuffer, Lib3MF_Attachment * pSheet)
+Lib3MFResult lib3mf_multipropertygroup_removemultiproperty(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, Lib3MF_uint32 nPropertyID)
 {
-	IBase* pIBaseClass = (IBase *)pImageStack;
+	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "CreateSheetFromBuffer");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
-			pJournalEntry->addStringParameter("Path", pPath);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "RemoveMultiProperty");
+			pJournalEntry->addUInt32Parameter("PropertyID", nPropertyID);
 		}
-		if (pPath == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if ( (!pDataBuffer) && (nDataBufferSize>0))
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pSheet == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sPath(pPath);
-		IBase* pBaseSheet(nullptr);
-		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
-		if (!pIImageStack)
+		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
+		if (!pIMultiPropertyGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseSheet = pIImageStack->CreateSheetFromBuffer(nIndex, sPath, nDataBufferSize, pDataBuffer);
+		pIMultiPropertyGroup->RemoveMultiProperty(nPropertyID);
 
-		*pSheet = (IBase*)(pBaseSheet);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Sheet", *pSheet);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9939,36 +10132,25 @@ Lib3MFResult lib3mf_imagestack_createsheetfrombuffer(Lib3MF_ImageStack pImageSta
 	}
 }
 
-Lib3MFResult lib3mf_imagestack_createsheetfromfile(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 nIndex, const char * pPath, const char * pFileName, Lib3MF_Attachment * pSheet)
+Lib3MFResult lib3mf_multipropertygroup_getlayercount(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, Lib3MF_uint32 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pImageStack;
+	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "CreateSheetFromFile");
-			pJournalEntry->addUInt32Parameter("Index", nIndex);
-			pJournalEntry->addStringParameter("Path", pPath);
-			pJournalEntry->addStringParameter("FileName", pFileName);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "GetLayerCount");
 		}
-		if (pPath == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pFileName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pSheet == nullptr)
+		if (pCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sPath(pPath);
-		std::string sFileName(pFileName);
-		IBase* pBaseSheet(nullptr);
-		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
-		if (!pIImageStack)
+		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
+		if (!pIMultiPropertyGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseSheet = pIImageStack->CreateSheetFromFile(nIndex, sPath, sFileName);
+		*pCount = pIMultiPropertyGroup->GetLayerCount();
 
-		*pSheet = (IBase*)(pBaseSheet);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Sheet", *pSheet);
+			pJournalEntry->addUInt32Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -9984,51 +10166,25 @@ Lib3MFResult lib3mf_imagestack_createsheetfromfile(Lib3MF_ImageStack pImageStack
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for Attachment
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_attachment_getpath(Lib3MF_Attachment pAttachment, const Lib3MF_uint32 nPathBufferSize, Lib3MF_uint32* pPathNeededChars, char * pPathBuffer)
+Lib3MFResult lib3mf_multipropertygroup_addlayer(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, const sLib3MFMultiPropertyLayer * pTheLayer, Lib3MF_uint32 * pLayerIndex)
 {
-	IBase* pIBaseClass = (IBase *)pAttachment;
+	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "GetPath");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "AddLayer");
 		}
-		if ( (!pPathBuffer) && !(pPathNeededChars) )
+		if (pLayerIndex == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sPath("");
-		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
-		if (!pIAttachment)
+		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
+		if (!pIMultiPropertyGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pPathBuffer == nullptr);
-		if (isCacheCall) {
-			sPath = pIAttachment->GetPath();
+		*pLayerIndex = pIMultiPropertyGroup->AddLayer(*pTheLayer);
 
-			pIAttachment->_setCache (new ParameterCache_1<std::string> (sPath));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIAttachment->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sPath);
-			pIAttachment->_setCache (nullptr);
-		}
-		
-		if (pPathNeededChars)
-			*pPathNeededChars = (Lib3MF_uint32) (sPath.size()+1);
-		if (pPathBuffer) {
-			if (sPath.size() >= nPathBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iPath = 0; iPath < sPath.size(); iPath++)
-				pPathBuffer[iPath] = sPath[iPath];
-			pPathBuffer[sPath.size()] = 0;
-		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Path", sPath.c_str());
+			pJournalEntry->addUInt32Result("LayerIndex", *pLayerIndex);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -10044,24 +10200,23 @@ Lib3MFResult lib3mf_attachment_getpath(Lib3MF_Attachment pAttachment, const Lib3
 	}
 }
 
-Lib3MFResult lib3mf_attachment_setpath(Lib3MF_Attachment pAttachment, const char * pPath)
+Lib3MFResult lib3mf_multipropertygroup_getlayer(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, Lib3MF_uint32 nLayerIndex, sLib3MFMultiPropertyLayer * pTheLayer)
 {
-	IBase* pIBaseClass = (IBase *)pAttachment;
+	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "SetPath");
-			pJournalEntry->addStringParameter("Path", pPath);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "GetLayer");
+			pJournalEntry->addUInt32Parameter("LayerIndex", nLayerIndex);
 		}
-		if (pPath == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sPath(pPath);
-		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
-		if (!pIAttachment)
+		if (pTheLayer == nullptr)
+		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
+		if (!pIMultiPropertyGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIAttachment->SetPath(sPath);
+		*pTheLayer = pIMultiPropertyGroup->GetLayer(nLayerIndex);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -10079,27 +10234,23 @@ Lib3MFResult lib3mf_attachment_setpath(Lib3MF_Attachment pAttachment, const char
 	}
 }
 
-Lib3MFResult lib3mf_attachment_packagepart(Lib3MF_Attachment pAttachment, Lib3MF_PackagePart * pPackagePart)
+Lib3MFResult lib3mf_multipropertygroup_removelayer(Lib3MF_MultiPropertyGroup pMultiPropertyGroup, Lib3MF_uint32 nLayerIndex)
 {
-	IBase* pIBaseClass = (IBase *)pAttachment;
+	IBase* pIBaseClass = (IBase *)pMultiPropertyGroup;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "PackagePart");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMultiPropertyGroup, "MultiPropertyGroup", "RemoveLayer");
+			pJournalEntry->addUInt32Parameter("LayerIndex", nLayerIndex);
 		}
-		if (pPackagePart == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBasePackagePart(nullptr);
-		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
-		if (!pIAttachment)
+		IMultiPropertyGroup* pIMultiPropertyGroup = dynamic_cast<IMultiPropertyGroup*>(pIBaseClass);
+		if (!pIMultiPropertyGroup)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBasePackagePart = pIAttachment->PackagePart();
+		pIMultiPropertyGroup->RemoveLayer(nLayerIndex);
 
-		*pPackagePart = (IBase*)(pBasePackagePart);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("PackagePart", *pPackagePart);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -10115,47 +10266,51 @@ Lib3MFResult lib3mf_attachment_packagepart(Lib3MF_Attachment pAttachment, Lib3MF
 	}
 }
 
-Lib3MFResult lib3mf_attachment_getrelationshiptype(Lib3MF_Attachment pAttachment, const Lib3MF_uint32 nPathBufferSize, Lib3MF_uint32* pPathNeededChars, char * pPathBuffer)
+
+/*************************************************************************************************************************
+ Class implementation for Image3D
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_image3d_getname(Lib3MF_Image3D pImage3D, const Lib3MF_uint32 nNameBufferSize, Lib3MF_uint32* pNameNeededChars, char * pNameBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pAttachment;
+	IBase* pIBaseClass = (IBase *)pImage3D;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "GetRelationShipType");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImage3D, "Image3D", "GetName");
 		}
-		if ( (!pPathBuffer) && !(pPathNeededChars) )
+		if ( (!pNameBuffer) && !(pNameNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sPath("");
-		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
-		if (!pIAttachment)
+		std::string sName("");
+		IImage3D* pIImage3D = dynamic_cast<IImage3D*>(pIBaseClass);
+		if (!pIImage3D)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pPathBuffer == nullptr);
+		bool isCacheCall = (pNameBuffer == nullptr);
 		if (isCacheCall) {
-			sPath = pIAttachment->GetRelationShipType();
+			sName = pIImage3D->GetName();
 
-			pIAttachment->_setCache (new ParameterCache_1<std::string> (sPath));
+			pIImage3D->_setCache (new ParameterCache_1<std::string> (sName));
 		}
 		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIAttachment->_getCache ());
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIImage3D->_getCache ());
 			if (cache == nullptr)
 				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sPath);
-			pIAttachment->_setCache (nullptr);
+			cache->retrieveData (sName);
+			pIImage3D->_setCache (nullptr);
 		}
 		
-		if (pPathNeededChars)
-			*pPathNeededChars = (Lib3MF_uint32) (sPath.size()+1);
-		if (pPathBuffer) {
-			if (sPath.size() >= nPathBufferSize)
+		if (pNameNeededChars)
+			*pNameNeededChars = (Lib3MF_uint32) (sName.size()+1);
+		if (pNameBuffer) {
+			if (sName.size() >= nNameBufferSize)
 				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iPath = 0; iPath < sPath.size(); iPath++)
-				pPathBuffer[iPath] = sPath[iPath];
-			pPathBuffer[sPath.size()] = 0;
+			for (size_t iName = 0; iName < sName.size(); iName++)
+				pNameBuffer[iName] = sName[iName];
+			pNameBuffer[sName.size()] = 0;
 		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Path", sPath.c_str());
+			pJournalEntry->addStringResult("Name", sName.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -10171,24 +10326,24 @@ Lib3MFResult lib3mf_attachment_getrelationshiptype(Lib3MF_Attachment pAttachment
 	}
 }
 
-Lib3MFResult lib3mf_attachment_setrelationshiptype(Lib3MF_Attachment pAttachment, const char * pPath)
+Lib3MFResult lib3mf_image3d_setname(Lib3MF_Image3D pImage3D, const char * pName)
 {
-	IBase* pIBaseClass = (IBase *)pAttachment;
+	IBase* pIBaseClass = (IBase *)pImage3D;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "SetRelationShipType");
-			pJournalEntry->addStringParameter("Path", pPath);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImage3D, "Image3D", "SetName");
+			pJournalEntry->addStringParameter("Name", pName);
 		}
-		if (pPath == nullptr)
+		if (pName == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sPath(pPath);
-		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
-		if (!pIAttachment)
+		std::string sName(pName);
+		IImage3D* pIImage3D = dynamic_cast<IImage3D*>(pIBaseClass);
+		if (!pIImage3D)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIAttachment->SetRelationShipType(sPath);
+		pIImage3D->SetName(sName);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -10206,26 +10361,25 @@ Lib3MFResult lib3mf_attachment_setrelationshiptype(Lib3MF_Attachment pAttachment
 	}
 }
 
-Lib3MFResult lib3mf_attachment_writetofile(Lib3MF_Attachment pAttachment, const char * pFileName)
+Lib3MFResult lib3mf_image3d_isimagestack(Lib3MF_Image3D pImage3D, bool * pIsImageStack)
 {
-	IBase* pIBaseClass = (IBase *)pAttachment;
+	IBase* pIBaseClass = (IBase *)pImage3D;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "WriteToFile");
-			pJournalEntry->addStringParameter("FileName", pFileName);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImage3D, "Image3D", "IsImageStack");
 		}
-		if (pFileName == nullptr)
+		if (pIsImageStack == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sFileName(pFileName);
-		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
-		if (!pIAttachment)
+		IImage3D* pIImage3D = dynamic_cast<IImage3D*>(pIBaseClass);
+		if (!pIImage3D)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIAttachment->WriteToFile(sFileName);
+		*pIsImageStack = pIImage3D->IsImageStack();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addBooleanResult("IsImageStack", *pIsImageStack);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -10241,26 +10395,29 @@ Lib3MFResult lib3mf_attachment_writetofile(Lib3MF_Attachment pAttachment, const
 	}
 }
 
-Lib3MFResult lib3mf_attachment_readfromfile(Lib3MF_Attachment pAttachment, const char * pFileName)
+
+/*************************************************************************************************************************
+ Class implementation for ImageStack
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_imagestack_getrowcount(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 * pRowCount)
 {
-	IBase* pIBaseClass = (IBase *)pAttachment;
+	IBase* pIBaseClass = (IBase *)pImageStack;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "ReadFromFile");
-			pJournalEntry->addStringParameter("FileName", pFileName);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "GetRowCount");
 		}
-		if (pFileName == nullptr)
+		if (pRowCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sFileName(pFileName);
-		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
-		if (!pIAttachment)
+		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
+		if (!pIImageStack)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIAttachment->ReadFromFile(sFileName);
+		*pRowCount = pIImageStack->GetRowCount();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("RowCount", *pRowCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -10276,22 +10433,21 @@ Lib3MFResult lib3mf_attachment_readfromfile(Lib3MF_Attachment pAttachment, const
 	}
 }
 
-Lib3MFResult lib3mf_attachment_readfromcallback(Lib3MF_Attachment pAttachment, Lib3MFReadCallback pTheReadCallback, Lib3MF_uint64 nStreamSize, Lib3MFSeekCallback pTheSeekCallback, Lib3MF_pvoid pUserData)
+Lib3MFResult lib3mf_imagestack_setrowcount(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 nRowCount)
 {
-	IBase* pIBaseClass = (IBase *)pAttachment;
+	IBase* pIBaseClass = (IBase *)pImageStack;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "ReadFromCallback");
-			pJournalEntry->addUInt64Parameter("StreamSize", nStreamSize);
-			pJournalEntry->addPointerParameter("UserData", pUserData);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "SetRowCount");
+			pJournalEntry->addUInt32Parameter("RowCount", nRowCount);
 		}
-		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
-		if (!pIAttachment)
+		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
+		if (!pIImageStack)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIAttachment->ReadFromCallback(pTheReadCallback, nStreamSize, pTheSeekCallback, pUserData);
+		pIImageStack->SetRowCount(nRowCount);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -10309,25 +10465,25 @@ Lib3MFResult lib3mf_attachment_readfromcallback(Lib3MF_Attachment pAttachment, L
 	}
 }
 
-Lib3MFResult lib3mf_attachment_getstreamsize(Lib3MF_Attachment pAttachment, Lib3MF_uint64 * pStreamSize)
+Lib3MFResult lib3mf_imagestack_getcolumncount(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 * pColumnCount)
 {
-	IBase* pIBaseClass = (IBase *)pAttachment;
+	IBase* pIBaseClass = (IBase *)pImageStack;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "GetStreamSize");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "GetColumnCount");
 		}
-		if (pStreamSize == nullptr)
+		if (pColumnCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
-		if (!pIAttachment)
+		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
+		if (!pIImageStack)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pStreamSize = pIAttachment->GetStreamSize();
+		*pColumnCount = pIImageStack->GetColumnCount();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt64Result("StreamSize", *pStreamSize);
+			pJournalEntry->addUInt32Result("ColumnCount", *pColumnCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -10343,22 +10499,21 @@ Lib3MFResult lib3mf_attachment_getstreamsize(Lib3MF_Attachment pAttachment, Lib3
 	}
 }
 
-Lib3MFResult lib3mf_attachment_writetobuffer(Lib3MF_Attachment pAttachment, const Lib3MF_uint64 nBufferBufferSize, Lib3MF_uint64* pBufferNeededCount, Lib3MF_uint8 * pBufferBuffer)
+Lib3MFResult lib3mf_imagestack_setcolumncount(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 nColumnCount)
 {
-	IBase* pIBaseClass = (IBase *)pAttachment;
+	IBase* pIBaseClass = (IBase *)pImageStack;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "WriteToBuffer");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "SetColumnCount");
+			pJournalEntry->addUInt32Parameter("ColumnCount", nColumnCount);
 		}
-		if ((!pBufferBuffer) && !(pBufferNeededCount))
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
-		if (!pIAttachment)
+		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
+		if (!pIImageStack)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIAttachment->WriteToBuffer(nBufferBufferSize, pBufferNeededCount, pBufferBuffer);
+		pIImageStack->SetColumnCount(nColumnCount);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -10376,24 +10531,25 @@ Lib3MFResult lib3mf_attachment_writetobuffer(Lib3MF_Attachment pAttachment, cons
 	}
 }
 
-Lib3MFResult lib3mf_attachment_readfrombuffer(Lib3MF_Attachment pAttachment, Lib3MF_uint64 nBufferBufferSize, const Lib3MF_uint8 * pBufferBuffer)
+Lib3MFResult lib3mf_imagestack_getsheetcount(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 * pSheetCount)
 {
-	IBase* pIBaseClass = (IBase *)pAttachment;
+	IBase* pIBaseClass = (IBase *)pImageStack;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "ReadFromBuffer");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "GetSheetCount");
 		}
-		if ( (!pBufferBuffer) && (nBufferBufferSize>0))
+		if (pSheetCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
-		if (!pIAttachment)
+		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
+		if (!pIImageStack)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIAttachment->ReadFromBuffer(nBufferBufferSize, pBufferBuffer);
+		*pSheetCount = pIImageStack->GetSheetCount();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("SheetCount", *pSheetCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -10409,31 +10565,28 @@ Lib3MFResult lib3mf_attachment_readfrombuffer(Lib3MF_Attachment pAttachment, Lib
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for Texture2D
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_texture2d_getattachment(Lib3MF_Texture2D pTexture2D, Lib3MF_Attachment * pAttachment)
+Lib3MFResult lib3mf_imagestack_getsheet(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 nIndex, Lib3MF_Attachment * pSheet)
 {
-	IBase* pIBaseClass = (IBase *)pTexture2D;
+	IBase* pIBaseClass = (IBase *)pImageStack;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2D, "Texture2D", "GetAttachment");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "GetSheet");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
 		}
-		if (pAttachment == nullptr)
+		if (pSheet == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseAttachment(nullptr);
-		ITexture2D* pITexture2D = dynamic_cast<ITexture2D*>(pIBaseClass);
-		if (!pITexture2D)
+		IBase* pBaseSheet(nullptr);
+		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
+		if (!pIImageStack)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseAttachment = pITexture2D->GetAttachment();
+		pBaseSheet = pIImageStack->GetSheet(nIndex);
 
-		*pAttachment = (IBase*)(pBaseAttachment);
+		*pSheet = (IBase*)(pBaseSheet);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Attachment", *pAttachment);
+			pJournalEntry->addHandleResult("Sheet", *pSheet);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -10449,26 +10602,27 @@ Lib3MFResult lib3mf_texture2d_getattachment(Lib3MF_Texture2D pTexture2D, Lib3MF_
 	}
 }
 
-Lib3MFResult lib3mf_texture2d_setattachment(Lib3MF_Texture2D pTexture2D, Lib3MF_Attachment pAttachment)
+Lib3MFResult lib3mf_imagestack_setsheet(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 nIndex, Lib3MF_Attachment pSheet)
 {
-	IBase* pIBaseClass = (IBase *)pTexture2D;
+	IBase* pIBaseClass = (IBase *)pImageStack;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2D, "Texture2D", "SetAttachment");
-			pJournalEntry->addHandleParameter("Attachment", pAttachment);
-		}
-		IBase* pIBaseClassAttachment = (IBase *)pAttachment;
-		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClassAttachment);
-		if (!pIAttachment)
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "SetSheet");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry->addHandleParameter("Sheet", pSheet);
+		}
+		IBase* pIBaseClassSheet = (IBase *)pSheet;
+		IAttachment* pISheet = dynamic_cast<IAttachment*>(pIBaseClassSheet);
+		if (!pISheet)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
 		
-		ITexture2D* pITexture2D = dynamic_cast<ITexture2D*>(pIBaseClass);
-		if (!pITexture2D)
+		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
+		if (!pIImageStack)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pITexture2D->SetAttachment(pIAttachment);
+		pIImageStack->SetSheet(nIndex, pISheet);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -10486,25 +10640,32 @@ Lib3MFResult lib3mf_texture2d_setattachment(Lib3MF_Texture2D pTexture2D, Lib3MF_
 	}
 }
 
-Lib3MFResult lib3mf_texture2d_getcontenttype(Lib3MF_Texture2D pTexture2D, eLib3MFTextureType * pContentType)
+Lib3MFResult lib3mf_imagestack_createemptysheet(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 nIndex, const char * pPath, Lib3MF_Attachment * pSheet)
 {
-	IBase* pIBaseClass = (IBase *)pTexture2D;
+	IBase* pIBaseClass = (IBase *)pImageStack;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2D, "Texture2D", "GetContentType");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "CreateEmptySheet");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry->addStringParameter("Path", pPath);
 		}
-		if (pContentType == nullptr)
+		if (pPath == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		ITexture2D* pITexture2D = dynamic_cast<ITexture2D*>(pIBaseClass);
-		if (!pITexture2D)
+		if (pSheet == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sPath(pPath);
+		IBase* pBaseSheet(nullptr);
+		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
+		if (!pIImageStack)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pContentType = pITexture2D->GetContentType();
+		pBaseSheet = pIImageStack->CreateEmptySheet(nIndex, sPath);
 
+		*pSheet = (IBase*)(pBaseSheet);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addEnumResult("ContentType", "TextureType", (Lib3MF_int32)(*pContentType));
+			pJournalEntry->addHandleResult("Sheet", *pSheet);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -10520,23 +10681,34 @@ Lib3MFResult lib3mf_texture2d_getcontenttype(Lib3MF_Texture2D pTexture2D, eLib3M
 	}
 }
 
-Lib3MFResult lib3mf_texture2d_setcontenttype(Lib3MF_Texture2D pTexture2D, eLib3MFTextureType eContentType)
+Lib3MFResult lib3mf_imagestack_createsheetfrombuffer(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 nIndex, const char * pPath, Lib3MF_uint64 nDataBufferSize, const Lib3MF_uint8 * pDataBuffer, Lib3MF_Attachment * pSheet)
 {
-	IBase* pIBaseClass = (IBase *)pTexture2D;
+	IBase* pIBaseClass = (IBase *)pImageStack;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2D, "Texture2D", "SetContentType");
-			pJournalEntry->addEnumParameter("ContentType", "TextureType", (Lib3MF_int32)(eContentType));
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "CreateSheetFromBuffer");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry->addStringParameter("Path", pPath);
 		}
-		ITexture2D* pITexture2D = dynamic_cast<ITexture2D*>(pIBaseClass);
-		if (!pITexture2D)
+		if (pPath == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if ( (!pDataBuffer) && (nDataBufferSize>0))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pSheet == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sPath(pPath);
+		IBase* pBaseSheet(nullptr);
+		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
+		if (!pIImageStack)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pITexture2D->SetContentType(eContentType);
+		pBaseSheet = pIImageStack->CreateSheetFromBuffer(nIndex, sPath, nDataBufferSize, pDataBuffer);
 
+		*pSheet = (IBase*)(pBaseSheet);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Sheet", *pSheet);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -10552,28 +10724,36 @@ Lib3MFResult lib3mf_texture2d_setcontenttype(Lib3MF_Texture2D pTexture2D, eLib3M
 	}
 }
 
-Lib3MFResult lib3mf_texture2d_gettilestyleuv(Lib3MF_Texture2D pTexture2D, eLib3MFTextureTileStyle * pTileStyleU, eLib3MFTextureTileStyle * pTileStyleV)
+Lib3MFResult lib3mf_imagestack_createsheetfromfile(Lib3MF_ImageStack pImageStack, Lib3MF_uint32 nIndex, const char * pPath, const char * pFileName, Lib3MF_Attachment * pSheet)
 {
-	IBase* pIBaseClass = (IBase *)pTexture2D;
+	IBase* pIBaseClass = (IBase *)pImageStack;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2D, "Texture2D", "GetTileStyleUV");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImageStack, "ImageStack", "CreateSheetFromFile");
+			pJournalEntry->addUInt32Parameter("Index", nIndex);
+			pJournalEntry->addStringParameter("Path", pPath);
+			pJournalEntry->addStringParameter("FileName", pFileName);
 		}
-		if (!pTileStyleU)
+		if (pPath == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (!pTileStyleV)
+		if (pFileName == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		ITexture2D* pITexture2D = dynamic_cast<ITexture2D*>(pIBaseClass);
-		if (!pITexture2D)
+		if (pSheet == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sPath(pPath);
+		std::string sFileName(pFileName);
+		IBase* pBaseSheet(nullptr);
+		IImageStack* pIImageStack = dynamic_cast<IImageStack*>(pIBaseClass);
+		if (!pIImageStack)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pITexture2D->GetTileStyleUV(*pTileStyleU, *pTileStyleV);
+		pBaseSheet = pIImageStack->CreateSheetFromFile(nIndex, sPath, sFileName);
 
+		*pSheet = (IBase*)(pBaseSheet);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addEnumResult("TileStyleU", "TextureTileStyle", (Lib3MF_int32)(*pTileStyleU));
-			pJournalEntry->addEnumResult("TileStyleV", "TextureTileStyle", (Lib3MF_int32)(*pTileStyleV));
+			pJournalEntry->addHandleResult("Sheet", *pSheet);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -10589,24 +10769,51 @@ Lib3MFResult lib3mf_texture2d_gettilestyleuv(Lib3MF_Texture2D pTexture2D, eLib3M
 	}
 }
 
-Lib3MFResult lib3mf_texture2d_settilestyleuv(Lib3MF_Texture2D pTexture2D, eLib3MFTextureTileStyle eTileStyleU, eLib3MFTextureTileStyle eTileStyleV)
+
+/*************************************************************************************************************************
+ Class implementation for Attachment
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_attachment_getpath(Lib3MF_Attachment pAttachment, const Lib3MF_uint32 nPathBufferSize, Lib3MF_uint32* pPathNeededChars, char * pPathBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pTexture2D;
+	IBase* pIBaseClass = (IBase *)pAttachment;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2D, "Texture2D", "SetTileStyleUV");
-			pJournalEntry->addEnumParameter("TileStyleU", "TextureTileStyle", (Lib3MF_int32)(eTileStyleU));
-			pJournalEntry->addEnumParameter("TileStyleV", "TextureTileStyle", (Lib3MF_int32)(eTileStyleV));
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "GetPath");
 		}
-		ITexture2D* pITexture2D = dynamic_cast<ITexture2D*>(pIBaseClass);
-		if (!pITexture2D)
+		if ( (!pPathBuffer) && !(pPathNeededChars) )
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sPath("");
+		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
+		if (!pIAttachment)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pITexture2D->SetTileStyleUV(eTileStyleU, eTileStyleV);
+		bool isCacheCall = (pPathBuffer == nullptr);
+		if (isCacheCall) {
+			sPath = pIAttachment->GetPath();
 
+			pIAttachment->_setCache (new ParameterCache_1<std::string> (sPath));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIAttachment->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sPath);
+			pIAttachment->_setCache (nullptr);
+		}
+		
+		if (pPathNeededChars)
+			*pPathNeededChars = (Lib3MF_uint32) (sPath.size()+1);
+		if (pPathBuffer) {
+			if (sPath.size() >= nPathBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iPath = 0; iPath < sPath.size(); iPath++)
+				pPathBuffer[iPath] = sPath[iPath];
+			pPathBuffer[sPath.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addStringResult("Path", sPath.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -10622,25 +10829,26 @@ Lib3MFResult lib3mf_texture2d_settilestyleuv(Lib3MF_Texture2D pTexture2D, eLib3M
 	}
 }
 
-Lib3MFResult lib3mf_texture2d_getfilter(Lib3MF_Texture2D pTexture2D, eLib3MFTextureFilter * pFilter)
+Lib3MFResult lib3mf_attachment_setpath(Lib3MF_Attachment pAttachment, const char * pPath)
 {
-	IBase* pIBaseClass = (IBase *)pTexture2D;
+	IBase* pIBaseClass = (IBase *)pAttachment;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2D, "Texture2D", "GetFilter");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "SetPath");
+			pJournalEntry->addStringParameter("Path", pPath);
 		}
-		if (pFilter == nullptr)
+		if (pPath == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		ITexture2D* pITexture2D = dynamic_cast<ITexture2D*>(pIBaseClass);
-		if (!pITexture2D)
+		std::string sPath(pPath);
+		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
+		if (!pIAttachment)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pFilter = pITexture2D->GetFilter();
+		pIAttachment->SetPath(sPath);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addEnumResult("Filter", "TextureFilter", (Lib3MF_int32)(*pFilter));
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -10656,23 +10864,27 @@ Lib3MFResult lib3mf_texture2d_getfilter(Lib3MF_Texture2D pTexture2D, eLib3MFText
 	}
 }
 
-Lib3MFResult lib3mf_texture2d_setfilter(Lib3MF_Texture2D pTexture2D, eLib3MFTextureFilter eFilter)
+Lib3MFResult lib3mf_attachment_packagepart(Lib3MF_Attachment pAttachment, Lib3MF_PackagePart * pPackagePart)
 {
-	IBase* pIBaseClass = (IBase *)pTexture2D;
+	IBase* pIBaseClass = (IBase *)pAttachment;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2D, "Texture2D", "SetFilter");
-			pJournalEntry->addEnumParameter("Filter", "TextureFilter", (Lib3MF_int32)(eFilter));
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "PackagePart");
 		}
-		ITexture2D* pITexture2D = dynamic_cast<ITexture2D*>(pIBaseClass);
-		if (!pITexture2D)
+		if (pPackagePart == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBasePackagePart(nullptr);
+		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
+		if (!pIAttachment)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pITexture2D->SetFilter(eFilter);
+		pBasePackagePart = pIAttachment->PackagePart();
 
+		*pPackagePart = (IBase*)(pBasePackagePart);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("PackagePart", *pPackagePart);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -10688,51 +10900,47 @@ Lib3MFResult lib3mf_texture2d_setfilter(Lib3MF_Texture2D pTexture2D, eLib3MFText
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for ImplicitPort
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_implicitport_getidentifier(Lib3MF_ImplicitPort pImplicitPort, const Lib3MF_uint32 nIdentifierBufferSize, Lib3MF_uint32* pIdentifierNeededChars, char * pIdentifierBuffer)
+Lib3MFResult lib3mf_attachment_getrelationshiptype(Lib3MF_Attachment pAttachment, const Lib3MF_uint32 nPathBufferSize, Lib3MF_uint32* pPathNeededChars, char * pPathBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitPort;
+	IBase* pIBaseClass = (IBase *)pAttachment;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitPort, "ImplicitPort", "GetIdentifier");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "GetRelationShipType");
 		}
-		if ( (!pIdentifierBuffer) && !(pIdentifierNeededChars) )
+		if ( (!pPathBuffer) && !(pPathNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier("");
-		IImplicitPort* pIImplicitPort = dynamic_cast<IImplicitPort*>(pIBaseClass);
-		if (!pIImplicitPort)
+		std::string sPath("");
+		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
+		if (!pIAttachment)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pIdentifierBuffer == nullptr);
+		bool isCacheCall = (pPathBuffer == nullptr);
 		if (isCacheCall) {
-			sIdentifier = pIImplicitPort->GetIdentifier();
+			sPath = pIAttachment->GetRelationShipType();
 
-			pIImplicitPort->_setCache (new ParameterCache_1<std::string> (sIdentifier));
+			pIAttachment->_setCache (new ParameterCache_1<std::string> (sPath));
 		}
 		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIImplicitPort->_getCache ());
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIAttachment->_getCache ());
 			if (cache == nullptr)
 				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sIdentifier);
-			pIImplicitPort->_setCache (nullptr);
+			cache->retrieveData (sPath);
+			pIAttachment->_setCache (nullptr);
 		}
 		
-		if (pIdentifierNeededChars)
-			*pIdentifierNeededChars = (Lib3MF_uint32) (sIdentifier.size()+1);
-		if (pIdentifierBuffer) {
-			if (sIdentifier.size() >= nIdentifierBufferSize)
+		if (pPathNeededChars)
+			*pPathNeededChars = (Lib3MF_uint32) (sPath.size()+1);
+		if (pPathBuffer) {
+			if (sPath.size() >= nPathBufferSize)
 				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iIdentifier = 0; iIdentifier < sIdentifier.size(); iIdentifier++)
-				pIdentifierBuffer[iIdentifier] = sIdentifier[iIdentifier];
-			pIdentifierBuffer[sIdentifier.size()] = 0;
+			for (size_t iPath = 0; iPath < sPath.size(); iPath++)
+				pPathBuffer[iPath] = sPath[iPath];
+			pPathBuffer[sPath.size()] = 0;
 		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Identifier", sIdentifier.c_str());
+			pJournalEntry->addStringResult("Path", sPath.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -10748,24 +10956,24 @@ Lib3MFResult lib3mf_implicitport_getidentifier(Lib3MF_ImplicitPort pImplicitPort
 	}
 }
 
-Lib3MFResult lib3mf_implicitport_setidentifier(Lib3MF_ImplicitPort pImplicitPort, const char * pIdentifier)
+Lib3MFResult lib3mf_attachment_setrelationshiptype(Lib3MF_Attachment pAttachment, const char * pPath)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitPort;
+	IBase* pIBaseClass = (IBase *)pAttachment;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitPort, "ImplicitPort", "SetIdentifier");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "SetRelationShipType");
+			pJournalEntry->addStringParameter("Path", pPath);
 		}
-		if (pIdentifier == nullptr)
+		if (pPath == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		IImplicitPort* pIImplicitPort = dynamic_cast<IImplicitPort*>(pIBaseClass);
-		if (!pIImplicitPort)
+		std::string sPath(pPath);
+		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
+		if (!pIAttachment)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIImplicitPort->SetIdentifier(sIdentifier);
+		pIAttachment->SetRelationShipType(sPath);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -10783,48 +10991,27 @@ Lib3MFResult lib3mf_implicitport_setidentifier(Lib3MF_ImplicitPort pImplicitPort
 	}
 }
 
-Lib3MFResult lib3mf_implicitport_getdisplayname(Lib3MF_ImplicitPort pImplicitPort, const Lib3MF_uint32 nDisplayNameBufferSize, Lib3MF_uint32* pDisplayNameNeededChars, char * pDisplayNameBuffer)
+Lib3MFResult lib3mf_attachment_writetofile(Lib3MF_Attachment pAttachment, const char * pFileName)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitPort;
+	IBase* pIBaseClass = (IBase *)pAttachment;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitPort, "ImplicitPort", "GetDisplayName");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "WriteToFile");
+			pJournalEntry->addStringParameter("FileName", pFileName);
 		}
-		if ( (!pDisplayNameBuffer) && !(pDisplayNameNeededChars) )
+		if (pFileName == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sDisplayName("");
-		IImplicitPort* pIImplicitPort = dynamic_cast<IImplicitPort*>(pIBaseClass);
-		if (!pIImplicitPort)
+		std::string sFileName(pFileName);
+		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
+		if (!pIAttachment)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pDisplayNameBuffer == nullptr);
-		if (isCacheCall) {
-			sDisplayName = pIImplicitPort->GetDisplayName();
+		pIAttachment->WriteToFile(sFileName);
 
-			pIImplicitPort->_setCache (new ParameterCache_1<std::string> (sDisplayName));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIImplicitPort->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sDisplayName);
-			pIImplicitPort->_setCache (nullptr);
-		}
-		
-		if (pDisplayNameNeededChars)
-			*pDisplayNameNeededChars = (Lib3MF_uint32) (sDisplayName.size()+1);
-		if (pDisplayNameBuffer) {
-			if (sDisplayName.size() >= nDisplayNameBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iDisplayName = 0; iDisplayName < sDisplayName.size(); iDisplayName++)
-				pDisplayNameBuffer[iDisplayName] = sDisplayName[iDisplayName];
-			pDisplayNameBuffer[sDisplayName.size()] = 0;
-		}
-		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("DisplayName", sDisplayName.c_str());
-			pJournalEntry->writeSuccess();
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
 	}
@@ -10839,24 +11026,24 @@ Lib3MFResult lib3mf_implicitport_getdisplayname(Lib3MF_ImplicitPort pImplicitPor
 	}
 }
 
-Lib3MFResult lib3mf_implicitport_setdisplayname(Lib3MF_ImplicitPort pImplicitPort, const char * pDisplayName)
+Lib3MFResult lib3mf_attachment_readfromfile(Lib3MF_Attachment pAttachment, const char * pFileName)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitPort;
+	IBase* pIBaseClass = (IBase *)pAttachment;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitPort, "ImplicitPort", "SetDisplayName");
-			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "ReadFromFile");
+			pJournalEntry->addStringParameter("FileName", pFileName);
 		}
-		if (pDisplayName == nullptr)
+		if (pFileName == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sDisplayName(pDisplayName);
-		IImplicitPort* pIImplicitPort = dynamic_cast<IImplicitPort*>(pIBaseClass);
-		if (!pIImplicitPort)
+		std::string sFileName(pFileName);
+		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
+		if (!pIAttachment)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIImplicitPort->SetDisplayName(sDisplayName);
+		pIAttachment->ReadFromFile(sFileName);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -10874,21 +11061,22 @@ Lib3MFResult lib3mf_implicitport_setdisplayname(Lib3MF_ImplicitPort pImplicitPor
 	}
 }
 
-Lib3MFResult lib3mf_implicitport_settype(Lib3MF_ImplicitPort pImplicitPort, eLib3MFImplicitPortType eImplicitPortType)
+Lib3MFResult lib3mf_attachment_readfromcallback(Lib3MF_Attachment pAttachment, Lib3MFReadCallback pTheReadCallback, Lib3MF_uint64 nStreamSize, Lib3MFSeekCallback pTheSeekCallback, Lib3MF_pvoid pUserData)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitPort;
+	IBase* pIBaseClass = (IBase *)pAttachment;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitPort, "ImplicitPort", "SetType");
-			pJournalEntry->addEnumParameter("ImplicitPortType", "ImplicitPortType", (Lib3MF_int32)(eImplicitPortType));
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "ReadFromCallback");
+			pJournalEntry->addUInt64Parameter("StreamSize", nStreamSize);
+			pJournalEntry->addPointerParameter("UserData", pUserData);
 		}
-		IImplicitPort* pIImplicitPort = dynamic_cast<IImplicitPort*>(pIBaseClass);
-		if (!pIImplicitPort)
+		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
+		if (!pIAttachment)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIImplicitPort->SetType(eImplicitPortType);
+		pIAttachment->ReadFromCallback(pTheReadCallback, nStreamSize, pTheSeekCallback, pUserData);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -10906,25 +11094,25 @@ Lib3MFResult lib3mf_implicitport_settype(Lib3MF_ImplicitPort pImplicitPort, eLib
 	}
 }
 
-Lib3MFResult lib3mf_implicitport_gettype(Lib3MF_ImplicitPort pImplicitPort, eLib3MFImplicitPortType * pImplicitPortType)
+Lib3MFResult lib3mf_attachment_getstreamsize(Lib3MF_Attachment pAttachment, Lib3MF_uint64 * pStreamSize)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitPort;
+	IBase* pIBaseClass = (IBase *)pAttachment;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitPort, "ImplicitPort", "GetType");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "GetStreamSize");
 		}
-		if (pImplicitPortType == nullptr)
+		if (pStreamSize == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IImplicitPort* pIImplicitPort = dynamic_cast<IImplicitPort*>(pIBaseClass);
-		if (!pIImplicitPort)
+		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
+		if (!pIAttachment)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pImplicitPortType = pIImplicitPort->GetType();
+		*pStreamSize = pIAttachment->GetStreamSize();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addEnumResult("ImplicitPortType", "ImplicitPortType", (Lib3MF_int32)(*pImplicitPortType));
+			pJournalEntry->addUInt64Result("StreamSize", *pStreamSize);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -10940,47 +11128,24 @@ Lib3MFResult lib3mf_implicitport_gettype(Lib3MF_ImplicitPort pImplicitPort, eLib
 	}
 }
 
-Lib3MFResult lib3mf_implicitport_getreference(Lib3MF_ImplicitPort pImplicitPort, const Lib3MF_uint32 nReferenceBufferSize, Lib3MF_uint32* pReferenceNeededChars, char * pReferenceBuffer)
+Lib3MFResult lib3mf_attachment_writetobuffer(Lib3MF_Attachment pAttachment, const Lib3MF_uint64 nBufferBufferSize, Lib3MF_uint64* pBufferNeededCount, Lib3MF_uint8 * pBufferBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitPort;
+	IBase* pIBaseClass = (IBase *)pAttachment;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitPort, "ImplicitPort", "GetReference");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "WriteToBuffer");
 		}
-		if ( (!pReferenceBuffer) && !(pReferenceNeededChars) )
+		if ((!pBufferBuffer) && !(pBufferNeededCount))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sReference("");
-		IImplicitPort* pIImplicitPort = dynamic_cast<IImplicitPort*>(pIBaseClass);
-		if (!pIImplicitPort)
+		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
+		if (!pIAttachment)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pReferenceBuffer == nullptr);
-		if (isCacheCall) {
-			sReference = pIImplicitPort->GetReference();
+		pIAttachment->WriteToBuffer(nBufferBufferSize, pBufferNeededCount, pBufferBuffer);
 
-			pIImplicitPort->_setCache (new ParameterCache_1<std::string> (sReference));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIImplicitPort->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sReference);
-			pIImplicitPort->_setCache (nullptr);
-		}
-		
-		if (pReferenceNeededChars)
-			*pReferenceNeededChars = (Lib3MF_uint32) (sReference.size()+1);
-		if (pReferenceBuffer) {
-			if (sReference.size() >= nReferenceBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iReference = 0; iReference < sReference.size(); iReference++)
-				pReferenceBuffer[iReference] = sReference[iReference];
-			pReferenceBuffer[sReference.size()] = 0;
-		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Reference", sReference.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -10996,24 +11161,22 @@ Lib3MFResult lib3mf_implicitport_getreference(Lib3MF_ImplicitPort pImplicitPort,
 	}
 }
 
-Lib3MFResult lib3mf_implicitport_setreference(Lib3MF_ImplicitPort pImplicitPort, const char * pReference)
+Lib3MFResult lib3mf_attachment_readfrombuffer(Lib3MF_Attachment pAttachment, Lib3MF_uint64 nBufferBufferSize, const Lib3MF_uint8 * pBufferBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitPort;
+	IBase* pIBaseClass = (IBase *)pAttachment;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitPort, "ImplicitPort", "SetReference");
-			pJournalEntry->addStringParameter("Reference", pReference);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pAttachment, "Attachment", "ReadFromBuffer");
 		}
-		if (pReference == nullptr)
+		if ( (!pBufferBuffer) && (nBufferBufferSize>0))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sReference(pReference);
-		IImplicitPort* pIImplicitPort = dynamic_cast<IImplicitPort*>(pIBaseClass);
-		if (!pIImplicitPort)
+		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClass);
+		if (!pIAttachment)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIImplicitPort->SetReference(sReference);
+		pIAttachment->ReadFromBuffer(nBufferBufferSize, pBufferBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -11033,27 +11196,29 @@ Lib3MFResult lib3mf_implicitport_setreference(Lib3MF_ImplicitPort pImplicitPort,
 
 
 /*************************************************************************************************************************
- Class implementation for Iterator
+ Class implementation for Texture2D
 **************************************************************************************************************************/
-Lib3MFResult lib3mf_iterator_movenext(Lib3MF_Iterator pIterator, bool * pHasNext)
+Lib3MFResult lib3mf_texture2d_getattachment(Lib3MF_Texture2D pTexture2D, Lib3MF_Attachment * pAttachment)
 {
-	IBase* pIBaseClass = (IBase *)pIterator;
+	IBase* pIBaseClass = (IBase *)pTexture2D;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pIterator, "Iterator", "MoveNext");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2D, "Texture2D", "GetAttachment");
 		}
-		if (pHasNext == nullptr)
+		if (pAttachment == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IIterator* pIIterator = dynamic_cast<IIterator*>(pIBaseClass);
-		if (!pIIterator)
+		IBase* pBaseAttachment(nullptr);
+		ITexture2D* pITexture2D = dynamic_cast<ITexture2D*>(pIBaseClass);
+		if (!pITexture2D)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pHasNext = pIIterator->MoveNext();
+		pBaseAttachment = pITexture2D->GetAttachment();
 
+		*pAttachment = (IBase*)(pBaseAttachment);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("HasNext", *pHasNext);
+			pJournalEntry->addHandleResult("Attachment", *pAttachment);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -11069,25 +11234,28 @@ Lib3MFResult lib3mf_iterator_movenext(Lib3MF_Iterator pIterator, bool * pHasNext
 	}
 }
 
-Lib3MFResult lib3mf_iterator_moveprevious(Lib3MF_Iterator pIterator, bool * pHasPrevious)
+Lib3MFResult lib3mf_texture2d_setattachment(Lib3MF_Texture2D pTexture2D, Lib3MF_Attachment pAttachment)
 {
-	IBase* pIBaseClass = (IBase *)pIterator;
+	IBase* pIBaseClass = (IBase *)pTexture2D;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pIterator, "Iterator", "MovePrevious");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2D, "Texture2D", "SetAttachment");
+			pJournalEntry->addHandleParameter("Attachment", pAttachment);
 		}
-		if (pHasPrevious == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IIterator* pIIterator = dynamic_cast<IIterator*>(pIBaseClass);
-		if (!pIIterator)
+		IBase* pIBaseClassAttachment = (IBase *)pAttachment;
+		IAttachment* pIAttachment = dynamic_cast<IAttachment*>(pIBaseClassAttachment);
+		if (!pIAttachment)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
+		ITexture2D* pITexture2D = dynamic_cast<ITexture2D*>(pIBaseClass);
+		if (!pITexture2D)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pHasPrevious = pIIterator->MovePrevious();
+		pITexture2D->SetAttachment(pIAttachment);
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("HasPrevious", *pHasPrevious);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -11103,25 +11271,25 @@ Lib3MFResult lib3mf_iterator_moveprevious(Lib3MF_Iterator pIterator, bool * pHas
 	}
 }
 
-Lib3MFResult lib3mf_iterator_count(Lib3MF_Iterator pIterator, Lib3MF_uint64 * pCount)
+Lib3MFResult lib3mf_texture2d_getcontenttype(Lib3MF_Texture2D pTexture2D, eLib3MFTextureType * pContentType)
 {
-	IBase* pIBaseClass = (IBase *)pIterator;
+	IBase* pIBaseClass = (IBase *)pTexture2D;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pIterator, "Iterator", "Count");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2D, "Texture2D", "GetContentType");
 		}
-		if (pCount == nullptr)
+		if (pContentType == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IIterator* pIIterator = dynamic_cast<IIterator*>(pIBaseClass);
-		if (!pIIterator)
+		ITexture2D* pITexture2D = dynamic_cast<ITexture2D*>(pIBaseClass);
+		if (!pITexture2D)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pCount = pIIterator->Count();
+		*pContentType = pITexture2D->GetContentType();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addUInt64Result("Count", *pCount);
+			pJournalEntry->addEnumResult("ContentType", "TextureType", (Lib3MF_int32)(*pContentType));
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -11137,31 +11305,23 @@ Lib3MFResult lib3mf_iterator_count(Lib3MF_Iterator pIterator, Lib3MF_uint64 * pC
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for ImplicitPortIterator
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_implicitportiterator_getcurrent(Lib3MF_ImplicitPortIterator pImplicitPortIterator, Lib3MF_ImplicitPort * pPort)
+Lib3MFResult lib3mf_texture2d_setcontenttype(Lib3MF_Texture2D pTexture2D, eLib3MFTextureType eContentType)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitPortIterator;
+	IBase* pIBaseClass = (IBase *)pTexture2D;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitPortIterator, "ImplicitPortIterator", "GetCurrent");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2D, "Texture2D", "SetContentType");
+			pJournalEntry->addEnumParameter("ContentType", "TextureType", (Lib3MF_int32)(eContentType));
 		}
-		if (pPort == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBasePort(nullptr);
-		IImplicitPortIterator* pIImplicitPortIterator = dynamic_cast<IImplicitPortIterator*>(pIBaseClass);
-		if (!pIImplicitPortIterator)
+		ITexture2D* pITexture2D = dynamic_cast<ITexture2D*>(pIBaseClass);
+		if (!pITexture2D)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBasePort = pIImplicitPortIterator->GetCurrent();
+		pITexture2D->SetContentType(eContentType);
 
-		*pPort = (IBase*)(pBasePort);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Port", *pPort);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -11177,51 +11337,28 @@ Lib3MFResult lib3mf_implicitportiterator_getcurrent(Lib3MF_ImplicitPortIterator
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for ImplicitNode
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_implicitnode_getidentifier(Lib3MF_ImplicitNode pImplicitNode, const Lib3MF_uint32 nIdentifierBufferSize, Lib3MF_uint32* pIdentifierNeededChars, char * pIdentifierBuffer)
+Lib3MFResult lib3mf_texture2d_gettilestyleuv(Lib3MF_Texture2D pTexture2D, eLib3MFTextureTileStyle * pTileStyleU, eLib3MFTextureTileStyle * pTileStyleV)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitNode;
+	IBase* pIBaseClass = (IBase *)pTexture2D;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "GetIdentifier");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2D, "Texture2D", "GetTileStyleUV");
 		}
-		if ( (!pIdentifierBuffer) && !(pIdentifierNeededChars) )
+		if (!pTileStyleU)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier("");
-		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
-		if (!pIImplicitNode)
+		if (!pTileStyleV)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		ITexture2D* pITexture2D = dynamic_cast<ITexture2D*>(pIBaseClass);
+		if (!pITexture2D)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pIdentifierBuffer == nullptr);
-		if (isCacheCall) {
-			sIdentifier = pIImplicitNode->GetIdentifier();
+		pITexture2D->GetTileStyleUV(*pTileStyleU, *pTileStyleV);
 
-			pIImplicitNode->_setCache (new ParameterCache_1<std::string> (sIdentifier));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIImplicitNode->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sIdentifier);
-			pIImplicitNode->_setCache (nullptr);
-		}
-		
-		if (pIdentifierNeededChars)
-			*pIdentifierNeededChars = (Lib3MF_uint32) (sIdentifier.size()+1);
-		if (pIdentifierBuffer) {
-			if (sIdentifier.size() >= nIdentifierBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iIdentifier = 0; iIdentifier < sIdentifier.size(); iIdentifier++)
-				pIdentifierBuffer[iIdentifier] = sIdentifier[iIdentifier];
-			pIdentifierBuffer[sIdentifier.size()] = 0;
-		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Identifier", sIdentifier.c_str());
+			pJournalEntry->addEnumResult("TileStyleU", "TextureTileStyle", (Lib3MF_int32)(*pTileStyleU));
+			pJournalEntry->addEnumResult("TileStyleV", "TextureTileStyle", (Lib3MF_int32)(*pTileStyleV));
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -11237,24 +11374,22 @@ Lib3MFResult lib3mf_implicitnode_getidentifier(Lib3MF_ImplicitNode pImplicitNode
 	}
 }
 
-Lib3MFResult lib3mf_implicitnode_setidentifier(Lib3MF_ImplicitNode pImplicitNode, const char * pIdentifier)
+Lib3MFResult lib3mf_texture2d_settilestyleuv(Lib3MF_Texture2D pTexture2D, eLib3MFTextureTileStyle eTileStyleU, eLib3MFTextureTileStyle eTileStyleV)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitNode;
+	IBase* pIBaseClass = (IBase *)pTexture2D;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "SetIdentifier");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2D, "Texture2D", "SetTileStyleUV");
+			pJournalEntry->addEnumParameter("TileStyleU", "TextureTileStyle", (Lib3MF_int32)(eTileStyleU));
+			pJournalEntry->addEnumParameter("TileStyleV", "TextureTileStyle", (Lib3MF_int32)(eTileStyleV));
 		}
-		if (pIdentifier == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
-		if (!pIImplicitNode)
+		ITexture2D* pITexture2D = dynamic_cast<ITexture2D*>(pIBaseClass);
+		if (!pITexture2D)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIImplicitNode->SetIdentifier(sIdentifier);
+		pITexture2D->SetTileStyleUV(eTileStyleU, eTileStyleV);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -11272,47 +11407,25 @@ Lib3MFResult lib3mf_implicitnode_setidentifier(Lib3MF_ImplicitNode pImplicitNode
 	}
 }
 
-Lib3MFResult lib3mf_implicitnode_getdisplayname(Lib3MF_ImplicitNode pImplicitNode, const Lib3MF_uint32 nDisplayNameBufferSize, Lib3MF_uint32* pDisplayNameNeededChars, char * pDisplayNameBuffer)
+Lib3MFResult lib3mf_texture2d_getfilter(Lib3MF_Texture2D pTexture2D, eLib3MFTextureFilter * pFilter)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitNode;
+	IBase* pIBaseClass = (IBase *)pTexture2D;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "GetDisplayName");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2D, "Texture2D", "GetFilter");
 		}
-		if ( (!pDisplayNameBuffer) && !(pDisplayNameNeededChars) )
+		if (pFilter == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sDisplayName("");
-		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
-		if (!pIImplicitNode)
+		ITexture2D* pITexture2D = dynamic_cast<ITexture2D*>(pIBaseClass);
+		if (!pITexture2D)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pDisplayNameBuffer == nullptr);
-		if (isCacheCall) {
-			sDisplayName = pIImplicitNode->GetDisplayName();
+		*pFilter = pITexture2D->GetFilter();
 
-			pIImplicitNode->_setCache (new ParameterCache_1<std::string> (sDisplayName));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIImplicitNode->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sDisplayName);
-			pIImplicitNode->_setCache (nullptr);
-		}
-		
-		if (pDisplayNameNeededChars)
-			*pDisplayNameNeededChars = (Lib3MF_uint32) (sDisplayName.size()+1);
-		if (pDisplayNameBuffer) {
-			if (sDisplayName.size() >= nDisplayNameBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iDisplayName = 0; iDisplayName < sDisplayName.size(); iDisplayName++)
-				pDisplayNameBuffer[iDisplayName] = sDisplayName[iDisplayName];
-			pDisplayNameBuffer[sDisplayName.size()] = 0;
-		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("DisplayName", sDisplayName.c_str());
+			pJournalEntry->addEnumResult("Filter", "TextureFilter", (Lib3MF_int32)(*pFilter));
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -11328,24 +11441,21 @@ Lib3MFResult lib3mf_implicitnode_getdisplayname(Lib3MF_ImplicitNode pImplicitNod
 	}
 }
 
-Lib3MFResult lib3mf_implicitnode_setdisplayname(Lib3MF_ImplicitNode pImplicitNode, const char * pDisplayName)
+Lib3MFResult lib3mf_texture2d_setfilter(Lib3MF_Texture2D pTexture2D, eLib3MFTextureFilter eFilter)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitNode;
+	IBase* pIBaseClass = (IBase *)pTexture2D;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "SetDisplayName");
-			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTexture2D, "Texture2D", "SetFilter");
+			pJournalEntry->addEnumParameter("Filter", "TextureFilter", (Lib3MF_int32)(eFilter));
 		}
-		if (pDisplayName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sDisplayName(pDisplayName);
-		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
-		if (!pIImplicitNode)
+		ITexture2D* pITexture2D = dynamic_cast<ITexture2D*>(pIBaseClass);
+		if (!pITexture2D)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIImplicitNode->SetDisplayName(sDisplayName);
+		pITexture2D->SetFilter(eFilter);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -11363,47 +11473,51 @@ Lib3MFResult lib3mf_implicitnode_setdisplayname(Lib3MF_ImplicitNode pImplicitNod
 	}
 }
 
-Lib3MFResult lib3mf_implicitnode_gettag(Lib3MF_ImplicitNode pImplicitNode, const Lib3MF_uint32 nTagBufferSize, Lib3MF_uint32* pTagNeededChars, char * pTagBuffer)
+
+/*************************************************************************************************************************
+ Class implementation for ImplicitPort
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_implicitport_getidentifier(Lib3MF_ImplicitPort pImplicitPort, const Lib3MF_uint32 nIdentifierBufferSize, Lib3MF_uint32* pIdentifierNeededChars, char * pIdentifierBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitNode;
+	IBase* pIBaseClass = (IBase *)pImplicitPort;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "GetTag");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitPort, "ImplicitPort", "GetIdentifier");
 		}
-		if ( (!pTagBuffer) && !(pTagNeededChars) )
+		if ( (!pIdentifierBuffer) && !(pIdentifierNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sTag("");
-		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
-		if (!pIImplicitNode)
+		std::string sIdentifier("");
+		IImplicitPort* pIImplicitPort = dynamic_cast<IImplicitPort*>(pIBaseClass);
+		if (!pIImplicitPort)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pTagBuffer == nullptr);
+		bool isCacheCall = (pIdentifierBuffer == nullptr);
 		if (isCacheCall) {
-			sTag = pIImplicitNode->GetTag();
+			sIdentifier = pIImplicitPort->GetIdentifier();
 
-			pIImplicitNode->_setCache (new ParameterCache_1<std::string> (sTag));
+			pIImplicitPort->_setCache (new ParameterCache_1<std::string> (sIdentifier));
 		}
 		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIImplicitNode->_getCache ());
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIImplicitPort->_getCache ());
 			if (cache == nullptr)
 				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sTag);
-			pIImplicitNode->_setCache (nullptr);
+			cache->retrieveData (sIdentifier);
+			pIImplicitPort->_setCache (nullptr);
 		}
 		
-		if (pTagNeededChars)
-			*pTagNeededChars = (Lib3MF_uint32) (sTag.size()+1);
-		if (pTagBuffer) {
-			if (sTag.size() >= nTagBufferSize)
+		if (pIdentifierNeededChars)
+			*pIdentifierNeededChars = (Lib3MF_uint32) (sIdentifier.size()+1);
+		if (pIdentifierBuffer) {
+			if (sIdentifier.size() >= nIdentifierBufferSize)
 				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iTag = 0; iTag < sTag.size(); iTag++)
-				pTagBuffer[iTag] = sTag[iTag];
-			pTagBuffer[sTag.size()] = 0;
+			for (size_t iIdentifier = 0; iIdentifier < sIdentifier.size(); iIdentifier++)
+				pIdentifierBuffer[iIdentifier] = sIdentifier[iIdentifier];
+			pIdentifierBuffer[sIdentifier.size()] = 0;
 		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Tag", sTag.c_str());
+			pJournalEntry->addStringResult("Identifier", sIdentifier.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -11419,24 +11533,24 @@ Lib3MFResult lib3mf_implicitnode_gettag(Lib3MF_ImplicitNode pImplicitNode, const
 	}
 }
 
-Lib3MFResult lib3mf_implicitnode_settag(Lib3MF_ImplicitNode pImplicitNode, const char * pTag)
+Lib3MFResult lib3mf_implicitport_setidentifier(Lib3MF_ImplicitPort pImplicitPort, const char * pIdentifier)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitNode;
+	IBase* pIBaseClass = (IBase *)pImplicitPort;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "SetTag");
-			pJournalEntry->addStringParameter("Tag", pTag);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitPort, "ImplicitPort", "SetIdentifier");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 		}
-		if (pTag == nullptr)
+		if (pIdentifier == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sTag(pTag);
-		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
-		if (!pIImplicitNode)
+		std::string sIdentifier(pIdentifier);
+		IImplicitPort* pIImplicitPort = dynamic_cast<IImplicitPort*>(pIBaseClass);
+		if (!pIImplicitPort)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIImplicitNode->SetTag(sTag);
+		pIImplicitPort->SetIdentifier(sIdentifier);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -11454,25 +11568,47 @@ Lib3MFResult lib3mf_implicitnode_settag(Lib3MF_ImplicitNode pImplicitNode, const
 	}
 }
 
-Lib3MFResult lib3mf_implicitnode_getnodetype(Lib3MF_ImplicitNode pImplicitNode, eLib3MFImplicitNodeType * pType)
+Lib3MFResult lib3mf_implicitport_getdisplayname(Lib3MF_ImplicitPort pImplicitPort, const Lib3MF_uint32 nDisplayNameBufferSize, Lib3MF_uint32* pDisplayNameNeededChars, char * pDisplayNameBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitNode;
+	IBase* pIBaseClass = (IBase *)pImplicitPort;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "GetNodeType");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitPort, "ImplicitPort", "GetDisplayName");
 		}
-		if (pType == nullptr)
+		if ( (!pDisplayNameBuffer) && !(pDisplayNameNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
-		if (!pIImplicitNode)
+		std::string sDisplayName("");
+		IImplicitPort* pIImplicitPort = dynamic_cast<IImplicitPort*>(pIBaseClass);
+		if (!pIImplicitPort)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pType = pIImplicitNode->GetNodeType();
+		bool isCacheCall = (pDisplayNameBuffer == nullptr);
+		if (isCacheCall) {
+			sDisplayName = pIImplicitPort->GetDisplayName();
 
+			pIImplicitPort->_setCache (new ParameterCache_1<std::string> (sDisplayName));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIImplicitPort->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sDisplayName);
+			pIImplicitPort->_setCache (nullptr);
+		}
+		
+		if (pDisplayNameNeededChars)
+			*pDisplayNameNeededChars = (Lib3MF_uint32) (sDisplayName.size()+1);
+		if (pDisplayNameBuffer) {
+			if (sDisplayName.size() >= nDisplayNameBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iDisplayName = 0; iDisplayName < sDisplayName.size(); iDisplayName++)
+				pDisplayNameBuffer[iDisplayName] = sDisplayName[iDisplayName];
+			pDisplayNameBuffer[sDisplayName.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addEnumResult("Type", "ImplicitNodeType", (Lib3MF_int32)(*pType));
+			pJournalEntry->addStringResult("DisplayName", sDisplayName.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -11488,35 +11624,26 @@ Lib3MFResult lib3mf_implicitnode_getnodetype(Lib3MF_ImplicitNode pImplicitNode,
 	}
 }
 
-Lib3MFResult lib3mf_implicitnode_addinput(Lib3MF_ImplicitNode pImplicitNode, const char * pIdentifier, const char * pDisplayName, Lib3MF_ImplicitPort * pPort)
+Lib3MFResult lib3mf_implicitport_setdisplayname(Lib3MF_ImplicitPort pImplicitPort, const char * pDisplayName)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitNode;
+	IBase* pIBaseClass = (IBase *)pImplicitPort;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "AddInput");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitPort, "ImplicitPort", "SetDisplayName");
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 		}
-		if (pIdentifier == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		if (pDisplayName == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pPort == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
 		std::string sDisplayName(pDisplayName);
-		IBase* pBasePort(nullptr);
-		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
-		if (!pIImplicitNode)
+		IImplicitPort* pIImplicitPort = dynamic_cast<IImplicitPort*>(pIBaseClass);
+		if (!pIImplicitPort)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBasePort = pIImplicitNode->AddInput(sIdentifier, sDisplayName);
+		pIImplicitPort->SetDisplayName(sDisplayName);
 
-		*pPort = (IBase*)(pBasePort);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Port", *pPort);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -11532,27 +11659,23 @@ Lib3MFResult lib3mf_implicitnode_addinput(Lib3MF_ImplicitNode pImplicitNode, con
 	}
 }
 
-Lib3MFResult lib3mf_implicitnode_getinputs(Lib3MF_ImplicitNode pImplicitNode, Lib3MF_ImplicitPortIterator * pIterator)
+Lib3MFResult lib3mf_implicitport_settype(Lib3MF_ImplicitPort pImplicitPort, eLib3MFImplicitPortType eImplicitPortType)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitNode;
+	IBase* pIBaseClass = (IBase *)pImplicitPort;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "GetInputs");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitPort, "ImplicitPort", "SetType");
+			pJournalEntry->addEnumParameter("ImplicitPortType", "ImplicitPortType", (Lib3MF_int32)(eImplicitPortType));
 		}
-		if (pIterator == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseIterator(nullptr);
-		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
-		if (!pIImplicitNode)
+		IImplicitPort* pIImplicitPort = dynamic_cast<IImplicitPort*>(pIBaseClass);
+		if (!pIImplicitPort)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseIterator = pIImplicitNode->GetInputs();
+		pIImplicitPort->SetType(eImplicitPortType);
 
-		*pIterator = (IBase*)(pBaseIterator);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Iterator", *pIterator);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -11568,35 +11691,25 @@ Lib3MFResult lib3mf_implicitnode_getinputs(Lib3MF_ImplicitNode pImplicitNode, Li
 	}
 }
 
-Lib3MFResult lib3mf_implicitnode_addoutput(Lib3MF_ImplicitNode pImplicitNode, const char * pIdentifier, const char * pDisplayName, Lib3MF_ImplicitPort * pPort)
+Lib3MFResult lib3mf_implicitport_gettype(Lib3MF_ImplicitPort pImplicitPort, eLib3MFImplicitPortType * pImplicitPortType)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitNode;
+	IBase* pIBaseClass = (IBase *)pImplicitPort;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "AddOutput");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitPort, "ImplicitPort", "GetType");
 		}
-		if (pIdentifier == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pDisplayName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pPort == nullptr)
+		if (pImplicitPortType == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		std::string sDisplayName(pDisplayName);
-		IBase* pBasePort(nullptr);
-		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
-		if (!pIImplicitNode)
+		IImplicitPort* pIImplicitPort = dynamic_cast<IImplicitPort*>(pIBaseClass);
+		if (!pIImplicitPort)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBasePort = pIImplicitNode->AddOutput(sIdentifier, sDisplayName);
+		*pImplicitPortType = pIImplicitPort->GetType();
 
-		*pPort = (IBase*)(pBasePort);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Port", *pPort);
+			pJournalEntry->addEnumResult("ImplicitPortType", "ImplicitPortType", (Lib3MF_int32)(*pImplicitPortType));
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -11612,67 +11725,47 @@ Lib3MFResult lib3mf_implicitnode_addoutput(Lib3MF_ImplicitNode pImplicitNode, co
 	}
 }
 
-Lib3MFResult lib3mf_implicitnode_getoutputs(Lib3MF_ImplicitNode pImplicitNode, Lib3MF_ImplicitPortIterator * pIterator)
+Lib3MFResult lib3mf_implicitport_getreference(Lib3MF_ImplicitPort pImplicitPort, const Lib3MF_uint32 nReferenceBufferSize, Lib3MF_uint32* pReferenceNeededChars, char * pReferenceBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitNode;
+	IBase* pIBaseClass = (IBase *)pImplicitPort;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "GetOutputs");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitPort, "ImplicitPort", "GetReference");
 		}
-		if (pIterator == nullptr)
+		if ( (!pReferenceBuffer) && !(pReferenceNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseIterator(nullptr);
-		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
-		if (!pIImplicitNode)
+		std::string sReference("");
+		IImplicitPort* pIImplicitPort = dynamic_cast<IImplicitPort*>(pIBaseClass);
+		if (!pIImplicitPort)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseIterator = pIImplicitNode->GetOutputs();
+		bool isCacheCall = (pReferenceBuffer == nullptr);
+		if (isCacheCall) {
+			sReference = pIImplicitPort->GetReference();
 
-		*pIterator = (IBase*)(pBaseIterator);
-		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Iterator", *pIterator);
-			pJournalEntry->writeSuccess();
+			pIImplicitPort->_setCache (new ParameterCache_1<std::string> (sReference));
 		}
-		return LIB3MF_SUCCESS;
-	}
-	catch (ELib3MFInterfaceException & Exception) {
-		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
-	}
-	catch (std::exception & StdException) {
-		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
-	}
-	catch (...) {
-		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
-	}
-}
-
-Lib3MFResult lib3mf_implicitnode_findinput(Lib3MF_ImplicitNode pImplicitNode, const char * pIdentifier, Lib3MF_ImplicitPort * pInput)
-{
-	IBase* pIBaseClass = (IBase *)pImplicitNode;
-
-	PLib3MFInterfaceJournalEntry pJournalEntry;
-	try {
-		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "FindInput");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIImplicitPort->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sReference);
+			pIImplicitPort->_setCache (nullptr);
 		}
-		if (pIdentifier == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pInput == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		IBase* pBaseInput(nullptr);
-		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
-		if (!pIImplicitNode)
-			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseInput = pIImplicitNode->FindInput(sIdentifier);
-
-		*pInput = (IBase*)(pBaseInput);
+		if (pReferenceNeededChars)
+			*pReferenceNeededChars = (Lib3MF_uint32) (sReference.size()+1);
+		if (pReferenceBuffer) {
+			if (sReference.size() >= nReferenceBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iReference = 0; iReference < sReference.size(); iReference++)
+				pReferenceBuffer[iReference] = sReference[iReference];
+			pReferenceBuffer[sReference.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Input", *pInput);
+			pJournalEntry->addStringResult("Reference", sReference.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -11688,31 +11781,26 @@ Lib3MFResult lib3mf_implicitnode_findinput(Lib3MF_ImplicitNode pImplicitNode, co
 	}
 }
 
-Lib3MFResult lib3mf_implicitnode_findoutput(Lib3MF_ImplicitNode pImplicitNode, const char * pIdentifier, Lib3MF_ImplicitPort * pOutput)
+Lib3MFResult lib3mf_implicitport_setreference(Lib3MF_ImplicitPort pImplicitPort, const char * pReference)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitNode;
+	IBase* pIBaseClass = (IBase *)pImplicitPort;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "FindOutput");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitPort, "ImplicitPort", "SetReference");
+			pJournalEntry->addStringParameter("Reference", pReference);
 		}
-		if (pIdentifier == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pOutput == nullptr)
+		if (pReference == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		IBase* pBaseOutput(nullptr);
-		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
-		if (!pIImplicitNode)
+		std::string sReference(pReference);
+		IImplicitPort* pIImplicitPort = dynamic_cast<IImplicitPort*>(pIBaseClass);
+		if (!pIImplicitPort)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseOutput = pIImplicitNode->FindOutput(sIdentifier);
+		pIImplicitPort->SetReference(sReference);
 
-		*pOutput = (IBase*)(pBaseOutput);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Output", *pOutput);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -11728,25 +11816,29 @@ Lib3MFResult lib3mf_implicitnode_findoutput(Lib3MF_ImplicitNode pImplicitNode, c
 	}
 }
 
-Lib3MFResult lib3mf_implicitnode_aretypesvalid(Lib3MF_ImplicitNode pImplicitNode, bool * pValid)
+
+/*************************************************************************************************************************
+ Class implementation for Iterator
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_iterator_movenext(Lib3MF_Iterator pIterator, bool * pHasNext)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitNode;
+	IBase* pIBaseClass = (IBase *)pIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "AreTypesValid");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pIterator, "Iterator", "MoveNext");
 		}
-		if (pValid == nullptr)
+		if (pHasNext == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
-		if (!pIImplicitNode)
+		IIterator* pIIterator = dynamic_cast<IIterator*>(pIBaseClass);
+		if (!pIIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pValid = pIImplicitNode->AreTypesValid();
+		*pHasNext = pIIterator->MoveNext();
 
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addBooleanResult("Valid", *pValid);
+			pJournalEntry->addBooleanResult("HasNext", *pHasNext);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -11762,31 +11854,25 @@ Lib3MFResult lib3mf_implicitnode_aretypesvalid(Lib3MF_ImplicitNode pImplicitNode
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for OneInputNode
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_oneinputnode_getinputa(Lib3MF_OneInputNode pOneInputNode, Lib3MF_ImplicitPort * pInput)
+Lib3MFResult lib3mf_iterator_moveprevious(Lib3MF_Iterator pIterator, bool * pHasPrevious)
 {
-	IBase* pIBaseClass = (IBase *)pOneInputNode;
+	IBase* pIBaseClass = (IBase *)pIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pOneInputNode, "OneInputNode", "GetInputA");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pIterator, "Iterator", "MovePrevious");
 		}
-		if (pInput == nullptr)
+		if (pHasPrevious == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseInput(nullptr);
-		IOneInputNode* pIOneInputNode = dynamic_cast<IOneInputNode*>(pIBaseClass);
-		if (!pIOneInputNode)
+		IIterator* pIIterator = dynamic_cast<IIterator*>(pIBaseClass);
+		if (!pIIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseInput = pIOneInputNode->GetInputA();
+		*pHasPrevious = pIIterator->MovePrevious();
 
-		*pInput = (IBase*)(pBaseInput);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Input", *pInput);
+			pJournalEntry->addBooleanResult("HasPrevious", *pHasPrevious);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -11802,27 +11888,25 @@ Lib3MFResult lib3mf_oneinputnode_getinputa(Lib3MF_OneInputNode pOneInputNode, Li
 	}
 }
 
-Lib3MFResult lib3mf_oneinputnode_getoutputresult(Lib3MF_OneInputNode pOneInputNode, Lib3MF_ImplicitPort * pResult)
+Lib3MFResult lib3mf_iterator_count(Lib3MF_Iterator pIterator, Lib3MF_uint64 * pCount)
 {
-	IBase* pIBaseClass = (IBase *)pOneInputNode;
+	IBase* pIBaseClass = (IBase *)pIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pOneInputNode, "OneInputNode", "GetOutputResult");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pIterator, "Iterator", "Count");
 		}
-		if (pResult == nullptr)
+		if (pCount == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseResult(nullptr);
-		IOneInputNode* pIOneInputNode = dynamic_cast<IOneInputNode*>(pIBaseClass);
-		if (!pIOneInputNode)
+		IIterator* pIIterator = dynamic_cast<IIterator*>(pIBaseClass);
+		if (!pIIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResult = pIOneInputNode->GetOutputResult();
+		*pCount = pIIterator->Count();
 
-		*pResult = (IBase*)(pBaseResult);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Result", *pResult);
+			pJournalEntry->addUInt64Result("Count", *pCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -11840,122 +11924,29 @@ Lib3MFResult lib3mf_oneinputnode_getoutputresult(Lib3MF_OneInputNode pOneInputNo
 
 
 /*************************************************************************************************************************
- Class implementation for SinNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for CosNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for TanNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for ArcSinNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for ArcCosNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for ArcTanNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for SinhNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for CoshNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for TanhNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for RoundNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for CeilNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for FloorNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for SignNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for FractNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for AbsNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for ExpNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for LogNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for Log2Node
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for Log10Node
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for LengthNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for TransposeNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for InverseNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for SqrtNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for ResourceIdNode
+ Class implementation for ImplicitPortIterator
 **************************************************************************************************************************/
-Lib3MFResult lib3mf_resourceidnode_setresource(Lib3MF_ResourceIdNode pResourceIdNode, Lib3MF_Resource pResource)
+Lib3MFResult lib3mf_implicitportiterator_getcurrent(Lib3MF_ImplicitPortIterator pImplicitPortIterator, Lib3MF_ImplicitPort * pPort)
 {
-	IBase* pIBaseClass = (IBase *)pResourceIdNode;
+	IBase* pIBaseClass = (IBase *)pImplicitPortIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pResourceIdNode, "ResourceIdNode", "SetResource");
-			pJournalEntry->addHandleParameter("Resource", pResource);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitPortIterator, "ImplicitPortIterator", "GetCurrent");
 		}
-		IBase* pIBaseClassResource = (IBase *)pResource;
-		IResource* pIResource = dynamic_cast<IResource*>(pIBaseClassResource);
-		if (!pIResource)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
-		IResourceIdNode* pIResourceIdNode = dynamic_cast<IResourceIdNode*>(pIBaseClass);
-		if (!pIResourceIdNode)
+		if (pPort == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBasePort(nullptr);
+		IImplicitPortIterator* pIImplicitPortIterator = dynamic_cast<IImplicitPortIterator*>(pIBaseClass);
+		if (!pIImplicitPortIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIResourceIdNode->SetResource(pIResource);
+		pBasePort = pIImplicitPortIterator->GetCurrent();
 
+		*pPort = (IBase*)(pBasePort);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Port", *pPort);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -11971,9 +11962,803 @@ Lib3MFResult lib3mf_resourceidnode_setresource(Lib3MF_ResourceIdNode pResourceId
 	}
 }
 
-Lib3MFResult lib3mf_resourceidnode_getresource(Lib3MF_ResourceIdNode pResourceIdNode, Lib3MF_Resource * pResource)
+
+/*************************************************************************************************************************
+ Class implementation for ImplicitNode
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_implicitnode_getidentifier(Lib3MF_ImplicitNode pImplicitNode, const Lib3MF_uint32 nIdentifierBufferSize, Lib3MF_uint32* pIdentifierNeededChars, char * pIdentifierBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pResourceIdNode;
+	IBase* pIBaseClass = (IBase *)pImplicitNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "GetIdentifier");
+		}
+		if ( (!pIdentifierBuffer) && !(pIdentifierNeededChars) )
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sIdentifier("");
+		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
+		if (!pIImplicitNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pIdentifierBuffer == nullptr);
+		if (isCacheCall) {
+			sIdentifier = pIImplicitNode->GetIdentifier();
+
+			pIImplicitNode->_setCache (new ParameterCache_1<std::string> (sIdentifier));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIImplicitNode->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sIdentifier);
+			pIImplicitNode->_setCache (nullptr);
+		}
+		
+		if (pIdentifierNeededChars)
+			*pIdentifierNeededChars = (Lib3MF_uint32) (sIdentifier.size()+1);
+		if (pIdentifierBuffer) {
+			if (sIdentifier.size() >= nIdentifierBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iIdentifier = 0; iIdentifier < sIdentifier.size(); iIdentifier++)
+				pIdentifierBuffer[iIdentifier] = sIdentifier[iIdentifier];
+			pIdentifierBuffer[sIdentifier.size()] = 0;
+		}
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addStringResult("Identifier", sIdentifier.c_str());
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_implicitnode_setidentifier(Lib3MF_ImplicitNode pImplicitNode, const char * pIdentifier)
+{
+	IBase* pIBaseClass = (IBase *)pImplicitNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "SetIdentifier");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+		}
+		if (pIdentifier == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
+		if (!pIImplicitNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIImplicitNode->SetIdentifier(sIdentifier);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_implicitnode_getdisplayname(Lib3MF_ImplicitNode pImplicitNode, const Lib3MF_uint32 nDisplayNameBufferSize, Lib3MF_uint32* pDisplayNameNeededChars, char * pDisplayNameBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pImplicitNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "GetDisplayName");
+		}
+		if ( (!pDisplayNameBuffer) && !(pDisplayNameNeededChars) )
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sDisplayName("");
+		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
+		if (!pIImplicitNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pDisplayNameBuffer == nullptr);
+		if (isCacheCall) {
+			sDisplayName = pIImplicitNode->GetDisplayName();
+
+			pIImplicitNode->_setCache (new ParameterCache_1<std::string> (sDisplayName));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIImplicitNode->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sDisplayName);
+			pIImplicitNode->_setCache (nullptr);
+		}
+		
+		if (pDisplayNameNeededChars)
+			*pDisplayNameNeededChars = (Lib3MF_uint32) (sDisplayName.size()+1);
+		if (pDisplayNameBuffer) {
+			if (sDisplayName.size() >= nDisplayNameBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iDisplayName = 0; iDisplayName < sDisplayName.size(); iDisplayName++)
+				pDisplayNameBuffer[iDisplayName] = sDisplayName[iDisplayName];
+			pDisplayNameBuffer[sDisplayName.size()] = 0;
+		}
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addStringResult("DisplayName", sDisplayName.c_str());
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_implicitnode_setdisplayname(Lib3MF_ImplicitNode pImplicitNode, const char * pDisplayName)
+{
+	IBase* pIBaseClass = (IBase *)pImplicitNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "SetDisplayName");
+			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
+		}
+		if (pDisplayName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sDisplayName(pDisplayName);
+		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
+		if (!pIImplicitNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIImplicitNode->SetDisplayName(sDisplayName);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_implicitnode_gettag(Lib3MF_ImplicitNode pImplicitNode, const Lib3MF_uint32 nTagBufferSize, Lib3MF_uint32* pTagNeededChars, char * pTagBuffer)
+{
+	IBase* pIBaseClass = (IBase *)pImplicitNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "GetTag");
+		}
+		if ( (!pTagBuffer) && !(pTagNeededChars) )
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sTag("");
+		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
+		if (!pIImplicitNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		bool isCacheCall = (pTagBuffer == nullptr);
+		if (isCacheCall) {
+			sTag = pIImplicitNode->GetTag();
+
+			pIImplicitNode->_setCache (new ParameterCache_1<std::string> (sTag));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIImplicitNode->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sTag);
+			pIImplicitNode->_setCache (nullptr);
+		}
+		
+		if (pTagNeededChars)
+			*pTagNeededChars = (Lib3MF_uint32) (sTag.size()+1);
+		if (pTagBuffer) {
+			if (sTag.size() >= nTagBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iTag = 0; iTag < sTag.size(); iTag++)
+				pTagBuffer[iTag] = sTag[iTag];
+			pTagBuffer[sTag.size()] = 0;
+		}
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addStringResult("Tag", sTag.c_str());
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_implicitnode_settag(Lib3MF_ImplicitNode pImplicitNode, const char * pTag)
+{
+	IBase* pIBaseClass = (IBase *)pImplicitNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "SetTag");
+			pJournalEntry->addStringParameter("Tag", pTag);
+		}
+		if (pTag == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sTag(pTag);
+		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
+		if (!pIImplicitNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIImplicitNode->SetTag(sTag);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_implicitnode_getnodetype(Lib3MF_ImplicitNode pImplicitNode, eLib3MFImplicitNodeType * pType)
+{
+	IBase* pIBaseClass = (IBase *)pImplicitNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "GetNodeType");
+		}
+		if (pType == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
+		if (!pIImplicitNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pType = pIImplicitNode->GetNodeType();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addEnumResult("Type", "ImplicitNodeType", (Lib3MF_int32)(*pType));
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_implicitnode_addinput(Lib3MF_ImplicitNode pImplicitNode, const char * pIdentifier, const char * pDisplayName, Lib3MF_ImplicitPort * pPort)
+{
+	IBase* pIBaseClass = (IBase *)pImplicitNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "AddInput");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
+		}
+		if (pIdentifier == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pDisplayName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pPort == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		std::string sDisplayName(pDisplayName);
+		IBase* pBasePort(nullptr);
+		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
+		if (!pIImplicitNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBasePort = pIImplicitNode->AddInput(sIdentifier, sDisplayName);
+
+		*pPort = (IBase*)(pBasePort);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Port", *pPort);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_implicitnode_getinputs(Lib3MF_ImplicitNode pImplicitNode, Lib3MF_ImplicitPortIterator * pIterator)
+{
+	IBase* pIBaseClass = (IBase *)pImplicitNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "GetInputs");
+		}
+		if (pIterator == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseIterator(nullptr);
+		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
+		if (!pIImplicitNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseIterator = pIImplicitNode->GetInputs();
+
+		*pIterator = (IBase*)(pBaseIterator);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Iterator", *pIterator);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_implicitnode_addoutput(Lib3MF_ImplicitNode pImplicitNode, const char * pIdentifier, const char * pDisplayName, Lib3MF_ImplicitPort * pPort)
+{
+	IBase* pIBaseClass = (IBase *)pImplicitNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "AddOutput");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
+		}
+		if (pIdentifier == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pDisplayName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pPort == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		std::string sDisplayName(pDisplayName);
+		IBase* pBasePort(nullptr);
+		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
+		if (!pIImplicitNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBasePort = pIImplicitNode->AddOutput(sIdentifier, sDisplayName);
+
+		*pPort = (IBase*)(pBasePort);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Port", *pPort);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_implicitnode_getoutputs(Lib3MF_ImplicitNode pImplicitNode, Lib3MF_ImplicitPortIterator * pIterator)
+{
+	IBase* pIBaseClass = (IBase *)pImplicitNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "GetOutputs");
+		}
+		if (pIterator == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseIterator(nullptr);
+		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
+		if (!pIImplicitNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseIterator = pIImplicitNode->GetOutputs();
+
+		*pIterator = (IBase*)(pBaseIterator);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Iterator", *pIterator);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_implicitnode_findinput(Lib3MF_ImplicitNode pImplicitNode, const char * pIdentifier, Lib3MF_ImplicitPort * pInput)
+{
+	IBase* pIBaseClass = (IBase *)pImplicitNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "FindInput");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+		}
+		if (pIdentifier == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pInput == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		IBase* pBaseInput(nullptr);
+		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
+		if (!pIImplicitNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseInput = pIImplicitNode->FindInput(sIdentifier);
+
+		*pInput = (IBase*)(pBaseInput);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Input", *pInput);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_implicitnode_findoutput(Lib3MF_ImplicitNode pImplicitNode, const char * pIdentifier, Lib3MF_ImplicitPort * pOutput)
+{
+	IBase* pIBaseClass = (IBase *)pImplicitNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "FindOutput");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+		}
+		if (pIdentifier == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pOutput == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		IBase* pBaseOutput(nullptr);
+		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
+		if (!pIImplicitNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseOutput = pIImplicitNode->FindOutput(sIdentifier);
+
+		*pOutput = (IBase*)(pBaseOutput);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Output", *pOutput);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_implicitnode_aretypesvalid(Lib3MF_ImplicitNode pImplicitNode, bool * pValid)
+{
+	IBase* pIBaseClass = (IBase *)pImplicitNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitNode, "ImplicitNode", "AreTypesValid");
+		}
+		if (pValid == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IImplicitNode* pIImplicitNode = dynamic_cast<IImplicitNode*>(pIBaseClass);
+		if (!pIImplicitNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pValid = pIImplicitNode->AreTypesValid();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addBooleanResult("Valid", *pValid);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+
+/*************************************************************************************************************************
+ Class implementation for OneInputNode
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_oneinputnode_getinputa(Lib3MF_OneInputNode pOneInputNode, Lib3MF_ImplicitPort * pInput)
+{
+	IBase* pIBaseClass = (IBase *)pOneInputNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pOneInputNode, "OneInputNode", "GetInputA");
+		}
+		if (pInput == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseInput(nullptr);
+		IOneInputNode* pIOneInputNode = dynamic_cast<IOneInputNode*>(pIBaseClass);
+		if (!pIOneInputNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseInput = pIOneInputNode->GetInputA();
+
+		*pInput = (IBase*)(pBaseInput);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Input", *pInput);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_oneinputnode_getoutputresult(Lib3MF_OneInputNode pOneInputNode, Lib3MF_ImplicitPort * pResult)
+{
+	IBase* pIBaseClass = (IBase *)pOneInputNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pOneInputNode, "OneInputNode", "GetOutputResult");
+		}
+		if (pResult == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseResult(nullptr);
+		IOneInputNode* pIOneInputNode = dynamic_cast<IOneInputNode*>(pIBaseClass);
+		if (!pIOneInputNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseResult = pIOneInputNode->GetOutputResult();
+
+		*pResult = (IBase*)(pBaseResult);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Result", *pResult);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+
+/*************************************************************************************************************************
+ Class implementation for SinNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for CosNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for TanNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for ArcSinNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for ArcCosNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for ArcTanNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for SinhNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for CoshNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for TanhNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for RoundNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for CeilNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for FloorNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for SignNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for FractNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for AbsNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for ExpNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for LogNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for Log2Node
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for Log10Node
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for LengthNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for TransposeNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for InverseNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for SqrtNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for ResourceIdNode
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_resourceidnode_setresource(Lib3MF_ResourceIdNode pResourceIdNode, Lib3MF_Resource pResource)
+{
+	IBase* pIBaseClass = (IBase *)pResourceIdNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pResourceIdNode, "ResourceIdNode", "SetResource");
+			pJournalEntry->addHandleParameter("Resource", pResource);
+		}
+		IBase* pIBaseClassResource = (IBase *)pResource;
+		IResource* pIResource = dynamic_cast<IResource*>(pIBaseClassResource);
+		if (!pIResource)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
+		IResourceIdNode* pIResourceIdNode = dynamic_cast<IResourceIdNode*>(pIBaseClass);
+		if (!pIResourceIdNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIResourceIdNode->SetResource(pIResource);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_resourceidnode_getresource(Lib3MF_ResourceIdNode pResourceIdNode, Lib3MF_Resource * pResource)
+{
+	IBase* pIBaseClass = (IBase *)pResourceIdNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
@@ -11987,11 +12772,215 @@ Lib3MFResult lib3mf_resourceidnode_getresource(Lib3MF_ResourceIdNode pResourceId
 		if (!pIResourceIdNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResource = pIResourceIdNode->GetResource();
+		pBaseResource = pIResourceIdNode->GetResource();
+
+		*pResource = (IBase*)(pBaseResource);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Resource", *pResource);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_resourceidnode_getoutputvalue(Lib3MF_ResourceIdNode pResourceIdNode, Lib3MF_ImplicitPort * pValue)
+{
+	IBase* pIBaseClass = (IBase *)pResourceIdNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pResourceIdNode, "ResourceIdNode", "GetOutputValue");
+		}
+		if (pValue == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseValue(nullptr);
+		IResourceIdNode* pIResourceIdNode = dynamic_cast<IResourceIdNode*>(pIBaseClass);
+		if (!pIResourceIdNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseValue = pIResourceIdNode->GetOutputValue();
+
+		*pValue = (IBase*)(pBaseValue);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Value", *pValue);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+
+/*************************************************************************************************************************
+ Class implementation for TwoInputNode
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_twoinputnode_getinputb(Lib3MF_TwoInputNode pTwoInputNode, Lib3MF_ImplicitPort * pB)
+{
+	IBase* pIBaseClass = (IBase *)pTwoInputNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pTwoInputNode, "TwoInputNode", "GetInputB");
+		}
+		if (pB == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseB(nullptr);
+		ITwoInputNode* pITwoInputNode = dynamic_cast<ITwoInputNode*>(pIBaseClass);
+		if (!pITwoInputNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseB = pITwoInputNode->GetInputB();
+
+		*pB = (IBase*)(pBaseB);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("B", *pB);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+
+/*************************************************************************************************************************
+ Class implementation for AdditionNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for SubtractionNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for MultiplicationNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for DivisionNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for DotNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for CrossNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for ArcTan2Node
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for MatVecMultiplicationNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for MinNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for MaxNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for FmodNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for ModNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for PowNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for SelectNode
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_selectnode_getinputb(Lib3MF_SelectNode pSelectNode, Lib3MF_ImplicitPort * pB)
+{
+	IBase* pIBaseClass = (IBase *)pSelectNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pSelectNode, "SelectNode", "GetInputB");
+		}
+		if (pB == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseB(nullptr);
+		ISelectNode* pISelectNode = dynamic_cast<ISelectNode*>(pIBaseClass);
+		if (!pISelectNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseB = pISelectNode->GetInputB();
+
+		*pB = (IBase*)(pBaseB);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("B", *pB);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_selectnode_getinputc(Lib3MF_SelectNode pSelectNode, Lib3MF_ImplicitPort * pC)
+{
+	IBase* pIBaseClass = (IBase *)pSelectNode;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pSelectNode, "SelectNode", "GetInputC");
+		}
+		if (pC == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseC(nullptr);
+		ISelectNode* pISelectNode = dynamic_cast<ISelectNode*>(pIBaseClass);
+		if (!pISelectNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseC = pISelectNode->GetInputC();
 
-		*pResource = (IBase*)(pBaseResource);
+		*pC = (IBase*)(pBaseC);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Resource", *pResource);
+			pJournalEntry->addHandleResult("C", *pC);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12007,27 +12996,27 @@ Lib3MFResult lib3mf_resourceidnode_getresource(Lib3MF_ResourceIdNode pResourceId
 	}
 }
 
-Lib3MFResult lib3mf_resourceidnode_getoutputvalue(Lib3MF_ResourceIdNode pResourceIdNode, Lib3MF_ImplicitPort * pValue)
+Lib3MFResult lib3mf_selectnode_getinputd(Lib3MF_SelectNode pSelectNode, Lib3MF_ImplicitPort * pD)
 {
-	IBase* pIBaseClass = (IBase *)pResourceIdNode;
+	IBase* pIBaseClass = (IBase *)pSelectNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pResourceIdNode, "ResourceIdNode", "GetOutputValue");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pSelectNode, "SelectNode", "GetInputD");
 		}
-		if (pValue == nullptr)
+		if (pD == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseValue(nullptr);
-		IResourceIdNode* pIResourceIdNode = dynamic_cast<IResourceIdNode*>(pIBaseClass);
-		if (!pIResourceIdNode)
+		IBase* pBaseD(nullptr);
+		ISelectNode* pISelectNode = dynamic_cast<ISelectNode*>(pIBaseClass);
+		if (!pISelectNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseValue = pIResourceIdNode->GetOutputValue();
+		pBaseD = pISelectNode->GetInputD();
 
-		*pValue = (IBase*)(pBaseValue);
+		*pD = (IBase*)(pBaseD);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Value", *pValue);
+			pJournalEntry->addHandleResult("D", *pD);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12045,29 +13034,29 @@ Lib3MFResult lib3mf_resourceidnode_getoutputvalue(Lib3MF_ResourceIdNode pResourc
 
 
 /*************************************************************************************************************************
- Class implementation for TwoInputNode
+ Class implementation for ClampNode
 **************************************************************************************************************************/
-Lib3MFResult lib3mf_twoinputnode_getinputb(Lib3MF_TwoInputNode pTwoInputNode, Lib3MF_ImplicitPort * pB)
+Lib3MFResult lib3mf_clampnode_getinputmin(Lib3MF_ClampNode pClampNode, Lib3MF_ImplicitPort * pMin)
 {
-	IBase* pIBaseClass = (IBase *)pTwoInputNode;
+	IBase* pIBaseClass = (IBase *)pClampNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pTwoInputNode, "TwoInputNode", "GetInputB");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pClampNode, "ClampNode", "GetInputMin");
 		}
-		if (pB == nullptr)
+		if (pMin == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseB(nullptr);
-		ITwoInputNode* pITwoInputNode = dynamic_cast<ITwoInputNode*>(pIBaseClass);
-		if (!pITwoInputNode)
+		IBase* pBaseMin(nullptr);
+		IClampNode* pIClampNode = dynamic_cast<IClampNode*>(pIBaseClass);
+		if (!pIClampNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseB = pITwoInputNode->GetInputB();
+		pBaseMin = pIClampNode->GetInputMin();
 
-		*pB = (IBase*)(pBaseB);
+		*pMin = (IBase*)(pBaseMin);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("B", *pB);
+			pJournalEntry->addHandleResult("Min", *pMin);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12083,83 +13072,175 @@ Lib3MFResult lib3mf_twoinputnode_getinputb(Lib3MF_TwoInputNode pTwoInputNode, Li
 	}
 }
 
+Lib3MFResult lib3mf_clampnode_getinputmax(Lib3MF_ClampNode pClampNode, Lib3MF_ImplicitPort * pMax)
+{
+	IBase* pIBaseClass = (IBase *)pClampNode;
 
-/*************************************************************************************************************************
- Class implementation for AdditionNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for SubtractionNode
-**************************************************************************************************************************/
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pClampNode, "ClampNode", "GetInputMax");
+		}
+		if (pMax == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseMax(nullptr);
+		IClampNode* pIClampNode = dynamic_cast<IClampNode*>(pIBaseClass);
+		if (!pIClampNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseMax = pIClampNode->GetInputMax();
 
-/*************************************************************************************************************************
- Class implementation for MultiplicationNode
-**************************************************************************************************************************/
+		*pMax = (IBase*)(pBaseMax);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Max", *pMax);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
 
-/*************************************************************************************************************************
- Class implementation for DivisionNode
-**************************************************************************************************************************/
 
 /*************************************************************************************************************************
- Class implementation for DotNode
+ Class implementation for ComposeVectorNode
 **************************************************************************************************************************/
+Lib3MFResult lib3mf_composevectornode_getinputx(Lib3MF_ComposeVectorNode pComposeVectorNode, Lib3MF_ImplicitPort * pX)
+{
+	IBase* pIBaseClass = (IBase *)pComposeVectorNode;
 
-/*************************************************************************************************************************
- Class implementation for CrossNode
-**************************************************************************************************************************/
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeVectorNode, "ComposeVectorNode", "GetInputX");
+		}
+		if (pX == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseX(nullptr);
+		IComposeVectorNode* pIComposeVectorNode = dynamic_cast<IComposeVectorNode*>(pIBaseClass);
+		if (!pIComposeVectorNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseX = pIComposeVectorNode->GetInputX();
 
-/*************************************************************************************************************************
- Class implementation for ArcTan2Node
-**************************************************************************************************************************/
+		*pX = (IBase*)(pBaseX);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("X", *pX);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
 
-/*************************************************************************************************************************
- Class implementation for MatVecMultiplicationNode
-**************************************************************************************************************************/
+Lib3MFResult lib3mf_composevectornode_getinputy(Lib3MF_ComposeVectorNode pComposeVectorNode, Lib3MF_ImplicitPort * pY)
+{
+	IBase* pIBaseClass = (IBase *)pComposeVectorNode;
 
-/*************************************************************************************************************************
- Class implementation for MinNode
-**************************************************************************************************************************/
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeVectorNode, "ComposeVectorNode", "GetInputY");
+		}
+		if (pY == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseY(nullptr);
+		IComposeVectorNode* pIComposeVectorNode = dynamic_cast<IComposeVectorNode*>(pIBaseClass);
+		if (!pIComposeVectorNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseY = pIComposeVectorNode->GetInputY();
 
-/*************************************************************************************************************************
- Class implementation for MaxNode
-**************************************************************************************************************************/
+		*pY = (IBase*)(pBaseY);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Y", *pY);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
 
-/*************************************************************************************************************************
- Class implementation for FmodNode
-**************************************************************************************************************************/
+Lib3MFResult lib3mf_composevectornode_getinputz(Lib3MF_ComposeVectorNode pComposeVectorNode, Lib3MF_ImplicitPort * pZ)
+{
+	IBase* pIBaseClass = (IBase *)pComposeVectorNode;
 
-/*************************************************************************************************************************
- Class implementation for ModNode
-**************************************************************************************************************************/
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeVectorNode, "ComposeVectorNode", "GetInputZ");
+		}
+		if (pZ == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseZ(nullptr);
+		IComposeVectorNode* pIComposeVectorNode = dynamic_cast<IComposeVectorNode*>(pIBaseClass);
+		if (!pIComposeVectorNode)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseZ = pIComposeVectorNode->GetInputZ();
 
-/*************************************************************************************************************************
- Class implementation for PowNode
-**************************************************************************************************************************/
+		*pZ = (IBase*)(pBaseZ);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Z", *pZ);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
 
-/*************************************************************************************************************************
- Class implementation for SelectNode
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_selectnode_getinputb(Lib3MF_SelectNode pSelectNode, Lib3MF_ImplicitPort * pB)
+Lib3MFResult lib3mf_composevectornode_getoutputresult(Lib3MF_ComposeVectorNode pComposeVectorNode, Lib3MF_ImplicitPort * pResult)
 {
-	IBase* pIBaseClass = (IBase *)pSelectNode;
+	IBase* pIBaseClass = (IBase *)pComposeVectorNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pSelectNode, "SelectNode", "GetInputB");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeVectorNode, "ComposeVectorNode", "GetOutputResult");
 		}
-		if (pB == nullptr)
+		if (pResult == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseB(nullptr);
-		ISelectNode* pISelectNode = dynamic_cast<ISelectNode*>(pIBaseClass);
-		if (!pISelectNode)
+		IBase* pBaseResult(nullptr);
+		IComposeVectorNode* pIComposeVectorNode = dynamic_cast<IComposeVectorNode*>(pIBaseClass);
+		if (!pIComposeVectorNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseB = pISelectNode->GetInputB();
+		pBaseResult = pIComposeVectorNode->GetOutputResult();
 
-		*pB = (IBase*)(pBaseB);
+		*pResult = (IBase*)(pBaseResult);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("B", *pB);
+			pJournalEntry->addHandleResult("Result", *pResult);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12175,27 +13256,35 @@ Lib3MFResult lib3mf_selectnode_getinputb(Lib3MF_SelectNode pSelectNode, Lib3MF_I
 	}
 }
 
-Lib3MFResult lib3mf_selectnode_getinputc(Lib3MF_SelectNode pSelectNode, Lib3MF_ImplicitPort * pC)
+
+/*************************************************************************************************************************
+ Class implementation for VectorFromScalarNode
+**************************************************************************************************************************/
+
+/*************************************************************************************************************************
+ Class implementation for DecomposeVectorNode
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_decomposevectornode_getinputa(Lib3MF_DecomposeVectorNode pDecomposeVectorNode, Lib3MF_ImplicitPort * pA)
 {
-	IBase* pIBaseClass = (IBase *)pSelectNode;
+	IBase* pIBaseClass = (IBase *)pDecomposeVectorNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pSelectNode, "SelectNode", "GetInputC");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pDecomposeVectorNode, "DecomposeVectorNode", "GetInputA");
 		}
-		if (pC == nullptr)
+		if (pA == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseC(nullptr);
-		ISelectNode* pISelectNode = dynamic_cast<ISelectNode*>(pIBaseClass);
-		if (!pISelectNode)
+		IBase* pBaseA(nullptr);
+		IDecomposeVectorNode* pIDecomposeVectorNode = dynamic_cast<IDecomposeVectorNode*>(pIBaseClass);
+		if (!pIDecomposeVectorNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseC = pISelectNode->GetInputC();
+		pBaseA = pIDecomposeVectorNode->GetInputA();
 
-		*pC = (IBase*)(pBaseC);
+		*pA = (IBase*)(pBaseA);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("C", *pC);
+			pJournalEntry->addHandleResult("A", *pA);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12211,27 +13300,27 @@ Lib3MFResult lib3mf_selectnode_getinputc(Lib3MF_SelectNode pSelectNode, Lib3MF_I
 	}
 }
 
-Lib3MFResult lib3mf_selectnode_getinputd(Lib3MF_SelectNode pSelectNode, Lib3MF_ImplicitPort * pD)
+Lib3MFResult lib3mf_decomposevectornode_getoutputx(Lib3MF_DecomposeVectorNode pDecomposeVectorNode, Lib3MF_ImplicitPort * pX)
 {
-	IBase* pIBaseClass = (IBase *)pSelectNode;
+	IBase* pIBaseClass = (IBase *)pDecomposeVectorNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pSelectNode, "SelectNode", "GetInputD");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pDecomposeVectorNode, "DecomposeVectorNode", "GetOutputX");
 		}
-		if (pD == nullptr)
+		if (pX == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseD(nullptr);
-		ISelectNode* pISelectNode = dynamic_cast<ISelectNode*>(pIBaseClass);
-		if (!pISelectNode)
+		IBase* pBaseX(nullptr);
+		IDecomposeVectorNode* pIDecomposeVectorNode = dynamic_cast<IDecomposeVectorNode*>(pIBaseClass);
+		if (!pIDecomposeVectorNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseD = pISelectNode->GetInputD();
+		pBaseX = pIDecomposeVectorNode->GetOutputX();
 
-		*pD = (IBase*)(pBaseD);
+		*pX = (IBase*)(pBaseX);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("D", *pD);
+			pJournalEntry->addHandleResult("X", *pX);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12247,31 +13336,27 @@ Lib3MFResult lib3mf_selectnode_getinputd(Lib3MF_SelectNode pSelectNode, Lib3MF_I
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for ClampNode
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_clampnode_getinputmin(Lib3MF_ClampNode pClampNode, Lib3MF_ImplicitPort * pMin)
+Lib3MFResult lib3mf_decomposevectornode_getoutputy(Lib3MF_DecomposeVectorNode pDecomposeVectorNode, Lib3MF_ImplicitPort * pY)
 {
-	IBase* pIBaseClass = (IBase *)pClampNode;
+	IBase* pIBaseClass = (IBase *)pDecomposeVectorNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pClampNode, "ClampNode", "GetInputMin");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pDecomposeVectorNode, "DecomposeVectorNode", "GetOutputY");
 		}
-		if (pMin == nullptr)
+		if (pY == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseMin(nullptr);
-		IClampNode* pIClampNode = dynamic_cast<IClampNode*>(pIBaseClass);
-		if (!pIClampNode)
+		IBase* pBaseY(nullptr);
+		IDecomposeVectorNode* pIDecomposeVectorNode = dynamic_cast<IDecomposeVectorNode*>(pIBaseClass);
+		if (!pIDecomposeVectorNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseMin = pIClampNode->GetInputMin();
+		pBaseY = pIDecomposeVectorNode->GetOutputY();
 
-		*pMin = (IBase*)(pBaseMin);
+		*pY = (IBase*)(pBaseY);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Min", *pMin);
+			pJournalEntry->addHandleResult("Y", *pY);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12287,27 +13372,27 @@ Lib3MFResult lib3mf_clampnode_getinputmin(Lib3MF_ClampNode pClampNode, Lib3MF_Im
 	}
 }
 
-Lib3MFResult lib3mf_clampnode_getinputmax(Lib3MF_ClampNode pClampNode, Lib3MF_ImplicitPort * pMax)
+Lib3MFResult lib3mf_decomposevectornode_getoutputz(Lib3MF_DecomposeVectorNode pDecomposeVectorNode, Lib3MF_ImplicitPort * pZ)
 {
-	IBase* pIBaseClass = (IBase *)pClampNode;
+	IBase* pIBaseClass = (IBase *)pDecomposeVectorNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pClampNode, "ClampNode", "GetInputMax");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pDecomposeVectorNode, "DecomposeVectorNode", "GetOutputZ");
 		}
-		if (pMax == nullptr)
+		if (pZ == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseMax(nullptr);
-		IClampNode* pIClampNode = dynamic_cast<IClampNode*>(pIBaseClass);
-		if (!pIClampNode)
+		IBase* pBaseZ(nullptr);
+		IDecomposeVectorNode* pIDecomposeVectorNode = dynamic_cast<IDecomposeVectorNode*>(pIBaseClass);
+		if (!pIDecomposeVectorNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseMax = pIClampNode->GetInputMax();
+		pBaseZ = pIDecomposeVectorNode->GetOutputZ();
 
-		*pMax = (IBase*)(pBaseMax);
+		*pZ = (IBase*)(pBaseZ);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Max", *pMax);
+			pJournalEntry->addHandleResult("Z", *pZ);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12325,29 +13410,29 @@ Lib3MFResult lib3mf_clampnode_getinputmax(Lib3MF_ClampNode pClampNode, Lib3MF_Im
 
 
 /*************************************************************************************************************************
- Class implementation for ComposeVectorNode
+ Class implementation for ComposeMatrixNode
 **************************************************************************************************************************/
-Lib3MFResult lib3mf_composevectornode_getinputx(Lib3MF_ComposeVectorNode pComposeVectorNode, Lib3MF_ImplicitPort * pX)
+Lib3MFResult lib3mf_composematrixnode_getinputm00(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM00)
 {
-	IBase* pIBaseClass = (IBase *)pComposeVectorNode;
+	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeVectorNode, "ComposeVectorNode", "GetInputX");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM00");
 		}
-		if (pX == nullptr)
+		if (pM00 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseX(nullptr);
-		IComposeVectorNode* pIComposeVectorNode = dynamic_cast<IComposeVectorNode*>(pIBaseClass);
-		if (!pIComposeVectorNode)
+		IBase* pBaseM00(nullptr);
+		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
+		if (!pIComposeMatrixNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseX = pIComposeVectorNode->GetInputX();
+		pBaseM00 = pIComposeMatrixNode->GetInputM00();
 
-		*pX = (IBase*)(pBaseX);
+		*pM00 = (IBase*)(pBaseM00);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("X", *pX);
+			pJournalEntry->addHandleResult("M00", *pM00);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12363,27 +13448,27 @@ Lib3MFResult lib3mf_composevectornode_getinputx(Lib3MF_ComposeVectorNode pCompos
 	}
 }
 
-Lib3MFResult lib3mf_composevectornode_getinputy(Lib3MF_ComposeVectorNode pComposeVectorNode, Lib3MF_ImplicitPort * pY)
+Lib3MFResult lib3mf_composematrixnode_getinputm01(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM01)
 {
-	IBase* pIBaseClass = (IBase *)pComposeVectorNode;
+	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeVectorNode, "ComposeVectorNode", "GetInputY");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM01");
 		}
-		if (pY == nullptr)
+		if (pM01 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseY(nullptr);
-		IComposeVectorNode* pIComposeVectorNode = dynamic_cast<IComposeVectorNode*>(pIBaseClass);
-		if (!pIComposeVectorNode)
+		IBase* pBaseM01(nullptr);
+		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
+		if (!pIComposeMatrixNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseY = pIComposeVectorNode->GetInputY();
+		pBaseM01 = pIComposeMatrixNode->GetInputM01();
 
-		*pY = (IBase*)(pBaseY);
+		*pM01 = (IBase*)(pBaseM01);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Y", *pY);
+			pJournalEntry->addHandleResult("M01", *pM01);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12399,27 +13484,27 @@ Lib3MFResult lib3mf_composevectornode_getinputy(Lib3MF_ComposeVectorNode pCompos
 	}
 }
 
-Lib3MFResult lib3mf_composevectornode_getinputz(Lib3MF_ComposeVectorNode pComposeVectorNode, Lib3MF_ImplicitPort * pZ)
+Lib3MFResult lib3mf_composematrixnode_getinputm02(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM02)
 {
-	IBase* pIBaseClass = (IBase *)pComposeVectorNode;
+	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeVectorNode, "ComposeVectorNode", "GetInputZ");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM02");
 		}
-		if (pZ == nullptr)
+		if (pM02 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseZ(nullptr);
-		IComposeVectorNode* pIComposeVectorNode = dynamic_cast<IComposeVectorNode*>(pIBaseClass);
-		if (!pIComposeVectorNode)
+		IBase* pBaseM02(nullptr);
+		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
+		if (!pIComposeMatrixNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseZ = pIComposeVectorNode->GetInputZ();
+		pBaseM02 = pIComposeMatrixNode->GetInputM02();
 
-		*pZ = (IBase*)(pBaseZ);
+		*pM02 = (IBase*)(pBaseM02);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Z", *pZ);
+			pJournalEntry->addHandleResult("M02", *pM02);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12435,27 +13520,27 @@ Lib3MFResult lib3mf_composevectornode_getinputz(Lib3MF_ComposeVectorNode pCompos
 	}
 }
 
-Lib3MFResult lib3mf_composevectornode_getoutputresult(Lib3MF_ComposeVectorNode pComposeVectorNode, Lib3MF_ImplicitPort * pResult)
+Lib3MFResult lib3mf_composematrixnode_getinputm03(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM03)
 {
-	IBase* pIBaseClass = (IBase *)pComposeVectorNode;
+	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeVectorNode, "ComposeVectorNode", "GetOutputResult");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM03");
 		}
-		if (pResult == nullptr)
+		if (pM03 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseResult(nullptr);
-		IComposeVectorNode* pIComposeVectorNode = dynamic_cast<IComposeVectorNode*>(pIBaseClass);
-		if (!pIComposeVectorNode)
+		IBase* pBaseM03(nullptr);
+		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
+		if (!pIComposeMatrixNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResult = pIComposeVectorNode->GetOutputResult();
+		pBaseM03 = pIComposeMatrixNode->GetInputM03();
 
-		*pResult = (IBase*)(pBaseResult);
+		*pM03 = (IBase*)(pBaseM03);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Result", *pResult);
+			pJournalEntry->addHandleResult("M03", *pM03);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12471,35 +13556,27 @@ Lib3MFResult lib3mf_composevectornode_getoutputresult(Lib3MF_ComposeVectorNode p
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for VectorFromScalarNode
-**************************************************************************************************************************/
-
-/*************************************************************************************************************************
- Class implementation for DecomposeVectorNode
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_decomposevectornode_getinputa(Lib3MF_DecomposeVectorNode pDecomposeVectorNode, Lib3MF_ImplicitPort * pA)
+Lib3MFResult lib3mf_composematrixnode_getinputm10(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM10)
 {
-	IBase* pIBaseClass = (IBase *)pDecomposeVectorNode;
+	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pDecomposeVectorNode, "DecomposeVectorNode", "GetInputA");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM10");
 		}
-		if (pA == nullptr)
+		if (pM10 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseA(nullptr);
-		IDecomposeVectorNode* pIDecomposeVectorNode = dynamic_cast<IDecomposeVectorNode*>(pIBaseClass);
-		if (!pIDecomposeVectorNode)
+		IBase* pBaseM10(nullptr);
+		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
+		if (!pIComposeMatrixNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseA = pIDecomposeVectorNode->GetInputA();
+		pBaseM10 = pIComposeMatrixNode->GetInputM10();
 
-		*pA = (IBase*)(pBaseA);
+		*pM10 = (IBase*)(pBaseM10);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("A", *pA);
+			pJournalEntry->addHandleResult("M10", *pM10);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12515,27 +13592,27 @@ Lib3MFResult lib3mf_decomposevectornode_getinputa(Lib3MF_DecomposeVectorNode pDe
 	}
 }
 
-Lib3MFResult lib3mf_decomposevectornode_getoutputx(Lib3MF_DecomposeVectorNode pDecomposeVectorNode, Lib3MF_ImplicitPort * pX)
+Lib3MFResult lib3mf_composematrixnode_getinputm11(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM11)
 {
-	IBase* pIBaseClass = (IBase *)pDecomposeVectorNode;
+	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pDecomposeVectorNode, "DecomposeVectorNode", "GetOutputX");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM11");
 		}
-		if (pX == nullptr)
+		if (pM11 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseX(nullptr);
-		IDecomposeVectorNode* pIDecomposeVectorNode = dynamic_cast<IDecomposeVectorNode*>(pIBaseClass);
-		if (!pIDecomposeVectorNode)
+		IBase* pBaseM11(nullptr);
+		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
+		if (!pIComposeMatrixNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseX = pIDecomposeVectorNode->GetOutputX();
+		pBaseM11 = pIComposeMatrixNode->GetInputM11();
 
-		*pX = (IBase*)(pBaseX);
+		*pM11 = (IBase*)(pBaseM11);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("X", *pX);
+			pJournalEntry->addHandleResult("M11", *pM11);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12551,27 +13628,27 @@ Lib3MFResult lib3mf_decomposevectornode_getoutputx(Lib3MF_DecomposeVectorNode pD
 	}
 }
 
-Lib3MFResult lib3mf_decomposevectornode_getoutputy(Lib3MF_DecomposeVectorNode pDecomposeVectorNode, Lib3MF_ImplicitPort * pY)
+Lib3MFResult lib3mf_composematrixnode_getinputm12(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM12)
 {
-	IBase* pIBaseClass = (IBase *)pDecomposeVectorNode;
+	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pDecomposeVectorNode, "DecomposeVectorNode", "GetOutputY");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM12");
 		}
-		if (pY == nullptr)
+		if (pM12 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseY(nullptr);
-		IDecomposeVectorNode* pIDecomposeVectorNode = dynamic_cast<IDecomposeVectorNode*>(pIBaseClass);
-		if (!pIDecomposeVectorNode)
+		IBase* pBaseM12(nullptr);
+		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
+		if (!pIComposeMatrixNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseY = pIDecomposeVectorNode->GetOutputY();
+		pBaseM12 = pIComposeMatrixNode->GetInputM12();
 
-		*pY = (IBase*)(pBaseY);
+		*pM12 = (IBase*)(pBaseM12);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Y", *pY);
+			pJournalEntry->addHandleResult("M12", *pM12);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12587,27 +13664,27 @@ Lib3MFResult lib3mf_decomposevectornode_getoutputy(Lib3MF_DecomposeVectorNode pD
 	}
 }
 
-Lib3MFResult lib3mf_decomposevectornode_getoutputz(Lib3MF_DecomposeVectorNode pDecomposeVectorNode, Lib3MF_ImplicitPort * pZ)
+Lib3MFResult lib3mf_composematrixnode_getinputm13(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM13)
 {
-	IBase* pIBaseClass = (IBase *)pDecomposeVectorNode;
+	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pDecomposeVectorNode, "DecomposeVectorNode", "GetOutputZ");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM13");
 		}
-		if (pZ == nullptr)
+		if (pM13 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseZ(nullptr);
-		IDecomposeVectorNode* pIDecomposeVectorNode = dynamic_cast<IDecomposeVectorNode*>(pIBaseClass);
-		if (!pIDecomposeVectorNode)
+		IBase* pBaseM13(nullptr);
+		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
+		if (!pIComposeMatrixNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseZ = pIDecomposeVectorNode->GetOutputZ();
+		pBaseM13 = pIComposeMatrixNode->GetInputM13();
 
-		*pZ = (IBase*)(pBaseZ);
+		*pM13 = (IBase*)(pBaseM13);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Z", *pZ);
+			pJournalEntry->addHandleResult("M13", *pM13);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12623,31 +13700,27 @@ Lib3MFResult lib3mf_decomposevectornode_getoutputz(Lib3MF_DecomposeVectorNode pD
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for ComposeMatrixNode
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_composematrixnode_getinputm00(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM00)
+Lib3MFResult lib3mf_composematrixnode_getinputm20(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM20)
 {
 	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM00");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM20");
 		}
-		if (pM00 == nullptr)
+		if (pM20 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseM00(nullptr);
+		IBase* pBaseM20(nullptr);
 		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
 		if (!pIComposeMatrixNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseM00 = pIComposeMatrixNode->GetInputM00();
+		pBaseM20 = pIComposeMatrixNode->GetInputM20();
 
-		*pM00 = (IBase*)(pBaseM00);
+		*pM20 = (IBase*)(pBaseM20);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("M00", *pM00);
+			pJournalEntry->addHandleResult("M20", *pM20);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12663,27 +13736,27 @@ Lib3MFResult lib3mf_composematrixnode_getinputm00(Lib3MF_ComposeMatrixNode pComp
 	}
 }
 
-Lib3MFResult lib3mf_composematrixnode_getinputm01(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM01)
+Lib3MFResult lib3mf_composematrixnode_getinputm21(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM21)
 {
 	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM01");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM21");
 		}
-		if (pM01 == nullptr)
+		if (pM21 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseM01(nullptr);
+		IBase* pBaseM21(nullptr);
 		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
 		if (!pIComposeMatrixNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseM01 = pIComposeMatrixNode->GetInputM01();
+		pBaseM21 = pIComposeMatrixNode->GetInputM21();
 
-		*pM01 = (IBase*)(pBaseM01);
+		*pM21 = (IBase*)(pBaseM21);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("M01", *pM01);
+			pJournalEntry->addHandleResult("M21", *pM21);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12699,27 +13772,27 @@ Lib3MFResult lib3mf_composematrixnode_getinputm01(Lib3MF_ComposeMatrixNode pComp
 	}
 }
 
-Lib3MFResult lib3mf_composematrixnode_getinputm02(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM02)
+Lib3MFResult lib3mf_composematrixnode_getinputm22(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM22)
 {
 	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM02");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM22");
 		}
-		if (pM02 == nullptr)
+		if (pM22 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseM02(nullptr);
+		IBase* pBaseM22(nullptr);
 		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
 		if (!pIComposeMatrixNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseM02 = pIComposeMatrixNode->GetInputM02();
+		pBaseM22 = pIComposeMatrixNode->GetInputM22();
 
-		*pM02 = (IBase*)(pBaseM02);
+		*pM22 = (IBase*)(pBaseM22);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("M02", *pM02);
+			pJournalEntry->addHandleResult("M22", *pM22);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12735,27 +13808,27 @@ Lib3MFResult lib3mf_composematrixnode_getinputm02(Lib3MF_ComposeMatrixNode pComp
 	}
 }
 
-Lib3MFResult lib3mf_composematrixnode_getinputm03(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM03)
+Lib3MFResult lib3mf_composematrixnode_getinputm23(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM23)
 {
 	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM03");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM23");
 		}
-		if (pM03 == nullptr)
+		if (pM23 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseM03(nullptr);
+		IBase* pBaseM23(nullptr);
 		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
 		if (!pIComposeMatrixNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseM03 = pIComposeMatrixNode->GetInputM03();
+		pBaseM23 = pIComposeMatrixNode->GetInputM23();
 
-		*pM03 = (IBase*)(pBaseM03);
+		*pM23 = (IBase*)(pBaseM23);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("M03", *pM03);
+			pJournalEntry->addHandleResult("M23", *pM23);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12771,27 +13844,27 @@ Lib3MFResult lib3mf_composematrixnode_getinputm03(Lib3MF_ComposeMatrixNode pComp
 	}
 }
 
-Lib3MFResult lib3mf_composematrixnode_getinputm10(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM10)
+Lib3MFResult lib3mf_composematrixnode_getinputm30(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM30)
 {
 	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM10");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM30");
 		}
-		if (pM10 == nullptr)
+		if (pM30 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseM10(nullptr);
+		IBase* pBaseM30(nullptr);
 		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
 		if (!pIComposeMatrixNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseM10 = pIComposeMatrixNode->GetInputM10();
+		pBaseM30 = pIComposeMatrixNode->GetInputM30();
 
-		*pM10 = (IBase*)(pBaseM10);
+		*pM30 = (IBase*)(pBaseM30);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("M10", *pM10);
+			pJournalEntry->addHandleResult("M30", *pM30);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12807,27 +13880,27 @@ Lib3MFResult lib3mf_composematrixnode_getinputm10(Lib3MF_ComposeMatrixNode pComp
 	}
 }
 
-Lib3MFResult lib3mf_composematrixnode_getinputm11(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM11)
+Lib3MFResult lib3mf_composematrixnode_getinputm31(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM31)
 {
 	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM11");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM31");
 		}
-		if (pM11 == nullptr)
+		if (pM31 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseM11(nullptr);
+		IBase* pBaseM31(nullptr);
 		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
 		if (!pIComposeMatrixNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseM11 = pIComposeMatrixNode->GetInputM11();
+		pBaseM31 = pIComposeMatrixNode->GetInputM31();
 
-		*pM11 = (IBase*)(pBaseM11);
+		*pM31 = (IBase*)(pBaseM31);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("M11", *pM11);
+			pJournalEntry->addHandleResult("M31", *pM31);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12843,27 +13916,27 @@ Lib3MFResult lib3mf_composematrixnode_getinputm11(Lib3MF_ComposeMatrixNode pComp
 	}
 }
 
-Lib3MFResult lib3mf_composematrixnode_getinputm12(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM12)
+Lib3MFResult lib3mf_composematrixnode_getinputm32(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM32)
 {
 	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM12");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM32");
 		}
-		if (pM12 == nullptr)
+		if (pM32 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseM12(nullptr);
+		IBase* pBaseM32(nullptr);
 		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
 		if (!pIComposeMatrixNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseM12 = pIComposeMatrixNode->GetInputM12();
+		pBaseM32 = pIComposeMatrixNode->GetInputM32();
 
-		*pM12 = (IBase*)(pBaseM12);
+		*pM32 = (IBase*)(pBaseM32);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("M12", *pM12);
+			pJournalEntry->addHandleResult("M32", *pM32);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12879,27 +13952,27 @@ Lib3MFResult lib3mf_composematrixnode_getinputm12(Lib3MF_ComposeMatrixNode pComp
 	}
 }
 
-Lib3MFResult lib3mf_composematrixnode_getinputm13(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM13)
+Lib3MFResult lib3mf_composematrixnode_getinputm33(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM33)
 {
 	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM13");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM33");
 		}
-		if (pM13 == nullptr)
+		if (pM33 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseM13(nullptr);
+		IBase* pBaseM33(nullptr);
 		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
 		if (!pIComposeMatrixNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseM13 = pIComposeMatrixNode->GetInputM13();
+		pBaseM33 = pIComposeMatrixNode->GetInputM33();
 
-		*pM13 = (IBase*)(pBaseM13);
+		*pM33 = (IBase*)(pBaseM33);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("M13", *pM13);
+			pJournalEntry->addHandleResult("M33", *pM33);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12915,27 +13988,27 @@ Lib3MFResult lib3mf_composematrixnode_getinputm13(Lib3MF_ComposeMatrixNode pComp
 	}
 }
 
-Lib3MFResult lib3mf_composematrixnode_getinputm20(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM20)
+Lib3MFResult lib3mf_composematrixnode_getoutputresult(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pResult)
 {
 	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM20");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetOutputResult");
 		}
-		if (pM20 == nullptr)
+		if (pResult == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseM20(nullptr);
+		IBase* pBaseResult(nullptr);
 		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
 		if (!pIComposeMatrixNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseM20 = pIComposeMatrixNode->GetInputM20();
+		pBaseResult = pIComposeMatrixNode->GetOutputResult();
 
-		*pM20 = (IBase*)(pBaseM20);
+		*pResult = (IBase*)(pBaseResult);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("M20", *pM20);
+			pJournalEntry->addHandleResult("Result", *pResult);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12951,27 +14024,31 @@ Lib3MFResult lib3mf_composematrixnode_getinputm20(Lib3MF_ComposeMatrixNode pComp
 	}
 }
 
-Lib3MFResult lib3mf_composematrixnode_getinputm21(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM21)
+
+/*************************************************************************************************************************
+ Class implementation for MatrixFromRowsNode
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_matrixfromrowsnode_getinputa(Lib3MF_MatrixFromRowsNode pMatrixFromRowsNode, Lib3MF_ImplicitPort * pRow0)
 {
-	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
+	IBase* pIBaseClass = (IBase *)pMatrixFromRowsNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM21");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromRowsNode, "MatrixFromRowsNode", "GetInputA");
 		}
-		if (pM21 == nullptr)
+		if (pRow0 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseM21(nullptr);
-		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
-		if (!pIComposeMatrixNode)
+		IBase* pBaseRow0(nullptr);
+		IMatrixFromRowsNode* pIMatrixFromRowsNode = dynamic_cast<IMatrixFromRowsNode*>(pIBaseClass);
+		if (!pIMatrixFromRowsNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseM21 = pIComposeMatrixNode->GetInputM21();
+		pBaseRow0 = pIMatrixFromRowsNode->GetInputA();
 
-		*pM21 = (IBase*)(pBaseM21);
+		*pRow0 = (IBase*)(pBaseRow0);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("M21", *pM21);
+			pJournalEntry->addHandleResult("Row0", *pRow0);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -12987,27 +14064,27 @@ Lib3MFResult lib3mf_composematrixnode_getinputm21(Lib3MF_ComposeMatrixNode pComp
 	}
 }
 
-Lib3MFResult lib3mf_composematrixnode_getinputm22(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM22)
+Lib3MFResult lib3mf_matrixfromrowsnode_getinputb(Lib3MF_MatrixFromRowsNode pMatrixFromRowsNode, Lib3MF_ImplicitPort * pRow1)
 {
-	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
+	IBase* pIBaseClass = (IBase *)pMatrixFromRowsNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM22");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromRowsNode, "MatrixFromRowsNode", "GetInputB");
 		}
-		if (pM22 == nullptr)
+		if (pRow1 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseM22(nullptr);
-		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
-		if (!pIComposeMatrixNode)
+		IBase* pBaseRow1(nullptr);
+		IMatrixFromRowsNode* pIMatrixFromRowsNode = dynamic_cast<IMatrixFromRowsNode*>(pIBaseClass);
+		if (!pIMatrixFromRowsNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseM22 = pIComposeMatrixNode->GetInputM22();
+		pBaseRow1 = pIMatrixFromRowsNode->GetInputB();
 
-		*pM22 = (IBase*)(pBaseM22);
+		*pRow1 = (IBase*)(pBaseRow1);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("M22", *pM22);
+			pJournalEntry->addHandleResult("Row1", *pRow1);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13023,27 +14100,27 @@ Lib3MFResult lib3mf_composematrixnode_getinputm22(Lib3MF_ComposeMatrixNode pComp
 	}
 }
 
-Lib3MFResult lib3mf_composematrixnode_getinputm23(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM23)
+Lib3MFResult lib3mf_matrixfromrowsnode_getinputc(Lib3MF_MatrixFromRowsNode pMatrixFromRowsNode, Lib3MF_ImplicitPort * pRow2)
 {
-	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
+	IBase* pIBaseClass = (IBase *)pMatrixFromRowsNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM23");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromRowsNode, "MatrixFromRowsNode", "GetInputC");
 		}
-		if (pM23 == nullptr)
+		if (pRow2 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseM23(nullptr);
-		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
-		if (!pIComposeMatrixNode)
+		IBase* pBaseRow2(nullptr);
+		IMatrixFromRowsNode* pIMatrixFromRowsNode = dynamic_cast<IMatrixFromRowsNode*>(pIBaseClass);
+		if (!pIMatrixFromRowsNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseM23 = pIComposeMatrixNode->GetInputM23();
+		pBaseRow2 = pIMatrixFromRowsNode->GetInputC();
 
-		*pM23 = (IBase*)(pBaseM23);
+		*pRow2 = (IBase*)(pBaseRow2);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("M23", *pM23);
+			pJournalEntry->addHandleResult("Row2", *pRow2);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13059,27 +14136,27 @@ Lib3MFResult lib3mf_composematrixnode_getinputm23(Lib3MF_ComposeMatrixNode pComp
 	}
 }
 
-Lib3MFResult lib3mf_composematrixnode_getinputm30(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM30)
+Lib3MFResult lib3mf_matrixfromrowsnode_getinputd(Lib3MF_MatrixFromRowsNode pMatrixFromRowsNode, Lib3MF_ImplicitPort * pRow3)
 {
-	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
+	IBase* pIBaseClass = (IBase *)pMatrixFromRowsNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM30");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromRowsNode, "MatrixFromRowsNode", "GetInputD");
 		}
-		if (pM30 == nullptr)
+		if (pRow3 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseM30(nullptr);
-		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
-		if (!pIComposeMatrixNode)
+		IBase* pBaseRow3(nullptr);
+		IMatrixFromRowsNode* pIMatrixFromRowsNode = dynamic_cast<IMatrixFromRowsNode*>(pIBaseClass);
+		if (!pIMatrixFromRowsNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseM30 = pIComposeMatrixNode->GetInputM30();
+		pBaseRow3 = pIMatrixFromRowsNode->GetInputD();
 
-		*pM30 = (IBase*)(pBaseM30);
+		*pRow3 = (IBase*)(pBaseRow3);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("M30", *pM30);
+			pJournalEntry->addHandleResult("Row3", *pRow3);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13095,27 +14172,27 @@ Lib3MFResult lib3mf_composematrixnode_getinputm30(Lib3MF_ComposeMatrixNode pComp
 	}
 }
 
-Lib3MFResult lib3mf_composematrixnode_getinputm31(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM31)
+Lib3MFResult lib3mf_matrixfromrowsnode_getoutputresult(Lib3MF_MatrixFromRowsNode pMatrixFromRowsNode, Lib3MF_ImplicitPort * pResult)
 {
-	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
+	IBase* pIBaseClass = (IBase *)pMatrixFromRowsNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM31");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromRowsNode, "MatrixFromRowsNode", "GetOutputResult");
 		}
-		if (pM31 == nullptr)
+		if (pResult == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseM31(nullptr);
-		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
-		if (!pIComposeMatrixNode)
+		IBase* pBaseResult(nullptr);
+		IMatrixFromRowsNode* pIMatrixFromRowsNode = dynamic_cast<IMatrixFromRowsNode*>(pIBaseClass);
+		if (!pIMatrixFromRowsNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseM31 = pIComposeMatrixNode->GetInputM31();
+		pBaseResult = pIMatrixFromRowsNode->GetOutputResult();
 
-		*pM31 = (IBase*)(pBaseM31);
+		*pResult = (IBase*)(pBaseResult);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("M31", *pM31);
+			pJournalEntry->addHandleResult("Result", *pResult);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13131,27 +14208,31 @@ Lib3MFResult lib3mf_composematrixnode_getinputm31(Lib3MF_ComposeMatrixNode pComp
 	}
 }
 
-Lib3MFResult lib3mf_composematrixnode_getinputm32(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM32)
+
+/*************************************************************************************************************************
+ Class implementation for MatrixFromColumnsNode
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_matrixfromcolumnsnode_getinputa(Lib3MF_MatrixFromColumnsNode pMatrixFromColumnsNode, Lib3MF_ImplicitPort * pColumn0)
 {
-	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
+	IBase* pIBaseClass = (IBase *)pMatrixFromColumnsNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM32");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromColumnsNode, "MatrixFromColumnsNode", "GetInputA");
 		}
-		if (pM32 == nullptr)
+		if (pColumn0 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseM32(nullptr);
-		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
-		if (!pIComposeMatrixNode)
+		IBase* pBaseColumn0(nullptr);
+		IMatrixFromColumnsNode* pIMatrixFromColumnsNode = dynamic_cast<IMatrixFromColumnsNode*>(pIBaseClass);
+		if (!pIMatrixFromColumnsNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseM32 = pIComposeMatrixNode->GetInputM32();
+		pBaseColumn0 = pIMatrixFromColumnsNode->GetInputA();
 
-		*pM32 = (IBase*)(pBaseM32);
+		*pColumn0 = (IBase*)(pBaseColumn0);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("M32", *pM32);
+			pJournalEntry->addHandleResult("Column0", *pColumn0);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13167,27 +14248,27 @@ Lib3MFResult lib3mf_composematrixnode_getinputm32(Lib3MF_ComposeMatrixNode pComp
 	}
 }
 
-Lib3MFResult lib3mf_composematrixnode_getinputm33(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pM33)
+Lib3MFResult lib3mf_matrixfromcolumnsnode_getinputb(Lib3MF_MatrixFromColumnsNode pMatrixFromColumnsNode, Lib3MF_ImplicitPort * pColumn1)
 {
-	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
+	IBase* pIBaseClass = (IBase *)pMatrixFromColumnsNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetInputM33");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromColumnsNode, "MatrixFromColumnsNode", "GetInputB");
 		}
-		if (pM33 == nullptr)
+		if (pColumn1 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseM33(nullptr);
-		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
-		if (!pIComposeMatrixNode)
+		IBase* pBaseColumn1(nullptr);
+		IMatrixFromColumnsNode* pIMatrixFromColumnsNode = dynamic_cast<IMatrixFromColumnsNode*>(pIBaseClass);
+		if (!pIMatrixFromColumnsNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseM33 = pIComposeMatrixNode->GetInputM33();
+		pBaseColumn1 = pIMatrixFromColumnsNode->GetInputB();
 
-		*pM33 = (IBase*)(pBaseM33);
+		*pColumn1 = (IBase*)(pBaseColumn1);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("M33", *pM33);
+			pJournalEntry->addHandleResult("Column1", *pColumn1);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13203,27 +14284,27 @@ Lib3MFResult lib3mf_composematrixnode_getinputm33(Lib3MF_ComposeMatrixNode pComp
 	}
 }
 
-Lib3MFResult lib3mf_composematrixnode_getoutputresult(Lib3MF_ComposeMatrixNode pComposeMatrixNode, Lib3MF_ImplicitPort * pResult)
+Lib3MFResult lib3mf_matrixfromcolumnsnode_getinputc(Lib3MF_MatrixFromColumnsNode pMatrixFromColumnsNode, Lib3MF_ImplicitPort * pColumn2)
 {
-	IBase* pIBaseClass = (IBase *)pComposeMatrixNode;
+	IBase* pIBaseClass = (IBase *)pMatrixFromColumnsNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pComposeMatrixNode, "ComposeMatrixNode", "GetOutputResult");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromColumnsNode, "MatrixFromColumnsNode", "GetInputC");
 		}
-		if (pResult == nullptr)
+		if (pColumn2 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseResult(nullptr);
-		IComposeMatrixNode* pIComposeMatrixNode = dynamic_cast<IComposeMatrixNode*>(pIBaseClass);
-		if (!pIComposeMatrixNode)
+		IBase* pBaseColumn2(nullptr);
+		IMatrixFromColumnsNode* pIMatrixFromColumnsNode = dynamic_cast<IMatrixFromColumnsNode*>(pIBaseClass);
+		if (!pIMatrixFromColumnsNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResult = pIComposeMatrixNode->GetOutputResult();
+		pBaseColumn2 = pIMatrixFromColumnsNode->GetInputC();
 
-		*pResult = (IBase*)(pBaseResult);
+		*pColumn2 = (IBase*)(pBaseColumn2);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Result", *pResult);
+			pJournalEntry->addHandleResult("Column2", *pColumn2);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13239,31 +14320,27 @@ Lib3MFResult lib3mf_composematrixnode_getoutputresult(Lib3MF_ComposeMatrixNode p
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for MatrixFromRowsNode
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_matrixfromrowsnode_getinputa(Lib3MF_MatrixFromRowsNode pMatrixFromRowsNode, Lib3MF_ImplicitPort * pRow0)
+Lib3MFResult lib3mf_matrixfromcolumnsnode_getinputd(Lib3MF_MatrixFromColumnsNode pMatrixFromColumnsNode, Lib3MF_ImplicitPort * pColumn3)
 {
-	IBase* pIBaseClass = (IBase *)pMatrixFromRowsNode;
+	IBase* pIBaseClass = (IBase *)pMatrixFromColumnsNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromRowsNode, "MatrixFromRowsNode", "GetInputA");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromColumnsNode, "MatrixFromColumnsNode", "GetInputD");
 		}
-		if (pRow0 == nullptr)
+		if (pColumn3 == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseRow0(nullptr);
-		IMatrixFromRowsNode* pIMatrixFromRowsNode = dynamic_cast<IMatrixFromRowsNode*>(pIBaseClass);
-		if (!pIMatrixFromRowsNode)
+		IBase* pBaseColumn3(nullptr);
+		IMatrixFromColumnsNode* pIMatrixFromColumnsNode = dynamic_cast<IMatrixFromColumnsNode*>(pIBaseClass);
+		if (!pIMatrixFromColumnsNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseRow0 = pIMatrixFromRowsNode->GetInputA();
+		pBaseColumn3 = pIMatrixFromColumnsNode->GetInputD();
 
-		*pRow0 = (IBase*)(pBaseRow0);
+		*pColumn3 = (IBase*)(pBaseColumn3);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Row0", *pRow0);
+			pJournalEntry->addHandleResult("Column3", *pColumn3);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13279,27 +14356,27 @@ Lib3MFResult lib3mf_matrixfromrowsnode_getinputa(Lib3MF_MatrixFromRowsNode pMatr
 	}
 }
 
-Lib3MFResult lib3mf_matrixfromrowsnode_getinputb(Lib3MF_MatrixFromRowsNode pMatrixFromRowsNode, Lib3MF_ImplicitPort * pRow1)
+Lib3MFResult lib3mf_matrixfromcolumnsnode_getoutputresult(Lib3MF_MatrixFromColumnsNode pMatrixFromColumnsNode, Lib3MF_ImplicitPort * pResult)
 {
-	IBase* pIBaseClass = (IBase *)pMatrixFromRowsNode;
+	IBase* pIBaseClass = (IBase *)pMatrixFromColumnsNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromRowsNode, "MatrixFromRowsNode", "GetInputB");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromColumnsNode, "MatrixFromColumnsNode", "GetOutputResult");
 		}
-		if (pRow1 == nullptr)
+		if (pResult == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseRow1(nullptr);
-		IMatrixFromRowsNode* pIMatrixFromRowsNode = dynamic_cast<IMatrixFromRowsNode*>(pIBaseClass);
-		if (!pIMatrixFromRowsNode)
+		IBase* pBaseResult(nullptr);
+		IMatrixFromColumnsNode* pIMatrixFromColumnsNode = dynamic_cast<IMatrixFromColumnsNode*>(pIBaseClass);
+		if (!pIMatrixFromColumnsNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseRow1 = pIMatrixFromRowsNode->GetInputB();
+		pBaseResult = pIMatrixFromColumnsNode->GetOutputResult();
 
-		*pRow1 = (IBase*)(pBaseRow1);
+		*pResult = (IBase*)(pBaseResult);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Row1", *pRow1);
+			pJournalEntry->addHandleResult("Result", *pResult);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13315,27 +14392,27 @@ Lib3MFResult lib3mf_matrixfromrowsnode_getinputb(Lib3MF_MatrixFromRowsNode pMatr
 	}
 }
 
-Lib3MFResult lib3mf_matrixfromrowsnode_getinputc(Lib3MF_MatrixFromRowsNode pMatrixFromRowsNode, Lib3MF_ImplicitPort * pRow2)
+
+/*************************************************************************************************************************
+ Class implementation for ConstantNode
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_constantnode_setconstant(Lib3MF_ConstantNode pConstantNode, Lib3MF_double dValue)
 {
-	IBase* pIBaseClass = (IBase *)pMatrixFromRowsNode;
+	IBase* pIBaseClass = (IBase *)pConstantNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromRowsNode, "MatrixFromRowsNode", "GetInputC");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pConstantNode, "ConstantNode", "SetConstant");
+			pJournalEntry->addDoubleParameter("Value", dValue);
 		}
-		if (pRow2 == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseRow2(nullptr);
-		IMatrixFromRowsNode* pIMatrixFromRowsNode = dynamic_cast<IMatrixFromRowsNode*>(pIBaseClass);
-		if (!pIMatrixFromRowsNode)
+		IConstantNode* pIConstantNode = dynamic_cast<IConstantNode*>(pIBaseClass);
+		if (!pIConstantNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseRow2 = pIMatrixFromRowsNode->GetInputC();
+		pIConstantNode->SetConstant(dValue);
 
-		*pRow2 = (IBase*)(pBaseRow2);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Row2", *pRow2);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13351,27 +14428,25 @@ Lib3MFResult lib3mf_matrixfromrowsnode_getinputc(Lib3MF_MatrixFromRowsNode pMatr
 	}
 }
 
-Lib3MFResult lib3mf_matrixfromrowsnode_getinputd(Lib3MF_MatrixFromRowsNode pMatrixFromRowsNode, Lib3MF_ImplicitPort * pRow3)
+Lib3MFResult lib3mf_constantnode_getconstant(Lib3MF_ConstantNode pConstantNode, Lib3MF_double * pValue)
 {
-	IBase* pIBaseClass = (IBase *)pMatrixFromRowsNode;
+	IBase* pIBaseClass = (IBase *)pConstantNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromRowsNode, "MatrixFromRowsNode", "GetInputD");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pConstantNode, "ConstantNode", "GetConstant");
 		}
-		if (pRow3 == nullptr)
+		if (pValue == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseRow3(nullptr);
-		IMatrixFromRowsNode* pIMatrixFromRowsNode = dynamic_cast<IMatrixFromRowsNode*>(pIBaseClass);
-		if (!pIMatrixFromRowsNode)
+		IConstantNode* pIConstantNode = dynamic_cast<IConstantNode*>(pIBaseClass);
+		if (!pIConstantNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseRow3 = pIMatrixFromRowsNode->GetInputD();
+		*pValue = pIConstantNode->GetConstant();
 
-		*pRow3 = (IBase*)(pBaseRow3);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Row3", *pRow3);
+			pJournalEntry->addDoubleResult("Value", *pValue);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13387,27 +14462,27 @@ Lib3MFResult lib3mf_matrixfromrowsnode_getinputd(Lib3MF_MatrixFromRowsNode pMatr
 	}
 }
 
-Lib3MFResult lib3mf_matrixfromrowsnode_getoutputresult(Lib3MF_MatrixFromRowsNode pMatrixFromRowsNode, Lib3MF_ImplicitPort * pResult)
+Lib3MFResult lib3mf_constantnode_getoutputvalue(Lib3MF_ConstantNode pConstantNode, Lib3MF_ImplicitPort * pValue)
 {
-	IBase* pIBaseClass = (IBase *)pMatrixFromRowsNode;
+	IBase* pIBaseClass = (IBase *)pConstantNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromRowsNode, "MatrixFromRowsNode", "GetOutputResult");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pConstantNode, "ConstantNode", "GetOutputValue");
 		}
-		if (pResult == nullptr)
+		if (pValue == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseResult(nullptr);
-		IMatrixFromRowsNode* pIMatrixFromRowsNode = dynamic_cast<IMatrixFromRowsNode*>(pIBaseClass);
-		if (!pIMatrixFromRowsNode)
+		IBase* pBaseValue(nullptr);
+		IConstantNode* pIConstantNode = dynamic_cast<IConstantNode*>(pIBaseClass);
+		if (!pIConstantNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResult = pIMatrixFromRowsNode->GetOutputResult();
+		pBaseValue = pIConstantNode->GetOutputValue();
 
-		*pResult = (IBase*)(pBaseResult);
+		*pValue = (IBase*)(pBaseValue);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Result", *pResult);
+			pJournalEntry->addHandleResult("Value", *pValue);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13425,29 +14500,24 @@ Lib3MFResult lib3mf_matrixfromrowsnode_getoutputresult(Lib3MF_MatrixFromRowsNode
 
 
 /*************************************************************************************************************************
- Class implementation for MatrixFromColumnsNode
+ Class implementation for ConstVecNode
 **************************************************************************************************************************/
-Lib3MFResult lib3mf_matrixfromcolumnsnode_getinputa(Lib3MF_MatrixFromColumnsNode pMatrixFromColumnsNode, Lib3MF_ImplicitPort * pColumn0)
+Lib3MFResult lib3mf_constvecnode_setvector(Lib3MF_ConstVecNode pConstVecNode, const sLib3MFVector * pValue)
 {
-	IBase* pIBaseClass = (IBase *)pMatrixFromColumnsNode;
+	IBase* pIBaseClass = (IBase *)pConstVecNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromColumnsNode, "MatrixFromColumnsNode", "GetInputA");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pConstVecNode, "ConstVecNode", "SetVector");
 		}
-		if (pColumn0 == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseColumn0(nullptr);
-		IMatrixFromColumnsNode* pIMatrixFromColumnsNode = dynamic_cast<IMatrixFromColumnsNode*>(pIBaseClass);
-		if (!pIMatrixFromColumnsNode)
+		IConstVecNode* pIConstVecNode = dynamic_cast<IConstVecNode*>(pIBaseClass);
+		if (!pIConstVecNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseColumn0 = pIMatrixFromColumnsNode->GetInputA();
+		pIConstVecNode->SetVector(*pValue);
 
-		*pColumn0 = (IBase*)(pBaseColumn0);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Column0", *pColumn0);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13463,27 +14533,24 @@ Lib3MFResult lib3mf_matrixfromcolumnsnode_getinputa(Lib3MF_MatrixFromColumnsNode
 	}
 }
 
-Lib3MFResult lib3mf_matrixfromcolumnsnode_getinputb(Lib3MF_MatrixFromColumnsNode pMatrixFromColumnsNode, Lib3MF_ImplicitPort * pColumn1)
+Lib3MFResult lib3mf_constvecnode_getvector(Lib3MF_ConstVecNode pConstVecNode, sLib3MFVector * pValue)
 {
-	IBase* pIBaseClass = (IBase *)pMatrixFromColumnsNode;
+	IBase* pIBaseClass = (IBase *)pConstVecNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromColumnsNode, "MatrixFromColumnsNode", "GetInputB");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pConstVecNode, "ConstVecNode", "GetVector");
 		}
-		if (pColumn1 == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseColumn1(nullptr);
-		IMatrixFromColumnsNode* pIMatrixFromColumnsNode = dynamic_cast<IMatrixFromColumnsNode*>(pIBaseClass);
-		if (!pIMatrixFromColumnsNode)
+		if (pValue == nullptr)
+		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IConstVecNode* pIConstVecNode = dynamic_cast<IConstVecNode*>(pIBaseClass);
+		if (!pIConstVecNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseColumn1 = pIMatrixFromColumnsNode->GetInputB();
+		*pValue = pIConstVecNode->GetVector();
 
-		*pColumn1 = (IBase*)(pBaseColumn1);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Column1", *pColumn1);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13499,27 +14566,27 @@ Lib3MFResult lib3mf_matrixfromcolumnsnode_getinputb(Lib3MF_MatrixFromColumnsNode
 	}
 }
 
-Lib3MFResult lib3mf_matrixfromcolumnsnode_getinputc(Lib3MF_MatrixFromColumnsNode pMatrixFromColumnsNode, Lib3MF_ImplicitPort * pColumn2)
+Lib3MFResult lib3mf_constvecnode_getoutputvector(Lib3MF_ConstVecNode pConstVecNode, Lib3MF_ImplicitPort * pVector)
 {
-	IBase* pIBaseClass = (IBase *)pMatrixFromColumnsNode;
+	IBase* pIBaseClass = (IBase *)pConstVecNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromColumnsNode, "MatrixFromColumnsNode", "GetInputC");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pConstVecNode, "ConstVecNode", "GetOutputVector");
 		}
-		if (pColumn2 == nullptr)
+		if (pVector == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseColumn2(nullptr);
-		IMatrixFromColumnsNode* pIMatrixFromColumnsNode = dynamic_cast<IMatrixFromColumnsNode*>(pIBaseClass);
-		if (!pIMatrixFromColumnsNode)
+		IBase* pBaseVector(nullptr);
+		IConstVecNode* pIConstVecNode = dynamic_cast<IConstVecNode*>(pIBaseClass);
+		if (!pIConstVecNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseColumn2 = pIMatrixFromColumnsNode->GetInputC();
+		pBaseVector = pIConstVecNode->GetOutputVector();
 
-		*pColumn2 = (IBase*)(pBaseColumn2);
+		*pVector = (IBase*)(pBaseVector);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Column2", *pColumn2);
+			pJournalEntry->addHandleResult("Vector", *pVector);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13535,27 +14602,26 @@ Lib3MFResult lib3mf_matrixfromcolumnsnode_getinputc(Lib3MF_MatrixFromColumnsNode
 	}
 }
 
-Lib3MFResult lib3mf_matrixfromcolumnsnode_getinputd(Lib3MF_MatrixFromColumnsNode pMatrixFromColumnsNode, Lib3MF_ImplicitPort * pColumn3)
+
+/*************************************************************************************************************************
+ Class implementation for ConstMatNode
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_constmatnode_setmatrix(Lib3MF_ConstMatNode pConstMatNode, const sLib3MFMatrix4x4 * pValue)
 {
-	IBase* pIBaseClass = (IBase *)pMatrixFromColumnsNode;
+	IBase* pIBaseClass = (IBase *)pConstMatNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromColumnsNode, "MatrixFromColumnsNode", "GetInputD");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pConstMatNode, "ConstMatNode", "SetMatrix");
 		}
-		if (pColumn3 == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseColumn3(nullptr);
-		IMatrixFromColumnsNode* pIMatrixFromColumnsNode = dynamic_cast<IMatrixFromColumnsNode*>(pIBaseClass);
-		if (!pIMatrixFromColumnsNode)
+		IConstMatNode* pIConstMatNode = dynamic_cast<IConstMatNode*>(pIBaseClass);
+		if (!pIConstMatNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseColumn3 = pIMatrixFromColumnsNode->GetInputD();
+		pIConstMatNode->SetMatrix(*pValue);
 
-		*pColumn3 = (IBase*)(pBaseColumn3);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Column3", *pColumn3);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13571,27 +14637,24 @@ Lib3MFResult lib3mf_matrixfromcolumnsnode_getinputd(Lib3MF_MatrixFromColumnsNode
 	}
 }
 
-Lib3MFResult lib3mf_matrixfromcolumnsnode_getoutputresult(Lib3MF_MatrixFromColumnsNode pMatrixFromColumnsNode, Lib3MF_ImplicitPort * pResult)
+Lib3MFResult lib3mf_constmatnode_getmatrix(Lib3MF_ConstMatNode pConstMatNode, sLib3MFMatrix4x4 * pValue)
 {
-	IBase* pIBaseClass = (IBase *)pMatrixFromColumnsNode;
+	IBase* pIBaseClass = (IBase *)pConstMatNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMatrixFromColumnsNode, "MatrixFromColumnsNode", "GetOutputResult");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pConstMatNode, "ConstMatNode", "GetMatrix");
 		}
-		if (pResult == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseResult(nullptr);
-		IMatrixFromColumnsNode* pIMatrixFromColumnsNode = dynamic_cast<IMatrixFromColumnsNode*>(pIBaseClass);
-		if (!pIMatrixFromColumnsNode)
+		if (pValue == nullptr)
+		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IConstMatNode* pIConstMatNode = dynamic_cast<IConstMatNode*>(pIBaseClass);
+		if (!pIConstMatNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseResult = pIMatrixFromColumnsNode->GetOutputResult();
+		*pValue = pIConstMatNode->GetMatrix();
 
-		*pResult = (IBase*)(pBaseResult);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Result", *pResult);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13607,27 +14670,27 @@ Lib3MFResult lib3mf_matrixfromcolumnsnode_getoutputresult(Lib3MF_MatrixFromColum
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for ConstantNode
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_constantnode_setconstant(Lib3MF_ConstantNode pConstantNode, Lib3MF_double dValue)
+Lib3MFResult lib3mf_constmatnode_getoutputmatrix(Lib3MF_ConstMatNode pConstMatNode, Lib3MF_ImplicitPort * pMatrix)
 {
-	IBase* pIBaseClass = (IBase *)pConstantNode;
+	IBase* pIBaseClass = (IBase *)pConstMatNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pConstantNode, "ConstantNode", "SetConstant");
-			pJournalEntry->addDoubleParameter("Value", dValue);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pConstMatNode, "ConstMatNode", "GetOutputMatrix");
 		}
-		IConstantNode* pIConstantNode = dynamic_cast<IConstantNode*>(pIBaseClass);
-		if (!pIConstantNode)
+		if (pMatrix == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseMatrix(nullptr);
+		IConstMatNode* pIConstMatNode = dynamic_cast<IConstMatNode*>(pIBaseClass);
+		if (!pIConstMatNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIConstantNode->SetConstant(dValue);
+		pBaseMatrix = pIConstMatNode->GetOutputMatrix();
 
+		*pMatrix = (IBase*)(pBaseMatrix);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Matrix", *pMatrix);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13643,25 +14706,31 @@ Lib3MFResult lib3mf_constantnode_setconstant(Lib3MF_ConstantNode pConstantNode,
 	}
 }
 
-Lib3MFResult lib3mf_constantnode_getconstant(Lib3MF_ConstantNode pConstantNode, Lib3MF_double * pValue)
+
+/*************************************************************************************************************************
+ Class implementation for MeshNode
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_meshnode_getinputmesh(Lib3MF_MeshNode pMeshNode, Lib3MF_ImplicitPort * pMesh)
 {
-	IBase* pIBaseClass = (IBase *)pConstantNode;
+	IBase* pIBaseClass = (IBase *)pMeshNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pConstantNode, "ConstantNode", "GetConstant");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshNode, "MeshNode", "GetInputMesh");
 		}
-		if (pValue == nullptr)
+		if (pMesh == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IConstantNode* pIConstantNode = dynamic_cast<IConstantNode*>(pIBaseClass);
-		if (!pIConstantNode)
+		IBase* pBaseMesh(nullptr);
+		IMeshNode* pIMeshNode = dynamic_cast<IMeshNode*>(pIBaseClass);
+		if (!pIMeshNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pValue = pIConstantNode->GetConstant();
+		pBaseMesh = pIMeshNode->GetInputMesh();
 
+		*pMesh = (IBase*)(pBaseMesh);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addDoubleResult("Value", *pValue);
+			pJournalEntry->addHandleResult("Mesh", *pMesh);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13677,27 +14746,27 @@ Lib3MFResult lib3mf_constantnode_getconstant(Lib3MF_ConstantNode pConstantNode,
 	}
 }
 
-Lib3MFResult lib3mf_constantnode_getoutputvalue(Lib3MF_ConstantNode pConstantNode, Lib3MF_ImplicitPort * pValue)
+Lib3MFResult lib3mf_meshnode_getinputpos(Lib3MF_MeshNode pMeshNode, Lib3MF_ImplicitPort * pPos)
 {
-	IBase* pIBaseClass = (IBase *)pConstantNode;
+	IBase* pIBaseClass = (IBase *)pMeshNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pConstantNode, "ConstantNode", "GetOutputValue");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshNode, "MeshNode", "GetInputPos");
 		}
-		if (pValue == nullptr)
+		if (pPos == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseValue(nullptr);
-		IConstantNode* pIConstantNode = dynamic_cast<IConstantNode*>(pIBaseClass);
-		if (!pIConstantNode)
+		IBase* pBasePos(nullptr);
+		IMeshNode* pIMeshNode = dynamic_cast<IMeshNode*>(pIBaseClass);
+		if (!pIMeshNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseValue = pIConstantNode->GetOutputValue();
+		pBasePos = pIMeshNode->GetInputPos();
 
-		*pValue = (IBase*)(pBaseValue);
+		*pPos = (IBase*)(pBasePos);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Value", *pValue);
+			pJournalEntry->addHandleResult("Pos", *pPos);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13713,26 +14782,27 @@ Lib3MFResult lib3mf_constantnode_getoutputvalue(Lib3MF_ConstantNode pConstantNod
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for ConstVecNode
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_constvecnode_setvector(Lib3MF_ConstVecNode pConstVecNode, const sLib3MFVector * pValue)
+Lib3MFResult lib3mf_meshnode_getoutputdistance(Lib3MF_MeshNode pMeshNode, Lib3MF_ImplicitPort * pDistance)
 {
-	IBase* pIBaseClass = (IBase *)pConstVecNode;
+	IBase* pIBaseClass = (IBase *)pMeshNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pConstVecNode, "ConstVecNode", "SetVector");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshNode, "MeshNode", "GetOutputDistance");
 		}
-		IConstVecNode* pIConstVecNode = dynamic_cast<IConstVecNode*>(pIBaseClass);
-		if (!pIConstVecNode)
+		if (pDistance == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseDistance(nullptr);
+		IMeshNode* pIMeshNode = dynamic_cast<IMeshNode*>(pIBaseClass);
+		if (!pIMeshNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIConstVecNode->SetVector(*pValue);
+		pBaseDistance = pIMeshNode->GetOutputDistance();
 
+		*pDistance = (IBase*)(pBaseDistance);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Distance", *pDistance);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13748,24 +14818,31 @@ Lib3MFResult lib3mf_constvecnode_setvector(Lib3MF_ConstVecNode pConstVecNode, co
 	}
 }
 
-Lib3MFResult lib3mf_constvecnode_getvector(Lib3MF_ConstVecNode pConstVecNode, sLib3MFVector * pValue)
+
+/*************************************************************************************************************************
+ Class implementation for UnsignedMeshNode
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_unsignedmeshnode_getinputmesh(Lib3MF_UnsignedMeshNode pUnsignedMeshNode, Lib3MF_ImplicitPort * pMesh)
 {
-	IBase* pIBaseClass = (IBase *)pConstVecNode;
+	IBase* pIBaseClass = (IBase *)pUnsignedMeshNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pConstVecNode, "ConstVecNode", "GetVector");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pUnsignedMeshNode, "UnsignedMeshNode", "GetInputMesh");
 		}
-		if (pValue == nullptr)
-		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IConstVecNode* pIConstVecNode = dynamic_cast<IConstVecNode*>(pIBaseClass);
-		if (!pIConstVecNode)
+		if (pMesh == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseMesh(nullptr);
+		IUnsignedMeshNode* pIUnsignedMeshNode = dynamic_cast<IUnsignedMeshNode*>(pIBaseClass);
+		if (!pIUnsignedMeshNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pValue = pIConstVecNode->GetVector();
+		pBaseMesh = pIUnsignedMeshNode->GetInputMesh();
 
+		*pMesh = (IBase*)(pBaseMesh);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Mesh", *pMesh);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13781,27 +14858,27 @@ Lib3MFResult lib3mf_constvecnode_getvector(Lib3MF_ConstVecNode pConstVecNode, sL
 	}
 }
 
-Lib3MFResult lib3mf_constvecnode_getoutputvector(Lib3MF_ConstVecNode pConstVecNode, Lib3MF_ImplicitPort * pVector)
+Lib3MFResult lib3mf_unsignedmeshnode_getinputpos(Lib3MF_UnsignedMeshNode pUnsignedMeshNode, Lib3MF_ImplicitPort * pPos)
 {
-	IBase* pIBaseClass = (IBase *)pConstVecNode;
+	IBase* pIBaseClass = (IBase *)pUnsignedMeshNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pConstVecNode, "ConstVecNode", "GetOutputVector");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pUnsignedMeshNode, "UnsignedMeshNode", "GetInputPos");
 		}
-		if (pVector == nullptr)
+		if (pPos == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseVector(nullptr);
-		IConstVecNode* pIConstVecNode = dynamic_cast<IConstVecNode*>(pIBaseClass);
-		if (!pIConstVecNode)
+		IBase* pBasePos(nullptr);
+		IUnsignedMeshNode* pIUnsignedMeshNode = dynamic_cast<IUnsignedMeshNode*>(pIBaseClass);
+		if (!pIUnsignedMeshNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseVector = pIConstVecNode->GetOutputVector();
+		pBasePos = pIUnsignedMeshNode->GetInputPos();
 
-		*pVector = (IBase*)(pBaseVector);
+		*pPos = (IBase*)(pBasePos);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Vector", *pVector);
+			pJournalEntry->addHandleResult("Pos", *pPos);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13817,26 +14894,27 @@ Lib3MFResult lib3mf_constvecnode_getoutputvector(Lib3MF_ConstVecNode pConstVecNo
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for ConstMatNode
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_constmatnode_setmatrix(Lib3MF_ConstMatNode pConstMatNode, const sLib3MFMatrix4x4 * pValue)
+Lib3MFResult lib3mf_unsignedmeshnode_getoutputdistance(Lib3MF_UnsignedMeshNode pUnsignedMeshNode, Lib3MF_ImplicitPort * pDistance)
 {
-	IBase* pIBaseClass = (IBase *)pConstMatNode;
+	IBase* pIBaseClass = (IBase *)pUnsignedMeshNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pConstMatNode, "ConstMatNode", "SetMatrix");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pUnsignedMeshNode, "UnsignedMeshNode", "GetOutputDistance");
 		}
-		IConstMatNode* pIConstMatNode = dynamic_cast<IConstMatNode*>(pIBaseClass);
-		if (!pIConstMatNode)
+		if (pDistance == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseDistance(nullptr);
+		IUnsignedMeshNode* pIUnsignedMeshNode = dynamic_cast<IUnsignedMeshNode*>(pIBaseClass);
+		if (!pIUnsignedMeshNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIConstMatNode->SetMatrix(*pValue);
+		pBaseDistance = pIUnsignedMeshNode->GetOutputDistance();
 
+		*pDistance = (IBase*)(pBaseDistance);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Distance", *pDistance);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13852,24 +14930,31 @@ Lib3MFResult lib3mf_constmatnode_setmatrix(Lib3MF_ConstMatNode pConstMatNode, co
 	}
 }
 
-Lib3MFResult lib3mf_constmatnode_getmatrix(Lib3MF_ConstMatNode pConstMatNode, sLib3MFMatrix4x4 * pValue)
+
+/*************************************************************************************************************************
+ Class implementation for FunctionCallNode
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_functioncallnode_getinputfunctionid(Lib3MF_FunctionCallNode pFunctionCallNode, Lib3MF_ImplicitPort * pFunction)
 {
-	IBase* pIBaseClass = (IBase *)pConstMatNode;
+	IBase* pIBaseClass = (IBase *)pFunctionCallNode;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pConstMatNode, "ConstMatNode", "GetMatrix");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionCallNode, "FunctionCallNode", "GetInputFunctionID");
 		}
-		if (pValue == nullptr)
-		throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IConstMatNode* pIConstMatNode = dynamic_cast<IConstMatNode*>(pIBaseClass);
-		if (!pIConstMatNode)
+		if (pFunction == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseFunction(nullptr);
+		IFunctionCallNode* pIFunctionCallNode = dynamic_cast<IFunctionCallNode*>(pIBaseClass);
+		if (!pIFunctionCallNode)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		*pValue = pIConstMatNode->GetMatrix();
+		pBaseFunction = pIFunctionCallNode->GetInputFunctionID();
 
+		*pFunction = (IBase*)(pBaseFunction);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Function", *pFunction);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13885,27 +14970,31 @@ Lib3MFResult lib3mf_constmatnode_getmatrix(Lib3MF_ConstMatNode pConstMatNode, sL
 	}
 }
 
-Lib3MFResult lib3mf_constmatnode_getoutputmatrix(Lib3MF_ConstMatNode pConstMatNode, Lib3MF_ImplicitPort * pMatrix)
+
+/*************************************************************************************************************************
+ Class implementation for NodeIterator
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_nodeiterator_getcurrent(Lib3MF_NodeIterator pNodeIterator, Lib3MF_ImplicitNode * pNode)
 {
-	IBase* pIBaseClass = (IBase *)pConstMatNode;
+	IBase* pIBaseClass = (IBase *)pNodeIterator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pConstMatNode, "ConstMatNode", "GetOutputMatrix");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pNodeIterator, "NodeIterator", "GetCurrent");
 		}
-		if (pMatrix == nullptr)
+		if (pNode == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseMatrix(nullptr);
-		IConstMatNode* pIConstMatNode = dynamic_cast<IConstMatNode*>(pIBaseClass);
-		if (!pIConstMatNode)
+		IBase* pBaseNode(nullptr);
+		INodeIterator* pINodeIterator = dynamic_cast<INodeIterator*>(pIBaseClass);
+		if (!pINodeIterator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseMatrix = pIConstMatNode->GetOutputMatrix();
+		pBaseNode = pINodeIterator->GetCurrent();
 
-		*pMatrix = (IBase*)(pBaseMatrix);
+		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Matrix", *pMatrix);
+			pJournalEntry->addHandleResult("Node", *pNode);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13923,29 +15012,49 @@ Lib3MFResult lib3mf_constmatnode_getoutputmatrix(Lib3MF_ConstMatNode pConstMatNo
 
 
 /*************************************************************************************************************************
- Class implementation for MeshNode
+ Class implementation for Function
 **************************************************************************************************************************/
-Lib3MFResult lib3mf_meshnode_getinputmesh(Lib3MF_MeshNode pMeshNode, Lib3MF_ImplicitPort * pMesh)
+Lib3MFResult lib3mf_function_getdisplayname(Lib3MF_Function pFunction, const Lib3MF_uint32 nDisplayNameBufferSize, Lib3MF_uint32* pDisplayNameNeededChars, char * pDisplayNameBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pMeshNode;
+	IBase* pIBaseClass = (IBase *)pFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshNode, "MeshNode", "GetInputMesh");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "GetDisplayName");
 		}
-		if (pMesh == nullptr)
+		if ( (!pDisplayNameBuffer) && !(pDisplayNameNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseMesh(nullptr);
-		IMeshNode* pIMeshNode = dynamic_cast<IMeshNode*>(pIBaseClass);
-		if (!pIMeshNode)
+		std::string sDisplayName("");
+		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
+		if (!pIFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseMesh = pIMeshNode->GetInputMesh();
+		bool isCacheCall = (pDisplayNameBuffer == nullptr);
+		if (isCacheCall) {
+			sDisplayName = pIFunction->GetDisplayName();
 
-		*pMesh = (IBase*)(pBaseMesh);
+			pIFunction->_setCache (new ParameterCache_1<std::string> (sDisplayName));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIFunction->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sDisplayName);
+			pIFunction->_setCache (nullptr);
+		}
+		
+		if (pDisplayNameNeededChars)
+			*pDisplayNameNeededChars = (Lib3MF_uint32) (sDisplayName.size()+1);
+		if (pDisplayNameBuffer) {
+			if (sDisplayName.size() >= nDisplayNameBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iDisplayName = 0; iDisplayName < sDisplayName.size(); iDisplayName++)
+				pDisplayNameBuffer[iDisplayName] = sDisplayName[iDisplayName];
+			pDisplayNameBuffer[sDisplayName.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Mesh", *pMesh);
+			pJournalEntry->addStringResult("DisplayName", sDisplayName.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13961,27 +15070,26 @@ Lib3MFResult lib3mf_meshnode_getinputmesh(Lib3MF_MeshNode pMeshNode, Lib3MF_Impl
 	}
 }
 
-Lib3MFResult lib3mf_meshnode_getinputpos(Lib3MF_MeshNode pMeshNode, Lib3MF_ImplicitPort * pPos)
+Lib3MFResult lib3mf_function_setdisplayname(Lib3MF_Function pFunction, const char * pDisplayName)
 {
-	IBase* pIBaseClass = (IBase *)pMeshNode;
+	IBase* pIBaseClass = (IBase *)pFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshNode, "MeshNode", "GetInputPos");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "SetDisplayName");
+			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 		}
-		if (pPos == nullptr)
+		if (pDisplayName == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBasePos(nullptr);
-		IMeshNode* pIMeshNode = dynamic_cast<IMeshNode*>(pIBaseClass);
-		if (!pIMeshNode)
+		std::string sDisplayName(pDisplayName);
+		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
+		if (!pIFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBasePos = pIMeshNode->GetInputPos();
+		pIFunction->SetDisplayName(sDisplayName);
 
-		*pPos = (IBase*)(pBasePos);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Pos", *pPos);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -13997,27 +15105,36 @@ Lib3MFResult lib3mf_meshnode_getinputpos(Lib3MF_MeshNode pMeshNode, Lib3MF_Impli
 	}
 }
 
-Lib3MFResult lib3mf_meshnode_getoutputdistance(Lib3MF_MeshNode pMeshNode, Lib3MF_ImplicitPort * pDistance)
+Lib3MFResult lib3mf_function_addinput(Lib3MF_Function pFunction, const char * pIdentifier, const char * pDisplayName, eLib3MFImplicitPortType eType, Lib3MF_ImplicitPort * pPort)
 {
-	IBase* pIBaseClass = (IBase *)pMeshNode;
+	IBase* pIBaseClass = (IBase *)pFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pMeshNode, "MeshNode", "GetOutputDistance");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "AddInput");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
+			pJournalEntry->addEnumParameter("Type", "ImplicitPortType", (Lib3MF_int32)(eType));
 		}
-		if (pDistance == nullptr)
+		if (pIdentifier == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseDistance(nullptr);
-		IMeshNode* pIMeshNode = dynamic_cast<IMeshNode*>(pIBaseClass);
-		if (!pIMeshNode)
+		if (pDisplayName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pPort == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		std::string sDisplayName(pDisplayName);
+		IBase* pBasePort(nullptr);
+		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
+		if (!pIFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseDistance = pIMeshNode->GetOutputDistance();
+		pBasePort = pIFunction->AddInput(sIdentifier, sDisplayName, eType);
 
-		*pDistance = (IBase*)(pBaseDistance);
+		*pPort = (IBase*)(pBasePort);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Distance", *pDistance);
+			pJournalEntry->addHandleResult("Port", *pPort);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -14033,31 +15150,27 @@ Lib3MFResult lib3mf_meshnode_getoutputdistance(Lib3MF_MeshNode pMeshNode, Lib3MF
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for UnsignedMeshNode
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_unsignedmeshnode_getinputmesh(Lib3MF_UnsignedMeshNode pUnsignedMeshNode, Lib3MF_ImplicitPort * pMesh)
+Lib3MFResult lib3mf_function_getinputs(Lib3MF_Function pFunction, Lib3MF_ImplicitPortIterator * pIterator)
 {
-	IBase* pIBaseClass = (IBase *)pUnsignedMeshNode;
+	IBase* pIBaseClass = (IBase *)pFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pUnsignedMeshNode, "UnsignedMeshNode", "GetInputMesh");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "GetInputs");
 		}
-		if (pMesh == nullptr)
+		if (pIterator == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseMesh(nullptr);
-		IUnsignedMeshNode* pIUnsignedMeshNode = dynamic_cast<IUnsignedMeshNode*>(pIBaseClass);
-		if (!pIUnsignedMeshNode)
+		IBase* pBaseIterator(nullptr);
+		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
+		if (!pIFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseMesh = pIUnsignedMeshNode->GetInputMesh();
+		pBaseIterator = pIFunction->GetInputs();
 
-		*pMesh = (IBase*)(pBaseMesh);
+		*pIterator = (IBase*)(pBaseIterator);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Mesh", *pMesh);
+			pJournalEntry->addHandleResult("Iterator", *pIterator);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -14073,27 +15186,28 @@ Lib3MFResult lib3mf_unsignedmeshnode_getinputmesh(Lib3MF_UnsignedMeshNode pUnsig
 	}
 }
 
-Lib3MFResult lib3mf_unsignedmeshnode_getinputpos(Lib3MF_UnsignedMeshNode pUnsignedMeshNode, Lib3MF_ImplicitPort * pPos)
+Lib3MFResult lib3mf_function_removeinput(Lib3MF_Function pFunction, Lib3MF_ImplicitPort pInput)
 {
-	IBase* pIBaseClass = (IBase *)pUnsignedMeshNode;
+	IBase* pIBaseClass = (IBase *)pFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pUnsignedMeshNode, "UnsignedMeshNode", "GetInputPos");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "RemoveInput");
+			pJournalEntry->addHandleParameter("Input", pInput);
 		}
-		if (pPos == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBasePos(nullptr);
-		IUnsignedMeshNode* pIUnsignedMeshNode = dynamic_cast<IUnsignedMeshNode*>(pIBaseClass);
-		if (!pIUnsignedMeshNode)
+		IBase* pIBaseClassInput = (IBase *)pInput;
+		IImplicitPort* pIInput = dynamic_cast<IImplicitPort*>(pIBaseClassInput);
+		if (!pIInput)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
+		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
+		if (!pIFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBasePos = pIUnsignedMeshNode->GetInputPos();
+		pIFunction->RemoveInput(pIInput);
 
-		*pPos = (IBase*)(pBasePos);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Pos", *pPos);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -14109,27 +15223,36 @@ Lib3MFResult lib3mf_unsignedmeshnode_getinputpos(Lib3MF_UnsignedMeshNode pUnsign
 	}
 }
 
-Lib3MFResult lib3mf_unsignedmeshnode_getoutputdistance(Lib3MF_UnsignedMeshNode pUnsignedMeshNode, Lib3MF_ImplicitPort * pDistance)
+Lib3MFResult lib3mf_function_addoutput(Lib3MF_Function pFunction, const char * pIdentifier, const char * pDisplayName, eLib3MFImplicitPortType eType, Lib3MF_ImplicitPort * pPort)
 {
-	IBase* pIBaseClass = (IBase *)pUnsignedMeshNode;
+	IBase* pIBaseClass = (IBase *)pFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pUnsignedMeshNode, "UnsignedMeshNode", "GetOutputDistance");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "AddOutput");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
+			pJournalEntry->addEnumParameter("Type", "ImplicitPortType", (Lib3MF_int32)(eType));
 		}
-		if (pDistance == nullptr)
+		if (pIdentifier == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseDistance(nullptr);
-		IUnsignedMeshNode* pIUnsignedMeshNode = dynamic_cast<IUnsignedMeshNode*>(pIBaseClass);
-		if (!pIUnsignedMeshNode)
+		if (pDisplayName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pPort == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		std::string sDisplayName(pDisplayName);
+		IBase* pBasePort(nullptr);
+		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
+		if (!pIFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseDistance = pIUnsignedMeshNode->GetOutputDistance();
+		pBasePort = pIFunction->AddOutput(sIdentifier, sDisplayName, eType);
 
-		*pDistance = (IBase*)(pBaseDistance);
+		*pPort = (IBase*)(pBasePort);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Distance", *pDistance);
+			pJournalEntry->addHandleResult("Port", *pPort);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -14145,31 +15268,27 @@ Lib3MFResult lib3mf_unsignedmeshnode_getoutputdistance(Lib3MF_UnsignedMeshNode p
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for FunctionCallNode
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_functioncallnode_getinputfunctionid(Lib3MF_FunctionCallNode pFunctionCallNode, Lib3MF_ImplicitPort * pFunction)
+Lib3MFResult lib3mf_function_getoutputs(Lib3MF_Function pFunction, Lib3MF_ImplicitPortIterator * pIterator)
 {
-	IBase* pIBaseClass = (IBase *)pFunctionCallNode;
+	IBase* pIBaseClass = (IBase *)pFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionCallNode, "FunctionCallNode", "GetInputFunctionID");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "GetOutputs");
 		}
-		if (pFunction == nullptr)
+		if (pIterator == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseFunction(nullptr);
-		IFunctionCallNode* pIFunctionCallNode = dynamic_cast<IFunctionCallNode*>(pIBaseClass);
-		if (!pIFunctionCallNode)
+		IBase* pBaseIterator(nullptr);
+		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
+		if (!pIFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseFunction = pIFunctionCallNode->GetInputFunctionID();
+		pBaseIterator = pIFunction->GetOutputs();
 
-		*pFunction = (IBase*)(pBaseFunction);
+		*pIterator = (IBase*)(pBaseIterator);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Function", *pFunction);
+			pJournalEntry->addHandleResult("Iterator", *pIterator);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -14185,31 +15304,28 @@ Lib3MFResult lib3mf_functioncallnode_getinputfunctionid(Lib3MF_FunctionCallNode
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for NodeIterator
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_nodeiterator_getcurrent(Lib3MF_NodeIterator pNodeIterator, Lib3MF_ImplicitNode * pNode)
+Lib3MFResult lib3mf_function_removeoutput(Lib3MF_Function pFunction, Lib3MF_ImplicitPort pOutput)
 {
-	IBase* pIBaseClass = (IBase *)pNodeIterator;
+	IBase* pIBaseClass = (IBase *)pFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pNodeIterator, "NodeIterator", "GetCurrent");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "RemoveOutput");
+			pJournalEntry->addHandleParameter("Output", pOutput);
 		}
-		if (pNode == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseNode(nullptr);
-		INodeIterator* pINodeIterator = dynamic_cast<INodeIterator*>(pIBaseClass);
-		if (!pINodeIterator)
+		IBase* pIBaseClassOutput = (IBase *)pOutput;
+		IImplicitPort* pIOutput = dynamic_cast<IImplicitPort*>(pIBaseClassOutput);
+		if (!pIOutput)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
+		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
+		if (!pIFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pINodeIterator->GetCurrent();
+		pIFunction->RemoveOutput(pIOutput);
 
-		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Node", *pNode);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -14225,51 +15341,31 @@ Lib3MFResult lib3mf_nodeiterator_getcurrent(Lib3MF_NodeIterator pNodeIterator, L
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for Function
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_function_getdisplayname(Lib3MF_Function pFunction, const Lib3MF_uint32 nDisplayNameBufferSize, Lib3MF_uint32* pDisplayNameNeededChars, char * pDisplayNameBuffer)
+Lib3MFResult lib3mf_function_findinput(Lib3MF_Function pFunction, const char * pIdentifier, Lib3MF_ImplicitPort * pInput)
 {
 	IBase* pIBaseClass = (IBase *)pFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "GetDisplayName");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "FindInput");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 		}
-		if ( (!pDisplayNameBuffer) && !(pDisplayNameNeededChars) )
+		if (pIdentifier == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sDisplayName("");
+		if (pInput == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		IBase* pBaseInput(nullptr);
 		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
 		if (!pIFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		bool isCacheCall = (pDisplayNameBuffer == nullptr);
-		if (isCacheCall) {
-			sDisplayName = pIFunction->GetDisplayName();
+		pBaseInput = pIFunction->FindInput(sIdentifier);
 
-			pIFunction->_setCache (new ParameterCache_1<std::string> (sDisplayName));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIFunction->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sDisplayName);
-			pIFunction->_setCache (nullptr);
-		}
-		
-		if (pDisplayNameNeededChars)
-			*pDisplayNameNeededChars = (Lib3MF_uint32) (sDisplayName.size()+1);
-		if (pDisplayNameBuffer) {
-			if (sDisplayName.size() >= nDisplayNameBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iDisplayName = 0; iDisplayName < sDisplayName.size(); iDisplayName++)
-				pDisplayNameBuffer[iDisplayName] = sDisplayName[iDisplayName];
-			pDisplayNameBuffer[sDisplayName.size()] = 0;
-		}
+		*pInput = (IBase*)(pBaseInput);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("DisplayName", sDisplayName.c_str());
+			pJournalEntry->addHandleResult("Input", *pInput);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -14285,26 +15381,31 @@ Lib3MFResult lib3mf_function_getdisplayname(Lib3MF_Function pFunction, const Lib
 	}
 }
 
-Lib3MFResult lib3mf_function_setdisplayname(Lib3MF_Function pFunction, const char * pDisplayName)
+Lib3MFResult lib3mf_function_findoutput(Lib3MF_Function pFunction, const char * pIdentifier, Lib3MF_ImplicitPort * pOutput)
 {
 	IBase* pIBaseClass = (IBase *)pFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "SetDisplayName");
-			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "FindOutput");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 		}
-		if (pDisplayName == nullptr)
+		if (pIdentifier == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sDisplayName(pDisplayName);
+		if (pOutput == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		IBase* pBaseOutput(nullptr);
 		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
 		if (!pIFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIFunction->SetDisplayName(sDisplayName);
+		pBaseOutput = pIFunction->FindOutput(sIdentifier);
 
+		*pOutput = (IBase*)(pBaseOutput);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Output", *pOutput);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -14320,36 +15421,51 @@ Lib3MFResult lib3mf_function_setdisplayname(Lib3MF_Function pFunction, const cha
 	}
 }
 
-Lib3MFResult lib3mf_function_addinput(Lib3MF_Function pFunction, const char * pIdentifier, const char * pDisplayName, eLib3MFImplicitPortType eType, Lib3MF_ImplicitPort * pPort)
+
+/*************************************************************************************************************************
+ Class implementation for ImplicitFunction
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_implicitfunction_getidentifier(Lib3MF_ImplicitFunction pImplicitFunction, const Lib3MF_uint32 nIdentifierBufferSize, Lib3MF_uint32* pIdentifierNeededChars, char * pIdentifierBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pFunction;
+	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "AddInput");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
-			pJournalEntry->addEnumParameter("Type", "ImplicitPortType", (Lib3MF_int32)(eType));
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "GetIdentifier");
 		}
-		if (pIdentifier == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pDisplayName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pPort == nullptr)
+		if ( (!pIdentifierBuffer) && !(pIdentifierNeededChars) )
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		std::string sDisplayName(pDisplayName);
-		IBase* pBasePort(nullptr);
-		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
-		if (!pIFunction)
+		std::string sIdentifier("");
+		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
+		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBasePort = pIFunction->AddInput(sIdentifier, sDisplayName, eType);
+		bool isCacheCall = (pIdentifierBuffer == nullptr);
+		if (isCacheCall) {
+			sIdentifier = pIImplicitFunction->GetIdentifier();
 
-		*pPort = (IBase*)(pBasePort);
+			pIImplicitFunction->_setCache (new ParameterCache_1<std::string> (sIdentifier));
+		}
+		else {
+			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIImplicitFunction->_getCache ());
+			if (cache == nullptr)
+				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+			cache->retrieveData (sIdentifier);
+			pIImplicitFunction->_setCache (nullptr);
+		}
+		
+		if (pIdentifierNeededChars)
+			*pIdentifierNeededChars = (Lib3MF_uint32) (sIdentifier.size()+1);
+		if (pIdentifierBuffer) {
+			if (sIdentifier.size() >= nIdentifierBufferSize)
+				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
+			for (size_t iIdentifier = 0; iIdentifier < sIdentifier.size(); iIdentifier++)
+				pIdentifierBuffer[iIdentifier] = sIdentifier[iIdentifier];
+			pIdentifierBuffer[sIdentifier.size()] = 0;
+		}
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Port", *pPort);
+			pJournalEntry->addStringResult("Identifier", sIdentifier.c_str());
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -14365,27 +15481,26 @@ Lib3MFResult lib3mf_function_addinput(Lib3MF_Function pFunction, const char * pI
 	}
 }
 
-Lib3MFResult lib3mf_function_getinputs(Lib3MF_Function pFunction, Lib3MF_ImplicitPortIterator * pIterator)
+Lib3MFResult lib3mf_implicitfunction_setidentifier(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier)
 {
-	IBase* pIBaseClass = (IBase *)pFunction;
+	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "GetInputs");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "SetIdentifier");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 		}
-		if (pIterator == nullptr)
+		if (pIdentifier == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseIterator(nullptr);
-		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
-		if (!pIFunction)
+		std::string sIdentifier(pIdentifier);
+		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
+		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseIterator = pIFunction->GetInputs();
+		pIImplicitFunction->SetIdentifier(sIdentifier);
 
-		*pIterator = (IBase*)(pBaseIterator);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Iterator", *pIterator);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -14401,28 +15516,41 @@ Lib3MFResult lib3mf_function_getinputs(Lib3MF_Function pFunction, Lib3MF_Implici
 	}
 }
 
-Lib3MFResult lib3mf_function_removeinput(Lib3MF_Function pFunction, Lib3MF_ImplicitPort pInput)
+Lib3MFResult lib3mf_implicitfunction_addnode(Lib3MF_ImplicitFunction pImplicitFunction, eLib3MFImplicitNodeType eNodeType, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_ImplicitNode * pNode)
 {
-	IBase* pIBaseClass = (IBase *)pFunction;
+	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "RemoveInput");
-			pJournalEntry->addHandleParameter("Input", pInput);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddNode");
+			pJournalEntry->addEnumParameter("NodeType", "ImplicitNodeType", (Lib3MF_int32)(eNodeType));
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
+			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
+			pJournalEntry->addStringParameter("Tag", pTag);
 		}
-		IBase* pIBaseClassInput = (IBase *)pInput;
-		IImplicitPort* pIInput = dynamic_cast<IImplicitPort*>(pIBaseClassInput);
-		if (!pIInput)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
-		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
-		if (!pIFunction)
+		if (pIdentifier == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pDisplayName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pTag == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pNode == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		std::string sDisplayName(pDisplayName);
+		std::string sTag(pTag);
+		IBase* pBaseNode(nullptr);
+		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
+		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIFunction->RemoveInput(pIInput);
+		pBaseNode = pIImplicitFunction->AddNode(eNodeType, sIdentifier, eConfiguration, sDisplayName, sTag);
 
+		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Node", *pNode);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -14438,36 +15566,40 @@ Lib3MFResult lib3mf_function_removeinput(Lib3MF_Function pFunction, Lib3MF_Impli
 	}
 }
 
-Lib3MFResult lib3mf_function_addoutput(Lib3MF_Function pFunction, const char * pIdentifier, const char * pDisplayName, eLib3MFImplicitPortType eType, Lib3MF_ImplicitPort * pPort)
+Lib3MFResult lib3mf_implicitfunction_addsinnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_SinNode * pNode)
 {
-	IBase* pIBaseClass = (IBase *)pFunction;
+	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "AddOutput");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddSinNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
-			pJournalEntry->addEnumParameter("Type", "ImplicitPortType", (Lib3MF_int32)(eType));
+			pJournalEntry->addStringParameter("Tag", pTag);
 		}
 		if (pIdentifier == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		if (pDisplayName == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pPort == nullptr)
+		if (pTag == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pNode == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		std::string sIdentifier(pIdentifier);
 		std::string sDisplayName(pDisplayName);
-		IBase* pBasePort(nullptr);
-		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
-		if (!pIFunction)
+		std::string sTag(pTag);
+		IBase* pBaseNode(nullptr);
+		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
+		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBasePort = pIFunction->AddOutput(sIdentifier, sDisplayName, eType);
+		pBaseNode = pIImplicitFunction->AddSinNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
-		*pPort = (IBase*)(pBasePort);
+		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Port", *pPort);
+			pJournalEntry->addHandleResult("Node", *pNode);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -14483,27 +15615,40 @@ Lib3MFResult lib3mf_function_addoutput(Lib3MF_Function pFunction, const char * p
 	}
 }
 
-Lib3MFResult lib3mf_function_getoutputs(Lib3MF_Function pFunction, Lib3MF_ImplicitPortIterator * pIterator)
+Lib3MFResult lib3mf_implicitfunction_addcosnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_CosNode * pNode)
 {
-	IBase* pIBaseClass = (IBase *)pFunction;
+	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "GetOutputs");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddCosNode");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
+			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
+			pJournalEntry->addStringParameter("Tag", pTag);
 		}
-		if (pIterator == nullptr)
+		if (pIdentifier == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseIterator(nullptr);
-		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
-		if (!pIFunction)
+		if (pDisplayName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pTag == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pNode == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		std::string sDisplayName(pDisplayName);
+		std::string sTag(pTag);
+		IBase* pBaseNode(nullptr);
+		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
+		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseIterator = pIFunction->GetOutputs();
+		pBaseNode = pIImplicitFunction->AddCosNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
-		*pIterator = (IBase*)(pBaseIterator);
+		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Iterator", *pIterator);
+			pJournalEntry->addHandleResult("Node", *pNode);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -14519,28 +15664,40 @@ Lib3MFResult lib3mf_function_getoutputs(Lib3MF_Function pFunction, Lib3MF_Implic
 	}
 }
 
-Lib3MFResult lib3mf_function_removeoutput(Lib3MF_Function pFunction, Lib3MF_ImplicitPort pOutput)
+Lib3MFResult lib3mf_implicitfunction_addtannode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_TanNode * pNode)
 {
-	IBase* pIBaseClass = (IBase *)pFunction;
+	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "RemoveOutput");
-			pJournalEntry->addHandleParameter("Output", pOutput);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddTanNode");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
+			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
+			pJournalEntry->addStringParameter("Tag", pTag);
 		}
-		IBase* pIBaseClassOutput = (IBase *)pOutput;
-		IImplicitPort* pIOutput = dynamic_cast<IImplicitPort*>(pIBaseClassOutput);
-		if (!pIOutput)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
-		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
-		if (!pIFunction)
+		if (pIdentifier == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pDisplayName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pTag == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pNode == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		std::string sDisplayName(pDisplayName);
+		std::string sTag(pTag);
+		IBase* pBaseNode(nullptr);
+		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
+		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIFunction->RemoveOutput(pIOutput);
+		pBaseNode = pIImplicitFunction->AddTanNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
+		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Node", *pNode);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -14556,31 +15713,40 @@ Lib3MFResult lib3mf_function_removeoutput(Lib3MF_Function pFunction, Lib3MF_Impl
 	}
 }
 
-Lib3MFResult lib3mf_function_findinput(Lib3MF_Function pFunction, const char * pIdentifier, Lib3MF_ImplicitPort * pInput)
+Lib3MFResult lib3mf_implicitfunction_addarcsinnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_ArcSinNode * pNode)
 {
-	IBase* pIBaseClass = (IBase *)pFunction;
+	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "FindInput");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddArcSinNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
+			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
+			pJournalEntry->addStringParameter("Tag", pTag);
 		}
 		if (pIdentifier == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pInput == nullptr)
+		if (pDisplayName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pTag == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pNode == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		std::string sIdentifier(pIdentifier);
-		IBase* pBaseInput(nullptr);
-		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
-		if (!pIFunction)
+		std::string sDisplayName(pDisplayName);
+		std::string sTag(pTag);
+		IBase* pBaseNode(nullptr);
+		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
+		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseInput = pIFunction->FindInput(sIdentifier);
+		pBaseNode = pIImplicitFunction->AddArcSinNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
-		*pInput = (IBase*)(pBaseInput);
+		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Input", *pInput);
+			pJournalEntry->addHandleResult("Node", *pNode);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -14596,31 +15762,40 @@ Lib3MFResult lib3mf_function_findinput(Lib3MF_Function pFunction, const char * p
 	}
 }
 
-Lib3MFResult lib3mf_function_findoutput(Lib3MF_Function pFunction, const char * pIdentifier, Lib3MF_ImplicitPort * pOutput)
+Lib3MFResult lib3mf_implicitfunction_addarccosnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_ArcCosNode * pNode)
 {
-	IBase* pIBaseClass = (IBase *)pFunction;
+	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunction, "Function", "FindOutput");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddArcCosNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
+			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
+			pJournalEntry->addStringParameter("Tag", pTag);
 		}
 		if (pIdentifier == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pOutput == nullptr)
+		if (pDisplayName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pTag == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pNode == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		std::string sIdentifier(pIdentifier);
-		IBase* pBaseOutput(nullptr);
-		IFunction* pIFunction = dynamic_cast<IFunction*>(pIBaseClass);
-		if (!pIFunction)
+		std::string sDisplayName(pDisplayName);
+		std::string sTag(pTag);
+		IBase* pBaseNode(nullptr);
+		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
+		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseOutput = pIFunction->FindOutput(sIdentifier);
+		pBaseNode = pIImplicitFunction->AddArcCosNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
-		*pOutput = (IBase*)(pBaseOutput);
+		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Output", *pOutput);
+			pJournalEntry->addHandleResult("Node", *pNode);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -14636,51 +15811,40 @@ Lib3MFResult lib3mf_function_findoutput(Lib3MF_Function pFunction, const char *
 	}
 }
 
-
-/*************************************************************************************************************************
- Class implementation for ImplicitFunction
-**************************************************************************************************************************/
-Lib3MFResult lib3mf_implicitfunction_getidentifier(Lib3MF_ImplicitFunction pImplicitFunction, const Lib3MF_uint32 nIdentifierBufferSize, Lib3MF_uint32* pIdentifierNeededChars, char * pIdentifierBuffer)
+Lib3MFResult lib3mf_implicitfunction_addarctan2node(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_ArcTan2Node * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "GetIdentifier");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddArcTan2Node");
+			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
+			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
+			pJournalEntry->addStringParameter("Tag", pTag);
 		}
-		if ( (!pIdentifierBuffer) && !(pIdentifierNeededChars) )
+		if (pIdentifier == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier("");
-		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
-		if (!pIImplicitFunction)
-			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-		
-		bool isCacheCall = (pIdentifierBuffer == nullptr);
-		if (isCacheCall) {
-			sIdentifier = pIImplicitFunction->GetIdentifier();
-
-			pIImplicitFunction->_setCache (new ParameterCache_1<std::string> (sIdentifier));
-		}
-		else {
-			auto cache = dynamic_cast<ParameterCache_1<std::string>*> (pIImplicitFunction->_getCache ());
-			if (cache == nullptr)
-				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
-			cache->retrieveData (sIdentifier);
-			pIImplicitFunction->_setCache (nullptr);
-		}
-		
-		if (pIdentifierNeededChars)
-			*pIdentifierNeededChars = (Lib3MF_uint32) (sIdentifier.size()+1);
-		if (pIdentifierBuffer) {
-			if (sIdentifier.size() >= nIdentifierBufferSize)
-				throw ELib3MFInterfaceException (LIB3MF_ERROR_BUFFERTOOSMALL);
-			for (size_t iIdentifier = 0; iIdentifier < sIdentifier.size(); iIdentifier++)
-				pIdentifierBuffer[iIdentifier] = sIdentifier[iIdentifier];
-			pIdentifierBuffer[sIdentifier.size()] = 0;
-		}
+		if (pDisplayName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pTag == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pNode == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sIdentifier(pIdentifier);
+		std::string sDisplayName(pDisplayName);
+		std::string sTag(pTag);
+		IBase* pBaseNode(nullptr);
+		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
+		if (!pIImplicitFunction)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseNode = pIImplicitFunction->AddArcTan2Node(sIdentifier, eConfiguration, sDisplayName, sTag);
+
+		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addStringResult("Identifier", sIdentifier.c_str());
+			pJournalEntry->addHandleResult("Node", *pNode);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -14696,26 +15860,40 @@ Lib3MFResult lib3mf_implicitfunction_getidentifier(Lib3MF_ImplicitFunction pImpl
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_setidentifier(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier)
+Lib3MFResult lib3mf_implicitfunction_addsinhnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_SinhNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "SetIdentifier");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddSinhNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
+			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
+			pJournalEntry->addStringParameter("Tag", pTag);
 		}
 		if (pIdentifier == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pDisplayName == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pTag == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pNode == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
 		std::string sIdentifier(pIdentifier);
+		std::string sDisplayName(pDisplayName);
+		std::string sTag(pTag);
+		IBase* pBaseNode(nullptr);
 		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIImplicitFunction->SetIdentifier(sIdentifier);
+		pBaseNode = pIImplicitFunction->AddSinhNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
+		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Node", *pNode);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -14731,15 +15909,14 @@ Lib3MFResult lib3mf_implicitfunction_setidentifier(Lib3MF_ImplicitFunction pImpl
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addnode(Lib3MF_ImplicitFunction pImplicitFunction, eLib3MFImplicitNodeType eNodeType, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_ImplicitNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addcoshnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_CoshNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddNode");
-			pJournalEntry->addEnumParameter("NodeType", "ImplicitNodeType", (Lib3MF_int32)(eNodeType));
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddCoshNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -14761,7 +15938,7 @@ Lib3MFResult lib3mf_implicitfunction_addnode(Lib3MF_ImplicitFunction pImplicitFu
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddNode(eNodeType, sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddCoshNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -14781,14 +15958,14 @@ Lib3MFResult lib3mf_implicitfunction_addnode(Lib3MF_ImplicitFunction pImplicitFu
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addsinnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_SinNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addtanhnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_TanhNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddSinNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddTanhNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -14810,7 +15987,7 @@ Lib3MFResult lib3mf_implicitfunction_addsinnode(Lib3MF_ImplicitFunction pImplici
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddSinNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddTanhNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -14830,14 +16007,14 @@ Lib3MFResult lib3mf_implicitfunction_addsinnode(Lib3MF_ImplicitFunction pImplici
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addcosnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_CosNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addroundnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_RoundNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddCosNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddRoundNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -14859,7 +16036,7 @@ Lib3MFResult lib3mf_implicitfunction_addcosnode(Lib3MF_ImplicitFunction pImplici
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddCosNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddRoundNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -14879,14 +16056,14 @@ Lib3MFResult lib3mf_implicitfunction_addcosnode(Lib3MF_ImplicitFunction pImplici
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addtannode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_TanNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addceilnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_CeilNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddTanNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddCeilNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -14908,7 +16085,7 @@ Lib3MFResult lib3mf_implicitfunction_addtannode(Lib3MF_ImplicitFunction pImplici
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddTanNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddCeilNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -14928,14 +16105,14 @@ Lib3MFResult lib3mf_implicitfunction_addtannode(Lib3MF_ImplicitFunction pImplici
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addarcsinnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_ArcSinNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addfloornode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_FloorNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddArcSinNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddFloorNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -14957,7 +16134,7 @@ Lib3MFResult lib3mf_implicitfunction_addarcsinnode(Lib3MF_ImplicitFunction pImpl
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddArcSinNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddFloorNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -14977,14 +16154,14 @@ Lib3MFResult lib3mf_implicitfunction_addarcsinnode(Lib3MF_ImplicitFunction pImpl
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addarccosnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_ArcCosNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addsignnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_SignNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddArcCosNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddSignNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -15006,7 +16183,7 @@ Lib3MFResult lib3mf_implicitfunction_addarccosnode(Lib3MF_ImplicitFunction pImpl
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddArcCosNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddSignNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15026,14 +16203,14 @@ Lib3MFResult lib3mf_implicitfunction_addarccosnode(Lib3MF_ImplicitFunction pImpl
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addarctan2node(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_ArcTan2Node * pNode)
+Lib3MFResult lib3mf_implicitfunction_addfractnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_FractNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddArcTan2Node");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddFractNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -15055,7 +16232,7 @@ Lib3MFResult lib3mf_implicitfunction_addarctan2node(Lib3MF_ImplicitFunction pImp
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddArcTan2Node(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddFractNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15075,14 +16252,14 @@ Lib3MFResult lib3mf_implicitfunction_addarctan2node(Lib3MF_ImplicitFunction pImp
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addsinhnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_SinhNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addabsnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_AbsNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddSinhNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddAbsNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -15104,7 +16281,7 @@ Lib3MFResult lib3mf_implicitfunction_addsinhnode(Lib3MF_ImplicitFunction pImplic
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddSinhNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddAbsNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15124,14 +16301,14 @@ Lib3MFResult lib3mf_implicitfunction_addsinhnode(Lib3MF_ImplicitFunction pImplic
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addcoshnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_CoshNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addexpnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_ExpNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddCoshNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddExpNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -15153,7 +16330,7 @@ Lib3MFResult lib3mf_implicitfunction_addcoshnode(Lib3MF_ImplicitFunction pImplic
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddCoshNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddExpNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15173,14 +16350,14 @@ Lib3MFResult lib3mf_implicitfunction_addcoshnode(Lib3MF_ImplicitFunction pImplic
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addtanhnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_TanhNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addlognode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_LogNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddTanhNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddLogNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -15202,7 +16379,7 @@ Lib3MFResult lib3mf_implicitfunction_addtanhnode(Lib3MF_ImplicitFunction pImplic
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddTanhNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddLogNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15222,14 +16399,14 @@ Lib3MFResult lib3mf_implicitfunction_addtanhnode(Lib3MF_ImplicitFunction pImplic
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addroundnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_RoundNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addlog2node(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_Log2Node * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddRoundNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddLog2Node");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -15251,7 +16428,7 @@ Lib3MFResult lib3mf_implicitfunction_addroundnode(Lib3MF_ImplicitFunction pImpli
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddRoundNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddLog2Node(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15271,14 +16448,14 @@ Lib3MFResult lib3mf_implicitfunction_addroundnode(Lib3MF_ImplicitFunction pImpli
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addceilnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_CeilNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addlog10node(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_Log10Node * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddCeilNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddLog10Node");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -15300,7 +16477,7 @@ Lib3MFResult lib3mf_implicitfunction_addceilnode(Lib3MF_ImplicitFunction pImplic
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddCeilNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddLog10Node(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15320,16 +16497,15 @@ Lib3MFResult lib3mf_implicitfunction_addceilnode(Lib3MF_ImplicitFunction pImplic
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addfloornode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_FloorNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addlengthnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_LengthNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddFloorNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddLengthNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
 		}
@@ -15349,7 +16525,7 @@ Lib3MFResult lib3mf_implicitfunction_addfloornode(Lib3MF_ImplicitFunction pImpli
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddFloorNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddLengthNode(sIdentifier, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15369,14 +16545,14 @@ Lib3MFResult lib3mf_implicitfunction_addfloornode(Lib3MF_ImplicitFunction pImpli
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addsignnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_SignNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addtransposenode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_TransposeNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddSignNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddTransposeNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -15398,7 +16574,7 @@ Lib3MFResult lib3mf_implicitfunction_addsignnode(Lib3MF_ImplicitFunction pImplic
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddSignNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddTransposeNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15418,16 +16594,15 @@ Lib3MFResult lib3mf_implicitfunction_addsignnode(Lib3MF_ImplicitFunction pImplic
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addfractnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_FractNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addinversenode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_InverseNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddFractNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddInverseNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
 		}
@@ -15447,7 +16622,7 @@ Lib3MFResult lib3mf_implicitfunction_addfractnode(Lib3MF_ImplicitFunction pImpli
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddFractNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddInverseNode(sIdentifier, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15467,14 +16642,14 @@ Lib3MFResult lib3mf_implicitfunction_addfractnode(Lib3MF_ImplicitFunction pImpli
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addabsnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_AbsNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addsqrtnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_SqrtNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddAbsNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddSqrtNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -15496,7 +16671,7 @@ Lib3MFResult lib3mf_implicitfunction_addabsnode(Lib3MF_ImplicitFunction pImplici
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddAbsNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddSqrtNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15516,16 +16691,15 @@ Lib3MFResult lib3mf_implicitfunction_addabsnode(Lib3MF_ImplicitFunction pImplici
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addexpnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_ExpNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addresourceidnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_ResourceIdNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddExpNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddResourceIdNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
 		}
@@ -15545,7 +16719,7 @@ Lib3MFResult lib3mf_implicitfunction_addexpnode(Lib3MF_ImplicitFunction pImplici
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddExpNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddResourceIdNode(sIdentifier, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15565,14 +16739,14 @@ Lib3MFResult lib3mf_implicitfunction_addexpnode(Lib3MF_ImplicitFunction pImplici
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addlognode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_LogNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addadditionnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_AdditionNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddLogNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddAdditionNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -15594,7 +16768,7 @@ Lib3MFResult lib3mf_implicitfunction_addlognode(Lib3MF_ImplicitFunction pImplici
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddLogNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddAdditionNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15614,14 +16788,14 @@ Lib3MFResult lib3mf_implicitfunction_addlognode(Lib3MF_ImplicitFunction pImplici
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addlog2node(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_Log2Node * pNode)
+Lib3MFResult lib3mf_implicitfunction_addsubtractionnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_SubtractionNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddLog2Node");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddSubtractionNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -15643,7 +16817,7 @@ Lib3MFResult lib3mf_implicitfunction_addlog2node(Lib3MF_ImplicitFunction pImplic
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddLog2Node(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddSubtractionNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15663,14 +16837,14 @@ Lib3MFResult lib3mf_implicitfunction_addlog2node(Lib3MF_ImplicitFunction pImplic
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addlog10node(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_Log10Node * pNode)
+Lib3MFResult lib3mf_implicitfunction_addmultiplicationnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_MultiplicationNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddLog10Node");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddMultiplicationNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -15692,7 +16866,7 @@ Lib3MFResult lib3mf_implicitfunction_addlog10node(Lib3MF_ImplicitFunction pImpli
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddLog10Node(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddMultiplicationNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15712,15 +16886,16 @@ Lib3MFResult lib3mf_implicitfunction_addlog10node(Lib3MF_ImplicitFunction pImpli
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addlengthnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_LengthNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_adddivisionnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_DivisionNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddLengthNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddDivisionNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
 		}
@@ -15740,7 +16915,7 @@ Lib3MFResult lib3mf_implicitfunction_addlengthnode(Lib3MF_ImplicitFunction pImpl
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddLengthNode(sIdentifier, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddDivisionNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15760,16 +16935,15 @@ Lib3MFResult lib3mf_implicitfunction_addlengthnode(Lib3MF_ImplicitFunction pImpl
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addtransposenode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_TransposeNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_adddotnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_DotNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddTransposeNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddDotNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
 		}
@@ -15789,7 +16963,7 @@ Lib3MFResult lib3mf_implicitfunction_addtransposenode(Lib3MF_ImplicitFunction pI
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddTransposeNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddDotNode(sIdentifier, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15809,14 +16983,14 @@ Lib3MFResult lib3mf_implicitfunction_addtransposenode(Lib3MF_ImplicitFunction pI
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addinversenode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_InverseNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addcrossnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_CrossNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddInverseNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddCrossNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
@@ -15837,7 +17011,7 @@ Lib3MFResult lib3mf_implicitfunction_addinversenode(Lib3MF_ImplicitFunction pImp
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddInverseNode(sIdentifier, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddCrossNode(sIdentifier, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15857,16 +17031,15 @@ Lib3MFResult lib3mf_implicitfunction_addinversenode(Lib3MF_ImplicitFunction pImp
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addsqrtnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_SqrtNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addmatvecmultiplicationnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_MatVecMultiplicationNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddSqrtNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddMatVecMultiplicationNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
 		}
@@ -15886,7 +17059,7 @@ Lib3MFResult lib3mf_implicitfunction_addsqrtnode(Lib3MF_ImplicitFunction pImplic
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddSqrtNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddMatVecMultiplicationNode(sIdentifier, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15906,15 +17079,16 @@ Lib3MFResult lib3mf_implicitfunction_addsqrtnode(Lib3MF_ImplicitFunction pImplic
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addresourceidnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_ResourceIdNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addminnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_MinNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddResourceIdNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddMinNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
 		}
@@ -15934,7 +17108,7 @@ Lib3MFResult lib3mf_implicitfunction_addresourceidnode(Lib3MF_ImplicitFunction p
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddResourceIdNode(sIdentifier, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddMinNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -15954,14 +17128,14 @@ Lib3MFResult lib3mf_implicitfunction_addresourceidnode(Lib3MF_ImplicitFunction p
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addadditionnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_AdditionNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addmaxnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_MaxNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddAdditionNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddMaxNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -15983,7 +17157,7 @@ Lib3MFResult lib3mf_implicitfunction_addadditionnode(Lib3MF_ImplicitFunction pIm
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddAdditionNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddMaxNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -16003,14 +17177,14 @@ Lib3MFResult lib3mf_implicitfunction_addadditionnode(Lib3MF_ImplicitFunction pIm
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addsubtractionnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_SubtractionNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addfmodnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_FmodNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddSubtractionNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddFmodNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -16032,7 +17206,7 @@ Lib3MFResult lib3mf_implicitfunction_addsubtractionnode(Lib3MF_ImplicitFunction
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddSubtractionNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddFmodNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -16052,14 +17226,14 @@ Lib3MFResult lib3mf_implicitfunction_addsubtractionnode(Lib3MF_ImplicitFunction
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addmultiplicationnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_MultiplicationNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addpownode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_PowNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddMultiplicationNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddPowNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -16081,7 +17255,7 @@ Lib3MFResult lib3mf_implicitfunction_addmultiplicationnode(Lib3MF_ImplicitFuncti
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddMultiplicationNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddPowNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -16101,14 +17275,14 @@ Lib3MFResult lib3mf_implicitfunction_addmultiplicationnode(Lib3MF_ImplicitFuncti
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_adddivisionnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_DivisionNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addselectnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_SelectNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddDivisionNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddSelectNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
@@ -16130,7 +17304,7 @@ Lib3MFResult lib3mf_implicitfunction_adddivisionnode(Lib3MF_ImplicitFunction pIm
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddDivisionNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddSelectNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -16150,15 +17324,16 @@ Lib3MFResult lib3mf_implicitfunction_adddivisionnode(Lib3MF_ImplicitFunction pIm
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_adddotnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_DotNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addclampnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_ClampNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddDotNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddClampNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
+			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
 		}
@@ -16178,7 +17353,7 @@ Lib3MFResult lib3mf_implicitfunction_adddotnode(Lib3MF_ImplicitFunction pImplici
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddDotNode(sIdentifier, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddClampNode(sIdentifier, eConfiguration, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -16198,14 +17373,14 @@ Lib3MFResult lib3mf_implicitfunction_adddotnode(Lib3MF_ImplicitFunction pImplici
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addcrossnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_CrossNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addcomposevectornode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_ComposeVectorNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddCrossNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddComposeVectorNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
@@ -16226,7 +17401,7 @@ Lib3MFResult lib3mf_implicitfunction_addcrossnode(Lib3MF_ImplicitFunction pImpli
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddCrossNode(sIdentifier, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddComposeVectorNode(sIdentifier, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -16246,14 +17421,14 @@ Lib3MFResult lib3mf_implicitfunction_addcrossnode(Lib3MF_ImplicitFunction pImpli
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addmatvecmultiplicationnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_MatVecMultiplicationNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addvectorfromscalarnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_VectorFromScalarNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddMatVecMultiplicationNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddVectorFromScalarNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
@@ -16274,7 +17449,7 @@ Lib3MFResult lib3mf_implicitfunction_addmatvecmultiplicationnode(Lib3MF_Implicit
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddMatVecMultiplicationNode(sIdentifier, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddVectorFromScalarNode(sIdentifier, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -16294,16 +17469,15 @@ Lib3MFResult lib3mf_implicitfunction_addmatvecmultiplicationnode(Lib3MF_Implicit
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addminnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_MinNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_adddecomposevectornode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_DecomposeVectorNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddMinNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddDecomposeVectorNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
 		}
@@ -16323,7 +17497,7 @@ Lib3MFResult lib3mf_implicitfunction_addminnode(Lib3MF_ImplicitFunction pImplici
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddMinNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddDecomposeVectorNode(sIdentifier, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -16343,16 +17517,15 @@ Lib3MFResult lib3mf_implicitfunction_addminnode(Lib3MF_ImplicitFunction pImplici
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addmaxnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_MaxNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addcomposematrixnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_ComposeMatrixNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddMaxNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddComposeMatrixNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
 		}
@@ -16372,7 +17545,7 @@ Lib3MFResult lib3mf_implicitfunction_addmaxnode(Lib3MF_ImplicitFunction pImplici
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddMaxNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddComposeMatrixNode(sIdentifier, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -16392,16 +17565,15 @@ Lib3MFResult lib3mf_implicitfunction_addmaxnode(Lib3MF_ImplicitFunction pImplici
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addfmodnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_FmodNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addmatrixfromrowsnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_MatrixFromRowsNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddFmodNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddMatrixFromRowsNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
 		}
@@ -16421,7 +17593,7 @@ Lib3MFResult lib3mf_implicitfunction_addfmodnode(Lib3MF_ImplicitFunction pImplic
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddFmodNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddMatrixFromRowsNode(sIdentifier, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -16441,16 +17613,15 @@ Lib3MFResult lib3mf_implicitfunction_addfmodnode(Lib3MF_ImplicitFunction pImplic
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addpownode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_PowNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addmatrixfromcolumnsnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_MatrixFromColumnsNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddPowNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddMatrixFromColumnsNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
 		}
@@ -16470,7 +17641,7 @@ Lib3MFResult lib3mf_implicitfunction_addpownode(Lib3MF_ImplicitFunction pImplici
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddPowNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddMatrixFromColumnsNode(sIdentifier, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -16490,16 +17661,15 @@ Lib3MFResult lib3mf_implicitfunction_addpownode(Lib3MF_ImplicitFunction pImplici
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addselectnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_SelectNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addconstantnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_ConstantNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddSelectNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddConstantNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
 		}
@@ -16519,7 +17689,7 @@ Lib3MFResult lib3mf_implicitfunction_addselectnode(Lib3MF_ImplicitFunction pImpl
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddSelectNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddConstantNode(sIdentifier, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -16539,16 +17709,15 @@ Lib3MFResult lib3mf_implicitfunction_addselectnode(Lib3MF_ImplicitFunction pImpl
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addclampnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, eLib3MFImplicitNodeConfiguration eConfiguration, const char * pDisplayName, const char * pTag, Lib3MF_ClampNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addconstvecnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_ConstVecNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddClampNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddConstVecNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addEnumParameter("Configuration", "ImplicitNodeConfiguration", (Lib3MF_int32)(eConfiguration));
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
 		}
@@ -16568,7 +17737,7 @@ Lib3MFResult lib3mf_implicitfunction_addclampnode(Lib3MF_ImplicitFunction pImpli
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddClampNode(sIdentifier, eConfiguration, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddConstVecNode(sIdentifier, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -16588,14 +17757,14 @@ Lib3MFResult lib3mf_implicitfunction_addclampnode(Lib3MF_ImplicitFunction pImpli
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addcomposevectornode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_ComposeVectorNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addconstmatnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_ConstMatNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddComposeVectorNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddConstMatNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
@@ -16616,7 +17785,7 @@ Lib3MFResult lib3mf_implicitfunction_addcomposevectornode(Lib3MF_ImplicitFunctio
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddComposeVectorNode(sIdentifier, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddConstMatNode(sIdentifier, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -16636,14 +17805,14 @@ Lib3MFResult lib3mf_implicitfunction_addcomposevectornode(Lib3MF_ImplicitFunctio
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addvectorfromscalarnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_VectorFromScalarNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addmeshnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_MeshNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddVectorFromScalarNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddMeshNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
@@ -16664,7 +17833,7 @@ Lib3MFResult lib3mf_implicitfunction_addvectorfromscalarnode(Lib3MF_ImplicitFunc
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddVectorFromScalarNode(sIdentifier, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddMeshNode(sIdentifier, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -16684,14 +17853,14 @@ Lib3MFResult lib3mf_implicitfunction_addvectorfromscalarnode(Lib3MF_ImplicitFunc
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_adddecomposevectornode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_DecomposeVectorNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addunsignedmeshnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_UnsignedMeshNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddDecomposeVectorNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddUnsignedMeshNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
@@ -16712,7 +17881,7 @@ Lib3MFResult lib3mf_implicitfunction_adddecomposevectornode(Lib3MF_ImplicitFunct
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddDecomposeVectorNode(sIdentifier, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddUnsignedMeshNode(sIdentifier, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -16732,14 +17901,14 @@ Lib3MFResult lib3mf_implicitfunction_adddecomposevectornode(Lib3MF_ImplicitFunct
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addcomposematrixnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_ComposeMatrixNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addfunctioncallnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_FunctionCallNode * pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddComposeMatrixNode");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddFunctionCallNode");
 			pJournalEntry->addStringParameter("Identifier", pIdentifier);
 			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
 			pJournalEntry->addStringParameter("Tag", pTag);
@@ -16760,7 +17929,7 @@ Lib3MFResult lib3mf_implicitfunction_addcomposematrixnode(Lib3MF_ImplicitFunctio
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddComposeMatrixNode(sIdentifier, sDisplayName, sTag);
+		pBaseNode = pIImplicitFunction->AddFunctionCallNode(sIdentifier, sDisplayName, sTag);
 
 		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
@@ -16780,39 +17949,27 @@ Lib3MFResult lib3mf_implicitfunction_addcomposematrixnode(Lib3MF_ImplicitFunctio
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addmatrixfromrowsnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_MatrixFromRowsNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_getnodes(Lib3MF_ImplicitFunction pImplicitFunction, Lib3MF_NodeIterator * pIterator)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddMatrixFromRowsNode");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
-			pJournalEntry->addStringParameter("Tag", pTag);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "GetNodes");
 		}
-		if (pIdentifier == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pDisplayName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pTag == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pNode == nullptr)
+		if (pIterator == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		std::string sDisplayName(pDisplayName);
-		std::string sTag(pTag);
-		IBase* pBaseNode(nullptr);
+		IBase* pBaseIterator(nullptr);
 		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddMatrixFromRowsNode(sIdentifier, sDisplayName, sTag);
+		pBaseIterator = pIImplicitFunction->GetNodes();
 
-		*pNode = (IBase*)(pBaseNode);
+		*pIterator = (IBase*)(pBaseIterator);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Node", *pNode);
+			pJournalEntry->addHandleResult("Iterator", *pIterator);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -16828,39 +17985,28 @@ Lib3MFResult lib3mf_implicitfunction_addmatrixfromrowsnode(Lib3MF_ImplicitFuncti
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addmatrixfromcolumnsnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_MatrixFromColumnsNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_removenode(Lib3MF_ImplicitFunction pImplicitFunction, Lib3MF_ImplicitNode pNode)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddMatrixFromColumnsNode");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
-			pJournalEntry->addStringParameter("Tag", pTag);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "RemoveNode");
+			pJournalEntry->addHandleParameter("Node", pNode);
 		}
-		if (pIdentifier == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pDisplayName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pTag == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pNode == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		std::string sDisplayName(pDisplayName);
-		std::string sTag(pTag);
-		IBase* pBaseNode(nullptr);
+		IBase* pIBaseClassNode = (IBase *)pNode;
+		IImplicitNode* pINode = dynamic_cast<IImplicitNode*>(pIBaseClassNode);
+		if (!pINode)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
 		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddMatrixFromColumnsNode(sIdentifier, sDisplayName, sTag);
+		pIImplicitFunction->RemoveNode(pINode);
 
-		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Node", *pNode);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -16876,39 +18022,34 @@ Lib3MFResult lib3mf_implicitfunction_addmatrixfromcolumnsnode(Lib3MF_ImplicitFun
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addconstantnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_ConstantNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addlink(Lib3MF_ImplicitFunction pImplicitFunction, Lib3MF_ImplicitPort pSource, Lib3MF_ImplicitPort pTarget)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddConstantNode");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
-			pJournalEntry->addStringParameter("Tag", pTag);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddLink");
+			pJournalEntry->addHandleParameter("Source", pSource);
+			pJournalEntry->addHandleParameter("Target", pTarget);
 		}
-		if (pIdentifier == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pDisplayName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pTag == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pNode == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		std::string sDisplayName(pDisplayName);
-		std::string sTag(pTag);
-		IBase* pBaseNode(nullptr);
+		IBase* pIBaseClassSource = (IBase *)pSource;
+		IImplicitPort* pISource = dynamic_cast<IImplicitPort*>(pIBaseClassSource);
+		if (!pISource)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
+		IBase* pIBaseClassTarget = (IBase *)pTarget;
+		IImplicitPort* pITarget = dynamic_cast<IImplicitPort*>(pIBaseClassTarget);
+		if (!pITarget)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
+		
 		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddConstantNode(sIdentifier, sDisplayName, sTag);
+		pIImplicitFunction->AddLink(pISource, pITarget);
 
-		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Node", *pNode);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -16924,39 +18065,30 @@ Lib3MFResult lib3mf_implicitfunction_addconstantnode(Lib3MF_ImplicitFunction pIm
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addconstvecnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_ConstVecNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_addlinkbynames(Lib3MF_ImplicitFunction pImplicitFunction, const char * pSource, const char * pTarget)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddConstVecNode");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
-			pJournalEntry->addStringParameter("Tag", pTag);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddLinkByNames");
+			pJournalEntry->addStringParameter("Source", pSource);
+			pJournalEntry->addStringParameter("Target", pTarget);
 		}
-		if (pIdentifier == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pDisplayName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pTag == nullptr)
+		if (pSource == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pNode == nullptr)
+		if (pTarget == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		std::string sDisplayName(pDisplayName);
-		std::string sTag(pTag);
-		IBase* pBaseNode(nullptr);
+		std::string sSource(pSource);
+		std::string sTarget(pTarget);
 		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddConstVecNode(sIdentifier, sDisplayName, sTag);
+		pIImplicitFunction->AddLinkByNames(sSource, sTarget);
 
-		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Node", *pNode);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -16972,39 +18104,22 @@ Lib3MFResult lib3mf_implicitfunction_addconstvecnode(Lib3MF_ImplicitFunction pIm
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addconstmatnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_ConstMatNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_clear(Lib3MF_ImplicitFunction pImplicitFunction)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddConstMatNode");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
-			pJournalEntry->addStringParameter("Tag", pTag);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "Clear");
 		}
-		if (pIdentifier == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pDisplayName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pTag == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pNode == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		std::string sDisplayName(pDisplayName);
-		std::string sTag(pTag);
-		IBase* pBaseNode(nullptr);
 		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddConstMatNode(sIdentifier, sDisplayName, sTag);
+		pIImplicitFunction->Clear();
 
-		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Node", *pNode);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -17020,39 +18135,22 @@ Lib3MFResult lib3mf_implicitfunction_addconstmatnode(Lib3MF_ImplicitFunction pIm
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addmeshnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_MeshNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_sortnodestopologically(Lib3MF_ImplicitFunction pImplicitFunction)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddMeshNode");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
-			pJournalEntry->addStringParameter("Tag", pTag);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "SortNodesTopologically");
 		}
-		if (pIdentifier == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pDisplayName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pTag == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pNode == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		std::string sDisplayName(pDisplayName);
-		std::string sTag(pTag);
-		IBase* pBaseNode(nullptr);
 		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddMeshNode(sIdentifier, sDisplayName, sTag);
+		pIImplicitFunction->SortNodesTopologically();
 
-		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Node", *pNode);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -17068,39 +18166,27 @@ Lib3MFResult lib3mf_implicitfunction_addmeshnode(Lib3MF_ImplicitFunction pImplic
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addunsignedmeshnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_UnsignedMeshNode * pNode)
+Lib3MFResult lib3mf_implicitfunction_createevaluator(Lib3MF_ImplicitFunction pImplicitFunction, Lib3MF_ImplicitEvaluator * pEvaluator)
 {
 	IBase* pIBaseClass = (IBase *)pImplicitFunction;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddUnsignedMeshNode");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
-			pJournalEntry->addStringParameter("Tag", pTag);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "CreateEvaluator");
 		}
-		if (pIdentifier == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pDisplayName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pTag == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pNode == nullptr)
+		if (pEvaluator == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		std::string sDisplayName(pDisplayName);
-		std::string sTag(pTag);
-		IBase* pBaseNode(nullptr);
+		IBase* pBaseEvaluator(nullptr);
 		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
 		if (!pIImplicitFunction)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddUnsignedMeshNode(sIdentifier, sDisplayName, sTag);
+		pBaseEvaluator = pIImplicitFunction->CreateEvaluator();
 
-		*pNode = (IBase*)(pBaseNode);
+		*pEvaluator = (IBase*)(pBaseEvaluator);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Node", *pNode);
+			pJournalEntry->addHandleResult("Evaluator", *pEvaluator);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -17116,39 +18202,29 @@ Lib3MFResult lib3mf_implicitfunction_addunsignedmeshnode(Lib3MF_ImplicitFunction
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addfunctioncallnode(Lib3MF_ImplicitFunction pImplicitFunction, const char * pIdentifier, const char * pDisplayName, const char * pTag, Lib3MF_FunctionCallNode * pNode)
+
+/*************************************************************************************************************************
+ Class implementation for ImplicitEvaluator
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_implicitevaluator_getinputstride(Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint32 * pStride)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitFunction;
+	IBase* pIBaseClass = (IBase *)pImplicitEvaluator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddFunctionCallNode");
-			pJournalEntry->addStringParameter("Identifier", pIdentifier);
-			pJournalEntry->addStringParameter("DisplayName", pDisplayName);
-			pJournalEntry->addStringParameter("Tag", pTag);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitEvaluator, "ImplicitEvaluator", "GetInputStride");
 		}
-		if (pIdentifier == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pDisplayName == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pTag == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pNode == nullptr)
+		if (pStride == nullptr)
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sIdentifier(pIdentifier);
-		std::string sDisplayName(pDisplayName);
-		std::string sTag(pTag);
-		IBase* pBaseNode(nullptr);
-		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
-		if (!pIImplicitFunction)
+		IImplicitEvaluator* pIImplicitEvaluator = dynamic_cast<IImplicitEvaluator*>(pIBaseClass);
+		if (!pIImplicitEvaluator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseNode = pIImplicitFunction->AddFunctionCallNode(sIdentifier, sDisplayName, sTag);
+		*pStride = pIImplicitEvaluator->GetInputStride();
 
-		*pNode = (IBase*)(pBaseNode);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Node", *pNode);
+			pJournalEntry->addUInt32Result("Stride", *pStride);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -17164,27 +18240,25 @@ Lib3MFResult lib3mf_implicitfunction_addfunctioncallnode(Lib3MF_ImplicitFunction
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_getnodes(Lib3MF_ImplicitFunction pImplicitFunction, Lib3MF_NodeIterator * pIterator)
+Lib3MFResult lib3mf_implicitevaluator_getoutputstride(Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint32 * pStride)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitFunction;
+	IBase* pIBaseClass = (IBase *)pImplicitEvaluator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "GetNodes");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitEvaluator, "ImplicitEvaluator", "GetOutputStride");
 		}
-		if (pIterator == nullptr)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		IBase* pBaseIterator(nullptr);
-		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
-		if (!pIImplicitFunction)
+		if (pStride == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IImplicitEvaluator* pIImplicitEvaluator = dynamic_cast<IImplicitEvaluator*>(pIBaseClass);
+		if (!pIImplicitEvaluator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pBaseIterator = pIImplicitFunction->GetNodes();
+		*pStride = pIImplicitEvaluator->GetOutputStride();
 
-		*pIterator = (IBase*)(pBaseIterator);
 		if (pJournalEntry.get() != nullptr) {
-			pJournalEntry->addHandleResult("Iterator", *pIterator);
+			pJournalEntry->addUInt32Result("Stride", *pStride);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -17200,26 +18274,21 @@ Lib3MFResult lib3mf_implicitfunction_getnodes(Lib3MF_ImplicitFunction pImplicitF
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_removenode(Lib3MF_ImplicitFunction pImplicitFunction, Lib3MF_ImplicitNode pNode)
+Lib3MFResult lib3mf_implicitevaluator_setworkerthreadcount(Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint32 nThreadCount)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitFunction;
+	IBase* pIBaseClass = (IBase *)pImplicitEvaluator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "RemoveNode");
-			pJournalEntry->addHandleParameter("Node", pNode);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitEvaluator, "ImplicitEvaluator", "SetWorkerThreadCount");
+			pJournalEntry->addUInt32Parameter("ThreadCount", nThreadCount);
 		}
-		IBase* pIBaseClassNode = (IBase *)pNode;
-		IImplicitNode* pINode = dynamic_cast<IImplicitNode*>(pIBaseClassNode);
-		if (!pINode)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
-		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
-		if (!pIImplicitFunction)
+		IImplicitEvaluator* pIImplicitEvaluator = dynamic_cast<IImplicitEvaluator*>(pIBaseClass);
+		if (!pIImplicitEvaluator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIImplicitFunction->RemoveNode(pINode);
+		pIImplicitEvaluator->SetWorkerThreadCount(nThreadCount);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -17237,34 +18306,25 @@ Lib3MFResult lib3mf_implicitfunction_removenode(Lib3MF_ImplicitFunction pImplici
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addlink(Lib3MF_ImplicitFunction pImplicitFunction, Lib3MF_ImplicitPort pSource, Lib3MF_ImplicitPort pTarget)
+Lib3MFResult lib3mf_implicitevaluator_getworkerthreadcount(Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint32 * pThreadCount)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitFunction;
+	IBase* pIBaseClass = (IBase *)pImplicitEvaluator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddLink");
-			pJournalEntry->addHandleParameter("Source", pSource);
-			pJournalEntry->addHandleParameter("Target", pTarget);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitEvaluator, "ImplicitEvaluator", "GetWorkerThreadCount");
 		}
-		IBase* pIBaseClassSource = (IBase *)pSource;
-		IImplicitPort* pISource = dynamic_cast<IImplicitPort*>(pIBaseClassSource);
-		if (!pISource)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
-		IBase* pIBaseClassTarget = (IBase *)pTarget;
-		IImplicitPort* pITarget = dynamic_cast<IImplicitPort*>(pIBaseClassTarget);
-		if (!pITarget)
-			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDCAST);
-		
-		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
-		if (!pIImplicitFunction)
+		if (pThreadCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IImplicitEvaluator* pIImplicitEvaluator = dynamic_cast<IImplicitEvaluator*>(pIBaseClass);
+		if (!pIImplicitEvaluator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIImplicitFunction->AddLink(pISource, pITarget);
+		*pThreadCount = pIImplicitEvaluator->GetWorkerThreadCount();
 
 		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("ThreadCount", *pThreadCount);
 			pJournalEntry->writeSuccess();
 		}
 		return LIB3MF_SUCCESS;
@@ -17280,28 +18340,24 @@ Lib3MFResult lib3mf_implicitfunction_addlink(Lib3MF_ImplicitFunction pImplicitFu
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_addlinkbynames(Lib3MF_ImplicitFunction pImplicitFunction, const char * pSource, const char * pTarget)
+Lib3MFResult lib3mf_implicitevaluator_evaluate(Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint64 nInputsBufferSize, const Lib3MF_double * pInputsBuffer, const Lib3MF_uint64 nOutputsBufferSize, Lib3MF_uint64* pOutputsNeededCount, Lib3MF_double * pOutputsBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitFunction;
+	IBase* pIBaseClass = (IBase *)pImplicitEvaluator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "AddLinkByNames");
-			pJournalEntry->addStringParameter("Source", pSource);
-			pJournalEntry->addStringParameter("Target", pTarget);
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitEvaluator, "ImplicitEvaluator", "Evaluate");
 		}
-		if (pSource == nullptr)
+		if ( (!pInputsBuffer) && (nInputsBufferSize>0))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		if (pTarget == nullptr)
+		if ((!pOutputsBuffer) && !(pOutputsNeededCount))
 			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
-		std::string sSource(pSource);
-		std::string sTarget(pTarget);
-		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
-		if (!pIImplicitFunction)
+		IImplicitEvaluator* pIImplicitEvaluator = dynamic_cast<IImplicitEvaluator*>(pIBaseClass);
+		if (!pIImplicitEvaluator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIImplicitFunction->AddLinkByNames(sSource, sTarget);
+		pIImplicitEvaluator->Evaluate(nInputsBufferSize, pInputsBuffer, nOutputsBufferSize, pOutputsNeededCount, pOutputsBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -17319,20 +18375,24 @@ Lib3MFResult lib3mf_implicitfunction_addlinkbynames(Lib3MF_ImplicitFunction pImp
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_clear(Lib3MF_ImplicitFunction pImplicitFunction)
+Lib3MFResult lib3mf_implicitevaluator_evaluatebatch(Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint64 nInputsBufferSize, const Lib3MF_double * pInputsBuffer, const Lib3MF_uint64 nOutputsBufferSize, Lib3MF_uint64* pOutputsNeededCount, Lib3MF_double * pOutputsBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitFunction;
+	IBase* pIBaseClass = (IBase *)pImplicitEvaluator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "Clear");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitEvaluator, "ImplicitEvaluator", "EvaluateBatch");
 		}
-		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
-		if (!pIImplicitFunction)
+		if ( (!pInputsBuffer) && (nInputsBufferSize>0))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if ((!pOutputsBuffer) && !(pOutputsNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IImplicitEvaluator* pIImplicitEvaluator = dynamic_cast<IImplicitEvaluator*>(pIBaseClass);
+		if (!pIImplicitEvaluator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIImplicitFunction->Clear();
+		pIImplicitEvaluator->EvaluateBatch(nInputsBufferSize, pInputsBuffer, nOutputsBufferSize, pOutputsNeededCount, pOutputsBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -17350,20 +18410,28 @@ Lib3MFResult lib3mf_implicitfunction_clear(Lib3MF_ImplicitFunction pImplicitFunc
 	}
 }
 
-Lib3MFResult lib3mf_implicitfunction_sortnodestopologically(Lib3MF_ImplicitFunction pImplicitFunction)
+Lib3MFResult lib3mf_implicitevaluator_evaluatebounds(Lib3MF_ImplicitEvaluator pImplicitEvaluator, Lib3MF_uint64 nInputMinimaBufferSize, const Lib3MF_double * pInputMinimaBuffer, Lib3MF_uint64 nInputMaximaBufferSize, const Lib3MF_double * pInputMaximaBuffer, const Lib3MF_uint64 nOutputMinimaBufferSize, Lib3MF_uint64* pOutputMinimaNeededCount, Lib3MF_double * pOutputMinimaBuffer, const Lib3MF_uint64 nOutputMaximaBufferSize, Lib3MF_uint64* pOutputMaximaNeededCount, Lib3MF_double * pOutputMaximaBuffer)
 {
-	IBase* pIBaseClass = (IBase *)pImplicitFunction;
+	IBase* pIBaseClass = (IBase *)pImplicitEvaluator;
 
 	PLib3MFInterfaceJournalEntry pJournalEntry;
 	try {
 		if (m_GlobalJournal.get() != nullptr)  {
-			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitFunction, "ImplicitFunction", "SortNodesTopologically");
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImplicitEvaluator, "ImplicitEvaluator", "EvaluateBounds");
 		}
-		IImplicitFunction* pIImplicitFunction = dynamic_cast<IImplicitFunction*>(pIBaseClass);
-		if (!pIImplicitFunction)
+		if ( (!pInputMinimaBuffer) && (nInputMinimaBufferSize>0))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if ( (!pInputMaximaBuffer) && (nInputMaximaBufferSize>0))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if ((!pOutputMinimaBuffer) && !(pOutputMinimaNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if ((!pOutputMaximaBuffer) && !(pOutputMaximaNeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IImplicitEvaluator* pIImplicitEvaluator = dynamic_cast<IImplicitEvaluator*>(pIBaseClass);
+		if (!pIImplicitEvaluator)
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
 		
-		pIImplicitFunction->SortNodesTopologically();
+		pIImplicitEvaluator->EvaluateBounds(nInputMinimaBufferSize, pInputMinimaBuffer, nInputMaximaBufferSize, pInputMaximaBuffer, nOutputMinimaBufferSize, pOutputMinimaNeededCount, pOutputMinimaBuffer, nOutputMaximaBufferSize, pOutputMaximaNeededCount, pOutputMaximaBuffer);
 
 		if (pJournalEntry.get() != nullptr) {
 			pJournalEntry->writeSuccess();
@@ -17730,6 +18798,213 @@ Lib3MFResult lib3mf_functionfromimage3d_setscale(Lib3MF_FunctionFromImage3D pFun
 	}
 }
 
+Lib3MFResult lib3mf_functionfromimage3d_createsampler(Lib3MF_FunctionFromImage3D pFunctionFromImage3D, Lib3MF_Image3DSampler * pSampler)
+{
+	IBase* pIBaseClass = (IBase *)pFunctionFromImage3D;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pFunctionFromImage3D, "FunctionFromImage3D", "CreateSampler");
+		}
+		if (pSampler == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IBase* pBaseSampler(nullptr);
+		IFunctionFromImage3D* pIFunctionFromImage3D = dynamic_cast<IFunctionFromImage3D*>(pIBaseClass);
+		if (!pIFunctionFromImage3D)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pBaseSampler = pIFunctionFromImage3D->CreateSampler();
+
+		*pSampler = (IBase*)(pBaseSampler);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("Sampler", *pSampler);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+
+/*************************************************************************************************************************
+ Class implementation for Image3DSampler
+**************************************************************************************************************************/
+Lib3MFResult lib3mf_image3dsampler_setcachesize(Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint64 nCacheSize)
+{
+	IBase* pIBaseClass = (IBase *)pImage3DSampler;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImage3DSampler, "Image3DSampler", "SetCacheSize");
+			pJournalEntry->addUInt64Parameter("CacheSize", nCacheSize);
+		}
+		IImage3DSampler* pIImage3DSampler = dynamic_cast<IImage3DSampler*>(pIBaseClass);
+		if (!pIImage3DSampler)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIImage3DSampler->SetCacheSize(nCacheSize);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_image3dsampler_getcachesize(Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint64 * pCacheSize)
+{
+	IBase* pIBaseClass = (IBase *)pImage3DSampler;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImage3DSampler, "Image3DSampler", "GetCacheSize");
+		}
+		if (pCacheSize == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IImage3DSampler* pIImage3DSampler = dynamic_cast<IImage3DSampler*>(pIBaseClass);
+		if (!pIImage3DSampler)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pCacheSize = pIImage3DSampler->GetCacheSize();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt64Result("CacheSize", *pCacheSize);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_image3dsampler_setworkerthreadcount(Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint32 nThreadCount)
+{
+	IBase* pIBaseClass = (IBase *)pImage3DSampler;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImage3DSampler, "Image3DSampler", "SetWorkerThreadCount");
+			pJournalEntry->addUInt32Parameter("ThreadCount", nThreadCount);
+		}
+		IImage3DSampler* pIImage3DSampler = dynamic_cast<IImage3DSampler*>(pIBaseClass);
+		if (!pIImage3DSampler)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIImage3DSampler->SetWorkerThreadCount(nThreadCount);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_image3dsampler_getworkerthreadcount(Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint32 * pThreadCount)
+{
+	IBase* pIBaseClass = (IBase *)pImage3DSampler;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImage3DSampler, "Image3DSampler", "GetWorkerThreadCount");
+		}
+		if (pThreadCount == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IImage3DSampler* pIImage3DSampler = dynamic_cast<IImage3DSampler*>(pIBaseClass);
+		if (!pIImage3DSampler)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		*pThreadCount = pIImage3DSampler->GetWorkerThreadCount();
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addUInt32Result("ThreadCount", *pThreadCount);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
+Lib3MFResult lib3mf_image3dsampler_sample(Lib3MF_Image3DSampler pImage3DSampler, Lib3MF_uint64 nUVWBufferSize, const Lib3MF_double * pUVWBuffer, const Lib3MF_uint64 nRGBABufferSize, Lib3MF_uint64* pRGBANeededCount, Lib3MF_double * pRGBABuffer)
+{
+	IBase* pIBaseClass = (IBase *)pImage3DSampler;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginClassMethod(pImage3DSampler, "Image3DSampler", "Sample");
+		}
+		if ( (!pUVWBuffer) && (nUVWBufferSize>0))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if ((!pRGBABuffer) && !(pRGBANeededCount))
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		IImage3DSampler* pIImage3DSampler = dynamic_cast<IImage3DSampler*>(pIBaseClass);
+		if (!pIImage3DSampler)
+			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDCAST);
+		
+		pIImage3DSampler->Sample(nUVWBufferSize, pUVWBuffer, nRGBABufferSize, pRGBANeededCount, pRGBABuffer);
+
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
 
 /*************************************************************************************************************************
  Class implementation for BuildItem
@@ -23357,6 +24632,18 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_writer_getdecimalprecision;
 	if (sProcName == "lib3mf_writer_setdecimalprecision") 
 		*ppProcAddress = (void*) &lib3mf_writer_setdecimalprecision;
+	if (sProcName == "lib3mf_writer_setshortestroundtripactive") 
+		*ppProcAddress = (void*) &lib3mf_writer_setshortestroundtripactive;
+	if (sProcName == "lib3mf_writer_getshortestroundtripactive") 
+		*ppProcAddress = (void*) &lib3mf_writer_getshortestroundtripactive;
+	if (sProcName == "lib3mf_writer_setworkerthreadcount") 
+		*ppProcAddress = (void*) &lib3mf_writer_setworkerthreadcount;
+	if (sProcName == "lib3mf_writer_getworkerthreadcount") 
+		*ppProcAddress = (void*) &lib3mf_writer_getworkerthreadcount;
+	if (sProcName == "lib3mf_writer_setcompressionlevel") 
+		*ppProcAddress = (void*) &lib3mf_writer_setcompressionlevel;
+	if (sProcName == "lib3mf_writer_getcompressionlevel") 
+		*ppProcAddress = (void*) &lib3mf_writer_getcompressionlevel;
 	if (sProcName == "lib3mf_writer_setstrictmodeactive") 
 		*ppProcAddress = (void*) &lib3mf_writer_setstrictmodeactive;
 	if (sProcName == "lib3mf_writer_getstrictmodeactive") 
@@ -23385,6 +24672,16 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_reader_setstrictmodeactive;
 	if (sProcName == "lib3mf_reader_getstrictmodeactive") 
 		*ppProcAddress = (void*) &lib3mf_reader_getstrictmodeactive;
+	if (sProcName == "lib3mf_reader_setworkerthreadcount") 
+		*ppProcAddress = (void*) &lib3mf_reader_setworkerthreadcount;
+	if (sProcName == "lib3mf_reader_getworkerthreadcount") 
+		*ppProcAddress = (void*) &lib3mf_reader_getworkerthreadcount;
+	if (sProcName == "lib3mf_reader_setmeshstreamcallbacks") 
+		*ppProcAddress = (void*) &lib3mf_reader_setmeshstreamcallbacks;
+	if (sProcName == "lib3mf_reader_setlazymeshloadingactive") 
+		*ppProcAddress = (void*) &lib3mf_reader_setlazymeshloadingactive;
+	if (sProcName == "lib3mf_reader_getlazymeshloadingactive") 
+		*ppProcAddress = (void*) &lib3mf_reader_getlazymeshloadingactive;
 	if (sProcName == "lib3mf_reader_getwarning") 
 		*ppProcAddress = (void*) &lib3mf_reader_getwarning;
 	if (sProcName == "lib3mf_reader_getwarningcount") 
@@ -23393,6 +24690,18 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_reader_addkeywrappingcallback;
 	if (sProcName == "lib3mf_reader_setcontentencryptioncallback") 
 		*ppProcAddress = (void*) &lib3mf_reader_setcontentencryptioncallback;
+	if (sProcName == "lib3mf_streamingwriter_beginmeshobject") 
+		*ppProcAddress = (void*) &lib3mf_streamingwriter_beginmeshobject;
+	if (sProcName == "lib3mf_streamingwriter_addvertices") 
+		*ppProcAddress = (void*) &lib3mf_streamingwriter_addvertices;
+	if (sProcName == "lib3mf_streamingwriter_addtriangles") 
+		*ppProcAddress = (void*) &lib3mf_streamingwriter_addtriangles;
+	if (sProcName == "lib3mf_streamingwriter_endmeshobject") 
+		*ppProcAddress = (void*) &lib3mf_streamingwriter_endmeshobject;
+	if (sProcName == "lib3mf_streamingwriter_addbuilditem") 
+		*ppProcAddress = (void*) &lib3mf_streamingwriter_addbuilditem;
+	if (sProcName == "lib3mf_streamingwriter_finish") 
+		*ppProcAddress = (void*) &lib3mf_streamingwriter_finish;
 	if (sProcName == "lib3mf_packagepart_getpath") 
 		*ppProcAddress = (void*) &lib3mf_packagepart_getpath;
 	if (sProcName == "lib3mf_packagepart_setpath") 
@@ -23561,6 +24870,10 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_meshobject_addvertex;
 	if (sProcName == "lib3mf_meshobject_getvertices") 
 		*ppProcAddress = (void*) &lib3mf_meshobject_getvertices;
+	if (sProcName == "lib3mf_meshobject_getvertexpagecount") 
+		*ppProcAddress = (void*) &lib3mf_meshobject_getvertexpagecount;
+	if (sProcName == "lib3mf_meshobject_getvertexpage") 
+		*ppProcAddress = (void*) &lib3mf_meshobject_getvertexpage;
 	if (sProcName == "lib3mf_meshobject_gettriangle") 
 		*ppProcAddress = (void*) &lib3mf_meshobject_gettriangle;
 	if (sProcName == "lib3mf_meshobject_settriangle") 
@@ -23569,6 +24882,10 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_meshobject_addtriangle;
 	if (sProcName == "lib3mf_meshobject_gettriangleindices") 
 		*ppProcAddress = (void*) &lib3mf_meshobject_gettriangleindices;
+	if (sProcName == "lib3mf_meshobject_gettrianglepagecount") 
+		*ppProcAddress = (void*) &lib3mf_meshobject_gettrianglepagecount;
+	if (sProcName == "lib3mf_meshobject_gettrianglepage") 
+		*ppProcAddress = (void*) &lib3mf_meshobject_gettrianglepage;
 	if (sProcName == "lib3mf_meshobject_setobjectlevelproperty") 
 		*ppProcAddress = (void*) &lib3mf_meshobject_setobjectlevelproperty;
 	if (sProcName == "lib3mf_meshobject_getobjectlevelproperty") 
@@ -23585,8 +24902,12 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_meshobject_clearallproperties;
 	if (sProcName == "lib3mf_meshobject_setgeometry") 
 		*ppProcAddress = (void*) &lib3mf_meshobject_setgeometry;
+	if (sProcName == "lib3mf_meshobject_reservegeometry") 
+		*ppProcAddress = (void*) &lib3mf_meshobject_reservegeometry;
 	if (sProcName == "lib3mf_meshobject_ismanifoldandoriented") 
 		*ppProcAddress = (void*) &lib3mf_meshobject_ismanifoldandoriented;
+	if (sProcName == "lib3mf_meshobject_isgeometryloaded") 
+		*ppProcAddress = (void*) &lib3mf_meshobject_isgeometryloaded;
 	if (sProcName == "lib3mf_meshobject_beamlattice") 
 		*ppProcAddress = (void*) &lib3mf_meshobject_beamlattice;
 	if (sProcName == "lib3mf_meshobject_getvolumedata") 
@@ -24229,6 +25550,22 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_implicitfunction_clear;
 	if (sProcName == "lib3mf_implicitfunction_sortnodestopologically") 
 		*ppProcAddress = (void*) &lib3mf_implicitfunction_sortnodestopologically;
+	if (sProcName == "lib3mf_implicitfunction_createevaluator") 
+		*ppProcAddress = (void*) &lib3mf_implicitfunction_createevaluator;
+	if (sProcName == "lib3mf_implicitevaluator_getinputstride") 
+		*ppProcAddress = (void*) &lib3mf_implicitevaluator_getinputstride;
+	if (sProcName == "lib3mf_implicitevaluator_getoutputstride") 
+		*ppProcAddress = (void*) &lib3mf_implicitevaluator_getoutputstride;
+	if (sProcName == "lib3mf_implicitevaluator_setworkerthreadcount") 
+		*ppProcAddress = (void*) &lib3mf_implicitevaluator_setworkerthreadcount;
+	if (sProcName == "lib3mf_implicitevaluator_getworkerthreadcount") 
+		*ppProcAddress = (void*) &lib3mf_implicitevaluator_getworkerthreadcount;
+	if (sProcName == "lib3mf_implicitevaluator_evaluate") 
+		*ppProcAddress = (void*) &lib3mf_implicitevaluator_evaluate;
+	if (sProcName == "lib3mf_implicitevaluator_evaluatebatch") 
+		*ppProcAddress = (void*) &lib3mf_implicitevaluator_evaluatebatch;
+	if (sProcName == "lib3mf_implicitevaluator_evaluatebounds") 
+		*ppProcAddress = (void*) &lib3mf_implicitevaluator_evaluatebounds;
 	if (sProcName == "lib3mf_functionfromimage3d_getimage3d") 
 		*ppProcAddress = (void*) &lib3mf_functionfromimage3d_getimage3d;
 	if (sProcName == "lib3mf_functionfromimage3d_setimage3d") 
@@ -24249,6 +25586,18 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_functionfromimage3d_getscale;
 	if (sProcName == "lib3mf_functionfromimage3d_setscale") 
 		*ppProcAddress = (void*) &lib3mf_functionfromimage3d_setscale;
+	if (sProcName == "lib3mf_functionfromimage3d_createsampler") 
+		*ppProcAddress = (void*) &lib3mf_functionfromimage3d_createsampler;
+	if (sProcName == "lib3mf_image3dsampler_setcachesize") 
+		*ppProcAddress = (void*) &lib3mf_image3dsampler_setcachesize;
+	if (sProcName == "lib3mf_image3dsampler_getcachesize") 
+		*ppProcAddress = (void*) &lib3mf_image3dsampler_getcachesize;
+	if (sProcName == "lib3mf_image3dsampler_setworkerthreadcount") 
+		*ppProcAddress = (void*) &lib3mf_image3dsampler_setworkerthreadcount;
+	if (sProcName == "lib3mf_image3dsampler_getworkerthreadcount") 
+		*ppProcAddress = (void*) &lib3mf_image3dsampler_getworkerthreadcount;
+	if (sProcName == "lib3mf_image3dsampler_sample") 
+		*ppProcAddress = (void*) &lib3mf_image3dsampler_sample;
 	if (sProcName == "lib3mf_builditem_getobjectresource") 
 		*ppProcAddress = (void*) &lib3mf_builditem_getobjectresource;
 	if (sProcName == "lib3mf_builditem_getuuid") 
@@ -24553,6 +25902,8 @@ Lib3MFResult Lib3MF::Impl::Lib3MF_GetProcAddress (const char * pProcName, void *
 		*ppProcAddress = (void*) &lib3mf_getspecificationversion;
 	if (sProcName == "lib3mf_createmodel") 
 		*ppProcAddress = (void*) &lib3mf_createmodel;
+	if (sProcName == "lib3mf_createstreamingwriter") 
+		*ppProcAddress = (void*) &lib3mf_createstreamingwriter;
 	if (sProcName == "lib3mf_release") 
 		*ppProcAddress = (void*) &lib3mf_release;
 	if (sProcName == "lib3mf_acquire") 
@@ -24787,6 +26138,43 @@ Lib3MFResult lib3mf_createmodel(Lib3MF_Model * pModel)
 	}
 }
 
+Lib3MFResult lib3mf_createstreamingwriter(const char * pFilename, eLib3MFModelUnit eUnit, Lib3MF_StreamingWriter * pStreamingWriter)
+{
+	IBase* pIBaseClass = nullptr;
+
+	PLib3MFInterfaceJournalEntry pJournalEntry;
+	try {
+		if (m_GlobalJournal.get() != nullptr)  {
+			pJournalEntry = m_GlobalJournal->beginStaticFunction("CreateStreamingWriter");
+			pJournalEntry->addStringParameter("Filename", pFilename);
+			pJournalEntry->addEnumParameter("Unit", "ModelUnit", (Lib3MF_int32)(eUnit));
+		}
+		if (pFilename == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		if (pStreamingWriter == nullptr)
+			throw ELib3MFInterfaceException (LIB3MF_ERROR_INVALIDPARAM);
+		std::string sFilename(pFilename);
+		IBase* pBaseStreamingWriter(nullptr);
+		pBaseStreamingWriter = CWrapper::CreateStreamingWriter(sFilename, eUnit);
+
+		*pStreamingWriter = (IBase*)(pBaseStreamingWriter);
+		if (pJournalEntry.get() != nullptr) {
+			pJournalEntry->addHandleResult("StreamingWriter", *pStreamingWriter);
+			pJournalEntry->writeSuccess();
+		}
+		return LIB3MF_SUCCESS;
+	}
+	catch (ELib3MFInterfaceException & Exception) {
+		return handleLib3MFException(pIBaseClass, Exception, pJournalEntry.get());
+	}
+	catch (std::exception & StdException) {
+		return handleStdException(pIBaseClass, StdException, pJournalEntry.get());
+	}
+	catch (...) {
+		return handleUnhandledException(pIBaseClass, pJournalEntry.get());
+	}
+}
+
 Lib3MFResult lib3mf_release(Lib3MF_Base pInstance)
 {
 	IBase* pIBaseClass = nullptr;
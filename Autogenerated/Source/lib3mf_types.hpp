@@ -212,6 +212,7 @@ inline const char * LIB3MF_GETERRORSTRING (Lib3MFResult nErrorCode) {
 typedef Lib3MFHandle Lib3MF_Base;
 typedef Lib3MFHandle Lib3MF_Writer;
 typedef Lib3MFHandle Lib3MF_Reader;
+typedef Lib3MFHandle Lib3MF_StreamingWriter;
 typedef Lib3MFHandle Lib3MF_PackagePart;
 typedef Lib3MFHandle Lib3MF_Resource;
 typedef Lib3MFHandle Lib3MF_ResourceIterator;
@@ -313,7 +314,9 @@ typedef Lib3MFHandle Lib3MF_FunctionCallNode;
 typedef Lib3MFHandle Lib3MF_NodeIterator;
 typedef Lib3MFHandle Lib3MF_Function;
 typedef Lib3MFHandle Lib3MF_ImplicitFunction;
+typedef Lib3MFHandle Lib3MF_ImplicitEvaluator;
 typedef Lib3MFHandle Lib3MF_FunctionFromImage3D;
+typedef Lib3MFHandle Lib3MF_Image3DSampler;
 typedef Lib3MFHandle Lib3MF_BuildItem;
 typedef Lib3MFHandle Lib3MF_BuildItemIterator;
 typedef Lib3MFHandle Lib3MF_Slice;
@@ -452,6 +455,25 @@ namespace Lib3MF {
     LinearColor = 1
   };
   
+  /**
+  * enum class ePackagePartType - The kind of a part written into the package
+  */
+  enum class ePackagePartType : Lib3MF_int32 {
+    Model = 0, /** 3D model parts */
+    Image = 1, /** Thumbnails, textures and image stack sheets */
+    Attachment = 2 /** All other attachments */
+  };
+  
+  /**
+  * enum class eCompressionLevel - The compression of a part in the package
+  */
+  enum class eCompressionLevel : Lib3MF_int32 {
+    Stored = 0, /** Part is stored without compression */
+    Fastest = 1, /** Fastest deflate compression */
+    Default = 6, /** Default deflate compression */
+    Maximum = 9 /** Best deflate compression */
+  };
+  
   /**
   * enum class eImplicitNodeType - The type of the node
   */
@@ -680,6 +702,28 @@ namespace Lib3MF {
   */
   typedef void(*RandomNumberCallback)(Lib3MF_uint64, Lib3MF_uint64, Lib3MF_pvoid, Lib3MF_uint64 *);
   
+  /**
+  * VertexBlockCallback - Callback to receive a block of vertices of a mesh object while it is read
+  *
+  * @param[in] nUniqueResourceID - Unique resource ID of the mesh object
+  * @param[in] nStartIndex - Index of the first vertex of the block within the mesh object
+  * @param[in] nVerticesBufferSize - Number of elements in buffer
+  * @param[in] pVerticesBuffer - Position buffer of Vertices of the block
+  * @param[in] pUserData - Userdata that is passed to the callback function
+  */
+  typedef void(*VertexBlockCallback)(Lib3MF_uint32, Lib3MF_uint32, Lib3MF_uint64, const sPosition *, Lib3MF_pvoid);
+  
+  /**
+  * TriangleBlockCallback - Callback to receive a block of triangles of a mesh object while it is read
+  *
+  * @param[in] nUniqueResourceID - Unique resource ID of the mesh object
+  * @param[in] nStartIndex - Index of the first triangle of the block within the mesh object
+  * @param[in] nTrianglesBufferSize - Number of elements in buffer
+  * @param[in] pTrianglesBuffer - Triangle buffer of Vertex indices of the triangles of the block
+  * @param[in] pUserData - Userdata that is passed to the callback function
+  */
+  typedef void(*TriangleBlockCallback)(Lib3MF_uint32, Lib3MF_uint32, Lib3MF_uint64, const sTriangle *, Lib3MF_pvoid);
+  
   /**
   * KeyWrappingCallback - A callback used to wrap (encrypt) the content key available in keystore resource group
   *
@@ -726,6 +770,8 @@ typedef Lib3MF::eBlendMethod eLib3MFBlendMethod;
 typedef Lib3MF::eChannelName eLib3MFChannelName;
 typedef Lib3MF::eCompositionMethod eLib3MFCompositionMethod;
 typedef Lib3MF::eCompositionSpace eLib3MFCompositionSpace;
+typedef Lib3MF::ePackagePartType eLib3MFPackagePartType;
+typedef Lib3MF::eCompressionLevel eLib3MFCompressionLevel;
 typedef Lib3MF::eImplicitNodeType eLib3MFImplicitNodeType;
 typedef Lib3MF::eImplicitPortType eLib3MFImplicitPortType;
 typedef Lib3MF::eImplicitNodeConfiguration eLib3MFImplicitNodeConfiguration;
@@ -753,6 +799,8 @@ typedef Lib3MF::WriteCallback Lib3MFWriteCallback;
 typedef Lib3MF::ReadCallback Lib3MFReadCallback;
 typedef Lib3MF::SeekCallback Lib3MFSeekCallback;
 typedef Lib3MF::RandomNumberCallback Lib3MFRandomNumberCallback;
+typedef Lib3MF::VertexBlockCallback Lib3MFVertexBlockCallback;
+typedef Lib3MF::TriangleBlockCallback Lib3MFTriangleBlockCallback;
 typedef Lib3MF::KeyWrappingCallback Lib3MFKeyWrappingCallback;
 typedef Lib3MF::ContentEncryptionCallback Lib3MFContentEncryptionCallback;
 
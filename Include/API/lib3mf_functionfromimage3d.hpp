@@ -145,6 +145,12 @@ public:
 	*/
 	void SetScale(const Lib3MF_double dScale) override;
 
+	/**
+	* IFunctionFromImage3D::CreateSampler - Creates a sampler, which decodes the sheets of the 3D image on demand.
+	* @return the sampler
+	*/
+	IImage3DSampler * CreateSampler() override;
+
 };
 
 } // namespace Impl
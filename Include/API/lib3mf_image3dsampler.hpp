@@ -0,0 +1,139 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium (Original Author)
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract: This is the class declaration of CImage3DSampler
+
+*/
+
+#ifndef __LIB3MF_IMAGE3DSAMPLER
+#define __LIB3MF_IMAGE3DSAMPLER
+
+#include "lib3mf_interfaces.hpp"
+
+// Parent classes
+#include "lib3mf_base.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4250)
+#endif
+
+// Include custom headers here.
+#include "Common/NMR_ThreadPool.h"
+#include "Model/Classes/NMR_ModelImage3DSampler.h"
+
+namespace Lib3MF
+{
+    namespace Impl
+    {
+
+        /*************************************************************************************************************************
+         Class declaration of CImage3DSampler
+        **************************************************************************************************************************/
+
+        class CImage3DSampler : public virtual IImage3DSampler, public virtual CBase
+        {
+           private:
+            /**
+             * Put private members here.
+             */
+            NMR::PModelImage3DSampler m_pSampler;
+
+            Lib3MF_uint32 m_nWorkerThreadCount = 1;
+            NMR::PThreadPool m_pThreadPool;
+
+           protected:
+            /**
+             * Put protected members here.
+             */
+
+           public:
+            /**
+             * Put additional public members here. They will not be visible in
+             * the external API.
+             */
+
+            CImage3DSampler() = delete;
+            CImage3DSampler(NMR::PModelImage3DSampler pSampler);
+
+            /**
+             * Public member functions to implement.
+             */
+
+            /**
+             * IImage3DSampler::SetCacheSize - Sets the maximal memory size of
+             * the decoded sheets
+             * @param[in] nCacheSize - cache size in bytes
+             */
+            void SetCacheSize(const Lib3MF_uint64 nCacheSize) override;
+
+            /**
+             * IImage3DSampler::GetCacheSize - Returns the maximal memory size
+             * of the decoded sheets
+             * @return cache size in bytes
+             */
+            Lib3MF_uint64 GetCacheSize() override;
+
+            /**
+             * IImage3DSampler::SetWorkerThreadCount - Sets the number of
+             * threads used by Sample
+             * @param[in] nThreadCount - number of threads, 0 selects the
+             * number of hardware threads
+             */
+            void SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount) override;
+
+            /**
+             * IImage3DSampler::GetWorkerThreadCount - Returns the number of
+             * threads used by Sample
+             * @return number of threads
+             */
+            Lib3MF_uint32 GetWorkerThreadCount() override;
+
+            /**
+             * IImage3DSampler::Sample - Samples the function from image3D at
+             * a batch of points
+             * @param[in] nUVWBufferSize - Number of elements in buffer
+             * @param[in] pUVWBuffer - u, v and w of all points
+             * @param[in] nRGBABufferSize - Number of elements in buffer
+             * @param[out] pRGBANeededCount - will be filled with the count of
+             * the written elements, or needed buffer size.
+             * @param[out] pRGBABuffer - red, green, blue and alpha of all
+             * points
+             */
+            void Sample(const Lib3MF_uint64 nUVWBufferSize,
+                        const Lib3MF_double* pUVWBuffer,
+                        Lib3MF_uint64 nRGBABufferSize,
+                        Lib3MF_uint64* pRGBANeededCount,
+                        Lib3MF_double* pRGBABuffer) override;
+        };
+
+    }  // namespace Impl
+}  // namespace Lib3MF
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+#endif  // __LIB3MF_IMAGE3DSAMPLER
@@ -0,0 +1,191 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium (Original Author)
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract: This is the class declaration of CImplicitEvaluator
+
+*/
+
+#ifndef __LIB3MF_IMPLICITEVALUATOR
+#define __LIB3MF_IMPLICITEVALUATOR
+
+#include "lib3mf_interfaces.hpp"
+
+// Parent classes
+#include "lib3mf_base.hpp"
+
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4250)
+#endif
+
+// Include custom headers here.
+#include "Model/Classes/NMR_ModelImplicitEvaluator.h"
+
+namespace Lib3MF
+{
+    namespace Impl
+    {
+
+        /*************************************************************************************************************************
+         Class declaration of CImplicitEvaluator
+        **************************************************************************************************************************/
+
+        class CImplicitEvaluator : public virtual IImplicitEvaluator, public virtual CBase
+        {
+           private:
+            /**
+             * Put private members here.
+             */
+            NMR::PModelImplicitEvaluator m_pEvaluator;
+
+            // Returns the number of points in an input buffer
+            Lib3MF_uint64 getPointCount(Lib3MF_uint64 nInputsBufferSize);
+
+            // Sets the needed output count and returns true, if the output
+            // buffer should be filled
+            bool prepareOutputs(Lib3MF_uint64 nPointCount,
+                                Lib3MF_uint64 nOutputsBufferSize,
+                                Lib3MF_uint64* pOutputsNeededCount,
+                                Lib3MF_double* pOutputsBuffer);
+
+           protected:
+            /**
+             * Put protected members here.
+             */
+
+           public:
+            /**
+             * Put additional public members here. They will not be visible in
+             * the external API.
+             */
+
+            CImplicitEvaluator() = delete;
+            CImplicitEvaluator(NMR::PModelImplicitEvaluator pEvaluator);
+
+            /**
+             * Public member functions to implement.
+             */
+
+            /**
+             * IImplicitEvaluator::GetInputStride - Returns the number of input
+             * values per point
+             * @return number of input values per point
+             */
+            Lib3MF_uint32 GetInputStride() override;
+
+            /**
+             * IImplicitEvaluator::GetOutputStride - Returns the number of
+             * output values per point
+             * @return number of output values per point
+             */
+            Lib3MF_uint32 GetOutputStride() override;
+
+            /**
+             * IImplicitEvaluator::SetWorkerThreadCount - Sets the number of
+             * threads used by Evaluate
+             * @param[in] nThreadCount - number of threads, 0 selects the
+             * number of hardware threads
+             */
+            void SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount) override;
+
+            /**
+             * IImplicitEvaluator::GetWorkerThreadCount - Returns the number of
+             * threads used by Evaluate
+             * @return number of threads
+             */
+            Lib3MF_uint32 GetWorkerThreadCount() override;
+
+            /**
+             * IImplicitEvaluator::Evaluate - Evaluates the function for a
+             * batch of points
+             * @param[in] nInputsBufferSize - Number of elements in buffer
+             * @param[in] pInputsBuffer - input values of all points
+             * @param[in] nOutputsBufferSize - Number of elements in buffer
+             * @param[out] pOutputsNeededCount - will be filled with the count
+             * of the written elements, or needed buffer size.
+             * @param[out] pOutputsBuffer - output values of all points
+             */
+            void Evaluate(const Lib3MF_uint64 nInputsBufferSize,
+                          const Lib3MF_double* pInputsBuffer,
+                          Lib3MF_uint64 nOutputsBufferSize,
+                          Lib3MF_uint64* pOutputsNeededCount,
+                          Lib3MF_double* pOutputsBuffer) override;
+
+            /**
+             * IImplicitEvaluator::EvaluateBatch - Evaluates the function for a
+             * batch of points in structure-of-arrays layout
+             * @param[in] nInputsBufferSize - Number of elements in buffer
+             * @param[in] pInputsBuffer - input values of all points, one array
+             * per component
+             * @param[in] nOutputsBufferSize - Number of elements in buffer
+             * @param[out] pOutputsNeededCount - will be filled with the count
+             * of the written elements, or needed buffer size.
+             * @param[out] pOutputsBuffer - output values of all points, one
+             * array per component
+             */
+            void EvaluateBatch(const Lib3MF_uint64 nInputsBufferSize,
+                               const Lib3MF_double* pInputsBuffer,
+                               Lib3MF_uint64 nOutputsBufferSize,
+                               Lib3MF_uint64* pOutputsNeededCount,
+                               Lib3MF_double* pOutputsBuffer) override;
+
+            /**
+             * IImplicitEvaluator::EvaluateBounds - Computes bounds of the
+             * function outputs for boxes of input values
+             * @param[in] nInputMinimaBufferSize - Number of elements in buffer
+             * @param[in] pInputMinimaBuffer - minimal input values of all boxes
+             * @param[in] nInputMaximaBufferSize - Number of elements in buffer
+             * @param[in] pInputMaximaBuffer - maximal input values of all boxes
+             * @param[in] nOutputMinimaBufferSize - Number of elements in buffer
+             * @param[out] pOutputMinimaNeededCount - will be filled with the
+             * count of the written elements, or needed buffer size.
+             * @param[out] pOutputMinimaBuffer - lower bounds of the outputs of
+             * all boxes
+             * @param[in] nOutputMaximaBufferSize - Number of elements in buffer
+             * @param[out] pOutputMaximaNeededCount - will be filled with the
+             * count of the written elements, or needed buffer size.
+             * @param[out] pOutputMaximaBuffer - upper bounds of the outputs of
+             * all boxes
+             */
+            void EvaluateBounds(const Lib3MF_uint64 nInputMinimaBufferSize,
+                                const Lib3MF_double* pInputMinimaBuffer,
+                                const Lib3MF_uint64 nInputMaximaBufferSize,
+                                const Lib3MF_double* pInputMaximaBuffer,
+                                Lib3MF_uint64 nOutputMinimaBufferSize,
+                                Lib3MF_uint64* pOutputMinimaNeededCount,
+                                Lib3MF_double* pOutputMinimaBuffer,
+                                Lib3MF_uint64 nOutputMaximaBufferSize,
+                                Lib3MF_uint64* pOutputMaximaNeededCount,
+                                Lib3MF_double* pOutputMaximaBuffer) override;
+        };
+
+    }  // namespace Impl
+}  // namespace Lib3MF
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+#endif  // __LIB3MF_IMPLICITEVALUATOR
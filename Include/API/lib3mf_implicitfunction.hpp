@@ -784,6 +784,13 @@ namespace Lib3MF
              * topologically
              */
             void SortNodesTopologically() override;
+
+            /**
+             * IImplicitFunction::CreateEvaluator - Compiles the function into
+             * an evaluator
+             * @return the evaluator
+             */
+            IImplicitEvaluator* CreateEvaluator() override;
         };
 
     }  // namespace Impl
@@ -94,6 +94,10 @@ public:
 
 	virtual void GetVertices(Lib3MF_uint64 nVerticesBufferSize, Lib3MF_uint64* pVerticesNeededCount, sLib3MFPosition * pVerticesBuffer) override;
 
+	Lib3MF_uint32 GetVertexPageCount() override;
+
+	Lib3MF_pvoid GetVertexPage(const Lib3MF_uint32 nPageIndex, Lib3MF_uint32 & nVertexCount, Lib3MF_uint32 & nStride) override;
+
 	sLib3MFTriangle GetTriangle (const Lib3MF_uint32 nIndex) override;
 
 	void SetTriangle (const Lib3MF_uint32 nIndex, const sLib3MFTriangle Indices) override;
@@ -102,10 +106,18 @@ public:
 
 	void GetTriangleIndices (Lib3MF_uint64 nIndicesBufferSize, Lib3MF_uint64* pIndicesNeededCount, sLib3MFTriangle * pIndicesBuffer) override;
 
+	Lib3MF_uint32 GetTrianglePageCount() override;
+
+	Lib3MF_pvoid GetTrianglePage(const Lib3MF_uint32 nPageIndex, Lib3MF_uint32 & nTriangleCount, Lib3MF_uint32 & nStride) override;
+
 	void SetGeometry(const Lib3MF_uint64 nVerticesBufferSize, const sLib3MFPosition * pVerticesBuffer, const Lib3MF_uint64 nIndicesBufferSize, const sLib3MFTriangle * pIndicesBuffer) override;
 
+	void ReserveGeometry(const Lib3MF_uint32 nVertexCount, const Lib3MF_uint32 nTriangleCount, const Lib3MF_uint32 nBeamCount) override;
+
 	bool IsManifoldAndOriented() override;
 
+	bool IsGeometryLoaded() override;
+
 	bool IsMeshObject() override;
 
 	bool IsComponentsObject() override;
@@ -96,6 +96,16 @@ public:
 
 	bool GetStrictModeActive ();
 
+	void SetWorkerThreadCount (const Lib3MF_uint32 nThreadCount);
+
+	Lib3MF_uint32 GetWorkerThreadCount ();
+
+	void SetMeshStreamCallbacks (const Lib3MF::VertexBlockCallback pTheVertexBlockCallback, const Lib3MF::TriangleBlockCallback pTheTriangleBlockCallback, const bool bRetainGeometry, const Lib3MF_pvoid pUserData);
+
+	void SetLazyMeshLoadingActive (const bool bLazyMeshLoadingActive);
+
+	bool GetLazyMeshLoadingActive ();
+
 	std::string GetWarning (const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErrorCode);
 
 	Lib3MF_uint32 GetWarningCount ();
@@ -100,6 +100,18 @@ public:
 
 	void SetDecimalPrecision(const Lib3MF_uint32 nDecimalPrecision) override;
 
+	void SetShortestRoundtripActive(const bool bShortestRoundtripActive) override;
+
+	bool GetShortestRoundtripActive() override;
+
+	void SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount) override;
+
+	Lib3MF_uint32 GetWorkerThreadCount() override;
+
+	void SetCompressionLevel(const Lib3MF::ePackagePartType ePartType, const Lib3MF::eCompressionLevel eLevel) override;
+
+	Lib3MF::eCompressionLevel GetCompressionLevel(const Lib3MF::ePackagePartType ePartType) override;
+
 	void AddKeyWrappingCallback(const std::string & sConsumerID, const Lib3MF::KeyWrappingCallback pTheCallback, const Lib3MF_pvoid pUserData) override;
 
 	void SetContentEncryptionCallback(const Lib3MF::ContentEncryptionCallback pTheCallback, const Lib3MF_pvoid pUserData) override;
@@ -0,0 +1,91 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_VectorHashGrid.h defines an open addressing hash grid to identify vectors by their
+position. It offers the same interface as CVectorTree with constant lookup time.
+
+--*/
+
+#ifndef __NMR_VECTORHASHGRID
+#define __NMR_VECTORHASHGRID
+
+#include "Common/Math/NMR_Geometry.h" 
+#include "Common/NMR_Types.h" 
+
+#include <vector>
+
+#define NMR_VECTORHASHGRID_MINCAPACITY 16
+
+namespace NMR {
+
+	typedef struct {
+		NVEC3I m_position;
+		nfUint32 m_value;
+		nfUint32 m_bOccupied;
+	} VECTORHASHGRIDENTRY;
+
+	class CVectorHashGrid {
+	private:
+		nfFloat m_fUnits;
+		std::vector<VECTORHASHGRIDENTRY> m_entries;
+		nfUint32 m_nCount;
+		nfUint32 m_nMask;
+
+		nfUint32 hashPosition(_In_ const NVEC3I & vPosition) const;
+		_Success_(return) nfBool findSlot(_In_ const NVEC3I & vPosition, _Out_ nfUint32 & nSlot) const;
+		void rehash(_In_ nfUint32 nCapacity);
+	public:
+		CVectorHashGrid();
+		CVectorHashGrid(_In_ nfFloat fUnits);
+
+		nfFloat getUnits();
+		void setUnits(_In_ nfFloat fUnits);
+
+		// Prepares the grid for nCount vectors, so that no rehashing is needed while adding them
+		void reserve(_In_ nfUint32 nCount);
+		nfUint32 getCount();
+
+		_Success_(return) nfBool findVector2(_In_ NVEC2 vVector, _Out_opt_ nfUint32 & value);
+		_Success_(return) nfBool findVector3(_In_ NVEC3 vVector, _Out_opt_ nfUint32 & value);
+		_Success_(return) nfBool findIntVector2(_In_ NVEC2I vVector, _Out_opt_ nfUint32 & value);
+		_Success_(return) nfBool findIntVector3(_In_ NVEC3I vVector, _Out_opt_ nfUint32 & value);
+
+		void addVector2(_In_ NVEC2 vVector, _In_ nfUint32 value);
+		void addVector3(_In_ NVEC3 vVector, _In_ nfUint32 value);
+		void addIntVector2(_In_ NVEC2I vVector, _In_ nfUint32 value);
+		void addIntVector3(_In_ NVEC3I vVector, _In_ nfUint32 value);
+
+		void removeVector2(_In_ NVEC2 vVector);
+		void removeVector3(_In_ NVEC3 vVector);
+		void removeIntVector2(_In_ NVEC2I vVector);
+		void removeIntVector3(_In_ NVEC3I vVector);
+	};
+
+}
+
+#endif // __NMR_VECTORHASHGRID
@@ -49,8 +49,13 @@ You can only add nodes and faces to mesh. You cannot remove the existing structu
 
 #include <map>
 
+// Number of face chunks and edge buckets per thread of the manifold check
+#define NMR_MESH_MANIFOLDCHECK_TASKSPERTHREAD 4
+
 namespace NMR {
 
+	class CThreadPool;
+
 	class CMesh {
 	private:
 		MESHNODES m_Nodes;
@@ -60,6 +65,17 @@ namespace NMR {
 
 
 		PMeshInformationHandler m_pMeshInformationHandler;
+
+		// Modification generation, and the generations the cached results belong to
+		nfUint64 m_nGeneration;
+		nfUint64 m_nManifoldCheckGeneration;
+		nfBool m_bManifoldAndOriented;
+		nfUint64 m_nOutboxGeneration;
+		NMATRIX3 m_mOutboxMatrix;
+		NOUTBOX3 m_vOutbox;
+
+		void initializeCache();
+		nfBool checkManifoldAndOriented(_In_opt_ CThreadPool * pThreadPool);
 	public:
 		CMesh();
 		CMesh(_In_opt_ CMesh * pMesh);
@@ -77,6 +93,9 @@ namespace NMR {
 			_In_ nfInt32 eCapMode1, _In_ nfInt32 eCapMode2);
 		_Ret_notnull_ MESHBALL * addBall(_In_ MESHNODE * pNode, _In_ nfDouble dRadius);
 		_Ret_notnull_ PBEAMSET addBeamSet();
+
+		// Preallocates storage, so that the given total numbers of elements can be added without further allocations.
+		void reserve(_In_ nfUint32 nNodeCount, _In_ nfUint32 nFaceCount, _In_ nfUint32 nBeamCount);
 		
 		nfUint32 getNodeCount();
 		nfUint32 getFaceCount();
@@ -86,12 +105,25 @@ namespace NMR {
 		nfUint32 getOccupiedNodeCount();
 		nfBool isNodeOccupied(_In_ nfUint32 nIdx);
 
+		// Writable access to single elements, this counts as a modification of the mesh.
 		_Ret_notnull_ MESHNODE * getNode(_In_ nfUint32 nIdx);
 		_Ret_notnull_ MESHFACE * getFace(_In_ nfUint32 nIdx);
 		_Ret_notnull_ MESHBEAM * getBeam(_In_ nfUint32 nIdx);
 		_Ret_notnull_ MESHBALL * getBall(_In_ nfUint32 nIdx);
+		// Read access to single elements, which keeps the cached results of the mesh valid.
+		_Ret_notnull_ const MESHNODE * readNode(_In_ nfUint32 nIdx);
+		_Ret_notnull_ const MESHFACE * readFace(_In_ nfUint32 nIdx);
+		_Ret_notnull_ const MESHBEAM * readBeam(_In_ nfUint32 nIdx);
+		_Ret_notnull_ const MESHBALL * readBall(_In_ nfUint32 nIdx);
 		_Ret_notnull_ PBEAMSET getBeamSet(_In_ nfUint32 nIdx);
-		_Ret_notnull_ MESHNODE * getOccupiedNode(_In_ nfUint32 nIdx);
+		_Ret_notnull_ const MESHNODE * getOccupiedNode(_In_ nfUint32 nIdx);
+
+		// Read access to the paged node and face storage, valid until the mesh is modified.
+		// The pages are handed out as const, as writes to them would bypass markModified().
+		nfUint32 getNodeBlockCount();
+		nfUint32 getFaceBlockCount();
+		_Ret_notnull_ const MESHNODE * getNodeBlock(_In_ nfUint32 nBlockIdx, _Out_ nfUint32 & nNodeCount);
+		_Ret_notnull_ const MESHFACE * getFaceBlock(_In_ nfUint32 nBlockIdx, _Out_ nfUint32 & nFaceCount);
 
 		void setBeamLatticeMinLength(nfDouble dMinLength);
 		nfDouble getBeamLatticeMinLength();
@@ -110,6 +142,15 @@ namespace NMR {
 
 		nfBool checkSanity();
 
+		// The generation changes with every modification of the mesh, including every writable
+		// access to a node, face, beam or ball.
+		nfUint64 getGeneration();
+		void markModified();
+
+		// Checks that every edge is shared by exactly two faces with opposite orientation.
+		// Stops at the first edge that violates this. Runs in parallel, if a thread pool is given.
+		nfBool isManifoldAndOriented(_In_opt_ CThreadPool * pThreadPool);
+
 		void clear();
 		void clearBeamLattice();
 		void clearBeamLatticeBeams();
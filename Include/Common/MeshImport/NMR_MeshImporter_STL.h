@@ -42,6 +42,8 @@ This is a derived class for Importing the binary STL and color STL Mesh Format.
 
 #include <vector>
 
+#define NMR_MESHIMPORTER_STL_MAXRESERVEDNODES (1 << 20)
+
 namespace NMR {
 
 #pragma pack (1)
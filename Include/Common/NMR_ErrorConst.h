@@ -302,6 +302,12 @@ NMR_ErrorConst.h defines all error code constants.
 // Too many slices
 #define NMR_ERROR_TOOMANYSLICES 0x1053
 
+// A file could not be mapped into memory
+#define NMR_ERROR_COULDNOTMAPFILE 0x1054
+
+// A memory-mapped file has been truncated while it is in use
+#define NMR_ERROR_MAPPEDFILETRUNCATED 0x1055
+
 /*-------------------------------------------------------------------
 Core framework error codes (0x2XXX)
 -------------------------------------------------------------------*/
@@ -1250,6 +1256,15 @@ Model error codes (0x8XXX)
 // A keystore element is not base64 encoded
 #define NMR_ERROR_KEYSTOREINVALIDENCODING 0x810E
 
+// Streamed mesh geometry is not retained, but required by the mesh content
+#define NMR_ERROR_MESHSTREAMGEOMETRYREQUIRED 0x810F
+
+// The call is not allowed in the current state of the streaming writer
+#define NMR_ERROR_STREAMWRITERINVALIDSTATE 0x8110
+
+// An object is not valid for its object type, e.g. a mesh of type model is not manifold and oriented
+#define NMR_ERROR_INVALIDMODELOBJECT 0x8111
+
 // errors for the volumetric extension 0x88xx
 
 // Invalid Image3D Size
@@ -1477,6 +1492,24 @@ Model error codes (0x8XXX)
 // Duplicate attribute mesh id in levelset element
 #define NMR_ERROR_DUPLICATE_BOUNDARY_SHAPE_MESH_ID 0x884A
 
+// Levelset has no mesh as evaluation domain
+#define NMR_ERROR_LEVELSET_MISSING_MESH 0x884B
+
+// Levelset function can not be evaluated
+#define NMR_ERROR_LEVELSET_UNSUPPORTED_FUNCTION 0x884C
+
+// Levelset channel is not a scalar output of the function
+#define NMR_ERROR_LEVELSET_INVALID_CHANNEL 0x884D
+
+// Image3D sheet is not a valid PNG image
+#define NMR_ERROR_INVALIDPNGIMAGE 0x884E
+
+// Image3D sheet does not match the size of the image stack
+#define NMR_ERROR_IMAGE3DSHEETSIZEMISMATCH 0x884F
+
+// Image3D sheet has not been set
+#define NMR_ERROR_MISSINGIMAGE3DSHEET 0x8850
+
 
 /*-------------------------------------------------------------------
 XML Parser Error Constants (0x9XXX)
@@ -1557,6 +1590,12 @@ XML Parser Error Constants (0x9XXX)
 // A matindices attribute is duplicated
 #define NMR_ERROR_DUPLICATE_MATINDICES_ATTRIBUTE 0x9019
 
+// Raw access to the XML stream is not possible at the current position
+#define NMR_ERROR_XMLPARSER_RAWACCESSNOTPOSSIBLE 0x901A
+
+// An XML element with its attributes does not fit into the buffer of the reader
+#define NMR_ERROR_XMLPARSER_ENTITYEXCEEDSBUFFER 0x901B
+
 //
 
 
@@ -0,0 +1,89 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_NumberFormat.h declares allocation free conversions of numbers into character buffers,
+which are used by the mesh writer for its vertex and triangle lines.
+
+--*/
+
+#ifndef __NMR_NUMBERFORMAT
+#define __NMR_NUMBERFORMAT
+
+#include "Common/NMR_Types.h"
+#include "Common/Platform/NMR_SAL.h"
+
+#include <string.h>
+
+// Maximum length of an unsigned 32 bit integer in decimal notation
+#define NMR_NUMBERFORMAT_MAXUINT32LENGTH 10
+
+namespace NMR {
+
+	// Writes nValue in decimal notation without terminating zero and returns the number of characters written.
+	// pBuffer must have space for NMR_NUMBERFORMAT_MAXUINT32LENGTH characters.
+	inline nfUint32 fnUInt32ToBuffer(_In_ nfUint32 nValue, _Out_ nfChar * pBuffer)
+	{
+		static const nfChar DigitPairs[] =
+			"00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+			"40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+			"8081828384858687888990919293949596979899";
+
+		nfChar Digits[NMR_NUMBERFORMAT_MAXUINT32LENGTH];
+		nfChar * pDigits = Digits + NMR_NUMBERFORMAT_MAXUINT32LENGTH;
+
+		while (nValue >= 100) {
+			nfUint32 nPair = (nValue % 100) * 2;
+			nValue /= 100;
+			pDigits -= 2;
+			pDigits[0] = DigitPairs[nPair];
+			pDigits[1] = DigitPairs[nPair + 1];
+		}
+
+		if (nValue >= 10) {
+			pDigits -= 2;
+			pDigits[0] = DigitPairs[nValue * 2];
+			pDigits[1] = DigitPairs[nValue * 2 + 1];
+		}
+		else {
+			pDigits--;
+			pDigits[0] = (nfChar)('0' + nValue);
+		}
+
+		nfUint32 nLength = (nfUint32)(Digits + NMR_NUMBERFORMAT_MAXUINT32LENGTH - pDigits);
+		memcpy(pBuffer, pDigits, nLength);
+		return nLength;
+	}
+
+	// Write the shortest decimal representation in fixed notation, which reads back as exactly the same value.
+	// Return the number of characters written, or throw NMR_ERROR_COULDNOTCONVERTNUMBER if cbBufferSize does not suffice.
+	nfUint32 fnFloatToShortestBuffer(_In_ nfFloat fValue, _Out_ nfChar * pBuffer, _In_ nfUint32 cbBufferSize);
+	nfUint32 fnDoubleToShortestBuffer(_In_ nfDouble dValue, _Out_ nfChar * pBuffer, _In_ nfUint32 cbBufferSize);
+
+}
+
+#endif // __NMR_NUMBERFORMAT
@@ -0,0 +1,64 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_PNGDecoder.h defines a decoder for PNG images, which are used as sheets of
+image stacks. All color types, bit depths and interlacing of the PNG standard are
+supported, ancillary chunks except for transparency are ignored.
+
+--*/
+
+#ifndef __NMR_PNGDECODER
+#define __NMR_PNGDECODER
+
+#include "Common/NMR_Types.h"
+#include "Common/Platform/NMR_SAL.h"
+
+#include <vector>
+
+// Upper limit of width * height of a decoded image
+#define NMR_PNG_MAXPIXELCOUNT (1 << 28)
+
+namespace NMR {
+
+	// Decoded image with interleaved samples, rows from top to bottom.
+	// Palette images are expanded to RGB(A), transparency chunks add an alpha channel.
+	struct sPNGImage {
+		nfUint32 m_nWidth;
+		nfUint32 m_nHeight;
+		// 1: gray, 2: gray and alpha, 3: RGB, 4: RGBA
+		nfUint32 m_nChannelCount;
+		// 8 or 16, lower bit depths are scaled to 8 bit
+		nfUint32 m_nBitDepth;
+		std::vector<nfUint16> m_Samples;
+	};
+
+	void fnDecodePNG(_In_ const nfByte * pData, _In_ nfUint64 cbSize, _Out_ sPNGImage & Image);
+
+}
+
+#endif // __NMR_PNGDECODER
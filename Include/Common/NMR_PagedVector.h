@@ -28,6 +28,8 @@ Abstract:
 
 NMR_PagedVector.h defines a vector class which allocates its memory block-wise, leading to 
 significant performance improvements against a standard template library vector.
+Each block is twice as large as its predecessor, until NMR_PAGEDVECTOR_MAXBLOCKSIZE is
+reached, so that large vectors only need few allocations while small vectors stay small.
 
 --*/
 
@@ -41,30 +43,91 @@ significant performance improvements against a standard template library vector.
 
 #include <array>
 
+// Blocks stop growing at this number of elements (must be a power of two)
+#define NMR_PAGEDVECTOR_MAXBLOCKSIZE 65536
+
 namespace NMR {
 
 	template <class T, unsigned int DEFAULTBLOCKSIZE = 1024>
 	class CPagedVector {
 		nfUint32 m_nBlockSize;
+		nfUint32 m_nBlockShift;
+		nfUint32 m_nGrowingBlockCount;
+		nfUint32 m_nGrowingElementCount;
 		nfUint32 m_nCount;
+		nfUint32 m_nUsedBlockCount;
+		nfUint32 m_nHeadIndex;
+		nfUint32 m_nHeadSize;
 		T * m_pHeadBlock;
 		std::vector<T *> m_pBlocks;
-	public:
 
-		CPagedVector() {
+		static nfUint32 floorLog2(_In_ nfUint32 nValue) {
+#ifdef __GNUC__
+			return 31 - __builtin_clz(nValue);
+#else
+			nfUint32 nResult = 0;
+			while (nValue >>= 1)
+				nResult++;
+			return nResult;
+#endif
+		}
+
+		void initialize(_In_ nfUint32 nBlockSize) {
+			// The block size must be a power of two, to locate elements without division
+			if ((nBlockSize == 0) || ((nBlockSize & (nBlockSize - 1)) != 0) || (nBlockSize > NMR_PAGEDVECTOR_MAXBLOCKSIZE))
+				throw CNMRException(NMR_ERROR_INVALIDBLOCKSIZE);
+
+			m_nBlockSize = nBlockSize;
+			m_nBlockShift = floorLog2(nBlockSize);
+			m_nGrowingBlockCount = floorLog2(NMR_PAGEDVECTOR_MAXBLOCKSIZE) - m_nBlockShift;
+			m_nGrowingElementCount = NMR_PAGEDVECTOR_MAXBLOCKSIZE - nBlockSize;
 			m_nCount = 0;
+			m_nUsedBlockCount = 0;
+			m_nHeadIndex = 0;
+			m_nHeadSize = 0;
 			m_pHeadBlock = NULL;
-			m_nBlockSize = DEFAULTBLOCKSIZE;
-			if (m_nBlockSize == 0)
-				throw CNMRException(NMR_ERROR_INVALIDBLOCKSIZE);
+		}
+
+		nfUint32 getBlockCapacity(_In_ nfUint32 nBlockIdx) {
+			if (nBlockIdx < m_nGrowingBlockCount)
+				return m_nBlockSize << nBlockIdx;
+			return NMR_PAGEDVECTOR_MAXBLOCKSIZE;
+		}
+
+		nfUint64 getBlockStart(_In_ nfUint32 nBlockIdx) {
+			if (nBlockIdx < m_nGrowingBlockCount)
+				return ((nfUint64)m_nBlockSize << nBlockIdx) - m_nBlockSize;
+			return (nfUint64)m_nGrowingElementCount + (nfUint64)(nBlockIdx - m_nGrowingBlockCount) * NMR_PAGEDVECTOR_MAXBLOCKSIZE;
+		}
+
+		T * locate(_In_ nfUint32 nIdx) {
+			if (nIdx < m_nGrowingElementCount) {
+				nfUint32 nBlockIdx = floorLog2((nIdx >> m_nBlockShift) + 1);
+				return &m_pBlocks[nBlockIdx][nIdx - (nfUint32)getBlockStart(nBlockIdx)];
+			}
+
+			nfUint32 nOffset = nIdx - m_nGrowingElementCount;
+			return &m_pBlocks[m_nGrowingBlockCount + nOffset / NMR_PAGEDVECTOR_MAXBLOCKSIZE][nOffset % NMR_PAGEDVECTOR_MAXBLOCKSIZE];
+		}
+
+		void nextBlock() {
+			if (m_nUsedBlockCount == m_pBlocks.size())
+				m_pBlocks.push_back(new T[getBlockCapacity(m_nUsedBlockCount)]);
+
+			m_pHeadBlock = m_pBlocks[m_nUsedBlockCount];
+			m_nHeadSize = getBlockCapacity(m_nUsedBlockCount);
+			m_nHeadIndex = 0;
+			m_nUsedBlockCount++;
+		}
+
+	public:
+
+		CPagedVector() {
+			initialize(DEFAULTBLOCKSIZE);
 		}
 
 		CPagedVector(_In_ nfUint32 nBlockSize) {
-			m_nCount = 0;
-			m_pHeadBlock = NULL;
-			m_nBlockSize = nBlockSize;
-			if (m_nBlockSize == 0)
-				throw CNMRException(NMR_ERROR_INVALIDBLOCKSIZE);
+			initialize(nBlockSize);
 		}
 
 		~CPagedVector() {
@@ -76,15 +139,12 @@ namespace NMR {
 		}
 
 		_Ret_notnull_ T * allocData() {
-			nfUint32 nIdx = (m_nCount % m_nBlockSize);
-
 			// Allocate new node block if necessary
-			if (nIdx == 0) {
-				m_pHeadBlock = new T[m_nBlockSize];
-				m_pBlocks.push_back(m_pHeadBlock);
-			}
+			if (m_nHeadIndex == m_nHeadSize)
+				nextBlock();
 
-			T * pResult = &m_pHeadBlock[nIdx];
+			T * pResult = &m_pHeadBlock[m_nHeadIndex];
+			m_nHeadIndex++;
 			m_nCount++;
 
 			return pResult;
@@ -96,34 +156,41 @@ namespace NMR {
 		}
 
 		T& allocDataRef(_Out_ nfUint32& nNewIndex) {
-			nfUint32 nIdx = (m_nCount % m_nBlockSize);
-
-			// Allocate new node block if necessary
-			if (nIdx == 0) {
-				m_pHeadBlock = new T[m_nBlockSize];
-				m_pBlocks.push_back(m_pHeadBlock);
-			}
-
 			nNewIndex = m_nCount;
-			m_nCount++;
-
-			return m_pHeadBlock[nIdx];
+			return *allocData();
 		}
 
 		_Ret_notnull_ T * getData(_In_ nfUint32 nIdx) {
 			if (nIdx >= m_nCount)
 				throw CNMRException(NMR_ERROR_INVALIDINDEX);
 
-			T * block = m_pBlocks[nIdx / m_nBlockSize];
-			return &block[nIdx % m_nBlockSize];
+			return locate(nIdx);
 		}
 
 		T& getDataRef(_In_ nfUint32 nIdx) {
 			if (nIdx >= m_nCount)
 				throw CNMRException(NMR_ERROR_INVALIDINDEX);
 
-			T* block = m_pBlocks[nIdx / m_nBlockSize];
-			return block[nIdx % m_nBlockSize];
+			return *locate(nIdx);
+		}
+
+		// Allocates all blocks that are needed to store nCount elements in total.
+		void reserve(_In_ nfUint32 nCount) {
+			nfUint32 nBlockCount = (nfUint32)m_pBlocks.size();
+			if (getBlockStart(nBlockCount) >= nCount)
+				return;
+
+			nfUint32 nNeededBlockCount = nBlockCount;
+			while (getBlockStart(nNeededBlockCount) < nCount)
+				nNeededBlockCount++;
+
+			m_pBlocks.reserve(nNeededBlockCount);
+			for (nfUint32 nBlockIdx = nBlockCount; nBlockIdx < nNeededBlockCount; nBlockIdx++)
+				m_pBlocks.push_back(new T[getBlockCapacity(nBlockIdx)]);
+		}
+
+		nfUint64 getCapacity() {
+			return getBlockStart((nfUint32)m_pBlocks.size());
 		}
 
 		void clearAllData() {
@@ -135,12 +202,32 @@ namespace NMR {
 
 			m_pBlocks.clear();
 			m_nCount = 0;
+			m_nUsedBlockCount = 0;
+			m_nHeadIndex = 0;
+			m_nHeadSize = 0;
 			m_pHeadBlock = NULL;
 		}
 
 		nfUint32 getBlockSize() {
 			return m_nBlockSize;
 		}
+
+		nfUint32 getBlockCount() {
+			return m_nUsedBlockCount;
+		}
+
+		// Returns the storage of a block; nElementCount receives the number of used elements in it.
+		_Ret_notnull_ T * getBlock(_In_ nfUint32 nBlockIdx, _Out_ nfUint32 & nElementCount) {
+			if (nBlockIdx >= m_nUsedBlockCount)
+				throw CNMRException(NMR_ERROR_INVALIDINDEX);
+
+			nfUint32 nBlockStart = (nfUint32)getBlockStart(nBlockIdx);
+			nElementCount = m_nCount - nBlockStart;
+			if (nElementCount > getBlockCapacity(nBlockIdx))
+				nElementCount = getBlockCapacity(nBlockIdx);
+
+			return m_pBlocks[nBlockIdx];
+		}
 	};
 
 }
@@ -62,6 +62,18 @@ namespace NMR {
 	nfUint32 fnStringToUint32(_In_z_ const nfChar * pszValue);
 	nfFloat fnStringToFloat(_In_z_ const nfChar * pszValue);
 	nfDouble fnStringToDouble(_In_z_ const nfChar * pszValue);
+
+	// Length-aware variants for callers which already know the length of the zero-terminated value.
+	// fnStringToInt32 takes a SWAR fast path for plain decimals of up to nine digits.
+	nfInt32 fnStringToInt32(_In_z_ const nfChar * pszValue, _In_ nfUint32 nLength);
+	nfFloat fnStringToFloat(_In_z_ const nfChar * pszValue, _In_ nfUint32 nLength);
+	nfDouble fnStringToDouble(_In_z_ const nfChar * pszValue, _In_ nfUint32 nLength);
+
+	// SWAR parser for plain decimals of 1 to 9 digits, which need not be zero-terminated.
+	// Returns false for signs, spaces, other characters and longer values, without throwing.
+	nfBool fnStringToShortDecimal(_In_ const nfChar * pValue, _In_ nfUint32 nLength, _Out_ nfUint32 & nValue);
+	// Converts eight right-aligned ASCII digits, as loaded from memory with the given byte order.
+	nfBool fnDecimalChunkToUint32(_In_ nfUint64 nChunk, _In_ nfBool bBigEndian, _Out_ nfUint32 & nValue);
 	nfBool fnStringToSRGBColor(_In_z_ const nfChar * pszValue, _Out_ nfColor & cResult);
 	nfUint32 fnHexStringToUint32(_In_z_ const nfChar * pszValue);
 
@@ -0,0 +1,93 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ThreadPool.h defines a simple pool of worker threads, which distributes a fixed
+number of independent tasks over all workers and the calling thread.
+
+--*/
+
+#ifndef __NMR_THREADPOOL
+#define __NMR_THREADPOOL
+
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+
+#include <condition_variable>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace NMR {
+
+	typedef std::function<void(nfUint32 nTaskIndex)> ThreadPoolTask;
+
+	class CThreadPool {
+	private:
+		std::vector<std::thread> m_Workers;
+		std::mutex m_Mutex;
+		std::condition_variable m_WakeCondition;
+		std::condition_variable m_DoneCondition;
+
+		const ThreadPoolTask * m_pTask;
+		nfUint32 m_nTaskCount;
+		nfUint32 m_nNextTask;
+		nfUint32 m_nPendingTasks;
+		nfBool m_bShutdown;
+
+		std::exception_ptr m_pException;
+		nfUint32 m_nExceptionTask;
+
+		void workerLoop();
+		void processTasks(_In_ std::unique_lock<std::mutex> & Lock);
+
+	public:
+		// nThreadCount is the total number of threads, including the calling thread.
+		CThreadPool(_In_ nfUint32 nThreadCount);
+		~CThreadPool();
+
+		CThreadPool(const CThreadPool &) = delete;
+		CThreadPool & operator=(const CThreadPool &) = delete;
+
+		nfUint32 getThreadCount();
+
+		// Calls fnTask for every index in [0, nTaskCount) and returns when all tasks are done.
+		// If tasks throw, the exception of the task with the lowest index is rethrown.
+		// Must not be called concurrently or from within a task.
+		void runTasks(_In_ nfUint32 nTaskCount, _In_ const ThreadPoolTask & fnTask);
+
+		static nfUint32 getHardwareThreadCount();
+	};
+
+	typedef std::shared_ptr<CThreadPool> PThreadPool;
+
+}
+
+#endif // __NMR_THREADPOOL
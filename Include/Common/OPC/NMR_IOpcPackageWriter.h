@@ -15,7 +15,7 @@ namespace NMR {
 
 	class IOpcPackageWriter {
 	public:
-		virtual POpcPackagePart addPart(_In_ std::string sPath) = 0;
+		virtual POpcPackagePart addPart(_In_ std::string sPath, _In_ nfInt32 nCompressionLevel) = 0;
 		virtual void addContentType(_In_ std::string sExtension, _In_ std::string sContentType) = 0;
 		virtual void addContentType(_In_ POpcPackagePart pOpcPackagePart, _In_ std::string sContentType) = 0;
 		virtual POpcPackageRelationship addRootRelationship(_In_ std::string sType, _In_ COpcPackagePart * pTargetPart) = 0;
@@ -40,6 +40,7 @@ NMR_OpcPackageReader.h defines an OPC Package reader in a portable way.
 #include "Common/OPC/NMR_OpcPackageRelationship.h"
 #include "Common/3MF_ProgressMonitor.h"
 #include "Common/NMR_ModelWarnings.h"
+#include "Common/Platform/NMR_ImportStream_MemoryMapped.h"
 #include "zip.h"
 #include <list>
 #include <vector>
@@ -60,12 +61,18 @@ namespace NMR {
 		std::map <std::string, nfUint64> m_ZIPEntries;
 		std::map <std::string, POpcPackagePart> m_Parts;
 
+		// Stored entries of a memory-mapped package are handed out as views on the mapping.
+		// The data offsets are indexed like the ZIP entries, 0 marks entries without one.
+		PImportStream_MemoryMapped m_pMappedStream;
+		std::vector<nfUint64> m_MappedDataOffsets;
+
 		std::string m_relationShipExtension;
 		
 		std::map<std::string, std::string> m_ContentTypes;
 		std::list<POpcPackageRelationship> m_RootRelationships;
 
 		void releaseZIP();
+		void readMappedDataOffsets();
 
 		PImportStream openZIPEntry(_In_ std::string sName);
 		PImportStream openZIPEntryIndexed(_In_ nfUint64 nIndex);
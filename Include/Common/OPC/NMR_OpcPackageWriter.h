@@ -63,10 +63,10 @@ namespace NMR {
 		void writeRootRelationships();
 		std::string generateRelationShipID();
 	public:
-		COpcPackageWriter(_In_ PExportStream pExportStream);
+		COpcPackageWriter(_In_ PExportStream pExportStream, _In_ PThreadPool pThreadPool);
 		~COpcPackageWriter();
 
-		POpcPackagePart addPart(_In_ std::string sPath) override;
+		POpcPackagePart addPart(_In_ std::string sPath, _In_ nfInt32 nCompressionLevel) override;
 
 		void addContentType(_In_ std::string sExtension, _In_ std::string sContentType) override;
 		void addContentType(_In_ POpcPackagePart pOpcPackagePart, _In_ std::string sContentType) override;
@@ -0,0 +1,54 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_CPUFeatures.h detects the SIMD instruction sets, which the CPU and the operating system support,
+so that kernels compiled for several instruction sets can be selected at runtime.
+
+--*/
+
+#ifndef __NMR_CPUFEATURES
+#define __NMR_CPUFEATURES
+
+#include "Common/NMR_Types.h"
+#include "Common/Platform/NMR_SAL.h"
+
+namespace NMR {
+
+	enum eCPUInstructionSet {
+		CPUINSTRUCTIONSET_SSE2,
+		CPUINSTRUCTIONSET_AVX2,
+		CPUINSTRUCTIONSET_AVX512
+	};
+
+	// Checks the CPU and, for the AVX registers, the operating system support.
+	// Returns false on all targets other than x86.
+	nfBool fnCPUSupportsInstructionSet(_In_ eCPUInstructionSet InstructionSet);
+
+}
+
+#endif // __NMR_CPUFEATURES
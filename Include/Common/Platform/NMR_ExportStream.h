@@ -53,7 +53,7 @@ namespace NMR {
 		virtual nfUint64 getPosition () = 0;
 		virtual nfUint64 writeBuffer(_In_ const void * pBuffer, _In_ nfUint64 cbTotalBytesToWrite) = 0;
 		virtual void close();
-		void copyFrom(_In_ CImportStream * pImportStream, _In_ nfUint64 cbCount, _In_ nfUint32 cbBufferSize);
+		virtual void copyFrom(_In_ CImportStream * pImportStream, _In_ nfUint64 cbCount, _In_ nfUint32 cbBufferSize);
 	};
 
 	typedef std::shared_ptr <CExportStream> PExportStream;
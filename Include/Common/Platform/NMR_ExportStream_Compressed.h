@@ -51,7 +51,7 @@ namespace NMR {
 		nfInt32 compress(nfInt32 flush);
 	public:
 		CExportStream_Compressed() = delete;
-		CExportStream_Compressed(PExportStream pUncompressedStream);
+		CExportStream_Compressed(PExportStream pUncompressedStream, nfInt32 nCompressionLevel = Z_DEFAULT_COMPRESSION);
 		~CExportStream_Compressed();
 
 		virtual nfBool seekPosition(_In_ nfUint64 position, _In_ nfBool bHasToSucceed);
@@ -36,13 +36,21 @@ NMR_PortableZIPWriter.h defines a portable stream to write into ZIP files
 #include "Common/NMR_Types.h"
 #include "Common/Platform/NMR_ExportStream.h"
 #include "Common/Platform/NMR_PortableZIPWriter.h"
+#include "Common/NMR_ThreadPool.h"
 #include "zlib.h"
 
 #include <array>
+#include <vector>
 
 #define ZIPEXPORTBUFFERSIZE 65536
 #define ZIPEXPORTWRITECHUNKSIZE 1048576
 
+// Block compression with a thread pool: every block is deflated independently,
+// primed with the preceding window of uncompressed data as dictionary.
+#define ZIPEXPORTBLOCKSIZE 131072
+#define ZIPEXPORTBLOCKSPERTHREAD 4
+#define ZIPEXPORTDICTIONARYSIZE 32768
+
 namespace NMR {
 
 	class CExportStream_ZIP : public CExportStream {
@@ -53,12 +61,24 @@ namespace NMR {
 		std::array<nfByte, ZIPEXPORTBUFFERSIZE> m_nOutBuffer;
 
 		nfBool m_bIsInitialized;
+		nfInt32 m_nCompressionLevel;
+
+		PThreadPool m_pThreadPool;
+		std::vector<nfByte> m_BlockBuffer;
+		size_t m_nBlockBufferSize;
+		std::vector<nfByte> m_Dictionary;
+
+		// Set when already deflated data has been written to the entry as is
+		nfBool m_bIsPassthrough;
 
 		nfUint32 writeChunk(_In_ const nfByte * pData, nfUint32 cbCount);
 		void finishDeflate();
+
+		void compressBlocks(_In_ nfBool bFinal);
+		nfBool copyDeflatedFrom(_In_ CImportStream * pImportStream, _In_ nfUint64 cbCount);
 	public:
 		CExportStream_ZIP() = delete;
-		CExportStream_ZIP(_In_ CPortableZIPWriter * pZIPWriter, nfUint32 nEntryKey);
+		CExportStream_ZIP(_In_ CPortableZIPWriter * pZIPWriter, nfUint32 nEntryKey, _In_ nfInt32 nCompressionLevel, _In_ PThreadPool pThreadPool = nullptr);
 		~CExportStream_ZIP();
 
 		virtual nfBool seekPosition(_In_ nfUint64 position, _In_ nfBool bHasToSucceed);
@@ -66,6 +86,7 @@ namespace NMR {
 		virtual nfBool seekFromEnd(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed);
 		virtual nfUint64 getPosition();
 		virtual nfUint64 writeBuffer(_In_ const void * pBuffer, _In_ nfUint64 cbTotalBytesToWrite);
+		virtual void copyFrom(_In_ CImportStream * pImportStream, _In_ nfUint64 cbCount, _In_ nfUint32 cbBufferSize);
 
 		void flushZIPStream();
 	};
@@ -0,0 +1,117 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ImportStream_Deflated.h defines the CImportStream_Deflated Class.
+This is a memory stream, which keeps the deflated data of a ZIP entry and inflates it
+while it is read. Seeking resumes inflating from the closest decompression checkpoint,
+so that the inflated data never needs to be held in memory as a whole.
+The deflated data can be written into another ZIP package as is.
+
+--*/
+#ifndef __NMR_IMPORTSTREAM_DEFLATED
+#define __NMR_IMPORTSTREAM_DEFLATED
+
+#include "Common/Platform/NMR_ImportStream.h"
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+#include "zlib.h"
+
+#include <vector>
+
+// Size of the deflate history window, which is stored with every checkpoint
+#define IMPORTSTREAM_DEFLATED_WINDOWSIZE 32768
+// Minimum distance of decompression checkpoints in uncompressed bytes
+#define IMPORTSTREAM_DEFLATED_CHECKPOINTSPAN (1024 * 1024)
+
+namespace NMR {
+
+	typedef std::shared_ptr <const std::vector<nfByte>> PDeflatedData;
+
+	typedef struct {
+		nfUint64 m_nUncompressedPosition;
+		nfUint64 m_nCompressedPosition;
+		// Number of bits of the byte before m_nCompressedPosition that belong to the next block
+		nfInt32 m_nBits;
+		std::vector<nfByte> m_Window;
+	} IMPORTSTREAMDEFLATEDCHECKPOINT;
+
+	class CImportStream_Deflated : public CImportStream {
+	private:
+		PDeflatedData m_pDeflatedData;
+		nfUint64 m_cbUncompressedSize;
+		nfUint32 m_nCRC32;
+
+		z_stream m_InflateStream;
+		nfBool m_bIsInflating;
+		nfUint64 m_nPosition;
+		// Offset of the deflated data behind the input that has been handed to zlib
+		nfUint64 m_nInputPosition;
+		std::vector<nfByte> m_Window;
+		nfUint32 m_nWindowPosition;
+		std::vector<IMPORTSTREAMDEFLATEDCHECKPOINT> m_Checkpoints;
+
+		// The checksum covers the data before m_cbChecked, which has been inflated at least once
+		nfUint32 m_nRunningCRC32;
+		nfUint64 m_cbChecked;
+
+		void startInflating();
+		void restoreCheckpoint(_In_ const IMPORTSTREAMDEFLATEDCHECKPOINT & Checkpoint);
+		void addCheckpoint(_In_ nfInt32 nBits);
+		void updateChecksum(_In_ const nfByte * pData, _In_ nfUint32 cbData);
+		nfUint64 inflateData(_Out_opt_ nfByte * pBuffer, _In_ nfUint64 cbBytes);
+	public:
+		CImportStream_Deflated() = delete;
+		CImportStream_Deflated(_In_ PDeflatedData pDeflatedData, _In_ nfUint64 cbUncompressedSize, _In_ nfUint32 nCRC32);
+		~CImportStream_Deflated();
+
+		CImportStream_Deflated(const CImportStream_Deflated &) = delete;
+		CImportStream_Deflated & operator=(const CImportStream_Deflated &) = delete;
+
+		virtual nfBool seekPosition(_In_ nfUint64 position, _In_ nfBool bHasToSucceed);
+		virtual nfBool seekForward(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed);
+		virtual nfBool seekFromEnd(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed);
+		virtual nfUint64 readIntoBuffer(_In_ nfByte * pBuffer, _In_ nfUint64 cbTotalBytesToRead, nfBool bNeedsToReadAll);
+		virtual nfUint64 retrieveSize();
+		virtual void writeToFile(_In_ const nfWChar * pwszFileName);
+		virtual PImportStream copyToMemory();
+		virtual nfUint64 getPosition();
+
+		// The deflated data does not change while the stream is read
+		const std::vector<nfByte> & getDeflatedData();
+		nfUint32 getCRC32();
+
+		// Checkpoints that have been recorded so far, the first one is at the start of the data
+		nfUint32 getCheckpointCount();
+		nfUint64 getCheckpointPosition(_In_ nfUint32 nIndex);
+	};
+
+	typedef std::shared_ptr <CImportStream_Deflated> PImportStream_Deflated;
+
+}
+
+#endif // __NMR_IMPORTSTREAM_DEFLATED
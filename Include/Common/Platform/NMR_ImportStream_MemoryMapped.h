@@ -0,0 +1,99 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ImportStream_MemoryMapped.h defines the CImportStream_MemoryMapped Class.
+This is a memory stream on a read-only mapping of a file. Views created while reading share
+the mapping, which is released together with the last stream referencing it. Copies of the
+stream are held in memory, so that data kept after reading does not refer to the file.
+
+Accessing a mapping beyond the end of a file that has been truncated meanwhile raises SIGBUS
+on POSIX systems. The file size is therefore checked before the mapping is read, which narrows
+this down to truncations while a single read is in progress. Windows does not allow to truncate
+a mapped file.
+
+--*/
+
+#ifndef __NMR_IMPORTSTREAM_MEMORYMAPPED
+#define __NMR_IMPORTSTREAM_MEMORYMAPPED
+
+#include "Common/Platform/NMR_ImportStream_Memory.h"
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+
+#include <memory>
+
+namespace NMR {
+
+	class CMemoryMappedFile {
+	private:
+		const nfByte * m_pData;
+		nfUint64 m_cbSize;
+#ifndef _WIN32
+		int m_nFileDescriptor;
+#endif
+	public:
+		CMemoryMappedFile() = delete;
+		CMemoryMappedFile(_In_ const nfWChar * pwszFileName);
+		~CMemoryMappedFile();
+
+		const nfByte * getData();
+		nfUint64 getSize();
+
+		// Throws, if the file has become shorter than the mapping
+		void checkSize();
+	};
+
+	typedef std::shared_ptr<CMemoryMappedFile> PMemoryMappedFile;
+
+	class CImportStream_MemoryMapped : public CImportStream_Memory {
+	private:
+		PMemoryMappedFile m_pFile;
+		const nfByte * m_pData;
+	protected:
+		virtual const nfByte * getAt(nfUint64 nPosition);
+	public:
+		CImportStream_MemoryMapped() = delete;
+		CImportStream_MemoryMapped(_In_ const nfWChar * pwszFileName);
+		CImportStream_MemoryMapped(_In_ PMemoryMappedFile pFile, _In_ nfUint64 nOffset, _In_ nfUint64 cbSize);
+
+		// Copies the remaining bytes into memory, the copy does not refer to the mapping
+		virtual PImportStream copyToMemory();
+
+		// Returns a view on nOffset to nOffset + cbSize of this stream, without copying it.
+		// The view keeps the file mapped, so it must only be used while the file is being read.
+		PImportStream createView(_In_ nfUint64 nOffset, _In_ nfUint64 cbSize);
+
+		// Gives direct access to the mapped data of this stream
+		const nfByte * getData();
+	};
+
+	typedef std::shared_ptr<CImportStream_MemoryMapped> PImportStream_MemoryMapped;
+
+}
+
+#endif // __NMR_IMPORTSTREAM_MEMORYMAPPED
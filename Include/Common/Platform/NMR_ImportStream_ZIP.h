@@ -45,9 +45,13 @@ namespace NMR {
 	private:
 		zip_file_t * m_pFile;
 		nfUint64 m_nSize;
+		nfUint64 m_nPosition;
+
+		zip_t * m_pArchive;
+		nfUint64 m_nIndex;
 	public:
 		CImportStream_ZIP() = delete;
-		CImportStream_ZIP(_In_ zip_file_t * pFile, _In_ nfUint64 nSize);
+		CImportStream_ZIP(_In_ zip_file_t * pFile, _In_ nfUint64 nSize, _In_ zip_t * pArchive, _In_ nfUint64 nIndex);
 		~CImportStream_ZIP();
 
 		virtual nfBool seekPosition(_In_ nfUint64 position, _In_ nfBool bHasToSucceed);
@@ -58,6 +62,10 @@ namespace NMR {
 		virtual void writeToFile(_In_ const nfWChar * pwszFileName);
 		virtual PImportStream copyToMemory();
 		virtual nfUint64 getPosition();
+
+		// Copies deflated entries without inflating them, other entries are copied like copyToMemory.
+		// The copy of a deflated entry can seek, which the ZIP stream itself cannot.
+		PImportStream copyDeflatedToMemory();
 	};
 
 }
@@ -43,6 +43,8 @@ classes.
 namespace NMR {
 
 	PImportStream fnCreateImportStreamInstance(_In_ const nfChar * pszFileName);
+	// Maps the file into memory if possible, otherwise falls back to a native file stream
+	PImportStream fnCreateMappedImportStreamInstance(_In_ const nfChar * pszFileName);
 	PExportStream fnCreateExportStreamInstance(_In_ const nfChar * pszFileName);
 	PXmlReader fnCreateXMLReaderInstance(_In_ PImportStream pImportStream, PProgressMonitor  pProgressMonitor);
 	PXmlWriter fnCreateXMLWriterInstance(_In_ PExportStream pExportStream, PProgressMonitor pProgressMonitor);
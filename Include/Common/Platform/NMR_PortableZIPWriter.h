@@ -37,6 +37,7 @@ NMR_PortableZIPWriter.h defines a portable and fast writer of ZIP files
 #include "Common/Platform/NMR_PortableZIPWriterTypes.h"
 #include "Common/Platform/NMR_PortableZIPWriterEntry.h"
 #include "Common/NMR_Types.h"
+#include "Common/NMR_ThreadPool.h"
 
 #include <string>
 #include <list>
@@ -57,17 +58,22 @@ namespace NMR {
 
 		std::list<PPortableZIPWriterEntry> m_Entries;
 		PExportStream m_pCurrentStream;
+		PThreadPool m_pThreadPool;
 	public:
 		CPortableZIPWriter() = delete;
-		CPortableZIPWriter(_In_ PExportStream pExportStream, _In_ nfBool bWriteZIP64);
+		CPortableZIPWriter(_In_ PExportStream pExportStream, _In_ nfBool bWriteZIP64, _In_ PThreadPool pThreadPool = nullptr);
 		~CPortableZIPWriter();
 
-		PExportStream createEntry(_In_ const std::string sName, _In_ nfTimeStamp nUnixTimeStamp);
+		PExportStream createEntry(_In_ const std::string sName, _In_ nfTimeStamp nUnixTimeStamp, _In_ nfInt32 nCompressionLevel = ZIPCOMPRESSIONLEVEL_FASTEST);
 		void closeEntry();
 
 		void writeDeflatedBuffer(_In_ nfUint32 nEntryKey, _In_ const void * pBuffer, _In_ nfUint32 cbCompressedBytes);
 		void calculateChecksum(_In_ nfUint32 nEntryKey, _In_ const void * pBuffer, _In_ nfUint32 cbUncompressedBytes);
+		// Appends the checksum of a separately hashed block of cbUncompressedBytes
+		void combineChecksum(_In_ nfUint32 nEntryKey, _In_ nfUint32 nCRC32, _In_ nfUint32 cbUncompressedBytes);
 		nfUint64 getCurrentSize(_In_ nfUint32 nEntryKey);
+		// Writes the complete deflated content of an empty entry, whose checksum and size are already known
+		void writeDeflatedEntry(_In_ nfUint32 nEntryKey, _In_ const void * pBuffer, _In_ nfUint64 cbCompressedBytes, _In_ nfUint32 nCRC32, _In_ nfUint64 cbUncompressedBytes);
 
 		void writeDirectory();
 	};
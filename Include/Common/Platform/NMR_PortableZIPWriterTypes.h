@@ -53,6 +53,15 @@ NMR_PortableZIPWriterTypes.h defines a portable and fast writer of ZIP files
 
 #define ZIPFILECOMPRESSION_UNCOMPRESSED 0
 #define ZIPFILECOMPRESSION_DEFLATED 8
+
+// DEFLATE levels of entries, level 0 writes uncompressed entries.
+// Unspecified entries are deflated with the fastest level, like before levels could be chosen.
+#define ZIPCOMPRESSIONLEVEL_UNSPECIFIED -1
+#define ZIPCOMPRESSIONLEVEL_STORED 0
+#define ZIPCOMPRESSIONLEVEL_FASTEST 1
+#define ZIPCOMPRESSIONLEVEL_DEFAULT 6
+#define ZIPCOMPRESSIONLEVEL_MAXIMUM 9
+
 #define ZIPFILEMAXFILENAMELENGTH 32000
 
 #define ZIPFILEMAXIMUMSIZENON64 0xFFFFFFFF
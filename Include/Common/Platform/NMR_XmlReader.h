@@ -34,6 +34,7 @@ NMR_XMLReader.h defines a XML reader class in a portable way.
 #define __NMR_XMLREADER
 
 #include "Common/Platform/NMR_ImportStream.h"
+#include <map>
 #include <string>
 
 namespace NMR {
@@ -57,6 +58,7 @@ namespace NMR {
 		virtual void GetNamespaceURI(_Outptr_result_buffer_maybenull_(*pcchValue + 1)  const nfChar ** ppszValue, _Out_opt_  nfUint32 *pcchValue) = 0;
 		virtual bool GetNamespaceURI(const std::string &sNameSpacePrefix, std::string &sNameSpaceURI) = 0;
 		virtual bool NamespaceRegistered(const std::string &sNameSpaceURI) = 0;
+		virtual void GetDefaultNamespaceURI(std::string &sNameSpaceURI) = 0;
 
 		virtual nfBool Read(_Out_ eXmlReaderNodeType & NodeType) = 0;
 		virtual nfBool IsEOF() = 0;
@@ -65,6 +67,19 @@ namespace NMR {
 		virtual nfBool MoveToNextAttribute() = 0;
 		virtual nfBool IsDefault() = 0;
 		virtual void CloseElement();
+
+		// Raw access to the unparsed document bytes behind the current node.
+		// CanReadRaw returns true, if the reader is positioned directly behind a completely
+		// parsed entity and can hand out the remaining bytes of the document unparsed.
+		// Bytes that are given back via UnreadRaw are parsed again by the next Read call.
+		virtual nfBool CanReadRaw();
+		virtual nfUint32 ReadRaw(_Out_ nfByte * pBuffer, _In_ nfUint32 cbBufferSize);
+		virtual void UnreadRaw(_In_ const nfByte * pBuffer, _In_ nfUint32 cbBufferSize);
+		// Returns the position of the next raw byte in the import stream
+		virtual nfUint64 GetRawPosition();
+
+		// Returns all namespace prefixes that have been declared so far, without the predefined ones
+		virtual void GetNamespaces(_Out_ std::map<std::string, std::string> & NameSpaces);
 	};
 
 	typedef std::shared_ptr<CXmlReader> PXmlReader;
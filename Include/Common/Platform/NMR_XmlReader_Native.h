@@ -91,16 +91,31 @@ namespace NMR {
 		std::vector<nfChar *> m_CurrentEntityList;
 		std::vector<nfChar *> m_CurrentEntityPrefixes;
 		std::vector<nfByte> m_CurrentEntityTypes;
+		// end of the entity, if it is the last entity of a finished entity group (nullptr otherwise)
+		std::vector<nfChar *> m_CurrentEntityEnds;
 
-		void performEscapeStringDecoding();
+		// Raw data that has not been parsed yet, starting at m_nPendingRawDataOffset.
+		// The space in front of the offset takes data that is given back.
+		std::vector<nfChar> m_PendingRawData;
+		nfUint32 m_nPendingRawDataOffset;
+		void prependPendingRawData(_In_ const nfChar * pData, _In_ nfUint32 cbDataSize);
 
 		// Insert List for 0 characters
 		nfUint32 m_nZeroInsertIndex;
 		std::vector<nfChar *> m_ZeroInsertArray;
 		void pushZeroInsert(_In_ nfChar * pChar);
-		void performZeroInserts();
 		void clearZeroInserts();
 
+		// Finished entity groups are only terminated and unescaped once they are read.
+		// Everything behind the current entity keeps its raw content that way.
+		std::vector<nfUint32> m_FinishedGroupEntityEnds;
+		std::vector<nfUint32> m_FinishedGroupZeroInsertEnds;
+		nfUint32 m_nPreparedGroupCount;
+		nfUint32 m_nPreparedEntityCount;
+		nfUint32 m_nPreparedZeroInsertCount;
+		void prepareEntity(_In_ nfUint32 nEntityIndex);
+		void clearFinishedGroups();
+
 		// how large is the current buffer
 		nfUint32 m_nCurrentBufferSize;
 		nfUint32 m_nCurrentEntityCount;
@@ -132,6 +147,8 @@ namespace NMR {
 		// Fill next buffer chunk
 		nfBool ensureFilledBuffer();
 		void readNextBufferFromStream();
+		nfUint32 readRawData(_Out_ nfByte * pBuffer, _In_ nfUint32 cbBufferSize);
+		void transferBufferToPendingRawData();
 
 		// Parse Text Buffer
 		nfChar * parseUnknown(_In_ nfChar * pszStart, _In_ nfChar * pszEnd);
@@ -161,6 +178,7 @@ namespace NMR {
 		virtual void GetNamespaceURI(_Outptr_result_buffer_maybenull_(*pcwchValue + 1)  const nfChar ** ppwszValue, _Out_opt_  nfUint32 *pcwchValue);
 		virtual bool GetNamespaceURI(const std::string &sNameSpacePrefix, std::string &sNameSpaceURI);
 		virtual bool NamespaceRegistered(const std::string &sNameSpaceURI);
+		virtual void GetDefaultNamespaceURI(std::string &sNameSpaceURI);
 
 		virtual nfBool Read(_Out_ eXmlReaderNodeType & NodeType);
 		virtual nfBool IsEOF();
@@ -170,6 +188,13 @@ namespace NMR {
 		virtual nfBool IsDefault();
 		virtual void CloseElement();
 
+		virtual nfBool CanReadRaw();
+		virtual nfUint32 ReadRaw(_Out_ nfByte * pBuffer, _In_ nfUint32 cbBufferSize);
+		virtual void UnreadRaw(_In_ const nfByte * pBuffer, _In_ nfUint32 cbBufferSize);
+		virtual nfUint64 GetRawPosition();
+
+		virtual void GetNamespaces(_Out_ std::map<std::string, std::string> & NameSpaces);
+
 	};
 
 	typedef std::shared_ptr<CXmlReader_Native> PXmlReader_Native;
@@ -0,0 +1,273 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_XmlScan.h implements the delimiter searches of the native XML parser. A few blocks are scanned
+inline, as delimiters in 3MF markup are rarely far away; longer runs are handed to the kernels of the
+widest instruction set the CPU supports, which are selected at runtime.
+
+--*/
+
+#ifndef __NMR_XMLSCAN
+#define __NMR_XMLSCAN
+
+#include "Common/NMR_Types.h"
+#include "Common/Platform/NMR_SAL.h"
+
+#include <cstddef>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#define NMR_XMLSCAN_SSE2
+#include <emmintrin.h>
+#endif
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+// Number of bytes, which are scanned inline before the selected kernel is called
+#define NMR_XMLSCAN_INLINEBYTES 32
+
+namespace NMR {
+
+	typedef nfChar * (*XmlScanForCharFunction)(_In_ nfChar * pszStart, _In_ nfChar * pszEnd, _In_ nfChar cDelimiter);
+	typedef nfChar * (*XmlScanFunction)(_In_ nfChar * pszStart, _In_ nfChar * pszEnd);
+
+	// The scans of one instruction set, see the fnXmlScan functions below
+	struct sXmlScanKernels {
+		XmlScanForCharFunction m_pScanForChar;
+		XmlScanFunction m_pScanForElementNameEnd;
+		XmlScanFunction m_pScanForEndElementEnd;
+		XmlScanFunction m_pScanForAttributeNameEnd;
+	};
+
+	// The kernels of the wider instruction sets are compiled in their own translation unit with that
+	// instruction set enabled. They must not be called, unless the CPU supports the instruction set,
+	// and are null, if the compiler does not target it.
+	sXmlScanKernels fnXmlScanGetKernelsScalar();
+	sXmlScanKernels fnXmlScanGetKernelsSSE2();
+	sXmlScanKernels fnXmlScanGetKernelsAVX2();
+
+	// Returns the kernels of the widest instruction set the CPU supports, selected once
+	const sXmlScanKernels & fnXmlScanGetKernels();
+
+	// A block compares Width characters at once. Equal returns a block, which is nonzero for the matching
+	// characters, Mask compresses it to one bit per character.
+	struct CXmlScanBlockScalar {
+		typedef nfUint32 Type;
+		static const ptrdiff_t Width = 1;
+
+		static Type Load(_In_ const nfChar * pChar) { return (nfByte)*pChar; }
+		static Type Broadcast(_In_ nfChar cChar) { return (nfByte)cChar; }
+		static Type Equal(_In_ Type Block, _In_ Type Delimiter) { return (Block == Delimiter) ? 1 : 0; }
+		static Type Either(_In_ Type A, _In_ Type B) { return A | B; }
+		static nfUint32 Mask(_In_ Type Block) { return Block; }
+	};
+
+#ifdef NMR_XMLSCAN_SSE2
+	struct CXmlScanBlockSSE2 {
+		typedef __m128i Type;
+		static const ptrdiff_t Width = 16;
+
+		static Type Load(_In_ const nfChar * pChar) { return _mm_loadu_si128((const __m128i *) pChar); }
+		static Type Broadcast(_In_ nfChar cChar) { return _mm_set1_epi8(cChar); }
+		static Type Equal(_In_ Type Block, _In_ Type Delimiter) { return _mm_cmpeq_epi8(Block, Delimiter); }
+		static Type Either(_In_ Type A, _In_ Type B) { return _mm_or_si128(A, B); }
+		static nfUint32 Mask(_In_ Type Block) { return (nfUint32)_mm_movemask_epi8(Block); }
+	};
+
+	typedef CXmlScanBlockSSE2 CXmlScanBlockInline;
+#else
+	typedef CXmlScanBlockScalar CXmlScanBlockInline;
+#endif
+
+	// The delimiter sets. Matches tests a single character, MatchBlock all characters of a block.
+	template <typename Block>
+	class CXmlScanChar {
+	private:
+		nfChar m_cDelimiter;
+		typename Block::Type m_Delimiter;
+	public:
+		CXmlScanChar(_In_ nfChar cDelimiter) : m_cDelimiter(cDelimiter), m_Delimiter(Block::Broadcast(cDelimiter)) {}
+		nfBool Matches(_In_ nfChar cChar) const { return cChar == m_cDelimiter; }
+		typename Block::Type MatchBlock(_In_ typename Block::Type Chars) const { return Block::Equal(Chars, m_Delimiter); }
+	};
+
+	// White space, '>', '/' or '?'
+	template <typename Block>
+	class CXmlScanElementNameEnd {
+	public:
+		nfBool Matches(_In_ nfChar cChar) const
+		{
+			return (cChar == 32) || (cChar == 9) || (cChar == 10) || (cChar == 13) || (cChar == '>') || (cChar == '/') || (cChar == '?');
+		}
+		typename Block::Type MatchBlock(_In_ typename Block::Type Chars) const
+		{
+			typename Block::Type Result = Block::Equal(Chars, Block::Broadcast(32));
+			Result = Block::Either(Result, Block::Equal(Chars, Block::Broadcast(9)));
+			Result = Block::Either(Result, Block::Equal(Chars, Block::Broadcast(10)));
+			Result = Block::Either(Result, Block::Equal(Chars, Block::Broadcast(13)));
+			Result = Block::Either(Result, Block::Equal(Chars, Block::Broadcast('>')));
+			Result = Block::Either(Result, Block::Equal(Chars, Block::Broadcast('/')));
+			return Block::Either(Result, Block::Equal(Chars, Block::Broadcast('?')));
+		}
+	};
+
+	// '>', '/' or '?'
+	template <typename Block>
+	class CXmlScanEndElementEnd {
+	public:
+		nfBool Matches(_In_ nfChar cChar) const
+		{
+			return (cChar == '>') || (cChar == '/') || (cChar == '?');
+		}
+		typename Block::Type MatchBlock(_In_ typename Block::Type Chars) const
+		{
+			typename Block::Type Result = Block::Equal(Chars, Block::Broadcast('>'));
+			Result = Block::Either(Result, Block::Equal(Chars, Block::Broadcast('/')));
+			return Block::Either(Result, Block::Equal(Chars, Block::Broadcast('?')));
+		}
+	};
+
+	// White space, '"', ''' or '='
+	template <typename Block>
+	class CXmlScanAttributeNameEnd {
+	public:
+		nfBool Matches(_In_ nfChar cChar) const
+		{
+			return (cChar == 32) || (cChar == 9) || (cChar == 10) || (cChar == 13) || (cChar == '=') || (cChar == 34) || (cChar == 39);
+		}
+		typename Block::Type MatchBlock(_In_ typename Block::Type Chars) const
+		{
+			typename Block::Type Result = Block::Equal(Chars, Block::Broadcast(32));
+			Result = Block::Either(Result, Block::Equal(Chars, Block::Broadcast(9)));
+			Result = Block::Either(Result, Block::Equal(Chars, Block::Broadcast(10)));
+			Result = Block::Either(Result, Block::Equal(Chars, Block::Broadcast(13)));
+			Result = Block::Either(Result, Block::Equal(Chars, Block::Broadcast('=')));
+			Result = Block::Either(Result, Block::Equal(Chars, Block::Broadcast(34)));
+			return Block::Either(Result, Block::Equal(Chars, Block::Broadcast(39)));
+		}
+	};
+
+	// Returns the first character in [pszStart, pszEnd) matching the delimiters, or pszEnd.
+	// Only the members of Block and Delimiters are used, so that the translation units of the wider
+	// instruction sets do not emit shared inline functions compiled for those instruction sets.
+	template <typename Block, typename Delimiters>
+	inline nfChar * fnXmlScanBlocks(_In_ nfChar * pszStart, _In_ nfChar * pszEnd, _In_ const Delimiters & delimiters)
+	{
+		nfChar * pChar = pszStart;
+		while (pszEnd - pChar >= Block::Width) {
+			nfUint32 nMask = Block::Mask(delimiters.MatchBlock(Block::Load(pChar)));
+			if (nMask != 0) {
+#ifdef _MSC_VER
+				unsigned long nIndex;
+				_BitScanForward(&nIndex, nMask);
+				return pChar + nIndex;
+#else
+				return pChar + __builtin_ctz(nMask);
+#endif
+			}
+			pChar += Block::Width;
+		}
+		while ((pChar != pszEnd) && !delimiters.Matches(*pChar))
+			pChar++;
+		return pChar;
+	}
+
+	// Returns the scans of fnXmlScanBlocks with the given block type
+	template <typename Block>
+	sXmlScanKernels fnXmlScanMakeKernels()
+	{
+		sXmlScanKernels Kernels;
+		Kernels.m_pScanForChar = [](nfChar * pszStart, nfChar * pszEnd, nfChar cDelimiter) {
+			return fnXmlScanBlocks<Block>(pszStart, pszEnd, CXmlScanChar<Block>(cDelimiter));
+		};
+		Kernels.m_pScanForElementNameEnd = [](nfChar * pszStart, nfChar * pszEnd) {
+			return fnXmlScanBlocks<Block>(pszStart, pszEnd, CXmlScanElementNameEnd<Block>());
+		};
+		Kernels.m_pScanForEndElementEnd = [](nfChar * pszStart, nfChar * pszEnd) {
+			return fnXmlScanBlocks<Block>(pszStart, pszEnd, CXmlScanEndElementEnd<Block>());
+		};
+		Kernels.m_pScanForAttributeNameEnd = [](nfChar * pszStart, nfChar * pszEnd) {
+			return fnXmlScanBlocks<Block>(pszStart, pszEnd, CXmlScanAttributeNameEnd<Block>());
+		};
+		return Kernels;
+	}
+
+	// Scans the first NMR_XMLSCAN_INLINEBYTES inline and the remainder with the selected kernel
+	template <typename Delimiters, typename KernelScan>
+	inline nfChar * fnXmlScan(_In_ nfChar * pszStart, _In_ nfChar * pszEnd, _In_ const Delimiters & delimiters, _In_ KernelScan kernelScan)
+	{
+		if (pszEnd - pszStart <= NMR_XMLSCAN_INLINEBYTES)
+			return fnXmlScanBlocks<CXmlScanBlockInline>(pszStart, pszEnd, delimiters);
+
+		nfChar * pszInlineEnd = pszStart + NMR_XMLSCAN_INLINEBYTES;
+		nfChar * pChar = fnXmlScanBlocks<CXmlScanBlockInline>(pszStart, pszInlineEnd, delimiters);
+		if (pChar != pszInlineEnd)
+			return pChar;
+		return kernelScan(pChar, pszEnd);
+	}
+
+	// Returns the first occurrence of cDelimiter in [pszStart, pszEnd), or pszEnd.
+	inline nfChar * fnXmlScanForChar(_In_ nfChar * pszStart, _In_ nfChar * pszEnd, _In_ nfChar cDelimiter)
+	{
+		return fnXmlScan(pszStart, pszEnd, CXmlScanChar<CXmlScanBlockInline>(cDelimiter), [cDelimiter](nfChar * pChar, nfChar * pszScanEnd) {
+			return fnXmlScanGetKernels().m_pScanForChar(pChar, pszScanEnd, cDelimiter);
+		});
+	}
+
+	// Returns the first white space, '>', '/' or '?' in [pszStart, pszEnd), or pszEnd.
+	inline nfChar * fnXmlScanForElementNameEnd(_In_ nfChar * pszStart, _In_ nfChar * pszEnd)
+	{
+		return fnXmlScan(pszStart, pszEnd, CXmlScanElementNameEnd<CXmlScanBlockInline>(), [](nfChar * pChar, nfChar * pszScanEnd) {
+			return fnXmlScanGetKernels().m_pScanForElementNameEnd(pChar, pszScanEnd);
+		});
+	}
+
+	// Returns the first '>', '/' or '?' in [pszStart, pszEnd), or pszEnd.
+	inline nfChar * fnXmlScanForEndElementEnd(_In_ nfChar * pszStart, _In_ nfChar * pszEnd)
+	{
+		return fnXmlScan(pszStart, pszEnd, CXmlScanEndElementEnd<CXmlScanBlockInline>(), [](nfChar * pChar, nfChar * pszScanEnd) {
+			return fnXmlScanGetKernels().m_pScanForEndElementEnd(pChar, pszScanEnd);
+		});
+	}
+
+	// Returns the first white space, '"', ''' or '=' in [pszStart, pszEnd), or pszEnd.
+	inline nfChar * fnXmlScanForAttributeNameEnd(_In_ nfChar * pszStart, _In_ nfChar * pszEnd)
+	{
+		return fnXmlScan(pszStart, pszEnd, CXmlScanAttributeNameEnd<CXmlScanBlockInline>(), [](nfChar * pChar, nfChar * pszScanEnd) {
+			return fnXmlScanGetKernels().m_pScanForAttributeNameEnd(pChar, pszScanEnd);
+		});
+	}
+
+	inline nfBool fnXmlIsWhiteSpace(_In_ nfChar cChar)
+	{
+		return (cChar == 32) || (cChar == 9) || (cChar == 10) || (cChar == 13);
+	}
+
+}
+
+#endif // __NMR_XMLSCAN
@@ -55,6 +55,11 @@ namespace NMR {
 		virtual void WriteFullEndElement() = 0;
 		virtual void WriteRawLine(_In_ const nfChar * pszRawData, _In_ nfUint32 cbCount) = 0;
 
+		// Returns the indentation and line ending WriteRawLine would frame a line with at the current position
+		virtual void GetRawLineFraming(_Out_ std::string & sIndentation, _Out_ std::string & sLineEnding) = 0;
+		// Writes a block of lines, which have been pre-rendered with the framing of GetRawLineFraming
+		virtual void WriteRawLines(_In_ const nfByte * pRawData, _In_ nfUint64 cbCount) = 0;
+
 		virtual void WriteText(_In_ const nfChar * pszContent, _In_ const nfUint32 cbLength) = 0;
 
 		virtual bool GetNamespacePrefix(const std::string &sNameSpaceURI, std::string &sNameSpacePrefix) = 0;
@@ -93,6 +93,8 @@ namespace NMR {
 
 		virtual void WriteText(_In_ const nfChar * pszContent, _In_ const nfUint32 cbLength);
 		virtual void WriteRawLine(_In_ const nfChar * pszRawData, _In_ nfUint32 cbCount);
+		virtual void GetRawLineFraming(_Out_ std::string & sIndentation, _Out_ std::string & sLineEnding);
+		virtual void WriteRawLines(_In_ const nfByte * pRawData, _In_ nfUint64 cbCount);
 
 		virtual bool GetNamespacePrefix(const std::string &sNameSpaceURI, std::string &sNameSpacePrefix);
 		virtual void RegisterCustomNameSpace(const std::string &sNameSpace, const std::string &sNameSpacePrefix);
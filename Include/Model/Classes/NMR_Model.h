@@ -49,6 +49,7 @@ NMR_Model.h defines the Model Class. A model is an in memory representation of t
 #include "Common/NMR_UUID.h"
 
 #include "Common/NMR_SecureContentTypes.h"
+#include "Common/NMR_ThreadPool.h"
 
 namespace NMR {
 
@@ -179,6 +180,9 @@ namespace NMR {
 
 		CryptoRandGenDescriptor m_sRandDescriptor;
 
+		// Worker threads shared by the parallel algorithms on the model's resources, created on first use
+		PThreadPool m_pThreadPool;
+
 		// Add Resource to resource lookup tables
 		void addResourceToLookupTable(_In_ PModelResource pResource);
 
@@ -378,6 +382,10 @@ namespace NMR {
 
 		[[nodiscard]] ModelResourceID getMaxModelResourceID();
 
+		// Returns a pool with one thread per core, or nullptr on single core machines.
+		// The pool lives as long as the model, so repeated checks do not spawn threads again.
+		_Ret_maybenull_ CThreadPool * getThreadPool();
+
 		void removeResource(PModelResource pResource);
 
 	};
@@ -0,0 +1,136 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelImage3DSampler.h defines the class CModelImage3DSampler, which looks up
+the channels of a FunctionFromImage3D. The PNG sheets of the image stack are
+decoded on demand and kept in a bounded cache of the most recently used sheets.
+
+--*/
+
+#ifndef __NMR_MODELIMAGE3DSAMPLER
+#define __NMR_MODELIMAGE3DSAMPLER
+
+#include "Common/NMR_Types.h"
+#include "Common/Platform/NMR_SAL.h"
+#include "Model/Classes/NMR_ModelTypes.h"
+
+#include <array>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Default memory limit of the decoded sheets in bytes
+#define NMR_IMAGE3D_DEFAULTCACHESIZE (256 * 1024 * 1024)
+#define NMR_IMAGE3D_TASKSPERTHREAD 4
+// Red, green, blue and alpha
+#define NMR_IMAGE3D_CHANNELCOUNT 4
+
+namespace NMR {
+
+	class CModelAttachment;
+	typedef std::shared_ptr<CModelAttachment> PModelAttachment;
+	class CModelFunctionFromImage3D;
+	class CThreadPool;
+
+	class CModelImage3DSampler {
+	private:
+		// Decoded sheet with one plane per stored channel. Sheets with 8 bit samples
+		// are kept as bytes, sheets with 16 bit samples as normalized floats.
+		struct sSheet {
+			nfUint32 m_nChannelCount;
+			std::vector<nfByte> m_Bytes;
+			std::vector<nfFloat> m_Floats;
+		};
+		typedef std::shared_ptr<const sSheet> PSheet;
+
+		struct sCacheEntry {
+			PSheet m_pSheet;
+			std::list<nfUint32>::iterator m_iRecent;
+		};
+
+		// The last sheets used by one thread, which are found without locking the cache
+		struct sSheetLookup {
+			std::array<nfUint32, 2> m_Indices;
+			std::array<PSheet, 2> m_Sheets;
+			nfUint32 m_nNext;
+			sSheetLookup();
+		};
+
+		std::vector<PModelAttachment> m_Sheets;
+		nfUint32 m_nColumnCount;
+		nfUint32 m_nRowCount;
+		std::array<eModelTextureTileStyle, 3> m_TileStyles;
+		nfBool m_bLinear;
+		nfDouble m_dOffset;
+		nfDouble m_dScale;
+
+		std::mutex m_CacheMutex;
+		nfUint64 m_cbCacheSize;
+		nfUint64 m_cbCachedSize;
+		// Sheet indices from the most to the least recently used one
+		std::list<nfUint32> m_RecentSheets;
+		std::unordered_map<nfUint32, sCacheEntry> m_CachedSheets;
+
+		PSheet decodeSheet(_In_ nfUint32 nSheetIndex);
+		PSheet getSheet(_In_ nfUint32 nSheetIndex, _Inout_ sSheetLookup & Lookup);
+		void evictSheets();
+		// Samples the channels in [nFirstChannel, nFirstChannel + nChannelCount) of one point
+		void lookup(_In_ const nfDouble (&vUVW)[3], _In_ nfUint32 nFirstChannel, _In_ nfUint32 nChannelCount, _Out_ nfDouble * pValues, _Inout_ sSheetLookup & Lookup);
+
+	public:
+		CModelImage3DSampler() = delete;
+		CModelImage3DSampler(_In_ CModelFunctionFromImage3D & Function);
+
+		nfUint32 getColumnCount();
+		nfUint32 getRowCount();
+		nfUint32 getSheetCount();
+
+		// The most recently used sheet is kept even if it exceeds the cache size
+		void setCacheSize(_In_ nfUint64 cbCacheSize);
+		nfUint64 getCacheSize();
+		nfUint64 getCachedSize();
+
+		// Range of all sampled values, which are offset + scale * [0, 1]
+		void getValueRange(_Out_ nfDouble & dMin, _Out_ nfDouble & dMax);
+
+		// Samples one channel (0: red, 1: green, 2: blue, 3: alpha) at nCount points, given
+		// by one array per coordinate. Can be called concurrently.
+		void sampleChannel(_In_ nfUint32 nChannel, _In_ const nfDouble * pU, _In_ const nfDouble * pV, _In_ const nfDouble * pW, _Out_ nfDouble * pValues, _In_ size_t nCount);
+
+		// Samples all channels at points with interleaved coordinates (u, v, w) and
+		// writes interleaved values (red, green, blue, alpha)
+		void sample(_In_ const nfDouble * pUVW, _Out_ nfDouble * pRGBA, _In_ nfUint64 nPointCount, _In_opt_ CThreadPool * pThreadPool);
+	};
+
+	typedef std::shared_ptr<CModelImage3DSampler> PModelImage3DSampler;
+
+}
+
+#endif // __NMR_MODELIMAGE3DSAMPLER
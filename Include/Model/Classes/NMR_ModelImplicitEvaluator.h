@@ -0,0 +1,202 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+#pragma once
+
+#include <Common/NMR_ThreadPool.h>
+#include <Model/Classes/NMR_ModelImage3DSampler.h>
+#include <Model/Classes/NMR_ModelImplicitFunction.h>
+
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace NMR
+{
+    namespace implicit
+    {
+        // Scalar operations of the instruction tape. Vector and matrix ports
+        // are compiled to one instruction per component.
+        enum class OpCode : uint8_t
+        {
+            Add,
+            Sub,
+            Mul,
+            Div,
+            Neg,
+            Sin,
+            Cos,
+            Tan,
+            ArcSin,
+            ArcCos,
+            ArcTan,
+            ArcTan2,
+            Min,
+            Max,
+            Abs,
+            Fmod,
+            Mod,
+            Pow,
+            Sqrt,
+            Exp,
+            Log,
+            Log2,
+            Log10,
+            Sinh,
+            Cosh,
+            Tanh,
+            Round,
+            Ceil,
+            Floor,
+            Sign,
+            Fract,
+            Select,      // result = a < b ? c : d
+            Clamp,       // result = min(max(a, b), c)
+            ImageSample  // result = image channel d at (u, v, w) = (a, b, c)
+        };
+
+        using Register = uint32_t;
+
+        struct Instruction
+        {
+            OpCode op;
+            Register result;
+            Register a;
+            Register b;
+            Register c;
+            Register d;
+        };
+
+        using Tape = std::vector<Instruction>;
+
+        // Number of operands an instruction reads
+        unsigned int getOperandCount(OpCode op);
+
+        // Applies an operation to a single set of operands. Image samples
+        // depend on the evaluator and can not be applied by this function.
+        double applyOperation(OpCode op, double a, double b, double c, double d);
+
+        // Defined in NMR_ModelImplicitInterval.h
+        struct Interval;
+    }  // namespace implicit
+
+    /**
+     * @brief Evaluates an implicit function for batches of points.
+     *
+     * The function is compiled into a flat tape of scalar instructions on
+     * registers. Nested function calls are inlined, nodes which do not
+     * contribute to an output are skipped and constant expressions are
+     * folded. Later changes of the function do not affect the evaluator.
+     *
+     * Point values are passed interleaved: the components of all function
+     * inputs, in their order, followed by the next point. Scalars take one
+     * value, vectors three and matrices sixteen in row-major order. Outputs
+     * are returned in the same layout. evaluateBatch takes the components
+     * as separate arrays instead.
+     */
+    class CModelImplicitEvaluator
+    {
+       public:
+        // Number of points, which are evaluated at once by every instruction
+        static constexpr size_t LaneCount = 64;
+
+       private:
+        implicit::Tape m_tape;
+        uint32_t m_registerCount = 0;
+        std::vector<std::pair<implicit::Register, double>> m_constants;
+        std::vector<implicit::Register> m_inputRegisters;
+        std::vector<implicit::Register> m_outputRegisters;
+
+        // Channels of the images, which are sampled by the functions from
+        // image3d. The d operand of an ImageSample instruction is a constant
+        // register holding the index into this list.
+        using ImageChannel = std::pair<PModelImage3DSampler, uint32_t>;
+        std::vector<ImageChannel> m_imageChannels;
+
+        uint32_t m_workerThreadCount = 1;
+        PThreadPool m_pThreadPool;
+
+        // Values of a point component are found at
+        // pBuffer[point * nPointStride + component * nComponentStride]
+        struct Layout
+        {
+            size_t m_nPointStride;
+            size_t m_nComponentStride;
+        };
+
+        void evaluateChunk(double const* pInputs,
+                           Layout inputLayout,
+                           double* pOutputs,
+                           Layout outputLayout,
+                           size_t nPointCount,
+                           double* pRegisters) const;
+
+        void evaluateChunks(double const* pInputs,
+                            Layout inputLayout,
+                            double* pOutputs,
+                            Layout outputLayout,
+                            uint64_t nPointCount);
+
+       public:
+        explicit CModelImplicitEvaluator(CModelImplicitFunction& function);
+
+        size_t getInputStride() const;
+        size_t getOutputStride() const;
+
+        implicit::Tape const& getTape() const;
+        uint32_t getRegisterCount() const;
+        std::vector<std::pair<implicit::Register, double>> const& getConstants() const;
+        std::vector<implicit::Register> const& getInputRegisters() const;
+        std::vector<implicit::Register> const& getOutputRegisters() const;
+        std::vector<ImageChannel> const& getImageChannels() const;
+
+        // 0 selects the number of hardware threads
+        void setWorkerThreadCount(uint32_t nThreadCount);
+        uint32_t getWorkerThreadCount() const;
+
+        void evaluate(double const* pInputs,
+                      double* pOutputs,
+                      uint64_t nPointCount);
+
+        // Evaluates points in structure-of-arrays layout: the values of the
+        // first input component of all points, then those of the second
+        // component and so on. Outputs are returned in the same layout.
+        void evaluateBatch(double const* pInputs,
+                           double* pOutputs,
+                           uint64_t nPointCount);
+
+        // Computes bounds of the outputs for all inputs within the given
+        // intervals, one per input component. The bounds are conservative,
+        // but not necessarily tight.
+        void evaluateInterval(implicit::Interval const* pInputs,
+                              implicit::Interval* pOutputs) const;
+    };
+
+    using PModelImplicitEvaluator = std::shared_ptr<CModelImplicitEvaluator>;
+}  // namespace NMR
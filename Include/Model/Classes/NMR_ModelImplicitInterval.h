@@ -0,0 +1,63 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+#pragma once
+
+#include <Model/Classes/NMR_ModelImplicitEvaluator.h>
+
+namespace NMR
+{
+    namespace implicit
+    {
+        // Closed range of values. Unbounded or undefined results are
+        // represented by the infinite interval.
+        struct Interval
+        {
+            double m_min;
+            double m_max;
+        };
+
+        Interval makeInterval(double value);
+        Interval makeInterval(double minimum, double maximum);
+        Interval infiniteInterval();
+        bool isBounded(Interval const& value);
+
+        /**
+         * @brief Applies an operation to intervals of its operands.
+         *
+         * The result contains the value of the operation for every
+         * combination of operand values. Unbounded operands and operands
+         * outside of the domain of an operation give the infinite interval,
+         * as the point evaluation may give NaN for them. A bounded result
+         * thus guarantees finite point values. The bounds are widened by a
+         * few units in the last place, so they also contain the rounded
+         * results of the point evaluation.
+         */
+        Interval applyIntervalOperation(OpCode op, Interval a, Interval b, Interval c, Interval d);
+    }  // namespace implicit
+}  // namespace NMR
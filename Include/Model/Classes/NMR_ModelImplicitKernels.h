@@ -0,0 +1,179 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+#pragma once
+
+#include <Model/Classes/NMR_ModelImplicitEvaluator.h>
+
+#include <cstddef>
+
+// Limits the batch width of the kernels, e.g. to 1 for the scalar kernels.
+// Kernels wider than the CPU supports are never selected.
+#define NMR_IMPLICIT_KERNELWIDTH_ENVIRONMENT "LIB3MF_IMPLICIT_KERNEL_WIDTH"
+
+namespace NMR
+{
+    namespace implicit
+    {
+        namespace kernels
+        {
+            // Applies an instruction with SIMD batches. Returns false for
+            // operations, which are computed per lane instead.
+            using BatchFunction = bool (*)(OpCode op,
+                                           double* result,
+                                           double const* a,
+                                           double const* b,
+                                           double const* c,
+                                           double const* d,
+                                           size_t nCount);
+
+            struct BatchKernel
+            {
+                // Number of lanes per batch, 0 if the kernel is not available
+                size_t m_nWidth;
+                BatchFunction m_pApply;
+            };
+
+            // The kernels of each instruction set are compiled in their own
+            // translation unit with that instruction set enabled. They must
+            // not be called, not even these getters, unless the CPU supports
+            // the instruction set.
+            BatchKernel getBatchKernelSSE2();
+            BatchKernel getBatchKernelAVX2();
+            BatchKernel getBatchKernelAVX512();
+
+            // Batch width of the kernel, which is selected for this CPU
+            size_t getBatchWidth();
+
+            /**
+             * @brief Applies an instruction to nCount lanes of its operand
+             * registers. nCount must be a multiple of the widest batch. The
+             * result may alias any operand.
+             *
+             * Arithmetic, min/max, abs, sqrt, select and clamp use the widest
+             * SIMD batch the CPU supports, which is selected once at runtime.
+             * Other operations, mostly transcendental functions, are computed
+             * per lane.
+             */
+            void applyInstruction(OpCode op,
+                                  double* result,
+                                  double const* a,
+                                  double const* b,
+                                  double const* c,
+                                  double const* d,
+                                  size_t nCount);
+
+            template <typename Batch, typename Operation>
+            inline void applyUnary(double* result, double const* a, size_t nCount, Operation operation)
+            {
+                for (size_t i = 0; i < nCount; i += Batch::Width)
+                {
+                    Batch::store(result + i, operation(Batch::load(a + i)));
+                }
+            }
+
+            template <typename Batch, typename Operation>
+            inline void applyBinary(double* result, double const* a, double const* b, size_t nCount,
+                                    Operation operation)
+            {
+                for (size_t i = 0; i < nCount; i += Batch::Width)
+                {
+                    Batch::store(result + i, operation(Batch::load(a + i), Batch::load(b + i)));
+                }
+            }
+
+            /**
+             * @brief Applies an instruction with the given batch type, see
+             * BatchFunction. Only the batch operations are used, so that the
+             * translation units of the wider instruction sets do not emit
+             * shared inline functions compiled for those instruction sets.
+             */
+            template <typename Batch>
+            bool applyBatch(OpCode op,
+                            double* result,
+                            double const* a,
+                            double const* b,
+                            double const* c,
+                            double const* d,
+                            size_t nCount)
+            {
+                static_assert(CModelImplicitEvaluator::LaneCount % Batch::Width == 0,
+                              "the lane count must be a multiple of the batch width");
+
+                using T = typename Batch::Type;
+                switch (op)
+                {
+                    case OpCode::Add:
+                        applyBinary<Batch>(result, a, b, nCount, [](T x, T y) { return Batch::add(x, y); });
+                        return true;
+                    case OpCode::Sub:
+                        applyBinary<Batch>(result, a, b, nCount, [](T x, T y) { return Batch::sub(x, y); });
+                        return true;
+                    case OpCode::Mul:
+                        applyBinary<Batch>(result, a, b, nCount, [](T x, T y) { return Batch::mul(x, y); });
+                        return true;
+                    case OpCode::Div:
+                        applyBinary<Batch>(result, a, b, nCount, [](T x, T y) { return Batch::div(x, y); });
+                        return true;
+                    // std::min(a, b) returns a unless b < a, which is min(b, a) of the batch
+                    case OpCode::Min:
+                        applyBinary<Batch>(result, a, b, nCount, [](T x, T y) { return Batch::min(y, x); });
+                        return true;
+                    case OpCode::Max:
+                        applyBinary<Batch>(result, a, b, nCount, [](T x, T y) { return Batch::max(y, x); });
+                        return true;
+                    case OpCode::Neg:
+                        applyUnary<Batch>(result, a, nCount, [](T x) { return Batch::neg(x); });
+                        return true;
+                    case OpCode::Abs:
+                        applyUnary<Batch>(result, a, nCount, [](T x) { return Batch::abs(x); });
+                        return true;
+                    case OpCode::Sqrt:
+                        applyUnary<Batch>(result, a, nCount, [](T x) { return Batch::sqrt(x); });
+                        return true;
+                    case OpCode::Select:
+                        for (size_t i = 0; i < nCount; i += Batch::Width)
+                        {
+                            Batch::store(result + i, Batch::select(Batch::load(a + i), Batch::load(b + i),
+                                                                   Batch::load(c + i), Batch::load(d + i)));
+                        }
+                        return true;
+                    case OpCode::Clamp:
+                        for (size_t i = 0; i < nCount; i += Batch::Width)
+                        {
+                            T const lower = Batch::max(Batch::load(b + i), Batch::load(a + i));
+                            Batch::store(result + i, Batch::min(Batch::load(c + i), lower));
+                        }
+                        return true;
+                    default:
+                        return false;
+                }
+            }
+        }  // namespace kernels
+    }  // namespace implicit
+}  // namespace NMR
@@ -0,0 +1,111 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelLevelSetMesher.h defines the class CModelLevelSetMesher, which
+extracts the surface of a levelset object as triangle mesh. The levelset
+function is sampled on a regular grid over the bounding box of the levelset
+mesh and triangulated with marching tetrahedra. Regions, which the bounds of
+the function prove to be entirely inside or outside, are skipped.
+
+--*/
+
+#ifndef __NMR_MODELLEVELSETMESHER
+#define __NMR_MODELLEVELSETMESHER
+
+#include "Common/Math/NMR_Geometry.h"
+#include "Model/Classes/NMR_ModelImplicitEvaluator.h"
+
+#include <array>
+#include <vector>
+
+// Number of grid cells per axis, which are evaluated and triangulated together
+#define NMR_LEVELSET_BRICKCELLS 16
+// Grid resolution if the levelset has no minimal feature size
+#define NMR_LEVELSET_DEFAULTCELLSPERAXIS 128
+// Upper limit of the grid resolution, which overrides the minimal feature size
+#define NMR_LEVELSET_MAXCELLSPERAXIS 1024
+#define NMR_LEVELSET_TASKSPERTHREAD 4
+
+namespace NMR {
+
+	class CMesh;
+	class CThreadPool;
+	class CModelLevelSetObject;
+
+	class CModelLevelSetMesher {
+	private:
+		PModelImplicitEvaluator m_pEvaluator;
+		nfUint32 m_nChannelOffset;
+		nfUint32 m_nOutputStride;
+		NMATRIX3 m_mTransform;
+		nfDouble m_dFallBackValue;
+
+		// Bounding box of the levelset mesh, which clips the surface
+		std::array<nfDouble, 3> m_vDomainMin;
+		std::array<nfDouble, 3> m_vDomainMax;
+		nfBool m_bEmptyDomain;
+
+		// The grid has one cell of padding around the domain, so the surface is closed
+		nfDouble m_dCellSize;
+		std::array<nfDouble, 3> m_vGridOrigin;
+		std::array<nfUint32, 3> m_nCellCount;
+		std::array<nfUint32, 3> m_nBrickCount;
+
+		// Crossings of the surface with the grid, identified by their grid edge
+		struct sBrickVertex {
+			nfUint64 m_nEdgeKey;
+			NVEC3 m_vPosition;
+		};
+
+		struct sBrickResult {
+			std::vector<sBrickVertex> m_Vertices;
+			std::vector<std::array<nfUint32, 3>> m_Triangles;
+		};
+
+		// Conservative test on the grid vertices of a block of cells, based on
+		// interval bounds of the levelset function
+		nfBool mayContainSurface(_In_ const std::array<nfUint32, 3> & vFirstCell, _In_ const std::array<nfUint32, 3> & vCellCount);
+		// Octree subdivision of a block of bricks down to the bricks, which need to be triangulated
+		void collectBricks(_In_ const std::array<nfUint32, 3> & vFirstBrick, _In_ const std::array<nfUint32, 3> & vBrickCount, _Inout_ std::vector<nfUint32> & Bricks);
+		void evaluateBrick(_In_ const std::array<nfUint32, 3> & vFirstCell, _In_ const std::array<nfUint32, 3> & vCellCount, _Out_ std::vector<nfDouble> & Values);
+		void triangulateBrick(_In_ nfUint32 nBrickIndex, _Out_ sBrickResult & Result);
+
+	public:
+		CModelLevelSetMesher() = delete;
+		CModelLevelSetMesher(_In_ CModelLevelSetObject & LevelSet);
+
+		nfDouble getCellSize();
+		void setCellSize(_In_ nfDouble dCellSize);
+
+		// Appends the surface of the levelset to pMesh
+		void extractMesh(_In_ CMesh * pMesh, _In_opt_ CThreadPool * pThreadPool);
+	};
+
+}
+
+#endif // __NMR_MODELLEVELSETMESHER
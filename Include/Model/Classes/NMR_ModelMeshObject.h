@@ -41,6 +41,9 @@ mesh object.
 #include "Model/Classes/NMR_ModelTriangleSet.h"
 #include "Model/Classes/NMR_ModelMeshBeamLatticeAttributes.h"
 
+// Meshes with at least this number of faces are checked for manifoldness in parallel
+#define NMR_MODELMESHOBJECT_PARALLELCHECKFACECOUNT (1 << 18)
+
 namespace NMR {
 
 	class CModel;
@@ -49,9 +52,21 @@ namespace NMR {
 	class CModelObject;
 	typedef std::shared_ptr <CModelObject> PModelObject;
 
+	class CModelMeshObject;
+
+	// Fills in the geometry of a mesh object, whose content is read on first access
+	class CModelMeshLoader {
+	public:
+		virtual ~CModelMeshLoader() = default;
+		virtual void loadMesh(_In_ CModelMeshObject * pMeshObject) = 0;
+	};
+
+	typedef std::shared_ptr <CModelMeshLoader> PModelMeshLoader;
+
 	class CModelMeshObject : public CModelObject {
 	private:
 		PMesh m_pMesh; 
+		PModelMeshLoader m_pMeshLoader;
 
 		PModelVolumeData m_pVolumeData;
 		PModelMeshBeamLatticeAttributes m_pBeamLatticeAttributes;
@@ -59,6 +74,9 @@ namespace NMR {
 		std::map<std::string, PModelTriangleSet> m_TriangleSetMap;
 		std::vector<PModelTriangleSet> m_TriangleSets;
 
+		// Runs a pending mesh loader, before the geometry or the data referring to it is accessed
+		void ensureMeshLoaded();
+
 	public:
 		CModelMeshObject() = delete;
 		CModelMeshObject(_In_ const ModelResourceID sID, _In_ CModel * pModel);
@@ -68,6 +86,10 @@ namespace NMR {
 		_Ret_notnull_ CMesh * getMesh ();
 		void setMesh (_In_ PMesh pMesh);
 
+		// The loader is called once, when the geometry is accessed for the first time
+		void setMeshLoader(_In_ PModelMeshLoader pMeshLoader);
+		nfBool isMeshLoaded();
+
 		void mergeToMesh(_In_ CMesh * pMesh, _In_ const NMATRIX3 mMatrix) override;
 
 		void setObjectType(_In_ eModelObjectType ObjectType) override;
@@ -194,6 +194,20 @@ namespace NMR {
 		MODELCOMPOSITIONSPACE_LINEARCOLOR = 1
 	};
 
+	enum eModelPackagePartType {
+		MODELPACKAGEPARTTYPE_MODEL = 0,
+		MODELPACKAGEPARTTYPE_IMAGE = 1,
+		MODELPACKAGEPARTTYPE_ATTACHMENT = 2
+	};
+
+	// Mapped to DEFLATE levels by CModelWriter, stored parts are written as uncompressed ZIP entries
+	enum eModelCompressionLevel {
+		MODELCOMPRESSIONLEVEL_STORED = 0,
+		MODELCOMPRESSIONLEVEL_FASTEST = 1,
+		MODELCOMPRESSIONLEVEL_DEFAULT = 6,
+		MODELCOMPRESSIONLEVEL_MAXIMUM = 9
+	};
+
 	typedef struct {
 		FLOAT m_fPosition[2];
 	} MODELSLICEVERTEX;
@@ -37,6 +37,8 @@ A model reader reads in a model file and generates an in-memory representation o
 #include "Model/Classes/NMR_ModelContext.h"
 #include "Common/NMR_ModelWarnings.h" 
 #include "Common/MeshImport/NMR_MeshImporter.h" 
+#include "Model/Reader/NMR_ModelReader_MeshStream.h"
+#include "Common/NMR_ThreadPool.h"
 
 #include <list>
 #include <set>
@@ -49,6 +51,17 @@ namespace NMR {
 		std::string m_sPrintTicketContentType;
 		std::set<std::string> m_RelationsToRead;
 
+		nfUint32 m_nWorkerThreadCount;
+		PThreadPool m_pThreadPool;
+
+		// Returns nullptr, if meshes are parsed on the calling thread only
+		PThreadPool threadPool();
+
+		PModelReader_MeshStream m_pMeshStream;
+		// Returns nullptr, if meshes are only read into the model
+		PModelReader_MeshStream meshStream();
+
+		nfBool m_bLazyMeshLoading;
 
 		void readFromMeshImporter(_In_ CMeshImporter * pImporter);
 	public:
@@ -61,6 +74,18 @@ namespace NMR {
 
 		void addRelationToRead(_In_ std::string sRelationShipType);
 		void removeRelationToRead(_In_ std::string sRelationShipType);
+
+		// 0 uses all hardware threads. 1 decodes mesh content on the calling thread,
+		// still through the raw mesh decoder where the XML reader supports it.
+		void setWorkerThreadCount(_In_ nfUint32 nWorkerThreadCount);
+		nfUint32 getWorkerThreadCount();
+
+		// Hands the geometry of all mesh objects to a sink while it is read, nullptr disables streaming
+		void setMeshStream(_In_ PModelReader_MeshStream pMeshStream);
+
+		// Defers parsing mesh geometry until it is first accessed, ignored while a mesh stream is set
+		void setLazyMeshLoading(_In_ nfBool bLazyMeshLoading);
+		nfBool getLazyMeshLoading();
 	};
 
 	typedef std::shared_ptr <CModelReader> PModelReader;
@@ -57,6 +57,9 @@ namespace NMR {
 		void parseContent(_In_ CXmlReader * pXMLReader);
 
 		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
+		// Called for attributes without namespace, with the value length known from the XML reader.
+		// Forwards to OnAttribute by default.
+		virtual void OnSizedAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue, _In_ nfUint32 nValueLength);
 		virtual void OnText(_In_z_ const nfChar * pText, _In_ CXmlReader * pXMLReader);
 		virtual void OnEndElement(_In_ CXmlReader * pXMLReader);
 
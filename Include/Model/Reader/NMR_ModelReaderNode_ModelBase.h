@@ -35,6 +35,8 @@ A model reader model node is a parser for the root node of an XML Model Stream.
 #define __NMR_MODELREADERNODE_MODELBASE
 
 #include "Model/Reader/NMR_ModelReaderNode.h"
+#include "Model/Reader/NMR_ModelReader_MeshStream.h"
+#include "Common/NMR_ThreadPool.h"
 
 namespace NMR {
 
@@ -54,6 +56,10 @@ namespace NMR {
 
 		nfBool m_bHaveWarnedAboutV093;
 
+		PThreadPool m_pThreadPool;
+		PModelReader_MeshStream m_pMeshStream;
+		PImportStream m_pLazyMeshPart;
+
 		void ReadMetaDataNode(_In_ CXmlReader * pXMLReader);
 
 		virtual void CheckRequiredExtensions();
@@ -74,6 +80,10 @@ namespace NMR {
 		void setIgnoreBuild(bool bIgnoreBuild);
 		nfBool ignoreMetaData();
 		void setIgnoreMetaData(bool bIgnoreMetaData);
+		void setThreadPool(_In_ PThreadPool pThreadPool);
+		void setMeshStream(_In_ PModelReader_MeshStream pMeshStream);
+		// Mesh content is parsed from pLazyMeshPart on first access, nullptr parses it right away
+		void setLazyMeshPart(_In_ PImportStream pLazyMeshPart);
 	};
 
 	typedef std::shared_ptr <CModelReaderNode_ModelBase> PModelReaderNode_ModelBase;
@@ -46,6 +46,9 @@ namespace NMR {
 		virtual PImportStream extract3MFOPCPackage(_In_ PImportStream pPackageStream) = 0;
 		virtual void release3MFOPCPackage() = 0;
 
+		// Copies a part of the package, so that it can be read after the package has been released
+		virtual PImportStream copyPartToMemory(_In_ PImportStream pPartStream);
+
 	public:
 		CModelReader_3MF() = delete;
 		CModelReader_3MF(_In_ PModel pModel);
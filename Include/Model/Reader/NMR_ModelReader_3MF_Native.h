@@ -57,6 +57,7 @@ namespace NMR {
 	
 		virtual PImportStream extract3MFOPCPackage(_In_ PImportStream pPackageStream);
 		virtual void release3MFOPCPackage();
+		virtual PImportStream copyPartToMemory(_In_ PImportStream pPartStream);
 
 	public:
 		CModelReader_3MF_Native() = delete;
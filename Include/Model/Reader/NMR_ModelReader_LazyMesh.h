@@ -0,0 +1,84 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelReader_LazyMesh.h defines a loader for mesh objects, whose content is parsed on first access.
+While the model is read, only the byte range of the content of the mesh node within the
+decompressed model part is recorded. The part is kept in memory, and the content is parsed when
+the geometry of the mesh object is accessed for the first time.
+
+--*/
+
+#ifndef __NMR_MODELREADER_LAZYMESH
+#define __NMR_MODELREADER_LAZYMESH
+
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+#include "Common/Platform/NMR_ImportStream.h"
+#include "Common/Platform/NMR_XmlReader.h"
+#include "Model/Classes/NMR_ModelMeshObject.h"
+
+#include <map>
+#include <memory>
+#include <string>
+
+#define NMR_MODELREADER_LAZYMESH_SKIPBUFFERSIZE (1024 * 1024)
+
+namespace NMR {
+
+	class CModelReader_LazyMesh : public CModelMeshLoader {
+	private:
+		PImportStream m_pPartStream;
+		CModel * m_pModel;
+		std::string m_sPath;
+
+		std::string m_sDefaultNameSpace;
+		std::map<std::string, std::string> m_NameSpaces;
+		nfUint64 m_nContentStart;
+		nfUint64 m_nContentSize;
+
+	protected:
+		// Parses the mesh node the XML reader is positioned at into the mesh object
+		virtual void parseMesh(_In_ CXmlReader * pXMLReader, _In_ CModelMeshObject * pMeshObject) = 0;
+
+	public:
+		CModelReader_LazyMesh() = delete;
+		// pPartStream is the seekable in-memory stream the model part at sPath is read from
+		CModelReader_LazyMesh(_In_ PImportStream pPartStream, _In_ CModel * pModel, _In_ const std::string & sPath);
+
+		// Skips the content of the mesh node whose attributes have just been parsed, and records its byte range.
+		// Returns false, if the XML reader cannot skip the content; the content has to be parsed right away then.
+		nfBool skipContent(_In_ CXmlReader * pXMLReader);
+
+		void loadMesh(_In_ CModelMeshObject * pMeshObject) override;
+	};
+
+	typedef std::shared_ptr <CModelReader_LazyMesh> PModelReader_LazyMesh;
+
+}
+
+#endif // __NMR_MODELREADER_LAZYMESH
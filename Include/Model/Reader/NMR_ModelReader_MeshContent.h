@@ -0,0 +1,134 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelReader_MeshContent.h defines parsers for the plain vertex and triangle content of a
+mesh node. The raw XML text is split into segments at element boundaries, which are decoded
+independently (optionally in parallel) and committed to the mesh in document order. Any content
+that is not understood is handed back to the XML reader and parsed by the regular reader nodes.
+
+--*/
+
+#ifndef __NMR_MODELREADER_MESHCONTENT
+#define __NMR_MODELREADER_MESHCONTENT
+
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+#include "Common/NMR_ThreadPool.h"
+#include "Common/Platform/NMR_XmlReader.h"
+#include "Common/Mesh/NMR_Mesh.h"
+#include "Model/Reader/NMR_ModelReader_MeshStream.h"
+
+#include <functional>
+#include <vector>
+
+#define NMR_MODELREADER_MESHCONTENT_SEGMENTSIZE (256 * 1024)
+#define NMR_MODELREADER_MESHCONTENT_SEGMENTSPERTHREAD 4
+
+namespace NMR {
+
+	enum eModelReaderMeshContentStatus {
+		MODELREADERMESHCONTENT_SEGMENTEND,
+		MODELREADERMESHCONTENT_CONTAINEREND,
+		MODELREADERMESHCONTENT_INCOMPLETE,
+		MODELREADERMESHCONTENT_UNKNOWNCONTENT
+	};
+
+	// Attribute values of a triangle element, -1 (or 0 for the property ID) if not given
+	typedef struct {
+		nfInt32 m_nIndices[3];
+		nfInt32 m_nPropertyID;
+		nfInt32 m_nPropertyIndices[3];
+	} MODELREADERTRIANGLE;
+
+	class CModelReader_MeshContent {
+	private:
+		std::vector<nfChar> m_Buffer;
+		std::vector<nfUint32> m_SegmentStarts;
+		std::vector<eModelReaderMeshContentStatus> m_SegmentStatus;
+		std::vector<const nfChar *> m_SegmentStops;
+
+	protected:
+		virtual void prepareSegments(_In_ nfUint32 nSegmentCount) = 0;
+		// Decodes the elements of one segment. Must not modify shared state, as segments are decoded in parallel.
+		virtual eModelReaderMeshContentStatus decodeSegment(_In_ nfUint32 nSegmentIndex, _In_ const nfChar * pStart, _In_ const nfChar * pEnd, _Out_ const nfChar ** ppStop) = 0;
+		virtual void commitSegment(_In_ nfUint32 nSegmentIndex) = 0;
+		// Called with the decoded segments of a chunk before they are committed
+		virtual void reserveSegments(_In_ nfUint32 nSegmentCount);
+
+	public:
+		virtual ~CModelReader_MeshContent() = default;
+
+		// Returns true, if the XML reader is positioned at raw content in the core namespace
+		static nfBool canParse(_In_ CXmlReader * pXMLReader);
+
+		// Parses as much content as possible and hands the rest back to the XML reader
+		void parse(_In_ CXmlReader * pXMLReader, _In_opt_ CThreadPool * pThreadPool);
+	};
+
+	class CModelReader_MeshVertices : public CModelReader_MeshContent {
+	private:
+		CMesh * m_pMesh;
+		CModelReader_MeshStream * m_pMeshStream;
+		std::vector<std::vector<NVEC3>> m_SegmentVertices;
+
+	protected:
+		virtual void prepareSegments(_In_ nfUint32 nSegmentCount);
+		virtual eModelReaderMeshContentStatus decodeSegment(_In_ nfUint32 nSegmentIndex, _In_ const nfChar * pStart, _In_ const nfChar * pEnd, _Out_ const nfChar ** ppStop);
+		virtual void commitSegment(_In_ nfUint32 nSegmentIndex);
+		virtual void reserveSegments(_In_ nfUint32 nSegmentCount);
+
+	public:
+		CModelReader_MeshVertices() = delete;
+		// Vertices are handed to pMeshStream as well, if given
+		CModelReader_MeshVertices(_In_ CMesh * pMesh, _In_opt_ CModelReader_MeshStream * pMeshStream = nullptr);
+	};
+
+	typedef std::function<void(_In_ const MODELREADERTRIANGLE & Triangle)> ModelReaderTriangleCallback;
+
+	class CModelReader_MeshTriangles : public CModelReader_MeshContent {
+	private:
+		CMesh * m_pMesh;
+		CModelReader_MeshStream * m_pMeshStream;
+		ModelReaderTriangleCallback m_fnAddTriangle;
+		std::vector<std::vector<MODELREADERTRIANGLE>> m_SegmentTriangles;
+
+	protected:
+		virtual void prepareSegments(_In_ nfUint32 nSegmentCount);
+		virtual eModelReaderMeshContentStatus decodeSegment(_In_ nfUint32 nSegmentIndex, _In_ const nfChar * pStart, _In_ const nfChar * pEnd, _Out_ const nfChar ** ppStop);
+		virtual void commitSegment(_In_ nfUint32 nSegmentIndex);
+		virtual void reserveSegments(_In_ nfUint32 nSegmentCount);
+
+	public:
+		CModelReader_MeshTriangles() = delete;
+		// Faces are only reserved in the mesh, if pMeshStream is not given or retains the geometry
+		CModelReader_MeshTriangles(_In_ CMesh * pMesh, _In_ ModelReaderTriangleCallback fnAddTriangle, _In_opt_ CModelReader_MeshStream * pMeshStream = nullptr);
+	};
+
+}
+
+#endif // __NMR_MODELREADER_MESHCONTENT
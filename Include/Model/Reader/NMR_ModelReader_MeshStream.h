@@ -0,0 +1,101 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelReader_MeshStream.h defines a sink for the vertices and triangles of the mesh
+objects of a model stream. Instead of only being committed to the in-memory mesh, the geometry
+is collected in fixed size blocks and handed to user callbacks in document order. If the geometry
+is not retained, the meshes of the model stay empty and the peak memory of the reader does not
+depend on the size of the meshes.
+
+--*/
+
+#ifndef __NMR_MODELREADER_MESHSTREAM
+#define __NMR_MODELREADER_MESHSTREAM
+
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+#include "Common/Math/NMR_Geometry.h"
+#include "Model/Classes/NMR_ModelTypes.h"
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#define NMR_MODELREADER_MESHSTREAM_BLOCKSIZE 65536
+
+namespace NMR {
+
+	typedef struct {
+		nfUint32 m_nIndices[3];
+	} MODELREADERSTREAMTRIANGLE;
+
+	// Called with the unique resource ID of the mesh object, the index of the first element and the elements of the block
+	typedef std::function<void(_In_ UniqueResourceID nUniqueResourceID, _In_ nfUint32 nStartIndex, _In_ nfUint32 nCount, _In_ const NVEC3 * pVertices)> ModelReaderVertexBlockCallback;
+	typedef std::function<void(_In_ UniqueResourceID nUniqueResourceID, _In_ nfUint32 nStartIndex, _In_ nfUint32 nCount, _In_ const MODELREADERSTREAMTRIANGLE * pTriangles)> ModelReaderTriangleBlockCallback;
+
+	class CModelReader_MeshStream {
+	private:
+		ModelReaderVertexBlockCallback m_fnVertexBlock;
+		ModelReaderTriangleBlockCallback m_fnTriangleBlock;
+		nfBool m_bRetainGeometry;
+
+		UniqueResourceID m_nUniqueResourceID;
+		nfUint32 m_nVertexCount;
+		nfUint32 m_nTriangleCount;
+		nfUint32 m_nFlushedVertexCount;
+		nfUint32 m_nFlushedTriangleCount;
+		std::vector<NVEC3> m_Vertices;
+		std::vector<MODELREADERSTREAMTRIANGLE> m_Triangles;
+
+		void flushVertices();
+		void flushTriangles();
+
+	public:
+		CModelReader_MeshStream() = delete;
+		CModelReader_MeshStream(_In_ ModelReaderVertexBlockCallback fnVertexBlock, _In_ ModelReaderTriangleBlockCallback fnTriangleBlock, _In_ nfBool bRetainGeometry);
+
+		// If false, the mesh of a streamed object stays empty
+		nfBool retainGeometry() const;
+
+		void beginMesh(_In_ UniqueResourceID nUniqueResourceID);
+		// Hands all remaining blocks of the current mesh to the callbacks
+		void endMesh();
+
+		void addVertex(_In_ const NVEC3 & vPosition);
+		void addTriangle(_In_ nfUint32 nIndex1, _In_ nfUint32 nIndex2, _In_ nfUint32 nIndex3);
+
+		// Number of vertices and triangles of the current mesh, including the ones already handed out
+		nfUint32 getVertexCount() const;
+		nfUint32 getTriangleCount() const;
+	};
+
+	typedef std::shared_ptr <CModelReader_MeshStream> PModelReader_MeshStream;
+
+}
+
+#endif // __NMR_MODELREADER_MESHSTREAM
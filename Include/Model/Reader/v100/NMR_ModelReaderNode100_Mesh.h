@@ -41,12 +41,15 @@ A mesh reader model node is a parser for the mesh node of an XML Model Stream.
 #include "Model/Classes/NMR_ModelVolumeData.h"
 #include "Model/Classes/NMR_ModelMeshObject.h"
 #include "Model/Classes/NMR_ModelTriangleSet.h"
+#include "Model/Reader/NMR_ModelReader_MeshStream.h"
+#include "Model/Reader/NMR_ModelReader_LazyMesh.h"
+#include "Common/NMR_ThreadPool.h"
 
 namespace NMR {
 
 	class CModelReaderNode100_Mesh : public CModelReaderNode {
 	private:
-		PModelMeshObject m_pMesh;
+		CModelMeshObject * m_pMesh;
 		CModel * m_pModel;
 		std::vector<PModelTriangleSet> m_pTriangleSets;
 
@@ -62,6 +65,12 @@ namespace NMR {
 
 		nfBool m_bHasVolumeDataID = false;
 		ModelResourceID m_nVolumeDataID = 0;
+
+		PThreadPool m_pThreadPool;
+		PModelReader_MeshStream m_pMeshStream;
+
+		PModelReader_LazyMesh m_pLazyMesh;
+		nfBool m_bContentSkipped;
 	protected:
 		void OnNSAttribute(_In_z_ const nfChar *pAttributeName,
 							_In_z_ const nfChar *pAttributeValue,
@@ -69,13 +78,17 @@ namespace NMR {
 		void OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader) override;
 	public:
 		CModelReaderNode100_Mesh() = delete;
-		CModelReaderNode100_Mesh(_In_ CModel * pModel, PModelMeshObject pMesh, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor, _In_ PPackageResourceID m_pObjectLevelPropertyID, _In_ ModelResourceIndex nDefaultPropertyIndex);
+		CModelReaderNode100_Mesh(_In_ CModel * pModel, _In_ CModelMeshObject * pMesh, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor, _In_ PPackageResourceID m_pObjectLevelPropertyID, _In_ ModelResourceIndex nDefaultPropertyIndex, _In_ PThreadPool pThreadPool, _In_ PModelReader_MeshStream pMeshStream);
 
 		virtual void parseXML(_In_ CXmlReader * pXMLReader);
 		void retrieveClippingInfo(_Out_ eModelBeamLatticeClipMode &eClipMode, _Out_ nfBool & bHasClippingMode, _Out_ ModelResourceID & nClippingMeshID);
 		void retrieveRepresentationInfo(_Out_ nfBool & bHasRepresentation, _Out_ ModelResourceID & nRepresentationMeshID);
 
 		std::vector<PModelTriangleSet> getTriangleSets ();
+
+		// If set, the content is skipped and its byte range is recorded in pLazyMesh, if possible
+		void setLazyMesh(_In_ PModelReader_LazyMesh pLazyMesh);
+		nfBool getContentSkipped();
 	};
 	typedef std::shared_ptr <CModelReaderNode100_Mesh> PModelReaderNode100_Mesh;
 }
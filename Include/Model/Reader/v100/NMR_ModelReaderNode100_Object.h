@@ -36,6 +36,7 @@ A object reader model node is a parser for the object node of an XML Model Strea
 
 #include "Model/Reader/NMR_ModelReaderNode.h"
 #include "Model/Reader/v100/NMR_ModelReaderNode100_Mesh.h"
+#include "Model/Reader/NMR_ModelReader_LazyMesh.h"
 #include "Model/Reader/NMR_ModelReader_TexCoordMapping.h"
 #include "Model/Classes/NMR_ModelComponent.h"
 #include "Model/Classes/NMR_ModelComponentsObject.h"
@@ -45,6 +46,9 @@ A object reader model node is a parser for the object node of an XML Model Strea
 
 namespace NMR {
 
+	class CModelReaderNode100_Object;
+	typedef std::shared_ptr <CModelReaderNode100_Object> PModelReaderNode100_Object;
+
 	class CModelReaderNode100_Object : public CModelReaderNode {
 	private:
 		CModel * m_pModel;
@@ -69,17 +73,37 @@ namespace NMR {
 
 		PModelMetaDataGroup m_MetaDataGroup;
 
-		void createDefaultProperties();
-		void handleBeamLatticeExtension(CModelReaderNode100_Mesh* pXMLNode);
+		PThreadPool m_pThreadPool;
+		PModelReader_MeshStream m_pMeshStream;
+		PImportStream m_pLazyMeshPart;
+
+		void createDefaultProperties(_In_ CModelMeshObject * pMeshObject);
+		void handleBeamLatticeExtension(_In_ CModelMeshObject * pMeshObject, _In_ CModelReaderNode100_Mesh* pXMLNode);
+		PModelReader_LazyMesh createLazyMesh();
 	protected:
 		virtual void OnNSAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue, _In_z_ const nfChar * pNameSpace);
 		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
 		virtual void OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader);
 	public:
 		CModelReaderNode100_Object() = delete;
-		CModelReaderNode100_Object(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor);
+		// If pLazyMeshPart is given, mesh content is parsed from this model part stream on first access
+		CModelReaderNode100_Object(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor, _In_ PThreadPool pThreadPool, _In_ PModelReader_MeshStream pMeshStream, _In_ PImportStream pLazyMeshPart);
 
 		virtual void parseXML(_In_ CXmlReader * pXMLReader);
+
+		// Parses the skipped content of a mesh node with the object-level properties of this object
+		void readLazyMesh(_In_ CXmlReader * pXMLReader, _In_ CModelMeshObject * pMeshObject);
+	};
+
+	// Parses the content of a mesh node on first access, with a copy of the state of its object node
+	class CModelReaderNode100_LazyMesh : public CModelReader_LazyMesh {
+	private:
+		PModelReaderNode100_Object m_pObjectNode;
+	protected:
+		void parseMesh(_In_ CXmlReader * pXMLReader, _In_ CModelMeshObject * pMeshObject) override;
+	public:
+		CModelReaderNode100_LazyMesh() = delete;
+		CModelReaderNode100_LazyMesh(_In_ PModelReaderNode100_Object pObjectNode, _In_ PImportStream pPartStream, _In_ CModel * pModel, _In_ const std::string & sPath);
 	};
 
 }
@@ -36,6 +36,8 @@ A resources reader model node is a parser for the resources node of an XML Model
 
 #include "Model/Reader/NMR_ModelReaderNode.h"
 #include "Model/Classes/NMR_ModelTexture2DGroup.h"
+#include "Model/Reader/NMR_ModelReader_MeshStream.h"
+#include "Common/NMR_ThreadPool.h"
 
 namespace NMR {
 
@@ -46,11 +48,15 @@ namespace NMR {
 
 		int m_nProgressCount;
 
+		PThreadPool m_pThreadPool;
+		PModelReader_MeshStream m_pMeshStream;
+		PImportStream m_pLazyMeshPart;
+
 		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar *  pAttributeValue);
 		virtual void OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader);
 	public:
 		CModelReaderNode100_Resources() = delete;
-		CModelReaderNode100_Resources(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_z_ const std::string sPath, _In_ PProgressMonitor pProgressMonitor);
+		CModelReaderNode100_Resources(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_z_ const std::string sPath, _In_ PProgressMonitor pProgressMonitor, _In_ PThreadPool pThreadPool, _In_ PModelReader_MeshStream pMeshStream, _In_ PImportStream pLazyMeshPart);
 		virtual void parseXML(_In_ CXmlReader * pXMLReader);
 	};
 
@@ -35,6 +35,7 @@ A triangle reader model node is a parser for the triangle node of an XML Model S
 #define __NMR_MODELREADERNODE100_TRIANGLE
 
 #include "Model/Reader/NMR_ModelReaderNode.h"
+#include "Model/Reader/NMR_ModelReader_MeshContent.h"
 #include "Model/Classes/NMR_ModelComponent.h"
 #include "Model/Classes/NMR_ModelObject.h"
 
@@ -50,14 +51,13 @@ namespace NMR {
 		nfInt32 m_nIndex2;
 		nfInt32 m_nIndex3;
 
-		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
+		virtual void OnSizedAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue, _In_ nfUint32 nValueLength);
 	public:
 		CModelReaderNode100_Triangle() = delete;
 		CModelReaderNode100_Triangle(_In_ PModelWarnings pWarnings);
 
 		virtual void parseXML(_In_ CXmlReader * pXMLReader);
-		void retrieveIndices(_Out_ nfInt32 & nIndex1, _Out_ nfInt32 & nIndex2, _Out_ nfInt32 & nIndex3, nfInt32 nNodeCount);
-		nfBool retrieveProperties(_Inout_ ModelResourceID & nPropertyID, _Inout_ ModelResourceIndex & nPropertyIndex1, _Inout_ ModelResourceIndex & nPropertyIndex2, _Inout_ ModelResourceIndex & nPropertyIndex3);
+		void retrieveTriangle(_Out_ MODELREADERTRIANGLE & Triangle);
 	};
 
 	typedef std::shared_ptr <CModelReaderNode100_Triangle> PModelReaderNode100_Triangle;
@@ -37,6 +37,8 @@ A triangles reader model node is a parser for the triangles node of an XML Model
 #include "Common/MeshInformation/NMR_MeshInformation_Properties.h"
 #include "Model/Reader/NMR_ModelReaderNode.h"
 #include "Model/Reader/NMR_ModelReader_TexCoordMapping.h"
+#include "Model/Reader/NMR_ModelReader_MeshContent.h"
+#include "Model/Reader/NMR_ModelReader_MeshStream.h"
 #include "Model/Classes/NMR_ModelComponent.h"
 #include "Model/Classes/NMR_ModelObject.h"
 
@@ -50,15 +52,18 @@ namespace NMR {
 		PPackageResourceID m_pObjectLevelPropertyID;
 		ModelResourceIndex m_nDefaultResourceIndex;
 		ModelResourceID m_nUsedResourceID;
+		PThreadPool m_pThreadPool;
+		PModelReader_MeshStream m_pMeshStream;
 
 		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
 		virtual void OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader);
 
 		_Ret_notnull_ CMeshInformation_Properties * createPropertiesInformation();
+		void addTriangle(_In_ const MODELREADERTRIANGLE & Triangle);
 	public:
 		CModelReaderNode100_Triangles() = delete;
 		CModelReaderNode100_Triangles(_In_ CModel * pModel, _In_ CMesh * pMesh, _In_ PModelWarnings pWarnings,
-			_In_ PPackageResourceID pObjectLevelPropertyID, _In_ ModelResourceIndex nDefaultPropertyIndex);
+			_In_ PPackageResourceID pObjectLevelPropertyID, _In_ ModelResourceIndex nDefaultPropertyIndex, _In_ PThreadPool pThreadPool, _In_ PModelReader_MeshStream pMeshStream);
 
 		virtual void parseXML(_In_ CXmlReader * pXMLReader);
 		ModelResourceID getUsedPropertyID() const;
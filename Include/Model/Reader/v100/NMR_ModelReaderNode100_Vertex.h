@@ -52,7 +52,7 @@ namespace NMR {
 		CModelReaderNode100_Vertex() = delete;
 		CModelReaderNode100_Vertex(_In_ PModelWarnings pWarnings);
 
-		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
+		virtual void OnSizedAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue, _In_ nfUint32 nValueLength);
 
 		virtual void parseXML(_In_ CXmlReader * pXMLReader);
 
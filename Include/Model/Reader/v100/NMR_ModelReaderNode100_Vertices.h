@@ -37,18 +37,22 @@ A vertices reader model node is a parser for the vertices node of an XML Model S
 #include "Model/Reader/NMR_ModelReaderNode.h"
 #include "Model/Classes/NMR_ModelComponent.h"
 #include "Model/Classes/NMR_ModelObject.h"
+#include "Model/Reader/NMR_ModelReader_MeshStream.h"
+#include "Common/NMR_ThreadPool.h"
 
 namespace NMR {
 
 	class CModelReaderNode100_Vertices : public CModelReaderNode {
 	private:
 		CMesh * m_pMesh;
+		PThreadPool m_pThreadPool;
+		PModelReader_MeshStream m_pMeshStream;
 	protected:
 		virtual void OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue);
 		virtual void OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader);
 	public:
 		CModelReaderNode100_Vertices() = delete;
-		CModelReaderNode100_Vertices(_In_ CMesh * pMesh, _In_ PModelWarnings pWarnings);
+		CModelReaderNode100_Vertices(_In_ CMesh * pMesh, _In_ PModelWarnings pWarnings, _In_ PThreadPool pThreadPool, _In_ PModelReader_MeshStream pMeshStream);
 
 		virtual void parseXML(_In_ CXmlReader * pXMLReader);
 	};
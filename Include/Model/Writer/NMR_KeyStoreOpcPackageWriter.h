@@ -37,6 +37,7 @@ NMR_KeyStoreOpcPackageWriter.h defines an OPC Package writer in a portable way.
 
 #include "Common/OPC/NMR_IOpcPackageWriter.h"
 #include "Common/Platform/NMR_ExportStream.h"
+#include "Common/NMR_ThreadPool.h"
 
 namespace NMR {
 
@@ -57,15 +58,16 @@ namespace NMR {
 
 		void writeKeyStoreStream(_In_ CXmlWriter * pXMLWriter);
 		void refreshAllResourceDataGroups();
-		POpcPackagePart wrapPartStream(PKeyStoreResourceData rd, POpcPackagePart part);
+		POpcPackagePart wrapPartStream(PKeyStoreResourceData rd, POpcPackagePart part, nfInt32 nCompressionLevel);
 		void refreshResourceDataTag(PKeyStoreResourceData rd);
 		void refreshAccessRight(PKeyStoreAccessRight ar, std::vector<nfByte> const & key);
 	public:
 		CKeyStoreOpcPackageWriter(
 			_In_ PExportStream pImportStream, 
-			_In_ CModelContext const & context);
+			_In_ CModelContext const & context,
+			_In_ PThreadPool pThreadPool);
 
-		POpcPackagePart addPart(_In_ std::string sPath) override;
+		POpcPackagePart addPart(_In_ std::string sPath, _In_ nfInt32 nCompressionLevel) override;
 		void close() override;
 		void addContentType(std::string sExtension, std::string sContentType) override;
 		void addContentType(_In_ POpcPackagePart pOpcPackagePart, _In_ std::string sContentType) override;
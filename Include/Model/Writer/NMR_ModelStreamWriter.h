@@ -0,0 +1,119 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelStreamWriter.h defines a writer, which streams mesh objects into the root model part
+of a 3MF package while they are generated. Vertices and triangles are rendered and compressed
+batch by batch, so the writer never holds more than one batch of geometry in memory. Only
+plain mesh objects and build items are supported.
+
+--*/
+
+#ifndef __NMR_MODELSTREAMWRITER
+#define __NMR_MODELSTREAMWRITER
+
+#include "Common/NMR_Types.h"
+#include "Common/NMR_Local.h"
+#include "Common/Math/NMR_Geometry.h"
+#include "Common/Math/NMR_Matrix.h"
+#include "Common/OPC/NMR_OpcPackageWriter.h"
+#include "Common/Platform/NMR_ExportStream.h"
+#include "Common/Platform/NMR_XmlWriter_Native.h"
+#include "Common/3MF_ProgressMonitor.h"
+#include "Model/Classes/NMR_Model.h"
+#include "Model/Classes/NMR_ModelMeshObject.h"
+#include "Model/Writer/v100/NMR_ModelWriterNode100_Mesh.h"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace NMR {
+
+	enum eModelStreamWriterState {
+		MODELSTREAMWRITERSTATE_RESOURCES,
+		MODELSTREAMWRITERSTATE_VERTICES,
+		MODELSTREAMWRITERSTATE_TRIANGLES,
+		MODELSTREAMWRITERSTATE_FINISHED
+	};
+
+	typedef struct {
+		ModelResourceID m_nObjectID;
+		NMATRIX3 m_mTransform;
+	} MODELSTREAMWRITERBUILDITEM;
+
+	class CModelStreamWriter {
+	private:
+		PExportStream m_pExportStream;
+		POpcPackageWriter m_pPackageWriter;
+		POpcPackagePart m_pModelPart;
+		PXmlWriter_Native m_pXMLWriter;
+
+		// Holds unit and language of the package and owns the placeholder mesh object,
+		// which the mesh writer node needs to render the streamed lines.
+		PModel m_pModel;
+		PModelMeshObject m_pMeshObject;
+		std::unique_ptr<CModelWriterNode100_Mesh> m_pMeshNode;
+
+		eModelStreamWriterState m_eState;
+		ModelResourceID m_nObjectCount;
+		nfUint32 m_nVertexCount;
+		nfUint32 m_nTriangleCount;
+		std::vector<MODELSTREAMWRITERBUILDITEM> m_BuildItems;
+
+		void checkState(_In_ eModelStreamWriterState eState);
+		void writeAttribute(_In_z_ const nfChar * pszName, _In_ const std::string & sValue);
+
+	public:
+		CModelStreamWriter() = delete;
+		CModelStreamWriter(_In_ PExportStream pExportStream, _In_ eModelUnit eUnit);
+
+		CModelStreamWriter(const CModelStreamWriter &) = delete;
+		CModelStreamWriter & operator=(const CModelStreamWriter &) = delete;
+
+		// Opens the object element of a new mesh object and returns its resource ID
+		ModelResourceID beginMeshObject(_In_ const std::string & sName);
+
+		// Vertices must all be added before the first triangle of the object
+		void addVertices(_In_ const NVEC3 * pVertices, _In_ nfUint32 nCount);
+		void addTriangles(_In_ const nfUint32 * pIndices, _In_ nfUint32 nTriangleCount);
+
+		void endMeshObject();
+
+		// Build items are written when the package is finished, so they may refer to any completed object
+		void addBuildItem(_In_ ModelResourceID nObjectID, _In_ const NMATRIX3 & mTransform);
+
+		// Writes the build, closes the model part and writes the package directory
+		void finish();
+		nfBool isFinished();
+	};
+
+	typedef std::shared_ptr<CModelStreamWriter> PModelStreamWriter;
+
+}
+
+#endif // __NMR_MODELSTREAMWRITER
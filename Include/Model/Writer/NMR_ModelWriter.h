@@ -38,6 +38,8 @@ A model writer exports the in memory represenation into the 3MF file.
 #include "Model/Classes/NMR_ModelContext.h"
 #include "Common/Platform/NMR_ExportStream.h" 
 #include "Common/3MF_ProgressMonitor.h" 
+#include "Common/NMR_ThreadPool.h"
+#include <array>
 #include <list>
 
 namespace NMR {
@@ -45,6 +47,17 @@ namespace NMR {
 	class CModelWriter : public CModelContext{
 	private:
 		nfUint32 m_nDecimalPrecision;
+		nfBool m_bShortestRoundtrip;
+		nfUint32 m_nWorkerThreadCount;
+		PThreadPool m_pThreadPool;
+		std::array<eModelCompressionLevel, MODELPACKAGEPARTTYPE_ATTACHMENT + 1> m_CompressionLevels;
+		std::array<nfBool, MODELPACKAGEPARTTYPE_ATTACHMENT + 1> m_CompressionLevelIsSet;
+	protected:
+		// Returns the DEFLATE level of a kind of parts, ZIPCOMPRESSIONLEVEL_UNSPECIFIED if it has not been set
+		nfInt32 zipCompressionLevel(_In_ eModelPackagePartType ePartType);
+
+		// Returns nullptr, if parts are compressed and meshes are rendered on the calling thread only
+		PThreadPool threadPool();
 	public:
 		CModelWriter() = delete;
 		CModelWriter(_In_ PModel pModel);
@@ -54,6 +67,17 @@ namespace NMR {
 
 		void SetDecimalPrecision(nfUint32);
 		nfUint32 GetDecimalPrecision();
+
+		// Writes mesh coordinates with the shortest exact representation instead of the decimal precision
+		void SetShortestRoundtripActive(_In_ nfBool bShortestRoundtrip);
+		nfBool GetShortestRoundtripActive();
+
+		// 0 uses all hardware threads, 1 compresses and renders meshes sequentially
+		void SetWorkerThreadCount(nfUint32 nWorkerThreadCount);
+		nfUint32 GetWorkerThreadCount();
+
+		void SetCompressionLevel(_In_ eModelPackagePartType ePartType, _In_ eModelCompressionLevel eLevel);
+		eModelCompressionLevel GetCompressionLevel(_In_ eModelPackagePartType ePartType);
 	};
 
 	typedef std::shared_ptr <CModelWriter> PModelWriter;
@@ -57,6 +57,10 @@ namespace NMR {
 
 		void addNonRootModels();
 
+		// Reports every object that is not valid for its object type as a warning. The manifold
+		// checks are cached by the meshes, so writing an unchanged model again does not repeat them.
+		void validateObjects();
+
 	public:
 		CModelWriter_3MF_Native() = delete;
 		CModelWriter_3MF_Native(_In_ PModel pModel);
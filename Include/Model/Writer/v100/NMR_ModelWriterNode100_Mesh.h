@@ -41,7 +41,11 @@ This is the class for exporting the 3mf mesh node.
 #include "Common/MeshInformation/NMR_MeshInformation_Properties.h"
 
 #include "Common/Platform/NMR_XmlWriter.h"
+#include "Common/NMR_ThreadPool.h"
 #include <array>
+#include <functional>
+#include <string>
+#include <vector>
 
 #define MODELWRITERMESH100_LINEBUFFERSIZE 1024
 #define MODELWRITERMESH100_VERTEXLINESTART "<vertex x=\""
@@ -59,12 +63,27 @@ This is the class for exporting the 3mf mesh node.
 #define MODELWRITERMESH100_TRIANGLESETS_REFLINESTART "<t:ref index=\""
 #define MODELWRITERMESH100_TRIANGLESETS_REFSTARTLENGTH 14
 
+// Vertex and triangle lists of at least this size are rendered on the writer thread pool
+#define MODELWRITERMESH100_PARALLELMINELEMENTCOUNT 32768
+#define MODELWRITERMESH100_CHUNKELEMENTCOUNT 16384
+#define MODELWRITERMESH100_CHUNKSPERTHREAD 4
+
 
 namespace NMR {
 
+	class CModelWriterNode100_Mesh;
+
+	typedef std::function<void(CModelWriterNode100_Mesh & Renderer, nfUint32 nBegin, nfUint32 nEnd)> ModelWriterMeshRangeFunction;
+
 	class CModelWriterNode100_Mesh : public CModelWriterNode_ModelBase {
 	protected:
 		CModelMeshObject * m_pModelMeshObject;
+		PThreadPool m_pThreadPool;
+
+		// If set, vertex and triangle lines are appended to this chunk instead of being written to the XML writer
+		std::vector<nfByte> * m_pChunkBuffer;
+		std::string m_sChunkIndentation;
+		std::string m_sChunkLineEnding;
 
 		PMeshInformation_PropertyIndexMapping m_pPropertyIndexMapping;
 
@@ -90,6 +109,7 @@ namespace NMR {
 		nfUint32 m_nTriangleSetRefBufferPos;
 	private:
 		const int m_nPosAfterDecPoint;
+		const nfBool m_bShortestRoundtrip;
 		const nfInt64 m_nPutDoubleFactor;
 		__NMR_INLINE void putFloat(_In_ const nfFloat fValue, _In_ std::array<nfChar, MODELWRITERMESH100_LINEBUFFERSIZE> & line, _In_ nfUint32 & nBufferPos);
 		__NMR_INLINE void putDouble(_In_ const nfDouble dValue, _In_ std::array<nfChar, MODELWRITERMESH100_LINEBUFFERSIZE> & line, _In_ nfUint32 & nBufferPos);
@@ -118,21 +138,36 @@ namespace NMR {
 		__NMR_INLINE void putTriangleSetRefString(_In_ const nfChar* pszString);
 		__NMR_INLINE void putTriangleSetRefUInt32(_In_ const nfUint32 nValue);
 
-		__NMR_INLINE void writeVertexData(_In_ MESHNODE * pNode);
-		__NMR_INLINE void writeFaceData_Plain(_In_ MESHFACE * pFace, _In_opt_ const nfChar * pszAdditionalString);
-		__NMR_INLINE void writeFaceData_OneProperty(_In_ MESHFACE * pFace, _In_ const ModelResourceID nPropertyID, _In_ const ModelResourceIndex nPropertyIndex, _In_opt_ const nfChar * pszAdditionalString);
-		__NMR_INLINE void writeFaceData_ThreeProperties(_In_ MESHFACE * pFace, _In_ const ModelResourceID nPropertyID, _In_ const ModelResourceIndex nPropertyIndex1, _In_ const ModelResourceIndex nPropertyIndex2, _In_ const ModelResourceIndex nPropertyIndex3, _In_opt_ const nfChar * pszAdditionalString);
-		__NMR_INLINE void writeBeamData(_In_ MESHBEAM * pBeam, _In_ nfDouble dRadius, _In_ eModelBeamLatticeCapMode eDefaultCapMode);
-		__NMR_INLINE void writeBallData(_In_ MESHBALL * pBall, _In_ eModelBeamLatticeBallMode eBallMode, _In_ nfDouble dRadius);
+		__NMR_INLINE void writeRawLine(_In_ const nfChar * pszLine, _In_ nfUint32 cbCount);
+		void writeVertexRange(_In_ CMesh * pMesh, _In_ nfUint32 nBegin, _In_ nfUint32 nEnd);
+		void writeFaceRange(_In_ CMesh * pMesh, _In_ nfUint32 nBegin, _In_ nfUint32 nEnd, _In_opt_ CMeshInformation_Properties * pProperties,
+			_In_ UniqueResourceID nObjectLevelPropertyID, _In_ ModelResourceIndex nObjectLevelPropertyIndex, _Out_ nfBool & bHasAProperty);
+
+		// Renders ranges of nCount elements into chunks on the thread pool and writes them in order
+		nfBool useParallelRanges(_In_ nfUint32 nCount);
+		void writeRangesInParallel(_In_ nfUint32 nCount, _In_ const ModelWriterMeshRangeFunction & fnWriteRange);
+
+		__NMR_INLINE void writeVertexData(_In_ const MESHNODE * pNode);
+		__NMR_INLINE void writeVertexPosition(_In_ const NVEC3 & vPosition);
+		__NMR_INLINE void writeFaceData_Plain(_In_ const MESHFACE * pFace, _In_opt_ const nfChar * pszAdditionalString);
+		__NMR_INLINE void writeFaceData_OneProperty(_In_ const MESHFACE * pFace, _In_ const ModelResourceID nPropertyID, _In_ const ModelResourceIndex nPropertyIndex, _In_opt_ const nfChar * pszAdditionalString);
+		__NMR_INLINE void writeFaceData_ThreeProperties(_In_ const MESHFACE * pFace, _In_ const ModelResourceID nPropertyID, _In_ const ModelResourceIndex nPropertyIndex1, _In_ const ModelResourceIndex nPropertyIndex2, _In_ const ModelResourceIndex nPropertyIndex3, _In_opt_ const nfChar * pszAdditionalString);
+		__NMR_INLINE void writeBeamData(_In_ const MESHBEAM * pBeam, _In_ nfDouble dRadius, _In_ eModelBeamLatticeCapMode eDefaultCapMode);
+		__NMR_INLINE void writeBallData(_In_ const MESHBALL * pBall, _In_ eModelBeamLatticeBallMode eBallMode, _In_ nfDouble dRadius);
 		__NMR_INLINE void writeRefData(_In_ INT nRefID);
 		__NMR_INLINE void writeBallRefData(_In_ INT nRefID);
 		__NMR_INLINE void writeTriangleSetRefData(_In_ INT nRefID);
 	public:
 		CModelWriterNode100_Mesh() = delete;
 		CModelWriterNode100_Mesh(_In_ CModelMeshObject * pModelMeshObject, _In_ CXmlWriter * pXMLWriter, _In_ PProgressMonitor pProgressMonitor,
-			_In_ PMeshInformation_PropertyIndexMapping pPropertyIndexMapping, _In_ int nPosAfterDecPoint, _In_ nfBool bWriteMaterialExtension, _In_ nfBool m_bWriteBeamLatticeExtension,
-			_In_ nfBool bWriteVolumetricExtension, _In_ nfBool bWriteTriangleSetExtension);
+			_In_ PMeshInformation_PropertyIndexMapping pPropertyIndexMapping, _In_ int nPosAfterDecPoint, _In_ nfBool bShortestRoundtrip, _In_ nfBool bWriteMaterialExtension, _In_ nfBool m_bWriteBeamLatticeExtension,
+			_In_ nfBool bWriteVolumetricExtension, _In_ nfBool bWriteTriangleSetExtension, _In_ PThreadPool pThreadPool = nullptr);
 		virtual void writeToXML();
+
+		// Write vertex and triangle lines of a mesh that is not held in the mesh object, e.g. by a streaming writer.
+		// The caller is responsible for the enclosing elements and for the validity of the indices.
+		void writeStreamedVertices(_In_ const NVEC3 * pVertices, _In_ nfUint32 nCount);
+		void writeStreamedTriangles(_In_ const nfUint32 * pIndices, _In_ nfUint32 nTriangleCount);
 	};
 
 }
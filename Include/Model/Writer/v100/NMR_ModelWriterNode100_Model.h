@@ -39,6 +39,7 @@ This is the class for exporting the 3mf model stream root node.
 #include "Model/Classes/NMR_ModelComponentsObject.h" 
 #include "Model/Classes/NMR_ModelMeshObject.h" 
 #include "Common/Platform/NMR_XmlWriter.h"
+#include "Common/NMR_ThreadPool.h"
 
 #include "Common/MeshInformation/NMR_MeshInformation_Properties.h"
 
@@ -48,6 +49,8 @@ namespace NMR {
 	class CModelWriterNode100_Model : public CModelWriterNode_ModelBase {
 	protected:
 		nfUint32 m_nDecimalPrecision;
+		nfBool m_bShortestRoundtrip;
+		PThreadPool m_pThreadPool;
 		
 		PMeshInformation_PropertyIndexMapping m_pPropertyIndexMapping;
 		
@@ -113,7 +116,7 @@ namespace NMR {
 	public:
 		CModelWriterNode100_Model() = delete;
 		CModelWriterNode100_Model(_In_ CModel * pModel, _In_ CXmlWriter * pXMLWriter, _In_ PProgressMonitor pProgressMonitor, _In_ nfUint32 nDecimalPrecision);
-		CModelWriterNode100_Model(_In_ CModel * pModel, _In_ CXmlWriter * pXMLWriter, _In_ PProgressMonitor pProgressMonitor, _In_ nfUint32 nDecimalPrecision, _In_ nfBool bWritesRootModel);
+		CModelWriterNode100_Model(_In_ CModel * pModel, _In_ CXmlWriter * pXMLWriter, _In_ PProgressMonitor pProgressMonitor, _In_ nfUint32 nDecimalPrecision, _In_ nfBool bShortestRoundtrip, _In_ nfBool bWritesRootModel, _In_ PThreadPool pThreadPool = nullptr);
 		
 		virtual void writeToXML();
 	};
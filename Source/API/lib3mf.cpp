@@ -38,6 +38,7 @@ Interface version: 2.3.2
 #include "lib3mf_interfaceexception.hpp"
 
 #include "lib3mf_model.hpp"
+#include "lib3mf_streamingwriter.hpp"
 
 #include "NMR_Spec_Version.h"
 #include "Model/Classes/NMR_ModelConstants.h" 
@@ -112,6 +113,11 @@ IModel * CWrapper::CreateModel ()
 	return new CModel();
 }
 
+IStreamingWriter * CWrapper::CreateStreamingWriter(const std::string & sFilename, const Lib3MF::eModelUnit eUnit)
+{
+	return new CStreamingWriter(sFilename, eUnit);
+}
+
 void CWrapper::Release (IBase* pInstance)
 {
 	IBase::ReleaseBaseClassInterface(pInstance);
@@ -156,7 +156,7 @@ Lib3MF_uint32 CBeamLattice::GetBeamCount ()
 sLib3MFBeam CBeamLattice::GetBeam (const Lib3MF_uint32 nIndex)
 {
 	sLib3MFBeam beam;
-	NMR::MESHBEAM* meshBeam = m_mesh.getBeam(nIndex);
+	const NMR::MESHBEAM* meshBeam = m_mesh.readBeam(nIndex);
 	beam.m_CapModes[0] = (eLib3MFBeamLatticeCapMode)(meshBeam->m_capMode[0]);
 	beam.m_CapModes[1] = (eLib3MFBeamLatticeCapMode)meshBeam->m_capMode[1];
 
@@ -255,7 +255,7 @@ void CBeamLattice::GetBeams(Lib3MF_uint64 nBeamInfoBufferSize, Lib3MF_uint64* pB
 		sLib3MFBeam* beam = pBeamInfoBuffer;
 		for (Lib3MF_uint32 i = 0; i < beamCount; i++)
 		{
-			const NMR::MESHBEAM* meshBeam = m_mesh.getBeam(i);
+			const NMR::MESHBEAM* meshBeam = m_mesh.readBeam(i);
 			beam->m_CapModes[0] = (eLib3MFBeamLatticeCapMode)meshBeam->m_capMode[0];
 			beam->m_CapModes[1] = (eLib3MFBeamLatticeCapMode)meshBeam->m_capMode[1];
 
@@ -298,7 +298,7 @@ sLib3MFBall CBeamLattice::GetBall (const Lib3MF_uint32 nIndex)
 	}
 
 	if (ballMode == eBeamLatticeBallMode::Mixed) {
-		NMR::MESHBALL * meshBall = m_mesh.getBall(nIndex);
+		const NMR::MESHBALL * meshBall = m_mesh.readBall(nIndex);
 
 		ball.m_Index = meshBall->m_nodeindex;
 
@@ -311,7 +311,7 @@ sLib3MFBall CBeamLattice::GetBall (const Lib3MF_uint32 nIndex)
 
 		Lib3MF_uint32 meshBallCount = m_mesh.getBallCount();
 		for (Lib3MF_uint32 iBall = 0; iBall < meshBallCount; iBall++) {
-			NMR::MESHBALL * meshBall = m_mesh.getBall(iBall);
+			const NMR::MESHBALL * meshBall = m_mesh.readBall(iBall);
 
 			if (meshBall->m_nodeindex == ballNodeIndex) {
 				ball.m_Index = meshBall->m_nodeindex;
@@ -433,7 +433,7 @@ void CBeamLattice::GetBalls(Lib3MF_uint64 nBallInfoBufferSize, Lib3MF_uint64 * p
 		if (ballMode == eBeamLatticeBallMode::Mixed) {
 			sLib3MFBall * ball = pBallInfoBuffer;
 			for (Lib3MF_uint32 iBall = 0; iBall < ballCount; iBall++) {
-				const NMR::MESHBALL * meshBall = m_mesh.getBall(iBall);
+				const NMR::MESHBALL * meshBall = m_mesh.readBall(iBall);
 
 				ball->m_Index = meshBall->m_nodeindex;
 
@@ -447,7 +447,7 @@ void CBeamLattice::GetBalls(Lib3MF_uint64 nBallInfoBufferSize, Lib3MF_uint64 * p
 			// Sort balls that are in the mesh into a map by node index
 			std::map<Lib3MF_uint32, Lib3MF_double> meshBallMap;
 			for (Lib3MF_uint32 iBall = 0; iBall < meshBallCount; iBall++) {
-				const NMR::MESHBALL * meshBall = m_mesh.getBall(iBall);
+				const NMR::MESHBALL * meshBall = m_mesh.readBall(iBall);
 
 				meshBallMap[meshBall->m_nodeindex] = meshBall->m_radius;
 			}
@@ -33,6 +33,7 @@ Abstract: This is a stub class definition of CFunctionFromImage3D
 
 // Include custom headers here.
 #include "lib3mf_image3d.hpp"
+#include "lib3mf_image3dsampler.hpp"
 
 using namespace Lib3MF::Impl;
 
@@ -126,3 +127,9 @@ void CFunctionFromImage3D::SetScale(const Lib3MF_double dScale)
 {
     functionfromimage3d()->setScale(dScale);
 }
+
+IImage3DSampler* CFunctionFromImage3D::CreateSampler()
+{
+    return new CImage3DSampler(
+        std::make_shared<NMR::CModelImage3DSampler>(*functionfromimage3d()));
+}
@@ -0,0 +1,112 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium (Original Author)
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract: This is a stub class definition of CImage3DSampler
+
+*/
+
+#include "lib3mf_image3dsampler.hpp"
+
+#include "lib3mf_interfaceexception.hpp"
+
+using namespace Lib3MF::Impl;
+
+/*************************************************************************************************************************
+ Class definition of CImage3DSampler
+**************************************************************************************************************************/
+
+CImage3DSampler::CImage3DSampler(NMR::PModelImage3DSampler pSampler)
+    : m_pSampler(pSampler)
+{
+    if (!m_pSampler)
+    {
+        throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
+    }
+}
+
+void CImage3DSampler::SetCacheSize(const Lib3MF_uint64 nCacheSize)
+{
+    m_pSampler->setCacheSize(nCacheSize);
+}
+
+Lib3MF_uint64 CImage3DSampler::GetCacheSize()
+{
+    return m_pSampler->getCacheSize();
+}
+
+void CImage3DSampler::SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount)
+{
+    if (nThreadCount != m_nWorkerThreadCount)
+    {
+        m_pThreadPool.reset();
+    }
+    m_nWorkerThreadCount = nThreadCount;
+}
+
+Lib3MF_uint32 CImage3DSampler::GetWorkerThreadCount()
+{
+    return m_nWorkerThreadCount;
+}
+
+void CImage3DSampler::Sample(const Lib3MF_uint64 nUVWBufferSize,
+                             const Lib3MF_double* pUVWBuffer,
+                             Lib3MF_uint64 nRGBABufferSize,
+                             Lib3MF_uint64* pRGBANeededCount,
+                             Lib3MF_double* pRGBABuffer)
+{
+    if (nUVWBufferSize % 3 != 0)
+    {
+        throw ELib3MFInterfaceException(
+            LIB3MF_ERROR_INVALIDPARAM,
+            "The coordinate buffer size must be a multiple of 3.");
+    }
+    Lib3MF_uint64 const nPointCount = nUVWBufferSize / 3;
+    Lib3MF_uint64 const nValueCount = nPointCount * NMR_IMAGE3D_CHANNELCOUNT;
+    if (pRGBANeededCount)
+    {
+        *pRGBANeededCount = nValueCount;
+    }
+    if (!pRGBABuffer)
+    {
+        return;
+    }
+    if (nRGBABufferSize < nValueCount)
+    {
+        throw ELib3MFInterfaceException(LIB3MF_ERROR_BUFFERTOOSMALL);
+    }
+
+    Lib3MF_uint32 nThreadCount = m_nWorkerThreadCount;
+    if (nThreadCount == 0)
+    {
+        nThreadCount = NMR::CThreadPool::getHardwareThreadCount();
+    }
+    if ((nThreadCount > 1) && !m_pThreadPool)
+    {
+        m_pThreadPool = std::make_shared<NMR::CThreadPool>(nThreadCount);
+    }
+    m_pSampler->sample(pUVWBuffer, pRGBABuffer, nPointCount,
+                       (nThreadCount > 1) ? m_pThreadPool.get() : nullptr);
+}
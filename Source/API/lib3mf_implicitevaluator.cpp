@@ -0,0 +1,193 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium (Original Author)
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+Abstract: This is a stub class definition of CImplicitEvaluator
+
+*/
+
+#include "lib3mf_implicitevaluator.hpp"
+
+#include "lib3mf_interfaceexception.hpp"
+
+#include "Model/Classes/NMR_ModelImplicitInterval.h"
+
+#include <vector>
+
+using namespace Lib3MF::Impl;
+
+/*************************************************************************************************************************
+ Class definition of CImplicitEvaluator
+**************************************************************************************************************************/
+
+CImplicitEvaluator::CImplicitEvaluator(NMR::PModelImplicitEvaluator pEvaluator)
+    : m_pEvaluator(pEvaluator)
+{
+    if (!m_pEvaluator)
+    {
+        throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
+    }
+}
+
+Lib3MF_uint64 CImplicitEvaluator::getPointCount(Lib3MF_uint64 nInputsBufferSize)
+{
+    // A function without inputs is evaluated once
+    Lib3MF_uint64 const nInputStride = m_pEvaluator->getInputStride();
+    if (nInputStride == 0)
+    {
+        return 1;
+    }
+    if (nInputsBufferSize % nInputStride != 0)
+    {
+        throw ELib3MFInterfaceException(
+            LIB3MF_ERROR_INVALIDPARAM,
+            "The input buffer size must be a multiple of the input stride.");
+    }
+    return nInputsBufferSize / nInputStride;
+}
+
+bool CImplicitEvaluator::prepareOutputs(Lib3MF_uint64 nPointCount,
+                                        Lib3MF_uint64 nOutputsBufferSize,
+                                        Lib3MF_uint64* pOutputsNeededCount,
+                                        Lib3MF_double* pOutputsBuffer)
+{
+    Lib3MF_uint64 const nOutputCount = nPointCount * m_pEvaluator->getOutputStride();
+    if (pOutputsNeededCount)
+    {
+        *pOutputsNeededCount = nOutputCount;
+    }
+    if (!pOutputsBuffer)
+    {
+        return false;
+    }
+    if (nOutputsBufferSize < nOutputCount)
+    {
+        throw ELib3MFInterfaceException(LIB3MF_ERROR_BUFFERTOOSMALL);
+    }
+    return true;
+}
+
+Lib3MF_uint32 CImplicitEvaluator::GetInputStride()
+{
+    return static_cast<Lib3MF_uint32>(m_pEvaluator->getInputStride());
+}
+
+Lib3MF_uint32 CImplicitEvaluator::GetOutputStride()
+{
+    return static_cast<Lib3MF_uint32>(m_pEvaluator->getOutputStride());
+}
+
+void CImplicitEvaluator::SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount)
+{
+    m_pEvaluator->setWorkerThreadCount(nThreadCount);
+}
+
+Lib3MF_uint32 CImplicitEvaluator::GetWorkerThreadCount()
+{
+    return m_pEvaluator->getWorkerThreadCount();
+}
+
+void CImplicitEvaluator::Evaluate(const Lib3MF_uint64 nInputsBufferSize,
+                                  const Lib3MF_double* pInputsBuffer,
+                                  Lib3MF_uint64 nOutputsBufferSize,
+                                  Lib3MF_uint64* pOutputsNeededCount,
+                                  Lib3MF_double* pOutputsBuffer)
+{
+    Lib3MF_uint64 const nPointCount = getPointCount(nInputsBufferSize);
+    if (prepareOutputs(nPointCount, nOutputsBufferSize, pOutputsNeededCount, pOutputsBuffer))
+    {
+        m_pEvaluator->evaluate(pInputsBuffer, pOutputsBuffer, nPointCount);
+    }
+}
+
+void CImplicitEvaluator::EvaluateBatch(const Lib3MF_uint64 nInputsBufferSize,
+                                       const Lib3MF_double* pInputsBuffer,
+                                       Lib3MF_uint64 nOutputsBufferSize,
+                                       Lib3MF_uint64* pOutputsNeededCount,
+                                       Lib3MF_double* pOutputsBuffer)
+{
+    Lib3MF_uint64 const nPointCount = getPointCount(nInputsBufferSize);
+    if (prepareOutputs(nPointCount, nOutputsBufferSize, pOutputsNeededCount, pOutputsBuffer))
+    {
+        m_pEvaluator->evaluateBatch(pInputsBuffer, pOutputsBuffer, nPointCount);
+    }
+}
+
+void CImplicitEvaluator::EvaluateBounds(const Lib3MF_uint64 nInputMinimaBufferSize,
+                                        const Lib3MF_double* pInputMinimaBuffer,
+                                        const Lib3MF_uint64 nInputMaximaBufferSize,
+                                        const Lib3MF_double* pInputMaximaBuffer,
+                                        Lib3MF_uint64 nOutputMinimaBufferSize,
+                                        Lib3MF_uint64* pOutputMinimaNeededCount,
+                                        Lib3MF_double* pOutputMinimaBuffer,
+                                        Lib3MF_uint64 nOutputMaximaBufferSize,
+                                        Lib3MF_uint64* pOutputMaximaNeededCount,
+                                        Lib3MF_double* pOutputMaximaBuffer)
+{
+    if (nInputMinimaBufferSize != nInputMaximaBufferSize)
+    {
+        throw ELib3MFInterfaceException(
+            LIB3MF_ERROR_INVALIDPARAM,
+            "The input minima and maxima must have the same size.");
+    }
+    Lib3MF_uint64 const nBoxCount = getPointCount(nInputMinimaBufferSize);
+    bool const bHasMinima = prepareOutputs(nBoxCount, nOutputMinimaBufferSize,
+                                           pOutputMinimaNeededCount, pOutputMinimaBuffer);
+    bool const bHasMaxima = prepareOutputs(nBoxCount, nOutputMaximaBufferSize,
+                                           pOutputMaximaNeededCount, pOutputMaximaBuffer);
+    if (!bHasMinima || !bHasMaxima)
+    {
+        return;
+    }
+
+    size_t const nInputStride = m_pEvaluator->getInputStride();
+    size_t const nOutputStride = m_pEvaluator->getOutputStride();
+    std::vector<NMR::implicit::Interval> inputs(nInputStride);
+    std::vector<NMR::implicit::Interval> outputs(nOutputStride);
+    for (Lib3MF_uint64 nBox = 0; nBox < nBoxCount; ++nBox)
+    {
+        for (size_t i = 0; i < nInputStride; ++i)
+        {
+            Lib3MF_double const dMinimum = pInputMinimaBuffer[nBox * nInputStride + i];
+            Lib3MF_double const dMaximum = pInputMaximaBuffer[nBox * nInputStride + i];
+            if (!(dMinimum <= dMaximum))
+            {
+                throw ELib3MFInterfaceException(
+                    LIB3MF_ERROR_INVALIDPARAM,
+                    "The input minima must not exceed the input maxima.");
+            }
+            inputs[i] = NMR::implicit::makeInterval(dMinimum, dMaximum);
+        }
+
+        m_pEvaluator->evaluateInterval(inputs.data(), outputs.data());
+
+        for (size_t i = 0; i < nOutputStride; ++i)
+        {
+            pOutputMinimaBuffer[nBox * nOutputStride + i] = outputs[i].m_min;
+            pOutputMaximaBuffer[nBox * nOutputStride + i] = outputs[i].m_max;
+        }
+    }
+}
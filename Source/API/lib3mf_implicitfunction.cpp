@@ -53,6 +53,7 @@ Abstract: This is a stub class definition of CImplicitFunction
 #include "lib3mf_fmodnode.hpp"
 #include "lib3mf_fractnode.hpp"
 #include "lib3mf_functioncallnode.hpp"
+#include "lib3mf_implicitevaluator.hpp"
 #include "lib3mf_implicitnode.hpp"
 #include "lib3mf_implicitport.hpp"
 #include "lib3mf_interfaceexception.hpp"
@@ -717,3 +718,9 @@ void CImplicitFunction::SortNodesTopologically()
     function()->sortNodesTopologically();
 }
 
+IImplicitEvaluator* CImplicitFunction::CreateEvaluator()
+{
+    return new CImplicitEvaluator(
+        std::make_shared<NMR::CModelImplicitEvaluator>(*function()));
+}
+
@@ -39,6 +39,7 @@ Abstract: This is a stub class definition of CMeshObject
 #include "Model/Classes/NMR_ModelVolumeData.h"
 #include "Model/Classes/NMR_ModelResource.h"
 #include <cmath>
+#include <algorithm>
 
 using namespace Lib3MF::Impl;
 
@@ -116,7 +117,7 @@ void CMeshObject::SetVertex (const Lib3MF_uint32 nIndex, const sLib3MFPosition C
 
 sLib3MFPosition CMeshObject::GetVertex(const Lib3MF_uint32 nIndex)
 {
-	NMR::MESHNODE* node = mesh()->getNode(nIndex);
+	const NMR::MESHNODE* node = mesh()->readNode(nIndex);
 	sLib3MFPosition pos;
 	pos.m_Coordinates[0] = node->m_position.m_fields[0];
 	pos.m_Coordinates[1] = node->m_position.m_fields[1];
@@ -137,20 +138,42 @@ void CMeshObject::GetVertices(Lib3MF_uint64 nVerticesBufferSize, Lib3MF_uint64*
 
 	if (nVerticesBufferSize >= nodeCount && pVerticesBuffer)
 	{
-		for (Lib3MF_uint32 i = 0; i < nodeCount; i++)
+		// Copy block by block to avoid the bounds check and index lookup per node
+		NMR::CMesh * pMesh = mesh();
+		sLib3MFPosition * pTarget = pVerticesBuffer;
+		Lib3MF_uint32 nBlockCount = pMesh->getNodeBlockCount();
+		for (Lib3MF_uint32 nBlock = 0; nBlock < nBlockCount; nBlock++)
 		{
-			const NMR::MESHNODE* node = mesh()->getNode(i);
-			pVerticesBuffer[i].m_Coordinates[0] = node->m_position.m_fields[0];
-			pVerticesBuffer[i].m_Coordinates[1] = node->m_position.m_fields[1];
-			pVerticesBuffer[i].m_Coordinates[2] = node->m_position.m_fields[2];
+			Lib3MF_uint32 nBlockNodeCount = 0;
+			const NMR::MESHNODE* pNodes = pMesh->getNodeBlock(nBlock, nBlockNodeCount);
+			for (Lib3MF_uint32 i = 0; i < nBlockNodeCount; i++)
+			{
+				pTarget[i].m_Coordinates[0] = pNodes[i].m_position.m_fields[0];
+				pTarget[i].m_Coordinates[1] = pNodes[i].m_position.m_fields[1];
+				pTarget[i].m_Coordinates[2] = pNodes[i].m_position.m_fields[2];
+			}
+			pTarget += nBlockNodeCount;
 		}
 	}
 }
 
+Lib3MF_uint32 CMeshObject::GetVertexPageCount()
+{
+	return mesh()->getNodeBlockCount();
+}
+
+Lib3MF_pvoid CMeshObject::GetVertexPage(const Lib3MF_uint32 nPageIndex, Lib3MF_uint32 & nVertexCount, Lib3MF_uint32 & nStride)
+{
+	// The page is read-only, the pointer type of the ABI cannot express this
+	const NMR::MESHNODE* pNodes = mesh()->getNodeBlock(nPageIndex, nVertexCount);
+	nStride = (Lib3MF_uint32)sizeof(NMR::MESHNODE);
+	return const_cast<NMR::nfFloat *>(&pNodes->m_position.m_fields[0]);
+}
+
 sLib3MFTriangle CMeshObject::GetTriangle (const Lib3MF_uint32 nIndex)
 {
 	sLib3MFTriangle t;
-	NMR::MESHFACE* mf = mesh()->getFace(nIndex);
+	const NMR::MESHFACE* mf = mesh()->readFace(nIndex);
 
 	t.m_Indices[0] = mf->m_nodeindices[0];
 	t.m_Indices[1] = mf->m_nodeindices[1];
@@ -181,16 +204,37 @@ void CMeshObject::GetTriangleIndices (Lib3MF_uint64 nIndicesBufferSize, Lib3MF_u
 
 	if (nIndicesBufferSize >= faceCount && pIndicesBuffer)
 	{
-		for (Lib3MF_uint32 i = 0; i < faceCount; i++)
+		NMR::CMesh * pMesh = mesh();
+		sLib3MFTriangle * pTarget = pIndicesBuffer;
+		Lib3MF_uint32 nBlockCount = pMesh->getFaceBlockCount();
+		for (Lib3MF_uint32 nBlock = 0; nBlock < nBlockCount; nBlock++)
 		{
-			const NMR::MESHFACE* face = mesh()->getFace(i);
-			pIndicesBuffer[i].m_Indices[0] = face->m_nodeindices[0];
-			pIndicesBuffer[i].m_Indices[1] = face->m_nodeindices[1];
-			pIndicesBuffer[i].m_Indices[2] = face->m_nodeindices[2];
+			Lib3MF_uint32 nBlockFaceCount = 0;
+			const NMR::MESHFACE* pFaces = pMesh->getFaceBlock(nBlock, nBlockFaceCount);
+			for (Lib3MF_uint32 i = 0; i < nBlockFaceCount; i++)
+			{
+				pTarget[i].m_Indices[0] = pFaces[i].m_nodeindices[0];
+				pTarget[i].m_Indices[1] = pFaces[i].m_nodeindices[1];
+				pTarget[i].m_Indices[2] = pFaces[i].m_nodeindices[2];
+			}
+			pTarget += nBlockFaceCount;
 		}
 	}
 }
 
+Lib3MF_uint32 CMeshObject::GetTrianglePageCount()
+{
+	return mesh()->getFaceBlockCount();
+}
+
+Lib3MF_pvoid CMeshObject::GetTrianglePage(const Lib3MF_uint32 nPageIndex, Lib3MF_uint32 & nTriangleCount, Lib3MF_uint32 & nStride)
+{
+	// The page is read-only, the pointer type of the ABI cannot express this
+	const NMR::MESHFACE* pFaces = mesh()->getFaceBlock(nPageIndex, nTriangleCount);
+	nStride = (Lib3MF_uint32)sizeof(NMR::MESHFACE);
+	return const_cast<NMR::nfInt32 *>(&pFaces->m_nodeindices[0]);
+}
+
 void CMeshObject::SetObjectLevelProperty(const Lib3MF_uint32 nUniqueResourceID, const Lib3MF_uint32 nPropertyID)
 {
 	NMR::CMeshInformation_Properties * pInformation = getMeshInformationProperties();
@@ -333,6 +377,7 @@ void CMeshObject::SetGeometry(const Lib3MF_uint64 nVerticesBufferSize, const sLi
 
 	// Clear old mesh
 	pMesh->clear();
+	pMesh->reserve((NMR::nfUint32)std::min(nVerticesBufferSize, (Lib3MF_uint64)NMR_MESH_MAXNODECOUNT), (NMR::nfUint32)std::min(nIndicesBufferSize, (Lib3MF_uint64)NMR_MESH_MAXFACECOUNT), 0);
 
 	// Rebuild Mesh Coordinates
 	const sLib3MFPosition * pVertex = pVerticesBuffer;
@@ -349,12 +394,10 @@ void CMeshObject::SetGeometry(const Lib3MF_uint64 nVerticesBufferSize, const sLi
 	// Rebuild Mesh Faces
 	const sLib3MFTriangle * pTriangle = pIndicesBuffer;
 	for (Lib3MF_uint64 nIndex = 0; nIndex < nIndicesBufferSize; nIndex++) {
-		NMR::MESHNODE * pNodes[3];
-
+		// Node indices equal the buffer positions, so no node lookup is necessary
 		for (int j = 0; j < 3; j++) {
 			if (pTriangle->m_Indices[j] >= nVerticesBufferSize)
 				throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
-			pNodes[j] = pMesh->getNode(pTriangle->m_Indices[j]);
 		}
 
 		if ((pTriangle->m_Indices[0] == pTriangle->m_Indices[1]) ||
@@ -362,17 +405,27 @@ void CMeshObject::SetGeometry(const Lib3MF_uint64 nVerticesBufferSize, const sLi
 			(pTriangle->m_Indices[1] == pTriangle->m_Indices[2]))
 			throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
 
-		pMesh->addFace(pNodes[0], pNodes[1], pNodes[2]);
+		pMesh->addFace((NMR::nfInt32)pTriangle->m_Indices[0], (NMR::nfInt32)pTriangle->m_Indices[1], (NMR::nfInt32)pTriangle->m_Indices[2]);
 
 		pTriangle++;
 	}
 }
 
+void CMeshObject::ReserveGeometry(const Lib3MF_uint32 nVertexCount, const Lib3MF_uint32 nTriangleCount, const Lib3MF_uint32 nBeamCount)
+{
+	mesh()->reserve(nVertexCount, nTriangleCount, nBeamCount);
+}
+
 bool CMeshObject::IsManifoldAndOriented ()
 {
 	return meshObject()->isManifoldAndOriented();
 }
 
+bool CMeshObject::IsGeometryLoaded()
+{
+	return meshObject()->isMeshLoaded();
+}
+
 bool CMeshObject::IsMeshObject()
 {
 	return true;
@@ -823,7 +823,7 @@ Lib3MF::sBox CModel::GetOutbox()
 
 IImageStack * CModel::AddImageStack(const Lib3MF_uint32 nSizeX, const Lib3MF_uint32 nSizeY, const Lib3MF_uint32 nSheetCount)
 {
-	NMR::PModelImageStack pResource = NMR::CModelImageStack::make(model().generateResourceID(), &model(), nSizeX, nSizeY, nSheetCount);
+	NMR::PModelImageStack pResource = NMR::CModelImageStack::make(model().generateResourceID(), &model(), nSizeY, nSizeX, nSheetCount);
 	model().addResource(pResource);
 
 	return new CImageStack(pResource);
@@ -40,6 +40,7 @@ Abstract: This is a stub class definition of CReader
 #include "Common/NMR_SecureContentTypes.h"
 #include "Common/NMR_SecureContext.h"
 #include "Model/Classes/NMR_KeyStore.h"
+#include "Model/Reader/NMR_ModelReader_MeshStream.h"
 
 
 using namespace Lib3MF::Impl;
@@ -72,7 +73,7 @@ NMR::CModelReader& CReader::reader()
 
 void CReader::ReadFromFile (const std::string & sFilename)
 {
-	NMR::PImportStream pImportStream = NMR::fnCreateImportStreamInstance(sFilename.c_str());
+	NMR::PImportStream pImportStream = NMR::fnCreateMappedImportStreamInstance(sFilename.c_str());
 
 	try {
 		reader().readStream(pImportStream);
@@ -166,6 +167,55 @@ bool CReader::GetStrictModeActive ()
 	return reader().warnings()->getCriticalWarningLevel() == NMR::mrwInvalidOptionalValue;
 }
 
+void CReader::SetWorkerThreadCount (const Lib3MF_uint32 nThreadCount)
+{
+	reader().setWorkerThreadCount(nThreadCount);
+}
+
+Lib3MF_uint32 CReader::GetWorkerThreadCount ()
+{
+	return reader().getWorkerThreadCount();
+}
+
+void CReader::SetMeshStreamCallbacks (const Lib3MF::VertexBlockCallback pTheVertexBlockCallback, const Lib3MF::TriangleBlockCallback pTheTriangleBlockCallback, const bool bRetainGeometry, const Lib3MF_pvoid pUserData)
+{
+	if (!pTheVertexBlockCallback && !pTheTriangleBlockCallback) {
+		reader().setMeshStream(nullptr);
+		return;
+	}
+
+	static_assert(sizeof(NMR::NVEC3) == sizeof(Lib3MF::sPosition), "Streamed vertices must match the layout of sPosition");
+	static_assert(sizeof(NMR::MODELREADERSTREAMTRIANGLE) == sizeof(Lib3MF::sTriangle), "Streamed triangles must match the layout of sTriangle");
+
+	NMR::ModelReaderVertexBlockCallback lambdaVertexBlock;
+	if (pTheVertexBlockCallback) {
+		lambdaVertexBlock = [pTheVertexBlockCallback, pUserData](NMR::UniqueResourceID nUniqueResourceID, NMR::nfUint32 nStartIndex, NMR::nfUint32 nCount, const NMR::NVEC3 * pVertices)
+		{
+			(*pTheVertexBlockCallback)(nUniqueResourceID, nStartIndex, nCount, reinterpret_cast<const Lib3MF::sPosition *>(pVertices), pUserData);
+		};
+	}
+
+	NMR::ModelReaderTriangleBlockCallback lambdaTriangleBlock;
+	if (pTheTriangleBlockCallback) {
+		lambdaTriangleBlock = [pTheTriangleBlockCallback, pUserData](NMR::UniqueResourceID nUniqueResourceID, NMR::nfUint32 nStartIndex, NMR::nfUint32 nCount, const NMR::MODELREADERSTREAMTRIANGLE * pTriangles)
+		{
+			(*pTheTriangleBlockCallback)(nUniqueResourceID, nStartIndex, nCount, reinterpret_cast<const Lib3MF::sTriangle *>(pTriangles), pUserData);
+		};
+	}
+
+	reader().setMeshStream(std::make_shared<NMR::CModelReader_MeshStream>(lambdaVertexBlock, lambdaTriangleBlock, bRetainGeometry));
+}
+
+void CReader::SetLazyMeshLoadingActive (const bool bLazyMeshLoadingActive)
+{
+	reader().setLazyMeshLoading(bLazyMeshLoadingActive);
+}
+
+bool CReader::GetLazyMeshLoadingActive ()
+{
+	return reader().getLazyMeshLoading();
+}
+
 std::string CReader::GetWarning (const Lib3MF_uint32 nIndex, Lib3MF_uint32 & nErrorCode)
 {
 	auto warning = reader().warnings()->getWarning(nIndex);
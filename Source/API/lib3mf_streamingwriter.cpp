@@ -0,0 +1,90 @@
+/*++
+
+Copyright (C) 2019 3MF Consortium (Original Author)
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract: This is a stub class definition of CStreamingWriter
+
+*/
+
+#include "lib3mf_streamingwriter.hpp"
+#include "lib3mf_interfaceexception.hpp"
+#include "lib3mf_utils.hpp"
+
+// Include custom headers here.
+#include "Common/Platform/NMR_Platform.h"
+#include "Common/NMR_Exception.h"
+
+#include <limits>
+
+using namespace Lib3MF::Impl;
+
+/*************************************************************************************************************************
+ Class definition of CStreamingWriter 
+**************************************************************************************************************************/
+
+// The streamed batches are handed to the mesh writer without a copy
+static_assert(sizeof(NMR::NVEC3) == sizeof(Lib3MF::sPosition), "streamed vertex layout mismatch");
+static_assert(sizeof(Lib3MF::sTriangle) == 3 * sizeof(NMR::nfUint32), "streamed triangle layout mismatch");
+
+CStreamingWriter::CStreamingWriter(const std::string & sFilename, const eLib3MFModelUnit eUnit)
+{
+	setlocale(LC_ALL, "C");
+	NMR::PExportStream pStream = NMR::fnCreateExportStreamInstance(sFilename.c_str());
+	m_pStreamWriter = std::make_shared<NMR::CModelStreamWriter>(pStream, NMR::eModelUnit(eUnit));
+}
+
+Lib3MF_uint32 CStreamingWriter::BeginMeshObject(const std::string & sName)
+{
+	return m_pStreamWriter->beginMeshObject(sName);
+}
+
+void CStreamingWriter::AddVertices(const Lib3MF_uint64 nVerticesBufferSize, const Lib3MF::sPosition * pVerticesBuffer)
+{
+	if (nVerticesBufferSize > std::numeric_limits<NMR::nfUint32>::max())
+		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
+	m_pStreamWriter->addVertices((const NMR::NVEC3 *)pVerticesBuffer, (NMR::nfUint32)nVerticesBufferSize);
+}
+
+void CStreamingWriter::AddTriangles(const Lib3MF_uint64 nIndicesBufferSize, const Lib3MF::sTriangle * pIndicesBuffer)
+{
+	if (nIndicesBufferSize > std::numeric_limits<NMR::nfUint32>::max())
+		throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
+	m_pStreamWriter->addTriangles((const NMR::nfUint32 *)pIndicesBuffer, (NMR::nfUint32)nIndicesBufferSize);
+}
+
+void CStreamingWriter::EndMeshObject()
+{
+	m_pStreamWriter->endMeshObject();
+}
+
+void CStreamingWriter::AddBuildItem(const Lib3MF_uint32 nObjectID, const Lib3MF::sTransform Transform)
+{
+	m_pStreamWriter->addBuildItem(nObjectID, TransformToMatrix(Transform));
+}
+
+void CStreamingWriter::Finish()
+{
+	m_pStreamWriter->finish();
+}
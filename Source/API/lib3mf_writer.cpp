@@ -192,6 +192,36 @@ void CWriter::SetDecimalPrecision(const Lib3MF_uint32 nDecimalPrecision)
 	m_pWriter->SetDecimalPrecision(nDecimalPrecision);
 }
 
+void CWriter::SetShortestRoundtripActive(const bool bShortestRoundtripActive)
+{
+	m_pWriter->SetShortestRoundtripActive(bShortestRoundtripActive);
+}
+
+bool CWriter::GetShortestRoundtripActive()
+{
+	return m_pWriter->GetShortestRoundtripActive();
+}
+
+void CWriter::SetWorkerThreadCount(const Lib3MF_uint32 nThreadCount)
+{
+	m_pWriter->SetWorkerThreadCount(nThreadCount);
+}
+
+Lib3MF_uint32 CWriter::GetWorkerThreadCount()
+{
+	return m_pWriter->GetWorkerThreadCount();
+}
+
+void CWriter::SetCompressionLevel(const Lib3MF::ePackagePartType ePartType, const Lib3MF::eCompressionLevel eLevel)
+{
+	m_pWriter->SetCompressionLevel(NMR::eModelPackagePartType(ePartType), NMR::eModelCompressionLevel(eLevel));
+}
+
+Lib3MF::eCompressionLevel CWriter::GetCompressionLevel(const Lib3MF::ePackagePartType ePartType)
+{
+	return Lib3MF::eCompressionLevel(m_pWriter->GetCompressionLevel(NMR::eModelPackagePartType(ePartType)));
+}
+
 void Lib3MF::Impl::CWriter::AddKeyWrappingCallback(const std::string & sConsumerID, const Lib3MF::KeyWrappingCallback pTheCallback, const Lib3MF_pvoid pUserData){
 	NMR::KeyWrappingDescriptor descriptor;
 	descriptor.m_sKekDecryptData.m_pUserData = pUserData;
@@ -0,0 +1,249 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_VectorHashGrid.cpp implements an open addressing hash grid to identify vectors by
+their position. Collisions are resolved by linear probing, removals by backward shifting.
+
+--*/
+
+#include "Common/Math/NMR_VectorHashGrid.h" 
+#include "Common/Math/NMR_Vector.h" 
+#include "Common/NMR_Exception.h" 
+
+namespace NMR {
+
+	CVectorHashGrid::CVectorHashGrid()
+		: m_nCount(0), m_nMask(0)
+	{
+		setUnits(NMR_VECTOR_DEFAULTUNITS);
+	}
+
+	CVectorHashGrid::CVectorHashGrid(_In_ nfFloat fUnits)
+		: m_nCount(0), m_nMask(0)
+	{
+		setUnits(fUnits);
+	}
+
+	nfFloat CVectorHashGrid::getUnits()
+	{
+		return m_fUnits;
+	}
+
+	void CVectorHashGrid::setUnits(_In_ nfFloat fUnits)
+	{
+		if ((fUnits < NMR_VECTOR_MINUNITS) || (fUnits > NMR_VECTOR_MAXUNITS))
+			throw CNMRException(NMR_ERROR_INVALIDUNITS);
+		if (m_nCount > 0)
+			throw CNMRException(NMR_ERROR_COULDNOTSETUNITS);
+
+		m_fUnits = fUnits;
+	}
+
+	void CVectorHashGrid::reserve(_In_ nfUint32 nCount)
+	{
+		// Keep the load factor at or below one half
+		nfUint64 nCapacity = NMR_VECTORHASHGRID_MINCAPACITY;
+		while (nCapacity < (nfUint64)nCount * 2)
+			nCapacity *= 2;
+		if (nCapacity > 0x80000000ULL)
+			throw CNMRException(NMR_ERROR_INVALIDBUFFERSIZE);
+
+		if (nCapacity > m_entries.size())
+			rehash((nfUint32)nCapacity);
+	}
+
+	nfUint32 CVectorHashGrid::getCount()
+	{
+		return m_nCount;
+	}
+
+	nfUint32 CVectorHashGrid::hashPosition(_In_ const NVEC3I & vPosition) const
+	{
+		nfUint64 nHash = (nfUint64)(nfUint32)vPosition.m_fields[0] * 0x9E3779B97F4A7C15ULL;
+		nHash ^= (nfUint64)(nfUint32)vPosition.m_fields[1] * 0xC2B2AE3D27D4EB4FULL;
+		nHash ^= (nfUint64)(nfUint32)vPosition.m_fields[2] * 0x165667B19E3779F9ULL;
+		return (nfUint32)(nHash ^ (nHash >> 32));
+	}
+
+	_Success_(return) nfBool CVectorHashGrid::findSlot(_In_ const NVEC3I & vPosition, _Out_ nfUint32 & nSlot) const
+	{
+		nSlot = 0;
+		if (m_entries.empty())
+			return false;
+
+		nfUint32 nIndex = hashPosition(vPosition) & m_nMask;
+		while (m_entries[nIndex].m_bOccupied) {
+			const NVEC3I & vEntry = m_entries[nIndex].m_position;
+			if ((vEntry.m_fields[0] == vPosition.m_fields[0]) && (vEntry.m_fields[1] == vPosition.m_fields[1]) && (vEntry.m_fields[2] == vPosition.m_fields[2])) {
+				nSlot = nIndex;
+				return true;
+			}
+			nIndex = (nIndex + 1) & m_nMask;
+		}
+
+		// Free slot, where the position would be inserted
+		nSlot = nIndex;
+		return false;
+	}
+
+	void CVectorHashGrid::rehash(_In_ nfUint32 nCapacity)
+	{
+		std::vector<VECTORHASHGRIDENTRY> oldEntries;
+		oldEntries.swap(m_entries);
+		m_entries.resize(nCapacity);
+		m_nMask = nCapacity - 1;
+
+		for (auto & entry : oldEntries) {
+			if (entry.m_bOccupied) {
+				nfUint32 nSlot;
+				findSlot(entry.m_position, nSlot);
+				m_entries[nSlot] = entry;
+			}
+		}
+	}
+
+	_Success_(return) nfBool CVectorHashGrid::findVector2(_In_ NVEC2 vVector, _Out_opt_ nfUint32 & value)
+	{
+		NVEC3 vVector3;
+		vVector3.m_fields[0] = vVector.m_fields[0];
+		vVector3.m_fields[1] = vVector.m_fields[1];
+		vVector3.m_fields[2] = 0.0f;
+		return findVector3(vVector3, value);
+	}
+
+	_Success_(return) nfBool CVectorHashGrid::findVector3(_In_ NVEC3 vVector, _Out_opt_ nfUint32 & value)
+	{
+		return findIntVector3(fnVEC3I_floor(vVector, m_fUnits), value);
+	}
+
+	_Success_(return) nfBool CVectorHashGrid::findIntVector2(_In_ NVEC2I vVector, _Out_opt_ nfUint32 & value)
+	{
+		NVEC3I vVector3;
+		vVector3.m_fields[0] = vVector.m_fields[0];
+		vVector3.m_fields[1] = vVector.m_fields[1];
+		vVector3.m_fields[2] = 0;
+		return findIntVector3(vVector3, value);
+	}
+
+	_Success_(return) nfBool CVectorHashGrid::findIntVector3(_In_ NVEC3I vVector, _Out_opt_ nfUint32 & value)
+	{
+		nfUint32 nSlot;
+		if (findSlot(vVector, nSlot)) {
+			value = m_entries[nSlot].m_value;
+			return true;
+		}
+		else
+			return false;
+	}
+
+	void CVectorHashGrid::addVector2(_In_ NVEC2 vVector, _In_ nfUint32 value)
+	{
+		NVEC3 vVector3;
+		vVector3.m_fields[0] = vVector.m_fields[0];
+		vVector3.m_fields[1] = vVector.m_fields[1];
+		vVector3.m_fields[2] = 0.0f;
+		addVector3(vVector3, value);
+	}
+
+	void CVectorHashGrid::addVector3(_In_ NVEC3 vVector, _In_ nfUint32 value)
+	{
+		addIntVector3(fnVEC3I_floor(vVector, m_fUnits), value);
+	}
+
+	void CVectorHashGrid::addIntVector2(_In_ NVEC2I vVector, _In_ nfUint32 value)
+	{
+		NVEC3I vVector3;
+		vVector3.m_fields[0] = vVector.m_fields[0];
+		vVector3.m_fields[1] = vVector.m_fields[1];
+		vVector3.m_fields[2] = 0;
+		addIntVector3(vVector3, value);
+	}
+
+	void CVectorHashGrid::addIntVector3(_In_ NVEC3I vVector, _In_ nfUint32 value)
+	{
+		if (((nfUint64)m_nCount + 1) * 2 > m_entries.size())
+			reserve(m_nCount + 1);
+
+		// As with CVectorTree, an existing entry is not overwritten
+		nfUint32 nSlot;
+		if (findSlot(vVector, nSlot))
+			return;
+
+		m_entries[nSlot].m_position = vVector;
+		m_entries[nSlot].m_value = value;
+		m_entries[nSlot].m_bOccupied = 1;
+		m_nCount++;
+	}
+
+	void CVectorHashGrid::removeVector2(_In_ NVEC2 vVector)
+	{
+		NVEC3 vVector3;
+		vVector3.m_fields[0] = vVector.m_fields[0];
+		vVector3.m_fields[1] = vVector.m_fields[1];
+		vVector3.m_fields[2] = 0.0f;
+		removeVector3(vVector3);
+	}
+
+	void CVectorHashGrid::removeVector3(_In_ NVEC3 vVector)
+	{
+		removeIntVector3(fnVEC3I_floor(vVector, m_fUnits));
+	}
+
+	void CVectorHashGrid::removeIntVector2(_In_ NVEC2I vVector)
+	{
+		NVEC3I vVector3;
+		vVector3.m_fields[0] = vVector.m_fields[0];
+		vVector3.m_fields[1] = vVector.m_fields[1];
+		vVector3.m_fields[2] = 0;
+		removeIntVector3(vVector3);
+	}
+
+	void CVectorHashGrid::removeIntVector3(_In_ NVEC3I vVector)
+	{
+		nfUint32 nSlot;
+		if (!findSlot(vVector, nSlot))
+			return;
+
+		// Shift following entries of the probe sequence back, so that no tombstones are needed
+		nfUint32 nFree = nSlot;
+		nfUint32 nIndex = (nSlot + 1) & m_nMask;
+		while (m_entries[nIndex].m_bOccupied) {
+			nfUint32 nHome = hashPosition(m_entries[nIndex].m_position) & m_nMask;
+			// Move the entry, if its home slot is not within (nFree, nIndex] cyclically
+			if (((nIndex - nHome) & m_nMask) >= ((nIndex - nFree) & m_nMask)) {
+				m_entries[nFree] = m_entries[nIndex];
+				nFree = nIndex;
+			}
+			nIndex = (nIndex + 1) & m_nMask;
+		}
+
+		m_entries[nFree].m_bOccupied = 0;
+		m_nCount--;
+	}
+
+}
@@ -42,18 +42,24 @@ structure.
 #include "Common/Mesh/NMR_Mesh.h"
 #include "Common/Math/NMR_Matrix.h" 
 #include "Common/NMR_Exception.h" 
+#include "Common/NMR_ThreadPool.h"
 #include "Common/MeshInformation/NMR_MeshInformation_Properties.h"
 #include <cmath>
+#include <algorithm>
+#include <atomic>
+#include <cstring>
 
 namespace NMR {
 
 	CMesh::CMesh(): m_BeamLattice(this->m_Nodes)
 	{
-		// empty on purpose
+		initializeCache();
 	}
 
 	CMesh::CMesh(_In_opt_ CMesh * pMesh) : m_BeamLattice(this->m_Nodes)
 	{
+		initializeCache();
+
 		if (!pMesh)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
@@ -71,10 +77,10 @@ namespace NMR {
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
 		nfInt32 nIdx, nNodeCount, nFaceCount, nBeamCount, nBallCount, j;
-		MESHNODE * pNode;
-		MESHFACE * pFace;
-		MESHBEAM * pBeam;
-		MESHBALL * pBall;
+		const MESHNODE * pNode;
+		const MESHFACE * pFace;
+		const MESHBEAM * pBeam;
+		const MESHBALL * pBall;
 		MESHNODE * pFaceNodes[3];
 		MESHNODE * pBeamNodes[2];
 		MESHNODE * pBallNode;
@@ -91,12 +97,14 @@ namespace NMR {
 		nBeamCount = pMesh->getBeamCount();
 		nBallCount = pMesh->getBallCount();
 
+		reserve(getNodeCount() + (nfUint32)nNodeCount, getFaceCount() + (nfUint32)nFaceCount, getBeamCount() + (nfUint32)nBeamCount);
+
 		if (nNodeCount > 0) {
 			std::vector<MESHNODE *> aNewNodes;
 			aNewNodes.resize(nNodeCount);
 
 			for (nIdx = 0; nIdx < nNodeCount; nIdx++) {
-				pNode = pMesh->getNode(nIdx);
+				pNode = pMesh->readNode(nIdx);
 				NVEC3 vPosition = fnMATRIX3_apply(mMatrix, pNode->m_position);
 				aNewNodes[nIdx] = addNode(vPosition);
 			}
@@ -107,7 +115,7 @@ namespace NMR {
 				}
 
 				for (nIdx = 0; nIdx < nFaceCount; nIdx++) {
-					pFace = pMesh->getFace(nIdx);
+					pFace = pMesh->readFace(nIdx);
 					for (j = 0; j < 3; j++) {
 						if ((pFace->m_nodeindices[j] < 0) || (pFace->m_nodeindices[j] >= nNodeCount))
 							throw CNMRException(NMR_ERROR_INVALIDNODEINDEX);
@@ -123,7 +131,7 @@ namespace NMR {
 			}
 			if (nBeamCount > 0) {
 				for (nIdx = 0; nIdx < nBeamCount; nIdx++) {
-					pBeam = pMesh->getBeam(nIdx);
+					pBeam = pMesh->readBeam(nIdx);
 					for (j = 0; j < 2; j++) {
 						if ((pBeam->m_nodeindices[j] < 0) || (pBeam->m_nodeindices[j] >= nNodeCount))
 							throw CNMRException(NMR_ERROR_INVALIDNODEINDEX);
@@ -135,7 +143,7 @@ namespace NMR {
 			}
 			if (nBallCount > 0) {
 				for (nIdx = 0; nIdx < nBallCount; nIdx++) {
-					pBall = pMesh->getBall(nIdx);
+					pBall = pMesh->readBall(nIdx);
 					if ((pBall->m_nodeindex < 0) || (pBall->m_nodeindex >= nNodeCount))
 						throw CNMRException(NMR_ERROR_INVALIDNODEINDEX);
 
@@ -184,6 +192,7 @@ namespace NMR {
 		pNode->m_index = nNewIndex;
 		pNode->m_position = vPosition;
 
+		markModified();
 		return pNode;
 	}
 	_Ret_notnull_ MESHNODE * CMesh::addNode(_In_ const nfFloat posX, _In_ const nfFloat posY, _In_ const nfFloat posZ)
@@ -211,6 +220,7 @@ namespace NMR {
 		pNode->m_position.m_values.y = posY;
 		pNode->m_position.m_values.z = posZ;
 
+		markModified();
 		return pNode;
 	}
 
@@ -239,6 +249,7 @@ namespace NMR {
 		if (m_pMeshInformationHandler)
 			m_pMeshInformationHandler->addFace(getFaceCount());
 
+		markModified();
 		return pFace;
 	}
 	
@@ -264,9 +275,18 @@ namespace NMR {
 		if (m_pMeshInformationHandler)
 			m_pMeshInformationHandler->addFace(getFaceCount());
 
+		markModified();
 		return pFace;
 	}
 
+	void CMesh::reserve(_In_ nfUint32 nNodeCount, _In_ nfUint32 nFaceCount, _In_ nfUint32 nBeamCount)
+	{
+		// Counts beyond the mesh limits are clamped, adding these elements fails anyway
+		m_Nodes.reserve(std::min(nNodeCount, (nfUint32)NMR_MESH_MAXNODECOUNT));
+		m_Faces.reserve(std::min(nFaceCount, (nfUint32)NMR_MESH_MAXFACECOUNT));
+		m_BeamLattice.m_Beams.reserve(std::min(nBeamCount, (nfUint32)NMR_MESH_MAXBEAMCOUNT));
+	}
+
 	_Ret_notnull_ MESHBEAM * CMesh::addBeam(_In_ MESHNODE * pNode1, _In_ MESHNODE * pNode2,
 		_In_ nfDouble dRadius1, _In_ nfDouble dRadius2,
 		_In_ nfInt32 eCapMode1, _In_ nfInt32 eCapMode2)
@@ -296,6 +316,7 @@ namespace NMR {
 		pBeam->m_capMode[1] = eCapMode2;
 
 		m_BeamLattice.m_OccupiedNodes.insert({ pNode1->m_index, pNode2->m_index });
+		markModified();
 
 		return pBeam;
 	}
@@ -328,10 +349,31 @@ namespace NMR {
 		pBall->m_nodeindex = pNode->m_index;
 		pBall->m_index = nNewIndex;
 		pBall->m_radius = dRadius;
+		markModified();
 
 		return pBall;
 	}
 
+	void CMesh::initializeCache()
+	{
+		m_nGeneration = 1;
+		m_nManifoldCheckGeneration = 0;
+		m_bManifoldAndOriented = false;
+		m_nOutboxGeneration = 0;
+		m_mOutboxMatrix = fnMATRIX3_identity();
+		fnOutboxInitialize(m_vOutbox);
+	}
+
+	nfUint64 CMesh::getGeneration()
+	{
+		return m_nGeneration;
+	}
+
+	void CMesh::markModified()
+	{
+		m_nGeneration++;
+	}
+
 
 	nfUint32 CMesh::getNodeCount()	{
 		return m_Nodes.getCount ();
@@ -368,16 +410,57 @@ namespace NMR {
 	}
 
 	_Ret_notnull_ MESHNODE * CMesh::getNode(_In_ nfUint32 nIdx)
+	{
+		MESHNODE * pNode = m_Nodes.getData(nIdx);
+		markModified();
+		return pNode;
+	}
+
+	_Ret_notnull_ const MESHNODE * CMesh::readNode(_In_ nfUint32 nIdx)
 	{
 		return m_Nodes.getData(nIdx);
 	}
 
 	_Ret_notnull_ MESHFACE * CMesh::getFace(_In_ nfUint32 nIdx)
+	{
+		MESHFACE * pFace = m_Faces.getData(nIdx);
+		markModified();
+		return pFace;
+	}
+
+	_Ret_notnull_ const MESHFACE * CMesh::readFace(_In_ nfUint32 nIdx)
 	{
 		return m_Faces.getData(nIdx);
 	}
 
+	nfUint32 CMesh::getNodeBlockCount()
+	{
+		return m_Nodes.getBlockCount();
+	}
+
+	nfUint32 CMesh::getFaceBlockCount()
+	{
+		return m_Faces.getBlockCount();
+	}
+
+	_Ret_notnull_ const MESHNODE * CMesh::getNodeBlock(_In_ nfUint32 nBlockIdx, _Out_ nfUint32 & nNodeCount)
+	{
+		return m_Nodes.getBlock(nBlockIdx, nNodeCount);
+	}
+
+	_Ret_notnull_ const MESHFACE * CMesh::getFaceBlock(_In_ nfUint32 nBlockIdx, _Out_ nfUint32 & nFaceCount)
+	{
+		return m_Faces.getBlock(nBlockIdx, nFaceCount);
+	}
+
 	_Ret_notnull_ MESHBEAM * CMesh::getBeam(_In_ nfUint32 nIdx)
+	{
+		MESHBEAM * pBeam = m_BeamLattice.m_Beams.getData(nIdx);
+		markModified();
+		return pBeam;
+	}
+
+	_Ret_notnull_ const MESHBEAM * CMesh::readBeam(_In_ nfUint32 nIdx)
 	{
 		return m_BeamLattice.m_Beams.getData(nIdx);
 	}
@@ -390,15 +473,22 @@ namespace NMR {
 	}
 
 	_Ret_notnull_ MESHBALL * CMesh::getBall(_In_ nfUint32 nIdx)
+	{
+		MESHBALL * pBall = m_BeamLattice.m_Balls.getData(nIdx);
+		markModified();
+		return pBall;
+	}
+
+	_Ret_notnull_ const MESHBALL * CMesh::readBall(_In_ nfUint32 nIdx)
 	{
 		return m_BeamLattice.m_Balls.getData(nIdx);
 	}
 
-	_Ret_notnull_ MESHNODE * CMesh::getOccupiedNode(_In_ nfUint32 nIdx)
+	_Ret_notnull_ const MESHNODE * CMesh::getOccupiedNode(_In_ nfUint32 nIdx)
 	{
 		std::unordered_set<nfInt32>::iterator iter = m_BeamLattice.m_OccupiedNodes.begin();
 		std::advance(iter, nIdx);
-		return getNode(*iter);
+		return readNode(*iter);
 	}
 
 	void CMesh::setBeamLatticeMinLength(nfDouble dMinLength)
@@ -447,6 +537,122 @@ namespace NMR {
 		return eModelBeamLatticeCapMode::MODELBEAMLATTICECAPMODE_SPHERE;
 	}
 
+	nfBool CMesh::isManifoldAndOriented(_In_opt_ CThreadPool * pThreadPool)
+	{
+		if (m_nManifoldCheckGeneration != m_nGeneration) {
+			m_bManifoldAndOriented = checkManifoldAndOriented(pThreadPool);
+			m_nManifoldCheckGeneration = m_nGeneration;
+		}
+
+		return m_bManifoldAndOriented;
+	}
+
+	nfBool CMesh::checkManifoldAndOriented(_In_opt_ CThreadPool * pThreadPool)
+	{
+		if (!checkSanity())
+			return false;
+
+		nfUint32 nNodeCount = getNodeCount();
+		nfUint32 nFaceCount = getFaceCount();
+
+		if (nNodeCount < 3)
+			return false;
+		if (nFaceCount < 3)
+			return false;
+
+		// Every edge is stored as a key of its lower node index, its higher node index and its
+		// orientation bit. After sorting, a manifold and oriented mesh consists of key pairs
+		// that only differ in the orientation bit. The keys are distributed to buckets by their
+		// lower node index, so that the buckets can be sorted and checked independently.
+		auto fnEdgeKey = [](nfUint32 nNodeIndex1, nfUint32 nNodeIndex2) {
+			if (nNodeIndex1 < nNodeIndex2)
+				return ((nfUint64)nNodeIndex1 << 32) | ((nfUint64)nNodeIndex2 << 1);
+			return ((nfUint64)nNodeIndex2 << 32) | ((nfUint64)nNodeIndex1 << 1) | 1;
+		};
+
+		nfUint32 nTaskCount = 1;
+		if (pThreadPool != nullptr)
+			nTaskCount = std::min(pThreadPool->getThreadCount() * NMR_MESH_MANIFOLDCHECK_TASKSPERTHREAD, nFaceCount);
+		nfUint32 nBucketCount = nTaskCount;
+
+		auto fnRunTasks = [pThreadPool](nfUint32 nCount, const ThreadPoolTask & fnTask) {
+			if (pThreadPool != nullptr)
+				pThreadPool->runTasks(nCount, fnTask);
+			else
+				for (nfUint32 nTask = 0; nTask < nCount; nTask++)
+					fnTask(nTask);
+		};
+		auto fnChunkStart = [nFaceCount, nTaskCount](nfUint32 nChunk) {
+			return (nfUint32)(((nfUint64)nFaceCount * nChunk) / nTaskCount);
+		};
+		auto fnBucket = [nNodeCount, nBucketCount](nfUint64 nKey) {
+			return (nfUint32)(((nKey >> 32) * nBucketCount) / nNodeCount);
+		};
+
+		// Count the keys of every face chunk per bucket
+		std::vector<nfUint64> BucketOffsets((size_t)nTaskCount * nBucketCount, 0);
+		fnRunTasks(nTaskCount, [&](nfUint32 nChunk) {
+			nfUint64 * pCounts = &BucketOffsets[(size_t)nChunk * nBucketCount];
+			nfUint32 nChunkEnd = fnChunkStart(nChunk + 1);
+			for (nfUint32 nFaceIndex = fnChunkStart(nChunk); nFaceIndex < nChunkEnd; nFaceIndex++) {
+				const MESHFACE * pFace = readFace(nFaceIndex);
+				for (nfUint32 j = 0; j < 3; j++)
+					pCounts[fnBucket(fnEdgeKey(pFace->m_nodeindices[j], pFace->m_nodeindices[(j + 1) % 3]))]++;
+			}
+		});
+
+		std::vector<nfUint64> BucketStarts(nBucketCount + 1);
+		nfUint64 nOffset = 0;
+		for (nfUint32 nBucket = 0; nBucket < nBucketCount; nBucket++) {
+			BucketStarts[nBucket] = nOffset;
+			for (nfUint32 nChunk = 0; nChunk < nTaskCount; nChunk++) {
+				nfUint64 nCount = BucketOffsets[(size_t)nChunk * nBucketCount + nBucket];
+				BucketOffsets[(size_t)nChunk * nBucketCount + nBucket] = nOffset;
+				nOffset += nCount;
+			}
+		}
+		BucketStarts[nBucketCount] = nOffset;
+
+		// Scatter the keys into their buckets
+		std::vector<nfUint64> EdgeKeys((size_t)nOffset);
+		fnRunTasks(nTaskCount, [&](nfUint32 nChunk) {
+			nfUint64 * pOffsets = &BucketOffsets[(size_t)nChunk * nBucketCount];
+			nfUint32 nChunkEnd = fnChunkStart(nChunk + 1);
+			for (nfUint32 nFaceIndex = fnChunkStart(nChunk); nFaceIndex < nChunkEnd; nFaceIndex++) {
+				const MESHFACE * pFace = readFace(nFaceIndex);
+				for (nfUint32 j = 0; j < 3; j++) {
+					nfUint64 nKey = fnEdgeKey(pFace->m_nodeindices[j], pFace->m_nodeindices[(j + 1) % 3]);
+					EdgeKeys[(size_t)pOffsets[fnBucket(nKey)]++] = nKey;
+				}
+			}
+		});
+
+		// Sort and check every bucket, stop as soon as one bucket fails
+		std::atomic<bool> bFailed(false);
+		fnRunTasks(nBucketCount, [&](nfUint32 nBucket) {
+			if (bFailed.load(std::memory_order_relaxed))
+				return;
+
+			auto iBegin = EdgeKeys.begin() + (size_t)BucketStarts[nBucket];
+			auto iEnd = EdgeKeys.begin() + (size_t)BucketStarts[nBucket + 1];
+			if (((iEnd - iBegin) % 2) != 0) {
+				bFailed = true;
+				return;
+			}
+
+			std::sort(iBegin, iEnd);
+			for (auto iKey = iBegin; iKey != iEnd; iKey += 2) {
+				if (((*iKey & 1) != 0) || (*(iKey + 1) != (*iKey | 1))) {
+					bFailed = true;
+					return;
+				}
+			}
+		});
+
+		// Mesh is non-empty, oriented and manifold
+		return !bFailed;
+	}
+
 	nfBool CMesh::checkSanity()
 	{
 		nfUint32 nIdx, j;
@@ -467,7 +673,7 @@ namespace NMR {
 			return false;
 
 		for (nIdx = 0; nIdx < nNodeCount; nIdx++) {
-			MESHNODE * node = getNode(nIdx);
+			const MESHNODE * node = readNode(nIdx);
 			if (node->m_index != (nfInt32) nIdx)
 				return false;
 			for (j = 0; j < 3; j++)
@@ -476,7 +682,7 @@ namespace NMR {
 		}
 
 		for (nIdx = 0; nIdx < nFaceCount; nIdx++) {
-			MESHFACE * face = getFace(nIdx);
+			const MESHFACE * face = readFace(nIdx);
 			for (j = 0; j < 3; j++)
 				if ((face->m_nodeindices[j] < 0) || (((nfUint32)face->m_nodeindices[j]) >= nNodeCount))
 					return false;
@@ -488,7 +694,7 @@ namespace NMR {
 		}
 
 		for (nIdx = 0; nIdx < nBeamCount; nIdx++) {
-			MESHBEAM * beam = getBeam(nIdx);
+			const MESHBEAM * beam = readBeam(nIdx);
 			for (j = 0; j < 2; j++)
 				if ((beam->m_nodeindices[j] < 0) || (((nfUint32)beam->m_nodeindices[j]) >= nNodeCount))
 					return false;
@@ -498,7 +704,7 @@ namespace NMR {
 		}
 
 		for (nIdx = 0; nIdx < nBallCount; nIdx++) {
-			MESHBALL* ball = getBall(nIdx);
+			const MESHBALL* ball = readBall(nIdx);
 			if ((ball->m_nodeindex < 0) || (((nfUint32)ball->m_nodeindex) >= nNodeCount))
 				return false;
 		}
@@ -511,18 +717,22 @@ namespace NMR {
 		m_Faces.clearAllData();
 		m_Nodes.clearAllData();
 		clearBeamLattice();
+		markModified();
 	}
 	
 	void CMesh::clearBeamLattice() {
 		m_BeamLattice.clear();
+		markModified();
 	}
 
 	void CMesh::clearBeamLatticeBeams() {
 		m_BeamLattice.clearBeams();
+		markModified();
 	}
 
 	void CMesh::clearBeamLatticeBalls() {
 		m_BeamLattice.clearBalls();
+		markModified();
 	}
 
 	void CMesh::scanOccupiedNodes() {
@@ -530,7 +740,7 @@ namespace NMR {
 
 		nfUint32 beamCount = m_BeamLattice.m_Beams.getCount();
 		for (nfUint32 iBeam = 0; iBeam < beamCount; iBeam++) {
-			MESHBEAM * meshBeam = getBeam(iBeam);
+			const MESHBEAM * meshBeam = readBeam(iBeam);
 			m_BeamLattice.m_OccupiedNodes.insert({ meshBeam->m_nodeindices[0], meshBeam->m_nodeindices[1] });
 		}
 	}
@@ -599,15 +809,24 @@ namespace NMR {
 
 	void CMesh::extendOutbox(_Out_ NOUTBOX3& vOutBox, _In_ const NMATRIX3 mAccumulatedMatrix)
 	{
-		if (fnMATRIX3_isIdentity(mAccumulatedMatrix)) {
-			for (nfUint32 iNode = 0; iNode < getNodeCount(); iNode++) {
-				fnOutboxMergeVector(vOutBox, getNode(iNode)->m_position);
+		// The outbox of the last matrix is cached, as build items and components often query the same one
+		if ((m_nOutboxGeneration != m_nGeneration) || (memcmp(&m_mOutboxMatrix, &mAccumulatedMatrix, sizeof(NMATRIX3)) != 0)) {
+			fnOutboxInitialize(m_vOutbox);
+			if (fnMATRIX3_isIdentity(mAccumulatedMatrix)) {
+				for (nfUint32 iNode = 0; iNode < getNodeCount(); iNode++) {
+					fnOutboxMergeVector(m_vOutbox, readNode(iNode)->m_position);
+				}
 			}
-		}
-		else {
-			for (nfUint32 iNode = 0; iNode < getNodeCount(); iNode++) {
-				fnOutboxMergeVector(vOutBox, fnMATRIX3_apply(mAccumulatedMatrix, getNode(iNode)->m_position));
+			else {
+				for (nfUint32 iNode = 0; iNode < getNodeCount(); iNode++) {
+					fnOutboxMergeVector(m_vOutbox, fnMATRIX3_apply(mAccumulatedMatrix, readNode(iNode)->m_position));
+				}
 			}
+			m_mOutboxMatrix = mAccumulatedMatrix;
+			m_nOutboxGeneration = m_nGeneration;
 		}
+
+		if (getNodeCount() > 0)
+			fnOutboxMergeOutbox(vOutBox, m_vOutbox);
 	}
 }
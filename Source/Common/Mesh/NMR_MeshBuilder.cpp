@@ -97,6 +97,7 @@ namespace NMR {
 		nfUint32 nNodeCount = m_Nodes.getCount();
 		nfUint32 nFaceCount = m_Faces.getCount();
 		pNodes.resize(nNodeCount);
+		pMesh->reserve(pMesh->getNodeCount() + nNodeCount, pMesh->getFaceCount() + nFaceCount, 0);
 
 		for (nIdx = 0; nIdx < nNodeCount; nIdx++) {
 			NVEC3 * pPosition = m_Nodes.getData(nIdx);
@@ -62,17 +62,17 @@ namespace NMR {
 
 		nfUint32 nIdx, j;
 		nfUint32 nFaceCount = pMesh->getFaceCount();
-		MESHFACE * face;
-		MESHNODE * node;
+		const MESHFACE * face;
+		const MESHNODE * node;
 
 		MESHFORMAT_STL_FACET facet;
 		std::list<MESHFORMAT_STL_FACET> facetdata;
 
 		for (nIdx = 0; nIdx < nFaceCount; nIdx++) {
 
-			face = pMesh->getFace(nIdx);
+			face = pMesh->readFace(nIdx);
 			for (j = 0; j < 3; j++) {
-				node = pMesh->getNode (face->m_nodeindices[j]);
+				node = pMesh->readNode (face->m_nodeindices[j]);
 				if (pmMatrix)
 					facet.m_vertices[j] = fnMATRIX3_apply(*pmMatrix, node->m_position);
 				else
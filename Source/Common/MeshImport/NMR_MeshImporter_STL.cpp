@@ -34,10 +34,11 @@ This is a derived class for Importing the binary STL and color STL Mesh Format.
 #include "Common/MeshImport/NMR_MeshImporter_STL.h" 
 #include "Common/MeshInformation/NMR_MeshInformation.h" 
 #include "Common/MeshInformation/NMR_MeshInformation_Properties.h" 
-#include "Common/Math/NMR_VectorTree.h" 
+#include "Common/Math/NMR_VectorHashGrid.h" 
 #include "Common/Math/NMR_Matrix.h" 
 #include "Common/NMR_Exception.h" 
 #include <cmath>
+#include <algorithm>
 #include <array>
 #include <list>
 
@@ -150,10 +151,15 @@ namespace NMR {
 		nfUint32 nNodeIdx;
 		MESHNODE * pNodes[3];
 		MESHFORMAT_STL_FACET Facet;
-		CVectorTree VectorTree;
+		CVectorHashGrid VectorGrid;
 		nfBool bIsValid;
 
-		VectorTree.setUnits(m_fUnits);
+		VectorGrid.setUnits(m_fUnits);
+		// Closed meshes have about half as many nodes as faces. The face count is
+		// not verified yet, so larger meshes let the grid grow on demand.
+		VectorGrid.reserve(std::min(nFaceCount / 2, (nfUint32)NMR_MESHIMPORTER_STL_MAXRESERVEDNODES));
+		pMesh->reserve(pMesh->getNodeCount() + std::min(nFaceCount / 2, (nfUint32)NMR_MESHIMPORTER_STL_MAXRESERVEDNODES),
+			pMesh->getFaceCount() + std::min(nFaceCount, (nfUint32)NMR_MESHIMPORTER_STL_MAXRESERVEDNODES * 2), 0);
 
 		for (nfUint32 nIdx = 0; nIdx < nFaceCount; nIdx++) {
 			pStream->readIntoBuffer((nfByte*)&Facet, sizeof(Facet), true);
@@ -167,7 +173,7 @@ namespace NMR {
 				for (nfUint32 k = 0; k < 3; k++)
 					bIsValid &= (fabs(Facet.m_vertices[j].m_fields[k]) < NMR_MESH_MAXCOORDINATE);
 
-			// Identify Nodes via Tree
+			// Identify Nodes via Grid
 			if (bIsValid) {
 
 				for (nfUint32 j = 0; j < 3; j++) {
@@ -175,12 +181,12 @@ namespace NMR {
 					if (pmMatrix)
 						vPosition = fnMATRIX3_apply(*pmMatrix, vPosition);
 
-					if (VectorTree.findVector3(vPosition, nNodeIdx)) {
+					if (VectorGrid.findVector3(vPosition, nNodeIdx)) {
 						pNodes[j] = pMesh->getNode(nNodeIdx);
 					}
 					else {
 						pNodes[j] = pMesh->addNode(vPosition);
-						VectorTree.addVector3(pNodes[j]->m_position, (nfUint32)pNodes[j]->m_index);
+						VectorGrid.addVector3(pNodes[j]->m_position, (nfUint32)pNodes[j]->m_index);
 					}
 				}
 
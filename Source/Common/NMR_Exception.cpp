@@ -126,6 +126,8 @@ namespace NMR {
 		case NMR_ERROR_COULDNOTINFLATE: return "Failed to decompress part";
 		case NMR_ERROR_COULDNOTINITDEFLATE: return "Failed to initialize a zlib buffer";
 		case NMR_ERROR_TOOMANYSLICES: return "Too many slices";
+		case NMR_ERROR_COULDNOTMAPFILE: return "The specified file could not be mapped into memory";
+		case NMR_ERROR_MAPPEDFILETRUNCATED: return "A memory-mapped file has been truncated while in use";
 
 		// Unhandled exception
 		case NMR_ERROR_GENERICEXCEPTION: return NMR_GENERICEXCEPTIONSTRING;
@@ -422,6 +424,9 @@ namespace NMR {
 		case NMR_ERROR_KEYSTOREDUPLICATERESOURCEDATAGROUP: return "A resource data group already exist for this keyuuid";
 		case NMR_ERROR_KEYSTOREINVALIDALGORITHM: return "The algorithm attribute is invalid";
 		case NMR_ERROR_KEYSTOREINVALIDENCODING: return "The keystore element value is not base64 encoded.";
+		case NMR_ERROR_MESHSTREAMGEOMETRYREQUIRED: return "Streamed mesh geometry is not retained, but required by the mesh content";
+		case NMR_ERROR_STREAMWRITERINVALIDSTATE: return "The call is not allowed in the current state of the streaming writer";
+		case NMR_ERROR_INVALIDMODELOBJECT: return "An object is not valid for its object type";
 		case NMR_ERROR_KEYSTOREINVALIDCOMPRESSION: return "The KeyStore ResourceData compression is invalid";
 		case NMR_ERROR_KEYSTOREINVALIDCIPHERVALUE: return "Invalid CipherValue elment value";
 		case NMR_ERROR_KEYSTOREINVALIDMGF: return "The mfgalgorithm attribute has invalid value";
@@ -516,6 +521,12 @@ namespace NMR {
 		case NMR_ERROR_DUPLICATE_BOUNDARY_SHAPE_MIN_FEATURE_SIZE: return "Duplicate attribute minfeaturesize in levelset element";
 		case NMR_ERROR_DUPLICATE_BOUNDARY_SHAPE_FALLBACK_VALUE: return "Duplicate attribute fallbackvalue in levelset element";
 		case NMR_ERROR_DUPLICATE_BOUNDARY_SHAPE_VOLUME_ID: return "Duplicate attribute volumeid in levelset element";
+		case NMR_ERROR_LEVELSET_MISSING_MESH: return "The levelset has no mesh as evaluation domain";
+		case NMR_ERROR_LEVELSET_UNSUPPORTED_FUNCTION: return "The function of the levelset can not be evaluated";
+		case NMR_ERROR_LEVELSET_INVALID_CHANNEL: return "The levelset channel is not a scalar output of the function";
+		case NMR_ERROR_INVALIDPNGIMAGE: return "An image3D sheet is not a valid PNG image";
+		case NMR_ERROR_IMAGE3DSHEETSIZEMISMATCH: return "An image3D sheet does not match the size of the image stack";
+		case NMR_ERROR_MISSINGIMAGE3DSHEET: return "An image3D sheet has not been set";
 
 		// XML Parser Error Constants(0x9XXX)
 		case NMR_ERROR_XMLPARSER_INVALIDATTRIBVALUE: return "Invalid XML attribute value";
@@ -543,6 +554,8 @@ namespace NMR {
 		case NMR_ERROR_XMLPARSER_INVALID_ESCAPESTRING: return "XML contains an invalid escape character.";
 		case NMR_ERROR_DUPLICATE_BOX_ATTRIBUTE: return "A box attribute is duplicated.";
 		case NMR_ERROR_DUPLICATE_MATINDICES_ATTRIBUTE: return "A matindices attribute is duplicated.";
+		case NMR_ERROR_XMLPARSER_RAWACCESSNOTPOSSIBLE: return "Raw access to the XML stream is not possible at the current position.";
+		case NMR_ERROR_XMLPARSER_ENTITYEXCEEDSBUFFER: return "An XML element with its attributes does not fit into the buffer of the reader.";
 
 		// Library errors (0xAXXX)
 		case NMR_ERROR_COULDNOTGETINTERFACEVERSION: return "Could not get interface version";
@@ -0,0 +1,93 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_NumberFormat.cpp implements the shortest round-trip formatting of floating point numbers.
+
+--*/
+
+#include "Common/NMR_NumberFormat.h"
+#include "Common/NMR_Exception.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#if defined(__has_include)
+#if __has_include(<charconv>)
+#include <charconv>
+#endif
+#endif
+
+// std::to_chars implements the shortest round-trip conversion (Ryu) in all current standard libraries.
+#if defined(__cpp_lib_to_chars) && (__cpp_lib_to_chars >= 201611L)
+#define NMR_NUMBERFORMAT_TOCHARS
+#endif
+
+namespace NMR {
+
+#ifdef NMR_NUMBERFORMAT_TOCHARS
+
+	template <typename T>
+	nfUint32 fnToShortestBuffer(_In_ T Value, _Out_ nfChar * pBuffer, _In_ nfUint32 cbBufferSize)
+	{
+		std::to_chars_result Result = std::to_chars(pBuffer, pBuffer + cbBufferSize, Value, std::chars_format::fixed);
+		if (Result.ec != std::errc())
+			throw CNMRException(NMR_ERROR_COULDNOTCONVERTNUMBER);
+		return (nfUint32)(Result.ptr - pBuffer);
+	}
+
+#else
+
+	// Without std::to_chars, the precision is increased until the printed value reads back identically.
+	template <typename T>
+	nfUint32 fnToShortestBuffer(_In_ T Value, _Out_ nfChar * pBuffer, _In_ nfUint32 cbBufferSize)
+	{
+		const int nMaxPrecision = (sizeof(T) == sizeof(nfFloat)) ? 9 : 17;
+		int nCount = 0;
+		for (int nPrecision = 1; nPrecision <= nMaxPrecision; nPrecision++) {
+			nCount = snprintf(pBuffer, cbBufferSize, "%.*g", nPrecision, (nfDouble)Value);
+			if ((nCount < 1) || ((nfUint32)nCount >= cbBufferSize))
+				throw CNMRException(NMR_ERROR_COULDNOTCONVERTNUMBER);
+			if ((T)strtod(pBuffer, nullptr) == Value)
+				break;
+		}
+		return (nfUint32)nCount;
+	}
+
+#endif // NMR_NUMBERFORMAT_TOCHARS
+
+	nfUint32 fnFloatToShortestBuffer(_In_ nfFloat fValue, _Out_ nfChar * pBuffer, _In_ nfUint32 cbBufferSize)
+	{
+		return fnToShortestBuffer(fValue, pBuffer, cbBufferSize);
+	}
+
+	nfUint32 fnDoubleToShortestBuffer(_In_ nfDouble dValue, _Out_ nfChar * pBuffer, _In_ nfUint32 cbBufferSize)
+	{
+		return fnToShortestBuffer(dValue, pBuffer, cbBufferSize);
+	}
+
+}
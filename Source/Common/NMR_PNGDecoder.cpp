@@ -0,0 +1,347 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_PNGDecoder.cpp implements the decoding of PNG images. The chunks are read
+and checked, the image data is inflated with zlib, and the scanlines of every
+interlace pass are unfiltered and expanded into the decoded image.
+
+--*/
+
+#include "Common/NMR_PNGDecoder.h"
+#include "Common/NMR_Exception.h"
+
+#include "zlib.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <string>
+
+namespace NMR {
+
+	namespace {
+
+		const nfByte PNG_SIGNATURE[8] = { 0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A };
+
+		const nfUint32 PNG_COLORTYPE_GRAY = 0;
+		const nfUint32 PNG_COLORTYPE_RGB = 2;
+		const nfUint32 PNG_COLORTYPE_PALETTE = 3;
+		const nfUint32 PNG_COLORTYPE_GRAYALPHA = 4;
+		const nfUint32 PNG_COLORTYPE_RGBA = 6;
+
+		// Adam7 passes: first column, first row, column step, row step
+		const nfUint32 PNG_ADAM7[7][4] = {
+			{ 0, 0, 8, 8 },
+			{ 4, 0, 8, 8 },
+			{ 0, 4, 4, 8 },
+			{ 2, 0, 4, 4 },
+			{ 0, 2, 2, 4 },
+			{ 1, 0, 2, 2 },
+			{ 0, 1, 1, 2 },
+		};
+
+		nfUint32 fnReadUint32BE(_In_ const nfByte * pData)
+		{
+			return ((nfUint32)pData[0] << 24) | ((nfUint32)pData[1] << 16) | ((nfUint32)pData[2] << 8) | (nfUint32)pData[3];
+		}
+
+		nfUint32 fnSamplesPerPixel(_In_ nfUint32 nColorType)
+		{
+			switch (nColorType) {
+			case PNG_COLORTYPE_GRAY: return 1;
+			case PNG_COLORTYPE_RGB: return 3;
+			case PNG_COLORTYPE_PALETTE: return 1;
+			case PNG_COLORTYPE_GRAYALPHA: return 2;
+			case PNG_COLORTYPE_RGBA: return 4;
+			default: throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+			}
+		}
+
+		nfBool fnIsValidBitDepth(_In_ nfUint32 nColorType, _In_ nfUint32 nBitDepth)
+		{
+			switch (nColorType) {
+			case PNG_COLORTYPE_GRAY:
+				return (nBitDepth == 1) || (nBitDepth == 2) || (nBitDepth == 4) || (nBitDepth == 8) || (nBitDepth == 16);
+			case PNG_COLORTYPE_PALETTE:
+				return (nBitDepth == 1) || (nBitDepth == 2) || (nBitDepth == 4) || (nBitDepth == 8);
+			default:
+				return (nBitDepth == 8) || (nBitDepth == 16);
+			}
+		}
+
+		nfByte fnPaeth(_In_ nfInt32 nLeft, _In_ nfInt32 nUp, _In_ nfInt32 nUpLeft)
+		{
+			nfInt32 nEstimate = nLeft + nUp - nUpLeft;
+			nfInt32 nDistLeft = std::abs(nEstimate - nLeft);
+			nfInt32 nDistUp = std::abs(nEstimate - nUp);
+			nfInt32 nDistUpLeft = std::abs(nEstimate - nUpLeft);
+			if ((nDistLeft <= nDistUp) && (nDistLeft <= nDistUpLeft))
+				return (nfByte)nLeft;
+			if (nDistUp <= nDistUpLeft)
+				return (nfByte)nUp;
+			return (nfByte)nUpLeft;
+		}
+
+		// Reverses the filter of a scanline in place, pPrevious is nullptr for the first line of a pass
+		void fnUnfilterScanline(_In_ nfByte nFilterType, _Inout_ nfByte * pLine, _In_opt_ const nfByte * pPrevious, _In_ size_t cbLine, _In_ size_t cbPixel)
+		{
+			for (size_t nIndex = 0; nIndex < cbLine; nIndex++) {
+				nfInt32 nLeft = (nIndex >= cbPixel) ? pLine[nIndex - cbPixel] : 0;
+				nfInt32 nUp = pPrevious ? pPrevious[nIndex] : 0;
+				nfInt32 nUpLeft = (pPrevious && (nIndex >= cbPixel)) ? pPrevious[nIndex - cbPixel] : 0;
+
+				switch (nFilterType) {
+				case 0: break;
+				case 1: pLine[nIndex] = (nfByte)(pLine[nIndex] + nLeft); break;
+				case 2: pLine[nIndex] = (nfByte)(pLine[nIndex] + nUp); break;
+				case 3: pLine[nIndex] = (nfByte)(pLine[nIndex] + ((nLeft + nUp) >> 1)); break;
+				case 4: pLine[nIndex] = (nfByte)(pLine[nIndex] + fnPaeth(nLeft, nUp, nUpLeft)); break;
+				default: throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+				}
+			}
+		}
+
+		void fnInflate(_In_ const std::vector<nfByte> & Compressed, _Out_ std::vector<nfByte> & Inflated)
+		{
+			if ((Compressed.size() > std::numeric_limits<uInt>::max()) || (Inflated.size() > std::numeric_limits<uInt>::max()))
+				throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+
+			z_stream Stream;
+			memset(&Stream, 0, sizeof(Stream));
+			if (inflateInit(&Stream) != Z_OK)
+				throw CNMRException(NMR_ERROR_COULDNOTINITINFLATE);
+
+			// The size of the image data is known from the header, so it is inflated in one call
+			Stream.next_in = (Bytef *)Compressed.data();
+			Stream.avail_in = (uInt)Compressed.size();
+			Stream.next_out = Inflated.data();
+			Stream.avail_out = (uInt)Inflated.size();
+			nfInt32 nResult = inflate(&Stream, Z_FINISH);
+			nfBool bIsComplete = (Stream.total_out == Inflated.size());
+			inflateEnd(&Stream);
+
+			if ((nResult != Z_STREAM_END) || !bIsComplete)
+				throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+		}
+
+	}
+
+	void fnDecodePNG(_In_ const nfByte * pData, _In_ nfUint64 cbSize, _Out_ sPNGImage & Image)
+	{
+		if ((pData == nullptr) || (cbSize < sizeof(PNG_SIGNATURE)) || (memcmp(pData, PNG_SIGNATURE, sizeof(PNG_SIGNATURE)) != 0))
+			throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+
+		nfUint32 nWidth = 0;
+		nfUint32 nHeight = 0;
+		nfUint32 nBitDepth = 0;
+		nfUint32 nColorType = 0;
+		nfUint32 nInterlace = 0;
+		nfBool bHasHeader = false;
+		nfBool bHasEnd = false;
+		std::vector<std::array<nfUint16, 4>> Palette;
+		std::vector<nfUint16> TransparentColor;
+		std::vector<nfByte> Compressed;
+
+		nfUint64 nPosition = sizeof(PNG_SIGNATURE);
+		while (!bHasEnd) {
+			if (cbSize - nPosition < 12)
+				throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+			nfUint32 cbChunk = fnReadUint32BE(pData + nPosition);
+			if (cbChunk > cbSize - nPosition - 12)
+				throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+
+			const nfByte * pType = pData + nPosition + 4;
+			const nfByte * pChunk = pType + 4;
+			uLong nCRC32 = crc32(0, pType, 4 + cbChunk);
+			if (nCRC32 != fnReadUint32BE(pChunk + cbChunk))
+				throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+			nPosition += 12 + (nfUint64)cbChunk;
+
+			std::string sType((const char *)pType, 4);
+			if (!bHasHeader && (sType != "IHDR"))
+				throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+
+			if (sType == "IHDR") {
+				if (bHasHeader || (cbChunk != 13))
+					throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+				nWidth = fnReadUint32BE(pChunk);
+				nHeight = fnReadUint32BE(pChunk + 4);
+				nBitDepth = pChunk[8];
+				nColorType = pChunk[9];
+				nInterlace = pChunk[12];
+				fnSamplesPerPixel(nColorType);
+				if ((nWidth == 0) || (nHeight == 0) || !fnIsValidBitDepth(nColorType, nBitDepth) ||
+					(pChunk[10] != 0) || (pChunk[11] != 0) || (nInterlace > 1))
+					throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+				if ((nfUint64)nWidth * nHeight > NMR_PNG_MAXPIXELCOUNT)
+					throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+				bHasHeader = true;
+			}
+			else if (sType == "PLTE") {
+				if ((cbChunk % 3 != 0) || (cbChunk / 3 > 256))
+					throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+				Palette.resize(cbChunk / 3);
+				for (size_t nIndex = 0; nIndex < Palette.size(); nIndex++)
+					Palette[nIndex] = { pChunk[nIndex * 3], pChunk[nIndex * 3 + 1], pChunk[nIndex * 3 + 2], 255 };
+			}
+			else if (sType == "tRNS") {
+				if (nColorType == PNG_COLORTYPE_PALETTE) {
+					if (cbChunk > Palette.size())
+						throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+					for (nfUint32 nIndex = 0; nIndex < cbChunk; nIndex++)
+						Palette[nIndex][3] = pChunk[nIndex];
+				}
+				else if ((nColorType == PNG_COLORTYPE_GRAY) || (nColorType == PNG_COLORTYPE_RGB)) {
+					// Color key, given as 16 bit values independent of the bit depth
+					nfUint32 nSampleCount = fnSamplesPerPixel(nColorType);
+					if (cbChunk != nSampleCount * 2)
+						throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+					TransparentColor.resize(nSampleCount);
+					for (nfUint32 nIndex = 0; nIndex < nSampleCount; nIndex++)
+						TransparentColor[nIndex] = (nfUint16)((pChunk[nIndex * 2] << 8) | pChunk[nIndex * 2 + 1]);
+				}
+			}
+			else if (sType == "IDAT") {
+				Compressed.insert(Compressed.end(), pChunk, pChunk + cbChunk);
+			}
+			else if (sType == "IEND") {
+				bHasEnd = true;
+			}
+			else if ((pType[0] & 0x20) == 0) {
+				// Unknown critical chunk
+				throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+			}
+		}
+
+		if ((nColorType == PNG_COLORTYPE_PALETTE) && Palette.empty())
+			throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+
+		const nfUint32 nSamplesPerPixel = fnSamplesPerPixel(nColorType);
+		const size_t cbPixel = std::max<size_t>(1, nSamplesPerPixel * nBitDepth / 8);
+		auto fnLineSize = [&](nfUint32 nPixelCount) -> size_t {
+			return ((size_t)nPixelCount * nSamplesPerPixel * nBitDepth + 7) / 8;
+		};
+
+		// Size of the pixels of a pass, which is empty if the image is too small for it
+		auto fnPassSize = [&](nfUint32 nPass, nfUint32 & nPassWidth, nfUint32 & nPassHeight) {
+			if (nInterlace == 0) {
+				nPassWidth = nWidth;
+				nPassHeight = nHeight;
+				return;
+			}
+			const nfUint32 * pPass = PNG_ADAM7[nPass];
+			nPassWidth = (nWidth > pPass[0]) ? (nWidth - pPass[0] + pPass[2] - 1) / pPass[2] : 0;
+			nPassHeight = (nHeight > pPass[1]) ? (nHeight - pPass[1] + pPass[3] - 1) / pPass[3] : 0;
+		};
+
+		const nfUint32 nPassCount = (nInterlace == 0) ? 1 : 7;
+		size_t cbInflated = 0;
+		for (nfUint32 nPass = 0; nPass < nPassCount; nPass++) {
+			nfUint32 nPassWidth, nPassHeight;
+			fnPassSize(nPass, nPassWidth, nPassHeight);
+			if ((nPassWidth > 0) && (nPassHeight > 0))
+				cbInflated += (fnLineSize(nPassWidth) + 1) * nPassHeight;
+		}
+		std::vector<nfByte> Inflated(cbInflated);
+		fnInflate(Compressed, Inflated);
+		Compressed.clear();
+		Compressed.shrink_to_fit();
+
+		const nfBool bHasPalette = (nColorType == PNG_COLORTYPE_PALETTE);
+		const nfBool bHasColorKey = !TransparentColor.empty();
+		nfBool bHasPaletteAlpha = false;
+		for (auto & Entry : Palette)
+			bHasPaletteAlpha = bHasPaletteAlpha || (Entry[3] != 255);
+
+		Image.m_nWidth = nWidth;
+		Image.m_nHeight = nHeight;
+		Image.m_nBitDepth = (nBitDepth == 16) ? 16 : 8;
+		if (bHasPalette)
+			Image.m_nChannelCount = bHasPaletteAlpha ? 4 : 3;
+		else
+			Image.m_nChannelCount = nSamplesPerPixel + (bHasColorKey ? 1 : 0);
+		Image.m_Samples.assign((size_t)nWidth * nHeight * Image.m_nChannelCount, 0);
+
+		const nfUint32 nSampleMax = (1u << nBitDepth) - 1;
+		const nfUint32 nOutputMax = (1u << Image.m_nBitDepth) - 1;
+
+		nfByte * pLine = Inflated.data();
+		for (nfUint32 nPass = 0; nPass < nPassCount; nPass++) {
+			nfUint32 nPassWidth, nPassHeight;
+			fnPassSize(nPass, nPassWidth, nPassHeight);
+			if ((nPassWidth == 0) || (nPassHeight == 0))
+				continue;
+
+			const size_t cbLine = fnLineSize(nPassWidth);
+			const nfByte * pPrevious = nullptr;
+			for (nfUint32 nRow = 0; nRow < nPassHeight; nRow++) {
+				nfByte nFilterType = pLine[0];
+				nfByte * pScanline = pLine + 1;
+				fnUnfilterScanline(nFilterType, pScanline, pPrevious, cbLine, cbPixel);
+
+				nfUint32 nY = (nInterlace == 0) ? nRow : PNG_ADAM7[nPass][1] + nRow * PNG_ADAM7[nPass][3];
+				for (nfUint32 nColumn = 0; nColumn < nPassWidth; nColumn++) {
+					nfUint32 nX = (nInterlace == 0) ? nColumn : PNG_ADAM7[nPass][0] + nColumn * PNG_ADAM7[nPass][2];
+
+					nfUint16 Samples[4];
+					for (nfUint32 nSample = 0; nSample < nSamplesPerPixel; nSample++) {
+						size_t nBit = ((size_t)nColumn * nSamplesPerPixel + nSample) * nBitDepth;
+						if (nBitDepth == 16)
+							Samples[nSample] = (nfUint16)((pScanline[nBit / 8] << 8) | pScanline[nBit / 8 + 1]);
+						else
+							Samples[nSample] = (nfUint16)((pScanline[nBit / 8] >> (8 - nBitDepth - nBit % 8)) & nSampleMax);
+					}
+
+					nfUint16 * pPixel = &Image.m_Samples[((size_t)nY * nWidth + nX) * Image.m_nChannelCount];
+					if (bHasPalette) {
+						if (Samples[0] >= Palette.size())
+							throw CNMRException(NMR_ERROR_INVALIDPNGIMAGE);
+						for (nfUint32 nChannel = 0; nChannel < Image.m_nChannelCount; nChannel++)
+							pPixel[nChannel] = Palette[Samples[0]][nChannel];
+						continue;
+					}
+
+					nfBool bIsTransparent = bHasColorKey;
+					for (nfUint32 nSample = 0; nSample < nSamplesPerPixel; nSample++) {
+						bIsTransparent = bIsTransparent && (Samples[nSample] == TransparentColor[nSample]);
+						// Low bit depths are scaled to the full range
+						pPixel[nSample] = (nfUint16)(Samples[nSample] * nOutputMax / nSampleMax);
+					}
+					if (bHasColorKey)
+						pPixel[nSamplesPerPixel] = bIsTransparent ? 0 : (nfUint16)nOutputMax;
+				}
+
+				pPrevious = pScanline;
+				pLine += cbLine + 1;
+			}
+		}
+	}
+
+}
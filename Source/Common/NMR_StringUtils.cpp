@@ -33,7 +33,9 @@ correctly and Exception-safe
 
 #include "Common/NMR_StringUtils.h"
 #include "Common/NMR_Exception.h"
+#include "Common/NMR_Architecture_Utils.h"
 #include <climits>
+#include <cstdint>
 #include <sstream>
 #include <cmath>
 #include <string.h>
@@ -106,7 +108,8 @@ namespace NMR {
 		// Convert to integer and make a input and range check!
 		nfChar * pEndPtr;
 
-		nResult = strtol(pszValue, &pEndPtr, 10);
+		// long is only 32 bit on some platforms, so the range check must not rely on it
+		nResult = strtoll(pszValue, &pEndPtr, 10);
 
 		// Check if any conversion happened
 		if ((pEndPtr == pszValue) || (!pEndPtr))
@@ -115,7 +118,7 @@ namespace NMR {
 		if ((*pEndPtr != '\0') && (*pEndPtr != ' '))
 			throw CNMRException(NMR_ERROR_INVALIDSTRINGTOINTCONVERSION);
 
-		if ((nResult >= LONG_MAX) || (nResult <= LONG_MIN))
+		if ((nResult > INT32_MAX) || (nResult < INT32_MIN))
 			throw CNMRException(NMR_ERROR_STRINGTOINTCONVERSIONOUTOFRANGE);
 
 		return (nfInt32)nResult;
@@ -144,21 +147,106 @@ namespace NMR {
 		return (nfUint32)nResult;
 	}
 
+	// Checks whether all eight bytes of a chunk are ASCII digits
+	static inline nfBool fnChunkIsEightDigits(_In_ nfUint64 nChunk)
+	{
+		return (((nChunk & 0xF0F0F0F0F0F0F0F0ULL) | (((nChunk + 0x0606060606060606ULL) & 0xF0F0F0F0F0F0F0F0ULL) >> 4)) == 0x3333333333333333ULL);
+	}
+
+	// Converts eight ASCII digits, first digit in the lowest byte, to their value
+	static inline nfUint32 fnChunkToEightDigits(_In_ nfUint64 nChunk)
+	{
+		const nfUint64 nMask = 0x000000FF000000FFULL;
+		const nfUint64 nMul1 = 0x000F424000000064ULL; // 100 + (1000000 << 32)
+		const nfUint64 nMul2 = 0x0000271000000001ULL; // 1 + (10000 << 32)
+		nChunk -= 0x3030303030303030ULL;
+		nChunk = (nChunk * 10) + (nChunk >> 8);
+		nChunk = (((nChunk & nMask) * nMul1) + (((nChunk >> 16) & nMask) * nMul2)) >> 32;
+		return (nfUint32)nChunk;
+	}
+
+	nfBool fnDecimalChunkToUint32(_In_ nfUint64 nChunk, _In_ nfBool bBigEndian, _Out_ nfUint32 & nValue)
+	{
+		// The SWAR arithmetic expects the first digit in the lowest byte
+		if (bBigEndian)
+			nChunk = swapBytes(nChunk);
+
+		if (!fnChunkIsEightDigits(nChunk))
+			return false;
+
+		nValue = fnChunkToEightDigits(nChunk);
+		return true;
+	}
+
+	nfBool fnStringToShortDecimal(_In_ const nfChar * pValue, _In_ nfUint32 nLength, _Out_ nfUint32 & nValue)
+	{
+		if ((pValue == nullptr) || (nLength == 0) || (nLength > 9))
+			return false;
+
+		nfUint32 nHighDigit = 0;
+		if (nLength == 9) {
+			nHighDigit = (nfUint32)(pValue[0] - '0');
+			if (nHighDigit > 9)
+				return false;
+			pValue++;
+			nLength--;
+		}
+
+		// Right-align the digits in a chunk padded with leading zeros
+		nfChar Buffer[8] = { '0', '0', '0', '0', '0', '0', '0', '0' };
+		memcpy(&Buffer[8 - nLength], pValue, nLength);
+		nfUint64 nChunk;
+		memcpy(&nChunk, Buffer, 8);
+
+		nfUint32 nLowDigits;
+		if (!fnDecimalChunkToUint32(nChunk, isBigEndian(), nLowDigits))
+			return false;
+
+		nValue = nHighDigit * 100000000 + nLowDigits;
+		return true;
+	}
+
+	nfInt32 fnStringToInt32(_In_z_ const nfChar * pszValue, _In_ nfUint32 nLength)
+	{
+		__NMRASSERT(pszValue);
+
+		// Nine digits can not overflow, everything else takes the validating path
+		if ((nLength > 0) && (nLength <= 9)) {
+			nfUint32 nValue;
+			if (fnStringToShortDecimal(pszValue, nLength, nValue))
+				return (nfInt32)nValue;
+		}
+
+		return fnStringToInt32(pszValue);
+	}
+
 	nfFloat fnStringToFloat(_In_z_ const nfChar * pszValue)
 	{
 		return (nfFloat)fnStringToDouble(pszValue);
 	}
 
+	nfFloat fnStringToFloat(_In_z_ const nfChar * pszValue, _In_ nfUint32 nLength)
+	{
+		return (nfFloat)fnStringToDouble(pszValue, nLength);
+	}
+
 	nfDouble fnStringToDouble(_In_z_ const nfChar * pszValue)
 	{
-		__NMRASSERT(pwszValue);
+		__NMRASSERT(pszValue);
+		return fnStringToDouble(pszValue, (nfUint32)strlen(pszValue));
+	}
+
+	nfDouble fnStringToDouble(_In_z_ const nfChar * pszValue, _In_ nfUint32 nLength)
+	{
+		__NMRASSERT(pszValue);
 		nfDouble dResult = 0.0;
+		const nfChar * pszEnd = pszValue + nLength;
 
 		//skip leading whitespaces
-		for (; *pszValue && *pszValue == ' '; pszValue++);
+		for (; (pszValue < pszEnd) && (*pszValue == ' '); pszValue++);
 
 		// Convert to double and make a input and range check!
-		auto answer = fast_float::from_chars(pszValue, pszValue + strlen(pszValue), dResult);
+		auto answer = fast_float::from_chars(pszValue, pszEnd, dResult);
 
 		// Check if any conversion happened
 		if (answer.ec != std::errc())
@@ -167,7 +255,7 @@ namespace NMR {
 		}
 		else if (answer.ptr) // Invalidate comma as decimal separator
 		{
-			if (answer.ptr[0] == ',')
+			if ((answer.ptr < pszEnd) && (answer.ptr[0] == ','))
 			{
 				throw CNMRException(NMR_ERROR_INVALIDSTRINGTODOUBLECONVERSION);
 			}
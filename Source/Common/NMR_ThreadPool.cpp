@@ -0,0 +1,147 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ThreadPool.cpp implements a simple pool of worker threads, which distributes a fixed
+number of independent tasks over all workers and the calling thread.
+
+--*/
+
+#include "Common/NMR_ThreadPool.h"
+#include "Common/NMR_Exception.h"
+
+namespace NMR {
+
+	CThreadPool::CThreadPool(_In_ nfUint32 nThreadCount)
+		: m_pTask(nullptr), m_nTaskCount(0), m_nNextTask(0), m_nPendingTasks(0), m_bShutdown(false), m_nExceptionTask(0)
+	{
+		if (nThreadCount == 0)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		for (nfUint32 nIndex = 1; nIndex < nThreadCount; nIndex++)
+			m_Workers.push_back(std::thread(&CThreadPool::workerLoop, this));
+	}
+
+	CThreadPool::~CThreadPool()
+	{
+		{
+			std::lock_guard<std::mutex> Lock(m_Mutex);
+			m_bShutdown = true;
+		}
+		m_WakeCondition.notify_all();
+
+		for (auto & Worker : m_Workers)
+			Worker.join();
+	}
+
+	nfUint32 CThreadPool::getThreadCount()
+	{
+		return (nfUint32)m_Workers.size() + 1;
+	}
+
+	void CThreadPool::runTasks(_In_ nfUint32 nTaskCount, _In_ const ThreadPoolTask & fnTask)
+	{
+		if (nTaskCount == 0)
+			return;
+
+		if (m_Workers.empty() || (nTaskCount == 1)) {
+			for (nfUint32 nTaskIndex = 0; nTaskIndex < nTaskCount; nTaskIndex++)
+				fnTask(nTaskIndex);
+			return;
+		}
+
+		std::unique_lock<std::mutex> Lock(m_Mutex);
+		m_pTask = &fnTask;
+		m_nTaskCount = nTaskCount;
+		m_nNextTask = 0;
+		m_nPendingTasks = nTaskCount;
+		m_pException = nullptr;
+		m_nExceptionTask = nTaskCount;
+		m_WakeCondition.notify_all();
+
+		// The calling thread works on the tasks as well
+		processTasks(Lock);
+		m_DoneCondition.wait(Lock, [this] { return m_nPendingTasks == 0; });
+
+		m_pTask = nullptr;
+		std::exception_ptr pException = m_pException;
+		m_pException = nullptr;
+		Lock.unlock();
+
+		if (pException)
+			std::rethrow_exception(pException);
+	}
+
+	void CThreadPool::processTasks(_In_ std::unique_lock<std::mutex> & Lock)
+	{
+		while ((m_pTask != nullptr) && (m_nNextTask < m_nTaskCount)) {
+			nfUint32 nTaskIndex = m_nNextTask;
+			const ThreadPoolTask * pTask = m_pTask;
+			m_nNextTask++;
+
+			Lock.unlock();
+			std::exception_ptr pException;
+			try {
+				(*pTask)(nTaskIndex);
+			}
+			catch (...) {
+				pException = std::current_exception();
+			}
+			Lock.lock();
+
+			if (pException && (nTaskIndex < m_nExceptionTask)) {
+				m_pException = pException;
+				m_nExceptionTask = nTaskIndex;
+			}
+
+			m_nPendingTasks--;
+			if (m_nPendingTasks == 0)
+				m_DoneCondition.notify_all();
+		}
+	}
+
+	void CThreadPool::workerLoop()
+	{
+		std::unique_lock<std::mutex> Lock(m_Mutex);
+		while (true) {
+			m_WakeCondition.wait(Lock, [this] { return m_bShutdown || ((m_pTask != nullptr) && (m_nNextTask < m_nTaskCount)); });
+			if (m_bShutdown)
+				return;
+
+			processTasks(Lock);
+		}
+	}
+
+	nfUint32 CThreadPool::getHardwareThreadCount()
+	{
+		nfUint32 nThreadCount = std::thread::hardware_concurrency();
+		if (nThreadCount == 0)
+			return 1;
+		return nThreadCount;
+	}
+
+}
@@ -40,8 +40,31 @@ NMR_OpcPackageReader.cpp defines an OPC Package reader in a portable way.
 #include "Model/Classes/NMR_ModelConstants.h"
 
 #include <iostream>
+#include <cstring>
+
+#define ZIPSIGNATURE_LOCALHEADER 0x04034b50
+#define ZIPSIGNATURE_CENTRALHEADER 0x02014b50
+#define ZIPSIGNATURE_ENDOFCENTRALDIR 0x06054b50
+#define ZIPSIGNATURE_ZIP64ENDOFCENTRALDIR 0x06064b50
+#define ZIPSIGNATURE_ZIP64LOCATOR 0x07064b50
+#define ZIPEXTRAFIELD_ZIP64 0x0001
 
 namespace NMR {
+
+	static nfUint32 fnZIPReadUInt16(_In_ const nfByte * pData)
+	{
+		return (nfUint32)pData[0] | ((nfUint32)pData[1] << 8);
+	}
+
+	static nfUint32 fnZIPReadUInt32(_In_ const nfByte * pData)
+	{
+		return fnZIPReadUInt16(pData) | (fnZIPReadUInt16(pData + 2) << 16);
+	}
+
+	static nfUint64 fnZIPReadUInt64(_In_ const nfByte * pData)
+	{
+		return (nfUint64)fnZIPReadUInt32(pData) | ((nfUint64)fnZIPReadUInt32(pData + 4) << 32);
+	}
 	
 	// custom callbck function for reading from a CImportStream on the fly
 	zip_int64_t custom_zip_source_callback(void *userData, void *data, zip_uint64_t len, zip_source_cmd_t cmd) {
@@ -174,6 +197,10 @@ namespace NMR {
 			m_pProgressMonitor->SetMaxProgress(double(nUnzippedFileSize));
 			m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
 
+			m_pMappedStream = std::dynamic_pointer_cast<CImportStream_MemoryMapped>(pImportStream);
+			if (m_pMappedStream)
+				readMappedDataOffsets();
+
 			readContentTypes();
 			readRootRelationships();
 		}
@@ -220,6 +247,8 @@ namespace NMR {
 
 		zip_error_fini(&m_ZIPError);
 		m_Buffer.resize(0);
+		m_MappedDataOffsets.clear();
+		m_pMappedStream = nullptr;
 
 		m_ZIParchive = nullptr;
 	}
@@ -243,14 +272,111 @@ namespace NMR {
 
 		nfUint64 nSize = Stat.size;
 
+		// Stored entries of a mapped package need not be copied
+		if ((nIndex < m_MappedDataOffsets.size()) && (m_MappedDataOffsets[nIndex] != 0)) {
+			nfUint64 nRequiredFields = ZIP_STAT_COMP_METHOD | ZIP_STAT_ENCRYPTION_METHOD | ZIP_STAT_SIZE | ZIP_STAT_COMP_SIZE;
+			if (((Stat.valid & nRequiredFields) == nRequiredFields) && (Stat.comp_method == ZIP_CM_STORE) &&
+				(Stat.encryption_method == ZIP_EM_NONE) && (Stat.comp_size == nSize))
+				return m_pMappedStream->createView(m_MappedDataOffsets[nIndex], nSize);
+		}
+
 		zip_file_t * pFile = zip_fopen_index(m_ZIParchive, nIndex, ZIP_FL_UNCHANGED);
 		if (pFile == nullptr)
 			throw CNMRException(NMR_ERROR_COULDNOTOPENZIPENTRY);
 
-		return std::make_shared<CImportStream_ZIP>(pFile, nSize);
+		return std::make_shared<CImportStream_ZIP>(pFile, nSize, m_ZIParchive, nIndex);
 	}
 
 
+	void COpcPackageReader::readMappedDataOffsets()
+	{
+		// libzip does not expose where the data of an entry starts, so the central directory
+		// is looked up in the mapping. Anything unexpected leaves the entries to libzip.
+		const nfByte * pData = m_pMappedStream->getData();
+		nfUint64 cbSize = m_pMappedStream->retrieveSize();
+		if (cbSize < 22)
+			return;
+
+		// The end of central directory record is followed by a comment of up to 65535 bytes
+		nfUint64 nEndOfCentralDir = cbSize - 22;
+		nfUint64 nSearchLimit = (nEndOfCentralDir > 65535) ? (nEndOfCentralDir - 65535) : 0;
+		while (fnZIPReadUInt32(pData + nEndOfCentralDir) != ZIPSIGNATURE_ENDOFCENTRALDIR) {
+			if (nEndOfCentralDir == nSearchLimit)
+				return;
+			nEndOfCentralDir--;
+		}
+
+		nfUint64 nEntryCount = fnZIPReadUInt16(pData + nEndOfCentralDir + 10);
+		nfUint64 nCentralDir = fnZIPReadUInt32(pData + nEndOfCentralDir + 16);
+		if ((nEndOfCentralDir >= 20) && (fnZIPReadUInt32(pData + nEndOfCentralDir - 20) == ZIPSIGNATURE_ZIP64LOCATOR)) {
+			nfUint64 nZip64EndOfCentralDir = fnZIPReadUInt64(pData + nEndOfCentralDir - 12);
+			if ((cbSize < 56) || (nZip64EndOfCentralDir > cbSize - 56) || (fnZIPReadUInt32(pData + nZip64EndOfCentralDir) != ZIPSIGNATURE_ZIP64ENDOFCENTRALDIR))
+				return;
+			nEntryCount = fnZIPReadUInt64(pData + nZip64EndOfCentralDir + 32);
+			nCentralDir = fnZIPReadUInt64(pData + nZip64EndOfCentralDir + 48);
+		}
+
+		zip_int64_t nZIPEntryCount = zip_get_num_entries(m_ZIParchive, ZIP_FL_UNCHANGED);
+		if ((nZIPEntryCount < 0) || (nEntryCount != (nfUint64)nZIPEntryCount))
+			return;
+
+		std::vector<nfUint64> DataOffsets((size_t)nEntryCount, 0);
+		nfUint64 nHeader = nCentralDir;
+		for (nfUint64 nIndex = 0; nIndex < nEntryCount; nIndex++) {
+			if ((nHeader > cbSize) || (cbSize - nHeader < 46) || (fnZIPReadUInt32(pData + nHeader) != ZIPSIGNATURE_CENTRALHEADER))
+				return;
+
+			nfUint64 cbCompressedSize = fnZIPReadUInt32(pData + nHeader + 20);
+			nfUint64 cbUncompressedSize = fnZIPReadUInt32(pData + nHeader + 24);
+			nfUint64 nLocalHeader = fnZIPReadUInt32(pData + nHeader + 42);
+			nfUint32 cbName = fnZIPReadUInt16(pData + nHeader + 28);
+			nfUint32 cbExtra = fnZIPReadUInt16(pData + nHeader + 30);
+			nfUint32 cbComment = fnZIPReadUInt16(pData + nHeader + 32);
+			if (cbSize - nHeader - 46 < (nfUint64)cbName + cbExtra + cbComment)
+				return;
+
+			// ZIP64 values are given in the extra field, in this order, if they do not fit
+			const nfByte * pExtra = pData + nHeader + 46 + cbName;
+			const nfByte * pExtraEnd = pExtra + cbExtra;
+			while (pExtraEnd - pExtra >= 4) {
+				nfUint32 nFieldID = fnZIPReadUInt16(pExtra);
+				nfUint32 cbField = fnZIPReadUInt16(pExtra + 2);
+				const nfByte * pField = pExtra + 4;
+				if ((nfUint64)(pExtraEnd - pField) < cbField)
+					return;
+
+				if (nFieldID == ZIPEXTRAFIELD_ZIP64) {
+					const nfByte * pFieldEnd = pField + cbField;
+					nfUint64 * pValues[3] = { &cbUncompressedSize, &cbCompressedSize, &nLocalHeader };
+					for (nfUint64 * pValue : pValues) {
+						if (*pValue == 0xFFFFFFFF) {
+							if (pFieldEnd - pField < 8)
+								return;
+							*pValue = fnZIPReadUInt64(pField);
+							pField += 8;
+						}
+					}
+				}
+				pExtra += 4 + cbField;
+			}
+
+			// The local header has to describe the same entry, otherwise the archive is not what libzip has read
+			const char * pszName = zip_get_name(m_ZIParchive, nIndex, ZIP_FL_ENC_RAW | ZIP_FL_UNCHANGED);
+			if ((pszName != nullptr) && (nLocalHeader < cbSize) && (cbSize - nLocalHeader >= 30) &&
+				(fnZIPReadUInt32(pData + nLocalHeader) == ZIPSIGNATURE_LOCALHEADER) && (fnZIPReadUInt16(pData + nLocalHeader + 26) == cbName) &&
+				(strlen(pszName) == cbName) && (cbSize - nLocalHeader - 30 >= cbName) && (memcmp(pData + nLocalHeader + 30, pszName, cbName) == 0)) {
+
+				nfUint64 nDataOffset = nLocalHeader + 30 + cbName + fnZIPReadUInt16(pData + nLocalHeader + 28);
+				if ((cbCompressedSize == cbUncompressedSize) && (nDataOffset <= cbSize) && (cbSize - nDataOffset >= cbCompressedSize))
+					DataOffsets[(size_t)nIndex] = nDataOffset;
+			}
+
+			nHeader += 46 + (nfUint64)cbName + cbExtra + cbComment;
+		}
+
+		m_MappedDataOffsets.swap(DataOffsets);
+	}
+
 	void COpcPackageReader::readContentTypes()
 	{
 		PImportStream pContentStream = openZIPEntry(OPCPACKAGE_PATH_CONTENTTYPES);
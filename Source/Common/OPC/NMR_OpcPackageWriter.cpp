@@ -43,13 +43,13 @@ NMR_OpcPackageWriter.cpp defines an OPC Package writer in a portable way.
 namespace NMR {
 
 
-	COpcPackageWriter::COpcPackageWriter(_In_ PExportStream pExportStream)
+	COpcPackageWriter::COpcPackageWriter(_In_ PExportStream pExportStream, _In_ PThreadPool pThreadPool)
 	{
 		if (pExportStream.get() == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
 		m_pExportStream = pExportStream;
-		m_pZIPWriter = std::make_shared<CPortableZIPWriter>(m_pExportStream, true);
+		m_pZIPWriter = std::make_shared<CPortableZIPWriter>(m_pExportStream, true, pThreadPool);
 
 		m_nRelationIDCounter = 0;
 	}
@@ -59,11 +59,11 @@ namespace NMR {
 		finishPackage();
 	}
 
-	POpcPackagePart COpcPackageWriter::addPart(_In_ std::string sPath)
+	POpcPackagePart COpcPackageWriter::addPart(_In_ std::string sPath, _In_ nfInt32 nCompressionLevel)
 	{
 		sPath = fnRemoveLeadingPathDelimiter(sPath);
 		
-		PExportStream pStream = m_pZIPWriter->createEntry(sPath, fnGetUnixTime());
+		PExportStream pStream = m_pZIPWriter->createEntry(sPath, fnGetUnixTime(), nCompressionLevel);
 		POpcPackagePart pPart = std::make_shared<COpcPackagePart>(sPath, pStream);
 		m_Parts.push_back(pPart);
 
@@ -0,0 +1,86 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_CPUFeatures.cpp implements the detection of the SIMD instruction sets.
+
+--*/
+
+#include "Common/Platform/NMR_CPUFeatures.h"
+
+#if defined(_MSC_VER) && (defined(_M_X64) || defined(_M_IX86))
+#include <intrin.h>
+#define NMR_CPUID_MSVC
+#elif (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define NMR_CPUID_GNUC
+#endif
+
+namespace NMR {
+
+	nfBool fnCPUSupportsInstructionSet(_In_ eCPUInstructionSet InstructionSet)
+	{
+#if defined(NMR_CPUID_MSVC)
+		int Info[4];
+		__cpuid(Info, 0);
+		int nMaxLeaf = Info[0];
+		if (nMaxLeaf < 1)
+			return false;
+
+		__cpuid(Info, 1);
+		if (InstructionSet == CPUINSTRUCTIONSET_SSE2)
+			return (Info[3] & (1 << 26)) != 0;
+
+		nfBool bOSXSave = (Info[2] & (1 << 27)) != 0;
+		if (!bOSXSave || (nMaxLeaf < 7))
+			return false;
+		unsigned long long nEnabledStates = _xgetbv(0);
+		__cpuidex(Info, 7, 0);
+		if (InstructionSet == CPUINSTRUCTIONSET_AVX2) {
+			// XMM and YMM states
+			return ((nEnabledStates & 0x06) == 0x06) && ((Info[1] & (1 << 5)) != 0);
+		}
+		// XMM, YMM, opmask and ZMM states
+		return ((nEnabledStates & 0xE6) == 0xE6) && ((Info[1] & (1 << 16)) != 0);
+#elif defined(NMR_CPUID_GNUC)
+		// Also checks the operating system support of the AVX registers
+		__builtin_cpu_init();
+		switch (InstructionSet) {
+		case CPUINSTRUCTIONSET_SSE2:
+			return __builtin_cpu_supports("sse2") != 0;
+		case CPUINSTRUCTIONSET_AVX2:
+			return __builtin_cpu_supports("avx2") != 0;
+		case CPUINSTRUCTIONSET_AVX512:
+			return __builtin_cpu_supports("avx512f") != 0;
+		}
+		return false;
+#else
+		(void)InstructionSet;
+		return false;
+#endif
+	}
+
+}
@@ -35,7 +35,7 @@ NMR_ExportStream_Compressed.h defines a stream to write compressed files
  
 namespace NMR {
 
-	CExportStream_Compressed::CExportStream_Compressed(PExportStream pUncompressedStream)
+	CExportStream_Compressed::CExportStream_Compressed(PExportStream pUncompressedStream, nfInt32 nCompressionLevel)
 	{
 		if (nullptr == pUncompressedStream)
 			throw CNMRException(NMR_ERROR_INVALIDPOINTER);
@@ -45,7 +45,7 @@ namespace NMR {
 		m_strm.zfree = Z_NULL;
 		m_strm.opaque = Z_NULL;
 
-		if (deflateInit2(&m_strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+		if (deflateInit2(&m_strm, nCompressionLevel, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY) != Z_OK)
 			throw CNMRException(NMR_ERROR_COULDNOTINITDEFLATE);
 	}
 
@@ -31,13 +31,65 @@ NMR_PortableZIPWriter.cpp implements a portable stream to write into ZIP files
 --*/
 
 #include "Common/Platform/NMR_ExportStream_ZIP.h"
+#include "Common/Platform/NMR_ImportStream_Deflated.h"
 #include "Common/NMR_Exception.h"
+
+#include <algorithm>
+#include <string.h>
  
 namespace NMR {
 
-	CExportStream_ZIP::CExportStream_ZIP(_In_ CPortableZIPWriter * pZIPWriter, nfUint32 nEntryKey)
+	// Deflates one block of a block compressed stream. Non-final blocks end on a byte boundary
+	// with a sync flush, so that the compressed blocks can simply be concatenated.
+	static void fnDeflateBlock(_In_ const nfByte * pData, _In_ nfUint32 cbCount, _In_ const nfByte * pDictionary, _In_ nfUint32 cbDictionary,
+		_In_ nfInt32 nLevel, _In_ nfBool bFinal, _Out_ std::vector<nfByte> & Output)
+	{
+		z_stream Stream;
+		memset(&Stream, 0, sizeof(Stream));
+		if (deflateInit2(&Stream, nLevel, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+			throw CNMRException(NMR_ERROR_DEFLATEINITFAILED);
+
+		nfInt32 nResult = Z_OK;
+		if (cbDictionary > 0)
+			nResult = deflateSetDictionary(&Stream, pDictionary, cbDictionary);
+
+		// deflateBound does not account for the empty stored block of the sync flush
+		Output.resize(deflateBound(&Stream, cbCount) + 16);
+		Stream.next_in = (Bytef *)pData;
+		Stream.avail_in = cbCount;
+		Stream.next_out = Output.data();
+		Stream.avail_out = (uInt)Output.size();
+
+		nfInt32 nFlush = bFinal ? Z_FINISH : Z_SYNC_FLUSH;
+		while (nResult == Z_OK) {
+			nResult = deflate(&Stream, nFlush);
+			if ((nResult == Z_OK) && (Stream.avail_out > 0)) {
+				// A sync flush is complete, as soon as output space is left
+				if (!bFinal)
+					nResult = Z_STREAM_END;
+			}
+			else if (((nResult == Z_OK) || (nResult == Z_BUF_ERROR)) && (Stream.avail_out == 0)) {
+				size_t cbWritten = Output.size();
+				Output.resize(cbWritten * 2);
+				Stream.next_out = Output.data() + cbWritten;
+				Stream.avail_out = (uInt)(Output.size() - cbWritten);
+				nResult = Z_OK;
+			}
+		}
+
+		Output.resize(Output.size() - Stream.avail_out);
+		deflateEnd(&Stream);
+
+		if (nResult != Z_STREAM_END)
+			throw CNMRException(NMR_ERROR_COULDNOTDEFLATE);
+	}
+
+	CExportStream_ZIP::CExportStream_ZIP(_In_ CPortableZIPWriter * pZIPWriter, nfUint32 nEntryKey, _In_ nfInt32 nCompressionLevel, _In_ PThreadPool pThreadPool)
 	{
 		m_bIsInitialized = false;
+		m_nCompressionLevel = nCompressionLevel;
+		m_nBlockBufferSize = 0;
+		m_bIsPassthrough = false;
 
 		if (pZIPWriter == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
@@ -47,6 +99,18 @@ namespace NMR {
 		m_pZIPWriter = pZIPWriter;
 		m_nEntryKey = nEntryKey;
 
+		if (m_nCompressionLevel == ZIPCOMPRESSIONLEVEL_STORED) {
+			m_bIsInitialized = true;
+			return;
+		}
+
+		if (pThreadPool) {
+			m_pThreadPool = pThreadPool;
+			m_BlockBuffer.resize((size_t)ZIPEXPORTBLOCKSIZE * ZIPEXPORTBLOCKSPERTHREAD * pThreadPool->getThreadCount());
+			m_bIsInitialized = true;
+			return;
+		}
+
 		m_pStream.next_in = nullptr;
 		m_pStream.avail_in = 0;
 		m_pStream.total_in = 0;
@@ -66,7 +130,7 @@ namespace NMR {
 		m_pStream.avail_out = ZIPEXPORTBUFFERSIZE;
 		m_pStream.total_out = 0;
 
-		nfInt32 nResult = deflateInit2(&m_pStream, Z_BEST_SPEED, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
+		nfInt32 nResult = deflateInit2(&m_pStream, m_nCompressionLevel, Z_DEFLATED, -15, 8, Z_DEFAULT_STRATEGY);
 		if (nResult < 0)
 			throw CNMRException(NMR_ERROR_DEFLATEINITFAILED);
 
@@ -103,17 +167,32 @@ namespace NMR {
 
 	nfUint64 CExportStream_ZIP::getPosition()
 	{
-		return m_pZIPWriter->getCurrentSize(m_nEntryKey);
+		return m_pZIPWriter->getCurrentSize(m_nEntryKey) + m_nBlockBufferSize;
 	}
 
 	nfUint64 CExportStream_ZIP::writeBuffer(_In_ const void * pBuffer, _In_ nfUint64 cbTotalBytesToWrite)
 	{
-		if (!m_bIsInitialized)
+		if (!m_bIsInitialized || m_bIsPassthrough)
 			throw CNMRException(NMR_ERROR_ZIPALREADYFINISHED);
 
 		nfUint64 cbCount = cbTotalBytesToWrite;
 		const nfByte * pByte = (const nfByte *)pBuffer;
 
+		if (m_pThreadPool) {
+			while (cbCount > 0) {
+				size_t cbToCopy = (size_t) std::min(cbCount, (nfUint64)(m_BlockBuffer.size() - m_nBlockBufferSize));
+				memcpy(m_BlockBuffer.data() + m_nBlockBufferSize, pByte, cbToCopy);
+				m_nBlockBufferSize += cbToCopy;
+				pByte += cbToCopy;
+				cbCount -= cbToCopy;
+
+				if (m_nBlockBufferSize == m_BlockBuffer.size())
+					compressBlocks(false);
+			}
+
+			return cbTotalBytesToWrite;
+		}
+
 		while (cbCount > 0) {
 			nfUint32 cbBytesWritten;
 			if (cbCount < ZIPEXPORTWRITECHUNKSIZE)
@@ -121,6 +200,8 @@ namespace NMR {
 			else
 				cbBytesWritten = writeChunk(pByte, ZIPEXPORTWRITECHUNKSIZE);
 
+			pByte += cbBytesWritten;
+
 			if (cbBytesWritten == 0)
 				throw CNMRException(NMR_ERROR_COULDNOTDEFLATE);
 
@@ -140,6 +221,11 @@ namespace NMR {
 
 		m_pZIPWriter->calculateChecksum(m_nEntryKey, pData, cbCount);
 
+		if (m_nCompressionLevel == ZIPCOMPRESSIONLEVEL_STORED) {
+			m_pZIPWriter->writeDeflatedBuffer(m_nEntryKey, pData, cbCount);
+			return cbCount;
+		}
+
 		while (m_pStream.avail_in > 0) {
 			nfInt32 nResult = deflate(&m_pStream, 0);
 			if (nResult < 0)
@@ -163,6 +249,25 @@ namespace NMR {
 		if (!m_bIsInitialized)
 			throw CNMRException(NMR_ERROR_ZIPALREADYFINISHED);
 
+		if (m_pThreadPool) {
+			m_bIsInitialized = false;
+			if (!m_bIsPassthrough)
+				compressBlocks(true);
+			return;
+		}
+
+		if (m_nCompressionLevel == ZIPCOMPRESSIONLEVEL_STORED) {
+			m_bIsInitialized = false;
+			return;
+		}
+
+		// The deflated data that has been passed through is already terminated
+		if (m_bIsPassthrough) {
+			deflateEnd(&m_pStream);
+			m_bIsInitialized = false;
+			return;
+		}
+
 		m_pStream.next_in = nullptr;
 		m_pStream.avail_in = 0;
 
@@ -190,6 +295,85 @@ namespace NMR {
 		m_bIsInitialized = false;
 	}
 
+	void CExportStream_ZIP::compressBlocks(_In_ nfBool bFinal)
+	{
+		nfUint32 nBlockCount = (nfUint32)((m_nBlockBufferSize + ZIPEXPORTBLOCKSIZE - 1) / ZIPEXPORTBLOCKSIZE);
+		if (nBlockCount == 0) {
+			if (!bFinal)
+				return;
+			// The final block terminates the deflate stream, even if it is empty
+			nBlockCount = 1;
+		}
+
+		std::vector<std::vector<nfByte>> CompressedBlocks(nBlockCount);
+		std::vector<nfUint32> Checksums(nBlockCount);
+
+		m_pThreadPool->runTasks(nBlockCount, [&](nfUint32 nBlock) {
+			size_t nOffset = (size_t)nBlock * ZIPEXPORTBLOCKSIZE;
+			nfUint32 cbBlock = (nfUint32)std::min((size_t)ZIPEXPORTBLOCKSIZE, m_nBlockBufferSize - nOffset);
+			const nfByte * pBlock = m_BlockBuffer.data() + nOffset;
+
+			const nfByte * pDictionary = m_Dictionary.data();
+			nfUint32 cbDictionary = (nfUint32)m_Dictionary.size();
+			if (nBlock > 0) {
+				pDictionary = pBlock - ZIPEXPORTDICTIONARYSIZE;
+				cbDictionary = ZIPEXPORTDICTIONARYSIZE;
+			}
+
+			fnDeflateBlock(pBlock, cbBlock, pDictionary, cbDictionary, m_nCompressionLevel,
+				bFinal && (nBlock + 1 == nBlockCount), CompressedBlocks[nBlock]);
+			Checksums[nBlock] = (nfUint32)crc32(0, pBlock, cbBlock);
+		});
+
+		for (nfUint32 nBlock = 0; nBlock < nBlockCount; nBlock++) {
+			size_t nOffset = (size_t)nBlock * ZIPEXPORTBLOCKSIZE;
+			nfUint32 cbBlock = (nfUint32)std::min((size_t)ZIPEXPORTBLOCKSIZE, m_nBlockBufferSize - nOffset);
+			m_pZIPWriter->combineChecksum(m_nEntryKey, Checksums[nBlock], cbBlock);
+
+			std::vector<nfByte> & CompressedBlock = CompressedBlocks[nBlock];
+			if (!CompressedBlock.empty())
+				m_pZIPWriter->writeDeflatedBuffer(m_nEntryKey, CompressedBlock.data(), (nfUint32)CompressedBlock.size());
+		}
+
+		// Keep the end of this batch as dictionary for the next one
+		size_t cbKeep = std::min(m_nBlockBufferSize, (size_t)ZIPEXPORTDICTIONARYSIZE);
+		size_t cbOld = std::min(m_Dictionary.size(), (size_t)ZIPEXPORTDICTIONARYSIZE - cbKeep);
+		m_Dictionary.erase(m_Dictionary.begin(), m_Dictionary.end() - cbOld);
+		m_Dictionary.insert(m_Dictionary.end(), m_BlockBuffer.data() + m_nBlockBufferSize - cbKeep, m_BlockBuffer.data() + m_nBlockBufferSize);
+
+		m_nBlockBufferSize = 0;
+	}
+
+	void CExportStream_ZIP::copyFrom(_In_ CImportStream * pImportStream, _In_ nfUint64 cbCount, _In_ nfUint32 cbBufferSize)
+	{
+		if (copyDeflatedFrom(pImportStream, cbCount)) {
+			close();
+			return;
+		}
+
+		CExportStream::copyFrom(pImportStream, cbCount, cbBufferSize);
+	}
+
+	nfBool CExportStream_ZIP::copyDeflatedFrom(_In_ CImportStream * pImportStream, _In_ nfUint64 cbCount)
+	{
+		// Streams that are still deflated are written as is, if the whole stream goes into an empty entry
+		CImportStream_Deflated * pDeflatedStream = dynamic_cast<CImportStream_Deflated *> (pImportStream);
+		if (pDeflatedStream == nullptr)
+			return false;
+		if (!m_bIsInitialized || m_bIsPassthrough || (m_nCompressionLevel == ZIPCOMPRESSIONLEVEL_STORED))
+			return false;
+		if ((getPosition() != 0) || (pDeflatedStream->getPosition() != 0))
+			return false;
+		if (cbCount != pDeflatedStream->retrieveSize())
+			return false;
+
+		const std::vector<nfByte> & DeflatedData = pDeflatedStream->getDeflatedData();
+		m_pZIPWriter->writeDeflatedEntry(m_nEntryKey, DeflatedData.data(), DeflatedData.size(), pDeflatedStream->getCRC32(), cbCount);
+
+		m_bIsPassthrough = true;
+		return true;
+	}
+
 	void CExportStream_ZIP::flushZIPStream()
 	{
 		finishDeflate();
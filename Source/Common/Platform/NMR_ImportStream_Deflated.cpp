@@ -0,0 +1,326 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ImportStream_Deflated.cpp implements the CImportStream_Deflated Class.
+This is a memory stream, which keeps the deflated data of a ZIP entry and inflates it
+while it is read.
+
+While inflating, a checkpoint with the deflate history window is recorded about every
+megabyte at a block boundary, so that a seek only inflates the data behind the closest
+checkpoint (see zran.c in the zlib examples).
+
+--*/
+#include "Common/Platform/NMR_ImportStream_Deflated.h"
+#include "Common/Platform/NMR_ImportStream_Unique_Memory.h"
+#include "Common/NMR_Exception.h"
+#include "Common/NMR_Exception_Windows.h"
+
+#include <algorithm>
+#include <cstring>
+
+// zlib counts in 32 bit, so larger data is handed over in several chunks
+#define IMPORTSTREAM_DEFLATED_MAXCHUNKSIZE (1024 * 1024 * 1024)
+
+namespace NMR {
+
+	CImportStream_Deflated::CImportStream_Deflated(_In_ PDeflatedData pDeflatedData, _In_ nfUint64 cbUncompressedSize, _In_ nfUint32 nCRC32)
+	{
+		if (pDeflatedData.get() == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		if (cbUncompressedSize > NMR_IMPORTSTREAM_MAXMEMSTREAMSIZE)
+			throw CNMRException(NMR_ERROR_INVALIDBUFFERSIZE);
+
+		m_pDeflatedData = pDeflatedData;
+		m_cbUncompressedSize = cbUncompressedSize;
+		m_nCRC32 = nCRC32;
+
+		memset(&m_InflateStream, 0, sizeof(m_InflateStream));
+		m_bIsInflating = false;
+		m_nPosition = 0;
+		m_nInputPosition = 0;
+		m_nWindowPosition = 0;
+		m_nRunningCRC32 = (nfUint32)crc32(0, nullptr, 0);
+		m_cbChecked = 0;
+	}
+
+	CImportStream_Deflated::~CImportStream_Deflated()
+	{
+		if (m_bIsInflating)
+			(void)inflateEnd(&m_InflateStream);
+		m_bIsInflating = false;
+	}
+
+	void CImportStream_Deflated::startInflating()
+	{
+		memset(&m_InflateStream, 0, sizeof(m_InflateStream));
+		m_InflateStream.zalloc = Z_NULL;
+		m_InflateStream.zfree = Z_NULL;
+		m_InflateStream.opaque = Z_NULL;
+		if (inflateInit2(&m_InflateStream, -MAX_WBITS) != Z_OK)
+			throw CNMRException(NMR_ERROR_COULDNOTINITINFLATE);
+		m_bIsInflating = true;
+
+		m_Window.resize(IMPORTSTREAM_DEFLATED_WINDOWSIZE);
+		m_nWindowPosition = 0;
+		m_nInputPosition = 0;
+		m_nPosition = 0;
+
+		// The start of the data is always a checkpoint
+		addCheckpoint(0);
+	}
+
+	void CImportStream_Deflated::addCheckpoint(_In_ nfInt32 nBits)
+	{
+		IMPORTSTREAMDEFLATEDCHECKPOINT Checkpoint;
+		Checkpoint.m_nUncompressedPosition = m_nPosition;
+		Checkpoint.m_nCompressedPosition = m_nInputPosition - m_InflateStream.avail_in;
+		Checkpoint.m_nBits = nBits;
+
+		// The window is a ring buffer, which ends at the write position once it has been filled
+		if (m_nPosition >= IMPORTSTREAM_DEFLATED_WINDOWSIZE) {
+			Checkpoint.m_Window.assign(m_Window.begin() + m_nWindowPosition, m_Window.end());
+			Checkpoint.m_Window.insert(Checkpoint.m_Window.end(), m_Window.begin(), m_Window.begin() + m_nWindowPosition);
+		}
+		else
+			Checkpoint.m_Window.assign(m_Window.begin(), m_Window.begin() + m_nWindowPosition);
+
+		m_Checkpoints.push_back(std::move(Checkpoint));
+	}
+
+	void CImportStream_Deflated::restoreCheckpoint(_In_ const IMPORTSTREAMDEFLATEDCHECKPOINT & Checkpoint)
+	{
+		if (inflateReset(&m_InflateStream) != Z_OK)
+			throw CNMRException(NMR_ERROR_COULDNOTINITINFLATE);
+		m_InflateStream.next_in = Z_NULL;
+		m_InflateStream.avail_in = 0;
+		m_nInputPosition = Checkpoint.m_nCompressedPosition;
+
+		// A block may start within a byte, whose remaining bits are primed into the inflater
+		if (Checkpoint.m_nBits > 0) {
+			nfByte nByte = (*m_pDeflatedData)[(size_t)(Checkpoint.m_nCompressedPosition - 1)];
+			if (inflatePrime(&m_InflateStream, Checkpoint.m_nBits, nByte >> (8 - Checkpoint.m_nBits)) != Z_OK)
+				throw CNMRException(NMR_ERROR_COULDNOTINFLATE);
+		}
+
+		if (!Checkpoint.m_Window.empty()) {
+			if (inflateSetDictionary(&m_InflateStream, Checkpoint.m_Window.data(), (uInt)Checkpoint.m_Window.size()) != Z_OK)
+				throw CNMRException(NMR_ERROR_COULDNOTINFLATE);
+		}
+
+		std::copy(Checkpoint.m_Window.begin(), Checkpoint.m_Window.end(), m_Window.begin());
+		m_nWindowPosition = (nfUint32)Checkpoint.m_Window.size();
+		m_nPosition = Checkpoint.m_nUncompressedPosition;
+	}
+
+	void CImportStream_Deflated::updateChecksum(_In_ const nfByte * pData, _In_ nfUint32 cbData)
+	{
+		// pData starts at m_nPosition. Only data behind everything inflated so far is new.
+		if ((m_nPosition > m_cbChecked) || (m_nPosition + cbData <= m_cbChecked))
+			return;
+
+		nfUint32 cbKnown = (nfUint32)(m_cbChecked - m_nPosition);
+		m_nRunningCRC32 = (nfUint32)crc32(m_nRunningCRC32, pData + cbKnown, cbData - cbKnown);
+		m_cbChecked = m_nPosition + cbData;
+
+		// The checksum is verified, as libZIP would have done while reading the entry
+		if ((m_cbChecked == m_cbUncompressedSize) && (m_nRunningCRC32 != m_nCRC32))
+			throw CNMRException(NMR_ERROR_COULDNOTREADSTREAM);
+	}
+
+	nfUint64 CImportStream_Deflated::inflateData(_Out_opt_ nfByte * pBuffer, _In_ nfUint64 cbBytes)
+	{
+		if (!m_bIsInflating)
+			startInflating();
+
+		if (cbBytes > m_cbUncompressedSize - m_nPosition)
+			cbBytes = m_cbUncompressedSize - m_nPosition;
+
+		nfUint64 cbInflatedBytes = 0;
+		while (cbInflatedBytes < cbBytes) {
+			if (m_InflateStream.avail_in == 0) {
+				// The deflated data ends before the size of the entry is reached
+				if (m_nInputPosition >= m_pDeflatedData->size())
+					throw CNMRException(NMR_ERROR_COULDNOTINFLATE);
+				m_InflateStream.next_in = (Bytef *)m_pDeflatedData->data() + m_nInputPosition;
+				m_InflateStream.avail_in = (uInt)std::min((nfUint64)m_pDeflatedData->size() - m_nInputPosition, (nfUint64)IMPORTSTREAM_DEFLATED_MAXCHUNKSIZE);
+				m_nInputPosition += m_InflateStream.avail_in;
+			}
+
+			// Inflate into the window, so that it always holds the history of the next block
+			if (m_nWindowPosition == IMPORTSTREAM_DEFLATED_WINDOWSIZE)
+				m_nWindowPosition = 0;
+			nfUint64 cbOutput = std::min((nfUint64)(IMPORTSTREAM_DEFLATED_WINDOWSIZE - m_nWindowPosition), cbBytes - cbInflatedBytes);
+			m_InflateStream.next_out = &m_Window[m_nWindowPosition];
+			m_InflateStream.avail_out = (uInt)cbOutput;
+			uInt cbInputBefore = m_InflateStream.avail_in;
+
+			nfInt32 nResult = inflate(&m_InflateStream, Z_BLOCK);
+			if ((nResult != Z_OK) && (nResult != Z_STREAM_END) && (nResult != Z_BUF_ERROR))
+				throw CNMRException(NMR_ERROR_COULDNOTINFLATE);
+
+			nfUint32 cbProduced = (nfUint32)(cbOutput - m_InflateStream.avail_out);
+			if ((cbProduced == 0) && (m_InflateStream.avail_in == cbInputBefore) && (cbInputBefore > 0))
+				throw CNMRException(NMR_ERROR_COULDNOTINFLATE);
+
+			updateChecksum(&m_Window[m_nWindowPosition], cbProduced);
+			if (pBuffer != nullptr)
+				memcpy(pBuffer + cbInflatedBytes, &m_Window[m_nWindowPosition], cbProduced);
+			m_nWindowPosition += cbProduced;
+			m_nPosition += cbProduced;
+			cbInflatedBytes += cbProduced;
+
+			if (nResult == Z_STREAM_END) {
+				if (m_nPosition != m_cbUncompressedSize)
+					throw CNMRException(NMR_ERROR_COULDNOTINFLATE);
+				break;
+			}
+
+			// Checkpoints are set at block boundaries, but not behind the last block
+			nfBool bIsBlockBoundary = ((m_InflateStream.data_type & 128) != 0) && ((m_InflateStream.data_type & 64) == 0);
+			if (bIsBlockBoundary && (m_nPosition >= m_Checkpoints.back().m_nUncompressedPosition + IMPORTSTREAM_DEFLATED_CHECKPOINTSPAN))
+				addCheckpoint(m_InflateStream.data_type & 7);
+		}
+
+		return cbInflatedBytes;
+	}
+
+	nfBool CImportStream_Deflated::seekPosition(_In_ nfUint64 position, _In_ nfBool bHasToSucceed)
+	{
+		if (position > m_cbUncompressedSize) {
+			if (bHasToSucceed)
+				throw CNMRException(NMR_ERROR_COULDNOTSEEKSTREAM);
+			return false;
+		}
+
+		// Rewinding a stream that has not been inflated yet does not need its data
+		if (!m_bIsInflating) {
+			if (position == 0)
+				return true;
+			startInflating();
+		}
+
+		// Continue from the closest checkpoint, unless the current position is closer
+		auto iCheckpoint = std::upper_bound(m_Checkpoints.begin(), m_Checkpoints.end(), position,
+			[](nfUint64 nPosition, const IMPORTSTREAMDEFLATEDCHECKPOINT & Checkpoint) { return nPosition < Checkpoint.m_nUncompressedPosition; });
+		__NMRASSERT(iCheckpoint != m_Checkpoints.begin());
+		iCheckpoint--;
+		if ((position < m_nPosition) || (iCheckpoint->m_nUncompressedPosition > m_nPosition))
+			restoreCheckpoint(*iCheckpoint);
+
+		inflateData(nullptr, position - m_nPosition);
+		return true;
+	}
+
+	nfBool CImportStream_Deflated::seekForward(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed)
+	{
+		if (bytes > m_cbUncompressedSize - m_nPosition) {
+			if (bHasToSucceed)
+				throw CNMRException(NMR_ERROR_COULDNOTSEEKSTREAM);
+			return false;
+		}
+
+		return seekPosition(m_nPosition + bytes, bHasToSucceed);
+	}
+
+	nfBool CImportStream_Deflated::seekFromEnd(_In_ nfUint64 bytes, _In_ nfBool bHasToSucceed)
+	{
+		if (bytes > m_cbUncompressedSize) {
+			if (bHasToSucceed)
+				throw CNMRException(NMR_ERROR_COULDNOTSEEKSTREAM);
+			return false;
+		}
+
+		return seekPosition(m_cbUncompressedSize - bytes, bHasToSucceed);
+	}
+
+	nfUint64 CImportStream_Deflated::readIntoBuffer(_In_ nfByte * pBuffer, _In_ nfUint64 cbTotalBytesToRead, nfBool bNeedsToReadAll)
+	{
+		if ((pBuffer == nullptr) && (cbTotalBytesToRead > 0))
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		nfUint64 cbBytesRead = inflateData(pBuffer, cbTotalBytesToRead);
+		if ((cbBytesRead != cbTotalBytesToRead) && bNeedsToReadAll)
+			throw CNMRException(NMR_ERROR_COULDNOTREADFULLDATA);
+
+		return cbBytesRead;
+	}
+
+	nfUint64 CImportStream_Deflated::retrieveSize()
+	{
+		return m_cbUncompressedSize;
+	}
+
+	void CImportStream_Deflated::writeToFile(_In_ const nfWChar * pwszFileName)
+	{
+		nfUint64 nPosition = m_nPosition;
+		seekPosition(0, true);
+		CImportStream_Unique_Memory InflatedStream(this, m_cbUncompressedSize, true);
+		seekPosition(nPosition, true);
+
+		InflatedStream.writeToFile(pwszFileName);
+	}
+
+	PImportStream CImportStream_Deflated::copyToMemory()
+	{
+		// A copy of the whole stream shares the deflated data and stays deflated
+		if (m_nPosition == 0)
+			return std::make_shared<CImportStream_Deflated>(m_pDeflatedData, m_cbUncompressedSize, m_nCRC32);
+
+		return std::make_shared<CImportStream_Unique_Memory>(this, m_cbUncompressedSize - m_nPosition, true);
+	}
+
+	nfUint64 CImportStream_Deflated::getPosition()
+	{
+		return m_nPosition;
+	}
+
+	const std::vector<nfByte> & CImportStream_Deflated::getDeflatedData()
+	{
+		return *m_pDeflatedData;
+	}
+
+	nfUint32 CImportStream_Deflated::getCRC32()
+	{
+		return m_nCRC32;
+	}
+
+	nfUint32 CImportStream_Deflated::getCheckpointCount()
+	{
+		return (nfUint32)m_Checkpoints.size();
+	}
+
+	nfUint64 CImportStream_Deflated::getCheckpointPosition(_In_ nfUint32 nIndex)
+	{
+		if (nIndex >= m_Checkpoints.size())
+			throw CNMRException(NMR_ERROR_INVALIDINDEX);
+
+		return m_Checkpoints[nIndex].m_nUncompressedPosition;
+	}
+
+}
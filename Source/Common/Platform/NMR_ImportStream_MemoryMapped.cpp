@@ -0,0 +1,203 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ImportStream_MemoryMapped.cpp implements the CImportStream_MemoryMapped Class.
+This is a memory stream on a read-only mapping of a file. Views created while reading share
+the mapping, which is released together with the last stream referencing it. Copies of the
+stream are held in memory, so that they do not refer to the file anymore.
+On POSIX systems, the file stays open to check its size before the mapping is read.
+
+--*/
+
+#include "Common/Platform/NMR_ImportStream_MemoryMapped.h"
+#include "Common/Platform/NMR_ImportStream_Unique_Memory.h"
+#include "Common/NMR_Exception.h"
+#include "Common/NMR_StringUtils.h"
+
+#include <cstdint>
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace NMR {
+
+	CMemoryMappedFile::CMemoryMappedFile(_In_ const nfWChar * pwszFileName)
+		: m_pData(nullptr), m_cbSize(0)
+#ifndef _WIN32
+		, m_nFileDescriptor(-1)
+#endif
+	{
+		if (pwszFileName == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+#ifdef _WIN32
+		HANDLE hFile = CreateFileW(pwszFileName, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+		if (hFile == INVALID_HANDLE_VALUE)
+			throw CNMRException(NMR_ERROR_COULDNOTOPENFILE);
+
+		LARGE_INTEGER nFileSize;
+		if ((GetFileType(hFile) != FILE_TYPE_DISK) || !GetFileSizeEx(hFile, &nFileSize) ||
+			((nfUint64)nFileSize.QuadPart > (nfUint64)SIZE_MAX) || ((nfUint64)nFileSize.QuadPart > NMR_IMPORTSTREAM_MAXMEMSTREAMSIZE)) {
+			CloseHandle(hFile);
+			throw CNMRException(NMR_ERROR_COULDNOTMAPFILE);
+		}
+		m_cbSize = (nfUint64)nFileSize.QuadPart;
+
+		// Empty files can not be mapped and do not need to be
+		if (m_cbSize > 0) {
+			HANDLE hMapping = CreateFileMappingW(hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+			if (hMapping != nullptr) {
+				m_pData = (const nfByte *)MapViewOfFile(hMapping, FILE_MAP_READ, 0, 0, 0);
+				CloseHandle(hMapping);
+			}
+		}
+		CloseHandle(hFile);
+#else
+		std::string sUTF8Name = fnUTF16toUTF8(pwszFileName);
+		int nFileDescriptor = open(sUTF8Name.c_str(), O_RDONLY);
+		if (nFileDescriptor < 0)
+			throw CNMRException(NMR_ERROR_COULDNOTOPENFILE);
+
+		struct stat FileStat;
+		if ((fstat(nFileDescriptor, &FileStat) != 0) || !S_ISREG(FileStat.st_mode) ||
+			((nfUint64)FileStat.st_size > (nfUint64)SIZE_MAX) || ((nfUint64)FileStat.st_size > NMR_IMPORTSTREAM_MAXMEMSTREAMSIZE)) {
+			close(nFileDescriptor);
+			throw CNMRException(NMR_ERROR_COULDNOTMAPFILE);
+		}
+		m_cbSize = (nfUint64)FileStat.st_size;
+
+		// Empty files can not be mapped and do not need to be
+		if (m_cbSize > 0) {
+			void * pMapping = mmap(nullptr, (size_t)m_cbSize, PROT_READ, MAP_PRIVATE, nFileDescriptor, 0);
+			if (pMapping != MAP_FAILED)
+				m_pData = (const nfByte *)pMapping;
+		}
+
+		if ((m_cbSize > 0) && (m_pData == nullptr)) {
+			close(nFileDescriptor);
+			throw CNMRException(NMR_ERROR_COULDNOTMAPFILE);
+		}
+		m_nFileDescriptor = nFileDescriptor;
+#endif
+
+		if ((m_cbSize > 0) && (m_pData == nullptr))
+			throw CNMRException(NMR_ERROR_COULDNOTMAPFILE);
+	}
+
+	CMemoryMappedFile::~CMemoryMappedFile()
+	{
+		if (m_pData != nullptr) {
+#ifdef _WIN32
+			UnmapViewOfFile(m_pData);
+#else
+			munmap((void *)m_pData, (size_t)m_cbSize);
+#endif
+			m_pData = nullptr;
+		}
+
+#ifndef _WIN32
+		if (m_nFileDescriptor >= 0)
+			close(m_nFileDescriptor);
+		m_nFileDescriptor = -1;
+#endif
+	}
+
+	const nfByte * CMemoryMappedFile::getData()
+	{
+		return m_pData;
+	}
+
+	nfUint64 CMemoryMappedFile::getSize()
+	{
+		return m_cbSize;
+	}
+
+	void CMemoryMappedFile::checkSize()
+	{
+#ifndef _WIN32
+		struct stat FileStat;
+		if ((fstat(m_nFileDescriptor, &FileStat) != 0) || ((nfUint64)FileStat.st_size < m_cbSize))
+			throw CNMRException(NMR_ERROR_MAPPEDFILETRUNCATED);
+#endif
+	}
+
+	CImportStream_MemoryMapped::CImportStream_MemoryMapped(_In_ const nfWChar * pwszFileName)
+	{
+		m_pFile = std::make_shared<CMemoryMappedFile>(pwszFileName);
+		m_pData = m_pFile->getData();
+		m_cbSize = m_pFile->getSize();
+		m_nPosition = 0;
+	}
+
+	CImportStream_MemoryMapped::CImportStream_MemoryMapped(_In_ PMemoryMappedFile pFile, _In_ nfUint64 nOffset, _In_ nfUint64 cbSize)
+	{
+		if (!pFile)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		if ((nOffset > pFile->getSize()) || (cbSize > pFile->getSize() - nOffset))
+			throw CNMRException(NMR_ERROR_INVALIDBUFFERSIZE);
+
+		m_pFile = pFile;
+		m_pData = pFile->getData() + nOffset;
+		m_cbSize = cbSize;
+		m_nPosition = 0;
+	}
+
+	PImportStream CImportStream_MemoryMapped::copyToMemory()
+	{
+		__NMRASSERT(m_nPosition <= m_cbSize);
+
+		return std::make_shared<CImportStream_Unique_Memory>(this, m_cbSize - m_nPosition, true);
+	}
+
+	PImportStream CImportStream_MemoryMapped::createView(_In_ nfUint64 nOffset, _In_ nfUint64 cbSize)
+	{
+		if ((nOffset > m_cbSize) || (cbSize > m_cbSize - nOffset))
+			throw CNMRException(NMR_ERROR_INVALIDBUFFERSIZE);
+
+		return std::make_shared<CImportStream_MemoryMapped>(m_pFile, (nfUint64)(m_pData - m_pFile->getData()) + nOffset, cbSize);
+	}
+
+	const nfByte * CImportStream_MemoryMapped::getData()
+	{
+		m_pFile->checkSize();
+		return m_pData;
+	}
+
+	__NMR_INLINE const nfByte * CImportStream_MemoryMapped::getAt(nfUint64 nPosition) {
+		m_pFile->checkSize();
+		return m_pData + nPosition;
+	}
+
+}
@@ -33,20 +33,26 @@ This is a stream class for importing from a libZIP object.
 
 #include "Common/Platform/NMR_ImportStream_ZIP.h"
 #include "Common/Platform/NMR_ImportStream_Unique_Memory.h"
+#include "Common/Platform/NMR_ImportStream_Deflated.h"
 #include "Common/NMR_Exception.h"
 #include "Common/NMR_Exception_Windows.h"
+#include <algorithm>
 #include <cmath>
 #include <vector>
 
 namespace NMR {
 
-	CImportStream_ZIP::CImportStream_ZIP(_In_ zip_file_t * pFile, _In_ nfUint64 nSize)
+	CImportStream_ZIP::CImportStream_ZIP(_In_ zip_file_t * pFile, _In_ nfUint64 nSize, _In_ zip_t * pArchive, _In_ nfUint64 nIndex)
 	{
-		if (pFile == nullptr)
+		if ((pFile == nullptr) || (pArchive == nullptr))
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
 		m_pFile = pFile;
 		m_nSize = nSize;
+		m_nPosition = 0;
+
+		m_pArchive = pArchive;
+		m_nIndex = nIndex;
 	}
 
 	CImportStream_ZIP::~CImportStream_ZIP()
@@ -73,7 +79,7 @@ namespace NMR {
 	}
 
 	nfUint64 CImportStream_ZIP::getPosition() {
-		throw CNMRException(NMR_ERROR_COULDNOTSEEKINZIP);
+		return m_nPosition;
 	}
 
 	nfUint64 CImportStream_ZIP::readIntoBuffer(_In_ nfByte * pBuffer, _In_ nfUint64 cbTotalBytesToRead, nfBool bNeedsToReadAll)
@@ -94,6 +100,7 @@ namespace NMR {
 			if (nfSize < 0)
 				throw CNMRException(NMR_ERROR_COULDNOTREADSTREAM);
 			cbBytesRead += nfSize;
+			m_nPosition += nfSize;
 
 			if (nfSize != (nfInt64)cbBytesToRead)
 				break;
@@ -124,10 +131,51 @@ namespace NMR {
 
 	PImportStream CImportStream_ZIP::copyToMemory()
 	{
-		nfUint64 cbStreamSize = retrieveSize();
+		nfUint64 cbStreamSize = retrieveSize() - m_nPosition;
 
 		return std::make_shared<CImportStream_Unique_Memory>(this, cbStreamSize, false);
 	}
 
+	PImportStream CImportStream_ZIP::copyDeflatedToMemory()
+	{
+		if (m_nPosition != 0)
+			return copyToMemory();
+
+		zip_stat_t Stat;
+		if (zip_stat_index(m_pArchive, m_nIndex, ZIP_FL_UNCHANGED, &Stat) != 0)
+			throw CNMRException(NMR_ERROR_COULDNOTSTATZIPENTRY);
+
+		nfUint64 nRequiredFields = ZIP_STAT_COMP_METHOD | ZIP_STAT_COMP_SIZE | ZIP_STAT_SIZE | ZIP_STAT_CRC;
+		if (((Stat.valid & nRequiredFields) != nRequiredFields) || (Stat.comp_method != ZIP_CM_DEFLATE) || (Stat.size != m_nSize))
+			return copyToMemory();
+		if ((Stat.size > NMR_IMPORTSTREAM_MAXMEMSTREAMSIZE) || (Stat.comp_size > NMR_IMPORTSTREAM_MAXMEMSTREAMSIZE))
+			throw CNMRException(NMR_ERROR_INVALIDBUFFERSIZE);
+
+		std::shared_ptr<std::vector<nfByte>> pDeflatedData = std::make_shared<std::vector<nfByte>>();
+		try {
+			pDeflatedData->resize((size_t)Stat.comp_size);
+		}
+		catch (std::bad_alloc&) {
+			throw CNMRException(NMR_ERROR_INVALIDBUFFERSIZE);
+		}
+
+		zip_file_t * pCompressedFile = zip_fopen_index(m_pArchive, m_nIndex, ZIP_FL_COMPRESSED | ZIP_FL_UNCHANGED);
+		if (pCompressedFile == nullptr)
+			throw CNMRException(NMR_ERROR_COULDNOTOPENZIPENTRY);
+
+		nfUint64 cbRead = 0;
+		while (cbRead < Stat.comp_size) {
+			nfUint64 cbChunk = std::min(Stat.comp_size - cbRead, (nfUint64)IMPORTSTREAM_ZIP_CHUNKSIZE);
+			zip_int64_t nResult = zip_fread(pCompressedFile, pDeflatedData->data() + cbRead, cbChunk);
+			if (nResult <= 0) {
+				zip_fclose(pCompressedFile);
+				throw CNMRException(NMR_ERROR_COULDNOTREADZIPFILE);
+			}
+			cbRead += nResult;
+		}
+		zip_fclose(pCompressedFile);
+
+		return std::make_shared<CImportStream_Deflated>(pDeflatedData, Stat.size, Stat.crc);
+	}
 
 }
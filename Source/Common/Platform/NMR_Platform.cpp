@@ -38,6 +38,7 @@ specific classes.
 #define NMR_PLATFORM_XMLREADER_BUFFERSIZE 65536
 
 #include "Common/Platform/NMR_ImportStream_Native.h"
+#include "Common/Platform/NMR_ImportStream_MemoryMapped.h"
 #include "Common/Platform/NMR_ExportStream_Native.h"
 #include "Common/Platform/NMR_XmlReader_Native.h"
 #include "Common/NMR_StringUtils.h"
@@ -51,6 +52,20 @@ namespace NMR {
 		return std::make_shared<CImportStream_Native> (sFileName.c_str());
 	}
 
+	PImportStream fnCreateMappedImportStreamInstance (_In_ const nfChar * pszFileName)
+	{
+		std::wstring sFileName = fnUTF8toUTF16(pszFileName);
+		try {
+			return std::make_shared<CImportStream_MemoryMapped> (sFileName.c_str());
+		}
+		catch (CNMRException & e) {
+			// e.g. pipes or devices
+			if (e.getErrorCode() != NMR_ERROR_COULDNOTMAPFILE)
+				throw;
+		}
+		return std::make_shared<CImportStream_Native> (sFileName.c_str());
+	}
+
 	PExportStream fnCreateExportStreamInstance (_In_ const nfChar * pszFileName)
 	{
 		std::wstring sFileName = fnUTF8toUTF16(pszFileName);
@@ -37,7 +37,7 @@ NMR_PortableZIPWriter.cpp implements a portable and fast writer of ZIP files
 
 namespace NMR {
 
-	CPortableZIPWriter::CPortableZIPWriter(_In_ PExportStream pExportStream, _In_ nfBool bWriteZIP64)
+	CPortableZIPWriter::CPortableZIPWriter(_In_ PExportStream pExportStream, _In_ nfBool bWriteZIP64, _In_ PThreadPool pThreadPool)
 	{
 		if (pExportStream.get() == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
@@ -48,6 +48,7 @@ namespace NMR {
 		m_pCurrentEntry = nullptr;
 		m_bIsFinished = false;
 		m_bWriteZIP64 = bWriteZIP64;
+		m_pThreadPool = pThreadPool;
 
 		if (m_bWriteZIP64) {
 			m_nVersionMade = ZIPFILEVERSIONNEEDEDZIP64;
@@ -69,10 +70,15 @@ namespace NMR {
 			writeDirectory();
 	}
 
-	PExportStream CPortableZIPWriter::createEntry(_In_ const std::string sName, _In_ nfTimeStamp nUnixTimeStamp)
+	PExportStream CPortableZIPWriter::createEntry(_In_ const std::string sName, _In_ nfTimeStamp nUnixTimeStamp, _In_ nfInt32 nCompressionLevel)
 	{
 		if (m_bIsFinished)
 			throw CNMRException(NMR_ERROR_ZIPALREADYFINISHED);
+		if (nCompressionLevel == ZIPCOMPRESSIONLEVEL_UNSPECIFIED)
+			nCompressionLevel = ZIPCOMPRESSIONLEVEL_FASTEST;
+		if ((nCompressionLevel < ZIPCOMPRESSIONLEVEL_STORED) || (nCompressionLevel > ZIPCOMPRESSIONLEVEL_MAXIMUM))
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		nfUint16 nCompressionMethod = (nCompressionLevel == ZIPCOMPRESSIONLEVEL_STORED) ? ZIPFILECOMPRESSION_UNCOMPRESSED : ZIPFILECOMPRESSION_DEFLATED;
 		// Finish old entry state
 		closeEntry();
 
@@ -99,7 +105,7 @@ namespace NMR {
 		LocalHeader.m_nSignature = ZIPFILEHEADERSIGNATURE;
 		LocalHeader.m_nVersion = m_nVersionNeeded;
 		LocalHeader.m_nGeneralPurposeFlags = 0;
-		LocalHeader.m_nCompressionMethod = ZIPFILECOMPRESSION_DEFLATED;
+		LocalHeader.m_nCompressionMethod = nCompressionMethod;
 		LocalHeader.m_nLastModTime = nLastModTime;
 		LocalHeader.m_nLastModDate = nLastModDate;
 		LocalHeader.m_nCRC32 = 0;
@@ -139,11 +145,11 @@ namespace NMR {
 		nfUint64 nDataPosition = m_pExportStream->getPosition();
 
 		// create list entry
-		m_pCurrentEntry = std::make_shared<CPortableZIPWriterEntry>(sUTF8Name, nLastModTime, nLastModDate, nFilePosition, nExtInfoPosition, nDataPosition);
+		m_pCurrentEntry = std::make_shared<CPortableZIPWriterEntry>(sUTF8Name, nLastModTime, nLastModDate, nFilePosition, nExtInfoPosition, nDataPosition, nCompressionMethod);
 		m_Entries.push_back(m_pCurrentEntry);
 
 		// Return new ZIP Entry stream
-		m_pCurrentStream = std::make_shared<CExportStream_ZIP>(this, m_nCurrentEntryKey);
+		m_pCurrentStream = std::make_shared<CExportStream_ZIP>(this, m_nCurrentEntryKey, nCompressionLevel, m_pThreadPool);
 		return m_pCurrentStream;
 	}
 
@@ -226,6 +232,20 @@ namespace NMR {
 		}
 	}
 
+	void CPortableZIPWriter::combineChecksum(_In_ nfUint32 nEntryKey, _In_ nfUint32 nCRC32, _In_ nfUint32 cbUncompressedBytes)
+	{
+		if (m_pCurrentEntry.get() == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDZIPENTRY);
+
+		if (nEntryKey != m_nCurrentEntryKey)
+			throw CNMRException(NMR_ERROR_INVALIDZIPENTRYKEY);
+
+		if (cbUncompressedBytes > 0) {
+			m_pCurrentEntry->combineChecksum(nCRC32, cbUncompressedBytes);
+			m_pCurrentEntry->increaseUncompressedSize(cbUncompressedBytes);
+		}
+	}
+
 
 	void CPortableZIPWriter::writeDeflatedBuffer(_In_ nfUint32 nEntryKey, _In_ const void * pBuffer, _In_ nfUint32 cbCompressedBytes)
 	{
@@ -244,6 +264,26 @@ namespace NMR {
 		}
 	}
 
+	void CPortableZIPWriter::writeDeflatedEntry(_In_ nfUint32 nEntryKey, _In_ const void * pBuffer, _In_ nfUint64 cbCompressedBytes, _In_ nfUint32 nCRC32, _In_ nfUint64 cbUncompressedBytes)
+	{
+		if (m_pCurrentEntry.get() == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDZIPENTRY);
+
+		if ((pBuffer == nullptr) && (cbCompressedBytes > 0))
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		if (nEntryKey != m_nCurrentEntryKey)
+			throw CNMRException(NMR_ERROR_INVALIDZIPENTRYKEY);
+
+		if ((m_pCurrentEntry->getCompressionMethod() != ZIPFILECOMPRESSION_DEFLATED) ||
+			(m_pCurrentEntry->getCompressedSize() != 0) || (m_pCurrentEntry->getUncompressedSize() != 0))
+			throw CNMRException(NMR_ERROR_INVALIDZIPENTRY);
+
+		if (cbCompressedBytes > 0)
+			m_pExportStream->writeBuffer(pBuffer, cbCompressedBytes);
+		m_pCurrentEntry->setDeflatedContent(nCRC32, cbCompressedBytes, cbUncompressedBytes);
+	}
+
 	nfUint64 CPortableZIPWriter::getCurrentSize(_In_ nfUint32 nEntryKey)
 	{
 		if (m_pCurrentEntry.get() == nullptr)
@@ -271,7 +311,7 @@ namespace NMR {
 			DirectoryHeader.m_nVersionMade = m_nVersionMade;
 			DirectoryHeader.m_nVersionNeeded = m_nVersionNeeded;
 			DirectoryHeader.m_nGeneralPurposeFlags = 0;
-			DirectoryHeader.m_nCompressionMethod = ZIPFILECOMPRESSION_DEFLATED;
+			DirectoryHeader.m_nCompressionMethod = pEntry->getCompressionMethod();
 			DirectoryHeader.m_nLastModTime = pEntry->getLastModTime();
 			DirectoryHeader.m_nLastModDate = pEntry->getLastModDate();
 			DirectoryHeader.m_nCRC32 = pEntry->getCRC32();
@@ -38,7 +38,7 @@ NMR_PortableZIPWriterEntry.cpp implements a portable and fast writer of ZIP file
 
 namespace NMR {
 
-	CPortableZIPWriterEntry::CPortableZIPWriterEntry(_In_ const std::string sUTF8Name, _In_ nfUint16 nLastModTime, _In_ nfUint16 nLastModDate, _In_ nfUint64 nFilePosition, _In_ nfUint64 nExtInfoPosition, _In_ nfUint64 nDataPosition)
+	CPortableZIPWriterEntry::CPortableZIPWriterEntry(_In_ const std::string sUTF8Name, _In_ nfUint16 nLastModTime, _In_ nfUint16 nLastModDate, _In_ nfUint64 nFilePosition, _In_ nfUint64 nExtInfoPosition, _In_ nfUint64 nDataPosition, _In_ nfUint16 nCompressionMethod)
 	{
 		m_sUTF8Name = sUTF8Name;
 		m_nCRC32 = 0;
@@ -49,6 +49,7 @@ namespace NMR {
 		m_nFilePosition = nFilePosition;
 		m_nExtInfoPosition = nExtInfoPosition;
 		m_nDataPosition = nDataPosition;
+		m_nCompressionMethod = nCompressionMethod;
 	}
 
 	std::string CPortableZIPWriterEntry::getUTF8Name()
@@ -96,6 +97,11 @@ namespace NMR {
 		return m_nDataPosition;
 	}
 
+	nfUint16 CPortableZIPWriterEntry::getCompressionMethod()
+	{
+		return m_nCompressionMethod;
+	}
+
 	void CPortableZIPWriterEntry::increaseCompressedSize(_In_ nfUint32 nCompressedSize)
 	{
 		m_nCompressedSize += nCompressedSize;
@@ -111,4 +117,16 @@ namespace NMR {
 		m_nCRC32 = crc32(m_nCRC32, (Bytef*) pBuffer, cbCount);
 	}
 
+	void CPortableZIPWriterEntry::combineChecksum(_In_ nfUint32 nCRC32, _In_ nfUint32 cbCount)
+	{
+		m_nCRC32 = crc32_combine(m_nCRC32, nCRC32, cbCount);
+	}
+
+	void CPortableZIPWriterEntry::setDeflatedContent(_In_ nfUint32 nCRC32, _In_ nfUint64 nCompressedSize, _In_ nfUint64 nUncompressedSize)
+	{
+		m_nCRC32 = nCRC32;
+		m_nCompressedSize = nCompressedSize;
+		m_nUncompressedSize = nUncompressedSize;
+	}
+
 }
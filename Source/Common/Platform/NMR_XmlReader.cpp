@@ -46,4 +46,29 @@ namespace NMR {
 	{
 	}
 
+	nfBool CXmlReader::CanReadRaw()
+	{
+		return false;
+	}
+
+	nfUint32 CXmlReader::ReadRaw(_Out_ nfByte * pBuffer, _In_ nfUint32 cbBufferSize)
+	{
+		throw CNMRException(NMR_ERROR_NOTIMPLEMENTED);
+	}
+
+	void CXmlReader::UnreadRaw(_In_ const nfByte * pBuffer, _In_ nfUint32 cbBufferSize)
+	{
+		throw CNMRException(NMR_ERROR_NOTIMPLEMENTED);
+	}
+
+	nfUint64 CXmlReader::GetRawPosition()
+	{
+		throw CNMRException(NMR_ERROR_NOTIMPLEMENTED);
+	}
+
+	void CXmlReader::GetNamespaces(_Out_ std::map<std::string, std::string> & NameSpaces)
+	{
+		throw CNMRException(NMR_ERROR_NOTIMPLEMENTED);
+	}
+
 }
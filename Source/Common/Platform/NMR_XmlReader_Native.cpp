@@ -31,6 +31,7 @@ NMR_XMLReader_Native.cpp implements a XML reader class with a native XML parsing
 --*/
 
 #include "Common/Platform/NMR_XmlReader_Native.h" 
+#include "Common/Platform/NMR_XmlScan.h" 
 #include "Common/NMR_Exception.h" 
 #include "Common/NMR_StringUtils.h" 
 
@@ -41,11 +42,13 @@ NMR_XMLReader_Native.cpp implements a XML reader class with a native XML parsing
 namespace NMR {
 
 	inline void decodeXMLEscapeXMLStrings(nfChar* pChar) {
-		if (strpbrk(pChar, "&") == nullptr) {
+		// Everything in front of the first ampersand stays in place
+		nfChar *pFirstAmp = strchr(pChar, '&');
+		if (pFirstAmp == nullptr) {
 			return;
 		}
-		nfChar *pIterChar = pChar;
-		nfChar *pWriteChar = pChar;
+		nfChar *pIterChar = pFirstAmp;
+		nfChar *pWriteChar = pFirstAmp;
 
 		nfChar *pAmp = nullptr;
 		nfChar *pColon = nullptr;
@@ -125,7 +128,12 @@ namespace NMR {
 		m_CurrentEntityList.resize(cbBufferCapacity);
 		m_CurrentEntityTypes.resize(cbBufferCapacity);
 		m_CurrentEntityPrefixes.resize(cbBufferCapacity);
+		m_CurrentEntityEnds.resize(cbBufferCapacity);
+		m_nPendingRawDataOffset = 0;
 		m_ZeroInsertArray.resize(cbBufferCapacity);
+		m_nPreparedGroupCount = 0;
+		m_nPreparedEntityCount = 0;
+		m_nPreparedZeroInsertCount = 0;
 
 		m_pNextBuffer = &m_UTF8Buffer1;
 		m_pCurrentBuffer = &m_UTF8Buffer2;
@@ -240,6 +248,20 @@ namespace NMR {
 		return false;
 	}
 
+	void CXmlReader_Native::GetDefaultNamespaceURI(std::string &sNameSpaceURI)
+	{
+		sNameSpaceURI = m_sDefaultNameSpace;
+	}
+
+	void CXmlReader_Native::GetNamespaces(_Out_ std::map<std::string, std::string> & NameSpaces)
+	{
+		NameSpaces.clear();
+		for (auto iIterator : m_sNameSpaces) {
+			if ((iIterator.first != NMR_NATIVEXMLNS_XML_PREFIX) && (iIterator.first != NMR_NATIVEXMLNS_XMLNS_PREFIX))
+				NameSpaces.insert(iIterator);
+		}
+	}
+
 	nfBool CXmlReader_Native::ensureFilledBuffer()
 	{
 		if (m_nCurrentEntityIndex >= m_nCurrentFullEntityCount) {
@@ -262,6 +284,7 @@ namespace NMR {
 		}
 
 		__NMRASSERT(m_nCurrentEntityIndex < m_nCurrentFullEntityCount);
+		prepareEntity(m_nCurrentEntityIndex);
 		nfByte nType = m_CurrentEntityTypes[m_nCurrentEntityIndex];
 		switch (nType) {
 		case NMR_NATIVEXMLTYPE_TEXT:
@@ -356,6 +379,7 @@ namespace NMR {
 
 		if (nNameType == NMR_NATIVEXMLTYPE_ATTRIBNAME) {
 			// Read Attribute Name
+			prepareEntity(m_nCurrentEntityIndex);
 			m_pCurrentPrefix = m_CurrentEntityPrefixes[m_nCurrentEntityIndex];
 			m_pCurrentName = m_CurrentEntityList[m_nCurrentEntityIndex];
 			m_nCurrentEntityIndex++;
@@ -368,6 +392,7 @@ namespace NMR {
 			nfByte nValueType = m_CurrentEntityTypes[m_nCurrentEntityIndex];
 			if (nValueType != NMR_NATIVEXMLTYPE_ATTRIBVALUE)
 				throw CNMRException(NMR_ERROR_XMLPARSER_INVALIDATTRIBVALUE);
+			prepareEntity(m_nCurrentEntityIndex);
 
 			m_pCurrentValue = m_CurrentEntityList[m_nCurrentEntityIndex];
 			m_nCurrentEntityIndex++;
@@ -396,6 +421,127 @@ namespace NMR {
 		// Empty by purpose
 	}
 
+	nfBool CXmlReader_Native::CanReadRaw()
+	{
+		if (m_bIsEOF)
+			return false;
+
+		if (m_nCurrentEntityIndex == 0)
+			return true;
+
+		return (m_CurrentEntityEnds[m_nCurrentEntityIndex - 1] != nullptr);
+	}
+
+	nfUint32 CXmlReader_Native::ReadRaw(_Out_ nfByte * pBuffer, _In_ nfUint32 cbBufferSize)
+	{
+		if (pBuffer == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		transferBufferToPendingRawData();
+
+		m_pProgressMonitor->QueryCancelled(true);
+
+		return readRawData(pBuffer, cbBufferSize);
+	}
+
+	void CXmlReader_Native::UnreadRaw(_In_ const nfByte * pBuffer, _In_ nfUint32 cbBufferSize)
+	{
+		if (cbBufferSize == 0)
+			return;
+		if (pBuffer == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		transferBufferToPendingRawData();
+		prependPendingRawData((const nfChar *)pBuffer, cbBufferSize);
+	}
+
+	nfUint64 CXmlReader_Native::GetRawPosition()
+	{
+		transferBufferToPendingRawData();
+
+		// Bytes that have been given back are in front of the stream position
+		nfUint64 cbPendingSize = m_PendingRawData.size() - m_nPendingRawDataOffset;
+		nfUint64 nStreamPosition = m_pImportStream->getPosition();
+		if (cbPendingSize > nStreamPosition)
+			throw CNMRException(NMR_ERROR_XMLPARSER_INVALIDPARSERESULT);
+
+		return nStreamPosition - cbPendingSize;
+	}
+
+	void CXmlReader_Native::transferBufferToPendingRawData()
+	{
+		if (!CanReadRaw())
+			throw CNMRException(NMR_ERROR_XMLPARSER_RAWACCESSNOTPOSSIBLE);
+
+		nfUint32 nRawStart = 0;
+		if (m_nCurrentEntityIndex > 0)
+			nRawStart = (nfUint32)(m_CurrentEntityEnds[m_nCurrentEntityIndex - 1] - &(*m_pCurrentBuffer)[0]);
+		if (nRawStart > m_nCurrentBufferSize)
+			throw CNMRException(NMR_ERROR_XMLPARSER_INVALIDPARSERESULT);
+
+		// Hand back the unconsumed part of the buffer. It has not been prepared for
+		// reading yet, so it is still in its unmodified form, except for the '<'
+		// terminating a preceding text.
+		if ((m_nCurrentEntityIndex > 0) && (m_CurrentEntityTypes[m_nCurrentEntityIndex - 1] == NMR_NATIVEXMLTYPE_TEXT) && (nRawStart < m_nCurrentBufferSize))
+			(*m_pCurrentBuffer)[nRawStart] = '<';
+		if (nRawStart < m_nCurrentBufferSize)
+			prependPendingRawData(&(*m_pCurrentBuffer)[nRawStart], m_nCurrentBufferSize - nRawStart);
+
+		clearZeroInserts();
+		clearFinishedGroups();
+		m_nCurrentBufferSize = 0;
+		m_cbCurrentOverflowSize = 0;
+		m_nCurrentEntityCount = 0;
+		m_nCurrentVerifiedEntityCount = 0;
+		m_nCurrentFullEntityCount = 0;
+		m_nCurrentEntityIndex = 0;
+		m_pCurrentEntityPointer = nullptr;
+	}
+
+	void CXmlReader_Native::prependPendingRawData(_In_ const nfChar * pData, _In_ nfUint32 cbDataSize)
+	{
+		if (cbDataSize == 0)
+			return;
+
+		nfUint32 cbPendingSize = (nfUint32)m_PendingRawData.size() - m_nPendingRawDataOffset;
+		if (cbDataSize > m_nPendingRawDataOffset) {
+			// Move the pending data back, leaving as much space in front as is used
+			nfUint32 nNewOffset = cbDataSize + cbPendingSize;
+			std::vector<nfChar> NewData(nNewOffset + cbPendingSize);
+			if (cbPendingSize > 0)
+				memcpy(&NewData[nNewOffset], &m_PendingRawData[m_nPendingRawDataOffset], cbPendingSize);
+			m_PendingRawData.swap(NewData);
+			m_nPendingRawDataOffset = nNewOffset;
+		}
+
+		m_nPendingRawDataOffset -= cbDataSize;
+		memcpy(&m_PendingRawData[m_nPendingRawDataOffset], pData, cbDataSize);
+	}
+
+	nfUint32 CXmlReader_Native::readRawData(_Out_ nfByte * pBuffer, _In_ nfUint32 cbBufferSize)
+	{
+		nfUint32 cbPendingSize = (nfUint32)m_PendingRawData.size() - m_nPendingRawDataOffset;
+		nfUint32 cbPendingBytes = std::min(cbPendingSize, cbBufferSize);
+		if (cbPendingBytes > 0) {
+			memcpy(pBuffer, &m_PendingRawData[m_nPendingRawDataOffset], cbPendingBytes);
+			m_nPendingRawDataOffset += cbPendingBytes;
+			if (m_nPendingRawDataOffset == m_PendingRawData.size()) {
+				m_PendingRawData.clear();
+				m_nPendingRawDataOffset = 0;
+			}
+		}
+
+		nfUint64 cbBytesRead = 0;
+		if (cbPendingBytes < cbBufferSize) {
+			cbBytesRead = m_pImportStream->readIntoBuffer(pBuffer + cbPendingBytes, cbBufferSize - cbPendingBytes, false);
+
+			// Update Progress
+			m_pProgressMonitor->IncrementProgress(double(cbBytesRead));
+		}
+
+		return cbPendingBytes + (nfUint32)cbBytesRead;
+	}
+
 	void CXmlReader_Native::readNextBufferFromStream()
 	{
 		if (m_progressCounter++ > PROGRESS_READBUFFERUPDATE) {
@@ -407,6 +553,7 @@ namespace NMR {
 		nfUint32 j;
 
 		clearZeroInserts();
+		clearFinishedGroups();
 
 		// Read buffer (minus safety margin for overread/overwrite)
 		nfUint32 cbReadSize = m_cbBufferCapacity - NMR_NATIVEXMLREADER_BUFFERMARGIN;
@@ -417,6 +564,10 @@ namespace NMR {
 
 		// Copy over unfinished elements of current buffer into new buffer
 		if (m_cbCurrentOverflowSize > 0) {
+			// The overflow starts at the '<' terminating the last text, if it has been read
+			if ((m_nCurrentFullEntityCount > 0) && (m_CurrentEntityTypes[m_nCurrentFullEntityCount - 1] == NMR_NATIVEXMLTYPE_TEXT))
+				*m_CurrentEntityEnds[m_nCurrentFullEntityCount - 1] = '<';
+
 			nfUint32 nDeltaIndex = m_nCurrentBufferSize - m_cbCurrentOverflowSize;
 			nfChar * pSrc = &(*m_pCurrentBuffer)[nDeltaIndex];
 			nfChar * pDst = &(*m_pNextBuffer)[0];
@@ -433,12 +584,9 @@ namespace NMR {
 		}
 
 		// Read buffer into memory
-		cbBytesRead = m_pImportStream->readIntoBuffer((nfByte*)(&((*m_pNextBuffer)[m_nCurrentBufferSize])), cbReadSize, false);
+		cbBytesRead = readRawData((nfByte*)(&((*m_pNextBuffer)[m_nCurrentBufferSize])), cbReadSize);
 		m_nCurrentBufferSize += (nfUint32)cbBytesRead;
 
-		// Update Progress
-		m_pProgressMonitor->IncrementProgress(double(cbBytesRead));
-
 		// Reset Entity parser
 		m_nCurrentEntityCount = 0;
 		m_nCurrentVerifiedEntityCount = 0;
@@ -470,6 +618,9 @@ namespace NMR {
 			m_cbCurrentOverflowSize = m_nCurrentBufferSize - ((nfUint32)nUsedChars);
 		}
 		else {
+			// An element that is still open has filled the whole buffer and cannot be carried over
+			if (m_nCurrentEntityCount > 0)
+				throw CNMRException(NMR_ERROR_XMLPARSER_ENTITYEXCEEDSBUFFER);
 			m_cbCurrentOverflowSize = 0;
 		}
 	}
@@ -512,17 +663,19 @@ namespace NMR {
 		}
 
 		m_CurrentEntityTypes[m_nCurrentEntityCount] = nType;
+		m_CurrentEntityEnds[m_nCurrentEntityCount] = nullptr;
 		m_nCurrentEntityCount++;
 
 		if (bEntityIsFinished) {
 			// We have closed a full entity
 			m_pCurrentEntityPointer = pszNextEntityChar;
 			m_nCurrentFullEntityCount = m_nCurrentEntityCount;
+			m_CurrentEntityEnds[m_nCurrentEntityCount - 1] = pszNextEntityChar;
 
-			// Insert all zeros of the entity, as we do not need to rollback.
-			performZeroInserts();
-
-			performEscapeStringDecoding();
+			// The zeros of the entity group are inserted when it is read, as we do not need to rollback.
+			m_FinishedGroupEntityEnds.push_back(m_nCurrentEntityCount);
+			m_FinishedGroupZeroInsertEnds.push_back(m_nZeroInsertIndex);
+			m_nCurrentVerifiedEntityCount = m_nCurrentEntityCount;
 		}
 	}
 
@@ -550,6 +703,11 @@ namespace NMR {
 				if (pChar+1 != pszEnd && *(pChar+1) == '!' &&
 					pChar+2 != pszEnd && *(pChar+2) == '-' &&
 					pChar+3 != pszEnd && *(pChar+3) == '-'){
+					// A comment ends the text in front of it, but is not an entity itself
+					if (pChar != pszStart) {
+						pushEntity(pszStart, pChar, pChar, NMR_NATIVEXMLTYPE_TEXT, false, true);
+						pushZeroInsert(pChar);
+					}
 					pChar += 4;
 					return parseComment(pChar, pszEnd);
 				} else {
@@ -561,7 +719,7 @@ namespace NMR {
 					return parseElement(pChar, pszEnd);
 				}
 			default:
-				pChar++;
+				pChar = fnXmlScanForChar(pChar + 1, pszEnd, '<');
 			}
 
 		}
@@ -613,7 +771,7 @@ namespace NMR {
 				}
 
 			default:
-				pChar++;
+				pChar = fnXmlScanForElementNameEnd(pChar + 1, pszEnd);
 			}
 
 		}
@@ -628,9 +786,14 @@ namespace NMR {
 		static nfChar commentEnd [3] = {'-', '-', '>'};
 		nfInt32 endPosition = 0;
 		while (pChar != pszEnd) {
+			if (endPosition == 0) {
+				pChar = fnXmlScanForChar(pChar, pszEnd, '-');
+				if (pChar == pszEnd)
+					break;
+			}
 			if (*pChar == commentEnd[endPosition]){
 				if (endPosition == 2)
-					return pChar;
+					return pChar + 1;
 				endPosition++;
 			} else {
 				if (*pChar != '-')
@@ -725,7 +888,7 @@ namespace NMR {
 				return pChar;
 
 			default:
-				pChar++;
+				pChar = fnXmlScanForEndElementEnd(pChar + 1, pszEnd);
 			}
 
 		}
@@ -842,7 +1005,7 @@ namespace NMR {
 			default:
 				if (bHadSpacing)
 					throw CNMRException(NMR_ERROR_XMLPARSER_SPACEINATTRIBUTENAME);
-				pChar++;
+				pChar = fnXmlScanForAttributeNameEnd(pChar + 1, pszEnd);
 			}
 		}
 
@@ -897,7 +1060,7 @@ namespace NMR {
 				return pChar;
 
 			default:
-				pChar++;
+				pChar = fnXmlScanForChar(pChar + 1, pszEnd, 34);
 			}
 		}
 
@@ -918,7 +1081,7 @@ namespace NMR {
 				return pChar;
 
 			default:
-				pChar++;
+				pChar = fnXmlScanForChar(pChar + 1, pszEnd, 39);
 			}
 		}
 
@@ -940,25 +1103,40 @@ namespace NMR {
 		m_nZeroInsertIndex++;
 	}
 	
-	void CXmlReader_Native::performEscapeStringDecoding()
+	void CXmlReader_Native::prepareEntity(_In_ nfUint32 nEntityIndex)
 	{
-		for (nfUint32 nIndex  = m_nCurrentVerifiedEntityCount; nIndex < m_nCurrentEntityCount-1; nIndex++) {
-			if (m_CurrentEntityTypes[nIndex] != NMR_NATIVEXMLTYPE_COMMENT) {
-				decodeXMLEscapeXMLStrings(m_CurrentEntityList[nIndex]);
+		while ((nEntityIndex >= m_nPreparedEntityCount) && (m_nPreparedGroupCount < m_FinishedGroupEntityEnds.size())) {
+			nfUint32 nEntityEnd = m_FinishedGroupEntityEnds[m_nPreparedGroupCount];
+			nfUint32 nZeroInsertEnd = m_FinishedGroupZeroInsertEnds[m_nPreparedGroupCount];
+
+			// Insert all zeros of the entity group
+			for (nfUint32 nIndex = m_nPreparedZeroInsertCount; nIndex < nZeroInsertEnd; nIndex++)
+				*m_ZeroInsertArray[nIndex] = 0;
+
+			// Text ends at the '<' of the next group, whose zero has not been inserted yet
+			if (m_CurrentEntityTypes[nEntityEnd - 1] == NMR_NATIVEXMLTYPE_TEXT)
+				*m_CurrentEntityEnds[nEntityEnd - 1] = 0;
+
+			// Decode escaped strings of all but the last entity, text is decoded by Read
+			for (nfUint32 nIndex = m_nPreparedEntityCount; nIndex + 1 < nEntityEnd; nIndex++) {
+				if (m_CurrentEntityTypes[nIndex] != NMR_NATIVEXMLTYPE_COMMENT) {
+					decodeXMLEscapeXMLStrings(m_CurrentEntityList[nIndex]);
+				}
 			}
+
+			m_nPreparedZeroInsertCount = nZeroInsertEnd;
+			m_nPreparedEntityCount = nEntityEnd;
+			m_nPreparedGroupCount++;
 		}
-		m_nCurrentVerifiedEntityCount = m_nCurrentEntityCount;
 	}
 
-	void CXmlReader_Native::performZeroInserts()
+	void CXmlReader_Native::clearFinishedGroups()
 	{
-		nfUint32 nIndex;
-		for (nIndex = 0; nIndex < m_nZeroInsertIndex; nIndex++) {
-			nfChar * pChar = m_ZeroInsertArray[nIndex];
-			*pChar = 0;
-		}
-
-		m_nZeroInsertIndex = 0;
+		m_FinishedGroupEntityEnds.clear();
+		m_FinishedGroupZeroInsertEnds.clear();
+		m_nPreparedGroupCount = 0;
+		m_nPreparedEntityCount = 0;
+		m_nPreparedZeroInsertCount = 0;
 	}
 
 	void CXmlReader_Native::clearZeroInserts()
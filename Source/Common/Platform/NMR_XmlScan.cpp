@@ -0,0 +1,75 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_XmlScan.cpp implements the scalar and SSE2 kernels of the delimiter searches of the native XML
+parser and selects the kernels for the CPU.
+
+--*/
+
+#include "Common/Platform/NMR_XmlScan.h"
+#include "Common/Platform/NMR_CPUFeatures.h"
+
+namespace NMR {
+
+	sXmlScanKernels fnXmlScanGetKernelsScalar()
+	{
+		return fnXmlScanMakeKernels<CXmlScanBlockScalar>();
+	}
+
+	sXmlScanKernels fnXmlScanGetKernelsSSE2()
+	{
+#ifdef NMR_XMLSCAN_SSE2
+		return fnXmlScanMakeKernels<CXmlScanBlockSSE2>();
+#else
+		return { nullptr, nullptr, nullptr, nullptr };
+#endif
+	}
+
+	static sXmlScanKernels fnXmlScanSelectKernels()
+	{
+		if (fnCPUSupportsInstructionSet(CPUINSTRUCTIONSET_AVX2)) {
+			sXmlScanKernels Kernels = fnXmlScanGetKernelsAVX2();
+			if (Kernels.m_pScanForChar != nullptr)
+				return Kernels;
+		}
+
+		// SSE2 is enabled at compile time, if it is part of the baseline of the target
+		sXmlScanKernels Kernels = fnXmlScanGetKernelsSSE2();
+		if (Kernels.m_pScanForChar != nullptr)
+			return Kernels;
+
+		return fnXmlScanGetKernelsScalar();
+	}
+
+	const sXmlScanKernels & fnXmlScanGetKernels()
+	{
+		static const sXmlScanKernels Kernels = fnXmlScanSelectKernels();
+		return Kernels;
+	}
+
+}
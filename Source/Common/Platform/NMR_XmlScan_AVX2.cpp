@@ -0,0 +1,70 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_XmlScan_AVX2.cpp implements the AVX2 kernels of the delimiter searches of the native XML parser.
+It is compiled with AVX2 enabled, see Source/CMakeLists.txt. Nothing but the members of the block
+and delimiter classes may be used here, see fnXmlScanBlocks.
+
+--*/
+
+#include "Common/Platform/NMR_XmlScan.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace NMR {
+
+#if defined(__AVX2__)
+	namespace {
+
+		struct CXmlScanBlockAVX2 {
+			typedef __m256i Type;
+			static const ptrdiff_t Width = 32;
+
+			static Type Load(_In_ const nfChar * pChar) { return _mm256_loadu_si256((const __m256i *) pChar); }
+			static Type Broadcast(_In_ nfChar cChar) { return _mm256_set1_epi8(cChar); }
+			static Type Equal(_In_ Type Block, _In_ Type Delimiter) { return _mm256_cmpeq_epi8(Block, Delimiter); }
+			static Type Either(_In_ Type A, _In_ Type B) { return _mm256_or_si256(A, B); }
+			static nfUint32 Mask(_In_ Type Block) { return (nfUint32)_mm256_movemask_epi8(Block); }
+		};
+
+	}
+
+	sXmlScanKernels fnXmlScanGetKernelsAVX2()
+	{
+		return fnXmlScanMakeKernels<CXmlScanBlockAVX2>();
+	}
+#else
+	sXmlScanKernels fnXmlScanGetKernelsAVX2()
+	{
+		return { nullptr, nullptr, nullptr, nullptr };
+	}
+#endif
+
+}
@@ -278,6 +278,26 @@ namespace NMR {
 		writeData(m_nLineEndingBuffer, m_nLineEndingCharCount);
 	}
 
+	void CXmlWriter_Native::GetRawLineFraming(_Out_ std::string & sIndentation, _Out_ std::string & sLineEnding)
+	{
+		sIndentation.assign(m_nLayer * m_nSpacesPerLayer, (nfChar)NATIVEXMLSPACING);
+		sLineEnding.assign((const nfChar *)m_nLineEndingBuffer, m_nLineEndingCharCount);
+	}
+
+	void CXmlWriter_Native::WriteRawLines(_In_ const nfByte * pRawData, _In_ nfUint64 cbCount)
+	{
+		if (m_bElementIsOpen) {
+			closeCurrentElement(true);
+		}
+
+		while (cbCount > 0) {
+			nfUint32 cbBlock = (cbCount > NATIVEXMLWRITEBUFFERSIZE) ? NATIVEXMLWRITEBUFFERSIZE : (nfUint32)cbCount;
+			writeData(pRawData, cbBlock);
+			pRawData += cbBlock;
+			cbCount -= cbBlock;
+		}
+	}
+
 	void CXmlWriter_Native::escapeXMLString(_In_z_ const nfChar * pszString, _Out_ nfChar * pszBuffer)
 	{
 		__NMRASSERT(pszString);
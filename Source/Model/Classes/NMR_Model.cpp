@@ -67,6 +67,7 @@ A model is an in memory representation of the 3MF file.
 #include "Common/Platform/NMR_XmlReader.h"
 #include "Common/Platform/NMR_Platform.h"
 #include "Common/Platform/NMR_ImportStream_Unique_Memory.h"
+#include "Common/Platform/NMR_ImportStream_Deflated.h"
 
 #include "Common/NMR_StringUtils.h" 
 
@@ -1310,10 +1311,18 @@ namespace NMR {
 			PImportStream pInStream = pModelAttachment->getStream();
 			if (!pInStream)
 				throw CNMRException(NMR_ERROR_INVALIDPARAM);
-			nfUint64 nPos = pInStream->getPosition();
-			pInStream->seekPosition(0, true);
-			PImportStream pCopiedStream = std::make_shared<CImportStream_Unique_Memory>(pInStream.get(), pInStream->retrieveSize(), true);
-			pInStream->seekPosition(nPos, true);
+			PImportStream pCopiedStream;
+			CImportStream_Deflated * pDeflatedStream = dynamic_cast<CImportStream_Deflated *> (pInStream.get());
+			if ((pDeflatedStream != nullptr) && (pDeflatedStream->getPosition() == 0)) {
+				// Shares the deflated data, so that the attachment is not inflated for merging
+				pCopiedStream = pDeflatedStream->copyToMemory();
+			}
+			else {
+				nfUint64 nPos = pInStream->getPosition();
+				pInStream->seekPosition(0, true);
+				pCopiedStream = std::make_shared<CImportStream_Unique_Memory>(pInStream.get(), pInStream->retrieveSize(), true);
+				pInStream->seekPosition(nPos, true);
+			}
 
 			addAttachment(pModelAttachment->getPathURI(), pModelAttachment->getRelationShipType(), pCopiedStream);
 		}
@@ -1622,6 +1631,17 @@ namespace NMR {
 		return (*maxResourceID)->getPackageResourceID()->getModelResourceID();
 	}
 
+	CThreadPool * CModel::getThreadPool()
+	{
+		if (!m_pThreadPool) {
+			nfUint32 nThreadCount = CThreadPool::getHardwareThreadCount();
+			if (nThreadCount <= 1)
+				return nullptr;
+			m_pThreadPool = std::make_shared<CThreadPool>(nThreadCount);
+		}
+		return m_pThreadPool.get();
+	}
+
 	PModelFunction CModel::findFunction(_In_ UniqueResourceID nResourceID)
 	{
             for(size_t i = 0; i < m_FunctionLookup.size(); i++)
@@ -0,0 +1,398 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelImage3DSampler.cpp implements the class CModelImage3DSampler.
+
+u runs along the columns, v along the rows and w along the sheets of the image
+stack. Like for 2D textures, v = 0 is at the bottom of a sheet, i.e. at its last
+row. Every voxel covers 1 / count of the unit interval on each axis, and its value
+is located at the center. Coordinates outside [0, 1] are mapped by the tile style
+of their axis; with tile style none, voxels outside of the image have the value 0.
+
+--*/
+
+#include "Model/Classes/NMR_ModelImage3DSampler.h"
+
+#include "Common/NMR_Exception.h"
+#include "Common/NMR_PNGDecoder.h"
+#include "Common/NMR_ThreadPool.h"
+#include "Common/Platform/NMR_ImportStream_Memory.h"
+#include "Model/Classes/NMR_Model.h"
+#include "Model/Classes/NMR_ModelAttachment.h"
+#include "Model/Classes/NMR_ModelFunctionFromImage3D.h"
+#include "Model/Classes/NMR_ModelImageStack.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace NMR {
+
+	namespace {
+
+		// Coordinates are limited to the exactly representable integers before they are rounded
+		const nfDouble IMAGE3D_MAXCOORDINATE = 4503599627370496.0;
+
+		// Attachments may share their streams, so they are read one at a time
+		std::mutex & fnStreamMutex()
+		{
+			static std::mutex Mutex;
+			return Mutex;
+		}
+
+		// Maps a voxel index to the image, returns false if it is outside and not tiled
+		nfBool fnTileIndex(_In_ nfInt64 nIndex, _In_ nfUint32 nCount, _In_ eModelTextureTileStyle eTileStyle, _Out_ nfUint32 & nTiledIndex)
+		{
+			const nfInt64 nSize = nCount;
+			switch (eTileStyle) {
+			case MODELTEXTURETILESTYLE_WRAP:
+				nTiledIndex = (nfUint32)(((nIndex % nSize) + nSize) % nSize);
+				return true;
+			case MODELTEXTURETILESTYLE_MIRROR: {
+				nfInt64 nPeriodIndex = ((nIndex % (2 * nSize)) + 2 * nSize) % (2 * nSize);
+				nTiledIndex = (nfUint32)((nPeriodIndex < nSize) ? nPeriodIndex : (2 * nSize - 1 - nPeriodIndex));
+				return true;
+			}
+			case MODELTEXTURETILESTYLE_CLAMP:
+				nTiledIndex = (nfUint32)std::min(std::max(nIndex, (nfInt64)0), nSize - 1);
+				return true;
+			default:
+				nTiledIndex = 0;
+				if ((nIndex < 0) || (nIndex >= nSize))
+					return false;
+				nTiledIndex = (nfUint32)nIndex;
+				return true;
+			}
+		}
+
+		// Voxels and weights of one axis, one voxel for nearest and two for linear filtering
+		struct sAxisSamples {
+			nfUint32 m_nCount;
+			nfUint32 m_Indices[2];
+			nfDouble m_Weights[2];
+		};
+
+		void fnAxisSamples(_In_ nfDouble dCoordinate, _In_ nfUint32 nCount, _In_ eModelTextureTileStyle eTileStyle, _In_ nfBool bLinear, _Out_ sAxisSamples & Samples)
+		{
+			nfDouble dPosition = dCoordinate * nCount;
+			if (bLinear)
+				dPosition -= 0.5;
+			dPosition = std::min(std::max(dPosition, -IMAGE3D_MAXCOORDINATE), IMAGE3D_MAXCOORDINATE);
+			nfDouble dFloor = std::floor(dPosition);
+			nfInt64 nIndex = (nfInt64)dFloor;
+
+			Samples.m_nCount = 0;
+			if (!bLinear) {
+				if (fnTileIndex(nIndex, nCount, eTileStyle, Samples.m_Indices[0])) {
+					Samples.m_Weights[0] = 1.0;
+					Samples.m_nCount = 1;
+				}
+				return;
+			}
+
+			nfDouble dFraction = dPosition - dFloor;
+			for (nfUint32 nOffset = 0; nOffset < 2; nOffset++) {
+				nfDouble dWeight = (nOffset == 0) ? (1.0 - dFraction) : dFraction;
+				if ((dWeight > 0.0) && fnTileIndex(nIndex + nOffset, nCount, eTileStyle, Samples.m_Indices[Samples.m_nCount])) {
+					Samples.m_Weights[Samples.m_nCount] = dWeight;
+					Samples.m_nCount++;
+				}
+			}
+		}
+
+	}
+
+	CModelImage3DSampler::sSheetLookup::sSheetLookup()
+		: m_Indices({ { std::numeric_limits<nfUint32>::max(), std::numeric_limits<nfUint32>::max() } }), m_nNext(0)
+	{
+	}
+
+	CModelImage3DSampler::CModelImage3DSampler(_In_ CModelFunctionFromImage3D & Function)
+		: m_cbCacheSize(NMR_IMAGE3D_DEFAULTCACHESIZE), m_cbCachedSize(0)
+	{
+		auto pImageStack = std::dynamic_pointer_cast<CModelImageStack>(Function.getModel()->findImage3D(Function.getImage3DUniqueResourceID()));
+		if (!pImageStack)
+			throw CNMRException(NMR_ERROR_RESOURCENOTFOUND);
+
+		m_nColumnCount = pImageStack->getColumnCount();
+		m_nRowCount = pImageStack->getRowCount();
+		if ((m_nColumnCount == 0) || (m_nRowCount == 0) || (pImageStack->getSheetCount() == 0))
+			throw CNMRException(NMR_ERROR_INVALIDIMAGE3DSIZE);
+
+		for (nfUint32 nIndex = 0; nIndex < pImageStack->getSheetCount(); nIndex++) {
+			PModelAttachment pSheet = pImageStack->getSheet(nIndex);
+			if (!pSheet)
+				throw CNMRException(NMR_ERROR_MISSINGIMAGE3DSHEET);
+			m_Sheets.push_back(pSheet);
+		}
+
+		m_TileStyles = { Function.getTileStyleU(), Function.getTileStyleV(), Function.getTileStyleW() };
+		m_bLinear = (Function.getFilter() != MODELTEXTUREFILTER_NEAREST);
+		m_dOffset = Function.getOffset();
+		m_dScale = Function.getScale();
+	}
+
+	nfUint32 CModelImage3DSampler::getColumnCount()
+	{
+		return m_nColumnCount;
+	}
+
+	nfUint32 CModelImage3DSampler::getRowCount()
+	{
+		return m_nRowCount;
+	}
+
+	nfUint32 CModelImage3DSampler::getSheetCount()
+	{
+		return (nfUint32)m_Sheets.size();
+	}
+
+	void CModelImage3DSampler::setCacheSize(_In_ nfUint64 cbCacheSize)
+	{
+		std::lock_guard<std::mutex> Lock(m_CacheMutex);
+		m_cbCacheSize = cbCacheSize;
+		evictSheets();
+	}
+
+	nfUint64 CModelImage3DSampler::getCacheSize()
+	{
+		std::lock_guard<std::mutex> Lock(m_CacheMutex);
+		return m_cbCacheSize;
+	}
+
+	nfUint64 CModelImage3DSampler::getCachedSize()
+	{
+		std::lock_guard<std::mutex> Lock(m_CacheMutex);
+		return m_cbCachedSize;
+	}
+
+	void CModelImage3DSampler::getValueRange(_Out_ nfDouble & dMin, _Out_ nfDouble & dMax)
+	{
+		dMin = std::min(m_dOffset, m_dOffset + m_dScale);
+		dMax = std::max(m_dOffset, m_dOffset + m_dScale);
+	}
+
+	CModelImage3DSampler::PSheet CModelImage3DSampler::decodeSheet(_In_ nfUint32 nSheetIndex)
+	{
+		std::vector<nfByte> Buffer;
+		{
+			std::lock_guard<std::mutex> Lock(fnStreamMutex());
+			PImportStream pStream = m_Sheets[nSheetIndex]->getStream();
+			if (!pStream)
+				throw CNMRException(NMR_ERROR_MISSINGIMAGE3DSHEET);
+			pStream->seekPosition(0, true);
+			nfUint64 cbSize = pStream->retrieveSize();
+			if (cbSize > NMR_IMPORTSTREAM_MAXMEMSTREAMSIZE)
+				throw CNMRException(NMR_ERROR_INVALIDBUFFERSIZE);
+			Buffer.resize((size_t)cbSize);
+			pStream->readIntoBuffer(Buffer.data(), cbSize, true);
+			pStream->seekPosition(0, true);
+		}
+
+		sPNGImage Image;
+		fnDecodePNG(Buffer.data(), Buffer.size(), Image);
+		Buffer.clear();
+		Buffer.shrink_to_fit();
+		if ((Image.m_nWidth != m_nColumnCount) || (Image.m_nHeight != m_nRowCount))
+			throw CNMRException(NMR_ERROR_IMAGE3DSHEETSIZEMISMATCH);
+
+		// The interleaved samples are split into one plane per channel
+		auto pSheet = std::make_shared<sSheet>();
+		pSheet->m_nChannelCount = Image.m_nChannelCount;
+		const size_t nPixelCount = (size_t)Image.m_nWidth * Image.m_nHeight;
+		const size_t nSampleCount = nPixelCount * Image.m_nChannelCount;
+		if (Image.m_nBitDepth == 8)
+			pSheet->m_Bytes.resize(nSampleCount);
+		else
+			pSheet->m_Floats.resize(nSampleCount);
+
+		for (nfUint32 nChannel = 0; nChannel < Image.m_nChannelCount; nChannel++) {
+			const nfUint16 * pSource = Image.m_Samples.data() + nChannel;
+			const size_t nPlaneOffset = nChannel * nPixelCount;
+			if (Image.m_nBitDepth == 8) {
+				nfByte * pTarget = pSheet->m_Bytes.data() + nPlaneOffset;
+				for (size_t nPixel = 0; nPixel < nPixelCount; nPixel++)
+					pTarget[nPixel] = (nfByte)pSource[nPixel * Image.m_nChannelCount];
+			}
+			else {
+				nfFloat * pTarget = pSheet->m_Floats.data() + nPlaneOffset;
+				for (size_t nPixel = 0; nPixel < nPixelCount; nPixel++)
+					pTarget[nPixel] = pSource[nPixel * Image.m_nChannelCount] / 65535.0f;
+			}
+		}
+		return pSheet;
+	}
+
+	void CModelImage3DSampler::evictSheets()
+	{
+		while ((m_cbCachedSize > m_cbCacheSize) && (m_RecentSheets.size() > 1)) {
+			auto iEntry = m_CachedSheets.find(m_RecentSheets.back());
+			m_cbCachedSize -= iEntry->second.m_pSheet->m_Bytes.size() + iEntry->second.m_pSheet->m_Floats.size() * sizeof(nfFloat);
+			m_CachedSheets.erase(iEntry);
+			m_RecentSheets.pop_back();
+		}
+	}
+
+	CModelImage3DSampler::PSheet CModelImage3DSampler::getSheet(_In_ nfUint32 nSheetIndex, _Inout_ sSheetLookup & Lookup)
+	{
+		for (nfUint32 nSlot = 0; nSlot < 2; nSlot++) {
+			if (Lookup.m_Indices[nSlot] == nSheetIndex)
+				return Lookup.m_Sheets[nSlot];
+		}
+
+		PSheet pSheet;
+		{
+			std::lock_guard<std::mutex> Lock(m_CacheMutex);
+			auto iEntry = m_CachedSheets.find(nSheetIndex);
+			if (iEntry != m_CachedSheets.end()) {
+				m_RecentSheets.splice(m_RecentSheets.begin(), m_RecentSheets, iEntry->second.m_iRecent);
+				pSheet = iEntry->second.m_pSheet;
+			}
+		}
+
+		if (!pSheet) {
+			// Decoding does not block other threads. If two threads decode the same
+			// sheet, the first one to finish is cached.
+			PSheet pDecodedSheet = decodeSheet(nSheetIndex);
+
+			std::lock_guard<std::mutex> Lock(m_CacheMutex);
+			auto iEntry = m_CachedSheets.find(nSheetIndex);
+			if (iEntry != m_CachedSheets.end()) {
+				m_RecentSheets.splice(m_RecentSheets.begin(), m_RecentSheets, iEntry->second.m_iRecent);
+				pSheet = iEntry->second.m_pSheet;
+			}
+			else {
+				m_RecentSheets.push_front(nSheetIndex);
+				m_CachedSheets[nSheetIndex] = sCacheEntry{ pDecodedSheet, m_RecentSheets.begin() };
+				m_cbCachedSize += pDecodedSheet->m_Bytes.size() + pDecodedSheet->m_Floats.size() * sizeof(nfFloat);
+				evictSheets();
+				pSheet = pDecodedSheet;
+			}
+		}
+
+		Lookup.m_Indices[Lookup.m_nNext] = nSheetIndex;
+		Lookup.m_Sheets[Lookup.m_nNext] = pSheet;
+		Lookup.m_nNext = 1 - Lookup.m_nNext;
+		return pSheet;
+	}
+
+	void CModelImage3DSampler::lookup(_In_ const nfDouble (&vUVW)[3], _In_ nfUint32 nFirstChannel, _In_ nfUint32 nChannelCount, _Out_ nfDouble * pValues, _Inout_ sSheetLookup & Lookup)
+	{
+		if (!std::isfinite(vUVW[0]) || !std::isfinite(vUVW[1]) || !std::isfinite(vUVW[2])) {
+			for (nfUint32 nChannel = 0; nChannel < nChannelCount; nChannel++)
+				pValues[nChannel] = std::numeric_limits<nfDouble>::quiet_NaN();
+			return;
+		}
+
+		sAxisSamples Columns, Rows, Sheets;
+		fnAxisSamples(vUVW[0], m_nColumnCount, m_TileStyles[0], m_bLinear, Columns);
+		fnAxisSamples(vUVW[1], m_nRowCount, m_TileStyles[1], m_bLinear, Rows);
+		fnAxisSamples(vUVW[2], (nfUint32)m_Sheets.size(), m_TileStyles[2], m_bLinear, Sheets);
+
+		nfDouble Sums[NMR_IMAGE3D_CHANNELCOUNT] = { 0.0, 0.0, 0.0, 0.0 };
+		const size_t nPixelCount = (size_t)m_nColumnCount * m_nRowCount;
+		for (nfUint32 nSheet = 0; nSheet < Sheets.m_nCount; nSheet++) {
+			PSheet pSheet = getSheet(Sheets.m_Indices[nSheet], Lookup);
+			for (nfUint32 nRow = 0; nRow < Rows.m_nCount; nRow++) {
+				// v runs from the last row upwards
+				size_t nRowOffset = (size_t)(m_nRowCount - 1 - Rows.m_Indices[nRow]) * m_nColumnCount;
+				for (nfUint32 nColumn = 0; nColumn < Columns.m_nCount; nColumn++) {
+					nfDouble dWeight = Sheets.m_Weights[nSheet] * Rows.m_Weights[nRow] * Columns.m_Weights[nColumn];
+					size_t nPixel = nRowOffset + Columns.m_Indices[nColumn];
+
+					for (nfUint32 nIndex = 0; nIndex < nChannelCount; nIndex++) {
+						nfUint32 nChannel = nFirstChannel + nIndex;
+						// Gray is used for all colors, the alpha of images without alpha is 1
+						nfBool bHasAlpha = (pSheet->m_nChannelCount == 2) || (pSheet->m_nChannelCount == 4);
+						nfUint32 nPlane;
+						if (nChannel == 3) {
+							if (!bHasAlpha) {
+								Sums[nIndex] += dWeight;
+								continue;
+							}
+							nPlane = pSheet->m_nChannelCount - 1;
+						}
+						else
+							nPlane = (pSheet->m_nChannelCount < 3) ? 0 : nChannel;
+
+						size_t nSample = nPlane * nPixelCount + nPixel;
+						if (pSheet->m_Bytes.empty())
+							Sums[nIndex] += dWeight * pSheet->m_Floats[nSample];
+						else
+							Sums[nIndex] += dWeight * (pSheet->m_Bytes[nSample] / 255.0);
+					}
+				}
+			}
+		}
+
+		for (nfUint32 nIndex = 0; nIndex < nChannelCount; nIndex++)
+			pValues[nIndex] = m_dOffset + m_dScale * Sums[nIndex];
+	}
+
+	void CModelImage3DSampler::sampleChannel(_In_ nfUint32 nChannel, _In_ const nfDouble * pU, _In_ const nfDouble * pV, _In_ const nfDouble * pW, _Out_ nfDouble * pValues, _In_ size_t nCount)
+	{
+		if (nChannel >= NMR_IMAGE3D_CHANNELCOUNT)
+			throw CNMRException(NMR_ERROR_INVALIDINDEX);
+		if ((nCount > 0) && (!pU || !pV || !pW || !pValues))
+			throw CNMRException(NMR_ERROR_INVALIDPOINTER);
+
+		sSheetLookup Lookup;
+		for (size_t nIndex = 0; nIndex < nCount; nIndex++) {
+			const nfDouble vUVW[3] = { pU[nIndex], pV[nIndex], pW[nIndex] };
+			lookup(vUVW, nChannel, 1, pValues + nIndex, Lookup);
+		}
+	}
+
+	void CModelImage3DSampler::sample(_In_ const nfDouble * pUVW, _Out_ nfDouble * pRGBA, _In_ nfUint64 nPointCount, _In_opt_ CThreadPool * pThreadPool)
+	{
+		if (nPointCount == 0)
+			return;
+		if (!pUVW || !pRGBA)
+			throw CNMRException(NMR_ERROR_INVALIDPOINTER);
+
+		nfUint32 nTaskCount = 1;
+		if (pThreadPool != nullptr)
+			nTaskCount = (nfUint32)std::min<nfUint64>(pThreadPool->getThreadCount() * NMR_IMAGE3D_TASKSPERTHREAD, nPointCount);
+
+		ThreadPoolTask fnTask = [&](nfUint32 nTaskIndex) {
+			nfUint64 nFirstPoint = nPointCount * nTaskIndex / nTaskCount;
+			nfUint64 nLastPoint = nPointCount * (nTaskIndex + 1) / nTaskCount;
+			sSheetLookup Lookup;
+			for (nfUint64 nPoint = nFirstPoint; nPoint < nLastPoint; nPoint++) {
+				const nfDouble vUVW[3] = { pUVW[nPoint * 3], pUVW[nPoint * 3 + 1], pUVW[nPoint * 3 + 2] };
+				lookup(vUVW, 0, NMR_IMAGE3D_CHANNELCOUNT, pRGBA + nPoint * NMR_IMAGE3D_CHANNELCOUNT, Lookup);
+			}
+		};
+
+		if ((pThreadPool != nullptr) && (nTaskCount > 1))
+			pThreadPool->runTasks(nTaskCount, fnTask);
+		else
+			fnTask(0);
+	}
+
+}
@@ -0,0 +1,1295 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+#include "Model/Classes/NMR_ModelImplicitEvaluator.h"
+#include "Model/Classes/NMR_ModelFunctionFromImage3D.h"
+#include "Model/Classes/NMR_ModelImplicitInterval.h"
+#include "Model/Classes/NMR_ModelImplicitKernels.h"
+
+#include "lib3mf_interfaceexception.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+
+namespace NMR
+{
+    namespace implicit
+    {
+        unsigned int getOperandCount(OpCode op)
+        {
+            switch (op)
+            {
+                case OpCode::Add:
+                case OpCode::Sub:
+                case OpCode::Mul:
+                case OpCode::Div:
+                case OpCode::ArcTan2:
+                case OpCode::Min:
+                case OpCode::Max:
+                case OpCode::Fmod:
+                case OpCode::Mod:
+                case OpCode::Pow:
+                    return 2;
+                case OpCode::Clamp:
+                    return 3;
+                case OpCode::Select:
+                case OpCode::ImageSample:
+                    return 4;
+                default:
+                    return 1;
+            }
+        }
+
+        double applyOperation(OpCode op, double a, double b, double c, double d)
+        {
+            switch (op)
+            {
+                case OpCode::Add:
+                    return a + b;
+                case OpCode::Sub:
+                    return a - b;
+                case OpCode::Mul:
+                    return a * b;
+                case OpCode::Div:
+                    return a / b;
+                case OpCode::Neg:
+                    return -a;
+                case OpCode::Sin:
+                    return std::sin(a);
+                case OpCode::Cos:
+                    return std::cos(a);
+                case OpCode::Tan:
+                    return std::tan(a);
+                case OpCode::ArcSin:
+                    return std::asin(a);
+                case OpCode::ArcCos:
+                    return std::acos(a);
+                case OpCode::ArcTan:
+                    return std::atan(a);
+                case OpCode::ArcTan2:
+                    return std::atan2(a, b);
+                case OpCode::Min:
+                    return std::min(a, b);
+                case OpCode::Max:
+                    return std::max(a, b);
+                case OpCode::Abs:
+                    return std::abs(a);
+                case OpCode::Fmod:
+                    return std::fmod(a, b);
+                case OpCode::Mod:
+                    // Takes the sign of the divisor, unlike fmod
+                    return a - b * std::floor(a / b);
+                case OpCode::Pow:
+                    return std::pow(a, b);
+                case OpCode::Sqrt:
+                    return std::sqrt(a);
+                case OpCode::Exp:
+                    return std::exp(a);
+                case OpCode::Log:
+                    return std::log(a);
+                case OpCode::Log2:
+                    return std::log2(a);
+                case OpCode::Log10:
+                    return std::log10(a);
+                case OpCode::Sinh:
+                    return std::sinh(a);
+                case OpCode::Cosh:
+                    return std::cosh(a);
+                case OpCode::Tanh:
+                    return std::tanh(a);
+                case OpCode::Round:
+                    return std::round(a);
+                case OpCode::Ceil:
+                    return std::ceil(a);
+                case OpCode::Floor:
+                    return std::floor(a);
+                case OpCode::Sign:
+                    return (a > 0.) ? 1. : ((a < 0.) ? -1. : 0.);
+                case OpCode::Fract:
+                    return a - std::floor(a);
+                case OpCode::Select:
+                    return (a < b) ? c : d;
+                case OpCode::Clamp:
+                    return std::min(std::max(a, b), c);
+                case OpCode::ImageSample:
+                    throw ELib3MFInterfaceException(LIB3MF_ERROR_NOTIMPLEMENTED,
+                                                    "Image samples can only be computed by an evaluator.");
+            }
+            throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM,
+                                            "Unknown operation " + std::to_string(static_cast<int>(op)));
+        }
+    }  // namespace implicit
+
+    namespace
+    {
+        using namespace implicit;
+
+        using Values = std::vector<Register>;
+        using PortValues = std::unordered_map<CModelImplicitPort const*, Values>;
+
+        size_t componentCount(Lib3MF::eImplicitPortType type)
+        {
+            switch (type)
+            {
+                case Lib3MF::eImplicitPortType::Scalar:
+                    return 1;
+                case Lib3MF::eImplicitPortType::Vector:
+                    return 3;
+                case Lib3MF::eImplicitPortType::Matrix:
+                    return 16;
+                default:
+                    return 0;
+            }
+        }
+
+        // Maps node types, which are applied per component, to their operation
+        bool findComponentwiseOperation(Lib3MF::eImplicitNodeType type, OpCode& op)
+        {
+            using Lib3MF::eImplicitNodeType;
+            static std::unordered_map<int, OpCode> const operations{
+                {static_cast<int>(eImplicitNodeType::Addition), OpCode::Add},
+                {static_cast<int>(eImplicitNodeType::Subtraction), OpCode::Sub},
+                {static_cast<int>(eImplicitNodeType::Multiplication), OpCode::Mul},
+                {static_cast<int>(eImplicitNodeType::Division), OpCode::Div},
+                {static_cast<int>(eImplicitNodeType::Sinus), OpCode::Sin},
+                {static_cast<int>(eImplicitNodeType::Cosinus), OpCode::Cos},
+                {static_cast<int>(eImplicitNodeType::Tan), OpCode::Tan},
+                {static_cast<int>(eImplicitNodeType::ArcSin), OpCode::ArcSin},
+                {static_cast<int>(eImplicitNodeType::ArcCos), OpCode::ArcCos},
+                {static_cast<int>(eImplicitNodeType::ArcTan), OpCode::ArcTan},
+                {static_cast<int>(eImplicitNodeType::ArcTan2), OpCode::ArcTan2},
+                {static_cast<int>(eImplicitNodeType::Min), OpCode::Min},
+                {static_cast<int>(eImplicitNodeType::Max), OpCode::Max},
+                {static_cast<int>(eImplicitNodeType::Abs), OpCode::Abs},
+                {static_cast<int>(eImplicitNodeType::Fmod), OpCode::Fmod},
+                {static_cast<int>(eImplicitNodeType::Mod), OpCode::Mod},
+                {static_cast<int>(eImplicitNodeType::Pow), OpCode::Pow},
+                {static_cast<int>(eImplicitNodeType::Sqrt), OpCode::Sqrt},
+                {static_cast<int>(eImplicitNodeType::Exp), OpCode::Exp},
+                {static_cast<int>(eImplicitNodeType::Log), OpCode::Log},
+                {static_cast<int>(eImplicitNodeType::Log2), OpCode::Log2},
+                {static_cast<int>(eImplicitNodeType::Log10), OpCode::Log10},
+                {static_cast<int>(eImplicitNodeType::Sinh), OpCode::Sinh},
+                {static_cast<int>(eImplicitNodeType::Cosh), OpCode::Cosh},
+                {static_cast<int>(eImplicitNodeType::Tanh), OpCode::Tanh},
+                {static_cast<int>(eImplicitNodeType::Round), OpCode::Round},
+                {static_cast<int>(eImplicitNodeType::Ceil), OpCode::Ceil},
+                {static_cast<int>(eImplicitNodeType::Floor), OpCode::Floor},
+                {static_cast<int>(eImplicitNodeType::Sign), OpCode::Sign},
+                {static_cast<int>(eImplicitNodeType::Fract), OpCode::Fract},
+                {static_cast<int>(eImplicitNodeType::Select), OpCode::Select},
+                {static_cast<int>(eImplicitNodeType::Clamp), OpCode::Clamp}};
+
+            auto it = operations.find(static_cast<int>(type));
+            if (it == operations.end())
+            {
+                return false;
+            }
+            op = it->second;
+            return true;
+        }
+
+        std::string nodeName(CModelImplicitNode const& node)
+        {
+            return node.getIdentifier().empty() ? std::string("(unnamed)") : node.getIdentifier();
+        }
+
+        class CImplicitCompiler
+        {
+           private:
+            Tape m_tape;
+            std::vector<std::pair<Register, double>> m_constants;
+            std::unordered_map<uint64_t, Register> m_constantRegisters;
+            std::vector<bool> m_isConstant;
+            std::vector<double> m_constantValues;
+            std::vector<CModelImplicitFunction const*> m_callStack;
+            std::vector<std::pair<PModelImage3DSampler, uint32_t>> m_imageChannels;
+            std::unordered_map<CModelFunctionFromImage3D const*, PModelImage3DSampler> m_samplers;
+
+            Register newRegister()
+            {
+                if (m_isConstant.size() >= std::numeric_limits<Register>::max())
+                {
+                    throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM,
+                                                    "The function is too large to be evaluated.");
+                }
+                m_isConstant.push_back(false);
+                m_constantValues.push_back(0.);
+                return static_cast<Register>(m_isConstant.size() - 1);
+            }
+
+            Register constant(double value)
+            {
+                uint64_t bits;
+                static_assert(sizeof(bits) == sizeof(value), "unexpected double size");
+                std::memcpy(&bits, &value, sizeof(bits));
+
+                auto it = m_constantRegisters.find(bits);
+                if (it != m_constantRegisters.end())
+                {
+                    return it->second;
+                }
+                Register result = newRegister();
+                m_isConstant[result] = true;
+                m_constantValues[result] = value;
+                m_constants.emplace_back(result, value);
+                m_constantRegisters.emplace(bits, result);
+                return result;
+            }
+
+            // Operations on constants are folded into a new constant
+            Register emit(OpCode op, Register a, Register b, Register c, Register d)
+            {
+                unsigned int const operandCount = getOperandCount(op);
+                Register const operands[4] = {a, (operandCount > 1) ? b : a,
+                                              (operandCount > 2) ? c : a,
+                                              (operandCount > 3) ? d : a};
+
+                bool isConstant = true;
+                for (unsigned int i = 0; i < operandCount; ++i)
+                {
+                    isConstant = isConstant && m_isConstant[operands[i]];
+                }
+                if (isConstant)
+                {
+                    return constant(applyOperation(op, m_constantValues[operands[0]],
+                                                   m_constantValues[operands[1]],
+                                                   m_constantValues[operands[2]],
+                                                   m_constantValues[operands[3]]));
+                }
+
+                Register result = newRegister();
+                m_tape.push_back({op, result, operands[0], operands[1], operands[2], operands[3]});
+                return result;
+            }
+
+            // Samples are never folded, the image is only decoded by the evaluation
+            Register sampleImage(PModelImage3DSampler const& pSampler, uint32_t channel, Values const& uvw)
+            {
+                auto const imageChannel = std::make_pair(pSampler, channel);
+                auto it = std::find(m_imageChannels.begin(), m_imageChannels.end(), imageChannel);
+                if (it == m_imageChannels.end())
+                {
+                    it = m_imageChannels.insert(m_imageChannels.end(), imageChannel);
+                }
+                Register const index = constant(static_cast<double>(it - m_imageChannels.begin()));
+
+                Register result = newRegister();
+                m_tape.push_back({OpCode::ImageSample, result, uvw[0], uvw[1], uvw[2], index});
+                return result;
+            }
+
+            Register emit(OpCode op, Register a)
+            {
+                return emit(op, a, a, a, a);
+            }
+
+            Register emit(OpCode op, Register a, Register b)
+            {
+                return emit(op, a, b, a, a);
+            }
+
+            Register dot(Values const& a, Values const& b)
+            {
+                Register result = emit(OpCode::Mul, a[0], b[0]);
+                for (size_t i = 1; i < a.size(); ++i)
+                {
+                    result = emit(OpCode::Add, result, emit(OpCode::Mul, a[i], b[i]));
+                }
+                return result;
+            }
+
+            // x0 * y0 - x1 * y1 + x2 * y2
+            Register alternatingSum(Register x0, Register y0, Register x1, Register y1, Register x2, Register y2)
+            {
+                return emit(OpCode::Add,
+                            emit(OpCode::Sub, emit(OpCode::Mul, x0, y0), emit(OpCode::Mul, x1, y1)),
+                            emit(OpCode::Mul, x2, y2));
+            }
+
+            Register difference(Register x0, Register y0, Register x1, Register y1)
+            {
+                return emit(OpCode::Sub, emit(OpCode::Mul, x0, y0), emit(OpCode::Mul, x1, y1));
+            }
+
+            // Inverse of a 4x4 matrix by the cofactors of 2x2 sub-determinants
+            Values inverse(Values const& m)
+            {
+                auto at = [&m](int row, int column) { return m[row * 4 + column]; };
+
+                Register const s0 = difference(at(0, 0), at(1, 1), at(1, 0), at(0, 1));
+                Register const s1 = difference(at(0, 0), at(1, 2), at(1, 0), at(0, 2));
+                Register const s2 = difference(at(0, 0), at(1, 3), at(1, 0), at(0, 3));
+                Register const s3 = difference(at(0, 1), at(1, 2), at(1, 1), at(0, 2));
+                Register const s4 = difference(at(0, 1), at(1, 3), at(1, 1), at(0, 3));
+                Register const s5 = difference(at(0, 2), at(1, 3), at(1, 2), at(0, 3));
+
+                Register const c5 = difference(at(2, 2), at(3, 3), at(3, 2), at(2, 3));
+                Register const c4 = difference(at(2, 1), at(3, 3), at(3, 1), at(2, 3));
+                Register const c3 = difference(at(2, 1), at(3, 2), at(3, 1), at(2, 2));
+                Register const c2 = difference(at(2, 0), at(3, 3), at(3, 0), at(2, 3));
+                Register const c1 = difference(at(2, 0), at(3, 2), at(3, 0), at(2, 2));
+                Register const c0 = difference(at(2, 0), at(3, 1), at(3, 0), at(2, 1));
+
+                Register const determinant = emit(
+                    OpCode::Add,
+                    alternatingSum(s0, c5, s1, c4, s2, c3),
+                    alternatingSum(s3, c2, s4, c1, s5, c0));
+                Register const inverseDeterminant = emit(OpCode::Div, constant(1.), determinant);
+
+                auto positive = [&](Register value) { return emit(OpCode::Mul, value, inverseDeterminant); };
+                auto negative = [&](Register value) { return emit(OpCode::Neg, positive(value)); };
+
+                return Values{
+                    positive(alternatingSum(at(1, 1), c5, at(1, 2), c4, at(1, 3), c3)),
+                    negative(alternatingSum(at(0, 1), c5, at(0, 2), c4, at(0, 3), c3)),
+                    positive(alternatingSum(at(3, 1), s5, at(3, 2), s4, at(3, 3), s3)),
+                    negative(alternatingSum(at(2, 1), s5, at(2, 2), s4, at(2, 3), s3)),
+
+                    negative(alternatingSum(at(1, 0), c5, at(1, 2), c2, at(1, 3), c1)),
+                    positive(alternatingSum(at(0, 0), c5, at(0, 2), c2, at(0, 3), c1)),
+                    negative(alternatingSum(at(3, 0), s5, at(3, 2), s2, at(3, 3), s1)),
+                    positive(alternatingSum(at(2, 0), s5, at(2, 2), s2, at(2, 3), s1)),
+
+                    positive(alternatingSum(at(1, 0), c4, at(1, 1), c2, at(1, 3), c0)),
+                    negative(alternatingSum(at(0, 0), c4, at(0, 1), c2, at(0, 3), c0)),
+                    positive(alternatingSum(at(3, 0), s4, at(3, 1), s2, at(3, 3), s0)),
+                    negative(alternatingSum(at(2, 0), s4, at(2, 1), s2, at(2, 3), s0)),
+
+                    negative(alternatingSum(at(1, 0), c3, at(1, 1), c1, at(1, 2), c0)),
+                    positive(alternatingSum(at(0, 0), c3, at(0, 1), c1, at(0, 2), c0)),
+                    negative(alternatingSum(at(3, 0), s3, at(3, 1), s1, at(3, 2), s0)),
+                    positive(alternatingSum(at(2, 0), s3, at(2, 1), s1, at(2, 2), s0))};
+            }
+
+            // Returns the node, which provides the value of an input, or nullptr for function inputs
+            CModelImplicitNode* findSourceNode(CModelImplicitFunction const& function,
+                                               CModelImplicitPort const& input)
+            {
+                auto const source = input.getReferencedPort();
+                auto* sourceNode = source->getParent();
+                if (sourceNode && (sourceNode->getParent() != &function))
+                {
+                    throw ELib3MFInterfaceException(
+                        LIB3MF_ERROR_INVALIDPARAM,
+                        "Input " + input.getIdentifier() + " is linked to a node of another function.");
+                }
+                return sourceNode;
+            }
+
+            // Topologically sorts the nodes, which contribute to the outputs of a function
+            std::vector<CModelImplicitNode*> sortRequiredNodes(
+                CModelImplicitFunction const& function,
+                std::vector<PModelImplicitPort> const& outputSources)
+            {
+                enum class Mark
+                {
+                    Visiting,
+                    Done
+                };
+                std::unordered_map<CModelImplicitNode*, Mark> marks;
+                std::vector<CModelImplicitNode*> sortedNodes;
+                std::vector<std::pair<CModelImplicitNode*, size_t>> stack;
+
+                for (auto const& source : outputSources)
+                {
+                    auto* outputNode = source->getParent();
+                    if (!outputNode || marks.count(outputNode))
+                    {
+                        continue;
+                    }
+                    marks[outputNode] = Mark::Visiting;
+                    stack.emplace_back(outputNode, 0);
+
+                    while (!stack.empty())
+                    {
+                        auto* node = stack.back().first;
+                        auto const& inputs = *node->getInputs();
+                        if (stack.back().second < inputs.size())
+                        {
+                            auto* sourceNode = findSourceNode(function, *inputs[stack.back().second]);
+                            stack.back().second++;
+                            if (!sourceNode)
+                            {
+                                continue;
+                            }
+
+                            auto mark = marks.find(sourceNode);
+                            if (mark == marks.end())
+                            {
+                                marks[sourceNode] = Mark::Visiting;
+                                stack.emplace_back(sourceNode, 0);
+                            }
+                            else if (mark->second == Mark::Visiting)
+                            {
+                                throw ELib3MFInterfaceException(LIB3MF_ERROR_GRAPHISCYCLIC);
+                            }
+                        }
+                        else
+                        {
+                            marks[node] = Mark::Done;
+                            sortedNodes.push_back(node);
+                            stack.pop_back();
+                        }
+                    }
+                }
+                return sortedNodes;
+            }
+
+            void compileNode(CModelImplicitNode const& node, PortValues& values)
+            {
+                using Lib3MF::eImplicitNodeType;
+
+                auto input = [&](std::string const& identifier) -> Values const&
+                {
+                    auto const port = node.findInput(identifier);
+                    if (!port)
+                    {
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_INPUTNOTSET,
+                            "Node " + nodeName(node) + " has no input " + identifier + ".");
+                    }
+                    auto const it = values.find(port->getReferencedPort().get());
+                    if (it == values.end())
+                    {
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_INPUTNOTSET,
+                            "Input " + identifier + " of node " + nodeName(node) + " has no value.");
+                    }
+                    if (it->second.size() != componentCount(port->getType()))
+                    {
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_INCOMPATIBLEPORTTYPES,
+                            "Input " + identifier + " of node " + nodeName(node) + " is linked to a port of another type.");
+                    }
+                    return it->second;
+                };
+
+                auto setOutput = [&](std::string const& identifier, Values const& result)
+                {
+                    auto const port = node.findOutput(identifier);
+                    if (!port || (componentCount(port->getType()) != result.size()))
+                    {
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_INVALIDNODECONFIGURATION,
+                            "Output " + identifier + " of node " + nodeName(node) + " does not match its node type.");
+                    }
+                    values[port.get()] = result;
+                };
+
+                OpCode op;
+                if (findComponentwiseOperation(node.getNodeType(), op))
+                {
+                    std::vector<Values const*> operands;
+                    switch (node.getNodeType())
+                    {
+                        case eImplicitNodeType::Select:
+                            operands = {&input("A"), &input("B"), &input("C"), &input("D")};
+                            break;
+                        case eImplicitNodeType::Clamp:
+                            operands = {&input("A"), &input("min"), &input("max")};
+                            break;
+                        default:
+                            operands.push_back(&input("A"));
+                            if (getOperandCount(op) > 1)
+                            {
+                                operands.push_back(&input("B"));
+                            }
+                            break;
+                    }
+
+                    size_t const count = operands.front()->size();
+                    for (auto const* operand : operands)
+                    {
+                        if (operand->size() != count)
+                        {
+                            throw ELib3MFInterfaceException(
+                                LIB3MF_ERROR_INCOMPATIBLEPORTTYPES,
+                                "The inputs of node " + nodeName(node) + " have different types.");
+                        }
+                    }
+
+                    Values result(count);
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        Register r[4];
+                        for (size_t j = 0; j < 4; ++j)
+                        {
+                            r[j] = (*operands[std::min(j, operands.size() - 1)])[i];
+                        }
+                        result[i] = emit(op, r[0], r[1], r[2], r[3]);
+                    }
+                    setOutput("result", result);
+                    return;
+                }
+
+                switch (node.getNodeType())
+                {
+                    case eImplicitNodeType::Constant:
+                        setOutput("value", {constant(node.getConstant())});
+                        break;
+
+                    case eImplicitNodeType::ConstVec:
+                    {
+                        auto const vector = node.getVector();
+                        setOutput("vector", {constant(vector.m_Coordinates[0]),
+                                             constant(vector.m_Coordinates[1]),
+                                             constant(vector.m_Coordinates[2])});
+                        break;
+                    }
+
+                    case eImplicitNodeType::ConstMat:
+                    {
+                        auto const matrix = node.getMatrix();
+                        Values result;
+                        for (int row = 0; row < 4; ++row)
+                        {
+                            for (int column = 0; column < 4; ++column)
+                            {
+                                result.push_back(constant(matrix.m_Field[row][column]));
+                            }
+                        }
+                        setOutput("matrix", result);
+                        break;
+                    }
+
+                    case eImplicitNodeType::ComposeVector:
+                        setOutput("result", {input("x")[0], input("y")[0], input("z")[0]});
+                        break;
+
+                    case eImplicitNodeType::DecomposeVector:
+                    {
+                        auto const& a = input("A");
+                        setOutput("x", {a[0]});
+                        setOutput("y", {a[1]});
+                        setOutput("z", {a[2]});
+                        break;
+                    }
+
+                    case eImplicitNodeType::VectorFromScalar:
+                    {
+                        Register const a = input("A")[0];
+                        setOutput("result", {a, a, a});
+                        break;
+                    }
+
+                    case eImplicitNodeType::ComposeMatrix:
+                    {
+                        Values result;
+                        for (int row = 0; row < 4; ++row)
+                        {
+                            for (int column = 0; column < 4; ++column)
+                            {
+                                result.push_back(input("m" + std::to_string(row) + std::to_string(column))[0]);
+                            }
+                        }
+                        setOutput("result", result);
+                        break;
+                    }
+
+                    // The vectors fill the upper three rows of the columns, the last row is (0, 0, 0, 1)
+                    case eImplicitNodeType::MatrixFromColumns:
+                    case eImplicitNodeType::MatrixFromRows:
+                    {
+                        Values const* vectors[4] = {&input("A"), &input("B"), &input("C"), &input("D")};
+                        bool const fromRows = (node.getNodeType() == eImplicitNodeType::MatrixFromRows);
+                        Values result(16);
+                        for (int row = 0; row < 4; ++row)
+                        {
+                            for (int column = 0; column < 4; ++column)
+                            {
+                                int const vector = fromRows ? row : column;
+                                int const component = fromRows ? column : row;
+                                if (component < 3)
+                                {
+                                    result[row * 4 + column] = (*vectors[vector])[component];
+                                }
+                                else
+                                {
+                                    result[row * 4 + column] = constant((vector == 3) ? 1. : 0.);
+                                }
+                            }
+                        }
+                        setOutput("result", result);
+                        break;
+                    }
+
+                    case eImplicitNodeType::Dot:
+                        setOutput("result", {dot(input("A"), input("B"))});
+                        break;
+
+                    case eImplicitNodeType::Cross:
+                    {
+                        auto const& a = input("A");
+                        auto const& b = input("B");
+                        setOutput("result", {difference(a[1], b[2], a[2], b[1]),
+                                             difference(a[2], b[0], a[0], b[2]),
+                                             difference(a[0], b[1], a[1], b[0])});
+                        break;
+                    }
+
+                    case eImplicitNodeType::Length:
+                    {
+                        auto const& a = input("A");
+                        setOutput("result", {emit(OpCode::Sqrt, dot(a, a))});
+                        break;
+                    }
+
+                    // The vector is transformed as a point, (x, y, z, 1)
+                    case eImplicitNodeType::MatVecMultiplication:
+                    {
+                        auto const& m = input("A");
+                        auto const& v = input("B");
+                        Values result(3);
+                        for (int row = 0; row < 3; ++row)
+                        {
+                            Values const matrixRow{m[row * 4], m[row * 4 + 1], m[row * 4 + 2]};
+                            result[row] = emit(OpCode::Add, dot(matrixRow, v), m[row * 4 + 3]);
+                        }
+                        setOutput("result", result);
+                        break;
+                    }
+
+                    case eImplicitNodeType::Transpose:
+                    {
+                        auto const& m = input("A");
+                        Values result(16);
+                        for (int row = 0; row < 4; ++row)
+                        {
+                            for (int column = 0; column < 4; ++column)
+                            {
+                                result[row * 4 + column] = m[column * 4 + row];
+                            }
+                        }
+                        setOutput("result", result);
+                        break;
+                    }
+
+                    case eImplicitNodeType::Inverse:
+                        setOutput("result", inverse(input("A")));
+                        break;
+
+                    // Resource IDs are only resolved by the nodes using them
+                    case eImplicitNodeType::ConstResourceID:
+                        setOutput("value", {});
+                        break;
+
+                    case eImplicitNodeType::FunctionCall:
+                        compileFunctionCall(node, values, input);
+                        break;
+
+                    default:
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_NOTIMPLEMENTED,
+                            "Node " + nodeName(node) + " of type " +
+                                std::to_string(static_cast<int>(node.getNodeType())) +
+                                " can not be evaluated.");
+                }
+            }
+
+            template <typename InputFunction>
+            void compileFunctionCall(CModelImplicitNode const& node, PortValues& values, InputFunction& input)
+            {
+                auto const functionIdPort = node.findInput("functionID");
+                if (!functionIdPort)
+                {
+                    throw ELib3MFInterfaceException(
+                        LIB3MF_ERROR_INPUTNOTSET,
+                        "Node " + nodeName(node) + " has no input functionID.");
+                }
+                auto const* resourceNode = functionIdPort->getReferencedPort()->getParent();
+                if (!resourceNode || (resourceNode->getNodeType() != Lib3MF::eImplicitNodeType::ConstResourceID))
+                {
+                    throw ELib3MFInterfaceException(
+                        LIB3MF_ERROR_NOTIMPLEMENTED,
+                        "The function of node " + nodeName(node) + " must be selected by a constant resource ID.");
+                }
+                auto const resource = resourceNode->getResource();
+                auto const imageFunction = std::dynamic_pointer_cast<CModelFunctionFromImage3D>(resource);
+                if (imageFunction)
+                {
+                    compileImageCall(node, *imageFunction, values);
+                    return;
+                }
+                auto const callee = std::dynamic_pointer_cast<CModelImplicitFunction>(resource);
+                if (!callee)
+                {
+                    throw ELib3MFInterfaceException(
+                        LIB3MF_ERROR_NOTIMPLEMENTED,
+                        "Node " + nodeName(node) + " does not call an implicit function.");
+                }
+
+                PortValues calleeInputs;
+                for (auto const& calleeInput : *callee->getInputs())
+                {
+                    auto const& argument = input(calleeInput->getIdentifier());
+                    if (argument.size() != componentCount(calleeInput->getType()))
+                    {
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_INCOMPATIBLEPORTTYPES,
+                            "Input " + calleeInput->getIdentifier() + " of node " + nodeName(node) +
+                                " does not match the type of the function input.");
+                    }
+                    calleeInputs[calleeInput.get()] = argument;
+                }
+
+                auto const results = compileFunction(*callee, calleeInputs);
+
+                auto const& calleeOutputs = *callee->getOutputs();
+                for (size_t i = 0; i < calleeOutputs.size(); ++i)
+                {
+                    auto const port = node.findOutput(calleeOutputs[i]->getIdentifier());
+                    if (!port)
+                    {
+                        continue;
+                    }
+                    if (port->getType() != calleeOutputs[i]->getType())
+                    {
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_INCOMPATIBLEPORTTYPES,
+                            "Output " + port->getIdentifier() + " of node " + nodeName(node) +
+                                " does not match the type of the function output.");
+                    }
+                    values[port.get()] = results[i];
+                }
+            }
+
+            // A function from image3d takes the vector uvw and returns the
+            // vector color and the scalars red, green, blue and alpha
+            void compileImageCall(CModelImplicitNode const& node,
+                                  CModelFunctionFromImage3D& function,
+                                  PortValues& values)
+            {
+                auto uvwPort = node.findInput("uvw");
+                if (!uvwPort)
+                {
+                    for (auto const& port : *node.getInputs())
+                    {
+                        if (port->getType() != Lib3MF::eImplicitPortType::Vector)
+                        {
+                            continue;
+                        }
+                        if (uvwPort)
+                        {
+                            throw ELib3MFInterfaceException(
+                                LIB3MF_ERROR_INPUTNOTSET,
+                                "Node " + nodeName(node) + " has no input uvw.");
+                        }
+                        uvwPort = port;
+                    }
+                }
+                if (!uvwPort)
+                {
+                    throw ELib3MFInterfaceException(
+                        LIB3MF_ERROR_INPUTNOTSET,
+                        "Node " + nodeName(node) + " has no input uvw.");
+                }
+                auto const it = values.find(uvwPort->getReferencedPort().get());
+                if ((it == values.end()) || (it->second.size() != 3))
+                {
+                    throw ELib3MFInterfaceException(
+                        LIB3MF_ERROR_INCOMPATIBLEPORTTYPES,
+                        "Input " + uvwPort->getIdentifier() + " of node " + nodeName(node) +
+                            " must be linked to a vector.");
+                }
+                Values const uvw = it->second;
+
+                auto& pSampler = m_samplers[&function];
+                if (!pSampler)
+                {
+                    pSampler = std::make_shared<CModelImage3DSampler>(function);
+                }
+
+                static char const* const channelNames[] = {"red", "green", "blue", "alpha"};
+                for (uint32_t channel = 0; channel < 4; ++channel)
+                {
+                    auto const port = node.findOutput(channelNames[channel]);
+                    if (port)
+                    {
+                        values[port.get()] = Values{sampleImage(pSampler, channel, uvw)};
+                    }
+                }
+                auto const colorPort = node.findOutput("color");
+                if (colorPort)
+                {
+                    values[colorPort.get()] = Values{sampleImage(pSampler, 0, uvw),
+                                                     sampleImage(pSampler, 1, uvw),
+                                                     sampleImage(pSampler, 2, uvw)};
+                }
+            }
+
+           public:
+            Values addInput(Lib3MF::eImplicitPortType type)
+            {
+                Values result(componentCount(type));
+                for (auto& r : result)
+                {
+                    r = newRegister();
+                }
+                return result;
+            }
+
+            // Returns the values of the function outputs in their order
+            std::vector<Values> compileFunction(CModelImplicitFunction& function, PortValues const& inputs)
+            {
+                if (std::find(m_callStack.begin(), m_callStack.end(), &function) != m_callStack.end())
+                {
+                    throw ELib3MFInterfaceException(
+                        LIB3MF_ERROR_GRAPHISCYCLIC,
+                        "Function " + function.getDisplayName() + " calls itself.");
+                }
+                m_callStack.push_back(&function);
+
+                std::vector<PModelImplicitPort> outputSources;
+                for (auto const& output : *function.getOutputs())
+                {
+                    auto source = function.findPort(output->getReference());
+                    if (!source)
+                    {
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_INPUTNOTSET,
+                            "Output " + output->getIdentifier() + " of function " +
+                                function.getDisplayName() + " is not linked.");
+                    }
+                    outputSources.push_back(source);
+                }
+
+                PortValues values(inputs);
+                for (auto* node : sortRequiredNodes(function, outputSources))
+                {
+                    compileNode(*node, values);
+                }
+
+                std::vector<Values> results;
+                auto const& outputs = *function.getOutputs();
+                for (size_t i = 0; i < outputs.size(); ++i)
+                {
+                    auto const it = values.find(outputSources[i].get());
+                    if (it == values.end())
+                    {
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_INPUTNOTSET,
+                            "Output " + outputs[i]->getIdentifier() + " of function " +
+                                function.getDisplayName() + " has no value.");
+                    }
+                    if (it->second.size() != componentCount(outputs[i]->getType()))
+                    {
+                        throw ELib3MFInterfaceException(
+                            LIB3MF_ERROR_INCOMPATIBLEPORTTYPES,
+                            "Output " + outputs[i]->getIdentifier() + " of function " +
+                                function.getDisplayName() + " is linked to a port of another type.");
+                    }
+                    results.push_back(it->second);
+                }
+
+                m_callStack.pop_back();
+                return results;
+            }
+
+            Tape const& getTape() const
+            {
+                return m_tape;
+            }
+
+            std::vector<std::pair<Register, double>> const& getConstants() const
+            {
+                return m_constants;
+            }
+
+            size_t getRegisterCount() const
+            {
+                return m_isConstant.size();
+            }
+
+            std::vector<std::pair<PModelImage3DSampler, uint32_t>> const& getImageChannels() const
+            {
+                return m_imageChannels;
+            }
+        };
+    }  // namespace
+
+    CModelImplicitEvaluator::CModelImplicitEvaluator(CModelImplicitFunction& function)
+    {
+        CImplicitCompiler compiler;
+
+        // Inputs occupy the first registers
+        PortValues inputs;
+        std::vector<Register> inputRegisters;
+        for (auto const& input : *function.getInputs())
+        {
+            auto const values = compiler.addInput(input->getType());
+            inputs[input.get()] = values;
+            inputRegisters.insert(inputRegisters.end(), values.begin(), values.end());
+        }
+
+        std::vector<Register> outputRegisters;
+        for (auto const& values : compiler.compileFunction(function, inputs))
+        {
+            outputRegisters.insert(outputRegisters.end(), values.begin(), values.end());
+        }
+
+        // Every temporary register is written by exactly one instruction, so
+        // instructions whose result is never read can be dropped
+        size_t const registerCount = compiler.getRegisterCount();
+        std::vector<bool> isRead(registerCount, false);
+        for (auto r : outputRegisters)
+        {
+            isRead[r] = true;
+        }
+        Tape const& compiledTape = compiler.getTape();
+        std::vector<Instruction> requiredInstructions;
+        for (auto it = compiledTape.rbegin(); it != compiledTape.rend(); ++it)
+        {
+            if (!isRead[it->result])
+            {
+                continue;
+            }
+            isRead[it->a] = isRead[it->b] = isRead[it->c] = isRead[it->d] = true;
+            requiredInstructions.push_back(*it);
+        }
+        std::reverse(requiredInstructions.begin(), requiredInstructions.end());
+
+        // Registers of temporaries are reused after their last read, which
+        // keeps the register file of a chunk small enough for the cache
+        Register const unassigned = std::numeric_limits<Register>::max();
+        std::vector<Register> mapping(registerCount, unassigned);
+        std::vector<size_t> lastRead(registerCount, 0);
+        for (size_t i = 0; i < requiredInstructions.size(); ++i)
+        {
+            auto const& instruction = requiredInstructions[i];
+            lastRead[instruction.a] = lastRead[instruction.b] = lastRead[instruction.c] =
+                lastRead[instruction.d] = i;
+        }
+        for (auto r : outputRegisters)
+        {
+            lastRead[r] = std::numeric_limits<size_t>::max();
+        }
+
+        Register nextRegister = 0;
+        for (auto r : inputRegisters)
+        {
+            mapping[r] = nextRegister++;
+        }
+        for (auto const& constant : compiler.getConstants())
+        {
+            if (isRead[constant.first])
+            {
+                mapping[constant.first] = nextRegister;
+                m_constants.emplace_back(nextRegister, constant.second);
+                nextRegister++;
+            }
+        }
+        std::vector<bool> isFixed(registerCount, false);
+        for (size_t r = 0; r < registerCount; ++r)
+        {
+            isFixed[r] = (mapping[r] != unassigned);
+        }
+
+        std::vector<Register> freeRegisters;
+        for (size_t i = 0; i < requiredInstructions.size(); ++i)
+        {
+            Instruction instruction = requiredInstructions[i];
+            Register const operands[4] = {instruction.a, instruction.b, instruction.c, instruction.d};
+            instruction.a = mapping[operands[0]];
+            instruction.b = mapping[operands[1]];
+            instruction.c = mapping[operands[2]];
+            instruction.d = mapping[operands[3]];
+
+            // Operands, which are not read again, release their register before the result is assigned
+            for (int j = 0; j < 4; ++j)
+            {
+                Register const r = operands[j];
+                if (isFixed[r] || (lastRead[r] != i) || (std::find(operands, operands + j, r) != operands + j))
+                {
+                    continue;
+                }
+                freeRegisters.push_back(mapping[r]);
+            }
+
+            if (freeRegisters.empty())
+            {
+                mapping[instruction.result] = nextRegister++;
+            }
+            else
+            {
+                mapping[instruction.result] = freeRegisters.back();
+                freeRegisters.pop_back();
+            }
+            instruction.result = mapping[instruction.result];
+            m_tape.push_back(instruction);
+        }
+
+        for (auto r : inputRegisters)
+        {
+            m_inputRegisters.push_back(mapping[r]);
+        }
+        for (auto r : outputRegisters)
+        {
+            m_outputRegisters.push_back(mapping[r]);
+        }
+        m_registerCount = nextRegister;
+        m_imageChannels = compiler.getImageChannels();
+    }
+
+    size_t CModelImplicitEvaluator::getInputStride() const
+    {
+        return m_inputRegisters.size();
+    }
+
+    size_t CModelImplicitEvaluator::getOutputStride() const
+    {
+        return m_outputRegisters.size();
+    }
+
+    implicit::Tape const& CModelImplicitEvaluator::getTape() const
+    {
+        return m_tape;
+    }
+
+    uint32_t CModelImplicitEvaluator::getRegisterCount() const
+    {
+        return m_registerCount;
+    }
+
+    std::vector<std::pair<implicit::Register, double>> const& CModelImplicitEvaluator::getConstants() const
+    {
+        return m_constants;
+    }
+
+    std::vector<implicit::Register> const& CModelImplicitEvaluator::getInputRegisters() const
+    {
+        return m_inputRegisters;
+    }
+
+    std::vector<implicit::Register> const& CModelImplicitEvaluator::getOutputRegisters() const
+    {
+        return m_outputRegisters;
+    }
+
+    std::vector<CModelImplicitEvaluator::ImageChannel> const& CModelImplicitEvaluator::getImageChannels() const
+    {
+        return m_imageChannels;
+    }
+
+    void CModelImplicitEvaluator::setWorkerThreadCount(uint32_t nThreadCount)
+    {
+        if (nThreadCount != m_workerThreadCount)
+        {
+            m_pThreadPool.reset();
+        }
+        m_workerThreadCount = nThreadCount;
+    }
+
+    uint32_t CModelImplicitEvaluator::getWorkerThreadCount() const
+    {
+        return m_workerThreadCount;
+    }
+
+    void CModelImplicitEvaluator::evaluateChunk(double const* pInputs,
+                                                Layout inputLayout,
+                                                double* pOutputs,
+                                                Layout outputLayout,
+                                                size_t nPointCount,
+                                                double* pRegisters) const
+    {
+        for (size_t i = 0; i < m_inputRegisters.size(); ++i)
+        {
+            double* pRegister = pRegisters + m_inputRegisters[i] * LaneCount;
+            double const* pComponent = pInputs + i * inputLayout.m_nComponentStride;
+            for (size_t lane = 0; lane < nPointCount; ++lane)
+            {
+                pRegister[lane] = pComponent[lane * inputLayout.m_nPointStride];
+            }
+        }
+
+        // Lanes past the point count hold stale values, but are computed
+        // anyway so the kernels always process full batches
+        for (auto const& instruction : m_tape)
+        {
+            if (instruction.op == implicit::OpCode::ImageSample)
+            {
+                auto const& imageChannel =
+                    m_imageChannels[static_cast<size_t>(pRegisters[instruction.d * LaneCount])];
+                imageChannel.first->sampleChannel(imageChannel.second,
+                                                  pRegisters + instruction.a * LaneCount,
+                                                  pRegisters + instruction.b * LaneCount,
+                                                  pRegisters + instruction.c * LaneCount,
+                                                  pRegisters + instruction.result * LaneCount,
+                                                  nPointCount);
+                continue;
+            }
+            implicit::kernels::applyInstruction(instruction.op,
+                                                pRegisters + instruction.result * LaneCount,
+                                                pRegisters + instruction.a * LaneCount,
+                                                pRegisters + instruction.b * LaneCount,
+                                                pRegisters + instruction.c * LaneCount,
+                                                pRegisters + instruction.d * LaneCount,
+                                                LaneCount);
+        }
+
+        for (size_t i = 0; i < m_outputRegisters.size(); ++i)
+        {
+            double const* pRegister = pRegisters + m_outputRegisters[i] * LaneCount;
+            double* pComponent = pOutputs + i * outputLayout.m_nComponentStride;
+            for (size_t lane = 0; lane < nPointCount; ++lane)
+            {
+                pComponent[lane * outputLayout.m_nPointStride] = pRegister[lane];
+            }
+        }
+    }
+
+    void CModelImplicitEvaluator::evaluateChunks(double const* pInputs,
+                                                 Layout inputLayout,
+                                                 double* pOutputs,
+                                                 Layout outputLayout,
+                                                 uint64_t nPointCount)
+    {
+        if (nPointCount == 0)
+        {
+            return;
+        }
+        if ((!pInputs && !m_inputRegisters.empty()) || (!pOutputs && !m_outputRegisters.empty()))
+        {
+            throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
+        }
+
+        uint32_t threadCount = m_workerThreadCount;
+        if (threadCount == 0)
+        {
+            threadCount = CThreadPool::getHardwareThreadCount();
+        }
+
+        uint64_t const chunkCount = (nPointCount + LaneCount - 1) / LaneCount;
+        uint32_t const taskCount =
+            static_cast<uint32_t>(std::max<uint64_t>(1, std::min<uint64_t>(threadCount, chunkCount)));
+
+        auto evaluateTask = [&](uint32_t nTaskIndex)
+        {
+            // Every task works on its own register file, initialized with the constants
+            std::vector<double> registers(static_cast<size_t>(m_registerCount) * LaneCount, 0.);
+            for (auto const& constant : m_constants)
+            {
+                std::fill_n(registers.begin() + constant.first * LaneCount, LaneCount, constant.second);
+            }
+
+            uint64_t const firstChunk = chunkCount * nTaskIndex / taskCount;
+            uint64_t const lastChunk = chunkCount * (nTaskIndex + 1) / taskCount;
+            for (uint64_t chunk = firstChunk; chunk < lastChunk; ++chunk)
+            {
+                uint64_t const firstPoint = chunk * LaneCount;
+                size_t const pointCount = static_cast<size_t>(std::min<uint64_t>(LaneCount, nPointCount - firstPoint));
+                evaluateChunk(pInputs + firstPoint * inputLayout.m_nPointStride, inputLayout,
+                              pOutputs + firstPoint * outputLayout.m_nPointStride, outputLayout,
+                              pointCount, registers.data());
+            }
+        };
+
+        if (taskCount <= 1)
+        {
+            evaluateTask(0);
+            return;
+        }
+
+        if (!m_pThreadPool)
+        {
+            m_pThreadPool = std::make_shared<CThreadPool>(threadCount);
+        }
+        m_pThreadPool->runTasks(taskCount, evaluateTask);
+    }
+
+    void CModelImplicitEvaluator::evaluate(double const* pInputs,
+                                           double* pOutputs,
+                                           uint64_t nPointCount)
+    {
+        evaluateChunks(pInputs, Layout{m_inputRegisters.size(), 1},
+                       pOutputs, Layout{m_outputRegisters.size(), 1}, nPointCount);
+    }
+
+    void CModelImplicitEvaluator::evaluateBatch(double const* pInputs,
+                                                double* pOutputs,
+                                                uint64_t nPointCount)
+    {
+        evaluateChunks(pInputs, Layout{1, static_cast<size_t>(nPointCount)},
+                       pOutputs, Layout{1, static_cast<size_t>(nPointCount)}, nPointCount);
+    }
+
+    void CModelImplicitEvaluator::evaluateInterval(implicit::Interval const* pInputs,
+                                                   implicit::Interval* pOutputs) const
+    {
+        if ((!pInputs && !m_inputRegisters.empty()) || (!pOutputs && !m_outputRegisters.empty()))
+        {
+            throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM);
+        }
+
+        std::vector<implicit::Interval> registers(m_registerCount, implicit::makeInterval(0.));
+        for (auto const& constant : m_constants)
+        {
+            registers[constant.first] = implicit::makeInterval(constant.second);
+        }
+        for (size_t i = 0; i < m_inputRegisters.size(); ++i)
+        {
+            registers[m_inputRegisters[i]] = pInputs[i];
+        }
+
+        for (auto const& instruction : m_tape)
+        {
+            // Samples are bounded by the value range of the image, as long as they are defined
+            if (instruction.op == implicit::OpCode::ImageSample)
+            {
+                implicit::Interval result = implicit::infiniteInterval();
+                if (implicit::isBounded(registers[instruction.a]) && implicit::isBounded(registers[instruction.b]) &&
+                    implicit::isBounded(registers[instruction.c]))
+                {
+                    auto const& imageChannel = m_imageChannels[static_cast<size_t>(registers[instruction.d].m_min)];
+                    imageChannel.first->getValueRange(result.m_min, result.m_max);
+                    // The filter weights of a sample may not sum up to exactly one
+                    double const margin = 16. * std::numeric_limits<double>::epsilon() *
+                                              std::max(std::abs(result.m_min), std::abs(result.m_max)) +
+                                          std::numeric_limits<double>::min();
+                    result.m_min -= margin;
+                    result.m_max += margin;
+                }
+                registers[instruction.result] = result;
+                continue;
+            }
+            registers[instruction.result] = implicit::applyIntervalOperation(instruction.op,
+                                                                             registers[instruction.a],
+                                                                             registers[instruction.b],
+                                                                             registers[instruction.c],
+                                                                             registers[instruction.d]);
+        }
+
+        for (size_t i = 0; i < m_outputRegisters.size(); ++i)
+        {
+            pOutputs[i] = registers[m_outputRegisters[i]];
+        }
+    }
+}  // namespace NMR
@@ -0,0 +1,382 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+#include "Model/Classes/NMR_ModelImplicitInterval.h"
+
+#include "lib3mf_interfaceexception.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace NMR
+{
+    namespace implicit
+    {
+        namespace
+        {
+            double const Pi = 3.14159265358979323846;
+            double const TwoPi = 2. * Pi;
+            double const RoundingMargin = 4. * std::numeric_limits<double>::epsilon();
+
+            Interval hull(double a, double b, double c, double d)
+            {
+                return makeInterval(std::min(std::min(a, b), std::min(c, d)),
+                                    std::max(std::max(a, b), std::max(c, d)));
+            }
+
+            Interval hull(Interval const& a, Interval const& b)
+            {
+                return makeInterval(std::min(a.m_min, b.m_min), std::max(a.m_max, b.m_max));
+            }
+
+            // Functions, which do not decrease
+            template <typename Function>
+            Interval monotone(Interval const& a, Function function)
+            {
+                return makeInterval(function(a.m_min), function(a.m_max));
+            }
+
+            // True if phase + k * period lies in the interval for some integer k
+            bool containsPeriodicPoint(Interval const& a, double phase, double period)
+            {
+                double const k = std::ceil((a.m_min - phase) / period);
+                return phase + k * period <= a.m_max;
+            }
+
+            Interval multiply(Interval const& a, Interval const& b)
+            {
+                return hull(a.m_min * b.m_min, a.m_min * b.m_max, a.m_max * b.m_min, a.m_max * b.m_max);
+            }
+
+            Interval divide(Interval const& a, Interval const& b)
+            {
+                if (b.m_min <= 0. && b.m_max >= 0.)
+                {
+                    return infiniteInterval();
+                }
+                return multiply(a, makeInterval(1. / b.m_max, 1. / b.m_min));
+            }
+
+            Interval minimum(Interval const& a, Interval const& b)
+            {
+                return makeInterval(std::min(a.m_min, b.m_min), std::min(a.m_max, b.m_max));
+            }
+
+            Interval maximum(Interval const& a, Interval const& b)
+            {
+                return makeInterval(std::max(a.m_min, b.m_min), std::max(a.m_max, b.m_max));
+            }
+
+            Interval absolute(Interval const& a)
+            {
+                if (a.m_min >= 0.)
+                {
+                    return a;
+                }
+                if (a.m_max <= 0.)
+                {
+                    return makeInterval(-a.m_max, -a.m_min);
+                }
+                return makeInterval(0., std::max(-a.m_min, a.m_max));
+            }
+
+            // Bounds of sin or cos, which take their maximum at maximumPhase + 2 k pi
+            // and their minimum half a period later
+            template <typename Function>
+            Interval periodic(Interval const& a, Function function, double maximumPhase)
+            {
+                if (a.m_max - a.m_min >= TwoPi)
+                {
+                    return makeInterval(-1., 1.);
+                }
+                double const first = function(a.m_min);
+                double const last = function(a.m_max);
+                Interval result = makeInterval(std::min(first, last), std::max(first, last));
+                if (containsPeriodicPoint(a, maximumPhase, TwoPi))
+                {
+                    result.m_max = 1.;
+                }
+                if (containsPeriodicPoint(a, maximumPhase + Pi, TwoPi))
+                {
+                    result.m_min = -1.;
+                }
+                return result;
+            }
+
+            // Integer powers of an arbitrary base
+            Interval integerPower(Interval const& a, double exponent)
+            {
+                if (exponent == 0.)
+                {
+                    return makeInterval(1.);
+                }
+                if (exponent < 0.)
+                {
+                    return divide(makeInterval(1.), integerPower(a, -exponent));
+                }
+                bool const isEven = (std::fmod(exponent, 2.) == 0.);
+                if (isEven)
+                {
+                    Interval const base = absolute(a);
+                    return makeInterval(std::pow(base.m_min, exponent), std::pow(base.m_max, exponent));
+                }
+                return monotone(a, [exponent](double x) { return std::pow(x, exponent); });
+            }
+
+            Interval power(Interval const& a, Interval const& b)
+            {
+                // For positive bases pow is monotone along every edge of the
+                // box of the operands, so the extremes are at its corners
+                if (a.m_min > 0.)
+                {
+                    return hull(std::pow(a.m_min, b.m_min), std::pow(a.m_min, b.m_max),
+                                std::pow(a.m_max, b.m_min), std::pow(a.m_max, b.m_max));
+                }
+                if (b.m_min == b.m_max && std::floor(b.m_min) == b.m_min)
+                {
+                    return integerPower(a, b.m_min);
+                }
+                return infiniteInterval();
+            }
+
+            Interval arcTan2(Interval const& y, Interval const& x)
+            {
+                // Away from the branch cut atan2 is monotone along every edge
+                // of the box of the operands
+                if (x.m_min > 0. || y.m_min > 0. || y.m_max < 0.)
+                {
+                    return hull(std::atan2(y.m_min, x.m_min), std::atan2(y.m_min, x.m_max),
+                                std::atan2(y.m_max, x.m_min), std::atan2(y.m_max, x.m_max));
+                }
+                return makeInterval(-Pi, Pi);
+            }
+
+            // The result takes the sign of the dividend and is smaller than the divisor
+            Interval fmodInterval(Interval const& a, Interval const& b)
+            {
+                if (b.m_min <= 0. && b.m_max >= 0.)
+                {
+                    return infiniteInterval();
+                }
+                double const limit = std::max(std::abs(b.m_min), std::abs(b.m_max));
+                return makeInterval(std::max(std::min(a.m_min, 0.), -limit),
+                                    std::min(std::max(a.m_max, 0.), limit));
+            }
+
+            // The result takes the sign of the divisor and is smaller than the divisor
+            Interval modInterval(Interval const& a, Interval const& b)
+            {
+                if (b.m_min <= 0. && b.m_max >= 0.)
+                {
+                    return infiniteInterval();
+                }
+                if (b.m_min > 0.)
+                {
+                    if (a.m_min >= 0. && a.m_max < b.m_min)
+                    {
+                        return a;
+                    }
+                    return makeInterval(0., b.m_max);
+                }
+                return makeInterval(b.m_min, 0.);
+            }
+
+            Interval applyToBounds(OpCode op, Interval a, Interval b, Interval c, Interval d)
+            {
+                switch (op)
+                {
+                    case OpCode::Add:
+                        return makeInterval(a.m_min + b.m_min, a.m_max + b.m_max);
+                    case OpCode::Sub:
+                        return makeInterval(a.m_min - b.m_max, a.m_max - b.m_min);
+                    case OpCode::Mul:
+                        return multiply(a, b);
+                    case OpCode::Div:
+                        return divide(a, b);
+                    case OpCode::Neg:
+                        return makeInterval(-a.m_max, -a.m_min);
+                    case OpCode::Sin:
+                        return periodic(a, [](double x) { return std::sin(x); }, Pi / 2.);
+                    case OpCode::Cos:
+                        return periodic(a, [](double x) { return std::cos(x); }, 0.);
+                    case OpCode::Tan:
+                        if (a.m_max - a.m_min >= Pi || containsPeriodicPoint(a, Pi / 2., Pi))
+                        {
+                            return infiniteInterval();
+                        }
+                        return monotone(a, [](double x) { return std::tan(x); });
+                    case OpCode::ArcSin:
+                        if (a.m_min < -1. || a.m_max > 1.)
+                        {
+                            return infiniteInterval();
+                        }
+                        return monotone(a, [](double x) { return std::asin(x); });
+                    case OpCode::ArcCos:
+                        if (a.m_min < -1. || a.m_max > 1.)
+                        {
+                            return infiniteInterval();
+                        }
+                        return makeInterval(std::acos(a.m_max), std::acos(a.m_min));
+                    case OpCode::ArcTan:
+                        return monotone(a, [](double x) { return std::atan(x); });
+                    case OpCode::ArcTan2:
+                        return arcTan2(a, b);
+                    case OpCode::Min:
+                        return minimum(a, b);
+                    case OpCode::Max:
+                        return maximum(a, b);
+                    case OpCode::Abs:
+                        return absolute(a);
+                    case OpCode::Fmod:
+                        return fmodInterval(a, b);
+                    case OpCode::Mod:
+                        return modInterval(a, b);
+                    case OpCode::Pow:
+                        return power(a, b);
+                    case OpCode::Sqrt:
+                        if (a.m_min < 0.)
+                        {
+                            return infiniteInterval();
+                        }
+                        return monotone(a, [](double x) { return std::sqrt(x); });
+                    case OpCode::Exp:
+                        return monotone(a, [](double x) { return std::exp(x); });
+                    case OpCode::Log:
+                        if (a.m_min <= 0.)
+                        {
+                            return infiniteInterval();
+                        }
+                        return monotone(a, [](double x) { return std::log(x); });
+                    case OpCode::Log2:
+                        if (a.m_min <= 0.)
+                        {
+                            return infiniteInterval();
+                        }
+                        return monotone(a, [](double x) { return std::log2(x); });
+                    case OpCode::Log10:
+                        if (a.m_min <= 0.)
+                        {
+                            return infiniteInterval();
+                        }
+                        return monotone(a, [](double x) { return std::log10(x); });
+                    case OpCode::Sinh:
+                        return monotone(a, [](double x) { return std::sinh(x); });
+                    case OpCode::Cosh:
+                    {
+                        double const first = std::cosh(a.m_min);
+                        double const last = std::cosh(a.m_max);
+                        double const lower = (a.m_min <= 0. && a.m_max >= 0.) ? 1. : std::min(first, last);
+                        return makeInterval(lower, std::max(first, last));
+                    }
+                    case OpCode::Tanh:
+                        return monotone(a, [](double x) { return std::tanh(x); });
+                    case OpCode::Round:
+                        return monotone(a, [](double x) { return std::round(x); });
+                    case OpCode::Ceil:
+                        return monotone(a, [](double x) { return std::ceil(x); });
+                    case OpCode::Floor:
+                        return monotone(a, [](double x) { return std::floor(x); });
+                    case OpCode::Sign:
+                        return monotone(a, [](double x) { return applyOperation(OpCode::Sign, x, x, x, x); });
+                    case OpCode::Fract:
+                        if (std::floor(a.m_min) != std::floor(a.m_max))
+                        {
+                            return makeInterval(0., 1.);
+                        }
+                        return makeInterval(a.m_min - std::floor(a.m_min), a.m_max - std::floor(a.m_min));
+                    case OpCode::Select:
+                        if (a.m_max < b.m_min)
+                        {
+                            return c;
+                        }
+                        if (a.m_min >= b.m_max)
+                        {
+                            return d;
+                        }
+                        return hull(c, d);
+                    case OpCode::Clamp:
+                        return minimum(maximum(a, b), c);
+                    // Bounded by the evaluator, which knows the image
+                    case OpCode::ImageSample:
+                        return infiniteInterval();
+                }
+                throw ELib3MFInterfaceException(LIB3MF_ERROR_INVALIDPARAM,
+                                                "Unknown operation " + std::to_string(static_cast<int>(op)));
+            }
+        }  // namespace
+
+        Interval makeInterval(double value)
+        {
+            return Interval{value, value};
+        }
+
+        Interval makeInterval(double minimum, double maximum)
+        {
+            if (std::isnan(minimum) || std::isnan(maximum))
+            {
+                return infiniteInterval();
+            }
+            return Interval{minimum, maximum};
+        }
+
+        Interval infiniteInterval()
+        {
+            return Interval{-std::numeric_limits<double>::infinity(),
+                            std::numeric_limits<double>::infinity()};
+        }
+
+        bool isBounded(Interval const& value)
+        {
+            return std::isfinite(value.m_min) && std::isfinite(value.m_max);
+        }
+
+        Interval applyIntervalOperation(OpCode op, Interval a, Interval b, Interval c, Interval d)
+        {
+            // Infinite operands give NaN for most operations
+            Interval const operands[] = {a, b, c, d};
+            unsigned int const operandCount = getOperandCount(op);
+            for (unsigned int index = 0; index < operandCount; ++index)
+            {
+                if (!isBounded(operands[index]))
+                {
+                    return infiniteInterval();
+                }
+            }
+
+            // Covers the rounding errors of the point evaluation, which may
+            // differ from the ones of the bounds, including denormal results
+            Interval result = applyToBounds(op, a, b, c, d);
+            double const margin = RoundingMargin * std::max(std::abs(result.m_min), std::abs(result.m_max)) +
+                                  std::numeric_limits<double>::min();
+            result.m_min -= margin;
+            result.m_max += margin;
+            return result;
+        }
+    }  // namespace implicit
+}  // namespace NMR
@@ -0,0 +1,148 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+#include "Model/Classes/NMR_ModelImplicitKernels.h"
+#include "Common/Platform/NMR_CPUFeatures.h"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace NMR
+{
+    namespace implicit
+    {
+        namespace kernels
+        {
+            namespace
+            {
+                struct BatchScalar
+                {
+                    using Type = double;
+                    static constexpr size_t Width = 1;
+
+                    static Type load(double const* p) { return *p; }
+                    static void store(double* p, Type v) { *p = v; }
+                    static Type add(Type a, Type b) { return a + b; }
+                    static Type sub(Type a, Type b) { return a - b; }
+                    static Type mul(Type a, Type b) { return a * b; }
+                    static Type div(Type a, Type b) { return a / b; }
+                    // Same operand order and NaN handling as the SIMD min and max
+                    static Type min(Type a, Type b) { return (a < b) ? a : b; }
+                    static Type max(Type a, Type b) { return (a > b) ? a : b; }
+                    static Type sqrt(Type a) { return std::sqrt(a); }
+                    static Type abs(Type a) { return std::abs(a); }
+                    static Type neg(Type a) { return -a; }
+                    static Type select(Type a, Type b, Type c, Type d) { return (a < b) ? c : d; }
+                };
+
+                size_t getMaximumWidth()
+                {
+                    char const* pszWidth = std::getenv(NMR_IMPLICIT_KERNELWIDTH_ENVIRONMENT);
+                    if (pszWidth != nullptr)
+                    {
+                        char* pEnd = nullptr;
+                        unsigned long const nWidth = std::strtoul(pszWidth, &pEnd, 10);
+                        if ((pEnd != pszWidth) && (*pEnd == 0) && (nWidth > 0))
+                        {
+                            return static_cast<size_t>(nWidth);
+                        }
+                    }
+                    return CModelImplicitEvaluator::LaneCount;
+                }
+
+                BatchKernel selectBatchKernel()
+                {
+                    size_t const nMaximumWidth = getMaximumWidth();
+                    struct Candidate
+                    {
+                        eCPUInstructionSet m_instructionSet;
+                        BatchKernel (*m_pGetKernel)();
+                    };
+                    Candidate const candidates[] = {{CPUINSTRUCTIONSET_AVX512, &getBatchKernelAVX512},
+                                                    {CPUINSTRUCTIONSET_AVX2, &getBatchKernelAVX2},
+                                                    {CPUINSTRUCTIONSET_SSE2, &getBatchKernelSSE2}};
+
+                    for (auto const& candidate : candidates)
+                    {
+                        if (!fnCPUSupportsInstructionSet(candidate.m_instructionSet))
+                        {
+                            continue;
+                        }
+                        BatchKernel const kernel = candidate.m_pGetKernel();
+                        if ((kernel.m_nWidth > 0) && (kernel.m_nWidth <= nMaximumWidth))
+                        {
+                            return kernel;
+                        }
+                    }
+                    return {BatchScalar::Width, &applyBatch<BatchScalar>};
+                }
+
+                BatchKernel const& getBatchKernel()
+                {
+                    static BatchKernel const kernel = selectBatchKernel();
+                    return kernel;
+                }
+            }  // namespace
+
+            size_t getBatchWidth()
+            {
+                return getBatchKernel().m_nWidth;
+            }
+
+            void applyInstruction(OpCode op,
+                                  double* result,
+                                  double const* a,
+                                  double const* b,
+                                  double const* c,
+                                  double const* d,
+                                  size_t nCount)
+            {
+                if (getBatchKernel().m_pApply(op, result, a, b, c, d, nCount))
+                {
+                    return;
+                }
+
+                switch (op)
+                {
+                    case OpCode::Sin:
+                        for (size_t i = 0; i < nCount; ++i)
+                            result[i] = std::sin(a[i]);
+                        break;
+                    case OpCode::Cos:
+                        for (size_t i = 0; i < nCount; ++i)
+                            result[i] = std::cos(a[i]);
+                        break;
+                    default:
+                        for (size_t i = 0; i < nCount; ++i)
+                            result[i] = applyOperation(op, a[i], b[i], c[i], d[i]);
+                        break;
+                }
+            }
+        }  // namespace kernels
+    }  // namespace implicit
+}  // namespace NMR
@@ -0,0 +1,83 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+// Compiled with AVX2 enabled, see Source/CMakeLists.txt. Nothing but the
+// batch operations may be used here, see applyBatch.
+
+#include "Model/Classes/NMR_ModelImplicitKernels.h"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#endif
+
+namespace NMR
+{
+    namespace implicit
+    {
+        namespace kernels
+        {
+#if defined(__AVX2__)
+            namespace
+            {
+                struct BatchAVX2
+                {
+                    using Type = __m256d;
+                    static constexpr size_t Width = 4;
+
+                    static Type load(double const* p) { return _mm256_loadu_pd(p); }
+                    static void store(double* p, Type v) { _mm256_storeu_pd(p, v); }
+                    static Type add(Type a, Type b) { return _mm256_add_pd(a, b); }
+                    static Type sub(Type a, Type b) { return _mm256_sub_pd(a, b); }
+                    static Type mul(Type a, Type b) { return _mm256_mul_pd(a, b); }
+                    static Type div(Type a, Type b) { return _mm256_div_pd(a, b); }
+                    static Type min(Type a, Type b) { return _mm256_min_pd(a, b); }
+                    static Type max(Type a, Type b) { return _mm256_max_pd(a, b); }
+                    static Type sqrt(Type a) { return _mm256_sqrt_pd(a); }
+                    static Type abs(Type a) { return _mm256_andnot_pd(_mm256_set1_pd(-0.), a); }
+                    static Type neg(Type a) { return _mm256_xor_pd(a, _mm256_set1_pd(-0.)); }
+                    // a < b ? c : d
+                    static Type select(Type a, Type b, Type c, Type d)
+                    {
+                        return _mm256_blendv_pd(d, c, _mm256_cmp_pd(a, b, _CMP_LT_OQ));
+                    }
+                };
+            }  // namespace
+
+            BatchKernel getBatchKernelAVX2()
+            {
+                return {BatchAVX2::Width, &applyBatch<BatchAVX2>};
+            }
+#else
+            BatchKernel getBatchKernelAVX2()
+            {
+                return {0, nullptr};
+            }
+#endif
+        }  // namespace kernels
+    }  // namespace implicit
+}  // namespace NMR
@@ -0,0 +1,91 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+// Compiled with AVX-512F enabled, see Source/CMakeLists.txt. Nothing but the
+// batch operations may be used here, see applyBatch.
+
+#include "Model/Classes/NMR_ModelImplicitKernels.h"
+
+#if defined(__AVX512F__)
+// The AVX-512 intrinsics of GCC pass _mm512_undefined_pd() as the unused merge operand
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+#include <immintrin.h>
+#endif
+
+namespace NMR
+{
+    namespace implicit
+    {
+        namespace kernels
+        {
+#if defined(__AVX512F__)
+            namespace
+            {
+                struct BatchAVX512
+                {
+                    using Type = __m512d;
+                    static constexpr size_t Width = 8;
+
+                    static Type load(double const* p) { return _mm512_loadu_pd(p); }
+                    static void store(double* p, Type v) { _mm512_storeu_pd(p, v); }
+                    static Type add(Type a, Type b) { return _mm512_add_pd(a, b); }
+                    static Type sub(Type a, Type b) { return _mm512_sub_pd(a, b); }
+                    static Type mul(Type a, Type b) { return _mm512_mul_pd(a, b); }
+                    static Type div(Type a, Type b) { return _mm512_div_pd(a, b); }
+                    static Type min(Type a, Type b) { return _mm512_min_pd(a, b); }
+                    static Type max(Type a, Type b) { return _mm512_max_pd(a, b); }
+                    static Type sqrt(Type a) { return _mm512_sqrt_pd(a); }
+                    static Type abs(Type a) { return _mm512_abs_pd(a); }
+                    static Type neg(Type a)
+                    {
+                        return _mm512_castsi512_pd(_mm512_xor_si512(
+                            _mm512_castpd_si512(a), _mm512_castpd_si512(_mm512_set1_pd(-0.))));
+                    }
+                    // a < b ? c : d
+                    static Type select(Type a, Type b, Type c, Type d)
+                    {
+                        return _mm512_mask_blend_pd(_mm512_cmp_pd_mask(a, b, _CMP_LT_OQ), d, c);
+                    }
+                };
+            }  // namespace
+
+            BatchKernel getBatchKernelAVX512()
+            {
+                return {BatchAVX512::Width, &applyBatch<BatchAVX512>};
+            }
+#else
+            BatchKernel getBatchKernelAVX512()
+            {
+                return {0, nullptr};
+            }
+#endif
+        }  // namespace kernels
+    }  // namespace implicit
+}  // namespace NMR
@@ -0,0 +1,84 @@
+/*++
+
+Copyright (C) 2023 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+--*/
+
+// Compiled with SSE2 enabled, see Source/CMakeLists.txt. Nothing but the
+// batch operations may be used here, see applyBatch.
+
+#include "Model/Classes/NMR_ModelImplicitKernels.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+#include <emmintrin.h>
+#endif
+
+namespace NMR
+{
+    namespace implicit
+    {
+        namespace kernels
+        {
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+            namespace
+            {
+                struct BatchSSE2
+                {
+                    using Type = __m128d;
+                    static constexpr size_t Width = 2;
+
+                    static Type load(double const* p) { return _mm_loadu_pd(p); }
+                    static void store(double* p, Type v) { _mm_storeu_pd(p, v); }
+                    static Type add(Type a, Type b) { return _mm_add_pd(a, b); }
+                    static Type sub(Type a, Type b) { return _mm_sub_pd(a, b); }
+                    static Type mul(Type a, Type b) { return _mm_mul_pd(a, b); }
+                    static Type div(Type a, Type b) { return _mm_div_pd(a, b); }
+                    static Type min(Type a, Type b) { return _mm_min_pd(a, b); }
+                    static Type max(Type a, Type b) { return _mm_max_pd(a, b); }
+                    static Type sqrt(Type a) { return _mm_sqrt_pd(a); }
+                    static Type abs(Type a) { return _mm_andnot_pd(_mm_set1_pd(-0.), a); }
+                    static Type neg(Type a) { return _mm_xor_pd(a, _mm_set1_pd(-0.)); }
+                    // a < b ? c : d
+                    static Type select(Type a, Type b, Type c, Type d)
+                    {
+                        Type const mask = _mm_cmplt_pd(a, b);
+                        return _mm_or_pd(_mm_and_pd(mask, c), _mm_andnot_pd(mask, d));
+                    }
+                };
+            }  // namespace
+
+            BatchKernel getBatchKernelSSE2()
+            {
+                return {BatchSSE2::Width, &applyBatch<BatchSSE2>};
+            }
+#else
+            BatchKernel getBatchKernelSSE2()
+            {
+                return {0, nullptr};
+            }
+#endif
+        }  // namespace kernels
+    }  // namespace implicit
+}  // namespace NMR
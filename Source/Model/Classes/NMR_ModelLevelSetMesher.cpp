@@ -0,0 +1,526 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelLevelSetMesher.cpp implements the class CModelLevelSetMesher.
+
+The grid is processed in bricks of NMR_LEVELSET_BRICKCELLS^3 cells. An octree
+over the bricks bounds the levelset function with interval arithmetic and
+drops blocks, which are entirely inside or outside. Every remaining brick is
+evaluated with one batch call of the compiled levelset function and
+triangulated independently, bricks without a sign change are skipped.
+Each cube of the grid is split into six tetrahedra along its main diagonal,
+which gives a watertight, consistently oriented surface without the
+ambiguities of marching cubes. Negative function values are inside.
+
+--*/
+
+#include "Model/Classes/NMR_ModelLevelSetMesher.h"
+
+#include "Common/Math/NMR_Matrix.h"
+#include "Common/Math/NMR_Vector.h"
+#include "Common/Mesh/NMR_Mesh.h"
+#include "Common/NMR_Exception.h"
+#include "Common/NMR_ThreadPool.h"
+#include "Model/Classes/NMR_ModelImplicitFunction.h"
+#include "Model/Classes/NMR_ModelImplicitInterval.h"
+#include "Model/Classes/NMR_ModelLevelSetObject.h"
+#include "Model/Classes/NMR_ModelMeshObject.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_map>
+
+namespace NMR {
+
+	namespace {
+
+		nfUint32 fnPortComponentCount(_In_ Lib3MF::eImplicitPortType ePortType)
+		{
+			switch (ePortType) {
+			case Lib3MF::eImplicitPortType::Scalar: return 1;
+			case Lib3MF::eImplicitPortType::Vector: return 3;
+			case Lib3MF::eImplicitPortType::Matrix: return 16;
+			default: return 0;
+			}
+		}
+
+		// The six tetrahedra of a cube, given by cube corners (bit 0: x, bit 1: y, bit 2: z).
+		// Every tetrahedron walks from corner 0 to corner 7 along one permutation of the axes.
+		const nfUint32 LEVELSET_TETRAHEDRA[6][4] = {
+			{ 0, 1, 3, 7 },
+			{ 0, 1, 5, 7 },
+			{ 0, 2, 3, 7 },
+			{ 0, 2, 6, 7 },
+			{ 0, 4, 5, 7 },
+			{ 0, 4, 6, 7 },
+		};
+
+	}
+
+	CModelLevelSetMesher::CModelLevelSetMesher(_In_ CModelLevelSetObject & LevelSet)
+	{
+		PModelMeshObject pMeshObject = LevelSet.getMesh();
+		if (!pMeshObject)
+			throw CNMRException(NMR_ERROR_LEVELSET_MISSING_MESH);
+
+		auto pFunction = std::dynamic_pointer_cast<CModelImplicitFunction>(LevelSet.getFunction());
+		if (!pFunction)
+			throw CNMRException(NMR_ERROR_LEVELSET_UNSUPPORTED_FUNCTION);
+
+		// The function is evaluated at a single position
+		auto & Inputs = *pFunction->getInputs();
+		if ((Inputs.size() != 1) || (Inputs[0]->getType() != Lib3MF::eImplicitPortType::Vector))
+			throw CNMRException(NMR_ERROR_LEVELSET_UNSUPPORTED_FUNCTION);
+
+		// Without a channel name, the first output is used
+		const std::string & sChannelName = LevelSet.getChannelName();
+		nfUint32 nOffset = 0;
+		nfBool bFoundChannel = false;
+		for (auto & pOutput : *pFunction->getOutputs()) {
+			if (sChannelName.empty() || (pOutput->getIdentifier() == sChannelName)) {
+				if (pOutput->getType() != Lib3MF::eImplicitPortType::Scalar)
+					throw CNMRException(NMR_ERROR_LEVELSET_INVALID_CHANNEL);
+				m_nChannelOffset = nOffset;
+				bFoundChannel = true;
+				break;
+			}
+			nOffset += fnPortComponentCount(pOutput->getType());
+		}
+		if (!bFoundChannel)
+			throw CNMRException(NMR_ERROR_LEVELSET_INVALID_CHANNEL);
+
+		m_pEvaluator = std::make_shared<CModelImplicitEvaluator>(*pFunction);
+		m_nOutputStride = (nfUint32)m_pEvaluator->getOutputStride();
+		m_mTransform = LevelSet.getTransform();
+		m_dFallBackValue = LevelSet.getFallBackValue();
+
+		NOUTBOX3 oDomain;
+		fnOutboxInitialize(oDomain);
+		pMeshObject->getMesh()->extendOutbox(oDomain, fnMATRIX3_identity());
+		m_bEmptyDomain = !fnOutboxIsValid(oDomain);
+
+		nfDouble dMaxExtent = 0.0;
+		for (nfUint32 j = 0; j < 3; j++) {
+			m_vDomainMin[j] = oDomain.m_min.m_fields[j];
+			m_vDomainMax[j] = oDomain.m_max.m_fields[j];
+			if (!m_bEmptyDomain)
+				dMaxExtent = std::max(dMaxExtent, m_vDomainMax[j] - m_vDomainMin[j]);
+		}
+
+		// Two samples per minimal feature
+		nfDouble dCellSize = LevelSet.getMinFeatureSize() / 2.0;
+		if (dCellSize <= 0.0)
+			dCellSize = dMaxExtent / NMR_LEVELSET_DEFAULTCELLSPERAXIS;
+		if (dCellSize <= 0.0)
+			dCellSize = 1.0;
+		setCellSize(dCellSize);
+	}
+
+	nfDouble CModelLevelSetMesher::getCellSize()
+	{
+		return m_dCellSize;
+	}
+
+	void CModelLevelSetMesher::setCellSize(_In_ nfDouble dCellSize)
+	{
+		if (!(dCellSize > 0.0) || !std::isfinite(dCellSize))
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		nfDouble dMaxExtent = 0.0;
+		if (!m_bEmptyDomain) {
+			for (nfUint32 j = 0; j < 3; j++)
+				dMaxExtent = std::max(dMaxExtent, m_vDomainMax[j] - m_vDomainMin[j]);
+		}
+		m_dCellSize = std::max(dCellSize, dMaxExtent / NMR_LEVELSET_MAXCELLSPERAXIS);
+
+		for (nfUint32 j = 0; j < 3; j++) {
+			nfDouble dExtent = m_bEmptyDomain ? 0.0 : (m_vDomainMax[j] - m_vDomainMin[j]);
+			m_nCellCount[j] = (nfUint32)std::ceil(dExtent / m_dCellSize) + 2;
+			m_vGridOrigin[j] = m_vDomainMin[j] - m_dCellSize;
+			m_nBrickCount[j] = (m_nCellCount[j] + NMR_LEVELSET_BRICKCELLS - 1) / NMR_LEVELSET_BRICKCELLS;
+		}
+	}
+
+	nfBool CModelLevelSetMesher::mayContainSurface(_In_ const std::array<nfUint32, 3> & vFirstCell, _In_ const std::array<nfUint32, 3> & vCellCount)
+	{
+		// The positions are computed like in evaluateBrick, so the rounded grid
+		// vertices lie within the bounds
+		implicit::Interval Box[3];
+		implicit::Interval BoxDistance = implicit::makeInterval(-std::numeric_limits<nfDouble>::infinity());
+		for (nfUint32 nAxis = 0; nAxis < 3; nAxis++) {
+			Box[nAxis] = implicit::makeInterval(m_vGridOrigin[nAxis] + vFirstCell[nAxis] * m_dCellSize,
+				m_vGridOrigin[nAxis] + (vFirstCell[nAxis] + vCellCount[nAxis]) * m_dCellSize);
+
+			nfDouble dCenter = (m_vDomainMin[nAxis] + m_vDomainMax[nAxis]) / 2.0;
+			nfDouble dHalfSize = (m_vDomainMax[nAxis] - m_vDomainMin[nAxis]) / 2.0;
+			nfDouble dLower = Box[nAxis].m_min - dCenter;
+			nfDouble dUpper = Box[nAxis].m_max - dCenter;
+			nfDouble dMinDistance = ((dLower <= 0.0) && (dUpper >= 0.0)) ? 0.0 : std::min(std::abs(dLower), std::abs(dUpper));
+			nfDouble dMaxDistance = std::max(std::abs(dLower), std::abs(dUpper));
+			BoxDistance.m_min = std::max(BoxDistance.m_min, dMinDistance - dHalfSize);
+			BoxDistance.m_max = std::max(BoxDistance.m_max, dMaxDistance - dHalfSize);
+		}
+
+		// Affine transform of the box, widened by the rounding error of the sums
+		implicit::Interval Positions[3];
+		for (nfUint32 nAxis = 0; nAxis < 3; nAxis++) {
+			nfDouble dMin = m_mTransform.m_fields[nAxis][3];
+			nfDouble dMax = m_mTransform.m_fields[nAxis][3];
+			nfDouble dMagnitude = std::abs(m_mTransform.m_fields[nAxis][3]);
+			for (nfUint32 j = 0; j < 3; j++) {
+				nfDouble dFirst = m_mTransform.m_fields[nAxis][j] * Box[j].m_min;
+				nfDouble dLast = m_mTransform.m_fields[nAxis][j] * Box[j].m_max;
+				dMin += std::min(dFirst, dLast);
+				dMax += std::max(dFirst, dLast);
+				dMagnitude += std::max(std::abs(dFirst), std::abs(dLast));
+			}
+			nfDouble dMargin = 4.0 * std::numeric_limits<nfDouble>::epsilon() * dMagnitude;
+			Positions[nAxis] = implicit::makeInterval(dMin - dMargin, dMax + dMargin);
+		}
+
+		std::vector<implicit::Interval> Outputs(m_nOutputStride);
+		m_pEvaluator->evaluateInterval(Positions, Outputs.data());
+
+		// Unbounded values may be replaced by the fallback value
+		implicit::Interval Value = Outputs[m_nChannelOffset];
+		if (!implicit::isBounded(Value)) {
+			Value.m_min = std::min(Value.m_min, m_dFallBackValue);
+			Value.m_max = std::max(Value.m_max, m_dFallBackValue);
+		}
+		Value.m_min = std::max(Value.m_min, BoxDistance.m_min);
+		Value.m_max = std::max(Value.m_max, BoxDistance.m_max);
+
+		// Negative values are inside
+		return (Value.m_min < 0.0) && (Value.m_max >= 0.0);
+	}
+
+	void CModelLevelSetMesher::collectBricks(_In_ const std::array<nfUint32, 3> & vFirstBrick, _In_ const std::array<nfUint32, 3> & vBrickCount, _Inout_ std::vector<nfUint32> & Bricks)
+	{
+		std::array<nfUint32, 3> vFirstCell;
+		std::array<nfUint32, 3> vCellCount;
+		for (nfUint32 j = 0; j < 3; j++) {
+			vFirstCell[j] = vFirstBrick[j] * NMR_LEVELSET_BRICKCELLS;
+			vCellCount[j] = std::min(vBrickCount[j] * NMR_LEVELSET_BRICKCELLS, m_nCellCount[j] - vFirstCell[j]);
+		}
+		if (!mayContainSurface(vFirstCell, vCellCount))
+			return;
+
+		if ((vBrickCount[0] == 1) && (vBrickCount[1] == 1) && (vBrickCount[2] == 1)) {
+			Bricks.push_back(vFirstBrick[0] + m_nBrickCount[0] * (vFirstBrick[1] + m_nBrickCount[1] * vFirstBrick[2]));
+			return;
+		}
+
+		// Axes with a single brick are not split
+		for (nfUint32 nOctant = 0; nOctant < 8; nOctant++) {
+			std::array<nfUint32, 3> vChildFirst;
+			std::array<nfUint32, 3> vChildCount;
+			nfBool bEmpty = false;
+			for (nfUint32 j = 0; j < 3; j++) {
+				nfUint32 nLowerCount = (vBrickCount[j] + 1) / 2;
+				if ((nOctant >> j) & 1) {
+					vChildFirst[j] = vFirstBrick[j] + nLowerCount;
+					vChildCount[j] = vBrickCount[j] - nLowerCount;
+				}
+				else {
+					vChildFirst[j] = vFirstBrick[j];
+					vChildCount[j] = nLowerCount;
+				}
+				bEmpty = bEmpty || (vChildCount[j] == 0);
+			}
+			if (!bEmpty)
+				collectBricks(vChildFirst, vChildCount, Bricks);
+		}
+	}
+
+	void CModelLevelSetMesher::evaluateBrick(_In_ const std::array<nfUint32, 3> & vFirstCell, _In_ const std::array<nfUint32, 3> & vCellCount, _Out_ std::vector<nfDouble> & Values)
+	{
+		const nfUint32 nSizeX = vCellCount[0] + 1;
+		const nfUint32 nSizeY = vCellCount[1] + 1;
+		const nfUint32 nSizeZ = vCellCount[2] + 1;
+		const size_t nPointCount = (size_t)nSizeX * nSizeY * nSizeZ;
+
+		std::array<nfDouble, 3> vCenter;
+		std::array<nfDouble, 3> vHalfSize;
+		for (nfUint32 j = 0; j < 3; j++) {
+			vCenter[j] = (m_vDomainMin[j] + m_vDomainMax[j]) / 2.0;
+			vHalfSize[j] = (m_vDomainMax[j] - m_vDomainMin[j]) / 2.0;
+		}
+
+		// Positions in function coordinates, one array per axis
+		std::vector<nfDouble> Positions(nPointCount * 3);
+		std::vector<nfDouble> BoxDistances(nPointCount);
+		size_t nIndex = 0;
+		for (nfUint32 k = 0; k < nSizeZ; k++) {
+			for (nfUint32 j = 0; j < nSizeY; j++) {
+				for (nfUint32 i = 0; i < nSizeX; i++) {
+					nfDouble vPoint[3] = {
+						m_vGridOrigin[0] + (vFirstCell[0] + i) * m_dCellSize,
+						m_vGridOrigin[1] + (vFirstCell[1] + j) * m_dCellSize,
+						m_vGridOrigin[2] + (vFirstCell[2] + k) * m_dCellSize
+					};
+
+					nfDouble dBoxDistance = -std::numeric_limits<nfDouble>::infinity();
+					for (nfUint32 nAxis = 0; nAxis < 3; nAxis++)
+						dBoxDistance = std::max(dBoxDistance, std::abs(vPoint[nAxis] - vCenter[nAxis]) - vHalfSize[nAxis]);
+					BoxDistances[nIndex] = dBoxDistance;
+
+					for (nfUint32 nAxis = 0; nAxis < 3; nAxis++) {
+						Positions[nAxis * nPointCount + nIndex] = m_mTransform.m_fields[nAxis][0] * vPoint[0] +
+							m_mTransform.m_fields[nAxis][1] * vPoint[1] + m_mTransform.m_fields[nAxis][2] * vPoint[2] +
+							m_mTransform.m_fields[nAxis][3];
+					}
+					nIndex++;
+				}
+			}
+		}
+
+		// The evaluator runs on the calling thread, so bricks can be evaluated concurrently
+		std::vector<nfDouble> Outputs(nPointCount * m_nOutputStride);
+		m_pEvaluator->evaluateBatch(Positions.data(), Outputs.data(), nPointCount);
+
+		// The surface is clipped to the domain by intersecting it with the domain box
+		Values.resize(nPointCount);
+		const nfDouble * pChannel = Outputs.data() + (size_t)m_nChannelOffset * nPointCount;
+		for (nIndex = 0; nIndex < nPointCount; nIndex++) {
+			nfDouble dValue = pChannel[nIndex];
+			if (!std::isfinite(dValue))
+				dValue = m_dFallBackValue;
+			Values[nIndex] = std::max(dValue, BoxDistances[nIndex]);
+		}
+	}
+
+	void CModelLevelSetMesher::triangulateBrick(_In_ nfUint32 nBrickIndex, _Out_ sBrickResult & Result)
+	{
+		std::array<nfUint32, 3> vBrick = {
+			nBrickIndex % m_nBrickCount[0],
+			(nBrickIndex / m_nBrickCount[0]) % m_nBrickCount[1],
+			nBrickIndex / (m_nBrickCount[0] * m_nBrickCount[1])
+		};
+
+		std::array<nfUint32, 3> vFirstCell;
+		std::array<nfUint32, 3> vCellCount;
+		for (nfUint32 j = 0; j < 3; j++) {
+			vFirstCell[j] = vBrick[j] * NMR_LEVELSET_BRICKCELLS;
+			vCellCount[j] = std::min((nfUint32)NMR_LEVELSET_BRICKCELLS, m_nCellCount[j] - vFirstCell[j]);
+		}
+
+		std::vector<nfDouble> Values;
+		evaluateBrick(vFirstCell, vCellCount, Values);
+
+		auto fnIsInside = [](nfDouble dValue) { return dValue < 0.0; };
+		nfUint32 nInsideCount = (nfUint32)std::count_if(Values.begin(), Values.end(), fnIsInside);
+		if ((nInsideCount == 0) || (nInsideCount == Values.size()))
+			return;
+
+		const nfUint32 nSizeX = vCellCount[0] + 1;
+		const nfUint32 nSizeY = vCellCount[1] + 1;
+		const nfUint64 nGridSizeX = (nfUint64)m_nCellCount[0] + 1;
+		const nfUint64 nGridSizeY = (nfUint64)m_nCellCount[1] + 1;
+
+		std::unordered_map<nfUint64, nfUint32> VertexMap;
+
+		for (nfUint32 k = 0; k < vCellCount[2]; k++) {
+			for (nfUint32 j = 0; j < vCellCount[1]; j++) {
+				for (nfUint32 i = 0; i < vCellCount[0]; i++) {
+					nfDouble CornerValues[8];
+					nfUint64 CornerKeys[8];
+					nfDouble CornerPositions[8][3];
+					nfUint32 nCellInsideCount = 0;
+
+					for (nfUint32 nCorner = 0; nCorner < 8; nCorner++) {
+						nfUint32 nI = i + (nCorner & 1);
+						nfUint32 nJ = j + ((nCorner >> 1) & 1);
+						nfUint32 nK = k + ((nCorner >> 2) & 1);
+						CornerValues[nCorner] = Values[nI + (size_t)nSizeX * (nJ + (size_t)nSizeY * nK)];
+						if (fnIsInside(CornerValues[nCorner]))
+							nCellInsideCount++;
+
+						nfUint64 nGridI = vFirstCell[0] + nI;
+						nfUint64 nGridJ = vFirstCell[1] + nJ;
+						nfUint64 nGridK = vFirstCell[2] + nK;
+						CornerKeys[nCorner] = nGridI + nGridSizeX * (nGridJ + nGridSizeY * nGridK);
+						CornerPositions[nCorner][0] = m_vGridOrigin[0] + nGridI * m_dCellSize;
+						CornerPositions[nCorner][1] = m_vGridOrigin[1] + nGridJ * m_dCellSize;
+						CornerPositions[nCorner][2] = m_vGridOrigin[2] + nGridK * m_dCellSize;
+					}
+					if ((nCellInsideCount == 0) || (nCellInsideCount == 8))
+						continue;
+
+					// Crossing on the edge between two corners of a tetrahedron. The corners of a
+					// tetrahedron are ordered by inclusion of their bits, so every edge is keyed
+					// by its lower corner and its direction, independent of the brick.
+					auto fnCrossing = [&](nfUint32 nCornerA, nfUint32 nCornerB) -> nfUint32 {
+						nfUint32 nLower = ((nCornerA & nCornerB) == nCornerA) ? nCornerA : nCornerB;
+						nfUint32 nUpper = nCornerA ^ nCornerB ^ nLower;
+						nfUint64 nEdgeKey = CornerKeys[nLower] * 8 + (nUpper & ~nLower);
+
+						auto iVertex = VertexMap.find(nEdgeKey);
+						if (iVertex != VertexMap.end())
+							return iVertex->second;
+
+						nfDouble dLower = CornerValues[nLower];
+						nfDouble dT = dLower / (dLower - CornerValues[nUpper]);
+						sBrickVertex Vertex;
+						Vertex.m_nEdgeKey = nEdgeKey;
+						for (nfUint32 nAxis = 0; nAxis < 3; nAxis++)
+							Vertex.m_vPosition.m_fields[nAxis] = (nfFloat)(CornerPositions[nLower][nAxis] + dT * (CornerPositions[nUpper][nAxis] - CornerPositions[nLower][nAxis]));
+
+						nfUint32 nVertexIndex = (nfUint32)Result.m_Vertices.size();
+						Result.m_Vertices.push_back(Vertex);
+						VertexMap.insert(std::make_pair(nEdgeKey, nVertexIndex));
+						return nVertexIndex;
+					};
+
+					// Triangles are oriented from the inside corners to the outside corners. The
+					// orientation is taken from the edge midpoints, as the crossings of a triangle
+					// may coincide at a corner with the value zero.
+					auto fnAddTriangle = [&](const nfUint32 (&Edges)[3][2], const nfDouble (&vOutward)[3]) {
+						nfDouble vMidpoints[3][3];
+						for (nfUint32 nEdge = 0; nEdge < 3; nEdge++) {
+							for (nfUint32 nAxis = 0; nAxis < 3; nAxis++)
+								vMidpoints[nEdge][nAxis] = (CornerPositions[Edges[nEdge][0]][nAxis] + CornerPositions[Edges[nEdge][1]][nAxis]) / 2.0;
+						}
+						nfDouble vEdge1[3];
+						nfDouble vEdge2[3];
+						for (nfUint32 nAxis = 0; nAxis < 3; nAxis++) {
+							vEdge1[nAxis] = vMidpoints[1][nAxis] - vMidpoints[0][nAxis];
+							vEdge2[nAxis] = vMidpoints[2][nAxis] - vMidpoints[0][nAxis];
+						}
+						nfDouble dOrientation =
+							(vEdge1[1] * vEdge2[2] - vEdge1[2] * vEdge2[1]) * vOutward[0] +
+							(vEdge1[2] * vEdge2[0] - vEdge1[0] * vEdge2[2]) * vOutward[1] +
+							(vEdge1[0] * vEdge2[1] - vEdge1[1] * vEdge2[0]) * vOutward[2];
+
+						nfUint32 nVertex1 = fnCrossing(Edges[0][0], Edges[0][1]);
+						nfUint32 nVertex2 = fnCrossing(Edges[1][0], Edges[1][1]);
+						nfUint32 nVertex3 = fnCrossing(Edges[2][0], Edges[2][1]);
+						if (dOrientation < 0.0)
+							std::swap(nVertex2, nVertex3);
+						Result.m_Triangles.push_back({ nVertex1, nVertex2, nVertex3 });
+					};
+
+					for (auto & Tetrahedron : LEVELSET_TETRAHEDRA) {
+						nfUint32 Inside[4];
+						nfUint32 Outside[4];
+						nfUint32 nTetInsideCount = 0;
+						nfUint32 nTetOutsideCount = 0;
+						for (nfUint32 nCorner : Tetrahedron) {
+							if (fnIsInside(CornerValues[nCorner]))
+								Inside[nTetInsideCount++] = nCorner;
+							else
+								Outside[nTetOutsideCount++] = nCorner;
+						}
+						if ((nTetInsideCount == 0) || (nTetOutsideCount == 0))
+							continue;
+
+						nfDouble vOutward[3];
+						for (nfUint32 nAxis = 0; nAxis < 3; nAxis++) {
+							nfDouble dInside = 0.0;
+							nfDouble dOutside = 0.0;
+							for (nfUint32 nIdx = 0; nIdx < nTetInsideCount; nIdx++)
+								dInside += CornerPositions[Inside[nIdx]][nAxis];
+							for (nfUint32 nIdx = 0; nIdx < nTetOutsideCount; nIdx++)
+								dOutside += CornerPositions[Outside[nIdx]][nAxis];
+							vOutward[nAxis] = dOutside / nTetOutsideCount - dInside / nTetInsideCount;
+						}
+
+						if (nTetInsideCount == 1) {
+							const nfUint32 Edges[3][2] = { { Inside[0], Outside[0] }, { Inside[0], Outside[1] }, { Inside[0], Outside[2] } };
+							fnAddTriangle(Edges, vOutward);
+						}
+						else if (nTetInsideCount == 3) {
+							const nfUint32 Edges[3][2] = { { Inside[0], Outside[0] }, { Inside[1], Outside[0] }, { Inside[2], Outside[0] } };
+							fnAddTriangle(Edges, vOutward);
+						}
+						else {
+							// The crossings form the quad (I0,O0) (I0,O1) (I1,O1) (I1,O0)
+							const nfUint32 Edges1[3][2] = { { Inside[0], Outside[0] }, { Inside[0], Outside[1] }, { Inside[1], Outside[1] } };
+							const nfUint32 Edges2[3][2] = { { Inside[0], Outside[0] }, { Inside[1], Outside[1] }, { Inside[1], Outside[0] } };
+							fnAddTriangle(Edges1, vOutward);
+							fnAddTriangle(Edges2, vOutward);
+						}
+					}
+				}
+			}
+		}
+	}
+
+	void CModelLevelSetMesher::extractMesh(_In_ CMesh * pMesh, _In_opt_ CThreadPool * pThreadPool)
+	{
+		if (!pMesh)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		if (m_bEmptyDomain)
+			return;
+
+		std::vector<nfUint32> Bricks;
+		collectBricks({ 0, 0, 0 }, m_nBrickCount, Bricks);
+		std::sort(Bricks.begin(), Bricks.end());
+
+		nfUint32 nBrickCount = (nfUint32)Bricks.size();
+		if (nBrickCount == 0)
+			return;
+		std::vector<sBrickResult> Results(nBrickCount);
+
+		nfUint32 nTaskCount = 1;
+		if (pThreadPool != nullptr)
+			nTaskCount = std::min(pThreadPool->getThreadCount() * NMR_LEVELSET_TASKSPERTHREAD, nBrickCount);
+
+		ThreadPoolTask fnTask = [&](nfUint32 nTaskIndex) {
+			nfUint32 nFirstBrick = (nfUint32)((nfUint64)nBrickCount * nTaskIndex / nTaskCount);
+			nfUint32 nLastBrick = (nfUint32)((nfUint64)nBrickCount * (nTaskIndex + 1) / nTaskCount);
+			for (nfUint32 nIndex = nFirstBrick; nIndex < nLastBrick; nIndex++)
+				triangulateBrick(Bricks[nIndex], Results[nIndex]);
+		};
+
+		if (pThreadPool != nullptr)
+			pThreadPool->runTasks(nTaskCount, fnTask);
+		else
+			fnTask(0);
+
+		// Crossings on the border of two bricks are merged into one node
+		std::unordered_map<nfUint64, MESHNODE *> NodeMap;
+		std::vector<MESHNODE *> BrickNodes;
+		for (auto & Result : Results) {
+			BrickNodes.resize(Result.m_Vertices.size());
+			for (size_t nIndex = 0; nIndex < Result.m_Vertices.size(); nIndex++) {
+				auto & Vertex = Result.m_Vertices[nIndex];
+				auto iNode = NodeMap.find(Vertex.m_nEdgeKey);
+				if (iNode == NodeMap.end())
+					iNode = NodeMap.insert(std::make_pair(Vertex.m_nEdgeKey, pMesh->addNode(Vertex.m_vPosition))).first;
+				BrickNodes[nIndex] = iNode->second;
+			}
+
+			for (auto & Triangle : Result.m_Triangles)
+				pMesh->addFace(BrickNodes[Triangle[0]], BrickNodes[Triangle[1]], BrickNodes[Triangle[2]]);
+
+			Result = sBrickResult();
+		}
+	}
+
+}
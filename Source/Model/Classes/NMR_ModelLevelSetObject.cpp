@@ -36,6 +36,8 @@ levelset object.
 
 #include "Common/Math/NMR_PairMatchingTree.h"
 #include "Common/Mesh/NMR_Mesh.h"
+#include "Common/NMR_ThreadPool.h"
+#include "Model/Classes/NMR_ModelLevelSetMesher.h"
 #include "Model/Classes/NMR_ModelMeshObject.h"
 #include "Model/Classes/NMR_ModelObject.h"
 #include "Model/Classes/NMR_ModelVolumeData.h"
@@ -54,7 +56,13 @@ namespace NMR
     void CModelLevelSetObject::mergeToMesh(CMesh* pMesh,
                                                 const NMATRIX3 mMatrix)
     {
-		throw CNMRException(NMR_ERROR_NOTIMPLEMENTED);
+        if (!pMesh) throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+        // The bricks are meshed on the worker threads of the model, which are kept between calls
+        CMesh levelSetMesh;
+        CModelLevelSetMesher mesher(*this);
+        mesher.extractMesh(&levelSetMesh, getModel()->getThreadPool());
+        pMesh->mergeMesh(&levelSetMesh, mMatrix);
     }
 
     PModelMeshObject CModelLevelSetObject::getMesh()
@@ -95,7 +103,27 @@ namespace NMR
     void CModelLevelSetObject::extendOutbox(
         NOUTBOX3& vOutBox, const NMATRIX3 mAccumulatedMatrix)
     {
-		throw CNMRException(NMR_ERROR_NOTIMPLEMENTED);
+        if (!m_pMesh) throw CNMRException(NMR_ERROR_LEVELSET_MISSING_MESH);
+
+        // The surface is clipped to the bounding box of the mesh, so its
+        // corners bound the levelset without evaluating the function
+        NOUTBOX3 meshOutbox;
+        fnOutboxInitialize(meshOutbox);
+        m_pMesh->getMesh()->extendOutbox(meshOutbox, fnMATRIX3_identity());
+        if (!fnOutboxIsValid(meshOutbox)) return;
+
+        for (nfUint32 nCorner = 0; nCorner < 8; nCorner++)
+        {
+            NVEC3 corner;
+            for (nfUint32 nAxis = 0; nAxis < 3; nAxis++)
+            {
+                corner.m_fields[nAxis] = ((nCorner >> nAxis) & 1)
+                                             ? meshOutbox.m_max.m_fields[nAxis]
+                                             : meshOutbox.m_min.m_fields[nAxis];
+            }
+            fnOutboxMergeVector(vOutBox,
+                                fnMATRIX3_apply(mAccumulatedMatrix, corner));
+        }
     }
 
     PModelFunction CModelLevelSetObject::getFunction()
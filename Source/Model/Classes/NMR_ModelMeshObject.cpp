@@ -34,7 +34,7 @@ mesh object.
 
 #include "Model/Classes/NMR_ModelObject.h" 
 #include "Model/Classes/NMR_ModelMeshObject.h" 
-#include "Common/Math/NMR_PairMatchingTree.h" 
+#include "Common/NMR_ThreadPool.h"
 
 #define TRIANGLESET_MAXCOUNT (1024 * 1024 * 1024)
 
@@ -63,6 +63,7 @@ namespace NMR {
 
 	_Ret_notnull_ CMesh * CModelMeshObject::getMesh()
 	{
+		ensureMeshLoaded();
 		return m_pMesh.get();
 	}
 
@@ -71,17 +72,53 @@ namespace NMR {
 		if (!pMesh)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
+		// A pending loader must not overwrite the new geometry
+		ensureMeshLoaded();
 		m_pMesh = pMesh;
 	}
 
+	void CModelMeshObject::setMeshLoader(_In_ PModelMeshLoader pMeshLoader)
+	{
+		m_pMeshLoader = pMeshLoader;
+	}
+
+	nfBool CModelMeshObject::isMeshLoaded()
+	{
+		return (m_pMeshLoader.get() == nullptr);
+	}
+
+	void CModelMeshObject::ensureMeshLoaded()
+	{
+		if (!m_pMeshLoader)
+			return;
+
+		// The loader accesses the mesh object itself, so it is detached first
+		PModelMeshLoader pMeshLoader = m_pMeshLoader;
+		m_pMeshLoader = nullptr;
+
+		try {
+			pMeshLoader->loadMesh(this);
+		}
+		catch (...) {
+			// Discard partially loaded data, so that the next access fails the same way
+			m_pMesh = std::make_shared<CMesh>();
+			m_pBeamLatticeAttributes = std::make_shared<CModelMeshBeamLatticeAttributes>();
+			m_TriangleSets.clear();
+			m_TriangleSetMap.clear();
+			m_pMeshLoader = pMeshLoader;
+			throw;
+		}
+	}
+
 	void CModelMeshObject::mergeToMesh(_In_ CMesh * pMesh, _In_ const NMATRIX3 mMatrix)
 	{
 		__NMRASSERT(pMesh);
-		pMesh->mergeMesh(m_pMesh.get(), mMatrix);
+		pMesh->mergeMesh(getMesh(), mMatrix);
 	}
 
 	void CModelMeshObject::setObjectType(_In_ eModelObjectType ObjectType)
 	{
+		ensureMeshLoaded();
 		if ((ObjectType != MODELOBJECTTYPE_MODEL) && (ObjectType != MODELOBJECTTYPE_SOLIDSUPPORT)) {
 			if (m_pMesh->getBeamCount() > 0)
 				throw CNMRException(NMR_ERROR_BEAMLATTICE_INVALID_OBJECTTYPE);
@@ -125,93 +162,20 @@ namespace NMR {
 
 	nfBool CModelMeshObject::isManifoldAndOriented()
 	{
-		if (!m_pMesh->checkSanity())
-			return false;
-
-		nfUint32 nNodeCount = m_pMesh->getNodeCount();
-		nfUint32 nFaceCount = m_pMesh->getFaceCount();
+		ensureMeshLoaded();
 
-		if (nNodeCount < 3)
-			return false;
-		if (nFaceCount < 3)
-			return false;
-
-		CPairMatchingTree PairMatchingTree;
-		nfUint32 nFaceIndex;
-		nfInt32 nEdgeIndex;
-		nfInt32 nEdgeCounter = 0;
-		nfUint32 j;
-
-		// Build Edge Tree
-		for (nFaceIndex = 0; nFaceIndex < nFaceCount; nFaceIndex++) {
-			MESHFACE * pFace = m_pMesh->getFace(nFaceIndex);
-
-			for (j = 0; j < 3; j++) {
-				nfInt32 nNodeIndex1 = pFace->m_nodeindices[j];
-				nfInt32 nNodeIndex2 = pFace->m_nodeindices[(j + 1) % 3];
-
-				if (!PairMatchingTree.checkMatch(nNodeIndex1, nNodeIndex2, nEdgeIndex)) {
-					PairMatchingTree.addMatch(nNodeIndex1, nNodeIndex2, nEdgeCounter);
-					nEdgeCounter++;
-
-					if (nEdgeCounter > NMR_MESH_MAXEDGECOUNT)
-						throw CNMRException(NMR_ERROR_INVALIDEDGEINDEX);
-				}
-			}
-
-		}
-
-		// Count positively and negatively oriented edges...
-		std::vector<nfInt32> PositiveOrientations;
-		std::vector<nfInt32> NegativeOrientations;
-
-		// Create Edge arrays
-		PositiveOrientations.resize(nEdgeCounter);
-		NegativeOrientations.resize(nEdgeCounter);
-		for (nEdgeIndex = 0; nEdgeIndex < nEdgeCounter; nEdgeIndex++) {
-			PositiveOrientations[nEdgeIndex] = 0;
-			NegativeOrientations[nEdgeIndex] = 0;
-		}
-
-		for (nFaceIndex = 0; nFaceIndex < nFaceCount; nFaceIndex++) {
-			MESHFACE * pFace = m_pMesh->getFace(nFaceIndex);
-
-			for (j = 0; j < 3; j++) {
-				nfInt32 nNodeIndex1 = pFace->m_nodeindices[j];
-				nfInt32 nNodeIndex2 = pFace->m_nodeindices[(j + 1) % 3];
-
-				if (PairMatchingTree.checkMatch(nNodeIndex1, nNodeIndex2, nEdgeIndex)) {
-					if ((nEdgeIndex < 0) || (nEdgeIndex >= nEdgeCounter))
-						throw CNMRException(NMR_ERROR_INVALIDEDGEINDEX);
-
-					if (nNodeIndex1 <= nNodeIndex2) {
-						PositiveOrientations[nEdgeIndex]++;
-					}
-					else {
-						NegativeOrientations[nEdgeIndex]++;
-					}
-				}
-				else {
-					throw CNMRException(NMR_ERROR_INVALIDMESHTOPOLOGY);
-				}
-			}
-		}
-
-		// Check Edge Orientations and determine manifoldness
-		for (nEdgeIndex = 0; nEdgeIndex < nEdgeCounter; nEdgeIndex++) {
-			if (PositiveOrientations[nEdgeIndex] != 1)
-				return false;
-			if (NegativeOrientations[nEdgeIndex] != 1)
-				return false;
-		}
+		// Large meshes are checked on all cores, using the worker threads of the model
+		CThreadPool * pThreadPool = nullptr;
+		if (m_pMesh->getFaceCount() >= NMR_MODELMESHOBJECT_PARALLELCHECKFACECOUNT)
+			pThreadPool = getModel()->getThreadPool();
 
-		// Mesh is non-empty, oriented and manifold
-		return true;
+		return m_pMesh->isManifoldAndOriented(pThreadPool);
 	}
 
 
 	_Ret_notnull_ PModelMeshBeamLatticeAttributes CModelMeshObject::getBeamLatticeAttributes()
 	{
+		ensureMeshLoaded();
 		return m_pBeamLatticeAttributes;
 	}
 
@@ -220,6 +184,7 @@ namespace NMR {
 		if (!pBeamLatticeAttributes)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
+		ensureMeshLoaded();
 		m_pBeamLatticeAttributes = pBeamLatticeAttributes;
 	}
 
@@ -238,7 +203,7 @@ namespace NMR {
 
 	void CModelMeshObject::extendOutbox(_Out_ NOUTBOX3& vOutBox, _In_ const NMATRIX3 mAccumulatedMatrix)
 	{
-		m_pMesh->extendOutbox(vOutBox, mAccumulatedMatrix);
+		getMesh()->extendOutbox(vOutBox, mAccumulatedMatrix);
 	}
 
 	ResourceDependencies CModelMeshObject::getDependencies()
@@ -255,6 +220,7 @@ namespace NMR {
 
 	void CModelMeshObject::deleteTriangleSet(_In_ CModelTriangleSet* pTriangleSet)
 	{
+		ensureMeshLoaded();
 		if (pTriangleSet != nullptr) {
 			auto sIdentifier = pTriangleSet->getIdentifier();
 			m_TriangleSets.erase(std::remove_if(
@@ -270,6 +236,7 @@ namespace NMR {
 
 	PModelTriangleSet CModelMeshObject::findTriangleSet(const std::string& sIdentifier)
 	{
+		ensureMeshLoaded();
 		auto iIterator = m_TriangleSetMap.find(sIdentifier);
 		if (iIterator == m_TriangleSetMap.end())
 			return nullptr;
@@ -280,6 +247,7 @@ namespace NMR {
 
 	PModelTriangleSet CModelMeshObject::addTriangleSet(const std::string& sIdentifier, const std::string& sName)
 	{
+		ensureMeshLoaded();
 		auto iIterator = m_TriangleSetMap.find(sIdentifier);
 		if (iIterator != m_TriangleSetMap.end())
 			throw CNMRException(NMR_ERROR_DUPLICATETRIANGLESET);
@@ -297,6 +265,7 @@ namespace NMR {
 
 	PModelTriangleSet CModelMeshObject::addTriangleSet(PModelTriangleSet pModelTriangleSet)
 	{
+		ensureMeshLoaded();
 		if (pModelTriangleSet.get() == nullptr)
 			throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
@@ -315,11 +284,13 @@ namespace NMR {
 
 	uint32_t CModelMeshObject::getTriangleSetCount()
 	{
+		ensureMeshLoaded();
 		return (uint32_t)m_TriangleSets.size();
 	}
 
 	PModelTriangleSet CModelMeshObject::getTriangleSet(const uint32_t nIndex)
 	{
+		ensureMeshLoaded();
 		if (nIndex >= m_TriangleSets.size())
 			throw CNMRException(NMR_ERROR_INVALIDINDEX);
 
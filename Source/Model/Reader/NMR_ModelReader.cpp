@@ -45,6 +45,8 @@ namespace NMR {
 	CModelReader::CModelReader(_In_ PModel pModel)
 		:CModelContext(pModel)
 	{
+		m_nWorkerThreadCount = 1;
+		m_bLazyMeshLoading = false;
 	}
 
 	void CModelReader::readFromMeshImporter(_In_ CMeshImporter * pImporter)
@@ -82,4 +84,49 @@ namespace NMR {
 		m_RelationsToRead.erase(sRelationShipType);
 	}
 
+	void CModelReader::setWorkerThreadCount(_In_ nfUint32 nWorkerThreadCount)
+	{
+		if (nWorkerThreadCount != m_nWorkerThreadCount)
+			m_pThreadPool = nullptr;
+		m_nWorkerThreadCount = nWorkerThreadCount;
+	}
+
+	nfUint32 CModelReader::getWorkerThreadCount()
+	{
+		return m_nWorkerThreadCount;
+	}
+
+	void CModelReader::setMeshStream(_In_ PModelReader_MeshStream pMeshStream)
+	{
+		m_pMeshStream = pMeshStream;
+	}
+
+	PModelReader_MeshStream CModelReader::meshStream()
+	{
+		return m_pMeshStream;
+	}
+
+	void CModelReader::setLazyMeshLoading(_In_ nfBool bLazyMeshLoading)
+	{
+		m_bLazyMeshLoading = bLazyMeshLoading;
+	}
+
+	nfBool CModelReader::getLazyMeshLoading()
+	{
+		return m_bLazyMeshLoading;
+	}
+
+	PThreadPool CModelReader::threadPool()
+	{
+		nfUint32 nThreadCount = m_nWorkerThreadCount;
+		if (nThreadCount == 0)
+			nThreadCount = CThreadPool::getHardwareThreadCount();
+		if (nThreadCount <= 1)
+			return nullptr;
+
+		if (!m_pThreadPool)
+			m_pThreadPool = std::make_shared<CThreadPool>(nThreadCount);
+		return m_pThreadPool;
+	}
+
 }
@@ -127,7 +127,7 @@ namespace NMR {
 
 				if (nNameCount > 0) {
 					if (nNameSpaceCount == 0) {
-						OnAttribute(pszLocalName, pszValue);
+						OnSizedAttribute(pszLocalName, pszValue, nValueCount);
 					}
 					else {
 						OnNSAttribute(pszLocalName, pszValue, pszNameSpaceURI);
@@ -218,6 +218,11 @@ namespace NMR {
 		// empty on purpose, to be implemented by child classes
 	}
 
+	void CModelReaderNode::OnSizedAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue, _In_ nfUint32 nValueLength)
+	{
+		OnAttribute(pAttributeName, pAttributeValue);
+	}
+
 	void CModelReaderNode::OnText(_In_z_ const nfChar * pText, _In_ CXmlReader * pXMLReader)
 	{
 		// empty on purpose, to be implemented by child classes
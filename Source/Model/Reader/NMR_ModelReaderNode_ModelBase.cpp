@@ -197,7 +197,7 @@ namespace NMR {
 				m_pProgressMonitor->SetProgressIdentifier(ProgressIdentifier::PROGRESS_READRESOURCES);
 				m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
 				
-				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode100_Resources>(m_pModel, m_pWarnings, m_sPath.c_str(), m_pProgressMonitor);
+				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode100_Resources>(m_pModel, m_pWarnings, m_sPath.c_str(), m_pProgressMonitor, m_pThreadPool, m_pMeshStream, m_pLazyMeshPart);
 				if (m_bHasResources)
 					throw CNMRException(NMR_ERROR_DUPLICATERESOURCES);
 				pXMLNode->parseXML(pXMLReader);
@@ -294,5 +294,17 @@ namespace NMR {
 	{
 		m_bIgnoreMetaData = bIgnoreMetaData;
 	}
+	void CModelReaderNode_ModelBase::setThreadPool(_In_ PThreadPool pThreadPool)
+	{
+		m_pThreadPool = pThreadPool;
+	}
+	void CModelReaderNode_ModelBase::setMeshStream(_In_ PModelReader_MeshStream pMeshStream)
+	{
+		m_pMeshStream = pMeshStream;
+	}
+	void CModelReaderNode_ModelBase::setLazyMeshPart(_In_ PImportStream pLazyMeshPart)
+	{
+		m_pLazyMeshPart = pLazyMeshPart;
+	}
 
 }
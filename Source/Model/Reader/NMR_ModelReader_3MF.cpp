@@ -57,7 +57,13 @@ namespace NMR {
 		// empty on purpose
 	}
 
-	void readProductionAttachmentModels(_In_ PModel pModel, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor)
+	PImportStream CModelReader_3MF::copyPartToMemory(_In_ PImportStream pPartStream)
+	{
+		__NMRASSERT(pPartStream != nullptr);
+		return pPartStream->copyToMemory();
+	}
+
+	void readProductionAttachmentModels(_In_ PModel pModel, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor, _In_ PThreadPool pThreadPool, _In_ PModelReader_MeshStream pMeshStream, _In_ nfBool bLazyMeshLoading)
 	{
 		nfUint32 prodAttCount = pModel->getProductionAttachmentCount();
 		for (nfInt32 i = prodAttCount-1; i >=0; i--)
@@ -104,6 +110,10 @@ namespace NMR {
 					pXMLNode = std::make_shared<CModelReaderNode_ModelBase>(pModel.get(), pWarnings, sPath, pProgressMonitor);
 					pXMLNode->setIgnoreBuild(true);
 					pXMLNode->setIgnoreMetaData(true);
+					pXMLNode->setThreadPool(pThreadPool);
+					pXMLNode->setMeshStream(pMeshStream);
+					if (bLazyMeshLoading)
+						pXMLNode->setLazyMeshPart(pSubModelStream);
 					pXMLNode->parseXML(pXMLReader.get());
 
 					if (!pXMLNode->getHasResources())
@@ -130,7 +140,13 @@ namespace NMR {
 		PImportStream pModelStream = extract3MFOPCPackage(pStream);
 		
 		// before reading the root model, read the other models in the file
-		readProductionAttachmentModels(model(), warnings(), monitor());
+		nfBool bLazyMeshLoading = getLazyMeshLoading() && !meshStream();
+		readProductionAttachmentModels(model(), warnings(), monitor(), threadPool(), meshStream(), bLazyMeshLoading);
+
+		// Mesh content is parsed from the root model part after the package has been released.
+		// The part stays deflated, and each mesh is inflated from the nearest checkpoint before its content.
+		if (bLazyMeshLoading)
+			pModelStream = copyPartToMemory(pModelStream);
 
 		monitor()->SetProgressIdentifier(ProgressIdentifier::PROGRESS_READROOTMODEL);
 		monitor()->ReportProgressAndQueryCancelled(true);
@@ -163,6 +179,10 @@ namespace NMR {
 
 				model()->setCurrentPath(model()->rootPath());
 				PModelReaderNode_ModelBase pXMLNode = std::make_shared<CModelReaderNode_ModelBase>(model().get(), warnings(), model()->rootPath(), monitor());
+				pXMLNode->setThreadPool(threadPool());
+				pXMLNode->setMeshStream(meshStream());
+				if (bLazyMeshLoading)
+					pXMLNode->setLazyMeshPart(pModelStream);
 				pXMLNode->parseXML(pXMLReader.get());
 
 				if (!pXMLNode->getHasResources())
@@ -42,6 +42,7 @@ It uses libzip and irrxml to parse the OPC package.
 #include "Common/NMR_Exception_Windows.h"
 #include "Common/NMR_StringUtils.h"
 #include "Common/Platform/NMR_Platform.h"
+#include "Common/Platform/NMR_ImportStream_ZIP.h"
 #include "Model/Reader/NMR_ModelReader_InstructionElement.h"
 
 namespace NMR {
@@ -92,7 +93,7 @@ namespace NMR {
 			POpcPackagePart pThumbnailPart = m_pPackageReader->createPart(sTargetPartURI);
 			if (pThumbnailPart == nullptr)
 				throw CNMRException(NMR_ERROR_OPCCOULDNOTGETTHUMBNAILSTREAM);
-			PImportStream pThumbnailStream = pThumbnailPart->getImportStream()->copyToMemory();
+			PImportStream pThumbnailStream = copyPartToMemory(pThumbnailPart->getImportStream());
 			model()->addPackageThumbnail()->setStream(pThumbnailStream);
 			monitor()->IncrementProgress((double)pThumbnailStream->retrieveSize());
 			monitor()->ReportProgressAndQueryCancelled(true);
@@ -136,7 +137,7 @@ namespace NMR {
 				if (!pModelAttachment) {
 					POpcPackagePart pTexturePart = m_pPackageReader->createPart(sURI);
 					PImportStream pTextureAttachmentStream = pTexturePart->getImportStream();
-					PImportStream pMemoryStream = pTextureAttachmentStream->copyToMemory();
+					PImportStream pMemoryStream = copyPartToMemory(pTextureAttachmentStream);
 
 					if (pMemoryStream->retrieveSize() == 0)
 						warnings()->addException(CNMRException(NMR_ERROR_IMPORTSTREAMISEMPTY), mrwMissingMandatoryValue);
@@ -175,7 +176,7 @@ namespace NMR {
 				POpcPackagePart pPart = m_pPackageReader->createPart(sURI);
 				PImportStream pAttachmentStream = pPart->getImportStream();
 				try {
-					PImportStream pMemoryStream = pAttachmentStream->copyToMemory();
+					PImportStream pMemoryStream = copyPartToMemory(pAttachmentStream);
 
 					if (pMemoryStream->retrieveSize() == 0)
 						warnings()->addException(CNMRException(NMR_ERROR_IMPORTSTREAMISEMPTY), mrwMissingMandatoryValue);
@@ -233,7 +234,7 @@ namespace NMR {
 				else {
 					// this is the first time this attachment is read
 					PImportStream pAttachmentStream = pPart->getImportStream();
-					PImportStream pMemoryStream = pAttachmentStream->copyToMemory();
+					PImportStream pMemoryStream = copyPartToMemory(pAttachmentStream);
 					if (pMemoryStream->retrieveSize() == 0)
 						warnings()->addException(CNMRException(NMR_ERROR_IMPORTSTREAMISEMPTY), mrwMissingMandatoryValue);
 					model()->addProductionAttachment(sURI, sRelationShipType, pMemoryStream, true);
@@ -243,6 +244,17 @@ namespace NMR {
 	}
 	
 
+	PImportStream CModelReader_3MF_Native::copyPartToMemory(_In_ PImportStream pPartStream)
+	{
+		// Parts keep their deflated data and are only inflated when they are accessed.
+		// The package is closed after reading, so the deflated data has to be copied nonetheless.
+		CImportStream_ZIP * pZIPStream = dynamic_cast<CImportStream_ZIP *> (pPartStream.get());
+		if (pZIPStream != nullptr)
+			return pZIPStream->copyDeflatedToMemory();
+
+		return pPartStream->copyToMemory();
+	}
+
 	void CModelReader_3MF_Native::checkContentTypes()
 	{
 		//throw CNMRException(NMR_ERROR_NOTIMPLEMENTED);	
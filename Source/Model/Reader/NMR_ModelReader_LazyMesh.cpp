@@ -0,0 +1,196 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelReader_LazyMesh.cpp implements a loader for mesh objects, whose content is parsed on
+first access. The content of a mesh node is skipped by scanning the raw XML text for the end
+element of the node. On first access, the recorded byte range is wrapped into a mesh node with
+the namespace declarations of the model part and parsed by the regular reader nodes.
+
+--*/
+
+#include "Model/Reader/NMR_ModelReader_LazyMesh.h"
+#include "Model/Classes/NMR_Model.h"
+#include "Model/Classes/NMR_ModelConstants.h"
+#include "Common/Platform/NMR_ImportStream_Shared_Memory.h"
+#include "Common/Platform/NMR_Platform.h"
+#include "Common/Platform/NMR_XmlScan.h"
+#include "Common/3MF_ProgressMonitor.h"
+#include "Common/NMR_Exception.h"
+
+#include <string.h>
+#include <vector>
+
+namespace NMR {
+
+	enum eModelReaderLazyMeshEndElement {
+		MODELREADERLAZYMESH_NOENDELEMENT,
+		MODELREADERLAZYMESH_ENDELEMENT,
+		MODELREADERLAZYMESH_INCOMPLETE
+	};
+
+	// Checks, if the markup at pChar is the end element of a mesh node, with or without namespace prefix.
+	// Mesh nodes do not nest, and end elements within comments are not expected in mesh content.
+	inline eModelReaderLazyMeshEndElement matchMeshEndElement(_In_ const nfChar * pChar, _In_ const nfChar * pEnd)
+	{
+		if (pEnd - pChar < 2)
+			return MODELREADERLAZYMESH_INCOMPLETE;
+		if (pChar[1] != '/')
+			return MODELREADERLAZYMESH_NOENDELEMENT;
+
+		const nfChar * pName = pChar + 2;
+		const nfChar * pNameEnd = pName;
+		const nfChar * pLocalName = pName;
+		while ((pNameEnd != pEnd) && !fnXmlIsWhiteSpace(*pNameEnd) && (*pNameEnd != '>')) {
+			if (*pNameEnd == ':')
+				pLocalName = pNameEnd + 1;
+			pNameEnd++;
+		}
+		if (pNameEnd == pEnd)
+			return MODELREADERLAZYMESH_INCOMPLETE;
+
+		size_t cbMeshElement = strlen(XML_3MF_ELEMENT_MESH);
+		if (((size_t)(pNameEnd - pLocalName) == cbMeshElement) && (memcmp(pLocalName, XML_3MF_ELEMENT_MESH, cbMeshElement) == 0))
+			return MODELREADERLAZYMESH_ENDELEMENT;
+
+		return MODELREADERLAZYMESH_NOENDELEMENT;
+	}
+
+	inline std::string escapeAttributeValue(_In_ const std::string & sValue)
+	{
+		std::string sResult;
+		for (nfChar cChar : sValue) {
+			switch (cChar) {
+			case '&': sResult += "&amp;"; break;
+			case '<': sResult += "&lt;"; break;
+			case '"': sResult += "&quot;"; break;
+			default: sResult += cChar;
+			}
+		}
+		return sResult;
+	}
+
+	CModelReader_LazyMesh::CModelReader_LazyMesh(_In_ PImportStream pPartStream, _In_ CModel * pModel, _In_ const std::string & sPath)
+		: m_pPartStream(pPartStream), m_pModel(pModel), m_sPath(sPath), m_nContentStart(0), m_nContentSize(0)
+	{
+		if (!pPartStream || !pModel)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+	}
+
+	nfBool CModelReader_LazyMesh::skipContent(_In_ CXmlReader * pXMLReader)
+	{
+		__NMRASSERT(pXMLReader);
+
+		// Self-closing nodes cannot be read raw
+		if (!pXMLReader->CanReadRaw())
+			return false;
+
+		pXMLReader->GetDefaultNamespaceURI(m_sDefaultNameSpace);
+		pXMLReader->GetNamespaces(m_NameSpaces);
+		m_nContentStart = pXMLReader->GetRawPosition();
+		m_nContentSize = 0;
+
+		std::vector<nfChar> Buffer(NMR_MODELREADER_LAZYMESH_SKIPBUFFERSIZE);
+		while (true) {
+			nfUint32 cbRead = pXMLReader->ReadRaw((nfByte *)Buffer.data(), (nfUint32)Buffer.size());
+			if (cbRead == 0)
+				throw CNMRException(NMR_ERROR_XMLPARSER_COULDNOTENDELEMENT);
+
+			const nfChar * pStart = Buffer.data();
+			const nfChar * pEnd = pStart + cbRead;
+			const nfChar * pStop = pEnd;
+			nfBool bFoundEndElement = false;
+
+			const nfChar * pChar = pStart;
+			while ((pChar = (const nfChar *)memchr(pChar, '<', pEnd - pChar)) != nullptr) {
+				eModelReaderLazyMeshEndElement eEndElement = matchMeshEndElement(pChar, pEnd);
+				if (eEndElement == MODELREADERLAZYMESH_ENDELEMENT) {
+					bFoundEndElement = true;
+					pStop = pChar;
+					break;
+				}
+
+				// Markup that is cut off is read again at the start of the next chunk
+				if ((eEndElement == MODELREADERLAZYMESH_INCOMPLETE) && (pChar != pStart)) {
+					pStop = pChar;
+					break;
+				}
+
+				pChar++;
+			}
+
+			// The end element and everything behind it is parsed by the XML reader again
+			m_nContentSize += (nfUint64)(pStop - pStart);
+			pXMLReader->UnreadRaw((const nfByte *)pStop, (nfUint32)(pEnd - pStop));
+
+			if (bFoundEndElement)
+				return true;
+		}
+	}
+
+	void CModelReader_LazyMesh::loadMesh(_In_ CModelMeshObject * pMeshObject)
+	{
+		if (pMeshObject == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		// Wrap the content into a mesh node, which declares the namespaces of the model part
+		std::string sStartElement = std::string("<") + XML_3MF_ELEMENT_MESH + " xmlns=\"" + escapeAttributeValue(m_sDefaultNameSpace) + "\"";
+		for (auto iIterator : m_NameSpaces)
+			sStartElement += " xmlns:" + iIterator.first + "=\"" + escapeAttributeValue(iIterator.second) + "\"";
+		sStartElement += ">";
+		std::string sEndElement = std::string("</") + XML_3MF_ELEMENT_MESH + ">";
+
+		std::vector<nfByte> Buffer(sStartElement.length() + m_nContentSize + sEndElement.length());
+		nfByte * pContent = Buffer.data() + sStartElement.length();
+		memcpy(Buffer.data(), sStartElement.c_str(), sStartElement.length());
+		m_pPartStream->seekPosition(m_nContentStart, true);
+		m_pPartStream->readIntoBuffer(pContent, m_nContentSize, true);
+		memcpy(pContent + m_nContentSize, sEndElement.c_str(), sEndElement.length());
+
+		PImportStream pContentStream = std::make_shared<CImportStream_Shared_Memory>(Buffer.data(), (nfUint64)Buffer.size());
+		PXmlReader pXMLReader = fnCreateXMLReaderInstance(pContentStream, std::make_shared<CProgressMonitor>());
+
+		eXmlReaderNodeType NodeType = XMLREADERNODETYPE_UNKNOWN;
+		while (NodeType != XMLREADERNODETYPE_STARTELEMENT) {
+			if (pXMLReader->IsEOF() || !pXMLReader->Read(NodeType))
+				throw CNMRException(NMR_ERROR_XMLPARSER_INVALIDPARSERESULT);
+		}
+
+		// Resource IDs are resolved within the model part of the mesh object
+		std::string sCurrentPath = m_pModel->currentPath();
+		m_pModel->setCurrentPath(m_sPath);
+		try {
+			parseMesh(pXMLReader.get(), pMeshObject);
+		}
+		catch (...) {
+			m_pModel->setCurrentPath(sCurrentPath);
+			throw;
+		}
+		m_pModel->setCurrentPath(sCurrentPath);
+	}
+
+}
@@ -0,0 +1,467 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelReader_MeshContent.cpp implements parsers for the plain vertex and triangle content of a
+mesh node. The raw XML text is split into segments at element boundaries, which are decoded
+independently (optionally in parallel) and committed to the mesh in document order. Any content
+that is not understood is handed back to the XML reader and parsed by the regular reader nodes.
+
+--*/
+
+#include "Model/Reader/NMR_ModelReader_MeshContent.h"
+#include "Model/Classes/NMR_ModelConstants.h"
+#include "Common/NMR_Exception.h"
+#include "Common/NMR_StringUtils.h"
+
+#include <cmath>
+#include <string.h>
+
+namespace NMR {
+
+	inline nfBool isXMLWhiteSpace(_In_ nfChar cChar)
+	{
+		return (cChar == ' ') || (cChar == '\n') || (cChar == '\r') || (cChar == '\t');
+	}
+
+	inline const nfChar * skipXMLWhiteSpace(_In_ const nfChar * pChar, _In_ const nfChar * pEnd)
+	{
+		while ((pChar != pEnd) && isXMLWhiteSpace(*pChar))
+			pChar++;
+		return pChar;
+	}
+
+	// Decodes a coordinate value with the same result as fnStringToFloat and the range checks
+	// of the vertex node. Returns false for anything the vertex node would reject or treat specially.
+	inline nfBool decodeCoordinate(_In_ const nfChar * pStart, _In_ const nfChar * pEnd, _Out_ nfFloat & fValue)
+	{
+		nfDouble dValue = 0.0;
+		auto answer = fast_float::from_chars(pStart, pEnd, dValue);
+		if ((answer.ec != std::errc()) || (answer.ptr != pEnd))
+			return false;
+		if ((dValue == HUGE_VAL) || (dValue == -HUGE_VAL))
+			return false;
+
+		fValue = (nfFloat)dValue;
+		if (std::isnan(fValue) || (fabs(fValue) > XML_3MF_MAXIMUMCOORDINATEVALUE))
+			return false;
+
+		return true;
+	}
+
+	// Decodes a plain non-negative index value. Values with signs, spaces or more than 9 digits
+	// are left to fnStringToInt32.
+	inline nfBool decodeIndex(_In_ const nfChar * pStart, _In_ const nfChar * pEnd, _Out_ nfInt32 & nValue)
+	{
+		if ((pEnd - pStart) > 9)
+			return false;
+
+		nfUint32 nResult;
+		if (!fnStringToShortDecimal(pStart, (nfUint32)(pEnd - pStart), nResult))
+			return false;
+
+		nValue = (nfInt32)nResult;
+		return true;
+	}
+
+	// Decodes self-closing elements of the form <name attribute="value" ... /> until the segment ends.
+	// *ppStop always points to the first element that has not been decoded.
+	template <class TDecoder> eModelReaderMeshContentStatus decodeElements(_In_ const nfChar * pStart, _In_ const nfChar * pEnd,
+		_In_z_ const nfChar * pszElementName, _In_z_ const nfChar * pszContainerName, _In_ TDecoder & Decoder, _Out_ const nfChar ** ppStop)
+	{
+		size_t cbElementName = strlen(pszElementName);
+		size_t cbContainerName = strlen(pszContainerName);
+
+		const nfChar * pChar = pStart;
+		while (true) {
+			pChar = skipXMLWhiteSpace(pChar, pEnd);
+			*ppStop = pChar;
+
+			if (pChar == pEnd)
+				return MODELREADERMESHCONTENT_SEGMENTEND;
+			if (*pChar != '<')
+				return MODELREADERMESHCONTENT_UNKNOWNCONTENT;
+			pChar++;
+
+			if ((size_t)(pEnd - pChar) <= cbElementName)
+				return MODELREADERMESHCONTENT_INCOMPLETE;
+
+			if (*pChar == '/') {
+				pChar++;
+				const nfChar * pClose = (const nfChar *)memchr(pChar, '>', pEnd - pChar);
+				if (pClose == nullptr)
+					return MODELREADERMESHCONTENT_INCOMPLETE;
+
+				const nfChar * pNameEnd = pClose;
+				while ((pNameEnd != pChar) && isXMLWhiteSpace(*(pNameEnd - 1)))
+					pNameEnd--;
+
+				if (((size_t)(pNameEnd - pChar) == cbContainerName) && (memcmp(pChar, pszContainerName, cbContainerName) == 0))
+					return MODELREADERMESHCONTENT_CONTAINEREND;
+				return MODELREADERMESHCONTENT_UNKNOWNCONTENT;
+			}
+
+			if ((memcmp(pChar, pszElementName, cbElementName) != 0) || !isXMLWhiteSpace(pChar[cbElementName]))
+				return MODELREADERMESHCONTENT_UNKNOWNCONTENT;
+			pChar += cbElementName;
+
+			Decoder.beginElement();
+
+			while (true) {
+				pChar = skipXMLWhiteSpace(pChar, pEnd);
+				if (pChar == pEnd)
+					return MODELREADERMESHCONTENT_INCOMPLETE;
+
+				if (*pChar == '/') {
+					pChar++;
+					if (pChar == pEnd)
+						return MODELREADERMESHCONTENT_INCOMPLETE;
+					if (*pChar != '>')
+						return MODELREADERMESHCONTENT_UNKNOWNCONTENT;
+					pChar++;
+
+					if (!Decoder.endElement())
+						return MODELREADERMESHCONTENT_UNKNOWNCONTENT;
+					break;
+				}
+
+				// Attribute name
+				const nfChar * pName = pChar;
+				while ((pChar != pEnd) && (*pChar != '=') && (*pChar != '/') && (*pChar != '>') && !isXMLWhiteSpace(*pChar))
+					pChar++;
+				if (pChar == pEnd)
+					return MODELREADERMESHCONTENT_INCOMPLETE;
+				if (*pChar != '=')
+					return MODELREADERMESHCONTENT_UNKNOWNCONTENT;
+				const nfChar * pNameEnd = pChar;
+				pChar++;
+
+				// Attribute value
+				if (pChar == pEnd)
+					return MODELREADERMESHCONTENT_INCOMPLETE;
+				nfChar cQuote = *pChar;
+				if ((cQuote != '"') && (cQuote != '\''))
+					return MODELREADERMESHCONTENT_UNKNOWNCONTENT;
+				pChar++;
+
+				const nfChar * pValueEnd = (const nfChar *)memchr(pChar, cQuote, pEnd - pChar);
+				if (pValueEnd == nullptr)
+					return MODELREADERMESHCONTENT_INCOMPLETE;
+
+				if (!Decoder.attribute(pName, pNameEnd, pChar, pValueEnd))
+					return MODELREADERMESHCONTENT_UNKNOWNCONTENT;
+
+				pChar = pValueEnd + 1;
+				if (pChar == pEnd)
+					return MODELREADERMESHCONTENT_INCOMPLETE;
+				if ((*pChar != '/') && !isXMLWhiteSpace(*pChar))
+					return MODELREADERMESHCONTENT_UNKNOWNCONTENT;
+			}
+		}
+	}
+
+	void CModelReader_MeshContent::reserveSegments(_In_ nfUint32 nSegmentCount)
+	{
+	}
+
+	nfBool CModelReader_MeshContent::canParse(_In_ CXmlReader * pXMLReader)
+	{
+		__NMRASSERT(pXMLReader);
+
+		if (!pXMLReader->CanReadRaw())
+			return false;
+
+		std::string sDefaultNameSpace;
+		pXMLReader->GetDefaultNamespaceURI(sDefaultNameSpace);
+		return (sDefaultNameSpace == XML_3MF_NAMESPACE_CORESPEC100);
+	}
+
+	void CModelReader_MeshContent::parse(_In_ CXmlReader * pXMLReader, _In_opt_ CThreadPool * pThreadPool)
+	{
+		__NMRASSERT(pXMLReader);
+
+		// Without a thread pool, each segment is committed right after decoding it,
+		// so that the segment buffers stay small and are reused for every chunk.
+		nfUint32 nMaxSegmentCount = 1;
+		if (pThreadPool != nullptr)
+			nMaxSegmentCount = pThreadPool->getThreadCount() * NMR_MODELREADER_MESHCONTENT_SEGMENTSPERTHREAD;
+
+		nfUint32 cbReadSize = nMaxSegmentCount * NMR_MODELREADER_MESHCONTENT_SEGMENTSIZE;
+		nfUint32 cbCarryOver = 0;
+
+		while (true) {
+			m_Buffer.resize(cbCarryOver + cbReadSize);
+			nfUint32 cbRead = pXMLReader->ReadRaw((nfByte *)m_Buffer.data() + cbCarryOver, cbReadSize);
+			if (cbRead == 0) {
+				pXMLReader->UnreadRaw((const nfByte *)m_Buffer.data(), cbCarryOver);
+				return;
+			}
+
+			nfUint32 cbBufferSize = cbCarryOver + cbRead;
+			const nfChar * pBuffer = m_Buffer.data();
+
+			// Split buffer into segments that start at element boundaries
+			nfUint32 nSegmentCount = (cbBufferSize + NMR_MODELREADER_MESHCONTENT_SEGMENTSIZE - 1) / NMR_MODELREADER_MESHCONTENT_SEGMENTSIZE;
+			if (nSegmentCount > nMaxSegmentCount)
+				nSegmentCount = nMaxSegmentCount;
+
+			m_SegmentStarts.resize(nSegmentCount + 1);
+			m_SegmentStarts[0] = 0;
+			for (nfUint32 nSegment = 1; nSegment < nSegmentCount; nSegment++) {
+				nfUint32 nStart = (nfUint32)(((nfUint64)cbBufferSize * nSegment) / nSegmentCount);
+				if (nStart < m_SegmentStarts[nSegment - 1])
+					nStart = m_SegmentStarts[nSegment - 1];
+
+				const nfChar * pElement = (const nfChar *)memchr(pBuffer + nStart, '<', cbBufferSize - nStart);
+				m_SegmentStarts[nSegment] = (pElement != nullptr) ? (nfUint32)(pElement - pBuffer) : cbBufferSize;
+			}
+			m_SegmentStarts[nSegmentCount] = cbBufferSize;
+
+			m_SegmentStatus.resize(nSegmentCount);
+			m_SegmentStops.resize(nSegmentCount);
+			prepareSegments(nSegmentCount);
+
+			auto fnDecode = [this, pBuffer](nfUint32 nSegment) {
+				const nfChar * pStop = nullptr;
+				m_SegmentStatus[nSegment] = decodeSegment(nSegment, pBuffer + m_SegmentStarts[nSegment], pBuffer + m_SegmentStarts[nSegment + 1], &pStop);
+				m_SegmentStops[nSegment] = pStop;
+			};
+
+			if (pThreadPool != nullptr) {
+				pThreadPool->runTasks(nSegmentCount, fnDecode);
+			}
+			else {
+				for (nfUint32 nSegment = 0; nSegment < nSegmentCount; nSegment++)
+					fnDecode(nSegment);
+			}
+
+			// Commit segments in document order
+			reserveSegments(nSegmentCount);
+			cbCarryOver = 0;
+			for (nfUint32 nSegment = 0; nSegment < nSegmentCount; nSegment++) {
+				commitSegment(nSegment);
+
+				eModelReaderMeshContentStatus eStatus = m_SegmentStatus[nSegment];
+				if (eStatus == MODELREADERMESHCONTENT_SEGMENTEND)
+					continue;
+
+				nfUint32 nStop = (nfUint32)(m_SegmentStops[nSegment] - pBuffer);
+				if ((eStatus == MODELREADERMESHCONTENT_INCOMPLETE) && (nSegment + 1 == nSegmentCount)) {
+					// Last element continues in the next chunk
+					cbCarryOver = cbBufferSize - nStop;
+					if (cbCarryOver > NMR_MODELREADER_MESHCONTENT_SEGMENTSIZE) {
+						pXMLReader->UnreadRaw((const nfByte *)pBuffer + nStop, cbCarryOver);
+						return;
+					}
+					memmove(m_Buffer.data(), pBuffer + nStop, cbCarryOver);
+					break;
+				}
+
+				// End of container or content that needs to be handled by the XML reader
+				pXMLReader->UnreadRaw((const nfByte *)pBuffer + nStop, cbBufferSize - nStop);
+				return;
+			}
+		}
+	}
+
+	class CModelReader_VertexDecoder {
+	private:
+		std::vector<NVEC3> & m_Vertices;
+		nfFloat m_fCoordinates[3];
+		nfUint32 m_nCoordinateMask;
+
+	public:
+		CModelReader_VertexDecoder(_In_ std::vector<NVEC3> & Vertices)
+			: m_Vertices(Vertices), m_nCoordinateMask(0)
+		{
+		}
+
+		inline void beginElement()
+		{
+			m_nCoordinateMask = 0;
+		}
+
+		inline nfBool attribute(_In_ const nfChar * pName, _In_ const nfChar * pNameEnd, _In_ const nfChar * pValue, _In_ const nfChar * pValueEnd)
+		{
+			if ((pNameEnd - pName) != 1)
+				return false;
+			nfUint32 nCoordinate = (nfUint32)(*pName - 'x');
+			if (nCoordinate > 2)
+				return false;
+
+			if (!decodeCoordinate(pValue, pValueEnd, m_fCoordinates[nCoordinate]))
+				return false;
+			m_nCoordinateMask |= (1 << nCoordinate);
+			return true;
+		}
+
+		inline nfBool endElement()
+		{
+			if (m_nCoordinateMask != 7)
+				return false;
+			m_Vertices.push_back(fnVEC3_make(m_fCoordinates[0], m_fCoordinates[1], m_fCoordinates[2]));
+			return true;
+		}
+	};
+
+	class CModelReader_TriangleDecoder {
+	private:
+		std::vector<MODELREADERTRIANGLE> & m_Triangles;
+		MODELREADERTRIANGLE m_Triangle;
+
+	public:
+		CModelReader_TriangleDecoder(_In_ std::vector<MODELREADERTRIANGLE> & Triangles)
+			: m_Triangles(Triangles)
+		{
+			beginElement();
+		}
+
+		inline void beginElement()
+		{
+			m_Triangle.m_nIndices[0] = -1;
+			m_Triangle.m_nIndices[1] = -1;
+			m_Triangle.m_nIndices[2] = -1;
+			m_Triangle.m_nPropertyID = 0;
+			m_Triangle.m_nPropertyIndices[0] = -1;
+			m_Triangle.m_nPropertyIndices[1] = -1;
+			m_Triangle.m_nPropertyIndices[2] = -1;
+		}
+
+		inline nfBool attribute(_In_ const nfChar * pName, _In_ const nfChar * pNameEnd, _In_ const nfChar * pValue, _In_ const nfChar * pValueEnd)
+		{
+			nfInt32 * pTarget = nullptr;
+			if ((pNameEnd - pName) == 2) {
+				nfUint32 nIndex = (nfUint32)(pName[1] - '1');
+				if (nIndex > 2)
+					return false;
+				if (pName[0] == 'v')
+					pTarget = &m_Triangle.m_nIndices[nIndex];
+				else if (pName[0] == 'p')
+					pTarget = &m_Triangle.m_nPropertyIndices[nIndex];
+				else
+					return false;
+			}
+			else if (((pNameEnd - pName) == 3) && (memcmp(pName, XML_3MF_ATTRIBUTE_TRIANGLE_PID, 3) == 0)) {
+				pTarget = &m_Triangle.m_nPropertyID;
+			}
+			else
+				return false;
+
+			return decodeIndex(pValue, pValueEnd, *pTarget);
+		}
+
+		inline nfBool endElement()
+		{
+			m_Triangles.push_back(m_Triangle);
+			return true;
+		}
+	};
+
+	CModelReader_MeshVertices::CModelReader_MeshVertices(_In_ CMesh * pMesh, _In_opt_ CModelReader_MeshStream * pMeshStream)
+		: m_pMesh(pMesh), m_pMeshStream(pMeshStream)
+	{
+		__NMRASSERT(pMesh);
+	}
+
+	void CModelReader_MeshVertices::prepareSegments(_In_ nfUint32 nSegmentCount)
+	{
+		if (m_SegmentVertices.size() < nSegmentCount)
+			m_SegmentVertices.resize(nSegmentCount);
+		for (nfUint32 nSegment = 0; nSegment < nSegmentCount; nSegment++)
+			m_SegmentVertices[nSegment].clear();
+	}
+
+	eModelReaderMeshContentStatus CModelReader_MeshVertices::decodeSegment(_In_ nfUint32 nSegmentIndex, _In_ const nfChar * pStart, _In_ const nfChar * pEnd, _Out_ const nfChar ** ppStop)
+	{
+		CModelReader_VertexDecoder Decoder(m_SegmentVertices[nSegmentIndex]);
+		return decodeElements(pStart, pEnd, XML_3MF_ELEMENT_VERTEX, XML_3MF_ELEMENT_VERTICES, Decoder, ppStop);
+	}
+
+	void CModelReader_MeshVertices::commitSegment(_In_ nfUint32 nSegmentIndex)
+	{
+		if (m_pMeshStream) {
+			for (auto & Vertex : m_SegmentVertices[nSegmentIndex])
+				m_pMeshStream->addVertex(Vertex);
+			if (!m_pMeshStream->retainGeometry())
+				return;
+		}
+
+		for (auto & Vertex : m_SegmentVertices[nSegmentIndex])
+			m_pMesh->addNode(Vertex);
+	}
+
+	void CModelReader_MeshVertices::reserveSegments(_In_ nfUint32 nSegmentCount)
+	{
+		if (m_pMeshStream && !m_pMeshStream->retainGeometry())
+			return;
+
+		nfUint32 nVertexCount = m_pMesh->getNodeCount();
+		for (nfUint32 nSegment = 0; nSegment < nSegmentCount; nSegment++)
+			nVertexCount += (nfUint32)m_SegmentVertices[nSegment].size();
+		m_pMesh->reserve(nVertexCount, 0, 0);
+	}
+
+	CModelReader_MeshTriangles::CModelReader_MeshTriangles(_In_ CMesh * pMesh, _In_ ModelReaderTriangleCallback fnAddTriangle, _In_opt_ CModelReader_MeshStream * pMeshStream)
+		: m_pMesh(pMesh), m_pMeshStream(pMeshStream), m_fnAddTriangle(fnAddTriangle)
+	{
+		__NMRASSERT(pMesh);
+		if (!fnAddTriangle)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+	}
+
+	void CModelReader_MeshTriangles::prepareSegments(_In_ nfUint32 nSegmentCount)
+	{
+		if (m_SegmentTriangles.size() < nSegmentCount)
+			m_SegmentTriangles.resize(nSegmentCount);
+		for (nfUint32 nSegment = 0; nSegment < nSegmentCount; nSegment++)
+			m_SegmentTriangles[nSegment].clear();
+	}
+
+	eModelReaderMeshContentStatus CModelReader_MeshTriangles::decodeSegment(_In_ nfUint32 nSegmentIndex, _In_ const nfChar * pStart, _In_ const nfChar * pEnd, _Out_ const nfChar ** ppStop)
+	{
+		CModelReader_TriangleDecoder Decoder(m_SegmentTriangles[nSegmentIndex]);
+		return decodeElements(pStart, pEnd, XML_3MF_ELEMENT_TRIANGLE, XML_3MF_ELEMENT_TRIANGLES, Decoder, ppStop);
+	}
+
+	void CModelReader_MeshTriangles::commitSegment(_In_ nfUint32 nSegmentIndex)
+	{
+		for (auto & Triangle : m_SegmentTriangles[nSegmentIndex])
+			m_fnAddTriangle(Triangle);
+	}
+
+	void CModelReader_MeshTriangles::reserveSegments(_In_ nfUint32 nSegmentCount)
+	{
+		if (m_pMeshStream && !m_pMeshStream->retainGeometry())
+			return;
+
+		nfUint32 nTriangleCount = m_pMesh->getFaceCount();
+		for (nfUint32 nSegment = 0; nSegment < nSegmentCount; nSegment++)
+			nTriangleCount += (nfUint32)m_SegmentTriangles[nSegment].size();
+		m_pMesh->reserve(0, nTriangleCount, 0);
+	}
+
+}
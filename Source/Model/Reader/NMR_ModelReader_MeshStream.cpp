@@ -0,0 +1,136 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelReader_MeshStream.cpp implements the sink for streamed mesh geometry. Vertices are
+always handed out before the triangles that follow them, and every block refers to a single
+mesh object.
+
+--*/
+
+#include "Model/Reader/NMR_ModelReader_MeshStream.h"
+#include "Common/Mesh/NMR_MeshTypes.h"
+#include "Common/NMR_Exception.h"
+
+namespace NMR {
+
+	CModelReader_MeshStream::CModelReader_MeshStream(_In_ ModelReaderVertexBlockCallback fnVertexBlock, _In_ ModelReaderTriangleBlockCallback fnTriangleBlock, _In_ nfBool bRetainGeometry)
+		: m_fnVertexBlock(fnVertexBlock), m_fnTriangleBlock(fnTriangleBlock), m_bRetainGeometry(bRetainGeometry)
+	{
+		m_nUniqueResourceID = 0;
+		m_nVertexCount = 0;
+		m_nTriangleCount = 0;
+		m_nFlushedVertexCount = 0;
+		m_nFlushedTriangleCount = 0;
+	}
+
+	nfBool CModelReader_MeshStream::retainGeometry() const
+	{
+		return m_bRetainGeometry;
+	}
+
+	void CModelReader_MeshStream::beginMesh(_In_ UniqueResourceID nUniqueResourceID)
+	{
+		m_nUniqueResourceID = nUniqueResourceID;
+		m_nVertexCount = 0;
+		m_nTriangleCount = 0;
+		m_nFlushedVertexCount = 0;
+		m_nFlushedTriangleCount = 0;
+		m_Vertices.clear();
+		m_Triangles.clear();
+	}
+
+	void CModelReader_MeshStream::endMesh()
+	{
+		flushVertices();
+		flushTriangles();
+	}
+
+	void CModelReader_MeshStream::flushVertices()
+	{
+		if (m_Vertices.empty())
+			return;
+
+		if (m_fnVertexBlock)
+			m_fnVertexBlock(m_nUniqueResourceID, m_nFlushedVertexCount, (nfUint32)m_Vertices.size(), m_Vertices.data());
+		m_nFlushedVertexCount = m_nVertexCount;
+		m_Vertices.clear();
+	}
+
+	void CModelReader_MeshStream::flushTriangles()
+	{
+		if (m_Triangles.empty())
+			return;
+
+		if (m_fnTriangleBlock)
+			m_fnTriangleBlock(m_nUniqueResourceID, m_nFlushedTriangleCount, (nfUint32)m_Triangles.size(), m_Triangles.data());
+		m_nFlushedTriangleCount = m_nTriangleCount;
+		m_Triangles.clear();
+	}
+
+	void CModelReader_MeshStream::addVertex(_In_ const NVEC3 & vPosition)
+	{
+		if (m_nVertexCount >= NMR_MESH_MAXNODECOUNT)
+			throw CNMRException(NMR_ERROR_TOOMANYNODES);
+
+		if (m_Vertices.empty())
+			m_Vertices.reserve(NMR_MODELREADER_MESHSTREAM_BLOCKSIZE);
+		m_Vertices.push_back(vPosition);
+		m_nVertexCount++;
+
+		if (m_Vertices.size() >= NMR_MODELREADER_MESHSTREAM_BLOCKSIZE)
+			flushVertices();
+	}
+
+	void CModelReader_MeshStream::addTriangle(_In_ nfUint32 nIndex1, _In_ nfUint32 nIndex2, _In_ nfUint32 nIndex3)
+	{
+		if (m_nTriangleCount >= NMR_MESH_MAXFACECOUNT)
+			throw CNMRException(NMR_ERROR_TOOMANYFACES);
+
+		// Triangles may only refer to vertices, which have already been handed out
+		flushVertices();
+
+		if (m_Triangles.empty())
+			m_Triangles.reserve(NMR_MODELREADER_MESHSTREAM_BLOCKSIZE);
+		m_Triangles.push_back({ { nIndex1, nIndex2, nIndex3 } });
+		m_nTriangleCount++;
+
+		if (m_Triangles.size() >= NMR_MODELREADER_MESHSTREAM_BLOCKSIZE)
+			flushTriangles();
+	}
+
+	nfUint32 CModelReader_MeshStream::getVertexCount() const
+	{
+		return m_nVertexCount;
+	}
+
+	nfUint32 CModelReader_MeshStream::getTriangleCount() const
+	{
+		return m_nTriangleCount;
+	}
+
+}
@@ -46,8 +46,8 @@ A mesh reader model node is a parser for the mesh node of an XML Model Stream.
 
 namespace NMR {
 
-	CModelReaderNode100_Mesh::CModelReaderNode100_Mesh(_In_ CModel * pModel, PModelMeshObject pMesh, _In_ PModelWarnings pWarnings,
-		_In_ PProgressMonitor pProgressMonitor, _In_ PPackageResourceID pObjectLevelPropertyID, _In_ ModelResourceIndex nDefaultPropertyIndex)
+	CModelReaderNode100_Mesh::CModelReaderNode100_Mesh(_In_ CModel * pModel, _In_ CModelMeshObject * pMesh, _In_ PModelWarnings pWarnings,
+		_In_ PProgressMonitor pProgressMonitor, _In_ PPackageResourceID pObjectLevelPropertyID, _In_ ModelResourceIndex nDefaultPropertyIndex, _In_ PThreadPool pThreadPool, _In_ PModelReader_MeshStream pMeshStream)
 		: CModelReaderNode(pWarnings, pProgressMonitor),
 		 m_pModel(pModel),
 		 m_pMesh(pMesh)
@@ -66,6 +66,11 @@ namespace NMR {
 
 		m_bHasVolumeDataID = false;
 		m_nVolumeDataID = 0;
+
+		m_pThreadPool = pThreadPool;
+		m_pMeshStream = pMeshStream;
+
+		m_bContentSkipped = false;
 	}
 
 	void CModelReaderNode100_Mesh::parseXML(_In_ CXmlReader * pXMLReader)
@@ -77,7 +82,17 @@ namespace NMR {
 		parseAttributes(pXMLReader);
 
 		// Parse Content
-		parseContent(pXMLReader);
+		if (m_pLazyMesh && m_pLazyMesh->skipContent(pXMLReader)) {
+			m_bContentSkipped = true;
+			parseContent(pXMLReader);
+		}
+		else if (m_pMeshStream) {
+			m_pMeshStream->beginMesh(m_pMesh->getPackageResourceID()->getUniqueID());
+			parseContent(pXMLReader);
+			m_pMeshStream->endMesh();
+		}
+		else
+			parseContent(pXMLReader);
 
 		if(m_bHasVolumeDataID)
 		{
@@ -153,7 +168,7 @@ namespace NMR {
 					m_pProgressMonitor->SetProgressIdentifier(ProgressIdentifier::PROGRESS_READMESH);
 					m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
 				}
-				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode100_Vertices>(mesh, m_pWarnings);
+				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode100_Vertices>(mesh, m_pWarnings, m_pThreadPool, m_pMeshStream);
 				pXMLNode->parseXML(pXMLReader);
 			}
 			else if (strcmp(pChildName, XML_3MF_ELEMENT_TRIANGLES) == 0)
@@ -163,7 +178,7 @@ namespace NMR {
 					m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
 				}
 				PModelReaderNode100_Triangles pXMLNode = std::make_shared<CModelReaderNode100_Triangles>(m_pModel, mesh, m_pWarnings,
-					m_pObjectLevelPropertyID, m_nObjectLevelPropertyIndex);
+					m_pObjectLevelPropertyID, m_nObjectLevelPropertyIndex, m_pThreadPool, m_pMeshStream);
 				pXMLNode->parseXML(pXMLReader);
 				if (m_pObjectLevelPropertyID && m_pObjectLevelPropertyID->getPackageModelPath() == 0) {
 					// warn, if object does not have an object-level property, but a triangle has one
@@ -184,6 +199,10 @@ namespace NMR {
 		if (strcmp(pNameSpace, XML_3MF_NAMESPACE_BEAMLATTICESPEC) == 0) {
 			if (strcmp(pChildName, XML_3MF_ELEMENT_BEAMLATTICE) == 0)
 			{
+				// Beams refer to the vertices of the mesh
+				if (m_pMeshStream && !m_pMeshStream->retainGeometry())
+					throw CNMRException(NMR_ERROR_MESHSTREAMGEOMETRYREQUIRED);
+
 				PModelReaderNode_BeamLattice1702_BeamLattice pXMLNode = std::make_shared<CModelReaderNode_BeamLattice1702_BeamLattice>(m_pModel, mesh, m_pWarnings);
 				pXMLNode->parseXML(pXMLReader);
 
@@ -198,6 +217,10 @@ namespace NMR {
 		if (strcmp(pNameSpace, XML_3MF_NAMESPACE_TRIANGLESETS) == 0) {
 			if (strcmp(pChildName, XML_3MF_ELEMENT_TRIANGLESETS) == 0)
 			{
+				// Triangle sets refer to the triangles of the mesh
+				if (m_pMeshStream && !m_pMeshStream->retainGeometry())
+					throw CNMRException(NMR_ERROR_MESHSTREAMGEOMETRYREQUIRED);
+
 				PModelReaderNode100_TriangleSets pXMLNode = std::make_shared<CModelReaderNode100_TriangleSets>(m_pModel, m_pMesh->getMesh(), m_pWarnings);
 				pXMLNode->parseXML(pXMLReader);
 
@@ -214,4 +237,14 @@ namespace NMR {
 		return m_pTriangleSets;
 	}
 
+	void CModelReaderNode100_Mesh::setLazyMesh(_In_ PModelReader_LazyMesh pLazyMesh)
+	{
+		m_pLazyMesh = pLazyMesh;
+	}
+
+	nfBool CModelReaderNode100_Mesh::getContentSkipped()
+	{
+		return m_bContentSkipped;
+	}
+
 }
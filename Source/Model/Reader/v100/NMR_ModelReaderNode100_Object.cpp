@@ -49,7 +49,7 @@ Stream.
 
 namespace NMR {
 
-	CModelReaderNode100_Object::CModelReaderNode100_Object(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor)
+	CModelReaderNode100_Object::CModelReaderNode100_Object(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_ PProgressMonitor pProgressMonitor, _In_ PThreadPool pThreadPool, _In_ PModelReader_MeshStream pMeshStream, _In_ PImportStream pLazyMeshPart)
 		: CModelReaderNode(pWarnings, pProgressMonitor)
 	{
 		// Initialize variables
@@ -72,6 +72,10 @@ namespace NMR {
 		m_nSliceStackId = 0;
 		m_eSlicesMeshResolution = MODELSLICESMESHRESOLUTION_FULL;
 		m_bHasMeshResolution = false;
+
+		m_pThreadPool = pThreadPool;
+		m_pMeshStream = pMeshStream;
+		m_pLazyMeshPart = pLazyMeshPart;
 	}
 
 	void CModelReaderNode100_Object::parseXML(_In_ CXmlReader * pXMLReader)
@@ -246,23 +250,35 @@ namespace NMR {
 				}
 				
 				// Read Mesh
-				PModelReaderNode100_Mesh pXMLNode = std::make_shared<CModelReaderNode100_Mesh>(m_pModel, meshObject,
-					m_pWarnings, m_pProgressMonitor, m_pObjectLevelPropertyID, m_nObjectLevelPropertyIndex);
+				PModelReaderNode100_Mesh pXMLNode = std::make_shared<CModelReaderNode100_Mesh>(m_pModel, meshObject.get(),
+					m_pWarnings, m_pProgressMonitor, m_pObjectLevelPropertyID, m_nObjectLevelPropertyIndex, m_pThreadPool, m_pMeshStream);
+				PModelReader_LazyMesh pLazyMesh;
+				if (m_pLazyMeshPart) {
+					pLazyMesh = createLazyMesh();
+					pXMLNode->setLazyMesh(pLazyMesh);
+				}
 				pXMLNode->parseXML(pXMLReader);
 
-				// store triangle sets in memory model
-				auto triangleSets = pXMLNode->getTriangleSets();
-				for (auto triangleSet : triangleSets)
-					meshObject->addTriangleSet(triangleSet);
+				if (pXMLNode->getContentSkipped()) {
+					// The geometry and the data referring to it are read on first access
+					meshObject->setMeshLoader(pLazyMesh);
+					m_pModel->addResource(m_pObject);
+				}
+				else {
+					// store triangle sets in memory model
+					auto triangleSets = pXMLNode->getTriangleSets();
+					for (auto triangleSet : triangleSets)
+						meshObject->addTriangleSet(triangleSet);
 
-				// Add Object to Parent
-				m_pModel->addResource(m_pObject);
+					// Add Object to Parent
+					m_pModel->addResource(m_pObject);
 
-				// Handle BeamLattice Data
-				handleBeamLatticeExtension(pXMLNode.get());
+					// Handle BeamLattice Data
+					handleBeamLatticeExtension(meshObject.get(), pXMLNode.get());
 
-				// Create Default Properties
-				createDefaultProperties();
+					// Create Default Properties
+					createDefaultProperties(meshObject.get());
+				}
 			}
 			// Read a component object
 			else if (strcmp(pChildName, XML_3MF_ELEMENT_COMPONENTS) == 0) {
@@ -347,13 +363,9 @@ namespace NMR {
     }
 
 	// Create the object-level property from m_nObjectLevelPropertyID, if defined
-	void CModelReaderNode100_Object::createDefaultProperties()
+	void CModelReaderNode100_Object::createDefaultProperties(_In_ CModelMeshObject * pMeshObject)
 	{
-		if (m_pObject.get() == nullptr)
-			return;
-
 		if (m_bHasDefaultPropertyIndex && m_bHasDefaultPropertyID) {
-			CModelMeshObject* pMeshObject = dynamic_cast<CModelMeshObject*>(m_pObject.get());
 			if (pMeshObject) {
 				CMesh * pMesh = pMeshObject->getMesh();
 				if (pMesh) {
@@ -393,9 +405,8 @@ namespace NMR {
 		}
 	}
 
-	void CModelReaderNode100_Object::handleBeamLatticeExtension(CModelReaderNode100_Mesh* pXMLNode)
+	void CModelReaderNode100_Object::handleBeamLatticeExtension(_In_ CModelMeshObject * pMeshObject, _In_ CModelReaderNode100_Mesh* pXMLNode)
 	{
-		CModelMeshObject* pMeshObject = dynamic_cast<CModelMeshObject*>(m_pObject.get());
 		if (pMeshObject == nullptr || pXMLNode == nullptr)
 			return;
 
@@ -450,4 +461,51 @@ namespace NMR {
 			}
 		}
 	}
+
+	PModelReader_LazyMesh CModelReaderNode100_Object::createLazyMesh()
+	{
+		// The copy is used after the reader has finished, so it neither reports progress nor uses worker threads
+		PModelReaderNode100_Object pObjectNode = std::make_shared<CModelReaderNode100_Object>(m_pModel, m_pWarnings, nullptr, nullptr, nullptr, nullptr);
+		pObjectNode->m_bHasDefaultPropertyID = m_bHasDefaultPropertyID;
+		pObjectNode->m_bHasDefaultPropertyIndex = m_bHasDefaultPropertyIndex;
+		pObjectNode->m_nObjectLevelPropertyModelID = m_nObjectLevelPropertyModelID;
+		pObjectNode->m_pObjectLevelPropertyID = m_pObjectLevelPropertyID;
+		pObjectNode->m_nObjectLevelPropertyIndex = m_nObjectLevelPropertyIndex;
+
+		return std::make_shared<CModelReaderNode100_LazyMesh>(pObjectNode, m_pLazyMeshPart, m_pModel, m_pModel->currentPath());
+	}
+
+	void CModelReaderNode100_Object::readLazyMesh(_In_ CXmlReader * pXMLReader, _In_ CModelMeshObject * pMeshObject)
+	{
+		__NMRASSERT(pXMLReader);
+		__NMRASSERT(pMeshObject);
+
+		PModelReaderNode100_Mesh pXMLNode = std::make_shared<CModelReaderNode100_Mesh>(m_pModel, pMeshObject,
+			m_pWarnings, m_pProgressMonitor, m_pObjectLevelPropertyID, m_nObjectLevelPropertyIndex, m_pThreadPool, m_pMeshStream);
+		pXMLNode->parseXML(pXMLReader);
+
+		// store triangle sets in memory model
+		auto triangleSets = pXMLNode->getTriangleSets();
+		for (auto triangleSet : triangleSets)
+			pMeshObject->addTriangleSet(triangleSet);
+
+		// Handle BeamLattice Data
+		handleBeamLatticeExtension(pMeshObject, pXMLNode.get());
+
+		// Create Default Properties
+		createDefaultProperties(pMeshObject);
+	}
+
+	CModelReaderNode100_LazyMesh::CModelReaderNode100_LazyMesh(_In_ PModelReaderNode100_Object pObjectNode, _In_ PImportStream pPartStream, _In_ CModel * pModel, _In_ const std::string & sPath)
+		: CModelReader_LazyMesh(pPartStream, pModel, sPath), m_pObjectNode(pObjectNode)
+	{
+		if (!pObjectNode)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+	}
+
+	void CModelReaderNode100_LazyMesh::parseMesh(_In_ CXmlReader * pXMLReader, _In_ CModelMeshObject * pMeshObject)
+	{
+		m_pObjectNode->readLazyMesh(pXMLReader, pMeshObject);
+	}
+
 }
@@ -55,7 +55,7 @@ XML Model Stream.
 namespace NMR {
 
 	CModelReaderNode100_Resources::CModelReaderNode100_Resources(_In_ CModel * pModel, _In_ PModelWarnings pWarnings, _In_z_ const std::string sPath,
-		_In_ PProgressMonitor pProgressMonitor)
+		_In_ PProgressMonitor pProgressMonitor, _In_ PThreadPool pThreadPool, _In_ PModelReader_MeshStream pMeshStream, _In_ PImportStream pLazyMeshPart)
 		: CModelReaderNode(pWarnings, pProgressMonitor)
 	{
 		__NMRASSERT(pModel);
@@ -63,6 +63,9 @@ namespace NMR {
 		m_pModel = pModel;
 		m_sPath = sPath;
 		m_nProgressCount = 0;
+		m_pThreadPool = pThreadPool;
+		m_pMeshStream = pMeshStream;
+		m_pLazyMeshPart = pLazyMeshPart;
 	}
 
 	void CModelReaderNode100_Resources::parseXML(_In_ CXmlReader * pXMLReader)
@@ -94,7 +97,7 @@ namespace NMR {
 				m_pProgressMonitor->SetProgressIdentifier(ProgressIdentifier::PROGRESS_READRESOURCES);
 				m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
 
-				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode100_Object>(m_pModel, m_pWarnings, m_pProgressMonitor);
+				PModelReaderNode pXMLNode = std::make_shared<CModelReaderNode100_Object>(m_pModel, m_pWarnings, m_pProgressMonitor, m_pThreadPool, m_pMeshStream, m_pLazyMeshPart);
 				pXMLNode->parseXML(pXMLReader);
 
 			}
@@ -68,87 +68,55 @@ namespace NMR {
 		parseContent(pXMLReader);
 	}
 
-	void CModelReaderNode100_Triangle::retrieveIndices(_Out_ nfInt32 & nIndex1, _Out_ nfInt32 & nIndex2, _Out_ nfInt32 & nIndex3, nfInt32 nNodeCount)
+	void CModelReaderNode100_Triangle::retrieveTriangle(_Out_ MODELREADERTRIANGLE & Triangle)
 	{
-		if ((m_nIndex1 < 0) || (m_nIndex2 < 0) || (m_nIndex3 < 0))
-			throw CNMRException(NMR_ERROR_INVALIDMODELNODEINDEX);
-
-		if ((m_nIndex1 >= nNodeCount) || (m_nIndex2 >= nNodeCount) || (m_nIndex3 >= nNodeCount))
-			throw CNMRException(NMR_ERROR_INVALIDMODELNODEINDEX);
-
-		nIndex1 = m_nIndex1;
-		nIndex2 = m_nIndex2;
-		nIndex3 = m_nIndex3;
-	}
-
-	nfBool CModelReaderNode100_Triangle::retrieveProperties(_Inout_ ModelResourceID & nPropertyID, _Inout_ ModelResourceIndex & nPropertyIndex1, _Inout_ ModelResourceIndex & nPropertyIndex2, _Inout_ ModelResourceIndex & nPropertyIndex3)
-	{
-
-		if (m_nPropertyID == 0)
-			return false;
-		if (m_nPropertyIndex1 < 0)
-			return false;
-
-		// See Core Spec 4.1.3.1 (Triangle)
-		nPropertyID = m_nPropertyID;
-		nPropertyIndex1 = m_nPropertyIndex1;
-
-		if (m_nPropertyIndex2 >= 0) {
-			nPropertyIndex2 = m_nPropertyIndex2;
-		}
-		else {
-			nPropertyIndex2 = m_nPropertyIndex1;
-		}
-
-		if (m_nPropertyIndex3 >= 0) {
-			nPropertyIndex3 = m_nPropertyIndex3;
-		}
-		else {
-			nPropertyIndex3 = m_nPropertyIndex1;
-		}
-
-		return true;
-
+		Triangle.m_nIndices[0] = m_nIndex1;
+		Triangle.m_nIndices[1] = m_nIndex2;
+		Triangle.m_nIndices[2] = m_nIndex3;
+		Triangle.m_nPropertyID = m_nPropertyID;
+		Triangle.m_nPropertyIndices[0] = m_nPropertyIndex1;
+		Triangle.m_nPropertyIndices[1] = m_nPropertyIndex2;
+		Triangle.m_nPropertyIndices[2] = m_nPropertyIndex3;
 	}
 
-	void CModelReaderNode100_Triangle::OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue)
+	void CModelReaderNode100_Triangle::OnSizedAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue, _In_ nfUint32 nValueLength)
 	{
 		__NMRASSERT(pAttributeName);
 		__NMRASSERT(pAttributeValue);
 		nfInt32 nValue;
 
 		if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_TRIANGLE_V1) == 0) {
-			nValue = fnStringToInt32(pAttributeValue);
+			nValue = fnStringToInt32(pAttributeValue, nValueLength);
 			if ((nValue >= 0) && (nValue < XML_3MF_MAXRESOURCEINDEX))
 				m_nIndex1 = nValue;
 		}
 		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_TRIANGLE_V2) == 0) {
-			nValue = fnStringToInt32(pAttributeValue);
+			nValue = fnStringToInt32(pAttributeValue, nValueLength);
 			if ((nValue >= 0) && (nValue < XML_3MF_MAXRESOURCEINDEX))
 				m_nIndex2 = nValue;
 		}
 		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_TRIANGLE_V3) == 0) {
-			nValue = fnStringToInt32(pAttributeValue);
+			nValue = fnStringToInt32(pAttributeValue, nValueLength);
 			if ((nValue >= 0) && (nValue < XML_3MF_MAXRESOURCEINDEX))
 				m_nIndex3 = nValue;
 		}
 		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_TRIANGLE_PID) == 0) {
-			nValue = fnStringToInt32(pAttributeValue);
+			nValue = fnStringToInt32(pAttributeValue, nValueLength);
 			if ((nValue >= 0) && (nValue < XML_3MF_MAXRESOURCEID))
 				m_nPropertyID = nValue;
 		}
 		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_TRIANGLE_P1) == 0) {
-			nValue = fnStringToInt32(pAttributeValue);
+			nValue = fnStringToInt32(pAttributeValue, nValueLength);
 			if ((nValue >= 0) && (nValue < XML_3MF_MAXRESOURCEINDEX))
 				m_nPropertyIndex1 = nValue;
 		}
 		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_TRIANGLE_P2) == 0) {
-			nValue = fnStringToInt32(pAttributeValue);
+			nValue = fnStringToInt32(pAttributeValue, nValueLength);
 			if ((nValue >= 0) && (nValue < XML_3MF_MAXRESOURCEINDEX))
 				m_nPropertyIndex2 = nValue;
 		}
 		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_TRIANGLE_P3) == 0) {
-			nValue = fnStringToInt32(pAttributeValue);
+			nValue = fnStringToInt32(pAttributeValue, nValueLength);
 			if ((nValue >= 0) && (nValue < XML_3MF_MAXRESOURCEINDEX))
 				m_nPropertyIndex3 = nValue;
 		}
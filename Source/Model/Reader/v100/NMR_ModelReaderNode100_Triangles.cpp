@@ -44,7 +44,7 @@ XML Model Stream.
 namespace NMR {
 
 	CModelReaderNode100_Triangles::CModelReaderNode100_Triangles(_In_ CModel * pModel, _In_ CMesh * pMesh,
-		_In_ PModelWarnings pWarnings, _In_ PPackageResourceID pObjectLevelPropertyID, _In_ ModelResourceIndex nDefaultPropertyIndex)
+		_In_ PModelWarnings pWarnings, _In_ PPackageResourceID pObjectLevelPropertyID, _In_ ModelResourceIndex nDefaultPropertyIndex, _In_ PThreadPool pThreadPool, _In_ PModelReader_MeshStream pMeshStream)
 		: CModelReaderNode(pWarnings)
 	{
 		__NMRASSERT(pMesh);
@@ -54,6 +54,8 @@ namespace NMR {
 		m_nDefaultResourceIndex = nDefaultPropertyIndex;
 
 		m_nUsedResourceID = 0;
+		m_pThreadPool = pThreadPool;
+		m_pMeshStream = pMeshStream;
 
 		m_pModel = pModel;
 		m_pMesh = pMesh;
@@ -67,6 +69,12 @@ namespace NMR {
 		// Parse attribute
 		parseAttributes(pXMLReader);
 
+		// Decode plain triangle elements directly from the XML stream
+		if (CModelReader_MeshContent::canParse(pXMLReader)) {
+			CModelReader_MeshTriangles MeshTriangles(m_pMesh, [this](const MODELREADERTRIANGLE & Triangle) { addTriangle(Triangle); }, m_pMeshStream.get());
+			MeshTriangles.parse(pXMLReader, m_pThreadPool.get());
+		}
+
 		// Parse Content
 		parseContent(pXMLReader);
 	}
@@ -99,6 +107,89 @@ namespace NMR {
 	}
 
 
+	void CModelReaderNode100_Triangles::addTriangle(_In_ const MODELREADERTRIANGLE & Triangle)
+	{
+		// Retrieve node indices
+		nfInt32 nNodeCount = m_pMeshStream ? (nfInt32)m_pMeshStream->getVertexCount() : (nfInt32)m_pMesh->getNodeCount();
+		for (nfUint32 j = 0; j < 3; j++) {
+			if ((Triangle.m_nIndices[j] < 0) || (Triangle.m_nIndices[j] >= nNodeCount))
+				throw CNMRException(NMR_ERROR_INVALIDMODELNODEINDEX);
+		}
+		nfInt32 nIndex1 = Triangle.m_nIndices[0];
+		nfInt32 nIndex2 = Triangle.m_nIndices[1];
+		nfInt32 nIndex3 = Triangle.m_nIndices[2];
+
+		// Create face if valid
+		if ((nIndex1 != nIndex2) && (nIndex1 != nIndex3) && (nIndex2 != nIndex3)) {
+			if (m_pMeshStream) {
+				m_pMeshStream->addTriangle(nIndex1, nIndex2, nIndex3);
+				if (!m_pMeshStream->retainGeometry())
+					return;
+			}
+
+			MESHNODE * pNode1 = m_pMesh->getNode(nIndex1);
+			MESHNODE * pNode2 = m_pMesh->getNode(nIndex2);
+			MESHNODE * pNode3 = m_pMesh->getNode(nIndex3);
+			MESHFACE * pFace = m_pMesh->addFace(pNode1, pNode2, pNode3);
+
+			ModelResourceID nModelResourceID = 0;
+			if (m_pObjectLevelPropertyID)
+				nModelResourceID = m_pObjectLevelPropertyID->getModelResourceID();
+			ModelResourceIndex nResourceIndex1 = m_nDefaultResourceIndex;
+			ModelResourceIndex nResourceIndex2 = m_nDefaultResourceIndex;
+			ModelResourceIndex nResourceIndex3 = m_nDefaultResourceIndex;
+
+			// See Core Spec 4.1.3.1 (Triangle)
+			nfBool bHasProperties = (Triangle.m_nPropertyID != 0) && (Triangle.m_nPropertyIndices[0] >= 0);
+			if (bHasProperties) {
+				nModelResourceID = Triangle.m_nPropertyID;
+				nResourceIndex1 = Triangle.m_nPropertyIndices[0];
+				nResourceIndex2 = (Triangle.m_nPropertyIndices[1] >= 0) ? Triangle.m_nPropertyIndices[1] : Triangle.m_nPropertyIndices[0];
+				nResourceIndex3 = (Triangle.m_nPropertyIndices[2] >= 0) ? Triangle.m_nPropertyIndices[2] : Triangle.m_nPropertyIndices[0];
+			}
+
+			if (bHasProperties || (nModelResourceID != 0)) {
+				// set potential default properties (i.e. used pid)
+				m_nUsedResourceID = nModelResourceID;
+
+				PPackageResourceID pID = m_pModel->findPackageResourceID(m_pModel->currentPath(), nModelResourceID);
+				if (pID.get()) {
+					// Find and Assign Resource of this Property
+					PModelResource pResource = m_pModel->findResource(pID->getUniqueID());
+					if (pResource.get () != nullptr) {
+						if (!pResource->hasResourceIndexMap())
+							pResource->buildResourceIndexMap();
+
+						ModelPropertyID pPropertyID1;
+						ModelPropertyID pPropertyID2;
+						ModelPropertyID pPropertyID3;
+						if (pResource->mapResourceIndexToPropertyID(nResourceIndex1, pPropertyID1)
+							&& pResource->mapResourceIndexToPropertyID(nResourceIndex2, pPropertyID2) 
+							&& pResource->mapResourceIndexToPropertyID(nResourceIndex3, pPropertyID3)) {
+
+							CMeshInformation_Properties * pProperties = createPropertiesInformation();
+							MESHINFORMATION_PROPERTIES* pFaceData = (MESHINFORMATION_PROPERTIES*)pProperties->getFaceData(pFace->m_index);
+							if (pFaceData) {
+								pFaceData->m_nUniqueResourceID = pID->getUniqueID();
+								pFaceData->m_nPropertyIDs[0] = pPropertyID1;
+								pFaceData->m_nPropertyIDs[1] = pPropertyID2;
+								pFaceData->m_nPropertyIDs[2] = pPropertyID3;
+							}
+						} else {
+							m_pWarnings->addException(CNMRException(NMR_ERROR_INVALIDMESHINFORMATIONINDEX), mrwInvalidOptionalValue);
+						}
+					}
+				}
+				else {
+					m_pWarnings->addException(CNMRException(NMR_ERROR_INVALIDMODELRESOURCE), mrwInvalidOptionalValue);
+				}
+
+			}
+		}
+		else
+			throw CNMRException(NMR_ERROR_INVALIDMODELCOORDINATEINDICES);
+	}
+
 	void CModelReaderNode100_Triangles::OnNSChildElement(_In_z_ const nfChar * pChildName, _In_z_ const nfChar * pNameSpace, _In_ CXmlReader * pXMLReader)
 	{
 		__NMRASSERT(pChildName);
@@ -111,64 +202,9 @@ namespace NMR {
 				PModelReaderNode100_Triangle pXMLNode = std::make_shared<CModelReaderNode100_Triangle>(m_pWarnings);
 				pXMLNode->parseXML(pXMLReader);
 
-				// Retrieve node indices
-				nfInt32 nIndex1, nIndex2, nIndex3;
-				pXMLNode->retrieveIndices(nIndex1, nIndex2, nIndex3, m_pMesh->getNodeCount());
-
-				// Create face if valid
-				if ((nIndex1 != nIndex2) && (nIndex1 != nIndex3) && (nIndex2 != nIndex3)) {
-					MESHNODE * pNode1 = m_pMesh->getNode(nIndex1);
-					MESHNODE * pNode2 = m_pMesh->getNode(nIndex2);
-					MESHNODE * pNode3 = m_pMesh->getNode(nIndex3);
-					MESHFACE * pFace = m_pMesh->addFace(pNode1, pNode2, pNode3);
-
-					ModelResourceID nModelResourceID = 0;
-					if (m_pObjectLevelPropertyID)
-						nModelResourceID = m_pObjectLevelPropertyID->getModelResourceID();
-					ModelResourceIndex nResourceIndex1 = m_nDefaultResourceIndex;
-					ModelResourceIndex nResourceIndex2 = m_nDefaultResourceIndex;
-					ModelResourceIndex nResourceIndex3 = m_nDefaultResourceIndex;
-
-					if (pXMLNode->retrieveProperties(nModelResourceID, nResourceIndex1, nResourceIndex2, nResourceIndex3) || (nModelResourceID != 0)) {
-						// set potential default properties (i.e. used pid)
-						m_nUsedResourceID = nModelResourceID;
-
-						PPackageResourceID pID = m_pModel->findPackageResourceID(m_pModel->currentPath(), nModelResourceID);
-						if (pID.get()) {
-							// Find and Assign Resource of this Property
-							PModelResource pResource = m_pModel->findResource(pID->getUniqueID());
-							if (pResource.get () != nullptr) {
-								if (!pResource->hasResourceIndexMap())
-									pResource->buildResourceIndexMap();
-
-								ModelPropertyID pPropertyID1;
-								ModelPropertyID pPropertyID2;
-								ModelPropertyID pPropertyID3;
-								if (pResource->mapResourceIndexToPropertyID(nResourceIndex1, pPropertyID1)
-									&& pResource->mapResourceIndexToPropertyID(nResourceIndex2, pPropertyID2) 
-									&& pResource->mapResourceIndexToPropertyID(nResourceIndex3, pPropertyID3)) {
-
-									CMeshInformation_Properties * pProperties = createPropertiesInformation();
-									MESHINFORMATION_PROPERTIES* pFaceData = (MESHINFORMATION_PROPERTIES*)pProperties->getFaceData(pFace->m_index);
-									if (pFaceData) {
-										pFaceData->m_nUniqueResourceID = pID->getUniqueID();
-										pFaceData->m_nPropertyIDs[0] = pPropertyID1;
-										pFaceData->m_nPropertyIDs[1] = pPropertyID2;
-										pFaceData->m_nPropertyIDs[2] = pPropertyID3;
-									}
-								} else {
-									m_pWarnings->addException(CNMRException(NMR_ERROR_INVALIDMESHINFORMATIONINDEX), mrwInvalidOptionalValue);
-								}
-							}
-						}
-						else {
-							m_pWarnings->addException(CNMRException(NMR_ERROR_INVALIDMODELRESOURCE), mrwInvalidOptionalValue);
-						}
-
-					}
-				}
-				else
-					throw CNMRException(NMR_ERROR_INVALIDMODELCOORDINATEINDICES);
+				MODELREADERTRIANGLE Triangle;
+				pXMLNode->retrieveTriangle(Triangle);
+				addTriangle(Triangle);
 			}
 			else
 				m_pWarnings->addException(CNMRException(NMR_ERROR_NAMESPACE_INVALID_ELEMENT), mrwInvalidOptionalValue);
@@ -76,13 +76,13 @@ namespace NMR {
 		fZ = m_fZ;
 	}
 
-	void CModelReaderNode100_Vertex::OnAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue)
+	void CModelReaderNode100_Vertex::OnSizedAttribute(_In_z_ const nfChar * pAttributeName, _In_z_ const nfChar * pAttributeValue, _In_ nfUint32 nValueLength)
 	{
 		__NMRASSERT(pAttributeName);
 		__NMRASSERT(pAttributeValue);
 
 		if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_VERTEX_X) == 0) {
-			m_fX = fnStringToFloat(pAttributeValue);
+			m_fX = fnStringToFloat(pAttributeValue, nValueLength);
 			if (std::isnan (m_fX))
 				throw CNMRException(NMR_ERROR_INVALIDMODELCOORDINATES);
 			if (fabs (m_fX) > XML_3MF_MAXIMUMCOORDINATEVALUE)
@@ -90,7 +90,7 @@ namespace NMR {
 			m_bHasX = true;
 		}
 		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_VERTEX_Y) == 0) {
-			m_fY = fnStringToFloat(pAttributeValue);
+			m_fY = fnStringToFloat(pAttributeValue, nValueLength);
 			if (std::isnan (m_fY))
 				throw CNMRException(NMR_ERROR_INVALIDMODELCOORDINATES);
 			if (fabs(m_fY) > XML_3MF_MAXIMUMCOORDINATEVALUE)
@@ -98,7 +98,7 @@ namespace NMR {
 			m_bHasY = true;
 		}
 		else if (strcmp(pAttributeName, XML_3MF_ATTRIBUTE_VERTEX_Z) == 0) {
-			m_fZ = fnStringToFloat(pAttributeValue);
+			m_fZ = fnStringToFloat(pAttributeValue, nValueLength);
 			if (std::isnan (m_fZ))
 				throw CNMRException(NMR_ERROR_INVALIDMODELCOORDINATES);
 			if (fabs(m_fZ) > XML_3MF_MAXIMUMCOORDINATEVALUE)
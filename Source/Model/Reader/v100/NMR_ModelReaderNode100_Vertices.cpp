@@ -34,6 +34,7 @@ XML Model Stream.
 
 #include "Model/Reader/v100/NMR_ModelReaderNode100_Vertices.h"
 #include "Model/Reader/v100/NMR_ModelReaderNode100_Vertex.h"
+#include "Model/Reader/NMR_ModelReader_MeshContent.h"
 
 #include "Model/Classes/NMR_ModelConstants.h"
 #include "Common/NMR_StringUtils.h"
@@ -42,11 +43,13 @@ XML Model Stream.
 
 namespace NMR {
 
-	CModelReaderNode100_Vertices::CModelReaderNode100_Vertices(_In_ CMesh * pMesh, _In_ PModelWarnings pWarnings)
+	CModelReaderNode100_Vertices::CModelReaderNode100_Vertices(_In_ CMesh * pMesh, _In_ PModelWarnings pWarnings, _In_ PThreadPool pThreadPool, _In_ PModelReader_MeshStream pMeshStream)
 		: CModelReaderNode(pWarnings)
 	{
 		__NMRASSERT(pMesh);
 		m_pMesh = pMesh;
+		m_pThreadPool = pThreadPool;
+		m_pMeshStream = pMeshStream;
 	}
 
 	void CModelReaderNode100_Vertices::parseXML(_In_ CXmlReader * pXMLReader)
@@ -57,6 +60,12 @@ namespace NMR {
 		// Parse attribute
 		parseAttributes(pXMLReader);
 
+		// Decode plain vertex elements directly from the XML stream
+		if (CModelReader_MeshContent::canParse(pXMLReader)) {
+			CModelReader_MeshVertices MeshVertices(m_pMesh, m_pMeshStream.get());
+			MeshVertices.parse(pXMLReader, m_pThreadPool.get());
+		}
+
 		// Parse Content
 		parseContent(pXMLReader);
 	}
@@ -82,7 +91,13 @@ namespace NMR {
 				// Create Mesh Node
 				nfFloat fX, fY, fZ;
 				pXMLNode->retrievePosition(fX, fY, fZ);
-				m_pMesh->addNode(fnVEC3_make(fX, fY, fZ));
+				NVEC3 vPosition = fnVEC3_make(fX, fY, fZ);
+				if (m_pMeshStream) {
+					m_pMeshStream->addVertex(vPosition);
+					if (!m_pMeshStream->retainGeometry())
+						return;
+				}
+				m_pMesh->addNode(vPosition);
 			}
 			else
 				m_pWarnings->addException(CNMRException(NMR_ERROR_NAMESPACE_INVALID_ELEMENT), mrwInvalidOptionalValue);
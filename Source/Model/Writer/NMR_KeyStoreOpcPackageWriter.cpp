@@ -56,13 +56,13 @@ NMR_OpcPackageWriter.cpp defines an OPC Package writer in a portable way.
 namespace NMR {
 
 
-	CKeyStoreOpcPackageWriter::CKeyStoreOpcPackageWriter(_In_ PExportStream pImportStream, _In_ CModelContext const & context)
+	CKeyStoreOpcPackageWriter::CKeyStoreOpcPackageWriter(_In_ PExportStream pImportStream, _In_ CModelContext const & context, _In_ PThreadPool pThreadPool)
 		:m_pContext(context)
 	{
 		if (!context.isComplete())
 			throw CNMRException(NMR_ERROR_INVALIDPOINTER);
 
-		m_pPackageWriter = std::make_shared<COpcPackageWriter>(pImportStream);
+		m_pPackageWriter = std::make_shared<COpcPackageWriter>(pImportStream, pThreadPool);
 		refreshAllResourceDataGroups();
 	}
 
@@ -108,7 +108,7 @@ namespace NMR {
 		return false;
 	}
 
-	POpcPackagePart CKeyStoreOpcPackageWriter::wrapPartStream(PKeyStoreResourceData rd, POpcPackagePart part) {
+	POpcPackagePart CKeyStoreOpcPackageWriter::wrapPartStream(PKeyStoreResourceData rd, POpcPackagePart part, nfInt32 nCompressionLevel) {
 		PSecureContext const & secureContext = m_pContext.secureContext();
 		ContentEncryptionDescriptor p = secureContext->getDekCtx();
 		PKeyStoreResourceDataGroup rdg = m_pContext.keyStore()->findResourceDataGroupByResourceDataPath(rd->packagePath());
@@ -117,7 +117,7 @@ namespace NMR {
 		PExportStream stream;
 		PExportStream encryptStream = std::make_shared<CExportStream_Encrypted>(part->getExportStream(), p);
 		if (rd->isCompressed()) {
-			PExportStream compressStream = std::make_shared<CExportStream_Compressed>(encryptStream);
+			PExportStream compressStream = std::make_shared<CExportStream_Compressed>(encryptStream, nCompressionLevel);
 			stream = compressStream;
 		} else {
 			stream = encryptStream;
@@ -149,20 +149,28 @@ namespace NMR {
 		}
 	}
 
-	POpcPackagePart CKeyStoreOpcPackageWriter::addPart(_In_ std::string sPath)
+	POpcPackagePart CKeyStoreOpcPackageWriter::addPart(_In_ std::string sPath, _In_ nfInt32 nCompressionLevel)
 	{
 		PSecureContext const & secureContext = m_pContext.secureContext();
 		PKeyStore const & keyStore = m_pContext.keyStore();
 
-		auto pPart = m_pPackageWriter->addPart(sPath);
 		NMR::PKeyStoreResourceData rd = keyStore->findResourceData(sPath);
-		if (nullptr != rd) {
-			if (secureContext->hasDekCtx()) {
-				return wrapPartStream(rd, pPart);
-			} else {
-				m_pContext.warnings()->addWarning(NMR_ERROR_DEKDESCRIPTORNOTFOUND, eModelWarningLevel::mrwFatal);
+		if ((nullptr != rd) && secureContext->hasDekCtx()) {
+			// Unless a level has been set, encrypted parts are deflated with the zlib default
+			// within a deflated ZIP entry, as they always have been
+			if (nCompressionLevel == ZIPCOMPRESSIONLEVEL_UNSPECIFIED) {
+				auto pPart = m_pPackageWriter->addPart(sPath, ZIPCOMPRESSIONLEVEL_UNSPECIFIED);
+				return wrapPartStream(rd, pPart, Z_DEFAULT_COMPRESSION);
 			}
+
+			// Encrypted data does not deflate any further, so the ZIP entry itself is stored
+			auto pPart = m_pPackageWriter->addPart(sPath, ZIPCOMPRESSIONLEVEL_STORED);
+			return wrapPartStream(rd, pPart, nCompressionLevel);
 		}
+
+		auto pPart = m_pPackageWriter->addPart(sPath, nCompressionLevel);
+		if (nullptr != rd)
+			m_pContext.warnings()->addWarning(NMR_ERROR_DEKDESCRIPTORNOTFOUND, eModelWarningLevel::mrwFatal);
 		return pPart;
 	}
 
@@ -178,7 +186,7 @@ namespace NMR {
 		}
 
 		if (!keyStore->empty()) {
-			POpcPackagePart pKeyStorePart = m_pPackageWriter->addPart(PACKAGE_3D_KEYSTORE_URI);
+			POpcPackagePart pKeyStorePart = m_pPackageWriter->addPart(PACKAGE_3D_KEYSTORE_URI, ZIPCOMPRESSIONLEVEL_FASTEST);
 			m_pPackageWriter->addContentType(pKeyStorePart, PACKAGE_KEYSTORE_CONTENT_TYPE);
 			m_pPackageWriter->addRootRelationship(PACKAGE_KEYSTORE_RELATIONSHIP_TYPE, pKeyStorePart.get());
 			m_pPackageWriter->addRootRelationship(PACKAGE_MUST_PRESERVE_RELATIONSHIP_TYPE, pKeyStorePart.get());
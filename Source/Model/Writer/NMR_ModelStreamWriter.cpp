@@ -0,0 +1,214 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+NMR_ModelStreamWriter.cpp implements a writer, which streams mesh objects into the root model part
+of a 3MF package while they are generated.
+
+--*/
+
+#include "Model/Writer/NMR_ModelStreamWriter.h"
+#include "Model/Writer/NMR_ModelWriter.h"
+#include "Model/Classes/NMR_ModelConstants.h"
+#include "Common/MeshInformation/NMR_MeshInformation_Properties.h"
+#include "Common/Mesh/NMR_MeshTypes.h"
+#include "Common/NMR_Exception.h"
+
+namespace NMR {
+
+	CModelStreamWriter::CModelStreamWriter(_In_ PExportStream pExportStream, _In_ eModelUnit eUnit)
+	{
+		if (pExportStream.get() == nullptr)
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		m_eState = MODELSTREAMWRITERSTATE_RESOURCES;
+		m_nObjectCount = 0;
+		m_nVertexCount = 0;
+		m_nTriangleCount = 0;
+
+		m_pModel = std::make_shared<CModel>();
+		m_pModel->setUnit(eUnit);
+		m_pMeshObject = std::make_shared<CModelMeshObject>(1, m_pModel.get());
+
+		// The model part is compressed on the calling thread while it is written
+		m_pExportStream = pExportStream;
+		m_pPackageWriter = std::make_shared<COpcPackageWriter>(m_pExportStream, nullptr);
+		m_pModelPart = m_pPackageWriter->addPart(m_pModel->rootPath(), ZIPCOMPRESSIONLEVEL_FASTEST);
+		m_pXMLWriter = std::make_shared<CXmlWriter_Native>(m_pModelPart->getExportStream());
+
+		m_pMeshNode.reset(new CModelWriterNode100_Mesh(m_pMeshObject.get(), m_pXMLWriter.get(), std::make_shared<CProgressMonitor>(),
+			std::make_shared<CMeshInformation_PropertyIndexMapping>(), 6, false, false, false, false, false));
+
+		std::string sLanguage = m_pModel->getLanguage();
+
+		m_pXMLWriter->WriteStartDocument();
+		m_pXMLWriter->WriteStartElement(nullptr, XML_3MF_ELEMENT_MODEL, PACKAGE_XMLNS_100);
+		writeAttribute(XML_3MF_ATTRIBUTE_MODEL_UNIT, m_pModel->getUnitString());
+		m_pXMLWriter->WriteAttributeString(XML_3MF_ATTRIBUTE_PREFIX_XML, XML_3MF_ATTRIBUTE_MODEL_LANG, nullptr, sLanguage.c_str());
+		m_pXMLWriter->WriteStartElement(nullptr, XML_3MF_ELEMENT_RESOURCES, nullptr);
+	}
+
+	void CModelStreamWriter::checkState(_In_ eModelStreamWriterState eState)
+	{
+		if (m_eState != eState)
+			throw CNMRException(NMR_ERROR_STREAMWRITERINVALIDSTATE);
+	}
+
+	void CModelStreamWriter::writeAttribute(_In_z_ const nfChar * pszName, _In_ const std::string & sValue)
+	{
+		m_pXMLWriter->WriteAttributeString(nullptr, pszName, nullptr, sValue.c_str());
+	}
+
+	ModelResourceID CModelStreamWriter::beginMeshObject(_In_ const std::string & sName)
+	{
+		checkState(MODELSTREAMWRITERSTATE_RESOURCES);
+
+		m_nObjectCount++;
+		m_nVertexCount = 0;
+		m_nTriangleCount = 0;
+
+		m_pXMLWriter->WriteStartElement(nullptr, XML_3MF_ELEMENT_OBJECT, nullptr);
+		writeAttribute(XML_3MF_ATTRIBUTE_OBJECT_ID, std::to_string(m_nObjectCount));
+		if (!sName.empty())
+			writeAttribute(XML_3MF_ATTRIBUTE_OBJECT_NAME, sName);
+		writeAttribute(XML_3MF_ATTRIBUTE_OBJECT_TYPE, XML_3MF_OBJECTTYPE_MODEL);
+		m_pXMLWriter->WriteStartElement(nullptr, XML_3MF_ELEMENT_MESH, nullptr);
+		m_pXMLWriter->WriteStartElement(nullptr, XML_3MF_ELEMENT_VERTICES, nullptr);
+
+		m_eState = MODELSTREAMWRITERSTATE_VERTICES;
+		return m_nObjectCount;
+	}
+
+	void CModelStreamWriter::addVertices(_In_ const NVEC3 * pVertices, _In_ nfUint32 nCount)
+	{
+		checkState(MODELSTREAMWRITERSTATE_VERTICES);
+		if ((pVertices == nullptr) && (nCount > 0))
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		if (nCount > NMR_MESH_MAXNODECOUNT - m_nVertexCount)
+			throw CNMRException(NMR_ERROR_TOOMANYNODES);
+
+		m_pMeshNode->writeStreamedVertices(pVertices, nCount);
+		m_nVertexCount += nCount;
+	}
+
+	void CModelStreamWriter::addTriangles(_In_ const nfUint32 * pIndices, _In_ nfUint32 nTriangleCount)
+	{
+		if (m_eState == MODELSTREAMWRITERSTATE_VERTICES) {
+			m_pXMLWriter->WriteFullEndElement();
+			m_pXMLWriter->WriteStartElement(nullptr, XML_3MF_ELEMENT_TRIANGLES, nullptr);
+			m_eState = MODELSTREAMWRITERSTATE_TRIANGLES;
+		}
+		checkState(MODELSTREAMWRITERSTATE_TRIANGLES);
+		if ((pIndices == nullptr) && (nTriangleCount > 0))
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		if (nTriangleCount > NMR_MESH_MAXFACECOUNT - m_nTriangleCount)
+			throw CNMRException(NMR_ERROR_TOOMANYFACES);
+
+		// The whole batch is validated before any of it is written
+		for (nfUint32 nIndex = 0; nIndex < nTriangleCount; nIndex++) {
+			const nfUint32 * pTriangle = &pIndices[nIndex * 3];
+			if ((pTriangle[0] >= m_nVertexCount) || (pTriangle[1] >= m_nVertexCount) || (pTriangle[2] >= m_nVertexCount))
+				throw CNMRException(NMR_ERROR_INVALIDMODELNODEINDEX);
+			if ((pTriangle[0] == pTriangle[1]) || (pTriangle[0] == pTriangle[2]) || (pTriangle[1] == pTriangle[2]))
+				throw CNMRException(NMR_ERROR_INVALIDMODELCOORDINATEINDICES);
+		}
+
+		m_pMeshNode->writeStreamedTriangles(pIndices, nTriangleCount);
+		m_nTriangleCount += nTriangleCount;
+	}
+
+	void CModelStreamWriter::endMeshObject()
+	{
+		if (m_eState == MODELSTREAMWRITERSTATE_VERTICES)
+			addTriangles(nullptr, 0);
+		checkState(MODELSTREAMWRITERSTATE_TRIANGLES);
+
+		// triangles, mesh and object
+		m_pXMLWriter->WriteFullEndElement();
+		m_pXMLWriter->WriteFullEndElement();
+		m_pXMLWriter->WriteFullEndElement();
+
+		m_eState = MODELSTREAMWRITERSTATE_RESOURCES;
+	}
+
+	void CModelStreamWriter::addBuildItem(_In_ ModelResourceID nObjectID, _In_ const NMATRIX3 & mTransform)
+	{
+		if (m_eState == MODELSTREAMWRITERSTATE_FINISHED)
+			throw CNMRException(NMR_ERROR_STREAMWRITERINVALIDSTATE);
+
+		// Only objects, which have been completely written, may be referenced
+		ModelResourceID nCompletedObjects = (m_eState == MODELSTREAMWRITERSTATE_RESOURCES) ? m_nObjectCount : m_nObjectCount - 1;
+		if ((nObjectID == 0) || (nObjectID > nCompletedObjects))
+			throw CNMRException(NMR_ERROR_INVALIDBUILDITEMOBJECTID);
+
+		MODELSTREAMWRITERBUILDITEM BuildItem;
+		BuildItem.m_nObjectID = nObjectID;
+		BuildItem.m_mTransform = mTransform;
+		m_BuildItems.push_back(BuildItem);
+	}
+
+	void CModelStreamWriter::finish()
+	{
+		checkState(MODELSTREAMWRITERSTATE_RESOURCES);
+
+		// resources
+		m_pXMLWriter->WriteFullEndElement();
+
+		m_pXMLWriter->WriteStartElement(nullptr, XML_3MF_ELEMENT_BUILD, nullptr);
+		for (auto & BuildItem : m_BuildItems) {
+			m_pXMLWriter->WriteStartElement(nullptr, XML_3MF_ELEMENT_ITEM, nullptr);
+			writeAttribute(XML_3MF_ATTRIBUTE_ITEM_OBJECTID, std::to_string(BuildItem.m_nObjectID));
+			if (!fnMATRIX3_isIdentity(BuildItem.m_mTransform))
+				writeAttribute(XML_3MF_ATTRIBUTE_ITEM_TRANSFORM, fnMATRIX3_toString(BuildItem.m_mTransform));
+			m_pXMLWriter->WriteEndElement();
+		}
+		m_pXMLWriter->WriteFullEndElement();
+
+		// model
+		m_pXMLWriter->WriteFullEndElement();
+		m_pXMLWriter->WriteEndDocument();
+		m_pXMLWriter->Flush();
+
+		m_pPackageWriter->addRootRelationship(PACKAGE_START_PART_RELATIONSHIP_TYPE, m_pModelPart.get());
+		m_pPackageWriter->addContentType(PACKAGE_3D_RELS_EXTENSION, PACKAGE_3D_RELS_CONTENT_TYPE);
+		m_pPackageWriter->addContentType(PACKAGE_3D_MODEL_EXTENSION, PACKAGE_3D_MODEL_CONTENT_TYPE);
+
+		m_eState = MODELSTREAMWRITERSTATE_FINISHED;
+
+		// The package writer writes content types, relationships and the ZIP directory when it is released
+		m_pXMLWriter = nullptr;
+		m_pModelPart = nullptr;
+		m_pPackageWriter = nullptr;
+		m_pExportStream = nullptr;
+	}
+
+	nfBool CModelStreamWriter::isFinished()
+	{
+		return m_eState == MODELSTREAMWRITERSTATE_FINISHED;
+	}
+
+}
@@ -38,6 +38,7 @@ A model writer exports the in memory represenation into a model file.
 #include "Common/NMR_Exception.h" 
 #include "Common/NMR_Exception_Windows.h" 
 #include "Common/NMR_SecureContext.h"
+#include "Common/Platform/NMR_PortableZIPWriterTypes.h"
 
 
 #include <sstream>
@@ -49,8 +50,12 @@ namespace NMR {
 
 	CModelWriter::CModelWriter(_In_ PModel pModel):
 		CModelContext(pModel),
-		m_nDecimalPrecision(6)
+		m_nDecimalPrecision(6),
+		m_bShortestRoundtrip(false),
+		m_nWorkerThreadCount(1)
 	{
+		m_CompressionLevels.fill(MODELCOMPRESSIONLEVEL_FASTEST);
+		m_CompressionLevelIsSet.fill(false);
 	}
 
 	void CModelWriter::SetDecimalPrecision(nfUint32 nDecimalPrecision)
@@ -65,4 +70,81 @@ namespace NMR {
 		return m_nDecimalPrecision;
 	}
 
+	void CModelWriter::SetShortestRoundtripActive(_In_ nfBool bShortestRoundtrip)
+	{
+		m_bShortestRoundtrip = bShortestRoundtrip;
+	}
+
+	nfBool CModelWriter::GetShortestRoundtripActive()
+	{
+		return m_bShortestRoundtrip;
+	}
+
+	void CModelWriter::SetWorkerThreadCount(nfUint32 nWorkerThreadCount)
+	{
+		if (nWorkerThreadCount != m_nWorkerThreadCount)
+			m_pThreadPool = nullptr;
+		m_nWorkerThreadCount = nWorkerThreadCount;
+	}
+
+	nfUint32 CModelWriter::GetWorkerThreadCount()
+	{
+		return m_nWorkerThreadCount;
+	}
+
+	void CModelWriter::SetCompressionLevel(_In_ eModelPackagePartType ePartType, _In_ eModelCompressionLevel eLevel)
+	{
+		if ((nfUint32)ePartType >= m_CompressionLevels.size())
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+
+		switch (eLevel) {
+		case MODELCOMPRESSIONLEVEL_STORED:
+		case MODELCOMPRESSIONLEVEL_FASTEST:
+		case MODELCOMPRESSIONLEVEL_DEFAULT:
+		case MODELCOMPRESSIONLEVEL_MAXIMUM:
+			m_CompressionLevels[ePartType] = eLevel;
+			m_CompressionLevelIsSet[ePartType] = true;
+			break;
+		default:
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		}
+	}
+
+	eModelCompressionLevel CModelWriter::GetCompressionLevel(_In_ eModelPackagePartType ePartType)
+	{
+		if ((nfUint32)ePartType >= m_CompressionLevels.size())
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		return m_CompressionLevels[ePartType];
+	}
+
+	nfInt32 CModelWriter::zipCompressionLevel(_In_ eModelPackagePartType ePartType)
+	{
+		if ((nfUint32)ePartType >= m_CompressionLevels.size())
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		if (!m_CompressionLevelIsSet[ePartType])
+			return ZIPCOMPRESSIONLEVEL_UNSPECIFIED;
+
+		switch (m_CompressionLevels[ePartType]) {
+		case MODELCOMPRESSIONLEVEL_STORED: return ZIPCOMPRESSIONLEVEL_STORED;
+		case MODELCOMPRESSIONLEVEL_FASTEST: return ZIPCOMPRESSIONLEVEL_FASTEST;
+		case MODELCOMPRESSIONLEVEL_DEFAULT: return ZIPCOMPRESSIONLEVEL_DEFAULT;
+		case MODELCOMPRESSIONLEVEL_MAXIMUM: return ZIPCOMPRESSIONLEVEL_MAXIMUM;
+		default:
+			throw CNMRException(NMR_ERROR_INVALIDPARAM);
+		}
+	}
+
+	PThreadPool CModelWriter::threadPool()
+	{
+		nfUint32 nThreadCount = m_nWorkerThreadCount;
+		if (nThreadCount == 0)
+			nThreadCount = CThreadPool::getHardwareThreadCount();
+		if (nThreadCount <= 1)
+			return nullptr;
+
+		if (!m_pThreadPool)
+			m_pThreadPool = std::make_shared<CThreadPool>(nThreadCount);
+		return m_pThreadPool;
+	}
+
 }
@@ -38,6 +38,7 @@ using LibZ and a native XML writer implementation.
 #include "Model/Classes/NMR_ModelConstants.h" 
 #include "Model/Classes/NMR_ModelAttachment.h" 
 #include "Model/Classes/NMR_ModelTextureAttachment.h" 
+#include "Model/Classes/NMR_ModelObject.h"
 #include "Common/Platform/NMR_ImportStream.h" 
 #include "Common/NMR_Exception.h" 
 #include "Common/Platform/NMR_XmlWriter.h" 
@@ -81,9 +82,11 @@ namespace NMR {
 		// Maximal progress = NrResources + NrAttachments + Build + Cleanup
 		monitor()->SetMaxProgress(m_pOtherModel->getResourceCount() + m_pOtherModel->getAttachmentCount() + 1 + 1);
 
+		validateObjects();
+
 		// Write Model Stream
-		m_pPackageWriter = std::make_shared<CKeyStoreOpcPackageWriter>(pStream, *this);
-		POpcPackagePart pModelPart = m_pPackageWriter->addPart(m_pOtherModel->rootPath());
+		m_pPackageWriter = std::make_shared<CKeyStoreOpcPackageWriter>(pStream, *this, threadPool());
+		POpcPackagePart pModelPart = m_pPackageWriter->addPart(m_pOtherModel->rootPath(), zipCompressionLevel(MODELPACKAGEPARTTYPE_MODEL));
 		PXmlWriter_Native pXMLWriter = std::make_shared<CXmlWriter_Native>(pModelPart->getExportStream());
 
 		monitor()->SetProgressIdentifier(ProgressIdentifier::PROGRESS_WRITEROOTMODEL);
@@ -98,7 +101,7 @@ namespace NMR {
 		if (pPackageThumbnail.get() != nullptr)
 		{
 			// create Package Thumbnail Part
-			POpcPackagePart pThumbnailPart = m_pPackageWriter->addPart(pPackageThumbnail->getPathURI());
+			POpcPackagePart pThumbnailPart = m_pPackageWriter->addPart(pPackageThumbnail->getPathURI(), zipCompressionLevel(MODELPACKAGEPARTTYPE_IMAGE));
 			PExportStream pExportStream = pThumbnailPart->getExportStream();
 			// Copy data
 			PImportStream pPackageThumbnailStream = pPackageThumbnail->getStream();
@@ -140,6 +143,16 @@ namespace NMR {
 		}
 	}
 
+	void CModelWriter_3MF_Native::validateObjects()
+	{
+		nfUint32 nCount = m_pOtherModel->getObjectCount();
+		for (nfUint32 nIndex = 0; nIndex < nCount; nIndex++) {
+			CModelObject * pObject = m_pOtherModel->getObject(nIndex);
+			if (!pObject->isValid())
+				warnings()->addWarning(NMR_ERROR_INVALIDMODELOBJECT, eModelWarningLevel::mrwInvalidMandatoryValue);
+		}
+	}
+
 	void CModelWriter_3MF_Native::addNonRootModels() {
 
 		// do this based on resource-paths
@@ -201,7 +214,12 @@ namespace NMR {
 					throw CNMRException(NMR_ERROR_INVALIDPARAM);
 
 				// create Attachment Part
-				POpcPackagePart pAttachmentPart = m_pPackageWriter->addPart(sPath);
+				eModelPackagePartType ePartType = MODELPACKAGEPARTTYPE_ATTACHMENT;
+				if (sRelationShipType == PACKAGE_START_PART_RELATIONSHIP_TYPE)
+					ePartType = MODELPACKAGEPARTTYPE_MODEL;
+				else if ((sRelationShipType == PACKAGE_TEXTURE_RELATIONSHIP_TYPE) || (sRelationShipType == PACKAGE_THUMBNAIL_RELATIONSHIP_TYPE))
+					ePartType = MODELPACKAGEPARTTYPE_IMAGE;
+				POpcPackagePart pAttachmentPart = m_pPackageWriter->addPart(sPath, zipCompressionLevel(ePartType));
 				PExportStream pExportStream = pAttachmentPart->getExportStream();
 
 				// Copy data
@@ -37,22 +37,21 @@ This is the class for exporting the 3mf mesh node.
 #include "Common/NMR_Exception.h"
 #include "Common/NMR_Exception_Windows.h"
 #include "Common/NMR_StringUtils.h"
+#include "Common/NMR_NumberFormat.h"
 
 #include "Common/3MF_ProgressMonitor.h"
 
+#include <algorithm>
+#include <atomic>
 #include <cmath>
 
-#ifdef __GNUC__
-#include <stdio.h>
-#endif // __GNUC__
-
 #define MAX(a,b) (((a)>(b))?(a):(b))
 
 namespace NMR {
 
 	CModelWriterNode100_Mesh::CModelWriterNode100_Mesh(_In_ CModelMeshObject * pModelMeshObject, _In_ CXmlWriter * pXMLWriter, _In_ PProgressMonitor pProgressMonitor,
-		_In_ PMeshInformation_PropertyIndexMapping pPropertyIndexMapping, _In_ int nPosAfterDecPoint, _In_ nfBool bWriteMaterialExtension, _In_ nfBool bWriteBeamLatticeExtension, _In_ nfBool bWriteVolumetricExtension, _In_ nfBool bWriteTriangleSetExtension)
-		:CModelWriterNode_ModelBase(pModelMeshObject->getModel(), pXMLWriter, pProgressMonitor), m_nPosAfterDecPoint(nPosAfterDecPoint), m_nPutDoubleFactor((nfInt64)(pow(10, CModelWriterNode100_Mesh::m_nPosAfterDecPoint)))
+		_In_ PMeshInformation_PropertyIndexMapping pPropertyIndexMapping, _In_ int nPosAfterDecPoint, _In_ nfBool bShortestRoundtrip, _In_ nfBool bWriteMaterialExtension, _In_ nfBool bWriteBeamLatticeExtension, _In_ nfBool bWriteVolumetricExtension, _In_ nfBool bWriteTriangleSetExtension, _In_ PThreadPool pThreadPool)
+		:CModelWriterNode_ModelBase(pModelMeshObject->getModel(), pXMLWriter, pProgressMonitor), m_nPosAfterDecPoint(nPosAfterDecPoint), m_bShortestRoundtrip(bShortestRoundtrip), m_nPutDoubleFactor((nfInt64)(pow(10, CModelWriterNode100_Mesh::m_nPosAfterDecPoint)))
 	{
 		__NMRASSERT(pModelMeshObject != nullptr);
 		if (!pPropertyIndexMapping.get())
@@ -65,6 +64,8 @@ namespace NMR {
 
 		m_pModelMeshObject = pModelMeshObject;
 		m_pPropertyIndexMapping = pPropertyIndexMapping;
+		m_pThreadPool = pThreadPool;
+		m_pChunkBuffer = nullptr;
 
 		// Initialize buffer arrays
 		m_nTriangleBufferPos = 0;
@@ -128,7 +129,7 @@ namespace NMR {
 		const nfUint32 nFaceCount = pMesh->getFaceCount();
 		const nfUint32 nBeamCount = pMesh->getBeamCount();
 		const nfUint32 nBallCount = pMesh->getBallCount();
-		nfUint32 nNodeIndex, nFaceIndex, nBeamIndex, nBallIndex;
+		nfUint32 nBeamIndex, nBallIndex;
 
 		// Write Mesh Element
 		writeStartElement(XML_3MF_ELEMENT_MESH);
@@ -149,23 +150,13 @@ namespace NMR {
 
 		// Write Vertices
 		writeStartElement(XML_3MF_ELEMENT_VERTICES);
-		for (nNodeIndex = 0; nNodeIndex < nNodeCount; nNodeIndex++) {
-			// Get Mesh Node
-			MESHNODE * pMeshNode = pMesh->getNode(nNodeIndex);
-			writeVertexData(pMeshNode);
-
-			/* The following works, but would be a major output speed bottleneck!
-
-			// Write Vertex
-			writeStartElement(XML_3MF_ELEMENT_VERTEX);
-			writeFloatAttribute(XML_3MF_ATTRIBUTE_VERTEX_X, pMeshNode->m_position.m_values.x);
-			writeFloatAttribute(XML_3MF_ATTRIBUTE_VERTEX_Y, pMeshNode->m_position.m_values.y);
-			writeFloatAttribute(XML_3MF_ATTRIBUTE_VERTEX_Z, pMeshNode->m_position.m_values.z);
-			writeEndElement(); */
-
-			if (nNodeIndex % PROGRESS_NODEUPDATE == PROGRESS_NODEUPDATE-1) {
-				m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
-			}
+		if (useParallelRanges(nNodeCount)) {
+			writeRangesInParallel(nNodeCount, [pMesh](CModelWriterNode100_Mesh & Renderer, nfUint32 nBegin, nfUint32 nEnd) {
+				Renderer.writeVertexRange(pMesh, nBegin, nEnd);
+			});
+		}
+		else {
+			writeVertexRange(pMesh, 0, nNodeCount);
 		}
 		writeFullEndElement();
 
@@ -195,73 +186,18 @@ namespace NMR {
 		m_pProgressMonitor->SetProgressIdentifier(ProgressIdentifier::PROGRESS_WRITETRIANGLES);
 		// Write Triangles
 		writeStartElement(XML_3MF_ELEMENT_TRIANGLES);
-		for (nFaceIndex = 0; nFaceIndex < nFaceCount; nFaceIndex++) {
-			if (nFaceIndex % PROGRESS_TRIANGLEUPDATE == PROGRESS_TRIANGLEUPDATE - 1) {
-				m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
-			}
-
-			// Get Mesh Face
-			MESHFACE * pMeshFace = pMesh->getFace(nFaceIndex);
-
-			UniqueResourceID nPropertyID = 0;
-			ModelResourceIndex nPropertyIndex1 = 0;
-			ModelResourceIndex nPropertyIndex2 = 0;
-			ModelResourceIndex nPropertyIndex3 = 0;
-
-			nfChar * pAdditionalString = nullptr;
-			// Retrieve Property Indices
-			if (pProperties != nullptr) {
-				MESHINFORMATION_PROPERTIES* pFaceData = (MESHINFORMATION_PROPERTIES*)pProperties->getFaceData(nFaceIndex);
-				if (pFaceData != nullptr) {
-					if (pFaceData->m_nUniqueResourceID) {
-						nPropertyID = pFaceData->m_nUniqueResourceID;
-						nPropertyIndex1 = m_pPropertyIndexMapping->mapPropertyIDToIndex(nPropertyID, pFaceData->m_nPropertyIDs[0]);
-						nPropertyIndex2 = m_pPropertyIndexMapping->mapPropertyIDToIndex(nPropertyID, pFaceData->m_nPropertyIDs[1]);
-						nPropertyIndex3 = m_pPropertyIndexMapping->mapPropertyIDToIndex(nPropertyID, pFaceData->m_nPropertyIDs[2]);
-					}
-				}
-			}
-
-
-			if (nPropertyID != 0) {
-				bMeshHasAProperty = true;
-				// TODO: this is slow
-				ModelResourceID nPropertyModelResourceID = m_pModel->findPackageResourceID(nPropertyID)->getModelResourceID();
-				if ((nPropertyIndex1 != nPropertyIndex2) || (nPropertyIndex1 != nPropertyIndex3)) {
-					writeFaceData_ThreeProperties(pMeshFace, nPropertyModelResourceID, nPropertyIndex1, nPropertyIndex2, nPropertyIndex3, pAdditionalString);
-				}
-				else {
-					if ((nPropertyID == nObjectLevelPropertyID) && (nPropertyIndex1 == nObjectLevelPropertyIndex)){
-						writeFaceData_Plain(pMeshFace, pAdditionalString);
-					} else {
-						writeFaceData_OneProperty(pMeshFace, nPropertyModelResourceID, nPropertyIndex1, pAdditionalString);
-					}
-				}
-			}
-			else
-			{
-				writeFaceData_Plain(pMeshFace, pAdditionalString);
-			}
-
-			/* The following works, but would be a major output speed bottleneck!
-
-			// Write Triangle
-			writeStartElement(XML_3MF_ELEMENT_TRIANGLE);
-			writeIntAttribute(XML_3MF_ATTRIBUTE_TRIANGLE_V1, pMeshFace->m_nodeindices[0]);
-			writeIntAttribute(XML_3MF_ATTRIBUTE_TRIANGLE_V2, pMeshFace->m_nodeindices[1]);
-			writeIntAttribute(XML_3MF_ATTRIBUTE_TRIANGLE_V3, pMeshFace->m_nodeindices[2]);
-
-			// Write Property Indices
-			if (nPropertyID != 0) {
-				writeIntAttribute(XML_3MF_ATTRIBUTE_TRIANGLE_PID, nPropertyID);
-				writeIntAttribute(XML_3MF_ATTRIBUTE_TRIANGLE_P1, nPropertyIndex1);
-				if ((nPropertyIndex1 != nPropertyIndex2) || (nPropertyIndex1 != nPropertyIndex3)) {
-					writeIntAttribute(XML_3MF_ATTRIBUTE_TRIANGLE_P2, nPropertyIndex2);
-					writeIntAttribute(XML_3MF_ATTRIBUTE_TRIANGLE_P3, nPropertyIndex3);
-				}
-			}
-
-			writeEndElement();  */
+		if (useParallelRanges(nFaceCount)) {
+			std::atomic<nfBool> bRangeHasAProperty(false);
+			writeRangesInParallel(nFaceCount, [&](CModelWriterNode100_Mesh & Renderer, nfUint32 nBegin, nfUint32 nEnd) {
+				nfBool bHasAProperty = false;
+				Renderer.writeFaceRange(pMesh, nBegin, nEnd, pProperties, nObjectLevelPropertyID, nObjectLevelPropertyIndex, bHasAProperty);
+				if (bHasAProperty)
+					bRangeHasAProperty = true;
+			});
+			bMeshHasAProperty = bRangeHasAProperty;
+		}
+		else {
+			writeFaceRange(pMesh, 0, nFaceCount, pProperties, nObjectLevelPropertyID, nObjectLevelPropertyIndex, bMeshHasAProperty);
 		}
 		writeFullEndElement();
 
@@ -314,7 +250,7 @@ namespace NMR {
 						// Check if any balls do not use dDefaultBallRadius
 						bWriteBallsElement = false;
 						for (nfUint32 iBall = 0; iBall < nBallCount; iBall++) {
-							if (stringRepresentationsDiffer(pMesh->getBall(iBall)->m_radius, dDefaultBallRadius, m_nPutDoubleFactor)) {
+							if (stringRepresentationsDiffer(pMesh->readBall(iBall)->m_radius, dDefaultBallRadius, m_nPutDoubleFactor)) {
 								bWriteBallsElement = true;
 								break;
 							}
@@ -358,7 +294,7 @@ namespace NMR {
 					writeStartElementWithPrefix(XML_3MF_ELEMENT_BEAMS, XML_3MF_NAMESPACEPREFIX_BEAMLATTICE);
 					for (nBeamIndex = 0; nBeamIndex < nBeamCount; nBeamIndex++) {
 						// write beamlattice: beam
-						MESHBEAM * pMeshBeam = pMesh->getBeam(nBeamIndex);
+						const MESHBEAM * pMeshBeam = pMesh->readBeam(nBeamIndex);
 						writeBeamData(pMeshBeam, dDefaultRadius, eDefaultCapMode);
 					}
 					writeFullEndElement();
@@ -369,7 +305,7 @@ namespace NMR {
 						writeStartElementWithPrefix(XML_3MF_ELEMENT_BALLS, XML_3MF_NAMESPACEPREFIX_BEAMLATTICE);
 						for (nBallIndex = 0; nBallIndex < nBallCount; nBallIndex++) {
 							// write beamlattice: ball
-							MESHBALL * pMeshBall = pMesh->getBall(nBallIndex);
+							const MESHBALL * pMeshBall = pMesh->readBall(nBallIndex);
 							writeBallData(pMeshBall, eBallMode, dDefaultBallRadius);
 						}
 						writeFullEndElement();
@@ -413,6 +349,158 @@ namespace NMR {
 	}
 
 
+	void CModelWriterNode100_Mesh::writeVertexRange(_In_ CMesh * pMesh, _In_ nfUint32 nBegin, _In_ nfUint32 nEnd)
+	{
+		__NMRASSERT(pMesh);
+		for (nfUint32 nNodeIndex = nBegin; nNodeIndex < nEnd; nNodeIndex++) {
+			// Get Mesh Node
+			const MESHNODE * pMeshNode = pMesh->readNode(nNodeIndex);
+			writeVertexData(pMeshNode);
+
+			/* The following works, but would be a major output speed bottleneck!
+
+			// Write Vertex
+			writeStartElement(XML_3MF_ELEMENT_VERTEX);
+			writeFloatAttribute(XML_3MF_ATTRIBUTE_VERTEX_X, pMeshNode->m_position.m_values.x);
+			writeFloatAttribute(XML_3MF_ATTRIBUTE_VERTEX_Y, pMeshNode->m_position.m_values.y);
+			writeFloatAttribute(XML_3MF_ATTRIBUTE_VERTEX_Z, pMeshNode->m_position.m_values.z);
+			writeEndElement(); */
+
+			// Chunks are rendered on worker threads, which must not report progress
+			if ((m_pChunkBuffer == nullptr) && (nNodeIndex % PROGRESS_NODEUPDATE == PROGRESS_NODEUPDATE-1)) {
+				m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
+			}
+		}
+	}
+
+	void CModelWriterNode100_Mesh::writeFaceRange(_In_ CMesh * pMesh, _In_ nfUint32 nBegin, _In_ nfUint32 nEnd, _In_opt_ CMeshInformation_Properties * pProperties,
+		_In_ UniqueResourceID nObjectLevelPropertyID, _In_ ModelResourceIndex nObjectLevelPropertyIndex, _Out_ nfBool & bHasAProperty)
+	{
+		__NMRASSERT(pMesh);
+		for (nfUint32 nFaceIndex = nBegin; nFaceIndex < nEnd; nFaceIndex++) {
+			if ((m_pChunkBuffer == nullptr) && (nFaceIndex % PROGRESS_TRIANGLEUPDATE == PROGRESS_TRIANGLEUPDATE - 1)) {
+				m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
+			}
+
+			// Get Mesh Face
+			const MESHFACE * pMeshFace = pMesh->readFace(nFaceIndex);
+
+			UniqueResourceID nPropertyID = 0;
+			ModelResourceIndex nPropertyIndex1 = 0;
+			ModelResourceIndex nPropertyIndex2 = 0;
+			ModelResourceIndex nPropertyIndex3 = 0;
+
+			nfChar * pAdditionalString = nullptr;
+			// Retrieve Property Indices
+			if (pProperties != nullptr) {
+				MESHINFORMATION_PROPERTIES* pFaceData = (MESHINFORMATION_PROPERTIES*)pProperties->getFaceData(nFaceIndex);
+				if (pFaceData != nullptr) {
+					if (pFaceData->m_nUniqueResourceID) {
+						nPropertyID = pFaceData->m_nUniqueResourceID;
+						nPropertyIndex1 = m_pPropertyIndexMapping->mapPropertyIDToIndex(nPropertyID, pFaceData->m_nPropertyIDs[0]);
+						nPropertyIndex2 = m_pPropertyIndexMapping->mapPropertyIDToIndex(nPropertyID, pFaceData->m_nPropertyIDs[1]);
+						nPropertyIndex3 = m_pPropertyIndexMapping->mapPropertyIDToIndex(nPropertyID, pFaceData->m_nPropertyIDs[2]);
+					}
+				}
+			}
+
+
+			if (nPropertyID != 0) {
+				bHasAProperty = true;
+				// TODO: this is slow
+				ModelResourceID nPropertyModelResourceID = m_pModel->findPackageResourceID(nPropertyID)->getModelResourceID();
+				if ((nPropertyIndex1 != nPropertyIndex2) || (nPropertyIndex1 != nPropertyIndex3)) {
+					writeFaceData_ThreeProperties(pMeshFace, nPropertyModelResourceID, nPropertyIndex1, nPropertyIndex2, nPropertyIndex3, pAdditionalString);
+				}
+				else {
+					if ((nPropertyID == nObjectLevelPropertyID) && (nPropertyIndex1 == nObjectLevelPropertyIndex)){
+						writeFaceData_Plain(pMeshFace, pAdditionalString);
+					} else {
+						writeFaceData_OneProperty(pMeshFace, nPropertyModelResourceID, nPropertyIndex1, pAdditionalString);
+					}
+				}
+			}
+			else
+			{
+				writeFaceData_Plain(pMeshFace, pAdditionalString);
+			}
+
+			/* The following works, but would be a major output speed bottleneck!
+
+			// Write Triangle
+			writeStartElement(XML_3MF_ELEMENT_TRIANGLE);
+			writeIntAttribute(XML_3MF_ATTRIBUTE_TRIANGLE_V1, pMeshFace->m_nodeindices[0]);
+			writeIntAttribute(XML_3MF_ATTRIBUTE_TRIANGLE_V2, pMeshFace->m_nodeindices[1]);
+			writeIntAttribute(XML_3MF_ATTRIBUTE_TRIANGLE_V3, pMeshFace->m_nodeindices[2]);
+
+			// Write Property Indices
+			if (nPropertyID != 0) {
+				writeIntAttribute(XML_3MF_ATTRIBUTE_TRIANGLE_PID, nPropertyID);
+				writeIntAttribute(XML_3MF_ATTRIBUTE_TRIANGLE_P1, nPropertyIndex1);
+				if ((nPropertyIndex1 != nPropertyIndex2) || (nPropertyIndex1 != nPropertyIndex3)) {
+					writeIntAttribute(XML_3MF_ATTRIBUTE_TRIANGLE_P2, nPropertyIndex2);
+					writeIntAttribute(XML_3MF_ATTRIBUTE_TRIANGLE_P3, nPropertyIndex3);
+				}
+			}
+
+			writeEndElement();  */
+		}
+	}
+
+	nfBool CModelWriterNode100_Mesh::useParallelRanges(_In_ nfUint32 nCount)
+	{
+		return (m_pThreadPool.get() != nullptr) && (m_pThreadPool->getThreadCount() > 1) && (nCount >= MODELWRITERMESH100_PARALLELMINELEMENTCOUNT);
+	}
+
+	void CModelWriterNode100_Mesh::writeRangesInParallel(_In_ nfUint32 nCount, _In_ const ModelWriterMeshRangeFunction & fnWriteRange)
+	{
+		__NMRASSERT(m_pThreadPool);
+		__NMRASSERT(m_pChunkBuffer == nullptr);
+
+		// Every chunk is rendered by a copy of this node, which frames its lines like the XML writer
+		CModelWriterNode100_Mesh Template(*this);
+		m_pXMLWriter->GetRawLineFraming(Template.m_sChunkIndentation, Template.m_sChunkLineEnding);
+
+		// Chunks are rendered and written in batches, to bound the memory of the rendered text
+		const nfUint32 nChunkCount = (nCount + MODELWRITERMESH100_CHUNKELEMENTCOUNT - 1) / MODELWRITERMESH100_CHUNKELEMENTCOUNT;
+		const nfUint32 nBatchSize = m_pThreadPool->getThreadCount() * MODELWRITERMESH100_CHUNKSPERTHREAD;
+		std::vector<std::vector<nfByte>> Chunks(std::min(nBatchSize, nChunkCount));
+
+		for (nfUint32 nBatchStart = 0; nBatchStart < nChunkCount; nBatchStart += nBatchSize) {
+			const nfUint32 nBatchCount = std::min(nBatchSize, nChunkCount - nBatchStart);
+
+			m_pThreadPool->runTasks(nBatchCount, [&](nfUint32 nTaskIndex) {
+				nfUint32 nBegin = (nBatchStart + nTaskIndex) * MODELWRITERMESH100_CHUNKELEMENTCOUNT;
+				nfUint32 nEnd = std::min(nCount - nBegin, (nfUint32)MODELWRITERMESH100_CHUNKELEMENTCOUNT) + nBegin;
+
+				std::vector<nfByte> & Chunk = Chunks[nTaskIndex];
+				Chunk.clear();
+
+				CModelWriterNode100_Mesh Renderer(Template);
+				Renderer.m_pChunkBuffer = &Chunk;
+				fnWriteRange(Renderer, nBegin, nEnd);
+			});
+
+			for (nfUint32 nTaskIndex = 0; nTaskIndex < nBatchCount; nTaskIndex++) {
+				m_pXMLWriter->WriteRawLines(Chunks[nTaskIndex].data(), Chunks[nTaskIndex].size());
+			}
+
+			m_pProgressMonitor->ReportProgressAndQueryCancelled(true);
+		}
+	}
+
+	void CModelWriterNode100_Mesh::writeRawLine(_In_ const nfChar * pszLine, _In_ nfUint32 cbCount)
+	{
+		if (m_pChunkBuffer == nullptr) {
+			m_pXMLWriter->WriteRawLine(pszLine, cbCount);
+			return;
+		}
+
+		m_pChunkBuffer->insert(m_pChunkBuffer->end(), m_sChunkIndentation.begin(), m_sChunkIndentation.end());
+		m_pChunkBuffer->insert(m_pChunkBuffer->end(), pszLine, pszLine + cbCount);
+		m_pChunkBuffer->insert(m_pChunkBuffer->end(), m_sChunkLineEnding.begin(), m_sChunkLineEnding.end());
+	}
+
 	void CModelWriterNode100_Mesh::putVertexString(_In_ const nfChar * pszString)
 	{
 		__NMRASSERT(pszString);
@@ -428,6 +516,11 @@ namespace NMR {
 	}
 
 	void CModelWriterNode100_Mesh::putFloat(_In_ const nfFloat fValue, _In_ std::array<nfChar, MODELWRITERMESH100_LINEBUFFERSIZE> & line, _In_ nfUint32 & nBufferPos) {
+		if (m_bShortestRoundtrip) {
+			nBufferPos += fnFloatToShortestBuffer(fValue, &line[nBufferPos], MODELWRITERMESH100_LINEBUFFERSIZE - nBufferPos);
+			return;
+		}
+
 		// Format float with "%.$ACCf" syntax where $ACC = m_snPosAfterDecPoint
 		nfInt64 nAbsValue = (nfInt64)(fValue * m_nPutDoubleFactor);
 		nAbsValue = MAX(nAbsValue, -nAbsValue);
@@ -471,6 +564,11 @@ namespace NMR {
 	}
 
 	void CModelWriterNode100_Mesh::putDouble(_In_ const nfDouble dValue, _In_ std::array<nfChar, MODELWRITERMESH100_LINEBUFFERSIZE> & line, _In_ nfUint32 & nBufferPos) {
+		if (m_bShortestRoundtrip) {
+			nBufferPos += fnDoubleToShortestBuffer(dValue, &line[nBufferPos], MODELWRITERMESH100_LINEBUFFERSIZE - nBufferPos);
+			return;
+		}
+
 		// Format float with "%.$ACCf" syntax where $ACC = m_snPosAfterDecPoint
 		nfInt64 nAbsValue = (nfInt64)(dValue * m_nPutDoubleFactor);
 		nAbsValue = MAX(nAbsValue, -nAbsValue);
@@ -535,16 +633,7 @@ namespace NMR {
 
 	void CModelWriterNode100_Mesh::putTriangleUInt32(_In_ const nfUint32 nValue)
 	{
-
-#ifdef __GNUC__
-		int nCount = sprintf(&m_TriangleLine[m_nTriangleBufferPos], "%d", nValue);
-#else
-		int nCount = sprintf_s(&m_TriangleLine[m_nTriangleBufferPos], MODELWRITERMESH100_LINEBUFFERSIZE - m_nTriangleBufferPos, "%d", nValue);
-#endif // __GNUC__
-
-		if (nCount < 1)
-			throw CNMRException(NMR_ERROR_COULDNOTCONVERTNUMBER);
-		m_nTriangleBufferPos += nCount;
+		m_nTriangleBufferPos += fnUInt32ToBuffer(nValue, &m_TriangleLine[m_nTriangleBufferPos]);
 	}
 
 
@@ -564,15 +653,7 @@ namespace NMR {
 
 	void CModelWriterNode100_Mesh::putBeamUInt32(_In_ const nfUint32 nValue)
 	{
-#ifdef __GNUC__
-		int nCount = sprintf(&m_BeamLine[m_nBeamBufferPos], "%d", nValue);
-#else
-		int nCount = sprintf_s(&m_BeamLine[m_nBeamBufferPos], MODELWRITERMESH100_LINEBUFFERSIZE - m_nBeamBufferPos, "%d", nValue);
-#endif // __GNUC__
-
-		if (nCount < 1)
-			throw CNMRException(NMR_ERROR_COULDNOTCONVERTNUMBER);
-		m_nBeamBufferPos += nCount;
+		m_nBeamBufferPos += fnUInt32ToBuffer(nValue, &m_BeamLine[m_nBeamBufferPos]);
 	}
 
 	void CModelWriterNode100_Mesh::putBeamDouble(_In_ const nfDouble dValue)
@@ -596,15 +677,7 @@ namespace NMR {
 
 	void CModelWriterNode100_Mesh::putBallUInt32(_In_ const nfUint32 nValue)
 	{
-#ifdef __GNUC__
-		int nCount = sprintf(&m_BallLine[m_nBallBufferPos], "%d", nValue);
-#else
-		int nCount = sprintf_s(&m_BallLine[m_nBallBufferPos], MODELWRITERMESH100_LINEBUFFERSIZE - m_nBallBufferPos, "%d", nValue);
-#endif // __GNUC__
-
-		if (nCount < 1)
-			throw CNMRException(NMR_ERROR_COULDNOTCONVERTNUMBER);
-		m_nBallBufferPos += nCount;
+		m_nBallBufferPos += fnUInt32ToBuffer(nValue, &m_BallLine[m_nBallBufferPos]);
 	}
 
 	void CModelWriterNode100_Mesh::putBallDouble(_In_ const nfDouble dValue)
@@ -628,15 +701,7 @@ namespace NMR {
 
 	void CModelWriterNode100_Mesh::putBeamRefUInt32(_In_ const nfUint32 nValue)
 	{
-#ifdef __GNUC__
-		int nCount = sprintf(&m_BeamRefLine[m_nBeamRefBufferPos], "%d", nValue);
-#else
-		int nCount = sprintf_s(&m_BeamRefLine[m_nBeamRefBufferPos], MODELWRITERMESH100_LINEBUFFERSIZE - m_nBeamRefBufferPos, "%d", nValue);
-#endif // __GNUC__
-
-		if (nCount < 1)
-			throw CNMRException(NMR_ERROR_COULDNOTCONVERTNUMBER);
-		m_nBeamRefBufferPos += nCount;
+		m_nBeamRefBufferPos += fnUInt32ToBuffer(nValue, &m_BeamRefLine[m_nBeamRefBufferPos]);
 	}
 
 	void CModelWriterNode100_Mesh::putTriangleSetRefString(_In_ const nfChar* pszString)
@@ -655,15 +720,7 @@ namespace NMR {
 
 	void CModelWriterNode100_Mesh::putTriangleSetRefUInt32(_In_ const nfUint32 nValue)
 	{
-#ifdef __GNUC__
-		int nCount = sprintf(&m_TriangleSetRefLine[m_nTriangleSetRefBufferPos], "%d", nValue);
-#else
-		int nCount = sprintf_s(&m_TriangleSetRefLine[m_nTriangleSetRefBufferPos], MODELWRITERMESH100_LINEBUFFERSIZE - m_nTriangleSetRefBufferPos, "%d", nValue);
-#endif // __GNUC__
-
-		if (nCount < 1)
-			throw CNMRException(NMR_ERROR_COULDNOTCONVERTNUMBER);
-		m_nTriangleSetRefBufferPos += nCount;
+		m_nTriangleSetRefBufferPos += fnUInt32ToBuffer(nValue, &m_TriangleSetRefLine[m_nTriangleSetRefBufferPos]);
 	}
 
 
@@ -683,32 +740,52 @@ namespace NMR {
 
 	void CModelWriterNode100_Mesh::putBallRefUInt32(_In_ const nfUint32 nValue)
 	{
-#ifdef __GNUC__
-		int nCount = sprintf(&m_BallRefLine[m_nBallRefBufferPos], "%d", nValue);
-#else
-		int nCount = sprintf_s(&m_BallRefLine[m_nBallRefBufferPos], MODELWRITERMESH100_LINEBUFFERSIZE - m_nBallRefBufferPos, "%d", nValue);
-#endif // __GNUC__
-
-		if (nCount < 1)
-			throw CNMRException(NMR_ERROR_COULDNOTCONVERTNUMBER);
-		m_nBallRefBufferPos += nCount;
+		m_nBallRefBufferPos += fnUInt32ToBuffer(nValue, &m_BallRefLine[m_nBallRefBufferPos]);
 	}
 
-	void CModelWriterNode100_Mesh::writeVertexData(_In_ MESHNODE * pNode)
+	void CModelWriterNode100_Mesh::writeVertexData(_In_ const MESHNODE * pNode)
 	{
 		__NMRASSERT(pNode);
+		writeVertexPosition(pNode->m_position);
+	}
+
+	void CModelWriterNode100_Mesh::writeVertexPosition(_In_ const NVEC3 & vPosition)
+	{
 		m_nVertexBufferPos = MODELWRITERMESH100_VERTEXLINESTARTLENGTH;
-		putVertexFloat(pNode->m_position.m_values.x);
+		putVertexFloat(vPosition.m_values.x);
 		putVertexString("\" y=\"");
-		putVertexFloat(pNode->m_position.m_values.y);
+		putVertexFloat(vPosition.m_values.y);
 		putVertexString("\" z=\"");
-		putVertexFloat(pNode->m_position.m_values.z);
+		putVertexFloat(vPosition.m_values.z);
 		putVertexString("\" />");
 
-		m_pXMLWriter->WriteRawLine(&m_VertexLine[0], m_nVertexBufferPos);
+		writeRawLine(&m_VertexLine[0], m_nVertexBufferPos);
+	}
+
+	void CModelWriterNode100_Mesh::writeStreamedVertices(_In_ const NVEC3 * pVertices, _In_ nfUint32 nCount)
+	{
+		__NMRASSERT(pVertices || (nCount == 0));
+		for (nfUint32 nIndex = 0; nIndex < nCount; nIndex++)
+			writeVertexPosition(pVertices[nIndex]);
+	}
+
+	void CModelWriterNode100_Mesh::writeStreamedTriangles(_In_ const nfUint32 * pIndices, _In_ nfUint32 nTriangleCount)
+	{
+		__NMRASSERT(pIndices || (nTriangleCount == 0));
+		for (nfUint32 nIndex = 0; nIndex < nTriangleCount; nIndex++) {
+			const nfUint32 * pTriangle = &pIndices[nIndex * 3];
+			m_nTriangleBufferPos = MODELWRITERMESH100_TRIANGLELINESTARTLENGTH;
+			putTriangleUInt32(pTriangle[0]);
+			putTriangleString("\" v2=\"");
+			putTriangleUInt32(pTriangle[1]);
+			putTriangleString("\" v3=\"");
+			putTriangleUInt32(pTriangle[2]);
+			putTriangleString("\" />");
+			writeRawLine(&m_TriangleLine[0], m_nTriangleBufferPos);
+		}
 	}
 
-	void CModelWriterNode100_Mesh::writeFaceData_Plain(_In_ MESHFACE * pFace, _In_opt_ const nfChar * pszAdditionalString)
+	void CModelWriterNode100_Mesh::writeFaceData_Plain(_In_ const MESHFACE * pFace, _In_opt_ const nfChar * pszAdditionalString)
 	{
 		__NMRASSERT(pFace);
 		m_nTriangleBufferPos = MODELWRITERMESH100_TRIANGLELINESTARTLENGTH;
@@ -722,10 +799,10 @@ namespace NMR {
 			putTriangleString(pszAdditionalString);
 		}
 		putTriangleString(" />");
-		m_pXMLWriter->WriteRawLine(&m_TriangleLine[0], m_nTriangleBufferPos);
+		writeRawLine(&m_TriangleLine[0], m_nTriangleBufferPos);
 	}
 
-	void CModelWriterNode100_Mesh::writeFaceData_OneProperty(_In_ MESHFACE * pFace, _In_ const ModelResourceID nPropertyID, _In_ const ModelResourceIndex nPropertyIndex, _In_opt_ const nfChar * pszAdditionalString)
+	void CModelWriterNode100_Mesh::writeFaceData_OneProperty(_In_ const MESHFACE * pFace, _In_ const ModelResourceID nPropertyID, _In_ const ModelResourceIndex nPropertyIndex, _In_opt_ const nfChar * pszAdditionalString)
 	{
 		__NMRASSERT(pFace);
 		m_nTriangleBufferPos = MODELWRITERMESH100_TRIANGLELINESTARTLENGTH;
@@ -745,10 +822,10 @@ namespace NMR {
 			putTriangleString(pszAdditionalString);
 		}
 		putTriangleString(" />");
-		m_pXMLWriter->WriteRawLine(&m_TriangleLine[0], m_nTriangleBufferPos);
+		writeRawLine(&m_TriangleLine[0], m_nTriangleBufferPos);
 	}
 
-	void CModelWriterNode100_Mesh::writeFaceData_ThreeProperties(_In_ MESHFACE * pFace, _In_ const ModelResourceID nPropertyID, _In_ const ModelResourceIndex nPropertyIndex1, _In_ const ModelResourceIndex nPropertyIndex2, _In_ const ModelResourceIndex nPropertyIndex3, _In_opt_ const nfChar * pszAdditionalString)
+	void CModelWriterNode100_Mesh::writeFaceData_ThreeProperties(_In_ const MESHFACE * pFace, _In_ const ModelResourceID nPropertyID, _In_ const ModelResourceIndex nPropertyIndex1, _In_ const ModelResourceIndex nPropertyIndex2, _In_ const ModelResourceIndex nPropertyIndex3, _In_opt_ const nfChar * pszAdditionalString)
 	{
 		__NMRASSERT(pFace);
 		m_nTriangleBufferPos = MODELWRITERMESH100_TRIANGLELINESTARTLENGTH;
@@ -772,10 +849,10 @@ namespace NMR {
 			putTriangleString(pszAdditionalString);
 		}
 		putTriangleString(" />");
-		m_pXMLWriter->WriteRawLine(&m_TriangleLine[0], m_nTriangleBufferPos);
+		writeRawLine(&m_TriangleLine[0], m_nTriangleBufferPos);
 	}	
 
-	__NMR_INLINE void CModelWriterNode100_Mesh::writeBeamData(_In_ MESHBEAM * pBeam, _In_ nfDouble dRadius, _In_ eModelBeamLatticeCapMode eDefaultCapMode)
+	__NMR_INLINE void CModelWriterNode100_Mesh::writeBeamData(_In_ const MESHBEAM * pBeam, _In_ nfDouble dRadius, _In_ eModelBeamLatticeCapMode eDefaultCapMode)
 	{
 		__NMRASSERT(pBeam);
 		m_nBeamBufferPos = MODELWRITERMESH100_BEAMLATTICE_BEAMSTARTLENGTH;
@@ -812,7 +889,7 @@ namespace NMR {
 		m_pXMLWriter->WriteRawLine(&m_BeamLine[0], m_nBeamBufferPos);
 	}
 
-	__NMR_INLINE void CModelWriterNode100_Mesh::writeBallData(_In_ MESHBALL* pBall, _In_ eModelBeamLatticeBallMode eBallMode, _In_ nfDouble dRadius)
+	__NMR_INLINE void CModelWriterNode100_Mesh::writeBallData(_In_ const MESHBALL* pBall, _In_ eModelBeamLatticeBallMode eBallMode, _In_ nfDouble dRadius)
 	{
 		__NMRASSERT(pBall);
 
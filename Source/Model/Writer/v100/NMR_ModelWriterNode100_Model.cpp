@@ -70,7 +70,7 @@ This is the class for exporting the 3mf model stream root node.
 namespace NMR {
 
 	CModelWriterNode100_Model::CModelWriterNode100_Model(_In_ CModel * pModel, _In_ CXmlWriter * pXMLWriter, _In_ PProgressMonitor pProgressMonitor,
-		_In_ nfUint32 nDecimalPrecision, nfBool bWritesRootModel) : CModelWriterNode_ModelBase(pModel, pXMLWriter, pProgressMonitor), m_nDecimalPrecision(nDecimalPrecision)
+		_In_ nfUint32 nDecimalPrecision, _In_ nfBool bShortestRoundtrip, nfBool bWritesRootModel, _In_ PThreadPool pThreadPool) : CModelWriterNode_ModelBase(pModel, pXMLWriter, pProgressMonitor), m_nDecimalPrecision(nDecimalPrecision), m_bShortestRoundtrip(bShortestRoundtrip), m_pThreadPool(pThreadPool)
 	{
 		m_pPropertyIndexMapping = std::make_shared<CMeshInformation_PropertyIndexMapping>();
 		m_bIsRootModel = bWritesRootModel;
@@ -611,9 +611,9 @@ namespace NMR {
 		{
 			CModelWriterNode100_Mesh ModelWriter_Mesh(
 				pMeshObject, m_pXMLWriter, m_pProgressMonitor,
-				m_pPropertyIndexMapping, m_nDecimalPrecision,
+				m_pPropertyIndexMapping, m_nDecimalPrecision, m_bShortestRoundtrip,
 				m_bWriteMaterialExtension, m_bWriteBeamLatticeExtension,
-				m_bWriteVolumetricExtension, m_bWriteTriangleSetExtension);
+				m_bWriteVolumetricExtension, m_bWriteTriangleSetExtension, m_pThreadPool);
 
 			ModelWriter_Mesh.writeToXML();
 		}
@@ -192,4 +192,10 @@ void fnCreateBox(std::vector<sLib3MFPosition> &vctVertices, std::vector<sLib3MFT
 
 void CheckReaderWarnings(Lib3MF::PReader reader, Lib3MF_uint32 nWarnings);
 
+// Returns the compression method and the compressed bytes of the ZIP entry sName in a written package
+void GetZIPEntryData(std::vector<Lib3MF_uint8> const & buffer, std::string sName, Lib3MF_uint32 & nMethod, std::vector<Lib3MF_uint8> & compressedData);
+
+// Returns a package with the given model part as root model, so that tests can read hand-written XML
+std::vector<Lib3MF_uint8> Create3MFFromModelXML(std::string const & sModelXML);
+
 #endif //__NMR_UNITTEST_UTILITIES
@@ -198,6 +198,65 @@ namespace Lib3MF
 		}
 	}
 
+	TEST_F(AttachmentsT, WriteReadUnchangedAttachment)
+	{
+		std::string sPayload;
+		for (int i = 0; i < 10000; i++)
+			sPayload += "<entry index=\"" + std::to_string(i) + "\"/>";
+
+		auto attachment = model->AddAttachment(m_sRelationShipPath + ".xml", m_sAttachmetType);
+		attachment->ReadFromBuffer(CLib3MFInputVector<Lib3MF_uint8>((Lib3MF_uint8*)sPayload.data(), sPayload.size()));
+		model->AddCustomContentType("xml", "application/xml");
+		std::string sEntryName = m_sRelationShipPath.substr(1) + ".xml";
+
+		auto writer = model->QueryWriter("3mf");
+		writer->SetCompressionLevel(ePackagePartType::Attachment, eCompressionLevel::Maximum);
+		std::vector<Lib3MF_uint8> vctFileBuffer;
+		writer->WriteToBuffer(vctFileBuffer);
+		Lib3MF_uint32 nMethod = 0;
+		std::vector<Lib3MF_uint8> vctMaximumEntry;
+		GetZIPEntryData(vctFileBuffer, sEntryName, nMethod, vctMaximumEntry);
+		ASSERT_EQ(nMethod, 8u);
+
+		// Compressing the attachment with the fastest level gives different bytes
+		writer->SetCompressionLevel(ePackagePartType::Attachment, eCompressionLevel::Fastest);
+		std::vector<Lib3MF_uint8> vctFastestBuffer, vctFastestEntry;
+		writer->WriteToBuffer(vctFastestBuffer);
+		GetZIPEntryData(vctFastestBuffer, sEntryName, nMethod, vctFastestEntry);
+		ASSERT_NE(vctFastestEntry, vctMaximumEntry);
+
+		// The attachment is written again without being accessed
+		auto readModel = wrapper->CreateModel();
+		auto reader = readModel->QueryReader("3mf");
+		reader->AddRelationToRead(m_sAttachmetType);
+		reader->ReadFromBuffer(vctFileBuffer);
+		ASSERT_EQ(readModel->GetAttachmentCount(), 1);
+		ASSERT_EQ(readModel->GetAttachment(0)->GetStreamSize(), sPayload.size());
+
+		// Its deflated bytes are copied as they are, not compressed again with the level of the writer
+		std::vector<Lib3MF_uint8> vctRewrittenBuffer, vctRewrittenEntry;
+		auto rewriter = readModel->QueryWriter("3mf");
+		rewriter->SetCompressionLevel(ePackagePartType::Attachment, eCompressionLevel::Fastest);
+		rewriter->WriteToBuffer(vctRewrittenBuffer);
+		GetZIPEntryData(vctRewrittenBuffer, sEntryName, nMethod, vctRewrittenEntry);
+		ASSERT_EQ(nMethod, 8u);
+		ASSERT_EQ(vctRewrittenEntry, vctMaximumEntry);
+
+		auto rereadModel = wrapper->CreateModel();
+		auto rereader = rereadModel->QueryReader("3mf");
+		rereader->AddRelationToRead(m_sAttachmetType);
+		rereader->ReadFromBuffer(vctRewrittenBuffer);
+		ASSERT_EQ(rereadModel->GetAttachmentCount(), 1);
+
+		std::vector<Lib3MF_uint8> vctAttachmentBuffer;
+		rereadModel->GetAttachment(0)->WriteToBuffer(vctAttachmentBuffer);
+		ASSERT_EQ(std::string(vctAttachmentBuffer.begin(), vctAttachmentBuffer.end()), sPayload);
+
+		// Accessing the attachment of the first model does not change it
+		readModel->GetAttachment(0)->WriteToBuffer(vctAttachmentBuffer);
+		ASSERT_EQ(std::string(vctAttachmentBuffer.begin(), vctAttachmentBuffer.end()), sPayload);
+	}
+
 	void CheckPackageThumbnailAreEqual(PModel pModel1, PModel pModel2)
 	{
 		ASSERT_EQ(pModel1->HasPackageThumbnailAttachment(), pModel2->HasPackageThumbnailAttachment());
@@ -83,6 +83,49 @@ namespace Lib3MF
 		ExpectEqModels(m_pModel, pReadModel);
 	}
 
+	TEST_F(MergeModels, MergeModelAttachments)
+	{
+		std::vector<Lib3MF_uint8> buffer, fastestBuffer;
+		auto pMergedModel = m_pModel->MergeToModel();
+		auto pWriter = pMergedModel->QueryWriter("3mf");
+		pWriter->SetCompressionLevel(ePackagePartType::Image, eCompressionLevel::Maximum);
+		pWriter->SetCompressionLevel(ePackagePartType::Attachment, eCompressionLevel::Maximum);
+		pWriter->WriteToBuffer(buffer);
+		pWriter->SetCompressionLevel(ePackagePartType::Image, eCompressionLevel::Fastest);
+		pWriter->SetCompressionLevel(ePackagePartType::Attachment, eCompressionLevel::Fastest);
+		pWriter->WriteToBuffer(fastestBuffer);
+
+		auto pReadModel = wrapper->CreateModel();
+		pReadModel->QueryReader("3mf")->ReadFromBuffer(buffer);
+
+		// The merged attachments keep the deflated bytes of the source package, whatever level is set
+		std::vector<Lib3MF_uint8> sourceBuffer = ReadFileIntoBuffer(sTestFilesPath + "/Models/" + "WithSomeResources.3mf");
+
+		ASSERT_GT(m_pModel->GetAttachmentCount(), 0u);
+		ASSERT_EQ(m_pModel->GetAttachmentCount(), pReadModel->GetAttachmentCount());
+		for (Lib3MF_uint32 i = 0; i < m_pModel->GetAttachmentCount(); i++) {
+			auto pAttachment = m_pModel->GetAttachment(i);
+			auto pReadAttachment = pReadModel->FindAttachment(pAttachment->GetPath());
+
+			std::string sEntryName = pAttachment->GetPath().substr(1);
+			Lib3MF_uint32 nSourceMethod = 0, nMethod = 0, nFastestMethod = 0;
+			std::vector<Lib3MF_uint8> sourceEntry, entry, fastestEntry;
+			GetZIPEntryData(sourceBuffer, sEntryName, nSourceMethod, sourceEntry);
+			GetZIPEntryData(buffer, sEntryName, nMethod, entry);
+			GetZIPEntryData(fastestBuffer, sEntryName, nFastestMethod, fastestEntry);
+			ASSERT_EQ(nSourceMethod, 8u);
+			EXPECT_EQ(nMethod, nSourceMethod);
+			EXPECT_EQ(nFastestMethod, nSourceMethod);
+			EXPECT_EQ(entry, sourceEntry) << sEntryName;
+			EXPECT_EQ(fastestEntry, sourceEntry) << sEntryName;
+
+			std::vector<Lib3MF_uint8> vctOriginal, vctRead;
+			pAttachment->WriteToBuffer(vctOriginal);
+			pReadAttachment->WriteToBuffer(vctRead);
+			EXPECT_EQ(vctOriginal, vctRead);
+		}
+	}
+
 
 	class MergeModels2 : public Lib3MFTest {
 	protected:
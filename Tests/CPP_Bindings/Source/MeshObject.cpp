@@ -32,6 +32,7 @@ UnitTest_MeshObject.cpp: Defines Unittests for the mesh object class
 
 #include "UnitTest_Utilities.h"
 #include "lib3mf_implicit.hpp"
+#include <cmath>
 
 namespace Lib3MF
 {
@@ -191,6 +192,87 @@ namespace Lib3MF
 		
 	}
 
+	TEST_F(MeshObject, PagedGeometryAccess)
+	{
+		// Use enough elements to span several pages
+		const Lib3MF_uint32 nVertexCount = 1000;
+		std::vector<sPosition> vctPositions(nVertexCount);
+		for (Lib3MF_uint32 i = 0; i < nVertexCount; i++)
+			vctPositions[i] = fnCreateVertex(1.0f * i, 2.0f * i, 3.0f * i);
+		std::vector<sTriangle> vctTriangles(nVertexCount - 2);
+		for (Lib3MF_uint32 i = 0; i < nVertexCount - 2; i++)
+			vctTriangles[i] = fnCreateTriangle(i, i + 1, i + 2);
+		mesh->SetGeometry(vctPositions, vctTriangles);
+
+		Lib3MF_uint32 nPageCount = mesh->GetVertexPageCount();
+		ASSERT_GT(nPageCount, 1u);
+		Lib3MF_uint32 nIndex = 0;
+		for (Lib3MF_uint32 nPage = 0; nPage < nPageCount; nPage++) {
+			Lib3MF_uint32 nCount = 0;
+			Lib3MF_uint32 nStride = 0;
+			const Lib3MF_uint8 * pData = (const Lib3MF_uint8 *)mesh->GetVertexPage(nPage, nCount, nStride);
+			ASSERT_GE(nStride, 3 * sizeof(Lib3MF_single));
+			for (Lib3MF_uint32 i = 0; i < nCount; i++, nIndex++) {
+				const Lib3MF_single * pCoordinates = (const Lib3MF_single *)(pData + i * nStride);
+				for (int j = 0; j < 3; j++)
+					ASSERT_EQ(vctPositions[nIndex].m_Coordinates[j], pCoordinates[j]);
+			}
+		}
+		ASSERT_EQ(nIndex, nVertexCount);
+
+		nPageCount = mesh->GetTrianglePageCount();
+		nIndex = 0;
+		for (Lib3MF_uint32 nPage = 0; nPage < nPageCount; nPage++) {
+			Lib3MF_uint32 nCount = 0;
+			Lib3MF_uint32 nStride = 0;
+			const Lib3MF_uint8 * pData = (const Lib3MF_uint8 *)mesh->GetTrianglePage(nPage, nCount, nStride);
+			for (Lib3MF_uint32 i = 0; i < nCount; i++, nIndex++) {
+				const Lib3MF_uint32 * pIndices = (const Lib3MF_uint32 *)(pData + i * nStride);
+				for (int j = 0; j < 3; j++)
+					ASSERT_EQ(vctTriangles[nIndex].m_Indices[j], pIndices[j]);
+			}
+		}
+		ASSERT_EQ(nIndex, nVertexCount - 2);
+		ASSERT_SPECIFIC_THROW(mesh->GetTrianglePage(nPageCount, nIndex, nIndex), ELib3MFException);
+
+		std::vector<sPosition> vctPositionsOut;
+		mesh->GetVertices(vctPositionsOut);
+		ASSERT_EQ(vctPositionsOut.size(), nVertexCount);
+		for (Lib3MF_uint32 i = 0; i < nVertexCount; i++)
+			for (int j = 0; j < 3; j++)
+				ASSERT_EQ(vctPositions[i].m_Coordinates[j], vctPositionsOut[i].m_Coordinates[j]);
+
+		std::vector<sTriangle> vctTrianglesOut;
+		mesh->GetTriangleIndices(vctTrianglesOut);
+		ASSERT_EQ(vctTrianglesOut.size(), nVertexCount - 2);
+		for (Lib3MF_uint32 i = 0; i < nVertexCount - 2; i++)
+			for (int j = 0; j < 3; j++)
+				ASSERT_EQ(vctTriangles[i].m_Indices[j], vctTrianglesOut[i].m_Indices[j]);
+	}
+
+	TEST_F(MeshObject, ReserveGeometry)
+	{
+		mesh->ReserveGeometry(100000, 200000, 0);
+		ASSERT_EQ(0, mesh->GetVertexCount());
+		ASSERT_EQ(0, mesh->GetTriangleCount());
+		ASSERT_EQ(0, mesh->GetVertexPageCount());
+
+		mesh->SetGeometry(CLib3MFInputVector<sPosition>(pVertices, 8), CLib3MFInputVector<sTriangle>(pTriangles, 12));
+		mesh->ReserveGeometry(4, 4, 0);
+		ASSERT_EQ(mesh->GetVertexCount(), 8);
+		ASSERT_EQ(mesh->GetTriangleCount(), 12);
+		for (Lib3MF_uint32 i = 0; i < 100000; i++)
+			mesh->AddVertex(pVertices[i % 8]);
+		ASSERT_EQ(mesh->GetVertexCount(), 100008);
+
+		sPosition pos = mesh->GetVertex(100007);
+		for (int j = 0; j < 3; j++)
+			ASSERT_EQ(pVertices[7].m_Coordinates[j], pos.m_Coordinates[j]);
+		sTriangle triangle = mesh->GetTriangle(11);
+		for (int j = 0; j < 3; j++)
+			ASSERT_EQ(pTriangles[11].m_Indices[j], triangle.m_Indices[j]);
+	}
+
 	TEST_F(MeshObject, IsManifoldAndOriented)
 	{
 		ASSERT_FALSE(mesh->IsManifoldAndOriented());
@@ -198,6 +280,46 @@ namespace Lib3MF
 		ASSERT_TRUE(mesh->IsManifoldAndOriented());
 	}
 
+	TEST_F(MeshObject, IsManifoldAndOrientedLargeMesh)
+	{
+		// Closed torus, large enough to be checked in parallel
+		const Lib3MF_uint32 nSegmentsU = 512;
+		const Lib3MF_uint32 nSegmentsV = 300;
+		std::vector<sPosition> vctPositions;
+		for (Lib3MF_uint32 u = 0; u < nSegmentsU; u++) {
+			for (Lib3MF_uint32 v = 0; v < nSegmentsV; v++) {
+				float fU = 6.2831853f * u / nSegmentsU;
+				float fV = 6.2831853f * v / nSegmentsV;
+				float fRadius = 100.0f + 30.0f * std::cos(fV);
+				vctPositions.push_back(fnCreateVertex(fRadius * std::cos(fU), fRadius * std::sin(fU), 30.0f * std::sin(fV)));
+			}
+		}
+		std::vector<sTriangle> vctTriangles;
+		for (Lib3MF_uint32 u = 0; u < nSegmentsU; u++) {
+			for (Lib3MF_uint32 v = 0; v < nSegmentsV; v++) {
+				Lib3MF_uint32 n00 = u * nSegmentsV + v;
+				Lib3MF_uint32 n10 = ((u + 1) % nSegmentsU) * nSegmentsV + v;
+				Lib3MF_uint32 n01 = u * nSegmentsV + (v + 1) % nSegmentsV;
+				Lib3MF_uint32 n11 = ((u + 1) % nSegmentsU) * nSegmentsV + (v + 1) % nSegmentsV;
+				vctTriangles.push_back(fnCreateTriangle(n00, n10, n11));
+				vctTriangles.push_back(fnCreateTriangle(n00, n11, n01));
+			}
+		}
+		mesh->SetGeometry(vctPositions, vctTriangles);
+		ASSERT_TRUE(mesh->IsManifoldAndOriented());
+
+		// Flip a single triangle
+		sTriangle triangle = vctTriangles[123457];
+		mesh->SetTriangle(123457, fnCreateTriangle(triangle.m_Indices[1], triangle.m_Indices[0], triangle.m_Indices[2]));
+		ASSERT_FALSE(mesh->IsManifoldAndOriented());
+		mesh->SetTriangle(123457, triangle);
+		ASSERT_TRUE(mesh->IsManifoldAndOriented());
+
+		// Duplicate a triangle
+		mesh->AddTriangle(triangle);
+		ASSERT_FALSE(mesh->IsManifoldAndOriented());
+	}
+
 	TEST_F(MeshObject, IsValid)
 	{
 		ASSERT_FALSE(mesh->IsValid());
@@ -76,6 +76,34 @@ namespace Lib3MF
 		CompareBoxes(sOutbox, sExpectedOutbox);
 	}
 
+	TEST_F(Outbox, CheckMeshAfterModification)
+	{
+		auto meshes = model->GetMeshObjects();
+		meshes->MoveNext();
+		auto mesh = meshes->GetCurrentMeshObject();
+
+		Lib3MF::sBox sOriginalOutbox = mesh->GetOutbox();
+		CompareBoxes(mesh->GetOutbox(), sOriginalOutbox);
+
+		// Moving an existing vertex must invalidate the cached outbox
+		Lib3MF::sPosition sOriginalVertex = mesh->GetVertex(0);
+		Lib3MF::sPosition sMovedVertex = sOriginalVertex;
+		sMovedVertex.m_Coordinates[0] = 500.0f;
+		mesh->SetVertex(0, sMovedVertex);
+		EXPECT_FLOAT_EQ(mesh->GetOutbox().m_MaxCoordinate[0], 500.0f);
+
+		mesh->SetVertex(0, sOriginalVertex);
+		CompareBoxes(mesh->GetOutbox(), sOriginalOutbox);
+
+		// So must adding a vertex
+		Lib3MF::sPosition sNewVertex;
+		sNewVertex.m_Coordinates[0] = 0.0f;
+		sNewVertex.m_Coordinates[1] = 0.0f;
+		sNewVertex.m_Coordinates[2] = -20.0f;
+		mesh->AddVertex(sNewVertex);
+		EXPECT_FLOAT_EQ(mesh->GetOutbox().m_MinCoordinate[2], -20.0f);
+	}
+
 	TEST_F(Outbox, CheckComponent)
 	{
 		auto components = model->GetComponentsObjects();
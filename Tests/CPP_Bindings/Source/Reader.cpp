@@ -34,6 +34,10 @@ UnitTest_Reader.cpp: Defines Unittests for the Reader classes
 #include "lib3mf_implicit.hpp"
 
 #include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
 
 namespace Lib3MF
 {
@@ -138,6 +142,122 @@ namespace Lib3MF
 		CheckReaderWarnings(Reader::reader3MF, 0);
 	}
 
+	TEST_F(Reader, 3MFReadFromFileMapsStoredParts)
+	{
+		// Stored parts of a file are read from its memory mapping, instead of through libzip
+		const std::string sAttachmentType = "http://schemas.autodesk.com/dmg/testattachment/2017/08";
+		std::string sPayload;
+		for (int i = 0; i < 10000; i++)
+			sPayload += "<entry index=\"" + std::to_string(i) + "\"/>";
+
+		auto sourceModel = wrapper->CreateModel();
+		std::vector<sLib3MFPosition> vctVertices;
+		std::vector<sLib3MFTriangle> vctTriangles;
+		fnCreateBox(vctVertices, vctTriangles);
+		auto sourceMesh = sourceModel->AddMeshObject();
+		sourceMesh->SetGeometry(vctVertices, vctTriangles);
+		sourceModel->AddBuildItem(sourceMesh.get(), wrapper->GetIdentityTransform());
+		auto sourceAttachment = sourceModel->AddAttachment("/Attachments/stored.xml", sAttachmentType);
+		sourceAttachment->ReadFromBuffer(CLib3MFInputVector<Lib3MF_uint8>((Lib3MF_uint8*)sPayload.data(), sPayload.size()));
+		sourceModel->AddCustomContentType("xml", "application/xml");
+
+		const std::string sFileName = sOutFilesPath + "/Reader_MappedStoredParts.3mf";
+		for (auto level : { eCompressionLevel::Stored, eCompressionLevel::Fastest }) {
+			auto writer = sourceModel->QueryWriter("3mf");
+			writer->SetCompressionLevel(ePackagePartType::Model, level);
+			writer->SetCompressionLevel(ePackagePartType::Attachment, level);
+			writer->WriteToFile(sFileName);
+
+			auto reader = model->QueryReader("3mf");
+			reader->AddRelationToRead(sAttachmentType);
+			reader->ReadFromFile(sFileName);
+			CheckReaderWarnings(reader, 0);
+
+			auto meshes = model->GetMeshObjects();
+			ASSERT_TRUE(meshes->MoveNext());
+			auto mesh = meshes->GetCurrentMeshObject();
+			std::vector<sLib3MFPosition> vctReadVertices;
+			std::vector<sLib3MFTriangle> vctReadTriangles;
+			mesh->GetVertices(vctReadVertices);
+			mesh->GetTriangleIndices(vctReadTriangles);
+			ASSERT_EQ(vctReadVertices.size(), vctVertices.size());
+			ASSERT_EQ(vctReadTriangles.size(), vctTriangles.size());
+			for (size_t nIndex = 0; nIndex < vctTriangles.size(); nIndex++)
+				for (int j = 0; j < 3; j++)
+					ASSERT_EQ(vctReadTriangles[nIndex].m_Indices[j], vctTriangles[nIndex].m_Indices[j]);
+
+			auto attachment = model->FindAttachment("/Attachments/stored.xml");
+			std::vector<Lib3MF_uint8> vctAttachmentBuffer;
+			attachment->WriteToBuffer(vctAttachmentBuffer);
+			ASSERT_EQ(std::string(vctAttachmentBuffer.begin(), vctAttachmentBuffer.end()), sPayload);
+
+			// The model does not refer to the file after reading
+			std::ofstream(sFileName, std::ios::trunc).close();
+			attachment->WriteToBuffer(vctAttachmentBuffer);
+			ASSERT_EQ(std::string(vctAttachmentBuffer.begin(), vctAttachmentBuffer.end()), sPayload);
+
+			model = wrapper->CreateModel();
+		}
+	}
+
+	TEST_F(Reader, 3MFReadFromFileAndWriteToSameFile)
+	{
+		// A model that has been read from a file can be written back to this file
+		const std::string sAttachmentType = "http://schemas.autodesk.com/dmg/testattachment/2017/08";
+		std::string sPayload;
+		for (int i = 0; i < 10000; i++)
+			sPayload += "<entry index=\"" + std::to_string(i) + "\"/>";
+
+		std::vector<sLib3MFPosition> vctVertices;
+		std::vector<sLib3MFTriangle> vctTriangles;
+		fnCreateBox(vctVertices, vctTriangles);
+
+		const std::string sFileName = sOutFilesPath + "/Reader_WriteToSameFile.3mf";
+		for (auto level : { eCompressionLevel::Stored, eCompressionLevel::Fastest }) {
+			auto sourceModel = wrapper->CreateModel();
+			auto sourceMesh = sourceModel->AddMeshObject();
+			sourceMesh->SetGeometry(vctVertices, vctTriangles);
+			sourceModel->AddBuildItem(sourceMesh.get(), wrapper->GetIdentityTransform());
+			auto sourceAttachment = sourceModel->AddAttachment("/Attachments/payload.xml", sAttachmentType);
+			sourceAttachment->ReadFromBuffer(CLib3MFInputVector<Lib3MF_uint8>((Lib3MF_uint8*)sPayload.data(), sPayload.size()));
+			sourceModel->AddCustomContentType("xml", "application/xml");
+
+			auto sourceWriter = sourceModel->QueryWriter("3mf");
+			sourceWriter->SetCompressionLevel(ePackagePartType::Model, level);
+			sourceWriter->SetCompressionLevel(ePackagePartType::Attachment, level);
+			sourceWriter->WriteToFile(sFileName);
+
+			for (int nPass = 0; nPass < 2; nPass++) {
+				auto readModel = wrapper->CreateModel();
+				auto reader = readModel->QueryReader("3mf");
+				reader->AddRelationToRead(sAttachmentType);
+				reader->ReadFromFile(sFileName);
+				CheckReaderWarnings(reader, 0);
+
+				auto meshes = readModel->GetMeshObjects();
+				ASSERT_TRUE(meshes->MoveNext());
+				std::vector<sLib3MFPosition> vctReadVertices;
+				std::vector<sLib3MFTriangle> vctReadTriangles;
+				meshes->GetCurrentMeshObject()->GetVertices(vctReadVertices);
+				meshes->GetCurrentMeshObject()->GetTriangleIndices(vctReadTriangles);
+				ASSERT_EQ(vctReadVertices.size(), vctVertices.size());
+				ASSERT_EQ(vctReadTriangles.size(), vctTriangles.size());
+
+				std::vector<Lib3MF_uint8> vctAttachmentBuffer;
+				readModel->FindAttachment("/Attachments/payload.xml")->WriteToBuffer(vctAttachmentBuffer);
+				ASSERT_EQ(std::string(vctAttachmentBuffer.begin(), vctAttachmentBuffer.end()), sPayload);
+
+				// The second pass reads what the first pass has written
+				if (nPass == 0) {
+					auto writer = readModel->QueryWriter("3mf");
+					writer->SetCompressionLevel(ePackagePartType::Model, level);
+					writer->SetCompressionLevel(ePackagePartType::Attachment, level);
+					writer->WriteToFile(sFileName);
+				}
+			}
+		}
+	}
+
 	TEST_F(Reader, Production)
 	{
 		auto buffer = ReadFileIntoBuffer(sTestFilesPath + "/Production/" + "2ProductionBoxes.3mf");
@@ -200,4 +320,487 @@ namespace Lib3MF
 		reader->ReadFromFile(sTestFilesPath + "/Reader/" + "cam_51476_test.3mf");
 		CheckReaderWarnings(Reader::reader3MF, 0);
 	}
-}
\ No newline at end of file
+
+	TEST_F(Reader, 3MFReadWithWorkerThreads)
+	{
+		// The mesh is large enough to be split into several segments by the parallel mesh reader.
+		auto sourceModel = wrapper->CreateModel();
+		auto sourceMesh = sourceModel->AddMeshObject();
+		const Lib3MF_uint32 nGridSize = 200;
+		std::vector<sLib3MFPosition> vctVertices;
+		std::vector<sLib3MFTriangle> vctTriangles;
+		for (Lib3MF_uint32 nY = 0; nY < nGridSize; nY++) {
+			for (Lib3MF_uint32 nX = 0; nX < nGridSize; nX++) {
+				sLib3MFPosition position = { { nX * 0.25f, nY * 0.5f, (nX * nY % 7) * 0.125f } };
+				vctVertices.push_back(position);
+				if ((nX > 0) && (nY > 0)) {
+					Lib3MF_uint32 nIndex = nY * nGridSize + nX;
+					vctTriangles.push_back({ { nIndex - nGridSize - 1, nIndex - nGridSize, nIndex } });
+					vctTriangles.push_back({ { nIndex - nGridSize - 1, nIndex, nIndex - 1 } });
+				}
+			}
+		}
+		sourceMesh->SetGeometry(vctVertices, vctTriangles);
+		sourceModel->AddBuildItem(sourceMesh.get(), wrapper->GetIdentityTransform());
+		std::vector<Lib3MF_uint8> buffer;
+		sourceModel->QueryWriter("3mf")->WriteToBuffer(buffer);
+
+		ASSERT_EQ(reader3MF->GetWorkerThreadCount(), 1);
+		reader3MF->ReadFromBuffer(buffer);
+		CheckReaderWarnings(reader3MF, 0);
+
+		auto parallelModel = wrapper->CreateModel();
+		auto parallelReader = parallelModel->QueryReader("3mf");
+		parallelReader->SetWorkerThreadCount(4);
+		ASSERT_EQ(parallelReader->GetWorkerThreadCount(), 4);
+		parallelReader->ReadFromBuffer(buffer);
+		CheckReaderWarnings(parallelReader, 0);
+
+		// Both readers decode the vertices and triangles in memory, the single worker does so in one segment
+		auto singleThreadMeshes = model->GetMeshObjects();
+		auto parallelMeshes = parallelModel->GetMeshObjects();
+		ASSERT_TRUE(singleThreadMeshes->MoveNext());
+		ASSERT_TRUE(parallelMeshes->MoveNext());
+		auto singleThreadMesh = singleThreadMeshes->GetCurrentMeshObject();
+		auto parallelMesh = parallelMeshes->GetCurrentMeshObject();
+
+		std::vector<sLib3MFPosition> vctSingleThreadVertices, vctParallelVertices;
+		std::vector<sLib3MFTriangle> vctSingleThreadTriangles, vctParallelTriangles;
+		singleThreadMesh->GetVertices(vctSingleThreadVertices);
+		parallelMesh->GetVertices(vctParallelVertices);
+		singleThreadMesh->GetTriangleIndices(vctSingleThreadTriangles);
+		parallelMesh->GetTriangleIndices(vctParallelTriangles);
+
+		ASSERT_EQ(vctParallelVertices.size(), vctVertices.size());
+		ASSERT_EQ(vctParallelTriangles.size(), vctTriangles.size());
+		ASSERT_EQ(vctSingleThreadVertices.size(), vctVertices.size());
+		ASSERT_EQ(vctSingleThreadTriangles.size(), vctTriangles.size());
+		for (size_t iVertex = 0; iVertex < vctVertices.size(); iVertex++)
+			for (int iCoordinate = 0; iCoordinate < 3; iCoordinate++) {
+				ASSERT_EQ(vctParallelVertices[iVertex].m_Coordinates[iCoordinate], vctVertices[iVertex].m_Coordinates[iCoordinate]);
+				ASSERT_EQ(vctSingleThreadVertices[iVertex].m_Coordinates[iCoordinate], vctVertices[iVertex].m_Coordinates[iCoordinate]);
+			}
+		for (size_t iTriangle = 0; iTriangle < vctTriangles.size(); iTriangle++)
+			for (int iIndex = 0; iIndex < 3; iIndex++) {
+				ASSERT_EQ(vctParallelTriangles[iTriangle].m_Indices[iIndex], vctTriangles[iTriangle].m_Indices[iIndex]);
+				ASSERT_EQ(vctSingleThreadTriangles[iTriangle].m_Indices[iIndex], vctTriangles[iTriangle].m_Indices[iIndex]);
+			}
+	}
+
+	// Writes a grid mesh by hand. With a prefix for the core namespace, the mesh is read node by node,
+	// without one, the vertices and triangles are decoded from the raw XML.
+	static std::string fnGridModelXML(std::string sPrefix, Lib3MF_uint32 nGridSize, Lib3MF_uint32 nCommentInterval, std::string sInsertion,
+		std::vector<sLib3MFPosition> & vctVertices, std::vector<sLib3MFTriangle> & vctTriangles)
+	{
+		std::string sElementPrefix = sPrefix.empty() ? "" : sPrefix + ":";
+		std::string sNamespace = sPrefix.empty() ? "xmlns" : "xmlns:" + sPrefix;
+		std::ostringstream stream;
+		stream << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n";
+		stream << "<" << sElementPrefix << "model unit=\"millimeter\" xml:lang=\"en-US\" " << sNamespace << "=\"http://schemas.microsoft.com/3dmanufacturing/core/2015/02\">";
+		stream << "<" << sElementPrefix << "resources><" << sElementPrefix << "object id=\"1\" type=\"model\"><" << sElementPrefix << "mesh>";
+
+		vctVertices.clear();
+		vctTriangles.clear();
+		stream << "<" << sElementPrefix << "vertices>" << sInsertion << "<!-- first vertex -->\n";
+		for (Lib3MF_uint32 nY = 0; nY < nGridSize; nY++) {
+			for (Lib3MF_uint32 nX = 0; nX < nGridSize; nX++) {
+				sLib3MFPosition position = { { nX * 0.25f, nY * 0.5f, (nX * nY % 7) * 0.125f } };
+				vctVertices.push_back(position);
+				stream << "<" << sElementPrefix << "vertex x=\"" << position.m_Coordinates[0] << "\" y=\"" << position.m_Coordinates[1] << "\" z=\"" << position.m_Coordinates[2] << "\"/>\n";
+				if (vctVertices.size() % nCommentInterval == 0)
+					stream << "<!-- vertex " << vctVertices.size() << " - > < & -->" << sInsertion;
+			}
+		}
+		stream << "<!-- last vertex --></" << sElementPrefix << "vertices>";
+
+		stream << "<" << sElementPrefix << "triangles><!-- first triangle -->";
+		for (Lib3MF_uint32 nY = 1; nY < nGridSize; nY++) {
+			for (Lib3MF_uint32 nX = 1; nX < nGridSize; nX++) {
+				Lib3MF_uint32 nIndex = nY * nGridSize + nX;
+				vctTriangles.push_back({ { nIndex - nGridSize - 1, nIndex - nGridSize, nIndex } });
+				vctTriangles.push_back({ { nIndex - nGridSize - 1, nIndex, nIndex - 1 } });
+				for (size_t iTriangle = vctTriangles.size() - 2; iTriangle < vctTriangles.size(); iTriangle++) {
+					auto & triangle = vctTriangles[iTriangle];
+					stream << "<" << sElementPrefix << "triangle v1=\"" << triangle.m_Indices[0] << "\" v2=\"" << triangle.m_Indices[1] << "\" v3=\"" << triangle.m_Indices[2] << "\"/>";
+					if (vctTriangles.size() % nCommentInterval == 0)
+						stream << "<!-- triangle " << vctTriangles.size() << " -->\n";
+				}
+			}
+		}
+		stream << "<!-- last triangle --></" << sElementPrefix << "triangles>";
+
+		stream << "</" << sElementPrefix << "mesh></" << sElementPrefix << "object></" << sElementPrefix << "resources>";
+		stream << "<" << sElementPrefix << "build><" << sElementPrefix << "item objectid=\"1\"/></" << sElementPrefix << "build>";
+		stream << "</" << sElementPrefix << "model>";
+		return stream.str();
+	}
+
+	static void fnCompareMesh(PModel model, std::vector<sLib3MFPosition> const & vctVertices, std::vector<sLib3MFTriangle> const & vctTriangles)
+	{
+		auto meshes = model->GetMeshObjects();
+		ASSERT_TRUE(meshes->MoveNext());
+		auto mesh = meshes->GetCurrentMeshObject();
+		std::vector<sLib3MFPosition> vctReadVertices;
+		std::vector<sLib3MFTriangle> vctReadTriangles;
+		mesh->GetVertices(vctReadVertices);
+		mesh->GetTriangleIndices(vctReadTriangles);
+		ASSERT_EQ(vctReadVertices.size(), vctVertices.size());
+		ASSERT_EQ(vctReadTriangles.size(), vctTriangles.size());
+		for (size_t iVertex = 0; iVertex < vctVertices.size(); iVertex++)
+			for (int iCoordinate = 0; iCoordinate < 3; iCoordinate++)
+				ASSERT_EQ(vctReadVertices[iVertex].m_Coordinates[iCoordinate], vctVertices[iVertex].m_Coordinates[iCoordinate]);
+		for (size_t iTriangle = 0; iTriangle < vctTriangles.size(); iTriangle++)
+			for (int iIndex = 0; iIndex < 3; iIndex++)
+				ASSERT_EQ(vctReadTriangles[iTriangle].m_Indices[iIndex], vctTriangles[iTriangle].m_Indices[iIndex]);
+	}
+
+	TEST_F(Reader, 3MFReadCommentsInsideMeshLikeNodeParser)
+	{
+		// The comments end the raw decoding in the middle of the vertices and triangles, at varying
+		// positions relative to the buffer refills of the XML reader
+		for (Lib3MF_uint32 nCommentInterval : { 1, 7, 1000 }) {
+			for (std::string sPrefix : { "", "m" }) {
+				for (Lib3MF_uint32 nWorkerThreads : { 1, 4 }) {
+					std::vector<sLib3MFPosition> vctVertices;
+					std::vector<sLib3MFTriangle> vctTriangles;
+					auto buffer = Create3MFFromModelXML(fnGridModelXML(sPrefix, 120, nCommentInterval, "", vctVertices, vctTriangles));
+
+					auto readModel = wrapper->CreateModel();
+					auto reader = readModel->QueryReader("3mf");
+					reader->SetWorkerThreadCount(nWorkerThreads);
+					reader->ReadFromBuffer(buffer);
+					CheckReaderWarnings(reader, 0);
+					fnCompareMesh(readModel, vctVertices, vctTriangles);
+				}
+			}
+		}
+	}
+
+	TEST_F(Reader, 3MFReadCharacterDataInsideVerticesLikeNodeParser)
+	{
+		// Mesh elements do not have character data, the raw decoder must handle it like the node parser
+		for (std::string sInsertion : { "<![CDATA[<vertex x=\"1\" y=\"2\" z=\"3\"/>]]>", "stray &amp; text", " \t\r\n" }) {
+			std::vector<sLib3MFPosition> vctVertices, vctNodeVertices;
+			std::vector<sLib3MFTriangle> vctTriangles, vctNodeTriangles;
+			bool bNodeParserThrows = false;
+			auto nodeModel = wrapper->CreateModel();
+			try {
+				nodeModel->QueryReader("3mf")->ReadFromBuffer(Create3MFFromModelXML(fnGridModelXML("m", 20, 50, sInsertion, vctVertices, vctTriangles)));
+				auto meshes = nodeModel->GetMeshObjects();
+				ASSERT_TRUE(meshes->MoveNext());
+				meshes->GetCurrentMeshObject()->GetVertices(vctNodeVertices);
+				meshes->GetCurrentMeshObject()->GetTriangleIndices(vctNodeTriangles);
+			}
+			catch (ELib3MFException &) {
+				bNodeParserThrows = true;
+			}
+
+			auto buffer = Create3MFFromModelXML(fnGridModelXML("", 20, 50, sInsertion, vctVertices, vctTriangles));
+			for (Lib3MF_uint32 nWorkerThreads : { 1, 4 }) {
+				auto readModel = wrapper->CreateModel();
+				auto reader = readModel->QueryReader("3mf");
+				reader->SetWorkerThreadCount(nWorkerThreads);
+				if (bNodeParserThrows) {
+					ASSERT_SPECIFIC_THROW(reader->ReadFromBuffer(buffer), ELib3MFException);
+				}
+				else {
+					reader->ReadFromBuffer(buffer);
+					fnCompareMesh(readModel, vctNodeVertices, vctNodeTriangles);
+				}
+			}
+		}
+	}
+
+	TEST_F(Reader, 3MFReadWithWorkerThreadsFallsBackOnUnusualContent)
+	{
+		// Leading whitespace and signs are left to the sequential parser.
+		reader3MF->SetWorkerThreadCount(4);
+		reader3MF->ReadFromFile(sTestFilesPath + "/Reader/" + "cam_51476_test.3mf");
+		CheckReaderWarnings(reader3MF, 0);
+
+		auto reader = wrapper->CreateModel()->QueryReader("3mf");
+		reader->SetWorkerThreadCount(4);
+		ASSERT_SPECIFIC_THROW(reader->ReadFromFile(sTestFilesPath + "/Reader/" + "N_XXX_0422_01.3mf"), ELib3MFException);
+	}
+
+	struct MeshStreamData {
+		std::map<Lib3MF_uint32, std::vector<sLib3MFPosition>> m_Vertices;
+		std::map<Lib3MF_uint32, std::vector<sLib3MFTriangle>> m_Triangles;
+		Lib3MF_uint32 m_nBlockCount = 0;
+		bool m_bInOrder = true;
+	};
+
+	void StreamVertexBlock(Lib3MF_uint32 nUniqueResourceID, Lib3MF_uint32 nStartIndex, Lib3MF_uint64 nVerticesBufferSize, const sLib3MFPosition * pVerticesBuffer, Lib3MF_pvoid pUserData)
+	{
+		auto pData = (MeshStreamData *)pUserData;
+		auto & vctVertices = pData->m_Vertices[nUniqueResourceID];
+		pData->m_bInOrder = pData->m_bInOrder && (vctVertices.size() == nStartIndex);
+		vctVertices.insert(vctVertices.end(), pVerticesBuffer, pVerticesBuffer + nVerticesBufferSize);
+		pData->m_nBlockCount++;
+	}
+
+	void StreamTriangleBlock(Lib3MF_uint32 nUniqueResourceID, Lib3MF_uint32 nStartIndex, Lib3MF_uint64 nTrianglesBufferSize, const sLib3MFTriangle * pTrianglesBuffer, Lib3MF_pvoid pUserData)
+	{
+		auto pData = (MeshStreamData *)pUserData;
+		auto & vctTriangles = pData->m_Triangles[nUniqueResourceID];
+		pData->m_bInOrder = pData->m_bInOrder && (vctTriangles.size() == nStartIndex);
+		// all vertices of the mesh object must have been delivered before its triangles
+		for (Lib3MF_uint64 iTriangle = 0; iTriangle < nTrianglesBufferSize; iTriangle++)
+			for (int iIndex = 0; iIndex < 3; iIndex++)
+				pData->m_bInOrder = pData->m_bInOrder && (pTrianglesBuffer[iTriangle].m_Indices[iIndex] < pData->m_Vertices[nUniqueResourceID].size());
+		vctTriangles.insert(vctTriangles.end(), pTrianglesBuffer, pTrianglesBuffer + nTrianglesBufferSize);
+		pData->m_nBlockCount++;
+	}
+
+	TEST_F(Reader, 3MFReadWithMeshStreamCallbacks)
+	{
+		// The grid is large enough to be delivered in several blocks.
+		auto sourceModel = wrapper->CreateModel();
+		auto sourceMesh = sourceModel->AddMeshObject();
+		const Lib3MF_uint32 nGridSize = 300;
+		std::vector<sLib3MFPosition> vctVertices;
+		std::vector<sLib3MFTriangle> vctTriangles;
+		for (Lib3MF_uint32 nY = 0; nY < nGridSize; nY++) {
+			for (Lib3MF_uint32 nX = 0; nX < nGridSize; nX++) {
+				sLib3MFPosition position = { { nX * 0.25f, nY * 0.5f, (nX * nY % 7) * 0.125f } };
+				vctVertices.push_back(position);
+				if ((nX > 0) && (nY > 0)) {
+					Lib3MF_uint32 nIndex = nY * nGridSize + nX;
+					vctTriangles.push_back({ { nIndex - nGridSize - 1, nIndex - nGridSize, nIndex } });
+					vctTriangles.push_back({ { nIndex - nGridSize - 1, nIndex, nIndex - 1 } });
+				}
+			}
+		}
+		sourceMesh->SetGeometry(vctVertices, vctTriangles);
+		sourceModel->AddBuildItem(sourceMesh.get(), wrapper->GetIdentityTransform());
+		std::vector<sLib3MFPosition> vctBoxVertices;
+		std::vector<sLib3MFTriangle> vctBoxTriangles;
+		fnCreateBox(vctBoxVertices, vctBoxTriangles);
+		auto sourceBox = sourceModel->AddMeshObject();
+		sourceBox->SetGeometry(vctBoxVertices, vctBoxTriangles);
+		sourceModel->AddBuildItem(sourceBox.get(), wrapper->GetIdentityTransform());
+		std::vector<Lib3MF_uint8> buffer;
+		sourceModel->QueryWriter("3mf")->WriteToBuffer(buffer);
+
+		MeshStreamData streamData;
+		reader3MF->SetWorkerThreadCount(2);
+		reader3MF->SetMeshStreamCallbacks(StreamVertexBlock, StreamTriangleBlock, false, &streamData);
+		reader3MF->ReadFromBuffer(buffer);
+		CheckReaderWarnings(reader3MF, 0);
+
+		ASSERT_TRUE(streamData.m_bInOrder);
+		ASSERT_GT(streamData.m_nBlockCount, 4u);
+		ASSERT_EQ(streamData.m_Vertices.size(), 2u);
+		ASSERT_EQ(streamData.m_Triangles.size(), 2u);
+
+		// The geometry is not retained, but objects and build items are
+		auto meshObjects = model->GetMeshObjects();
+		ASSERT_EQ(meshObjects->Count(), 2u);
+		ASSERT_EQ(model->GetBuildItems()->Count(), 2u);
+		while (meshObjects->MoveNext()) {
+			auto meshObject = meshObjects->GetCurrentMeshObject();
+			ASSERT_EQ(meshObject->GetVertexCount(), 0u);
+			ASSERT_EQ(meshObject->GetTriangleCount(), 0u);
+		}
+
+		// A retaining stream delivers the same data as the model
+		auto retainedModel = wrapper->CreateModel();
+		auto retainedReader = retainedModel->QueryReader("3mf");
+		MeshStreamData retainedData;
+		retainedReader->SetMeshStreamCallbacks(StreamVertexBlock, StreamTriangleBlock, true, &retainedData);
+		retainedReader->ReadFromBuffer(buffer);
+		CheckReaderWarnings(retainedReader, 0);
+		ASSERT_TRUE(retainedData.m_bInOrder);
+
+		auto retainedMeshes = retainedModel->GetMeshObjects();
+		ASSERT_EQ(retainedMeshes->Count(), 2u);
+		while (retainedMeshes->MoveNext()) {
+			auto meshObject = retainedMeshes->GetCurrentMeshObject();
+			std::vector<sLib3MFPosition> vctReadVertices;
+			std::vector<sLib3MFTriangle> vctReadTriangles;
+			meshObject->GetVertices(vctReadVertices);
+			meshObject->GetTriangleIndices(vctReadTriangles);
+
+			auto & vctStreamedVertices = retainedData.m_Vertices[meshObject->GetUniqueResourceID()];
+			auto & vctStreamedTriangles = retainedData.m_Triangles[meshObject->GetUniqueResourceID()];
+			ASSERT_EQ(vctStreamedVertices.size(), vctReadVertices.size());
+			ASSERT_EQ(vctStreamedTriangles.size(), vctReadTriangles.size());
+			for (size_t iVertex = 0; iVertex < vctReadVertices.size(); iVertex++)
+				for (int iCoordinate = 0; iCoordinate < 3; iCoordinate++)
+					ASSERT_EQ(vctStreamedVertices[iVertex].m_Coordinates[iCoordinate], vctReadVertices[iVertex].m_Coordinates[iCoordinate]);
+			for (size_t iTriangle = 0; iTriangle < vctReadTriangles.size(); iTriangle++)
+				for (int iIndex = 0; iIndex < 3; iIndex++)
+					ASSERT_EQ(vctStreamedTriangles[iTriangle].m_Indices[iIndex], vctReadTriangles[iTriangle].m_Indices[iIndex]);
+		}
+
+		// Both streams deliver identical data, and the grid is delivered unchanged
+		ASSERT_EQ(retainedData.m_Vertices.size(), streamData.m_Vertices.size());
+		auto iRetainedVertices = retainedData.m_Vertices.begin();
+		auto iRetainedTriangles = retainedData.m_Triangles.begin();
+		auto iTriangles = streamData.m_Triangles.begin();
+		bool bHasGrid = false;
+		for (auto iVertices = streamData.m_Vertices.begin(); iVertices != streamData.m_Vertices.end(); iVertices++, iRetainedVertices++, iTriangles++, iRetainedTriangles++) {
+			ASSERT_EQ(iVertices->second.size(), iRetainedVertices->second.size());
+			ASSERT_EQ(iTriangles->second.size(), iRetainedTriangles->second.size());
+			ASSERT_EQ(memcmp(iVertices->second.data(), iRetainedVertices->second.data(), iVertices->second.size() * sizeof(sLib3MFPosition)), 0);
+			ASSERT_EQ(memcmp(iTriangles->second.data(), iRetainedTriangles->second.data(), iTriangles->second.size() * sizeof(sLib3MFTriangle)), 0);
+			if (iVertices->second.size() == vctVertices.size()) {
+				bHasGrid = true;
+				ASSERT_EQ(memcmp(iVertices->second.data(), vctVertices.data(), vctVertices.size() * sizeof(sLib3MFPosition)), 0);
+				ASSERT_EQ(memcmp(iTriangles->second.data(), vctTriangles.data(), vctTriangles.size() * sizeof(sLib3MFTriangle)), 0);
+			}
+		}
+		ASSERT_TRUE(bHasGrid);
+	}
+
+	void CompareLazyMeshObjects(PModel eagerModel, PModel lazyModel)
+	{
+		auto eagerMeshes = eagerModel->GetMeshObjects();
+		auto lazyMeshes = lazyModel->GetMeshObjects();
+		ASSERT_EQ(eagerMeshes->Count(), lazyMeshes->Count());
+		while (eagerMeshes->MoveNext()) {
+			ASSERT_TRUE(lazyMeshes->MoveNext());
+			auto eagerMesh = eagerMeshes->GetCurrentMeshObject();
+			auto lazyMesh = lazyModel->GetMeshObjectByID(lazyMeshes->GetCurrentMeshObject()->GetUniqueResourceID());
+			ASSERT_TRUE(eagerMesh->IsGeometryLoaded());
+			ASSERT_FALSE(lazyMesh->IsGeometryLoaded());
+
+			std::vector<sLib3MFPosition> vctEagerVertices, vctLazyVertices;
+			std::vector<sLib3MFTriangle> vctEagerTriangles, vctLazyTriangles;
+			std::vector<sLib3MFTriangleProperties> vctEagerProperties, vctLazyProperties;
+			eagerMesh->GetVertices(vctEagerVertices);
+			lazyMesh->GetVertices(vctLazyVertices);
+			eagerMesh->GetTriangleIndices(vctEagerTriangles);
+			lazyMesh->GetTriangleIndices(vctLazyTriangles);
+			eagerMesh->GetAllTriangleProperties(vctEagerProperties);
+			lazyMesh->GetAllTriangleProperties(vctLazyProperties);
+
+			ASSERT_GT(vctLazyVertices.size(), 0u);
+			ASSERT_EQ(vctEagerVertices.size(), vctLazyVertices.size());
+			ASSERT_EQ(vctEagerTriangles.size(), vctLazyTriangles.size());
+			ASSERT_EQ(vctEagerProperties.size(), vctLazyProperties.size());
+			ASSERT_EQ(memcmp(vctEagerVertices.data(), vctLazyVertices.data(), vctLazyVertices.size() * sizeof(sLib3MFPosition)), 0);
+			ASSERT_EQ(memcmp(vctEagerTriangles.data(), vctLazyTriangles.data(), vctLazyTriangles.size() * sizeof(sLib3MFTriangle)), 0);
+			ASSERT_EQ(memcmp(vctEagerProperties.data(), vctLazyProperties.data(), vctLazyProperties.size() * sizeof(sLib3MFTriangleProperties)), 0);
+			ASSERT_EQ(eagerMesh->GetTriangleSetCount(), lazyMesh->GetTriangleSetCount());
+			ASSERT_EQ(eagerMesh->BeamLattice()->GetBeamCount(), lazyMesh->BeamLattice()->GetBeamCount());
+			ASSERT_TRUE(lazyMesh->IsGeometryLoaded());
+		}
+	}
+
+	TEST_F(Reader, 3MFReadWithLazyMeshLoading)
+	{
+		ASSERT_FALSE(reader3MF->GetLazyMeshLoadingActive());
+
+		auto sourceModel = wrapper->CreateModel();
+		std::vector<sLib3MFPosition> vctVertices;
+		std::vector<sLib3MFTriangle> vctTriangles;
+		fnCreateBox(vctVertices, vctTriangles);
+		auto sourceMesh = sourceModel->AddMeshObject();
+		sourceMesh->SetGeometry(vctVertices, vctTriangles);
+		auto colorGroup = sourceModel->AddColorGroup();
+		Lib3MF_uint32 nRed = colorGroup->AddColor(wrapper->RGBAToColor(255, 0, 0, 255));
+		Lib3MF_uint32 nGreen = colorGroup->AddColor(wrapper->RGBAToColor(0, 255, 0, 255));
+		std::vector<sLib3MFTriangleProperties> vctProperties(vctTriangles.size(), { colorGroup->GetResourceID(), { nRed, nGreen, nRed } });
+		sourceMesh->SetAllTriangleProperties(vctProperties);
+		sourceMesh->AddTriangleSet("top", "Top")->AddTriangle(0);
+		sourceMesh->BeamLattice()->AddBeam({ { 0, 6 }, { 1.0, 1.5 }, { eBeamLatticeCapMode::Sphere, eBeamLatticeCapMode::Butt } });
+		sourceModel->AddBuildItem(sourceMesh.get(), wrapper->GetIdentityTransform());
+		std::vector<Lib3MF_uint8> sourceBuffer;
+		sourceModel->QueryWriter("3mf")->WriteToBuffer(sourceBuffer);
+
+		std::vector<std::vector<Lib3MF_uint8>> buffers;
+		buffers.push_back(sourceBuffer);
+		buffers.push_back(ReadFileIntoBuffer(sTestFilesPath + "/Production/" + "2ProductionBoxes.3mf"));
+		buffers.push_back(ReadFileIntoBuffer(sTestFilesPath + "/Properties/" + "PyramidWithProperties.3mf"));
+		for (auto & buffer : buffers) {
+			auto eagerModel = wrapper->CreateModel();
+			auto eagerReader = eagerModel->QueryReader("3mf");
+			eagerReader->ReadFromBuffer(buffer);
+			CheckReaderWarnings(eagerReader, 0);
+
+			auto lazyModel = wrapper->CreateModel();
+			auto lazyReader = lazyModel->QueryReader("3mf");
+			lazyReader->SetLazyMeshLoadingActive(true);
+			ASSERT_TRUE(lazyReader->GetLazyMeshLoadingActive());
+			lazyReader->ReadFromBuffer(buffer);
+			CheckReaderWarnings(lazyReader, 0);
+
+			// The geometry is parsed from a copy of the model parts, not from the input buffer
+			std::fill(buffer.begin(), buffer.end(), (Lib3MF_uint8)0);
+			CompareLazyMeshObjects(eagerModel, lazyModel);
+
+			// A lazily read model can be written again
+			std::vector<Lib3MF_uint8> writtenBuffer;
+			lazyModel->QueryWriter("3mf")->WriteToBuffer(writtenBuffer);
+			ASSERT_GT(writtenBuffer.size(), 0u);
+		}
+	}
+
+	TEST_F(Reader, 3MFReadWithLazyMeshLoadingInArbitraryOrder)
+	{
+		// Several large meshes, so that the deflated model part spans many inflate checkpoints
+		const Lib3MF_uint32 nMeshCount = 6;
+		const Lib3MF_uint32 nGridSize = 150;
+		auto sourceModel = wrapper->CreateModel();
+		for (Lib3MF_uint32 nMesh = 0; nMesh < nMeshCount; nMesh++) {
+			std::vector<sLib3MFPosition> vctVertices;
+			std::vector<sLib3MFTriangle> vctTriangles;
+			for (Lib3MF_uint32 nY = 0; nY < nGridSize; nY++) {
+				for (Lib3MF_uint32 nX = 0; nX < nGridSize; nX++) {
+					vctVertices.push_back({ { nX * 0.5f, nY * 0.25f, nMesh + (nX * nY % 7) * 0.125f } });
+					if ((nX > 0) && (nY > 0)) {
+						Lib3MF_uint32 nIndex = nY * nGridSize + nX;
+						vctTriangles.push_back({ { nIndex - nGridSize - 1, nIndex - nGridSize, nIndex } });
+						vctTriangles.push_back({ { nIndex - nGridSize - 1, nIndex, nIndex - 1 } });
+					}
+				}
+			}
+			auto sourceMesh = sourceModel->AddMeshObject();
+			sourceMesh->SetGeometry(vctVertices, vctTriangles);
+			ASSERT_TRUE(sourceMesh->IsGeometryLoaded());
+			sourceModel->AddBuildItem(sourceMesh.get(), wrapper->GetIdentityTransform());
+		}
+		std::vector<Lib3MF_uint8> buffer;
+		sourceModel->QueryWriter("3mf")->WriteToBuffer(buffer);
+
+		auto eagerModel = wrapper->CreateModel();
+		eagerModel->QueryReader("3mf")->ReadFromBuffer(buffer);
+
+		auto lazyModel = wrapper->CreateModel();
+		auto lazyReader = lazyModel->QueryReader("3mf");
+		lazyReader->SetLazyMeshLoadingActive(true);
+		lazyReader->ReadFromBuffer(buffer);
+		CheckReaderWarnings(lazyReader, 0);
+
+		std::vector<Lib3MF_uint32> vctResourceIDs;
+		auto lazyMeshes = lazyModel->GetMeshObjects();
+		while (lazyMeshes->MoveNext())
+			vctResourceIDs.push_back(lazyMeshes->GetCurrentMeshObject()->GetUniqueResourceID());
+		ASSERT_EQ(vctResourceIDs.size(), nMeshCount);
+
+		// Meshes are loaded one by one, backwards and forwards through the part, the others stay unloaded
+		std::vector<Lib3MF_uint32> vctOrder = { 4, 1, 5, 0, 3, 2 };
+		for (size_t nStep = 0; nStep < vctOrder.size(); nStep++) {
+			auto lazyMesh = lazyModel->GetMeshObjectByID(vctResourceIDs[vctOrder[nStep]]);
+			auto eagerMesh = eagerModel->GetMeshObjectByID(vctResourceIDs[vctOrder[nStep]]);
+			ASSERT_FALSE(lazyMesh->IsGeometryLoaded());
+
+			std::vector<sLib3MFPosition> vctEagerVertices, vctLazyVertices;
+			std::vector<sLib3MFTriangle> vctEagerTriangles, vctLazyTriangles;
+			eagerMesh->GetVertices(vctEagerVertices);
+			lazyMesh->GetVertices(vctLazyVertices);
+			eagerMesh->GetTriangleIndices(vctEagerTriangles);
+			lazyMesh->GetTriangleIndices(vctLazyTriangles);
+			ASSERT_TRUE(lazyMesh->IsGeometryLoaded());
+			ASSERT_EQ(vctLazyVertices.size(), (size_t)(nGridSize * nGridSize));
+			ASSERT_EQ(vctEagerVertices.size(), vctLazyVertices.size());
+			ASSERT_EQ(vctEagerTriangles.size(), vctLazyTriangles.size());
+			ASSERT_EQ(memcmp(vctEagerVertices.data(), vctLazyVertices.data(), vctLazyVertices.size() * sizeof(sLib3MFPosition)), 0);
+			ASSERT_EQ(memcmp(vctEagerTriangles.data(), vctLazyTriangles.data(), vctLazyTriangles.size() * sizeof(sLib3MFTriangle)), 0);
+
+			for (size_t nOther = nStep + 1; nOther < vctOrder.size(); nOther++)
+				ASSERT_FALSE(lazyModel->GetMeshObjectByID(vctResourceIDs[vctOrder[nOther]])->IsGeometryLoaded());
+		}
+	}
+}
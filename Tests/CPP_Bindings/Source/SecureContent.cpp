@@ -642,6 +642,49 @@ namespace Lib3MF {
 		}
 	}
 
+	TEST_F(SecureContentT, WriteCompressionLevelOfEncryptedParts) {
+		readKeyStore(UNENCRYPTEDCOMPRESSEDKEYSTORE);
+		std::string sPartPath = model->GetKeyStore()->GetResourceData(0)->GetPath()->GetPath();
+		sPartPath.erase(0, sPartPath.find_first_not_of('/'));
+
+		auto writer = model->QueryWriter("3mf");
+		DEKCallbackData contentData;
+		writer->SetContentEncryptionCallback(testDEKCallback, (Lib3MF_pvoid)&contentData);
+
+		// Without a level, encrypted parts keep their deflated ZIP entry
+		std::vector<Lib3MF_uint8> defaultBuffer;
+		writer->WriteToBuffer(defaultBuffer);
+		Lib3MF_uint32 nMethod = 0;
+		std::vector<Lib3MF_uint8> defaultEntry;
+		GetZIPEntryData(defaultBuffer, sPartPath, nMethod, defaultEntry);
+		ASSERT_EQ(nMethod, 8u);
+
+		// A level applies to the deflate stream within the encryption, the ZIP entry is stored
+		writer->SetCompressionLevel(ePackagePartType::Model, eCompressionLevel::Maximum);
+		std::vector<Lib3MF_uint8> maximumBuffer;
+		writer->WriteToBuffer(maximumBuffer);
+		std::vector<Lib3MF_uint8> maximumEntry;
+		GetZIPEntryData(maximumBuffer, sPartPath, nMethod, maximumEntry);
+		ASSERT_EQ(nMethod, 0u);
+
+		writer->SetCompressionLevel(ePackagePartType::Model, eCompressionLevel::Stored);
+		std::vector<Lib3MF_uint8> storedBuffer;
+		writer->WriteToBuffer(storedBuffer);
+		std::vector<Lib3MF_uint8> storedEntry;
+		GetZIPEntryData(storedBuffer, sPartPath, nMethod, storedEntry);
+		ASSERT_EQ(nMethod, 0u);
+		ASSERT_LT(maximumEntry.size(), storedEntry.size());
+
+		for (auto buffer : { defaultBuffer, maximumBuffer, storedBuffer }) {
+			PModel readModel = wrapper->CreateModel();
+			PReader reader = readModel->QueryReader("3mf");
+			DEKCallbackData dekData;
+			reader->SetContentEncryptionCallback(testDEKCallback, (Lib3MF_pvoid)&dekData);
+			reader->ReadFromBuffer(buffer);
+			ASSERT_EQ(readModel->GetMeshObjects()->Count(), model->GetMeshObjects()->Count());
+		}
+	}
+
 	TEST_F(SecureContentT, MakeExistingModelEncrypted) {
 		generateTestFiles(false, "keystore.3mf");
 		generateTestFiles(true, "keystore_compressed.3mf");
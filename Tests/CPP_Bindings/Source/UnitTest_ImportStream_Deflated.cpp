@@ -0,0 +1,296 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+UnitTest_ImportStream_Deflated.cpp: Unit tests of seeking in the internal class CImportStream_Deflated
+
+--*/
+
+#include "gtest/gtest.h"
+
+#include "Common/Platform/NMR_ImportStream_Deflated.h"
+#include "Common/NMR_Exception.h"
+#include "zlib.h"
+
+#include <random>
+#include <string>
+#include <string.h>
+#include <vector>
+
+namespace Lib3MF
+{
+	using namespace NMR;
+
+	class ImportStreamDeflated : public ::testing::Test {
+	protected:
+		static std::vector<nfByte> m_Data;
+		static PDeflatedData m_pDeflatedData;
+		static nfUint32 m_nCRC32;
+
+		static void SetUpTestCase()
+		{
+			// XML-like text of several megabytes, which is deflated into many blocks
+			std::mt19937 generator(4711);
+			std::string sData;
+			while (sData.size() < 6 * IMPORTSTREAM_DEFLATED_CHECKPOINTSPAN) {
+				sData += "<vertex x=\"" + std::to_string(generator() % 100000) + "\" y=\"" + std::to_string(generator() % 1000) +
+					"\" z=\"" + std::to_string(generator() % 10) + "\"/>\n";
+			}
+			m_Data.assign(sData.begin(), sData.end());
+			m_pDeflatedData = std::make_shared<std::vector<nfByte>>(Deflate(m_Data));
+			m_nCRC32 = (nfUint32)crc32(0, m_Data.data(), (uInt)m_Data.size());
+		}
+
+		static void TearDownTestCase()
+		{
+			m_Data.clear();
+			m_pDeflatedData.reset();
+		}
+
+		static std::vector<nfByte> Deflate(const std::vector<nfByte> & Data)
+		{
+			z_stream Stream;
+			memset(&Stream, 0, sizeof(Stream));
+			EXPECT_EQ(deflateInit2(&Stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY), Z_OK);
+			std::vector<nfByte> Deflated(deflateBound(&Stream, (uLong)Data.size()));
+			Stream.next_in = (Bytef *)Data.data();
+			Stream.avail_in = (uInt)Data.size();
+			Stream.next_out = Deflated.data();
+			Stream.avail_out = (uInt)Deflated.size();
+			EXPECT_EQ(deflate(&Stream, Z_FINISH), Z_STREAM_END);
+			Deflated.resize(Stream.total_out);
+			deflateEnd(&Stream);
+			return Deflated;
+		}
+
+		static PImportStream_Deflated CreateStream()
+		{
+			return std::make_shared<CImportStream_Deflated>(m_pDeflatedData, m_Data.size(), m_nCRC32);
+		}
+
+		// Reads cbCount bytes at the current position and compares them with the original data
+		static void ExpectData(CImportStream * pStream, nfUint64 cbCount)
+		{
+			nfUint64 nPosition = pStream->getPosition();
+			ASSERT_LE(nPosition + cbCount, m_Data.size());
+			std::vector<nfByte> Buffer((size_t)cbCount);
+			ASSERT_EQ(pStream->readIntoBuffer(Buffer.data(), cbCount, true), cbCount);
+			ASSERT_TRUE(memcmp(Buffer.data(), m_Data.data() + nPosition, (size_t)cbCount) == 0) << "at position " << nPosition;
+			ASSERT_EQ(pStream->getPosition(), nPosition + cbCount);
+		}
+	};
+
+	std::vector<nfByte> ImportStreamDeflated::m_Data;
+	PDeflatedData ImportStreamDeflated::m_pDeflatedData;
+	nfUint32 ImportStreamDeflated::m_nCRC32;
+
+	TEST_F(ImportStreamDeflated, SequentialReadMatchesFullInflate)
+	{
+		// One-shot inflate as reference
+		std::vector<nfByte> Inflated(m_Data.size());
+		z_stream Stream;
+		memset(&Stream, 0, sizeof(Stream));
+		ASSERT_EQ(inflateInit2(&Stream, -MAX_WBITS), Z_OK);
+		Stream.next_in = (Bytef *)m_pDeflatedData->data();
+		Stream.avail_in = (uInt)m_pDeflatedData->size();
+		Stream.next_out = Inflated.data();
+		Stream.avail_out = (uInt)Inflated.size();
+		ASSERT_EQ(inflate(&Stream, Z_FINISH), Z_STREAM_END);
+		inflateEnd(&Stream);
+		ASSERT_EQ(Inflated, m_Data);
+
+		auto pStream = CreateStream();
+		ASSERT_EQ(pStream->retrieveSize(), m_Data.size());
+		std::vector<nfByte> Buffer(m_Data.size());
+		nfUint64 cbRead = 0;
+		nfUint64 cbChunk = 1;
+		while (cbRead < Buffer.size()) {
+			cbChunk = std::min((cbChunk * 7) % 100003 + 1, (nfUint64)Buffer.size() - cbRead);
+			ASSERT_EQ(pStream->readIntoBuffer(Buffer.data() + cbRead, cbChunk, true), cbChunk);
+			cbRead += cbChunk;
+		}
+		ASSERT_EQ(Buffer, Inflated);
+
+		// Reading at the end returns nothing
+		nfByte nByte;
+		ASSERT_EQ(pStream->readIntoBuffer(&nByte, 1, false), 0u);
+		ASSERT_THROW(pStream->readIntoBuffer(&nByte, 1, true), CNMRException);
+
+		// A checkpoint is recorded about every megabyte at a block boundary
+		ASSERT_GE(pStream->getCheckpointCount(), 4u);
+		ASSERT_EQ(pStream->getCheckpointPosition(0), 0u);
+		for (nfUint32 nIndex = 1; nIndex < pStream->getCheckpointCount(); nIndex++)
+			ASSERT_GE(pStream->getCheckpointPosition(nIndex), pStream->getCheckpointPosition(nIndex - 1) + IMPORTSTREAM_DEFLATED_CHECKPOINTSPAN);
+	}
+
+	TEST_F(ImportStreamDeflated, SeekAroundCheckpoints)
+	{
+		auto pStream = CreateStream();
+		pStream->seekFromEnd(0, true);
+		ASSERT_EQ(pStream->getPosition(), m_Data.size());
+		nfUint32 nCheckpointCount = pStream->getCheckpointCount();
+		ASSERT_GE(nCheckpointCount, 4u);
+
+		// Seek backwards through all checkpoints, to right before, at and behind each of them.
+		// Reading across a checkpoint continues with the following block.
+		for (nfUint32 nIndex = nCheckpointCount - 1; nIndex > 0; nIndex--) {
+			nfUint64 nCheckpoint = pStream->getCheckpointPosition(nIndex);
+			for (nfUint64 nPosition : { nCheckpoint + 1, nCheckpoint, nCheckpoint - 1, nCheckpoint - 40000 }) {
+				ASSERT_TRUE(pStream->seekPosition(nPosition, true));
+				ASSERT_EQ(pStream->getPosition(), nPosition);
+				ExpectData(pStream.get(), 70000);
+			}
+		}
+
+		// Forward from the current position, within the span of one checkpoint and beyond the last one
+		nfUint64 nLastCheckpoint = pStream->getCheckpointPosition(nCheckpointCount - 1);
+		ASSERT_TRUE(pStream->seekPosition(100, true));
+		ExpectData(pStream.get(), 100);
+		ASSERT_TRUE(pStream->seekPosition(50000, true));
+		ExpectData(pStream.get(), 1000);
+		ASSERT_TRUE(pStream->seekPosition(nLastCheckpoint + 12345, true));
+		ExpectData(pStream.get(), 1000);
+		ASSERT_TRUE(pStream->seekPosition(m_Data.size() - 10, true));
+		ExpectData(pStream.get(), 10);
+		ASSERT_TRUE(pStream->seekPosition(0, true));
+		ExpectData(pStream.get(), 10);
+
+		// Further seeks do not record checkpoints twice
+		ASSERT_EQ(pStream->getCheckpointCount(), nCheckpointCount);
+	}
+
+	TEST_F(ImportStreamDeflated, SeekBeforeAnyRead)
+	{
+		// Checkpoints are recorded while the first seek skips the data
+		auto pStream = CreateStream();
+		ASSERT_TRUE(pStream->seekPosition(0, true));
+		ASSERT_EQ(pStream->getCheckpointCount(), 0u);
+
+		nfUint64 nPosition = m_Data.size() - 3 * IMPORTSTREAM_DEFLATED_CHECKPOINTSPAN / 2;
+		ASSERT_TRUE(pStream->seekPosition(nPosition, true));
+		ASSERT_GE(pStream->getCheckpointCount(), 3u);
+		ExpectData(pStream.get(), 5000);
+
+		ASSERT_TRUE(pStream->seekPosition(17, true));
+		ExpectData(pStream.get(), 5000);
+	}
+
+	TEST_F(ImportStreamDeflated, SeekFromEndAndForward)
+	{
+		auto pStream = CreateStream();
+		ASSERT_TRUE(pStream->seekFromEnd(1000, true));
+		ASSERT_EQ(pStream->getPosition(), m_Data.size() - 1000);
+		ExpectData(pStream.get(), 1000);
+
+		ASSERT_TRUE(pStream->seekFromEnd(m_Data.size(), true));
+		ASSERT_EQ(pStream->getPosition(), 0u);
+		ASSERT_TRUE(pStream->seekForward(2 * IMPORTSTREAM_DEFLATED_CHECKPOINTSPAN + 3, true));
+		ASSERT_EQ(pStream->getPosition(), 2 * IMPORTSTREAM_DEFLATED_CHECKPOINTSPAN + 3);
+		ExpectData(pStream.get(), 3000);
+		ASSERT_TRUE(pStream->seekForward(0, true));
+		ExpectData(pStream.get(), 3000);
+
+		ASSERT_TRUE(pStream->seekFromEnd(IMPORTSTREAM_DEFLATED_CHECKPOINTSPAN + 1, true));
+		ASSERT_TRUE(pStream->seekForward(IMPORTSTREAM_DEFLATED_CHECKPOINTSPAN, true));
+		ExpectData(pStream.get(), 1);
+		ASSERT_EQ(pStream->getPosition(), m_Data.size());
+
+		// Seeking outside of the data fails, without moving the stream
+		ASSERT_FALSE(pStream->seekFromEnd(m_Data.size() + 1, false));
+		ASSERT_FALSE(pStream->seekForward(1, false));
+		ASSERT_FALSE(pStream->seekPosition(m_Data.size() + 1, false));
+		ASSERT_THROW(pStream->seekForward(1, true), CNMRException);
+		ASSERT_EQ(pStream->getPosition(), m_Data.size());
+	}
+
+	TEST_F(ImportStreamDeflated, RandomSeeksMatchData)
+	{
+		auto pStream = CreateStream();
+		std::mt19937 generator(815);
+		for (int nStep = 0; nStep < 200; nStep++) {
+			nfUint64 nPosition = generator() % m_Data.size();
+			nfUint64 cbCount = std::min((nfUint64)(generator() % 20000), m_Data.size() - nPosition);
+			ASSERT_TRUE(pStream->seekPosition(nPosition, true));
+			ExpectData(pStream.get(), cbCount);
+		}
+	}
+
+	TEST_F(ImportStreamDeflated, CopiesShareTheDeflatedData)
+	{
+		auto pStream = CreateStream();
+		PImportStream pCopy = pStream->copyToMemory();
+		CImportStream_Deflated * pDeflatedCopy = dynamic_cast<CImportStream_Deflated *>(pCopy.get());
+		ASSERT_TRUE(pDeflatedCopy != nullptr);
+		ASSERT_EQ(&pDeflatedCopy->getDeflatedData(), m_pDeflatedData.get());
+		ASSERT_EQ(pDeflatedCopy->getCRC32(), m_nCRC32);
+
+		// A copy behind the start holds the rest of the data
+		ASSERT_TRUE(pStream->seekFromEnd(5000, true));
+		pCopy = pStream->copyToMemory();
+		ASSERT_TRUE(dynamic_cast<CImportStream_Deflated *>(pCopy.get()) == nullptr);
+		ASSERT_EQ(pCopy->retrieveSize(), 5000u);
+		std::vector<nfByte> Buffer(5000);
+		pCopy->readIntoBuffer(Buffer.data(), 5000, true);
+		ASSERT_TRUE(memcmp(Buffer.data(), m_Data.data() + m_Data.size() - 5000, 5000) == 0);
+	}
+
+	TEST_F(ImportStreamDeflated, EmptyData)
+	{
+		std::vector<nfByte> Empty;
+		auto pStream = std::make_shared<CImportStream_Deflated>(std::make_shared<std::vector<nfByte>>(Deflate(Empty)), 0, (nfUint32)crc32(0, nullptr, 0));
+		nfByte nByte;
+		ASSERT_EQ(pStream->readIntoBuffer(&nByte, 1, false), 0u);
+		ASSERT_TRUE(pStream->seekFromEnd(0, true));
+		ASSERT_FALSE(pStream->seekPosition(1, false));
+	}
+
+	TEST_F(ImportStreamDeflated, CorruptDataIsDetected)
+	{
+		std::vector<nfByte> Buffer(m_Data.size());
+
+		// A wrong checksum is reported once all of the data has been inflated
+		auto pStream = std::make_shared<CImportStream_Deflated>(m_pDeflatedData, m_Data.size(), m_nCRC32 ^ 1);
+		ASSERT_TRUE(pStream->seekPosition(m_Data.size() / 2, true));
+		ASSERT_THROW(pStream->readIntoBuffer(Buffer.data(), m_Data.size() - m_Data.size() / 2, true), CNMRException);
+
+		// Truncated deflate data
+		auto pTruncated = std::make_shared<std::vector<nfByte>>(m_pDeflatedData->begin(), m_pDeflatedData->begin() + m_pDeflatedData->size() / 2);
+		pStream = std::make_shared<CImportStream_Deflated>(pTruncated, m_Data.size(), m_nCRC32);
+		ASSERT_THROW(pStream->readIntoBuffer(Buffer.data(), m_Data.size(), true), CNMRException);
+
+		// The deflate stream ends before the size of the entry is reached
+		pStream = std::make_shared<CImportStream_Deflated>(m_pDeflatedData, m_Data.size() + 1, m_nCRC32);
+		ASSERT_THROW(pStream->seekFromEnd(0, true), CNMRException);
+
+		// Invalid block type right at the start
+		auto pInvalid = std::make_shared<std::vector<nfByte>>(*m_pDeflatedData);
+		(*pInvalid)[0] = 0x07;
+		pStream = std::make_shared<CImportStream_Deflated>(pInvalid, m_Data.size(), m_nCRC32);
+		ASSERT_THROW(pStream->readIntoBuffer(Buffer.data(), 100, true), CNMRException);
+	}
+
+}
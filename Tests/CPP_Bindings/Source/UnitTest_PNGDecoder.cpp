@@ -0,0 +1,164 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+UnitTest_PNGDecoder.cpp: Unit tests of the PNG decoder of image stack sheets.
+The fixtures in TestFiles/Volumetric/PNG are 13 x 11 pixels. Their pixels follow
+the formulas below, every scanline uses another filter type, and the image data is
+split over two IDAT chunks.
+
+--*/
+
+#include "gtest/gtest.h"
+#include "UnitTest_Utilities.h"
+
+#include "Common/NMR_PNGDecoder.h"
+#include "Common/NMR_Exception.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Lib3MF
+{
+	using namespace NMR;
+
+	const nfUint32 PNG_FIXTURE_WIDTH = 13;
+	const nfUint32 PNG_FIXTURE_HEIGHT = 11;
+
+	class PNGDecoder : public ::testing::Test {
+	protected:
+		static void Decode(const std::string & sFileName, sPNGImage & Image)
+		{
+			std::vector<Lib3MF_uint8> Buffer = ReadFileIntoBuffer(sTestFilesPath + "/Volumetric/PNG/" + sFileName);
+			ASSERT_GT(Buffer.size(), 0u);
+			fnDecodePNG(Buffer.data(), Buffer.size(), Image);
+		}
+
+		static void CheckImage(const std::string & sFileName, nfUint32 nChannelCount, nfUint32 nBitDepth,
+			std::function<std::vector<nfUint32>(nfUint32 nX, nfUint32 nY)> fnExpected)
+		{
+			sPNGImage Image;
+			Decode(sFileName, Image);
+			ASSERT_EQ(Image.m_nWidth, PNG_FIXTURE_WIDTH);
+			ASSERT_EQ(Image.m_nHeight, PNG_FIXTURE_HEIGHT);
+			ASSERT_EQ(Image.m_nChannelCount, nChannelCount);
+			ASSERT_EQ(Image.m_nBitDepth, nBitDepth);
+			ASSERT_EQ(Image.m_Samples.size(), (size_t)PNG_FIXTURE_WIDTH * PNG_FIXTURE_HEIGHT * nChannelCount);
+
+			for (nfUint32 nY = 0; nY < PNG_FIXTURE_HEIGHT; nY++) {
+				for (nfUint32 nX = 0; nX < PNG_FIXTURE_WIDTH; nX++) {
+					std::vector<nfUint32> Expected = fnExpected(nX, nY);
+					ASSERT_EQ(Expected.size(), nChannelCount);
+					for (nfUint32 nChannel = 0; nChannel < nChannelCount; nChannel++)
+						ASSERT_EQ(Image.m_Samples[((size_t)nY * PNG_FIXTURE_WIDTH + nX) * nChannelCount + nChannel], Expected[nChannel])
+							<< sFileName << ": pixel (" << nX << ", " << nY << "), channel " << nChannel;
+				}
+			}
+		}
+
+		static void CheckInvalid(const std::string & sFileName)
+		{
+			sPNGImage Image;
+			try {
+				Decode(sFileName, Image);
+				FAIL() << sFileName << " was decoded";
+			}
+			catch (CNMRException & Exception) {
+				ASSERT_EQ(Exception.getErrorCode(), NMR_ERROR_INVALIDPNGIMAGE);
+			}
+		}
+	};
+
+	TEST_F(PNGDecoder, PaletteWithTransparency)
+	{
+		// 4 bit indices into 16 colors, the first 5 of them with alpha
+		const nfUint32 Alpha[5] = { 0, 60, 120, 180, 240 };
+		CheckImage("palette_trns_4bit.png", 4, 8, [&](nfUint32 nX, nfUint32 nY) {
+			nfUint32 nIndex = (nX * 3 + nY * 5) % 16;
+			return std::vector<nfUint32>({ nIndex * 17, 255 - nIndex * 13, (nIndex * nIndex * 7) % 256, (nIndex < 5) ? Alpha[nIndex] : 255 });
+		});
+	}
+
+	TEST_F(PNGDecoder, GrayLowBitDepths)
+	{
+		// Scaled to 8 bit, rows end within a byte
+		for (nfUint32 nBitDepth : { 1, 2, 4 }) {
+			nfUint32 nMaxValue = (1 << nBitDepth) - 1;
+			CheckImage("gray_" + std::to_string(nBitDepth) + "bit.png", 1, 8, [&](nfUint32 nX, nfUint32 nY) {
+				return std::vector<nfUint32>({ ((nX + 2 * nY) & nMaxValue) * 255 / nMaxValue });
+			});
+		}
+	}
+
+	TEST_F(PNGDecoder, GrayAlpha)
+	{
+		CheckImage("grayalpha_8bit.png", 2, 8, [](nfUint32 nX, nfUint32 nY) {
+			return std::vector<nfUint32>({ (nX * 19 + nY * 7) % 256, (nX * 5 + nY * 23) % 256 });
+		});
+	}
+
+	TEST_F(PNGDecoder, SixteenBit)
+	{
+		CheckImage("rgba_16bit.png", 4, 16, [](nfUint32 nX, nfUint32 nY) {
+			return std::vector<nfUint32>({ (nX * 4099 + nY * 257) % 65536, (nX * 31 + nY * 65000) % 65536, (nX * nY * 1031) % 65536, 65535 - nX * 1000 - nY * 100 });
+		});
+	}
+
+	TEST_F(PNGDecoder, Adam7Interlacing)
+	{
+		// With 13 x 11 pixels, every pass has a partial last block
+		CheckImage("rgba_8bit_adam7.png", 4, 8, [](nfUint32 nX, nfUint32 nY) {
+			return std::vector<nfUint32>({ (nX * 11 + nY) % 256, (nY * 13 + nX) % 256, (nX * nY) % 256, (255 - nX - nY * 3) % 256 });
+		});
+		CheckImage("gray_2bit_adam7.png", 1, 8, [](nfUint32 nX, nfUint32 nY) {
+			return std::vector<nfUint32>({ ((nX + 2 * nY) % 4) * 85 });
+		});
+	}
+
+	TEST_F(PNGDecoder, MalformedImages)
+	{
+		// The CRC of the second IDAT chunk has a flipped bit
+		CheckInvalid("invalid_crc.png");
+		// The image data ends after half of the deflated stream
+		CheckInvalid("truncated_idat.png");
+		// A single pixel refers to index 7 of a palette with 4 colors
+		CheckInvalid("palette_index_out_of_range.png");
+		// Palette color type without a PLTE chunk
+		CheckInvalid("missing_plte.png");
+	}
+
+	TEST_F(PNGDecoder, TruncatedFile)
+	{
+		std::vector<Lib3MF_uint8> Buffer = ReadFileIntoBuffer(sTestFilesPath + "/Volumetric/PNG/gray_4bit.png");
+		sPNGImage Image;
+		for (size_t cbSize = 0; cbSize < Buffer.size(); cbSize++)
+			ASSERT_THROW(fnDecodePNG(Buffer.data(), cbSize, Image), CNMRException) << cbSize << " bytes";
+		fnDecodePNG(Buffer.data(), Buffer.size(), Image);
+	}
+
+}
@@ -0,0 +1,184 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+UnitTest_StringUtils.cpp: Unit tests of the SWAR decimal parser in NMR_StringUtils
+
+--*/
+
+#include "gtest/gtest.h"
+
+#include "Common/NMR_StringUtils.h"
+#include "Common/NMR_Architecture_Utils.h"
+#include "Common/NMR_Exception.h"
+
+#include <cstdint>
+#include <string.h>
+#include <string>
+
+namespace Lib3MF
+{
+	using namespace NMR;
+
+	// Loads eight bytes the way a machine of the other byte order would see them
+	static nfUint64 LoadChunkWithForeignByteOrder(const std::string & sDigits)
+	{
+		nfUint64 nChunk;
+		memcpy(&nChunk, sDigits.c_str(), 8);
+		return swapBytes(nChunk);
+	}
+
+	TEST(StringUtils, ShortDecimalParsesOneToNineDigits)
+	{
+		std::string sDigits;
+		nfUint64 nExpected = 0;
+		for (nfUint32 nLength = 1; nLength <= 9; nLength++) {
+			nfChar cDigit = (nfChar)('0' + (nLength % 10));
+			sDigits += cDigit;
+			nExpected = nExpected * 10 + (nLength % 10);
+
+			nfUint32 nValue = 0;
+			ASSERT_TRUE(fnStringToShortDecimal(sDigits.c_str(), nLength, nValue)) << sDigits;
+			ASSERT_EQ(nValue, (nfUint32)nExpected);
+			ASSERT_EQ(fnStringToInt32(sDigits.c_str(), nLength), (nfInt32)nExpected);
+		}
+
+		nfUint32 nValue = 0;
+		ASSERT_TRUE(fnStringToShortDecimal("999999999", 9, nValue));
+		ASSERT_EQ(nValue, 999999999u);
+		ASSERT_TRUE(fnStringToShortDecimal("0", 1, nValue));
+		ASSERT_EQ(nValue, 0u);
+	}
+
+	TEST(StringUtils, ShortDecimalIgnoresBytesBeyondLength)
+	{
+		// Attribute values in the XML buffer are not zero-terminated
+		nfUint32 nValue = 0;
+		ASSERT_TRUE(fnStringToShortDecimal("4711\"/>", 4, nValue));
+		ASSERT_EQ(nValue, 4711u);
+		ASSERT_TRUE(fnStringToShortDecimal("123456789x", 9, nValue));
+		ASSERT_EQ(nValue, 123456789u);
+	}
+
+	TEST(StringUtils, ShortDecimalAcceptsLeadingZeros)
+	{
+		const char * Values[] = { "00", "000000000", "007", "000000042", "010", "00000001" };
+		const nfUint32 Expected[] = { 0, 0, 7, 42, 10, 1 };
+		for (size_t nIndex = 0; nIndex < sizeof(Expected) / sizeof(Expected[0]); nIndex++) {
+			nfUint32 nValue = 1234;
+			nfUint32 nLength = (nfUint32)strlen(Values[nIndex]);
+			ASSERT_TRUE(fnStringToShortDecimal(Values[nIndex], nLength, nValue)) << Values[nIndex];
+			ASSERT_EQ(nValue, Expected[nIndex]);
+			ASSERT_EQ(fnStringToInt32(Values[nIndex], nLength), (nfInt32)Expected[nIndex]);
+		}
+	}
+
+	TEST(StringUtils, ShortDecimalRejectsNonDigitAtEachPosition)
+	{
+		// Neighbours of the digit range catch off-by-one errors in the SWAR range check
+		const nfChar NonDigits[] = { '/', ':', ' ', '+', '-', '.', 'e', 'a', '\0', (nfChar)0x06, (nfChar)0x80, (nfChar)0xB0, (nfChar)0xF9, (nfChar)0xFF };
+		for (nfUint32 nLength = 1; nLength <= 9; nLength++) {
+			for (nfUint32 nPosition = 0; nPosition < nLength; nPosition++) {
+				for (nfChar cNonDigit : NonDigits) {
+					std::string sValue(nLength, '5');
+					sValue[nPosition] = cNonDigit;
+					nfUint32 nValue = 4711;
+					ASSERT_FALSE(fnStringToShortDecimal(sValue.c_str(), nLength, nValue))
+						<< "length " << nLength << ", position " << nPosition << ", char " << (int)(unsigned char)cNonDigit;
+					ASSERT_EQ(nValue, 4711u);
+				}
+			}
+		}
+	}
+
+	TEST(StringUtils, ShortDecimalRejectsOtherLengths)
+	{
+		nfUint32 nValue = 4711;
+		ASSERT_FALSE(fnStringToShortDecimal("", 0, nValue));
+		ASSERT_FALSE(fnStringToShortDecimal(nullptr, 3, nValue));
+		ASSERT_FALSE(fnStringToShortDecimal("1234567890", 10, nValue));
+		ASSERT_EQ(nValue, 4711u);
+	}
+
+	TEST(StringUtils, Int32ValuesAboveNineDigits)
+	{
+		// Longer values are parsed by the validating path, which checks the 32 bit range
+		ASSERT_EQ(fnStringToInt32("1000000000", 10), 1000000000);
+		ASSERT_EQ(fnStringToInt32("2147483647", 10), INT32_MAX);
+		ASSERT_EQ(fnStringToInt32("0000000000123", 13), 123);
+		ASSERT_EQ(fnStringToInt32("-2147483648", 11), INT32_MIN);
+		ASSERT_THROW(fnStringToInt32("2147483648", 10), CNMRException);
+		ASSERT_THROW(fnStringToInt32("4294967296", 10), CNMRException);
+		ASSERT_THROW(fnStringToInt32("9999999999", 10), CNMRException);
+		ASSERT_THROW(fnStringToInt32("-2147483649", 11), CNMRException);
+		ASSERT_THROW(fnStringToInt32("99999999999999999999", 20), CNMRException);
+
+		// Signs and trailing spaces fall back as well
+		ASSERT_EQ(fnStringToInt32("-12", 3), -12);
+		ASSERT_EQ(fnStringToInt32("+12", 3), 12);
+		ASSERT_EQ(fnStringToInt32("12 ", 3), 12);
+		ASSERT_THROW(fnStringToInt32("12a", 3), CNMRException);
+		ASSERT_THROW(fnStringToInt32("", 0), CNMRException);
+	}
+
+	TEST(StringUtils, DecimalChunkOfBothByteOrders)
+	{
+		const std::string Chunks[] = { "00000000", "12345678", "00004711", "99999999", "87654321" };
+		const nfUint32 Expected[] = { 0, 12345678, 4711, 99999999, 87654321 };
+		nfBool bBigEndian = isBigEndian();
+		for (size_t nIndex = 0; nIndex < sizeof(Expected) / sizeof(Expected[0]); nIndex++) {
+			nfUint64 nChunk;
+			memcpy(&nChunk, Chunks[nIndex].c_str(), 8);
+
+			nfUint32 nValue = 0;
+			ASSERT_TRUE(fnDecimalChunkToUint32(nChunk, bBigEndian, nValue)) << Chunks[nIndex];
+			ASSERT_EQ(nValue, Expected[nIndex]);
+
+			// The same bytes loaded on a machine of the other byte order
+			nValue = 0;
+			ASSERT_TRUE(fnDecimalChunkToUint32(LoadChunkWithForeignByteOrder(Chunks[nIndex]), !bBigEndian, nValue)) << Chunks[nIndex];
+			ASSERT_EQ(nValue, Expected[nIndex]);
+		}
+
+		// A wrong byte order reverses the digits, which is what the branch exists for
+		nfUint64 nChunk;
+		memcpy(&nChunk, "12345678", 8);
+		nfUint32 nValue = 0;
+		ASSERT_TRUE(fnDecimalChunkToUint32(nChunk, !bBigEndian, nValue));
+		ASSERT_EQ(nValue, 87654321u);
+
+		// Non-digits are rejected in every byte, whatever the byte order
+		for (nfUint32 nPosition = 0; nPosition < 8; nPosition++) {
+			std::string sChunk = "12345678";
+			sChunk[nPosition] = ':';
+			memcpy(&nChunk, sChunk.c_str(), 8);
+			ASSERT_FALSE(fnDecimalChunkToUint32(nChunk, bBigEndian, nValue)) << sChunk;
+			ASSERT_FALSE(fnDecimalChunkToUint32(LoadChunkWithForeignByteOrder(sChunk), !bBigEndian, nValue)) << sChunk;
+		}
+	}
+
+}
@@ -32,6 +32,7 @@ UnitTest_Utilities.cpp: Implementtion of Utilities for UnitTests
 
 
 #include "UnitTest_Utilities.h"
+#include "zlib.h"
 
 Lib3MF::PWrapper Lib3MFTest::wrapper;
 
@@ -452,3 +453,135 @@ void CheckReaderWarnings(Lib3MF::PReader reader, Lib3MF_uint32 nWarnings)
 		EXPECT_TRUE(true) << iWarning << ": " << nErrorCode << ", " << sWarning;
 	}
 }
+
+void GetZIPEntryData(std::vector<Lib3MF_uint8> const & buffer, std::string sName, Lib3MF_uint32 & nMethod, std::vector<Lib3MF_uint8> & compressedData)
+{
+	auto fnRead = [&buffer](size_t nOffset, size_t nBytes) {
+		Lib3MF_uint64 nValue = 0;
+		for (size_t nIndex = 0; nIndex < nBytes; nIndex++)
+			nValue |= (Lib3MF_uint64)buffer.at(nOffset + nIndex) << (8 * nIndex);
+		return nValue;
+	};
+
+	size_t nEndOfCentralDir = buffer.size() - 22;
+	while (fnRead(nEndOfCentralDir, 4) != 0x06054b50)
+		nEndOfCentralDir--;
+	size_t nHeader = (size_t)fnRead(nEndOfCentralDir + 16, 4);
+	Lib3MF_uint64 nEntryCount = fnRead(nEndOfCentralDir + 10, 2);
+	if ((nEndOfCentralDir >= 20) && (fnRead(nEndOfCentralDir - 20, 4) == 0x07064b50)) {
+		// ZIP64 end of central directory
+		size_t nZip64EndOfCentralDir = (size_t)fnRead(nEndOfCentralDir - 12, 8);
+		nEntryCount = fnRead(nZip64EndOfCentralDir + 32, 8);
+		nHeader = (size_t)fnRead(nZip64EndOfCentralDir + 48, 8);
+	}
+
+	for (; nEntryCount > 0; nEntryCount--) {
+		ASSERT_EQ(fnRead(nHeader, 4), 0x02014b50u);
+		size_t cbName = (size_t)fnRead(nHeader + 28, 2);
+		if (std::string(buffer.begin() + nHeader + 46, buffer.begin() + nHeader + 46 + cbName) == sName) {
+			nMethod = (Lib3MF_uint32)fnRead(nHeader + 10, 2);
+			Lib3MF_uint64 nCompressedSize = fnRead(nHeader + 20, 4);
+			Lib3MF_uint64 nLocalHeader = fnRead(nHeader + 42, 4);
+
+			// The ZIP64 extra field holds those values that do not fit, in the order
+			// uncompressed size, compressed size and local header offset
+			bool bSizeIsZip64 = (fnRead(nHeader + 24, 4) == 0xFFFFFFFF);
+			if ((nCompressedSize == 0xFFFFFFFF) || (nLocalHeader == 0xFFFFFFFF)) {
+				size_t nExtra = nHeader + 46 + cbName;
+				while (fnRead(nExtra, 2) != 0x0001)
+					nExtra += 4 + (size_t)fnRead(nExtra + 2, 2);
+				size_t nField = nExtra + 4 + (bSizeIsZip64 ? 8 : 0);
+				if (nCompressedSize == 0xFFFFFFFF) {
+					nCompressedSize = fnRead(nField, 8);
+					nField += 8;
+				}
+				if (nLocalHeader == 0xFFFFFFFF)
+					nLocalHeader = fnRead(nField, 8);
+			}
+
+			ASSERT_EQ(fnRead((size_t)nLocalHeader, 4), 0x04034b50u);
+			size_t nData = (size_t)nLocalHeader + 30 + (size_t)fnRead((size_t)nLocalHeader + 26, 2) + (size_t)fnRead((size_t)nLocalHeader + 28, 2);
+			ASSERT_LE(nData + nCompressedSize, buffer.size());
+			compressedData.assign(buffer.begin() + nData, buffer.begin() + nData + (size_t)nCompressedSize);
+			return;
+		}
+		nHeader += 46 + cbName + (size_t)fnRead(nHeader + 30, 2) + (size_t)fnRead(nHeader + 32, 2);
+	}
+	FAIL() << "ZIP entry " << sName << " not found";
+}
+
+std::vector<Lib3MF_uint8> Create3MFFromModelXML(std::string const & sModelXML)
+{
+	const std::vector<std::pair<std::string, std::string>> entries = {
+		{ "[Content_Types].xml",
+			"<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+			"<Types xmlns=\"http://schemas.openxmlformats.org/package/2006/content-types\">"
+			"<Default Extension=\"rels\" ContentType=\"application/vnd.openxmlformats-package.relationships+xml\"/>"
+			"<Default Extension=\"model\" ContentType=\"application/vnd.ms-package.3dmanufacturing-3dmodel+xml\"/>"
+			"</Types>" },
+		{ "_rels/.rels",
+			"<?xml version=\"1.0\" encoding=\"UTF-8\"?>"
+			"<Relationships xmlns=\"http://schemas.openxmlformats.org/package/2006/relationships\">"
+			"<Relationship Type=\"http://schemas.microsoft.com/3dmanufacturing/2013/01/3dmodel\" Target=\"/3D/3dmodel.model\" Id=\"rel0\"/>"
+			"</Relationships>" },
+		{ "3D/3dmodel.model", sModelXML }
+	};
+
+	std::vector<Lib3MF_uint8> buffer;
+	std::vector<Lib3MF_uint8> centralDirectory;
+	auto fnWrite = [](std::vector<Lib3MF_uint8> & target, Lib3MF_uint64 nValue, size_t nBytes) {
+		for (size_t nIndex = 0; nIndex < nBytes; nIndex++)
+			target.push_back((Lib3MF_uint8)(nValue >> (8 * nIndex)));
+	};
+
+	// All entries are stored, so that the reader sees the XML exactly as given
+	for (auto & entry : entries) {
+		const std::string & sName = entry.first;
+		const std::string & sData = entry.second;
+		Lib3MF_uint32 nCRC = (Lib3MF_uint32)crc32(0, (const Bytef *)sData.data(), (uInt)sData.size());
+		size_t nLocalHeader = buffer.size();
+
+		fnWrite(buffer, 0x04034b50, 4);
+		fnWrite(buffer, 20, 2);
+		fnWrite(buffer, 0, 2);
+		fnWrite(buffer, 0, 2);
+		fnWrite(buffer, 0, 4);
+		fnWrite(buffer, nCRC, 4);
+		fnWrite(buffer, sData.size(), 4);
+		fnWrite(buffer, sData.size(), 4);
+		fnWrite(buffer, sName.size(), 2);
+		fnWrite(buffer, 0, 2);
+		buffer.insert(buffer.end(), sName.begin(), sName.end());
+		buffer.insert(buffer.end(), sData.begin(), sData.end());
+
+		fnWrite(centralDirectory, 0x02014b50, 4);
+		fnWrite(centralDirectory, 20, 2);
+		fnWrite(centralDirectory, 20, 2);
+		fnWrite(centralDirectory, 0, 2);
+		fnWrite(centralDirectory, 0, 2);
+		fnWrite(centralDirectory, 0, 4);
+		fnWrite(centralDirectory, nCRC, 4);
+		fnWrite(centralDirectory, sData.size(), 4);
+		fnWrite(centralDirectory, sData.size(), 4);
+		fnWrite(centralDirectory, sName.size(), 2);
+		fnWrite(centralDirectory, 0, 2);
+		fnWrite(centralDirectory, 0, 2);
+		fnWrite(centralDirectory, 0, 2);
+		fnWrite(centralDirectory, 0, 2);
+		fnWrite(centralDirectory, 0, 4);
+		fnWrite(centralDirectory, nLocalHeader, 4);
+		centralDirectory.insert(centralDirectory.end(), sName.begin(), sName.end());
+	}
+
+	size_t nCentralDirectory = buffer.size();
+	buffer.insert(buffer.end(), centralDirectory.begin(), centralDirectory.end());
+	fnWrite(buffer, 0x06054b50, 4);
+	fnWrite(buffer, 0, 2);
+	fnWrite(buffer, 0, 2);
+	fnWrite(buffer, entries.size(), 2);
+	fnWrite(buffer, entries.size(), 2);
+	fnWrite(buffer, centralDirectory.size(), 4);
+	fnWrite(buffer, nCentralDirectory, 4);
+	fnWrite(buffer, 0, 2);
+	return buffer;
+}
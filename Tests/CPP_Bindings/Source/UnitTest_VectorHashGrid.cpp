@@ -0,0 +1,188 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+UnitTest_VectorHashGrid.cpp: Unit tests of the internal class CVectorHashGrid
+
+--*/
+
+#include "gtest/gtest.h"
+
+#include "Common/Math/NMR_VectorHashGrid.h"
+#include "Common/Math/NMR_Vector.h"
+#include "Common/NMR_Exception.h"
+
+#include <map>
+#include <random>
+#include <tuple>
+
+namespace Lib3MF
+{
+	using namespace NMR;
+
+	typedef std::tuple<nfInt32, nfInt32, nfInt32> GridKey;
+
+	static void CheckGrid(CVectorHashGrid & grid, const std::map<GridKey, nfUint32> & reference, const std::vector<GridKey> & removed)
+	{
+		ASSERT_EQ(grid.getCount(), (nfUint32)reference.size());
+		for (auto & iEntry : reference) {
+			nfUint32 nValue = 0;
+			ASSERT_TRUE(grid.findIntVector3(fnVEC3I_make(std::get<0>(iEntry.first), std::get<1>(iEntry.first), std::get<2>(iEntry.first)), nValue));
+			ASSERT_EQ(nValue, iEntry.second);
+		}
+		for (auto & key : removed) {
+			if (reference.find(key) != reference.end())
+				continue;
+			nfUint32 nValue = 0;
+			ASSERT_FALSE(grid.findIntVector3(fnVEC3I_make(std::get<0>(key), std::get<1>(key), std::get<2>(key)), nValue));
+		}
+	}
+
+	TEST(VectorHashGrid, RemoveShiftsProbeSequenceBack)
+	{
+		// Half of the minimum capacity is occupied, so that probe sequences collide and wrap around.
+		// Removing every single entry must keep all others reachable without tombstones.
+		const nfUint32 nEntryCount = NMR_VECTORHASHGRID_MINCAPACITY / 2;
+		std::vector<GridKey> keys;
+		for (nfUint32 nIndex = 0; nIndex < nEntryCount; nIndex++)
+			keys.push_back(GridKey(nIndex * 7, -(nfInt32)nIndex, nIndex % 3));
+
+		for (nfUint32 nRemoveFirst = 0; nRemoveFirst < nEntryCount; nRemoveFirst++) {
+			CVectorHashGrid grid;
+			grid.reserve(nEntryCount);
+			std::map<GridKey, nfUint32> reference;
+			for (nfUint32 nIndex = 0; nIndex < nEntryCount; nIndex++) {
+				grid.addIntVector3(fnVEC3I_make(std::get<0>(keys[nIndex]), std::get<1>(keys[nIndex]), std::get<2>(keys[nIndex])), nIndex);
+				reference[keys[nIndex]] = nIndex;
+			}
+
+			// Remove all entries, starting at a different one each time
+			for (nfUint32 nStep = 0; nStep < nEntryCount; nStep++) {
+				const GridKey & key = keys[(nRemoveFirst + nStep) % nEntryCount];
+				grid.removeIntVector3(fnVEC3I_make(std::get<0>(key), std::get<1>(key), std::get<2>(key)));
+				reference.erase(key);
+				CheckGrid(grid, reference, keys);
+			}
+		}
+	}
+
+	TEST(VectorHashGrid, RemoveMatchesReferenceMap)
+	{
+		// Random adds and removes within a fixed capacity, compared against std::map
+		const nfUint32 nMaxCount = 512;
+		CVectorHashGrid grid;
+		grid.reserve(nMaxCount);
+
+		std::mt19937 generator(4711);
+		std::uniform_int_distribution<nfInt32> coordinate(-12, 12);
+		std::map<GridKey, nfUint32> reference;
+		std::vector<GridKey> removed;
+
+		for (nfUint32 nStep = 0; nStep < 20000; nStep++) {
+			GridKey key(coordinate(generator), coordinate(generator), coordinate(generator));
+			NVEC3I vPosition = fnVEC3I_make(std::get<0>(key), std::get<1>(key), std::get<2>(key));
+			if ((reference.size() < nMaxCount) && (generator() % 2 == 0)) {
+				grid.addIntVector3(vPosition, nStep);
+				reference.insert(std::make_pair(key, nStep));
+			}
+			else {
+				grid.removeIntVector3(vPosition);
+				reference.erase(key);
+				removed.push_back(key);
+			}
+
+			if (nStep % 1000 == 0)
+				CheckGrid(grid, reference, removed);
+		}
+		CheckGrid(grid, reference, removed);
+	}
+
+	TEST(VectorHashGrid, GrowsBeyondReservation)
+	{
+		CVectorHashGrid grid;
+		grid.reserve(100);
+
+		std::map<GridKey, nfUint32> reference;
+		for (nfInt32 nIndex = 0; nIndex < 5000; nIndex++) {
+			GridKey key(nIndex % 17, nIndex / 17, -nIndex);
+			grid.addIntVector3(fnVEC3I_make(std::get<0>(key), std::get<1>(key), std::get<2>(key)), nIndex);
+			reference[key] = nIndex;
+
+			// Everything added so far stays reachable while the grid is rehashed
+			if ((nIndex == 99) || (nIndex == 100) || (nIndex == 4999))
+				CheckGrid(grid, reference, {});
+		}
+
+		// A smaller reservation never shrinks the grid, a larger one keeps all entries
+		grid.reserve(10);
+		CheckGrid(grid, reference, {});
+		grid.reserve(100000);
+		CheckGrid(grid, reference, {});
+
+		// Adding an existing position does not overwrite its value
+		grid.addIntVector3(fnVEC3I_make(0, 0, 0), 12345);
+		nfUint32 nValue = 1;
+		ASSERT_TRUE(grid.findIntVector3(fnVEC3I_make(0, 0, 0), nValue));
+		ASSERT_EQ(nValue, 0u);
+		ASSERT_EQ(grid.getCount(), 5000u);
+	}
+
+	TEST(VectorHashGrid, VectorsShareTheirUnitCell)
+	{
+		// Float vectors are identified by the cell of size fUnits they fall into, not by a distance
+		const nfFloat fUnits = 0.001f;
+		CVectorHashGrid grid(fUnits);
+		grid.addVector3({ { 1.0002f, 2.0002f, -3.0008f } }, 1);
+
+		nfUint32 nValue = 0;
+		ASSERT_TRUE(grid.findVector3({ { 1.0008f, 2.0001f, -3.0002f } }, nValue));
+		ASSERT_EQ(nValue, 1u);
+
+		// Closer than fUnits, but in the neighbouring cell
+		ASSERT_FALSE(grid.findVector3({ { 0.9998f, 2.0002f, -3.0008f } }, nValue));
+		ASSERT_FALSE(grid.findVector3({ { 1.0002f, 2.0002f, -2.9998f } }, nValue));
+		ASSERT_FALSE(grid.findVector3({ { 1.0002f, 2.0002f, -3.0012f } }, nValue));
+
+		// Negative coordinates are floored, not truncated towards zero
+		grid.addVector3({ { -0.0004f, 0.0f, 0.0f } }, 2);
+		ASSERT_TRUE(grid.findIntVector3(fnVEC3I_make(-1, 0, 0), nValue));
+		ASSERT_EQ(nValue, 2u);
+		ASSERT_FALSE(grid.findIntVector3(fnVEC3I_make(0, 0, 0), nValue));
+
+		// 2D vectors live in the z = 0 plane
+		grid.addVector2({ { 5.0005f, 6.0005f } }, 3);
+		ASSERT_TRUE(grid.findVector3({ { 5.0001f, 6.0009f, 0.0f } }, nValue));
+		ASSERT_EQ(nValue, 3u);
+		grid.removeVector2({ { 5.0009f, 6.0001f } });
+		ASSERT_FALSE(grid.findVector2({ { 5.0005f, 6.0005f } }, nValue));
+		ASSERT_EQ(grid.getCount(), 2u);
+
+		// Units are fixed once the grid holds vectors
+		ASSERT_THROW(grid.setUnits(0.01f), CNMRException);
+	}
+
+}
@@ -0,0 +1,202 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+UnitTest_XmlReader_Native.cpp: Unit tests of the buffering of the internal class CXmlReader_Native
+
+--*/
+
+#include "gtest/gtest.h"
+
+#include "Common/Platform/NMR_XmlReader_Native.h"
+#include "Common/Platform/NMR_ImportStream_Unique_Memory.h"
+#include "Common/3MF_ProgressMonitor.h"
+#include "Common/NMR_Exception.h"
+
+#include <string>
+#include <vector>
+
+namespace Lib3MF
+{
+	using namespace NMR;
+
+	class XmlReaderNative : public ::testing::Test {
+	protected:
+		// The smallest buffer makes the reader refill it as often as possible
+		static PXmlReader_Native CreateReader(const std::string & sDocument, nfUint32 cbBufferCapacity = NMR_NATIVEXMLREADER_MINBUFFERCAPACITY)
+		{
+			PImportStream pStream = std::make_shared<CImportStream_Unique_Memory>((const nfByte *)sDocument.data(), (nfUint64)sDocument.size());
+			return std::make_shared<CXmlReader_Native>(pStream, cbBufferCapacity, std::make_shared<CProgressMonitor>());
+		}
+
+		// Serializes the nodes with decoded attribute values and text, up to the end of the document
+		// or the start of the element sStopElement
+		static std::string ReadNodes(CXmlReader & Reader, const std::string & sStopElement = "")
+		{
+			std::string sNodes;
+			std::string sElement;
+			eXmlReaderNodeType NodeType;
+			const nfChar * pszName = nullptr;
+			const nfChar * pszValue = nullptr;
+			while (Reader.Read(NodeType)) {
+				switch (NodeType) {
+				case XMLREADERNODETYPE_STARTELEMENT:
+					Reader.GetLocalName(&pszName, nullptr);
+					sElement = pszName;
+					sNodes += "<" + sElement;
+					while (Reader.MoveToNextAttribute()) {
+						Reader.GetLocalName(&pszName, nullptr);
+						Reader.GetValue(&pszValue, nullptr);
+						sNodes += std::string(" ") + pszName + "=" + pszValue;
+					}
+					sNodes += ">";
+					if (sElement == sStopElement)
+						return sNodes;
+					break;
+				case XMLREADERNODETYPE_ENDELEMENT:
+					Reader.GetLocalName(&pszName, nullptr);
+					sNodes += std::string("</") + pszName + ">";
+					break;
+				case XMLREADERNODETYPE_TEXT:
+					Reader.GetValue(&pszValue, nullptr);
+					sNodes += pszValue;
+					break;
+				default:
+					sNodes += "?";
+				}
+			}
+			return sNodes;
+		}
+	};
+
+	TEST_F(XmlReaderNative, EscapesSplitAcrossBufferRefills)
+	{
+		const std::string sElement = "<e a=\"1&amp;2&lt;3&gt;4&quot;5&apos;6\">7&amp;8&lt;9&gt;0&quot;&apos;<!-- - &amp; --></e>";
+		const std::string sDecodedElement = "<e a=1&2<3>4\"5'6>7&8<9>0\"'</e>";
+
+		// The padding moves every byte of the escapes over the refill boundaries
+		for (size_t nPadding = 0; nPadding <= sElement.size(); nPadding++) {
+			std::string sDocument = "<root><pad v=\"" + std::string(nPadding, 'p') + "\"/>";
+			std::string sExpected = "<root><pad v=" + std::string(nPadding, 'p') + "></pad>";
+			for (int nIndex = 0; nIndex < 40; nIndex++) {
+				sDocument += sElement;
+				sExpected += sDecodedElement;
+			}
+			sDocument += "</root>";
+			sExpected += "</root>";
+
+			auto pReader = CreateReader(sDocument);
+			ASSERT_EQ(ReadNodes(*pReader), sExpected) << "padding " << nPadding;
+			ASSERT_TRUE(pReader->IsEOF());
+
+			// One buffer holds the whole document
+			ASSERT_EQ(ReadNodes(*CreateReader(sDocument, 1 << 16)), sExpected);
+		}
+	}
+
+	TEST_F(XmlReaderNative, RawAccessAtBufferEdges)
+	{
+		std::string sRawContent;
+		for (int nIndex = 0; nIndex < 100; nIndex++)
+			sRawContent += "<vertex x=\"" + std::to_string(nIndex) + "\" y=\"1.5\" z=\"-2\"/>\n";
+		const nfUint32 cbReadSize = NMR_NATIVEXMLREADER_MINBUFFERCAPACITY - NMR_NATIVEXMLREADER_BUFFERMARGIN;
+		const std::vector<nfUint32> ChunkSizes = { 1, 5, 64, 333, cbReadSize, 7 };
+
+		// The padding moves the start of the raw content over the end of the first buffer
+		for (nfUint32 nPadding = cbReadSize - 160; nPadding <= cbReadSize; nPadding++) {
+			// Elements cannot be split over two buffers, so the padding consists of short ones
+			std::string sPadding, sDecodedPadding;
+			for (nfUint32 nPadded = 0; nPadded < nPadding; nPadded += 100) {
+				std::string sValue(std::min<nfUint32>(nPadding - nPadded, 100), 'p');
+				sPadding += "<pad v=\"" + sValue + "\"/>";
+				sDecodedPadding += "<pad v=" + sValue + "></pad>";
+			}
+			std::string sDocument = "<root>" + sPadding + "<vertices>" + sRawContent +
+				"<!-- &amp; --></vertices><after a=\"1&amp;2\">x&lt;y</after></root>";
+			const size_t nRawStart = sDocument.find("<vertices>") + 10;
+			const size_t nRawEnd = sDocument.find("<!--");
+
+			auto pReader = CreateReader(sDocument);
+			ASSERT_EQ(ReadNodes(*pReader, "vertices"), "<root>" + sDecodedPadding + "<vertices>") << "padding " << nPadding;
+			ASSERT_TRUE(pReader->CanReadRaw());
+			ASSERT_EQ(pReader->GetRawPosition(), nRawStart);
+
+			// Read in chunks of varying size, giving back a few bytes now and then
+			size_t nPosition = nRawStart;
+			std::vector<nfByte> Buffer(cbReadSize);
+			size_t nChunk = 0;
+			while (nPosition < nRawEnd) {
+				nfUint32 cbRequested = ChunkSizes[nChunk % ChunkSizes.size()];
+				nfUint32 cbRead = pReader->ReadRaw(Buffer.data(), cbRequested);
+				ASSERT_EQ(cbRead, cbRequested);
+				ASSERT_EQ(std::string(Buffer.begin(), Buffer.begin() + cbRead), sDocument.substr(nPosition, cbRead));
+				nPosition += cbRead;
+
+				nfUint32 cbUnread = 0;
+				if (nPosition > nRawEnd)
+					cbUnread = (nfUint32)(nPosition - nRawEnd);
+				else if (nChunk % 3 == 1)
+					cbUnread = std::min<nfUint32>(cbRead, 3);
+				pReader->UnreadRaw(Buffer.data() + cbRead - cbUnread, cbUnread);
+				nPosition -= cbUnread;
+				ASSERT_EQ(pReader->GetRawPosition(), nPosition);
+				nChunk++;
+			}
+
+			// The given back bytes are parsed again
+			ASSERT_EQ(ReadNodes(*pReader), "</vertices><after a=1&2>x<y</after></root>") << "padding " << nPadding;
+			ASSERT_TRUE(pReader->IsEOF());
+		}
+	}
+
+	TEST_F(XmlReaderNative, ElementExceedingBufferFails)
+	{
+		std::string sValue(NMR_NATIVEXMLREADER_MINBUFFERCAPACITY, 'p');
+		auto pReader = CreateReader("<root><pad v=\"" + sValue + "\"/></root>");
+		ASSERT_THROW(ReadNodes(*pReader), CNMRException);
+
+		// A larger buffer holds it
+		ASSERT_EQ(ReadNodes(*CreateReader("<root><pad v=\"" + sValue + "\"/></root>", 4 * NMR_NATIVEXMLREADER_MINBUFFERCAPACITY)),
+			"<root><pad v=" + sValue + "></pad></root>");
+	}
+
+	TEST_F(XmlReaderNative, RawAccessRequiresFinishedEntity)
+	{
+		auto pReader = CreateReader("<root><e a=\"1\" b=\"2\"/></root>");
+		eXmlReaderNodeType NodeType;
+		ASSERT_TRUE(pReader->Read(NodeType));
+		ASSERT_TRUE(pReader->CanReadRaw());
+		ASSERT_TRUE(pReader->Read(NodeType));
+		ASSERT_EQ(NodeType, XMLREADERNODETYPE_STARTELEMENT);
+		// The attributes of the element are still pending
+		ASSERT_FALSE(pReader->CanReadRaw());
+		nfByte Byte;
+		ASSERT_THROW(pReader->ReadRaw(&Byte, 1), CNMRException);
+		ASSERT_THROW(pReader->GetRawPosition(), CNMRException);
+	}
+
+}
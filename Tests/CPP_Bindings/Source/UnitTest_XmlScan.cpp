@@ -0,0 +1,159 @@
+/*++
+
+Copyright (C) 2024 3MF Consortium
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification,
+are permitted provided that the following conditions are met:
+
+1. Redistributions of source code must retain the above copyright notice, this
+list of conditions and the following disclaimer.
+2. Redistributions in binary form must reproduce the above copyright notice,
+this list of conditions and the following disclaimer in the documentation
+and/or other materials provided with the distribution.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR
+ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+(INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Abstract:
+
+UnitTest_XmlScan.cpp: Unit tests of the delimiter searches of the native XML parser
+
+--*/
+
+#include "gtest/gtest.h"
+
+#include "Common/Platform/NMR_XmlScan.h"
+#include "Common/Platform/NMR_CPUFeatures.h"
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace Lib3MF
+{
+	using namespace NMR;
+
+	class XmlScan : public ::testing::Test {
+	protected:
+		struct sScan {
+			std::string m_sName;
+			// The characters the scan stops at
+			std::string m_sDelimiters;
+			std::function<nfChar * (const sXmlScanKernels & Kernels, nfChar * pszStart, nfChar * pszEnd)> m_Scan;
+		};
+
+		// The kernels of every instruction set the CPU supports, and the inline scans of the parser
+		static std::vector<std::pair<std::string, sXmlScanKernels>> GetKernels()
+		{
+			std::vector<std::pair<std::string, sXmlScanKernels>> Kernels;
+			Kernels.push_back(std::make_pair("Scalar", fnXmlScanGetKernelsScalar()));
+			if (fnXmlScanGetKernelsSSE2().m_pScanForChar != nullptr)
+				Kernels.push_back(std::make_pair("SSE2", fnXmlScanGetKernelsSSE2()));
+			if (fnCPUSupportsInstructionSet(CPUINSTRUCTIONSET_AVX2) && (fnXmlScanGetKernelsAVX2().m_pScanForChar != nullptr))
+				Kernels.push_back(std::make_pair("AVX2", fnXmlScanGetKernelsAVX2()));
+
+			sXmlScanKernels Inline;
+			Inline.m_pScanForChar = fnXmlScanForChar;
+			Inline.m_pScanForElementNameEnd = fnXmlScanForElementNameEnd;
+			Inline.m_pScanForEndElementEnd = fnXmlScanForEndElementEnd;
+			Inline.m_pScanForAttributeNameEnd = fnXmlScanForAttributeNameEnd;
+			Kernels.push_back(std::make_pair("Inline", Inline));
+			return Kernels;
+		}
+
+		static std::vector<sScan> GetScans()
+		{
+			std::vector<sScan> Scans;
+			for (nfChar cDelimiter : { '<', '-', '"', '\'' }) {
+				Scans.push_back({ std::string("Char ") + cDelimiter, std::string(1, cDelimiter),
+					[cDelimiter](const sXmlScanKernels & Kernels, nfChar * pszStart, nfChar * pszEnd) { return Kernels.m_pScanForChar(pszStart, pszEnd, cDelimiter); } });
+			}
+			Scans.push_back({ "ElementNameEnd", " \t\n\r>/?",
+				[](const sXmlScanKernels & Kernels, nfChar * pszStart, nfChar * pszEnd) { return Kernels.m_pScanForElementNameEnd(pszStart, pszEnd); } });
+			Scans.push_back({ "EndElementEnd", ">/?",
+				[](const sXmlScanKernels & Kernels, nfChar * pszStart, nfChar * pszEnd) { return Kernels.m_pScanForEndElementEnd(pszStart, pszEnd); } });
+			Scans.push_back({ "AttributeNameEnd", " \t\n\r=\"'",
+				[](const sXmlScanKernels & Kernels, nfChar * pszStart, nfChar * pszEnd) { return Kernels.m_pScanForAttributeNameEnd(pszStart, pszEnd); } });
+			return Scans;
+		}
+
+		static nfChar * ScanReference(nfChar * pszStart, nfChar * pszEnd, const std::string & sDelimiters)
+		{
+			nfChar * pChar = pszStart;
+			while ((pChar != pszEnd) && (sDelimiters.find(*pChar) == std::string::npos))
+				pChar++;
+			return pChar;
+		}
+	};
+
+	TEST_F(XmlScan, KernelsMatchScalarReference)
+	{
+		// Short ranges end in the tail of the blocks, long ones are handed from the inline scan to the kernels
+		std::vector<nfInt32> Lengths;
+		for (nfInt32 nLength = 0; nLength <= 20; nLength++)
+			Lengths.push_back(nLength);
+		for (nfInt32 nLength : { 31, 32, 33, 47, 48, 49, 63, 64, 65, 80, 97 })
+			Lengths.push_back(nLength);
+
+		alignas(64) nfChar Buffer[256];
+		for (auto & kernels : GetKernels()) {
+			for (auto & scan : GetScans()) {
+				for (nfChar cFiller : { 'a', (nfChar)0xBC }) {
+					for (nfChar cDelimiter : scan.m_sDelimiters) {
+						for (nfInt32 nStart = 0; nStart < 32; nStart++) {
+							for (nfInt32 nLength : Lengths) {
+								for (auto & cChar : Buffer)
+									cChar = cFiller;
+								nfChar * pszStart = Buffer + nStart;
+								nfChar * pszEnd = pszStart + nLength;
+								// Delimiters behind the range must not be found
+								*pszEnd = cDelimiter;
+
+								// -1 places no delimiter into the range
+								for (nfInt32 nOffset = -1; (nOffset < 32) && (nOffset < nLength); nOffset++) {
+									if (nOffset >= 0)
+										pszStart[nOffset] = cDelimiter;
+									nfChar * pResult = scan.m_Scan(kernels.second, pszStart, pszEnd);
+									ASSERT_EQ(pResult - pszStart, ScanReference(pszStart, pszEnd, scan.m_sDelimiters) - pszStart)
+										<< kernels.first << " " << scan.m_sName << " start " << nStart << " length " << nLength << " offset " << nOffset;
+									if (nOffset >= 0)
+										pszStart[nOffset] = cFiller;
+								}
+							}
+						}
+					}
+				}
+			}
+		}
+	}
+
+	TEST_F(XmlScan, KernelsFindFirstOfSeveralDelimiters)
+	{
+		alignas(64) nfChar Buffer[128];
+		for (auto & kernels : GetKernels()) {
+			for (auto & scan : GetScans()) {
+				for (nfInt32 nFirst = 0; nFirst < 64; nFirst++) {
+					for (nfInt32 nIndex = 0; nIndex < 128; nIndex++)
+						Buffer[nIndex] = 'a';
+					// Every delimiter of the set from nFirst on
+					for (size_t nDelimiter = 0; nDelimiter < scan.m_sDelimiters.size(); nDelimiter++)
+						Buffer[nFirst + nDelimiter * 7] = scan.m_sDelimiters[nDelimiter];
+
+					nfChar * pResult = scan.m_Scan(kernels.second, Buffer, Buffer + 120);
+					ASSERT_EQ(pResult, Buffer + nFirst) << kernels.first << " " << scan.m_sName << " first " << nFirst;
+				}
+			}
+		}
+	}
+
+}
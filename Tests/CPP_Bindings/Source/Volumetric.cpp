@@ -33,6 +33,9 @@ Vulometric.cpp: Defines Unittests for the Volumetric extension
 #include "UnitTest_Utilities.h"
 #include "lib3mf_implicit.hpp"
 
+#include <cmath>
+#include <map>
+
 namespace Lib3MF
 {
     namespace helper
@@ -1892,6 +1895,752 @@ namespace Lib3MF
         EXPECT_EQ(node->GetTag(), "group_a");
     }
 
+    /**
+     * @brief Evaluates the gyroid with a compiled evaluator and compares the
+     * results to a direct computation.
+     */
+    TEST_F(Volumetric, ImplicitEvaluator_Gyroid_MatchesDirectComputation)
+    {
+        auto const model = wrapper->CreateModel();
+        auto const gyroidFunction = helper::createGyroidFunction(*model);
+
+        auto const evaluator = gyroidFunction->CreateEvaluator();
+        ASSERT_EQ(evaluator->GetInputStride(), 3u);
+        ASSERT_EQ(evaluator->GetOutputStride(), 1u);
+        EXPECT_EQ(evaluator->GetWorkerThreadCount(), 1u);
+
+        // Enough points for several chunks and a partial last chunk
+        size_t const pointCount = 1000;
+        std::vector<double> inputs;
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            inputs.push_back(0.01 * i);
+            inputs.push_back(-0.02 * i + 1.);
+            inputs.push_back(0.5 * std::sin(0.1 * i));
+        }
+
+        std::vector<double> expected;
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            double const x = inputs[i * 3];
+            double const y = inputs[i * 3 + 1];
+            double const z = inputs[i * 3 + 2];
+            expected.push_back(std::sin(x) * std::cos(z) +
+                               std::sin(y) * std::cos(y) +
+                               std::sin(z) * std::cos(x));
+        }
+
+        std::vector<double> outputs;
+        evaluator->Evaluate(inputs, outputs);
+        ASSERT_EQ(outputs.size(), pointCount);
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            EXPECT_NEAR(outputs[i], expected[i], 1e-12);
+        }
+
+        evaluator->SetWorkerThreadCount(4);
+        std::vector<double> threadedOutputs;
+        evaluator->Evaluate(inputs, threadedOutputs);
+        EXPECT_EQ(threadedOutputs, outputs);
+
+        // Partial points are rejected
+        inputs.pop_back();
+        EXPECT_THROW(evaluator->Evaluate(inputs, outputs), ELib3MFException);
+    }
+
+    /**
+     * @brief Evaluates a function which calls the gyroid on a transformed
+     * position, which exercises function inlining and the matrix nodes.
+     */
+    TEST_F(Volumetric, ImplicitEvaluator_FunctionCallAndMatrices_AreEvaluated)
+    {
+        auto const model = wrapper->CreateModel();
+        auto const gyroidFunction = helper::createGyroidFunction(*model);
+
+        auto const function = model->AddImplicitFunction();
+        auto const posInput = function->AddInput(
+            "pos", "position", Lib3MF::eImplicitPortType::Vector);
+
+        // M^-1 * (M * pos) must reproduce pos
+        sMatrix4x4 transform = {{{2., 0.5, 0., 1.},
+                                 {0., 1., -1., 2.},
+                                 {0.25, 0., 3., -1.},
+                                 {0., 0., 0., 1.}}};
+        auto const matrixNode =
+            function->AddConstMatNode("matrix", "transform", "group_a");
+        matrixNode->SetMatrix(transform);
+
+        auto const transformNode = function->AddMatVecMultiplicationNode(
+            "transform", "transform", "group_a");
+        function->AddLink(matrixNode->GetOutputMatrix(),
+                          transformNode->GetInputA());
+        function->AddLink(posInput, transformNode->GetInputB());
+
+        auto const inverseNode =
+            function->AddInverseNode("inverse", "inverse", "group_a");
+        function->AddLink(matrixNode->GetOutputMatrix(),
+                          inverseNode->GetInputA());
+
+        auto const restoreNode = function->AddMatVecMultiplicationNode(
+            "restore", "restore", "group_a");
+        function->AddLink(inverseNode->GetOutputResult(),
+                          restoreNode->GetInputA());
+        function->AddLink(transformNode->GetOutputResult(),
+                          restoreNode->GetInputB());
+
+        auto const restoredOutput = function->AddOutput(
+            "restored", "restored position", Lib3MF::eImplicitPortType::Vector);
+        function->AddLink(restoreNode->GetOutputResult(), restoredOutput);
+
+        // The gyroid is called with the transformed position
+        auto const gyroidNode =
+            function->AddFunctionCallNode("gyroid", "gyroid", "group_b");
+        auto const functionIdNode =
+            function->AddResourceIdNode("gyroidID", "function", "group_b");
+        functionIdNode->SetResource(gyroidFunction.get());
+        function->AddLinkByNames("gyroidID.value", "gyroid.functionID");
+
+        auto const gyroidPosInput = gyroidNode->AddInput("pos", "position");
+        gyroidPosInput->SetType(Lib3MF::eImplicitPortType::Vector);
+        auto const gyroidShapeOutput =
+            gyroidNode->AddOutput("shape", "signed distance to the surface");
+        gyroidShapeOutput->SetType(Lib3MF::eImplicitPortType::Scalar);
+        function->AddLink(transformNode->GetOutputResult(), gyroidPosInput);
+
+        auto const shapeOutput = function->AddOutput(
+            "shape", "shape", Lib3MF::eImplicitPortType::Scalar);
+        function->AddLink(gyroidShapeOutput, shapeOutput);
+
+        auto const evaluator = function->CreateEvaluator();
+        ASSERT_EQ(evaluator->GetInputStride(), 3u);
+        ASSERT_EQ(evaluator->GetOutputStride(), 4u);
+
+        std::vector<double> const inputs = {0., 0., 0., 1., 2., 3., -0.5, 4., 0.25};
+        std::vector<double> outputs;
+        evaluator->Evaluate(inputs, outputs);
+        ASSERT_EQ(outputs.size(), 12u);
+
+        for (size_t i = 0; i < 3; ++i)
+        {
+            double const* pos = &inputs[i * 3];
+            double transformed[3];
+            for (int row = 0; row < 3; ++row)
+            {
+                transformed[row] = transform.m_Field[row][0] * pos[0] +
+                                   transform.m_Field[row][1] * pos[1] +
+                                   transform.m_Field[row][2] * pos[2] +
+                                   transform.m_Field[row][3];
+            }
+            double const gyroid =
+                std::sin(transformed[0]) * std::cos(transformed[2]) +
+                std::sin(transformed[1]) * std::cos(transformed[1]) +
+                std::sin(transformed[2]) * std::cos(transformed[0]);
+
+            EXPECT_NEAR(outputs[i * 4], pos[0], 1e-9);
+            EXPECT_NEAR(outputs[i * 4 + 1], pos[1], 1e-9);
+            EXPECT_NEAR(outputs[i * 4 + 2], pos[2], 1e-9);
+            EXPECT_NEAR(outputs[i * 4 + 3], gyroid, 1e-12);
+        }
+    }
+
+    /**
+     * @brief Evaluates points in structure-of-arrays layout with a function
+     * using the operations of the SIMD kernels.
+     */
+    TEST_F(Volumetric, ImplicitEvaluator_EvaluateBatch_MatchesDirectComputation)
+    {
+        auto const model = wrapper->CreateModel();
+        auto const function = model->AddImplicitFunction();
+        auto const scalar = Lib3MF::eImplicitNodeConfiguration::ScalarToScalar;
+
+        auto const posInput = function->AddInput(
+            "pos", "position", Lib3MF::eImplicitPortType::Vector);
+        auto const decompose =
+            function->AddDecomposeVectorNode("decompose", "decompose", "group_a");
+        function->AddLink(posInput, decompose->GetInputA());
+        auto const x = decompose->GetOutputX();
+        auto const y = decompose->GetOutputY();
+        auto const z = decompose->GetOutputZ();
+
+        // sqrt(abs(x < y ? clamp(x, min(x, y), max(y, z)) : max(y, z))) - min(x, y)
+        auto const minNode = function->AddMinNode("min", scalar, "min", "group_a");
+        function->AddLink(x, minNode->GetInputA());
+        function->AddLink(y, minNode->GetInputB());
+
+        auto const maxNode = function->AddMaxNode("max", scalar, "max", "group_a");
+        function->AddLink(y, maxNode->GetInputA());
+        function->AddLink(z, maxNode->GetInputB());
+
+        auto const clampNode = function->AddClampNode("clamp", scalar, "clamp", "group_a");
+        function->AddLink(x, clampNode->GetInputA());
+        function->AddLink(minNode->GetOutputResult(), clampNode->GetInputMin());
+        function->AddLink(maxNode->GetOutputResult(), clampNode->GetInputMax());
+
+        auto const selectNode = function->AddSelectNode("select", scalar, "select", "group_a");
+        function->AddLink(x, selectNode->GetInputA());
+        function->AddLink(y, selectNode->GetInputB());
+        function->AddLink(clampNode->GetOutputResult(), selectNode->GetInputC());
+        function->AddLink(maxNode->GetOutputResult(), selectNode->GetInputD());
+
+        auto const absNode = function->AddAbsNode("abs", scalar, "abs", "group_a");
+        function->AddLink(selectNode->GetOutputResult(), absNode->GetInputA());
+
+        auto const sqrtNode = function->AddSqrtNode("sqrt", scalar, "sqrt", "group_a");
+        function->AddLink(absNode->GetOutputResult(), sqrtNode->GetInputA());
+
+        auto const subtractionNode =
+            function->AddSubtractionNode("subtraction", scalar, "subtraction", "group_a");
+        function->AddLink(sqrtNode->GetOutputResult(), subtractionNode->GetInputA());
+        function->AddLink(minNode->GetOutputResult(), subtractionNode->GetInputB());
+
+        auto const valueOutput = function->AddOutput(
+            "value", "value", Lib3MF::eImplicitPortType::Scalar);
+        function->AddLink(subtractionNode->GetOutputResult(), valueOutput);
+
+        // Component-wise square of the position
+        auto const squareNode = function->AddMultiplicationNode(
+            "square", Lib3MF::eImplicitNodeConfiguration::VectorToVector, "square", "group_b");
+        function->AddLink(posInput, squareNode->GetInputA());
+        function->AddLink(posInput, squareNode->GetInputB());
+        auto const squareOutput = function->AddOutput(
+            "square", "square", Lib3MF::eImplicitPortType::Vector);
+        function->AddLink(squareNode->GetOutputResult(), squareOutput);
+
+        auto const evaluator = function->CreateEvaluator();
+        ASSERT_EQ(evaluator->GetOutputStride(), 4u);
+
+        size_t const pointCount = 131;
+        std::vector<double> batchInputs(pointCount * 3);
+        std::vector<double> interleavedInputs(pointCount * 3);
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            double const pos[3] = {std::sin(0.37 * i) * 2., std::cos(0.21 * i) * 2., 0.01 * i - 0.5};
+            for (size_t component = 0; component < 3; ++component)
+            {
+                batchInputs[component * pointCount + i] = pos[component];
+                interleavedInputs[i * 3 + component] = pos[component];
+            }
+        }
+
+        std::vector<double> batchOutputs;
+        evaluator->EvaluateBatch(batchInputs, batchOutputs);
+        ASSERT_EQ(batchOutputs.size(), pointCount * 4);
+
+        std::vector<double> interleavedOutputs;
+        evaluator->Evaluate(interleavedInputs, interleavedOutputs);
+
+        for (size_t i = 0; i < pointCount; ++i)
+        {
+            double const px = interleavedInputs[i * 3];
+            double const py = interleavedInputs[i * 3 + 1];
+            double const pz = interleavedInputs[i * 3 + 2];
+            double const lower = std::min(px, py);
+            double const upper = std::max(py, pz);
+            double const selected = (px < py) ? std::min(std::max(px, lower), upper) : upper;
+            double const expected = std::sqrt(std::abs(selected)) - lower;
+
+            EXPECT_DOUBLE_EQ(batchOutputs[i], expected);
+            EXPECT_DOUBLE_EQ(batchOutputs[pointCount + i], px * px);
+            EXPECT_DOUBLE_EQ(batchOutputs[2 * pointCount + i], py * py);
+            EXPECT_DOUBLE_EQ(batchOutputs[3 * pointCount + i], pz * pz);
+
+            for (size_t component = 0; component < 4; ++component)
+            {
+                EXPECT_EQ(batchOutputs[component * pointCount + i], interleavedOutputs[i * 4 + component]);
+            }
+        }
+    }
+
+    /**
+     * @brief Computes bounds of the gyroid for boxes of positions and checks,
+     * that they contain the values of points within the boxes.
+     */
+    TEST_F(Volumetric, ImplicitEvaluator_EvaluateBounds_ContainPointValues)
+    {
+        auto const model = wrapper->CreateModel();
+        auto const evaluator = helper::createGyroidFunction(*model)->CreateEvaluator();
+
+        size_t const boxCount = 20;
+        std::vector<double> minima;
+        std::vector<double> maxima;
+        for (size_t i = 0; i < boxCount; ++i)
+        {
+            double const size = 0.05 * (i % 5) + 0.01 * i;
+            minima.push_back(std::sin(1.3 * i) * 4.);
+            minima.push_back(std::cos(0.7 * i) * 4.);
+            minima.push_back(0.3 * i - 3.);
+            for (size_t component = 0; component < 3; ++component)
+            {
+                maxima.push_back(minima[i * 3 + component] + size * (component + 1));
+            }
+        }
+
+        std::vector<double> lowerBounds;
+        std::vector<double> upperBounds;
+        evaluator->EvaluateBounds(minima, maxima, lowerBounds, upperBounds);
+        ASSERT_EQ(lowerBounds.size(), boxCount);
+        ASSERT_EQ(upperBounds.size(), boxCount);
+
+        size_t const samplesPerAxis = 6;
+        std::vector<double> inputs;
+        for (size_t i = 0; i < boxCount; ++i)
+        {
+            for (size_t sample = 0; sample < samplesPerAxis * samplesPerAxis * samplesPerAxis; ++sample)
+            {
+                size_t const steps[3] = {sample % samplesPerAxis,
+                                         (sample / samplesPerAxis) % samplesPerAxis,
+                                         sample / (samplesPerAxis * samplesPerAxis)};
+                for (size_t component = 0; component < 3; ++component)
+                {
+                    double const t = static_cast<double>(steps[component]) / (samplesPerAxis - 1);
+                    inputs.push_back(minima[i * 3 + component] +
+                                     t * (maxima[i * 3 + component] - minima[i * 3 + component]));
+                }
+            }
+        }
+        std::vector<double> outputs;
+        evaluator->Evaluate(inputs, outputs);
+
+        size_t const samplesPerBox = samplesPerAxis * samplesPerAxis * samplesPerAxis;
+        for (size_t i = 0; i < boxCount; ++i)
+        {
+            // The gyroid is bounded by 3 and has a gradient of at most sqrt(6)
+            EXPECT_GE(lowerBounds[i], -3.);
+            EXPECT_LE(upperBounds[i], 3.);
+            for (size_t sample = 0; sample < samplesPerBox; ++sample)
+            {
+                double const value = outputs[i * samplesPerBox + sample];
+                EXPECT_LE(lowerBounds[i], value);
+                EXPECT_GE(upperBounds[i], value);
+            }
+        }
+
+        // Boxes of a single point give the point value
+        std::vector<double> pointBounds;
+        std::vector<double> pointUpperBounds;
+        std::vector<double> const point = {0.3, -1.2, 2.5};
+        evaluator->EvaluateBounds(point, point, pointBounds, pointUpperBounds);
+        evaluator->Evaluate(point, outputs);
+        EXPECT_NEAR(pointBounds[0], outputs[0], 1e-12);
+        EXPECT_NEAR(pointUpperBounds[0], outputs[0], 1e-12);
+
+        // Minima above the maxima are rejected
+        EXPECT_THROW(evaluator->EvaluateBounds(maxima, minima, lowerBounds, upperBounds), ELib3MFException);
+    }
+
+    /**
+     * @brief Division by an interval containing zero has no bounds.
+     */
+    TEST_F(Volumetric, ImplicitEvaluator_EvaluateBounds_DivisionByZeroIsUnbounded)
+    {
+        auto const model = wrapper->CreateModel();
+        auto const function = model->AddImplicitFunction();
+        auto const scalar = Lib3MF::eImplicitNodeConfiguration::ScalarToScalar;
+
+        auto const xInput = function->AddInput("x", "x", Lib3MF::eImplicitPortType::Scalar);
+        auto const oneNode = function->AddConstantNode("one", "one", "group_a");
+        oneNode->SetConstant(1.);
+        auto const divisionNode = function->AddDivisionNode("division", scalar, "division", "group_a");
+        function->AddLink(oneNode->GetOutputValue(), divisionNode->GetInputA());
+        function->AddLink(xInput, divisionNode->GetInputB());
+        auto const output = function->AddOutput("value", "value", Lib3MF::eImplicitPortType::Scalar);
+        function->AddLink(divisionNode->GetOutputResult(), output);
+
+        auto const evaluator = function->CreateEvaluator();
+        std::vector<double> lowerBounds;
+        std::vector<double> upperBounds;
+        std::vector<double> const minima = {-1., 2.};
+        std::vector<double> const maxima = {1., 4.};
+        evaluator->EvaluateBounds(minima, maxima, lowerBounds, upperBounds);
+        ASSERT_EQ(lowerBounds.size(), 2u);
+        EXPECT_TRUE(std::isinf(lowerBounds[0]));
+        EXPECT_TRUE(std::isinf(upperBounds[0]));
+        EXPECT_NEAR(lowerBounds[1], 0.25, 1e-12);
+        EXPECT_NEAR(upperBounds[1], 0.5, 1e-12);
+    }
+
+    /**
+     * @brief Samples voxel centers of the image stack with nearest filtering
+     * and compares them to the pixels of the PNG sheet. v = 0 is at the last
+     * row of a sheet.
+     */
+    TEST_F(Volumetric, Image3DSampler_Nearest_MatchesPixelValues)
+    {
+        auto const imageStack = SetupSheetsFromFile();
+        auto const function = model->AddFunctionFromImage3D(imageStack.get());
+        function->SetFilter(Lib3MF::eTextureFilter::Nearest);
+        function->SetTileStyles(Lib3MF::eTextureTileStyle::Clamp,
+                                Lib3MF::eTextureTileStyle::Clamp,
+                                Lib3MF::eTextureTileStyle::Clamp);
+
+        // Column, row and sheet of the voxels in the PNG files
+        struct Voxel
+        {
+            int column;
+            int row;
+            int sheet;
+            double red;
+            double green;
+            double blue;
+        };
+        std::vector<Voxel> const voxels = {{0, 100, 5, 184., 98., 73.},
+                                           {800, 800, 5, 120., 143., 189.},
+                                           {800, 100, 5, 97., 123., 184.}};
+
+        std::vector<double> uvw;
+        for (auto const& voxel : voxels)
+        {
+            uvw.push_back((voxel.column + 0.5) / 821.);
+            uvw.push_back((818 - voxel.row + 0.5) / 819.);
+            uvw.push_back((voxel.sheet + 0.5) / 11.);
+        }
+
+        auto const sampler = function->CreateSampler();
+        std::vector<double> rgba;
+        sampler->Sample(uvw, rgba);
+        ASSERT_EQ(rgba.size(), voxels.size() * 4);
+        for (size_t i = 0; i < voxels.size(); ++i)
+        {
+            EXPECT_NEAR(rgba[i * 4], voxels[i].red / 255., 1e-12);
+            EXPECT_NEAR(rgba[i * 4 + 1], voxels[i].green / 255., 1e-12);
+            EXPECT_NEAR(rgba[i * 4 + 2], voxels[i].blue / 255., 1e-12);
+            // The sheets have no alpha channel
+            EXPECT_DOUBLE_EQ(rgba[i * 4 + 3], 1.);
+        }
+    }
+
+    /**
+     * @brief Samples every voxel of a 16 bit RGBA sheet, which is decoded
+     * into normalized floats instead of bytes.
+     */
+    TEST_F(Volumetric, Image3DSampler_16BitSheet_MatchesPixelValues)
+    {
+        unsigned const columnCount = 13;
+        unsigned const rowCount = 11;
+        auto const imageStack = model->AddImageStack(columnCount, rowCount, 1);
+        imageStack->CreateSheetFromFile(0, "/volume/rgba_16bit.png", InFolder + "PNG/rgba_16bit.png");
+        auto const function = model->AddFunctionFromImage3D(imageStack.get());
+        function->SetFilter(Lib3MF::eTextureFilter::Nearest);
+
+        std::vector<double> uvw;
+        for (unsigned row = 0; row < rowCount; ++row)
+        {
+            for (unsigned column = 0; column < columnCount; ++column)
+            {
+                uvw.push_back((column + 0.5) / columnCount);
+                uvw.push_back((rowCount - 1 - row + 0.5) / rowCount);
+                uvw.push_back(0.5);
+            }
+        }
+
+        std::vector<double> rgba;
+        function->CreateSampler()->Sample(uvw, rgba);
+        ASSERT_EQ(rgba.size(), columnCount * rowCount * 4);
+        for (unsigned row = 0; row < rowCount; ++row)
+        {
+            for (unsigned column = 0; column < columnCount; ++column)
+            {
+                // The pixel values of the test file
+                unsigned const pixel[4] = {(column * 4099 + row * 257) % 65536,
+                                           (column * 31 + row * 65000) % 65536,
+                                           (column * row * 1031) % 65536,
+                                           65535 - column * 1000 - row * 100};
+                double const* sample = &rgba[(row * columnCount + column) * 4];
+                for (size_t channel = 0; channel < 4; ++channel)
+                {
+                    EXPECT_NEAR(sample[channel], pixel[channel] / 65535., 1e-6)
+                        << "column " << column << ", row " << row << ", channel " << channel;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Checks the tile styles, linear filtering, offset and scale and
+     * that a small cache and multiple threads do not change the samples.
+     */
+    TEST_F(Volumetric, Image3DSampler_TileStylesAndFilter_AreApplied)
+    {
+        auto const imageStack = SetupSheetsFromFile();
+        auto const function = model->AddFunctionFromImage3D(imageStack.get());
+        function->SetFilter(Lib3MF::eTextureFilter::Linear);
+        function->SetTileStyles(Lib3MF::eTextureTileStyle::Wrap,
+                                Lib3MF::eTextureTileStyle::Mirror,
+                                Lib3MF::eTextureTileStyle::NoTileStyle);
+        function->SetOffset(-1.);
+        function->SetScale(2.);
+
+        auto const sampler = function->CreateSampler();
+        // Each point is followed by its tiled counterpart
+        std::vector<double> const uvw = {0.3, 0.4, 0.5,      1.3, 0.4, 0.5,
+                                         0.7, 0.2, 0.25,     -0.3, -0.2, 0.25,
+                                         0.45, 0.55, 0.7,    0.45, 1.45, 0.7};
+        std::vector<double> rgba;
+        sampler->Sample(uvw, rgba);
+        ASSERT_EQ(rgba.size(), 24u);
+        for (size_t point = 0; point < 6; point += 2)
+        {
+            for (size_t channel = 0; channel < 4; ++channel)
+            {
+                EXPECT_NEAR(rgba[point * 4 + channel], rgba[(point + 1) * 4 + channel], 1e-9);
+            }
+            EXPECT_GE(rgba[point * 4], -1.);
+            EXPECT_LE(rgba[point * 4], 1.);
+            EXPECT_DOUBLE_EQ(rgba[point * 4 + 3], 1.);
+        }
+
+        // Linear filtering interpolates between the centers of two voxels
+        double const u0 = 400.5 / 821.;
+        double const u1 = 401.5 / 821.;
+        std::vector<double> const centers = {u0, 0.3, 0.5, u1, 0.3, 0.5, (u0 + u1) / 2., 0.3, 0.5};
+        sampler->Sample(centers, rgba);
+        for (size_t channel = 0; channel < 3; ++channel)
+        {
+            EXPECT_NEAR(rgba[8 + channel], (rgba[channel] + rgba[4 + channel]) / 2., 1e-9);
+        }
+
+        // Outside of the image stack in w, tile style none gives the value 0
+        std::vector<double> const outside = {0.5, 0.5, 1.5, 0.5, 0.5, -0.5};
+        sampler->Sample(outside, rgba);
+        for (auto const value : rgba)
+        {
+            EXPECT_DOUBLE_EQ(value, -1.);
+        }
+
+        std::vector<double> grid;
+        for (int i = 0; i < 200; ++i)
+        {
+            grid.push_back(std::fmod(i * 0.137, 1.));
+            grid.push_back(std::fmod(i * 0.291, 1.));
+            grid.push_back(std::fmod(i * 0.053, 1.));
+        }
+        std::vector<double> expected;
+        sampler->Sample(grid, expected);
+
+        sampler->SetCacheSize(0);
+        EXPECT_EQ(sampler->GetCacheSize(), 0u);
+        sampler->SetWorkerThreadCount(4);
+        EXPECT_EQ(sampler->GetWorkerThreadCount(), 4u);
+        std::vector<double> actual;
+        sampler->Sample(grid, actual);
+        ASSERT_EQ(actual.size(), expected.size());
+        for (size_t i = 0; i < actual.size(); ++i)
+        {
+            EXPECT_DOUBLE_EQ(actual[i], expected[i]);
+        }
+    }
+
+    /**
+     * @brief Evaluates an implicit function, which calls a function from
+     * image3d, and compares it to the sampler.
+     */
+    TEST_F(Volumetric, ImplicitEvaluator_FunctionFromImage3D_MatchesSampler)
+    {
+        auto const imageStack = SetupSheetsFromFile();
+        auto const imageFunction = model->AddFunctionFromImage3D(imageStack.get());
+        imageFunction->SetTileStyles(Lib3MF::eTextureTileStyle::Wrap,
+                                     Lib3MF::eTextureTileStyle::Clamp,
+                                     Lib3MF::eTextureTileStyle::Mirror);
+        imageFunction->SetOffset(0.5);
+        imageFunction->SetScale(-0.25);
+
+        auto const function = model->AddImplicitFunction();
+        function->AddInput("pos", "position", Lib3MF::eImplicitPortType::Vector);
+        auto const callNode = function->AddFunctionCallNode("call", "call", "group_a");
+        auto const idNode = function->AddResourceIdNode("id", "image function", "group_a");
+        idNode->SetResource(imageFunction.get());
+        function->AddLink(idNode->GetOutputValue(), callNode->GetInputFunctionID());
+        callNode->AddInput("uvw", "uvw")->SetType(Lib3MF::eImplicitPortType::Vector);
+        callNode->AddOutput("color", "color")->SetType(Lib3MF::eImplicitPortType::Vector);
+        callNode->AddOutput("green", "green")->SetType(Lib3MF::eImplicitPortType::Scalar);
+        function->AddLinkByNames("inputs.pos", "call.uvw");
+        function->AddOutput("color", "color", Lib3MF::eImplicitPortType::Vector);
+        function->AddOutput("green", "green", Lib3MF::eImplicitPortType::Scalar);
+        function->AddLinkByNames("call.color", "outputs.color");
+        function->AddLinkByNames("call.green", "outputs.green");
+
+        std::vector<double> points;
+        for (int i = 0; i < 150; ++i)
+        {
+            points.push_back(-0.5 + i * 0.013);
+            points.push_back(0.1 + i * 0.004);
+            points.push_back(1.2 - i * 0.011);
+        }
+
+        auto const evaluator = function->CreateEvaluator();
+        EXPECT_EQ(evaluator->GetOutputStride(), 4u);
+        std::vector<double> values;
+        evaluator->Evaluate(points, values);
+
+        std::vector<double> rgba;
+        imageFunction->CreateSampler()->Sample(points, rgba);
+        ASSERT_EQ(values.size(), rgba.size());
+        for (size_t i = 0; i < points.size() / 3; ++i)
+        {
+            EXPECT_DOUBLE_EQ(values[i * 4], rgba[i * 4]);
+            EXPECT_DOUBLE_EQ(values[i * 4 + 1], rgba[i * 4 + 1]);
+            EXPECT_DOUBLE_EQ(values[i * 4 + 2], rgba[i * 4 + 2]);
+            EXPECT_DOUBLE_EQ(values[i * 4 + 3], rgba[i * 4 + 1]);
+        }
+
+        // The samples are bounded by offset and scale
+        std::vector<double> lowerBounds;
+        std::vector<double> upperBounds;
+        std::vector<double> const minima = {0., 0., 0.};
+        std::vector<double> const maxima = {1., 1., 1.};
+        evaluator->EvaluateBounds(minima, maxima, lowerBounds, upperBounds);
+        ASSERT_EQ(lowerBounds.size(), 4u);
+        for (size_t i = 0; i < 4; ++i)
+        {
+            EXPECT_NEAR(lowerBounds[i], 0.25, 1e-12);
+            EXPECT_NEAR(upperBounds[i], 0.5, 1e-12);
+        }
+    }
+
+    /**
+     * @brief Merges a levelset sphere into a mesh and checks, that the
+     * extracted surface is closed, oriented outwards and on the sphere.
+     */
+    TEST_F(Volumetric, LevelSet_MergeToModel_ExtractsSphere)
+    {
+        auto const model = wrapper->CreateModel();
+
+        // 100 x 100 x 100 box from the origin as evaluation domain
+        auto const domain = model->AddMeshObject();
+        std::vector<sLib3MFPosition> vertices;
+        std::vector<sLib3MFTriangle> triangles;
+        fnCreateBox(vertices, triangles);
+        domain->SetGeometry(vertices, triangles);
+
+        // length(pos) - radius
+        double const radius = 30.;
+        auto const function = model->AddImplicitFunction();
+        auto const posInput = function->AddInput(
+            "pos", "position", Lib3MF::eImplicitPortType::Vector);
+        auto const lengthNode = function->AddLengthNode("length", "length", "group_a");
+        function->AddLink(posInput, lengthNode->GetInputA());
+        auto const radiusNode = function->AddConstantNode("radius", "radius", "group_a");
+        radiusNode->SetConstant(radius);
+        auto const subtractionNode = function->AddSubtractionNode(
+            "distance", Lib3MF::eImplicitNodeConfiguration::ScalarToScalar,
+            "distance", "group_a");
+        function->AddLink(lengthNode->GetOutputResult(), subtractionNode->GetInputA());
+        function->AddLink(radiusNode->GetOutputValue(), subtractionNode->GetInputB());
+        auto const shapeOutput = function->AddOutput(
+            "shape", "signed distance", Lib3MF::eImplicitPortType::Scalar);
+        function->AddLink(subtractionNode->GetOutputResult(), shapeOutput);
+
+        // The function is centered in the box by the levelset transform
+        auto const levelSet = model->AddLevelSet();
+        levelSet->SetMesh(domain);
+        levelSet->SetFunction(function.get());
+        levelSet->SetChannelName("shape");
+        levelSet->SetMinFeatureSize(4.);
+        sTransform transform = getIdentityTransform();
+        transform.m_Fields[3][0] = -50.f;
+        transform.m_Fields[3][1] = -50.f;
+        transform.m_Fields[3][2] = -50.f;
+        levelSet->SetTransform(transform);
+        model->AddBuildItem(levelSet.get(), getIdentityTransform());
+
+        // The outbox is bounded by the domain
+        auto const outbox = model->GetOutbox();
+        EXPECT_FLOAT_EQ(outbox.m_MinCoordinate[0], 0.f);
+        EXPECT_FLOAT_EQ(outbox.m_MaxCoordinate[2], 100.f);
+
+        auto const mergedModel = model->MergeToModel();
+        auto const meshes = mergedModel->GetMeshObjects();
+        ASSERT_TRUE(meshes->MoveNext());
+        auto const mesh = meshes->GetCurrentMeshObject();
+        mesh->GetVertices(vertices);
+        mesh->GetTriangleIndices(triangles);
+        ASSERT_GT(triangles.size(), 1000u);
+
+        for (auto const& vertex : vertices)
+        {
+            double const dx = vertex.m_Coordinates[0] - 50.;
+            double const dy = vertex.m_Coordinates[1] - 50.;
+            double const dz = vertex.m_Coordinates[2] - 50.;
+            EXPECT_NEAR(std::sqrt(dx * dx + dy * dy + dz * dz), radius, 0.2);
+        }
+
+        // Every directed edge is used once and its reverse edge as well
+        std::map<std::pair<Lib3MF_uint32, Lib3MF_uint32>, int> edges;
+        double volume = 0.;
+        for (auto const& triangle : triangles)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                edges[{triangle.m_Indices[i], triangle.m_Indices[(i + 1) % 3]}]++;
+            }
+
+            auto const& a = vertices[triangle.m_Indices[0]].m_Coordinates;
+            auto const& b = vertices[triangle.m_Indices[1]].m_Coordinates;
+            auto const& c = vertices[triangle.m_Indices[2]].m_Coordinates;
+            volume += (double(a[0]) * (double(b[1]) * c[2] - double(b[2]) * c[1]) -
+                       double(a[1]) * (double(b[0]) * c[2] - double(b[2]) * c[0]) +
+                       double(a[2]) * (double(b[0]) * c[1] - double(b[1]) * c[0])) / 6.;
+        }
+        for (auto const& edge : edges)
+        {
+            ASSERT_EQ(edge.second, 1);
+            ASSERT_EQ(edges.count({edge.first.second, edge.first.first}), 1u);
+        }
+
+        double const sphereVolume = 4. / 3. * 3.14159265358979 * radius * radius * radius;
+        EXPECT_NEAR(volume, sphereVolume, 0.02 * sphereVolume);
+    }
+
+    /**
+     * @brief A levelset, which is larger than its mesh, is clipped to the
+     * bounding box of the mesh and stays closed.
+     */
+    TEST_F(Volumetric, LevelSet_MergeToModel_IsClippedToMeshBox)
+    {
+        auto const model = wrapper->CreateModel();
+
+        auto const domain = model->AddMeshObject();
+        std::vector<sLib3MFPosition> vertices;
+        std::vector<sLib3MFTriangle> triangles;
+        fnCreateBox(vertices, triangles);
+        domain->SetGeometry(vertices, triangles);
+
+        auto const gyroidFunction = helper::createGyroidFunction(*model);
+        auto const levelSet = model->AddLevelSet();
+        levelSet->SetMesh(domain);
+        levelSet->SetFunction(gyroidFunction.get());
+        levelSet->SetChannelName("shape");
+        levelSet->SetMinFeatureSize(8.);
+        model->AddBuildItem(levelSet.get(), getIdentityTransform());
+
+        auto const mesh = model->MergeToModel()->GetMeshObjects();
+        ASSERT_TRUE(mesh->MoveNext());
+        mesh->GetCurrentMeshObject()->GetVertices(vertices);
+        mesh->GetCurrentMeshObject()->GetTriangleIndices(triangles);
+        ASSERT_GT(triangles.size(), 0u);
+
+        for (auto const& vertex : vertices)
+        {
+            for (int axis = 0; axis < 3; ++axis)
+            {
+                EXPECT_GE(vertex.m_Coordinates[axis], -1e-3f);
+                EXPECT_LE(vertex.m_Coordinates[axis], 100.f + 1e-3f);
+            }
+        }
 
+        std::map<std::pair<Lib3MF_uint32, Lib3MF_uint32>, int> edges;
+        for (auto const& triangle : triangles)
+        {
+            for (int i = 0; i < 3; ++i)
+            {
+                edges[{triangle.m_Indices[i], triangle.m_Indices[(i + 1) % 3]}]++;
+            }
+        }
+        for (auto const& edge : edges)
+        {
+            ASSERT_EQ(edge.second, 1);
+            ASSERT_EQ(edges.count({edge.first.second, edge.first.first}), 1u);
+        }
+    }
 
 }  // namespace Lib3MF
@@ -148,6 +148,34 @@ namespace Lib3MF
 		ASSERT_TRUE(buffer.size() < bufferLargr.size());
 	}
 
+	TEST_F(Writer, 3MFShortestRoundtrip)
+	{
+		std::vector<sPosition> vctVertices;
+		std::vector<sTriangle> vctTriangles;
+		fnCreateBox(vctVertices, vctTriangles);
+		vctVertices[0] = fnCreateVertex(0.1f, 1e-7f, 123456.789f);
+		vctVertices[1] = fnCreateVertex(-2.5f, 3.14159274f, -1e-30f);
+		auto mesh = model->AddMeshObject();
+		mesh->SetGeometry(vctVertices, vctTriangles);
+		Lib3MF_uint32 nResourceID = mesh->GetResourceID();
+
+		ASSERT_FALSE(writer3MF->GetShortestRoundtripActive());
+		writer3MF->SetShortestRoundtripActive(true);
+		ASSERT_TRUE(writer3MF->GetShortestRoundtripActive());
+		std::vector<Lib3MF_uint8> buffer;
+		writer3MF->WriteToBuffer(buffer);
+
+		auto readModel = wrapper->CreateModel();
+		readModel->QueryReader("3mf")->ReadFromBuffer(buffer);
+		std::vector<sPosition> vctReadVertices;
+		readModel->GetMeshObjectByID(nResourceID)->GetVertices(vctReadVertices);
+		ASSERT_EQ(vctReadVertices.size(), vctVertices.size());
+		for (size_t nIndex = 0; nIndex < vctVertices.size(); nIndex++) {
+			for (int j = 0; j < 3; j++)
+				ASSERT_EQ(vctReadVertices[nIndex].m_Coordinates[j], vctVertices[nIndex].m_Coordinates[j]);
+		}
+	}
+
 	TEST_F(Writer, STLCompare)
 	{
 		// This test is atleast functional
@@ -183,4 +211,275 @@ namespace Lib3MF
 
 		ASSERT_TRUE(std::equal(buffer.begin(), buffer.end(), callbackBuffer.vec.begin()));
 	}
+
+	TEST_F(Writer, 3MFWriteWithWorkerThreads)
+	{
+		// The model part spans several batches of compressed blocks.
+		auto sourceMesh = model->AddMeshObject();
+		const Lib3MF_uint32 nGridSize = 200;
+		std::vector<sLib3MFPosition> vctVertices;
+		std::vector<sLib3MFTriangle> vctTriangles;
+		for (Lib3MF_uint32 nY = 0; nY < nGridSize; nY++) {
+			for (Lib3MF_uint32 nX = 0; nX < nGridSize; nX++) {
+				vctVertices.push_back(fnCreateVertex(nX * 0.25f, nY * 0.5f, (nX * nY % 7) * 0.125f));
+				if ((nX > 0) && (nY > 0)) {
+					Lib3MF_uint32 nIndex = nY * nGridSize + nX;
+					vctTriangles.push_back(fnCreateTriangle(nIndex - nGridSize - 1, nIndex - nGridSize, nIndex));
+					vctTriangles.push_back(fnCreateTriangle(nIndex - nGridSize - 1, nIndex, nIndex - 1));
+				}
+			}
+		}
+		sourceMesh->SetGeometry(vctVertices, vctTriangles);
+		Lib3MF_uint32 nResourceID = sourceMesh->GetResourceID();
+
+		ASSERT_EQ(writer3MF->GetWorkerThreadCount(), 1);
+		writer3MF->SetWorkerThreadCount(4);
+		ASSERT_EQ(writer3MF->GetWorkerThreadCount(), 4);
+		std::vector<Lib3MF_uint8> buffer;
+		writer3MF->WriteToBuffer(buffer);
+
+		auto readModel = wrapper->CreateModel();
+		auto reader = readModel->QueryReader("3mf");
+		reader->ReadFromBuffer(buffer);
+		ASSERT_EQ(reader->GetWarningCount(), 0);
+
+		auto readMesh = readModel->GetMeshObjectByID(nResourceID);
+		std::vector<sLib3MFPosition> vctReadVertices;
+		std::vector<sLib3MFTriangle> vctReadTriangles;
+		readMesh->GetVertices(vctReadVertices);
+		readMesh->GetTriangleIndices(vctReadTriangles);
+		ASSERT_EQ(vctReadVertices.size(), vctVertices.size());
+		ASSERT_EQ(vctReadTriangles.size(), vctTriangles.size());
+		for (size_t nIndex = 0; nIndex < vctVertices.size(); nIndex++) {
+			for (int j = 0; j < 3; j++)
+				ASSERT_FLOAT_EQ(vctReadVertices[nIndex].m_Coordinates[j], vctVertices[nIndex].m_Coordinates[j]);
+		}
+		for (size_t nIndex = 0; nIndex < vctTriangles.size(); nIndex++) {
+			for (int j = 0; j < 3; j++)
+				ASSERT_EQ(vctReadTriangles[nIndex].m_Indices[j], vctTriangles[nIndex].m_Indices[j]);
+		}
+
+		// Small parts and the empty final block
+		auto pyramidModel = wrapper->CreateModel();
+		pyramidModel->QueryReader("3mf")->ReadFromFile(InFolder + "Pyramid.3mf");
+		auto pyramidWriter = pyramidModel->QueryWriter("3mf");
+		pyramidWriter->SetWorkerThreadCount(2);
+		std::vector<Lib3MF_uint8> pyramidBuffer;
+		pyramidWriter->WriteToBuffer(pyramidBuffer);
+		wrapper->CreateModel()->QueryReader("3mf")->ReadFromBuffer(pyramidBuffer);
+	}
+
+	TEST_F(Writer, 3MFWriteMeshChunksInParallel)
+	{
+		// Vertices and triangles span several chunks and more than one batch
+		auto mesh = model->AddMeshObject();
+		const Lib3MF_uint32 nGridSize = 400;
+		std::vector<sLib3MFPosition> vctVertices;
+		std::vector<sLib3MFTriangle> vctTriangles;
+		for (Lib3MF_uint32 nY = 0; nY < nGridSize; nY++) {
+			for (Lib3MF_uint32 nX = 0; nX < nGridSize; nX++) {
+				vctVertices.push_back(fnCreateVertex(nX * 0.25f, nY * 0.5f, (nX * nY % 7) * 0.125f));
+				if ((nX > 0) && (nY > 0)) {
+					Lib3MF_uint32 nIndex = nY * nGridSize + nX;
+					vctTriangles.push_back(fnCreateTriangle(nIndex - nGridSize - 1, nIndex - nGridSize, nIndex));
+					vctTriangles.push_back(fnCreateTriangle(nIndex - nGridSize - 1, nIndex, nIndex - 1));
+				}
+			}
+		}
+		mesh->SetGeometry(vctVertices, vctTriangles);
+
+		// Triangle properties are resolved on the worker threads
+		auto colorGroup = model->AddColorGroup();
+		Lib3MF_uint32 nRed = colorGroup->AddColor(wrapper->RGBAToColor(255, 0, 0, 255));
+		Lib3MF_uint32 nGreen = colorGroup->AddColor(wrapper->RGBAToColor(0, 255, 0, 255));
+		mesh->SetObjectLevelProperty(colorGroup->GetResourceID(), nRed);
+		sTriangleProperties sProperties;
+		sProperties.m_ResourceID = colorGroup->GetResourceID();
+		sProperties.m_PropertyIDs[0] = nGreen;
+		sProperties.m_PropertyIDs[1] = nGreen;
+		sProperties.m_PropertyIDs[2] = nRed;
+		for (Lib3MF_uint32 nIndex = 0; nIndex < (Lib3MF_uint32)vctTriangles.size(); nIndex += 997)
+			mesh->SetTriangleProperties(nIndex, sProperties);
+
+		// Stored model parts allow to compare the rendered XML byte by byte
+		writer3MF->SetCompressionLevel(ePackagePartType::Model, eCompressionLevel::Stored);
+		std::vector<Lib3MF_uint8> sequentialBuffer;
+		writer3MF->WriteToBuffer(sequentialBuffer);
+
+		writer3MF->SetWorkerThreadCount(3);
+		std::vector<Lib3MF_uint8> parallelBuffer;
+		writer3MF->WriteToBuffer(parallelBuffer);
+
+		ASSERT_EQ(sequentialBuffer.size(), parallelBuffer.size());
+		ASSERT_TRUE(sequentialBuffer == parallelBuffer);
+	}
+
+	TEST_F(Writer, 3MFReportsInvalidObjects)
+	{
+		auto boxModel = wrapper->CreateModel();
+		auto meshObject = boxModel->AddMeshObject();
+		meshObject->SetGeometry(CInputVector<sPosition>(pVertices, 8), CInputVector<sTriangle>(pTriangles, 12));
+		boxModel->AddBuildItem(meshObject.get(), getIdentityTransform());
+		auto writer = boxModel->QueryWriter("3mf");
+
+		std::vector<Lib3MF_uint8> buffer;
+		writer->WriteToBuffer(buffer);
+		ASSERT_EQ(writer->GetWarningCount(), 0);
+
+		// Flipping one triangle breaks the orientation
+		meshObject->SetTriangle(0, fnCreateTriangle(0, 1, 2));
+		ASSERT_FALSE(meshObject->IsValid());
+		writer->WriteToBuffer(buffer);
+		ASSERT_EQ(writer->GetWarningCount(), 1);
+		Lib3MF_uint32 nErrorCode = 0;
+		writer->GetWarning(0, nErrorCode);
+		ASSERT_EQ(nErrorCode, 0x8111);
+
+		writer->SetStrictModeActive(true);
+		ASSERT_THROW(writer->WriteToBuffer(buffer), ELib3MFException);
+
+		meshObject->SetTriangle(0, fnCreateTriangle(2, 1, 0));
+		ASSERT_TRUE(meshObject->IsValid());
+		writer->WriteToBuffer(buffer);
+	}
+
+	TEST_F(Writer, 3MFCompressionLevel)
+	{
+		ASSERT_EQ(writer3MF->GetCompressionLevel(ePackagePartType::Model), eCompressionLevel::Fastest);
+		ASSERT_EQ(writer3MF->GetCompressionLevel(ePackagePartType::Image), eCompressionLevel::Fastest);
+		ASSERT_EQ(writer3MF->GetCompressionLevel(ePackagePartType::Attachment), eCompressionLevel::Fastest);
+
+		// A texture attachment with a payload, which is easy to find in the package
+		std::string sPayload;
+		for (int i = 0; i < 1000; i++)
+			sPayload += "Stored texture payload " + std::to_string(i) + "\n";
+		auto attachment = model->AddAttachment("/3D/Textures/stored.png", "http://schemas.microsoft.com/3dmanufacturing/2013/01/3dtexture");
+		attachment->ReadFromBuffer(CInputVector<Lib3MF_uint8>((Lib3MF_uint8*)sPayload.data(), sPayload.size()));
+
+		std::vector<Lib3MF_uint8> fastestBuffer;
+		writer3MF->WriteToBuffer(fastestBuffer);
+		ASSERT_TRUE(std::search(fastestBuffer.begin(), fastestBuffer.end(), sPayload.begin(), sPayload.end()) == fastestBuffer.end());
+
+		writer3MF->SetCompressionLevel(ePackagePartType::Image, eCompressionLevel::Stored);
+		writer3MF->SetCompressionLevel(ePackagePartType::Model, eCompressionLevel::Maximum);
+		ASSERT_EQ(writer3MF->GetCompressionLevel(ePackagePartType::Image), eCompressionLevel::Stored);
+		ASSERT_EQ(writer3MF->GetCompressionLevel(ePackagePartType::Model), eCompressionLevel::Maximum);
+
+		std::vector<Lib3MF_uint8> storedBuffer;
+		writer3MF->WriteToBuffer(storedBuffer);
+		ASSERT_TRUE(std::search(storedBuffer.begin(), storedBuffer.end(), sPayload.begin(), sPayload.end()) != storedBuffer.end());
+
+		auto readModel = wrapper->CreateModel();
+		auto reader = readModel->QueryReader("3mf");
+		reader->ReadFromBuffer(storedBuffer);
+		ASSERT_EQ(reader->GetWarningCount(), 0);
+		std::vector<Lib3MF_uint8> readPayload;
+		readModel->FindAttachment("/3D/Textures/stored.png")->WriteToBuffer(readPayload);
+		ASSERT_EQ(readPayload.size(), sPayload.size());
+		ASSERT_TRUE(std::equal(readPayload.begin(), readPayload.end(), sPayload.begin()));
+	}
+
+	TEST_F(Writer, 3MFStreamingWriter)
+	{
+		// A grid, which is streamed row by row and is never held as a whole by the writer
+		const Lib3MF_uint32 nGridSize = 120;
+		auto fnGridVertex = [](Lib3MF_uint32 nX, Lib3MF_uint32 nY) {
+			return fnCreateVertex(0.5f * nX, 0.25f * nY, 0.01f * ((nX * nY) % 100));
+		};
+
+		std::string sFileName = OutFolder + "Streamed.3mf";
+		auto streamingWriter = wrapper->CreateStreamingWriter(sFileName, eModelUnit::CentiMeter);
+
+		Lib3MF_uint32 nBoxID = streamingWriter->BeginMeshObject("Box");
+		streamingWriter->AddVertices(CInputVector<sPosition>(pVertices, 5));
+		streamingWriter->AddVertices(CInputVector<sPosition>(&pVertices[5], 3));
+		streamingWriter->AddTriangles(CInputVector<sTriangle>(pTriangles, 7));
+		// Vertices cannot follow triangles, and triangles must refer to known vertices
+		ASSERT_SPECIFIC_THROW(streamingWriter->AddVertices(CInputVector<sPosition>(pVertices, 1)), ELib3MFException);
+		sTriangle invalidTriangle = fnCreateTriangle(0, 1, 8);
+		ASSERT_SPECIFIC_THROW(streamingWriter->AddTriangles(CInputVector<sTriangle>(&invalidTriangle, 1)), ELib3MFException);
+		streamingWriter->AddTriangles(CInputVector<sTriangle>(&pTriangles[7], 5));
+		// Only finished objects can be referenced by build items
+		ASSERT_SPECIFIC_THROW(streamingWriter->AddBuildItem(nBoxID, getIdentityTransform()), ELib3MFException);
+		streamingWriter->EndMeshObject();
+		streamingWriter->AddBuildItem(nBoxID, getIdentityTransform());
+
+		Lib3MF_uint32 nGridID = streamingWriter->BeginMeshObject("");
+		std::vector<sPosition> rowVertices(nGridSize);
+		for (Lib3MF_uint32 nY = 0; nY < nGridSize; nY++) {
+			for (Lib3MF_uint32 nX = 0; nX < nGridSize; nX++)
+				rowVertices[nX] = fnGridVertex(nX, nY);
+			streamingWriter->AddVertices(rowVertices);
+		}
+		std::vector<sTriangle> rowTriangles;
+		for (Lib3MF_uint32 nY = 0; nY + 1 < nGridSize; nY++) {
+			rowTriangles.clear();
+			for (Lib3MF_uint32 nX = 0; nX + 1 < nGridSize; nX++) {
+				Lib3MF_uint32 nIndex = nY * nGridSize + nX;
+				rowTriangles.push_back(fnCreateTriangle(nIndex, nIndex + 1, nIndex + nGridSize + 1));
+				rowTriangles.push_back(fnCreateTriangle(nIndex, nIndex + nGridSize + 1, nIndex + nGridSize));
+			}
+			streamingWriter->AddTriangles(rowTriangles);
+		}
+		streamingWriter->EndMeshObject();
+
+		sTransform translation = getIdentityTransform();
+		translation.m_Fields[3][0] = 150.0f;
+		streamingWriter->AddBuildItem(nGridID, translation);
+		ASSERT_SPECIFIC_THROW(streamingWriter->AddBuildItem(nGridID + 1, translation), ELib3MFException);
+		streamingWriter->Finish();
+		ASSERT_SPECIFIC_THROW(streamingWriter->BeginMeshObject("Late"), ELib3MFException);
+		streamingWriter.reset();
+
+		auto readModel = wrapper->CreateModel();
+		auto reader = readModel->QueryReader("3mf");
+		reader->ReadFromFile(sFileName);
+		ASSERT_EQ(reader->GetWarningCount(), 0);
+		ASSERT_EQ(readModel->GetUnit(), eModelUnit::CentiMeter);
+
+		auto meshObjects = readModel->GetMeshObjects();
+		ASSERT_EQ(meshObjects->Count(), 2);
+		ASSERT_TRUE(meshObjects->MoveNext());
+		auto box = meshObjects->GetCurrentMeshObject();
+		ASSERT_TRUE(meshObjects->MoveNext());
+		auto grid = meshObjects->GetCurrentMeshObject();
+		ASSERT_EQ(box->GetModelResourceID(), nBoxID);
+		ASSERT_EQ(grid->GetModelResourceID(), nGridID);
+		ASSERT_EQ(box->GetName(), "Box");
+		std::vector<sPosition> boxVertices;
+		std::vector<sTriangle> boxTriangles;
+		box->GetVertices(boxVertices);
+		box->GetTriangleIndices(boxTriangles);
+		ASSERT_EQ(boxVertices.size(), 8);
+		ASSERT_EQ(boxTriangles.size(), 12);
+		for (Lib3MF_uint32 nIndex = 0; nIndex < 8; nIndex++)
+			for (int j = 0; j < 3; j++)
+				ASSERT_EQ(boxVertices[nIndex].m_Coordinates[j], pVertices[nIndex].m_Coordinates[j]);
+		for (Lib3MF_uint32 nIndex = 0; nIndex < 12; nIndex++)
+			for (int j = 0; j < 3; j++)
+				ASSERT_EQ(boxTriangles[nIndex].m_Indices[j], pTriangles[nIndex].m_Indices[j]);
+
+		ASSERT_EQ(grid->GetVertexCount(), nGridSize * nGridSize);
+		ASSERT_EQ(grid->GetTriangleCount(), 2 * (nGridSize - 1) * (nGridSize - 1));
+		std::vector<sPosition> gridVertices;
+		grid->GetVertices(gridVertices);
+		for (Lib3MF_uint32 nY = 0; nY < nGridSize; nY++) {
+			for (Lib3MF_uint32 nX = 0; nX < nGridSize; nX++) {
+				sPosition expected = fnGridVertex(nX, nY);
+				for (int j = 0; j < 3; j++)
+					ASSERT_NEAR(gridVertices[nY * nGridSize + nX].m_Coordinates[j], expected.m_Coordinates[j], 1E-5);
+			}
+		}
+		sTriangle lastTriangle = grid->GetTriangle(grid->GetTriangleCount() - 1);
+		ASSERT_EQ(lastTriangle.m_Indices[2], nGridSize * nGridSize - 2);
+
+		auto buildItems = readModel->GetBuildItems();
+		ASSERT_EQ(buildItems->Count(), 2);
+		ASSERT_TRUE(buildItems->MoveNext());
+		ASSERT_EQ(buildItems->GetCurrent()->GetObjectResourceID(), box->GetUniqueResourceID());
+		ASSERT_FALSE(buildItems->GetCurrent()->HasObjectTransform());
+		ASSERT_TRUE(buildItems->MoveNext());
+		ASSERT_EQ(buildItems->GetCurrent()->GetObjectResourceID(), grid->GetUniqueResourceID());
+		ASSERT_EQ(buildItems->GetCurrent()->GetObjectTransform().m_Fields[3][0], 150.0f);
+	}
 }